@@ -0,0 +1,44 @@
+#pragma once
+
+#include "EditorCommand.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace Genesis {
+
+    // Undo/redo stack over EditorCommand objects. Every entry stores only
+    // the delta the command itself captured (old/new field bytes, one
+    // entity's components), never a scene copy, so hundreds of operations
+    // cost kilobytes. Commands arriving in quick succession are offered
+    // to the previous one via TryMerge, which collapses a slider drag
+    // into a single history entry.
+    class CommandHistory {
+    public:
+        static constexpr size_t MAX_DEPTH = 512;
+        static constexpr float MERGE_WINDOW_SECONDS = 0.5f;
+
+        // Runs the command and records it (or folds it into the previous
+        // entry). Anything past the cursor - the redo branch - is dropped.
+        void Execute(std::unique_ptr<EditorCommand> command);
+
+        bool CanUndo() const { return m_Cursor > 0; }
+        bool CanRedo() const { return m_Cursor < m_Commands.size(); }
+
+        void Undo();
+        void Redo();
+
+        const char* GetUndoName() const;
+        const char* GetRedoName() const;
+
+        void Clear();
+
+    private:
+        // Entries [0, m_Cursor) are applied; the rest are redoable
+        std::vector<std::unique_ptr<EditorCommand>> m_Commands;
+        size_t m_Cursor = 0;
+        std::chrono::steady_clock::time_point m_LastExecuteTime{};
+    };
+
+}
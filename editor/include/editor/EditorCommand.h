@@ -0,0 +1,128 @@
+#pragma once
+
+#include "PropertyModel.h"
+
+#include <genesis/Genesis.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace Genesis {
+
+    // Reversible editor operation. Commands carry the compact before and
+    // after state of what they touch - never scene copies - so a deep
+    // undo history stays cheap.
+    class EditorCommand {
+    public:
+        virtual ~EditorCommand() = default;
+
+        virtual void Execute() = 0;
+        virtual void Undo() = 0;
+        virtual const char* GetName() const = 0;
+
+        // Fold a follow-up command into this one when both edit the same
+        // target (slider drags emit a command per frame; the history
+        // should record one). Returns false when the pair can't merge.
+        virtual bool TryMerge(const EditorCommand& next) { (void)next; return false; }
+    };
+
+    // Writes one reflected component field; the delta is the field's old
+    // and new bytes, a few dozen bytes per history entry
+    class SetPropertyCommand : public EditorCommand {
+    public:
+        SetPropertyCommand(Entity entity, const ComponentDescriptor* component,
+                           const PropertyField* field, const PropertyValue& oldValue,
+                           const PropertyValue& newValue);
+
+        void Execute() override;
+        void Undo() override;
+        const char* GetName() const override { return m_Field->Name; }
+        bool TryMerge(const EditorCommand& next) override;
+
+    private:
+        void Apply(const PropertyValue& value);
+
+        Entity m_Entity;
+        const ComponentDescriptor* m_Component;
+        const PropertyField* m_Field;
+        PropertyValue m_OldValue;
+        PropertyValue m_NewValue;
+    };
+
+    // Copy of one entity's components, captured before a destroy so the
+    // undo can rebuild the entity in place. Component types are listed
+    // explicitly; the per-entity cost is the sum of the components it
+    // actually had, nothing scene-sized.
+    template<typename... Ts>
+    struct ComponentSnapshot {
+        std::tuple<std::optional<Ts>...> Data;
+
+        void Capture(Entity entity) {
+            (CaptureOne<Ts>(entity), ...);
+        }
+
+        void Restore(Entity entity) const {
+            (RestoreOne<Ts>(entity), ...);
+        }
+
+    private:
+        template<typename T>
+        void CaptureOne(Entity entity) {
+            if (entity.HasComponent<T>()) {
+                std::get<std::optional<T>>(Data) = entity.GetComponent<T>();
+            }
+        }
+
+        template<typename T>
+        void RestoreOne(Entity entity) const {
+            const auto& value = std::get<std::optional<T>>(Data);
+            if (value) {
+                entity.AddComponent<T>(*value);
+            }
+        }
+    };
+
+    using AllComponentsSnapshot =
+        ComponentSnapshot<TagComponent, TransformComponent, MeshRendererComponent,
+                          CameraComponent, DirectionalLightComponent, PointLightComponent,
+                          ProceduralMeshComponent, RigidbodyComponent, BoxColliderComponent>;
+
+    // Entity creation; undo destroys it, redo recreates it under the
+    // same ID so later commands referencing the entity stay valid
+    class CreateEntityCommand : public EditorCommand {
+    public:
+        CreateEntityCommand(Scene* scene, std::string name);
+
+        void Execute() override;
+        void Undo() override;
+        const char* GetName() const override { return "Create Entity"; }
+
+        Entity GetEntity() const { return Entity(m_ID, m_Scene); }
+
+    private:
+        Scene* m_Scene;
+        std::string m_Name;
+        uint64_t m_ID = 0;
+    };
+
+    // Entity destruction; the components are snapshotted at first execute
+    // and restored verbatim on undo
+    class DestroyEntityCommand : public EditorCommand {
+    public:
+        explicit DestroyEntityCommand(Entity entity);
+
+        void Execute() override;
+        void Undo() override;
+        const char* GetName() const override { return "Destroy Entity"; }
+
+    private:
+        Scene* m_Scene;
+        uint64_t m_ID;
+        std::string m_Name;
+        AllComponentsSnapshot m_Snapshot;
+        bool m_Captured = false;
+    };
+
+}
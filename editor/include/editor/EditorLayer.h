@@ -1,5 +1,7 @@
 #pragma once
 
+#include "CommandHistory.h"
+
 #include <genesis/Genesis.h>
 #include <memory>
 
@@ -18,6 +20,7 @@ namespace Genesis {
         void OnAttach() override;
         void OnDetach() override;
         void OnUpdate(float deltaTime) override;
+        void OnFixedUpdate(float fixedDeltaTime) override;
         void OnRender() override;
         void OnImGuiRender() override;
         void OnEvent(Event& event) override;
@@ -47,6 +50,7 @@ namespace Genesis {
         // Editor State
         Entity m_SelectedEntity;
         int m_GizmoType = -1;
+        CommandHistory m_CommandHistory;
 
         // Performance
         float m_FrameTime = 0.0f;
@@ -1,21 +1,101 @@
 #pragma once
 
 #include <genesis/Genesis.h>
+#include <genesis/renderer/HeightmapTexture.h>
+
+#include <atomic>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace Genesis {
 
+    // File browser over the asset directory. Directory reads never touch
+    // the UI thread: navigation kicks a background scan job and the panel
+    // keeps showing the previous listing until the new one lands. A cheap
+    // signature probe re-runs periodically so external changes (files
+    // added or removed outside the editor) refresh the listing without
+    // rescanning every frame.
+    //
+    // Thumbnails live in one shared atlas texture; tiles are generated
+    // once, persisted to disk keyed by the file's size and write time,
+    // and re-uploaded from that cache on later visits.
     class AssetBrowserPanel {
     public:
         AssetBrowserPanel();
 
+        void Init(Renderer& renderer);
+        void Shutdown();
+
         void OnImGuiRender();
 
     private:
+        struct AssetEntry {
+            std::string Name;
+            std::filesystem::path Path;
+            bool IsDirectory = false;
+            uint64_t Size = 0;
+            uint64_t WriteTime = 0;
+            int ThumbSlot = -1;
+        };
+
+        // One background scan's output; the UI adopts it when Done flips
+        struct ScanResult {
+            std::filesystem::path Directory;
+            std::vector<AssetEntry> Entries;
+            uint64_t Signature = 0;
+            std::atomic<bool> Done{false};
+        };
+
+        void RequestScan(const std::filesystem::path& directory);
+        void AdoptScanIfReady();
+        void ProbeForChanges(float deltaTime);
+
+        int AcquireThumbnail(AssetEntry& entry);
+        void GenerateThumbnail(const AssetEntry& entry, uint8_t* rgba);
+        std::filesystem::path ThumbnailCachePath(const AssetEntry& entry) const;
+
+        static uint64_t DirectorySignature(const std::filesystem::path& directory);
+
+    private:
+        // Atlas geometry: THUMB_SIZE-square tiles packed row-major into a
+        // single ATLAS_DIM-square texture
+        static constexpr int THUMB_SIZE = 64;
+        static constexpr int ATLAS_DIM = 1024;
+        static constexpr int ATLAS_COLUMNS = ATLAS_DIM / THUMB_SIZE;
+        static constexpr int ATLAS_SLOTS = ATLAS_COLUMNS * ATLAS_COLUMNS;
+
+        // Seconds between background signature probes of the current
+        // directory; a probe is one readdir, not a full scan
+        static constexpr float CHANGE_PROBE_INTERVAL = 1.0f;
+
         std::filesystem::path m_CurrentDirectory;
         std::filesystem::path m_BaseDirectory;
+        std::filesystem::path m_ThumbnailDirectory;
+
+        Renderer* m_Renderer = nullptr;
+
+        // Listing currently shown; replaced wholesale when a scan lands
+        std::vector<AssetEntry> m_Entries;
+        uint64_t m_CurrentSignature = 0;
+        bool m_ScanInFlight = false;
+        std::shared_ptr<ScanResult> m_PendingScan;
+
+        // Signature probe result, written by the probe job
+        std::shared_ptr<std::atomic<uint64_t>> m_ProbedSignature;
+        float m_ProbeTimer = 0.0f;
+        bool m_ProbeInFlight = false;
 
-        // Thumbnail cache would go here
+        // Thumbnail atlas: CPU mirror plus slot assignment by cache key.
+        // UpdateRGBA diffs rows, so touching one tile uploads one tile.
+        std::unique_ptr<HeightmapTexture> m_Atlas;
+        std::vector<uint8_t> m_AtlasPixels;
+        std::unordered_map<uint64_t, int> m_SlotByKey;
+        int m_NextSlot = 0;
+        bool m_AtlasDirty = false;
     };
 
 }
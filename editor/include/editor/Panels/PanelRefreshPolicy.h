@@ -0,0 +1,35 @@
+#pragma once
+
+namespace Genesis {
+
+    // Per-panel refresh throttle. An ImGui window has to submit its
+    // widgets every frame to stay on screen, but the expensive part of a
+    // panel - cache rebuilds, component re-reads, filesystem probes -
+    // does not. Panels call Tick once per frame after ImGui::Begin:
+    // active (focused or hovered) panels refresh every frame, background
+    // panels drop to 10 Hz. The viewport never throttles and does not
+    // use this.
+    class PanelRefreshPolicy {
+    public:
+        bool Tick(bool panelActive, float deltaTime) {
+            if (panelActive) {
+                // Keep the timer primed so the frame after losing focus
+                // still refreshes
+                m_Timer = BACKGROUND_INTERVAL;
+                return true;
+            }
+            m_Timer += deltaTime;
+            if (m_Timer >= BACKGROUND_INTERVAL) {
+                m_Timer = 0.0f;
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        static constexpr float BACKGROUND_INTERVAL = 0.1f; // 10 Hz when unfocused
+
+        float m_Timer = BACKGROUND_INTERVAL; // first tick always refreshes
+    };
+
+}
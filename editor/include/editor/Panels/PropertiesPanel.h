@@ -1,24 +1,58 @@
 #pragma once
 
+#include "EditorCommand.h"
+#include "PropertyModel.h"
+
+#include "Panels/PanelRefreshPolicy.h"
+
 #include <genesis/Genesis.h>
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 namespace Genesis {
 
+    // Component editor for the selected entity, driven by the reflected
+    // property tables in PropertyModel. Widgets render from a cached
+    // field snapshot; components are re-read only when the selection or
+    // the scene's component version changes, not every frame. Edits go
+    // out as SetPropertyCommand objects through the command handler so
+    // they can land on an undo stack.
     class PropertiesPanel {
     public:
+        using CommandHandler = std::function<void(std::unique_ptr<EditorCommand>)>;
+
         PropertiesPanel() = default;
 
         void OnImGuiRender();
         void SetSelectedEntity(Entity entity) { m_SelectedEntity = entity; }
 
+        // Receives every edit command; defaults to executing immediately
+        // when unset. The undo system installs its stack here.
+        void SetCommandHandler(CommandHandler handler) { m_CommandHandler = std::move(handler); }
+
     private:
-        void DrawComponents(Entity entity);
+        struct CachedComponent {
+            const ComponentDescriptor* Descriptor;
+            std::vector<PropertyValue> Values; // parallel to Descriptor->Fields
+        };
 
-        template<typename T>
-        void DrawComponent(const std::string& name, Entity entity, void (*uiFunction)(T&));
+        void RefreshCache();
+        void DrawComponent(CachedComponent& cached);
+        void SubmitEdit(CachedComponent& cached, size_t fieldIndex, const PropertyValue& newValue);
 
     private:
         Entity m_SelectedEntity;
+        CommandHandler m_CommandHandler;
+
+        // Snapshot the widgets render from, keyed on the entity and the
+        // scene's component version
+        std::vector<CachedComponent> m_Cache;
+        uint64_t m_CachedEntityID = 0;
+        uint64_t m_CachedComponentVersion = UINT64_MAX;
+
+        PanelRefreshPolicy m_RefreshPolicy;
     };
 
 }
@@ -1,10 +1,20 @@
 #pragma once
 
+#include "Panels/PanelRefreshPolicy.h"
+
 #include <genesis/Genesis.h>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace Genesis {
 
+    // Entity list for the active scene. Built to stay cheap at high
+    // entity counts: the name-sorted entity cache rebuilds only when the
+    // scene's entity-list version moves, the search filter narrows
+    // incrementally (typing refines the previous result set instead of
+    // rescanning everything), and a list clipper submits widgets only
+    // for the rows actually in view.
     class SceneHierarchyPanel {
     public:
         SceneHierarchyPanel() = default;
@@ -17,12 +27,32 @@ namespace Genesis {
         void SetSelectedEntity(Entity entity) { m_SelectedEntity = entity; }
 
     private:
-        void DrawEntityNode(Entity entity);
+        struct CachedEntity {
+            uint64_t ID;
+            // Interned handle; display and lower-cased filter text resolve
+            // through NameTable, so rebuilds allocate nothing per entity
+            NameHandle Name;
+        };
+
+        void DrawEntityNode(const CachedEntity& entry);
         void DrawComponents(Entity entity);
 
+        void RebuildEntityCache();
+        void ApplyFilter(const std::string& lowerFilter, bool narrowing);
+
     private:
         std::shared_ptr<Scene> m_Scene;
         Entity m_SelectedEntity;
+
+        // Cached view of the scene, keyed on GetEntityListVersion
+        std::vector<CachedEntity> m_CachedEntities; // sorted by name
+        std::vector<uint32_t> m_FilteredIndices;    // indices into the cache
+        uint64_t m_CachedVersion = UINT64_MAX;
+
+        char m_SearchBuffer[128] = "";
+        std::string m_AppliedFilter; // lowercased filter the indices reflect
+
+        PanelRefreshPolicy m_RefreshPolicy;
     };
 
 }
@@ -1,26 +1,53 @@
 #pragma once
 
 #include <genesis/Genesis.h>
+#include <genesis/renderer/ViewportTarget.h>
 #include <glm/glm.hpp>
 
 namespace Genesis {
 
+    // Scene viewport backed by an offscreen render target sized to the
+    // panel, not the window. The target runs at a dynamic resolution
+    // scale: it drops to half resolution while the camera is being
+    // manipulated and sharpens back to full once input goes idle, so
+    // orbiting on a high-DPI monitor shades a fraction of the pixels.
     class ViewportPanel {
     public:
         ViewportPanel() = default;
 
+        void Init(Renderer& renderer);
+        void Shutdown();
+
         void OnImGuiRender();
         void OnUpdate(float deltaTime);
 
+        ViewportTarget& GetTarget() { return m_Target; }
+
         glm::vec2 GetSize() const { return m_ViewportSize; }
         bool IsFocused() const { return m_IsFocused; }
         bool IsHovered() const { return m_IsHovered; }
 
     private:
+        // Render resolution while the camera is manipulated; 1.0 on idle
+        static constexpr float MANIPULATION_SCALE = 0.5f;
+        // Seconds the panel size must hold steady before the target is
+        // recreated - Resize waits for device idle, so it must not run
+        // on every frame of a drag
+        static constexpr float RESIZE_DEBOUNCE_SECONDS = 0.2f;
+
+        Renderer* m_Renderer = nullptr;
+        ViewportTarget m_Target;
+
         glm::vec2 m_ViewportSize{0.0f, 0.0f};
         glm::vec2 m_ViewportBounds[2];
         bool m_IsFocused = false;
         bool m_IsHovered = false;
+
+        float m_RenderScale = 1.0f;
+        float m_ResizeTimer = 0.0f;
+        bool m_ResizePending = false;
+        uint32_t m_PendingWidth = 0;
+        uint32_t m_PendingHeight = 0;
     };
 
 }
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <genesis/Genesis.h>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace Genesis {
+
+    // Reflection-lite description of the editable fields on a component.
+    // Each entry names a POD field by byte offset; panels render widgets
+    // from these tables instead of hand-writing one editor per component,
+    // and commands patch fields generically through the same offsets.
+    enum class PropertyType {
+        Float,
+        Float3,
+        Color3,
+        Bool,
+        Int,
+    };
+
+    struct PropertyField {
+        const char* Name;
+        PropertyType Type;
+        size_t Offset;
+        // Drag widget tuning; ignored for Bool and Color3
+        float Speed = 0.1f;
+        float Min = 0.0f;
+        float Max = 0.0f;
+    };
+
+    // Largest field is a vec3; values pass through commands and caches as
+    // raw bytes sized by the field type
+    struct PropertyValue {
+        unsigned char Bytes[16] = {};
+    };
+
+    size_t PropertyTypeSize(PropertyType type);
+
+    // Type-erased component access so panels and commands can walk every
+    // component an entity has without a template dispatch per type
+    struct ComponentDescriptor {
+        const char* Name;
+        bool (*Has)(Entity entity);
+        void* (*Get)(Entity entity);
+        const std::vector<PropertyField>* Fields;
+    };
+
+    const std::vector<ComponentDescriptor>& GetComponentDescriptors();
+
+    inline PropertyValue ReadProperty(void* component, const PropertyField& field) {
+        PropertyValue value;
+        std::memcpy(value.Bytes, static_cast<char*>(component) + field.Offset,
+                    PropertyTypeSize(field.Type));
+        return value;
+    }
+
+    inline void WriteProperty(void* component, const PropertyField& field,
+                              const PropertyValue& value) {
+        std::memcpy(static_cast<char*>(component) + field.Offset, value.Bytes,
+                    PropertyTypeSize(field.Type));
+    }
+
+}
@@ -0,0 +1,62 @@
+#include "CommandHistory.h"
+
+namespace Genesis {
+
+    void CommandHistory::Execute(std::unique_ptr<EditorCommand> command) {
+        command->Execute();
+
+        // Executing after an undo abandons the redo branch
+        m_Commands.resize(m_Cursor);
+
+        auto now = std::chrono::steady_clock::now();
+        float sinceLast =
+            std::chrono::duration<float>(now - m_LastExecuteTime).count();
+        m_LastExecuteTime = now;
+
+        if (!m_Commands.empty() && sinceLast < MERGE_WINDOW_SECONDS &&
+            m_Commands.back()->TryMerge(*command)) {
+            return; // coalesced into the previous entry
+        }
+
+        m_Commands.push_back(std::move(command));
+        m_Cursor++;
+
+        if (m_Commands.size() > MAX_DEPTH) {
+            m_Commands.erase(m_Commands.begin());
+            m_Cursor--;
+        }
+    }
+
+    void CommandHistory::Undo() {
+        if (!CanUndo()) {
+            return;
+        }
+        m_Cursor--;
+        m_Commands[m_Cursor]->Undo();
+        // An undone entry must not absorb the next edit
+        m_LastExecuteTime = {};
+    }
+
+    void CommandHistory::Redo() {
+        if (!CanRedo()) {
+            return;
+        }
+        m_Commands[m_Cursor]->Execute();
+        m_Cursor++;
+        m_LastExecuteTime = {};
+    }
+
+    const char* CommandHistory::GetUndoName() const {
+        return CanUndo() ? m_Commands[m_Cursor - 1]->GetName() : nullptr;
+    }
+
+    const char* CommandHistory::GetRedoName() const {
+        return CanRedo() ? m_Commands[m_Cursor]->GetName() : nullptr;
+    }
+
+    void CommandHistory::Clear() {
+        m_Commands.clear();
+        m_Cursor = 0;
+    }
+
+}
@@ -0,0 +1,80 @@
+#include "EditorCommand.h"
+
+namespace Genesis {
+
+    SetPropertyCommand::SetPropertyCommand(Entity entity, const ComponentDescriptor* component,
+                                           const PropertyField* field,
+                                           const PropertyValue& oldValue,
+                                           const PropertyValue& newValue)
+        : m_Entity(entity),
+          m_Component(component),
+          m_Field(field),
+          m_OldValue(oldValue),
+          m_NewValue(newValue) {
+    }
+
+    void SetPropertyCommand::Apply(const PropertyValue& value) {
+        if (!m_Entity.IsValid() || !m_Component->Has(m_Entity)) {
+            return; // target was destroyed since the command was recorded
+        }
+        WriteProperty(m_Component->Get(m_Entity), *m_Field, value);
+        m_Entity.GetScene()->MarkComponentsChanged();
+    }
+
+    void SetPropertyCommand::Execute() {
+        Apply(m_NewValue);
+    }
+
+    void SetPropertyCommand::Undo() {
+        Apply(m_OldValue);
+    }
+
+    bool SetPropertyCommand::TryMerge(const EditorCommand& next) {
+        const auto* other = dynamic_cast<const SetPropertyCommand*>(&next);
+        if (!other || other->m_Entity != m_Entity || other->m_Component != m_Component ||
+            other->m_Field != m_Field) {
+            return false;
+        }
+        // One drag, one history entry: keep this command's old value and
+        // adopt the newest new value
+        m_NewValue = other->m_NewValue;
+        return true;
+    }
+
+    CreateEntityCommand::CreateEntityCommand(Scene* scene, std::string name)
+        : m_Scene(scene), m_Name(std::move(name)) {
+    }
+
+    void CreateEntityCommand::Execute() {
+        if (m_ID == 0) {
+            m_ID = m_Scene->CreateEntity(m_Name).GetID();
+        } else {
+            m_Scene->CreateEntityWithID(m_ID, m_Name);
+        }
+    }
+
+    void CreateEntityCommand::Undo() {
+        m_Scene->DestroyEntity(Entity(m_ID, m_Scene));
+    }
+
+    DestroyEntityCommand::DestroyEntityCommand(Entity entity)
+        : m_Scene(entity.GetScene()), m_ID(entity.GetID()) {
+    }
+
+    void DestroyEntityCommand::Execute() {
+        Entity entity(m_ID, m_Scene);
+        if (!m_Captured) {
+            m_Name = m_Scene->GetEntityName(m_ID);
+            m_Snapshot.Capture(entity);
+            m_Captured = true;
+        }
+        m_Scene->DestroyEntity(entity);
+    }
+
+    void DestroyEntityCommand::Undo() {
+        Entity entity = m_Scene->CreateEntityWithID(m_ID, m_Name);
+        m_Snapshot.Restore(entity);
+        m_Scene->MarkComponentsChanged();
+    }
+
+}
@@ -4,6 +4,10 @@
 #include "Panels/ViewportPanel.h"
 #include "Panels/AssetBrowserPanel.h"
 
+#include <genesis/renderer/PickingPass.h>
+
+#include <imgui.h>
+
 namespace Genesis {
 
     EditorLayer::EditorLayer()
@@ -25,10 +29,21 @@ namespace Genesis {
         m_EditorCamera.LookAt({0.0f, 0.0f, 0.0f});
 
         // Initialize panels (would use ImGui in full implementation)
-        // m_SceneHierarchyPanel = std::make_unique<SceneHierarchyPanel>(m_ActiveScene);
-        // m_PropertiesPanel = std::make_unique<PropertiesPanel>();
-        // m_ViewportPanel = std::make_unique<ViewportPanel>();
-        // m_AssetBrowserPanel = std::make_unique<AssetBrowserPanel>();
+        m_SceneHierarchyPanel = std::make_unique<SceneHierarchyPanel>(m_ActiveScene);
+        m_PropertiesPanel = std::make_unique<PropertiesPanel>();
+        m_PropertiesPanel->SetCommandHandler([this](std::unique_ptr<EditorCommand> command) {
+            m_CommandHistory.Execute(std::move(command));
+        });
+
+        // The viewport panel owns the offscreen target the scene renders
+        // into; registering it redirects the renderer's scene pass there
+        auto& renderer = Application::Get().GetRenderer();
+        m_ViewportPanel = std::make_unique<ViewportPanel>();
+        m_ViewportPanel->Init(renderer);
+        renderer.SetViewportTarget(&m_ViewportPanel->GetTarget());
+
+        m_AssetBrowserPanel = std::make_unique<AssetBrowserPanel>();
+        m_AssetBrowserPanel->Init(renderer);
 
         // Create some default entities for testing
         auto ground = m_ActiveScene->CreateEntity("Ground");
@@ -38,19 +53,57 @@ namespace Genesis {
 
     void EditorLayer::OnDetach() {
         GEN_INFO("EditorLayer detached");
+
+        if (m_ViewportPanel) {
+            Application::Get().GetRenderer().SetViewportTarget(nullptr);
+            m_ViewportPanel->Shutdown();
+            m_ViewportPanel.reset();
+        }
+        if (m_AssetBrowserPanel) {
+            m_AssetBrowserPanel->Shutdown();
+            m_AssetBrowserPanel.reset();
+        }
     }
 
     void EditorLayer::OnUpdate(float deltaTime) {
         m_FrameTime = deltaTime;
 
+        if (m_ViewportPanel) {
+            m_ViewportPanel->OnUpdate(deltaTime);
+            m_ViewportFocused = m_ViewportPanel->IsFocused();
+            m_ViewportHovered = m_ViewportPanel->IsHovered();
+
+            // The camera projects into the panel, not the window
+            glm::vec2 size = m_ViewportPanel->GetSize();
+            if (size.x > 0.0f && size.y > 0.0f) {
+                m_EditorCamera.SetAspectRatio(size.x / size.y);
+            }
+        }
+
         // Handle editor camera movement
         if (m_ViewportFocused) {
             // WASD camera controls would go here
         }
 
-        // Update active scene
+        // Resolve viewport picks delivered by the async ID-buffer readback.
+        // Entity draws tag themselves with entity ID + 1; a miss clears the
+        // selection and chunk hits carry no entity to select.
+        uint32_t pickId = 0;
+        if (m_SceneHierarchyPanel &&
+            Application::Get().GetRenderer().TryTakePickResult(pickId)) {
+            if (pickId == 0) {
+                m_SceneHierarchyPanel->SetSelectedEntity({});
+            } else if (!(pickId & PICK_ID_CHUNK_BIT)) {
+                m_SceneHierarchyPanel->SetSelectedEntity(Entity(pickId - 1, m_ActiveScene.get()));
+            }
+        }
+    }
+
+    void EditorLayer::OnFixedUpdate(float fixedDeltaTime) {
+        // Simulation (ECS systems) advances on the fixed tick so it costs
+        // the same at any refresh rate; camera and panels stay per-frame
         if (m_ActiveScene) {
-            m_ActiveScene->OnUpdate(deltaTime);
+            m_ActiveScene->OnUpdate(fixedDeltaTime);
         }
     }
 
@@ -65,12 +118,51 @@ namespace Genesis {
     }
 
     void EditorLayer::OnImGuiRender() {
-        // ImGui editor UI would go here
+        // Global editor shortcuts (skipped while a text field has focus)
+        ImGuiIO& io = ImGui::GetIO();
+        if (!io.WantTextInput) {
+            if (io.KeyCtrl && ImGui::IsKeyPressed(ImGuiKey_Z, false)) {
+                if (io.KeyShift) {
+                    m_CommandHistory.Redo();
+                } else {
+                    m_CommandHistory.Undo();
+                }
+            }
+            if (io.KeyCtrl && ImGui::IsKeyPressed(ImGuiKey_Y, false)) {
+                m_CommandHistory.Redo();
+            }
+
+            // Delete goes through the history so it can be undone
+            if (ImGui::IsKeyPressed(ImGuiKey_Delete, false) && m_SceneHierarchyPanel) {
+                Entity selected = m_SceneHierarchyPanel->GetSelectedEntity();
+                if (selected) {
+                    m_CommandHistory.Execute(std::make_unique<DestroyEntityCommand>(selected));
+                    m_SceneHierarchyPanel->SetSelectedEntity({});
+                }
+            }
+        }
+
+        if (m_ViewportPanel) {
+            m_ViewportPanel->OnImGuiRender();
+        }
+        if (m_SceneHierarchyPanel) {
+            m_SceneHierarchyPanel->OnImGuiRender();
+        }
+        if (m_PropertiesPanel) {
+            if (m_SceneHierarchyPanel) {
+                m_PropertiesPanel->SetSelectedEntity(m_SceneHierarchyPanel->GetSelectedEntity());
+            }
+            m_PropertiesPanel->OnImGuiRender();
+        }
+        if (m_AssetBrowserPanel) {
+            m_AssetBrowserPanel->OnImGuiRender();
+        }
+
+        // Remaining editor UI would go here
         // - Dockspace
         // - Menu bar
         // - Scene hierarchy
         // - Properties
-        // - Viewport
         // - Asset browser
         // - Console
     }
@@ -82,6 +174,11 @@ namespace Genesis {
     void EditorLayer::NewScene() {
         m_EditorScene = std::make_shared<Scene>();
         m_ActiveScene = m_EditorScene;
+        if (m_SceneHierarchyPanel) {
+            m_SceneHierarchyPanel->SetScene(m_ActiveScene);
+        }
+        // History entries reference the discarded scene
+        m_CommandHistory.Clear();
     }
 
     void EditorLayer::OpenScene() {
@@ -1,35 +1,405 @@
 #include "Panels/AssetBrowserPanel.h"
 
+#include <imgui.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
 namespace Genesis {
 
+    namespace {
+
+        constexpr uint32_t THUMB_MAGIC = 0x47544831; // "GTH1"
+        constexpr uint32_t THUMB_VERSION = 1;
+
+        uint64_t HashCombine(uint64_t hash, uint64_t value) {
+            // FNV-1a over the value's bytes
+            for (int i = 0; i < 8; i++) {
+                hash ^= (value >> (i * 8)) & 0xFF;
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        uint64_t HashString(uint64_t hash, const std::string& text) {
+            for (char c : text) {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        uint64_t FileTimeToTicks(const std::filesystem::file_time_type& time) {
+            return static_cast<uint64_t>(time.time_since_epoch().count());
+        }
+
+        // Run a filesystem job off the UI thread when the job system is
+        // up (the editor initializes it with the application); fall back
+        // to inline execution so the panel still works without it
+        void RunAsync(std::function<void()> job) {
+            if (JobSystem::IsInitialized()) {
+                JobSystem::Get().Execute(std::move(job));
+            } else {
+                job();
+            }
+        }
+
+    }
+
     AssetBrowserPanel::AssetBrowserPanel()
-        : m_BaseDirectory("assets"), m_CurrentDirectory("assets") {
+        : m_CurrentDirectory("assets"),
+          m_BaseDirectory("assets"),
+          m_ThumbnailDirectory("assets/.thumbnails") {
+    }
+
+    void AssetBrowserPanel::Init(Renderer& renderer) {
+        m_Renderer = &renderer;
+
+        m_Atlas = std::make_unique<HeightmapTexture>();
+        m_Atlas->Create(renderer.GetDevice(), ATLAS_DIM, ATLAS_DIM);
+        m_AtlasPixels.assign(static_cast<size_t>(ATLAS_DIM) * ATLAS_DIM * 4, 0);
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_ThumbnailDirectory, ec);
+
+        RequestScan(m_CurrentDirectory);
+    }
+
+    void AssetBrowserPanel::Shutdown() {
+        if (m_Atlas) {
+            m_Atlas->Destroy();
+            m_Atlas.reset();
+        }
+        m_Renderer = nullptr;
+    }
+
+    uint64_t AssetBrowserPanel::DirectorySignature(const std::filesystem::path& directory) {
+        // One readdir combining names, sizes and write times - enough to
+        // notice files appearing, vanishing or being rewritten without
+        // the panel holding any per-file state
+        uint64_t signature = 1469598103934665603ull;
+        std::error_code ec;
+        for (auto it = std::filesystem::directory_iterator(directory, ec);
+             !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+            signature = HashString(signature, it->path().filename().string());
+            std::error_code entryEc;
+            if (it->is_regular_file(entryEc)) {
+                signature = HashCombine(signature, it->file_size(entryEc));
+                signature = HashCombine(signature, FileTimeToTicks(it->last_write_time(entryEc)));
+            }
+        }
+        return signature;
+    }
+
+    void AssetBrowserPanel::RequestScan(const std::filesystem::path& directory) {
+        auto result = std::make_shared<ScanResult>();
+        result->Directory = directory;
+        m_PendingScan = result;
+        m_ScanInFlight = true;
+
+        RunAsync([result]() {
+            std::error_code ec;
+            for (auto it = std::filesystem::directory_iterator(result->Directory, ec);
+                 !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+                std::string name = it->path().filename().string();
+                if (!name.empty() && name[0] == '.') {
+                    continue; // skips the thumbnail cache directory too
+                }
+
+                AssetEntry entry;
+                entry.Name = name;
+                entry.Path = it->path();
+                std::error_code entryEc;
+                entry.IsDirectory = it->is_directory(entryEc);
+                if (!entry.IsDirectory) {
+                    entry.Size = it->file_size(entryEc);
+                    entry.WriteTime = FileTimeToTicks(it->last_write_time(entryEc));
+                }
+                result->Entries.push_back(std::move(entry));
+            }
+
+            // Directories first, then files, both alphabetical
+            std::sort(result->Entries.begin(), result->Entries.end(),
+                      [](const AssetEntry& a, const AssetEntry& b) {
+                          if (a.IsDirectory != b.IsDirectory)
+                              return a.IsDirectory;
+                          return a.Name < b.Name;
+                      });
+
+            result->Signature = DirectorySignature(result->Directory);
+            result->Done.store(true, std::memory_order_release);
+        });
+    }
+
+    void AssetBrowserPanel::AdoptScanIfReady() {
+        if (!m_PendingScan || !m_PendingScan->Done.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        // A navigation while the scan ran makes the result stale; the
+        // newer request owns m_PendingScan by then, so this only fires
+        // for results that still match the shown directory
+        if (m_PendingScan->Directory == m_CurrentDirectory) {
+            m_Entries = std::move(m_PendingScan->Entries);
+            m_CurrentSignature = m_PendingScan->Signature;
+        }
+        m_PendingScan.reset();
+        m_ScanInFlight = false;
+    }
+
+    void AssetBrowserPanel::ProbeForChanges(float deltaTime) {
+        // Collect a finished probe: a changed signature means the
+        // directory was modified externally - rescan it
+        if (m_ProbeInFlight && m_ProbedSignature) {
+            uint64_t probed = m_ProbedSignature->load(std::memory_order_acquire);
+            if (probed != 0) {
+                m_ProbeInFlight = false;
+                if (probed != m_CurrentSignature && !m_ScanInFlight) {
+                    RequestScan(m_CurrentDirectory);
+                }
+            }
+        }
+
+        m_ProbeTimer += deltaTime;
+        if (m_ProbeTimer < CHANGE_PROBE_INTERVAL || m_ProbeInFlight || m_ScanInFlight) {
+            return;
+        }
+        m_ProbeTimer = 0.0f;
+
+        m_ProbedSignature = std::make_shared<std::atomic<uint64_t>>(0);
+        m_ProbeInFlight = true;
+        auto target = m_ProbedSignature;
+        auto directory = m_CurrentDirectory;
+        RunAsync([target, directory]() {
+            uint64_t signature = DirectorySignature(directory);
+            // 0 marks "not ready"; the hash landing on it just forces one
+            // redundant rescan
+            target->store(signature ? signature : 1, std::memory_order_release);
+        });
+    }
+
+    std::filesystem::path AssetBrowserPanel::ThumbnailCachePath(const AssetEntry& entry) const {
+        uint64_t key = HashString(1469598103934665603ull, entry.Path.string());
+        key = HashCombine(key, entry.Size);
+        key = HashCombine(key, entry.WriteTime);
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.gtmb",
+                      static_cast<unsigned long long>(key));
+        return m_ThumbnailDirectory / name;
+    }
+
+    void AssetBrowserPanel::GenerateThumbnail(const AssetEntry& entry, uint8_t* rgba) {
+        // No image decoder ships with the engine, so tiles are deterministic
+        // placeholders: a base color from the asset category plus an
+        // identicon-style pattern from the path hash, which makes files
+        // distinguishable at a glance. A real decoder can slot in here
+        // without touching the cache or atlas plumbing.
+        uint8_t baseR = 90, baseG = 95, baseB = 105;
+        if (entry.IsDirectory) {
+            baseR = 190; baseG = 160; baseB = 80;
+        } else {
+            std::string ext = entry.Path.extension().string();
+            if (ext == ".vert" || ext == ".frag" || ext == ".comp" || ext == ".glsl" ||
+                ext == ".spv") {
+                baseR = 90; baseG = 140; baseB = 190; // shaders
+            } else if (ext == ".png" || ext == ".jpg" || ext == ".bmp" || ext == ".tga") {
+                baseR = 110; baseG = 170; baseB = 110; // images
+            } else if (ext == ".obj" || ext == ".gltf" || ext == ".glb" || ext == ".fbx") {
+                baseR = 170; baseG = 120; baseB = 170; // meshes
+            } else if (ext == ".gpreset" || ext == ".gscene") {
+                baseR = 170; baseG = 140; baseB = 100; // engine data
+            }
+        }
+
+        uint64_t hash = HashString(1469598103934665603ull, entry.Path.string());
+
+        for (int y = 0; y < THUMB_SIZE; y++) {
+            for (int x = 0; x < THUMB_SIZE; x++) {
+                uint8_t* px = rgba + (y * THUMB_SIZE + x) * 4;
+                bool border = x == 0 || y == 0 || x == THUMB_SIZE - 1 || y == THUMB_SIZE - 1;
+
+                // 4x4 pattern cells, mirrored horizontally
+                int cellX = x * 4 / THUMB_SIZE;
+                int cellY = y * 4 / THUMB_SIZE;
+                int mirrorX = cellX < 2 ? cellX : 3 - cellX;
+                bool lit = (hash >> (cellY * 2 + mirrorX)) & 1;
+
+                float shade = border ? 0.55f : (lit ? 1.0f : 0.75f);
+                px[0] = static_cast<uint8_t>(baseR * shade);
+                px[1] = static_cast<uint8_t>(baseG * shade);
+                px[2] = static_cast<uint8_t>(baseB * shade);
+                px[3] = 255;
+            }
+        }
+    }
+
+    int AssetBrowserPanel::AcquireThumbnail(AssetEntry& entry) {
+        if (entry.ThumbSlot >= 0) {
+            return entry.ThumbSlot;
+        }
+
+        uint64_t key = HashString(1469598103934665603ull, entry.Path.string());
+        key = HashCombine(key, entry.Size);
+        key = HashCombine(key, entry.WriteTime);
+
+        auto it = m_SlotByKey.find(key);
+        if (it != m_SlotByKey.end()) {
+            entry.ThumbSlot = it->second;
+            return entry.ThumbSlot;
+        }
+
+        // Atlas full: flush every assignment and start over. Visible tiles
+        // re-acquire next frame; with 256 slots this only happens when
+        // paging through very large folders.
+        if (m_NextSlot >= ATLAS_SLOTS) {
+            m_SlotByKey.clear();
+            m_NextSlot = 0;
+            for (AssetEntry& other : m_Entries) {
+                other.ThumbSlot = -1;
+            }
+        }
+        int slot = m_NextSlot++;
+        m_SlotByKey[key] = slot;
+
+        uint8_t tile[THUMB_SIZE * THUMB_SIZE * 4];
+
+        // Disk cache hit skips generation entirely; directories are not
+        // cached since their tile is constant
+        bool loaded = false;
+        if (!entry.IsDirectory) {
+            std::ifstream file(ThumbnailCachePath(entry), std::ios::binary);
+            if (file) {
+                uint32_t magic = 0, version = 0, size = 0;
+                file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+                file.read(reinterpret_cast<char*>(&version), sizeof(version));
+                file.read(reinterpret_cast<char*>(&size), sizeof(size));
+                if (magic == THUMB_MAGIC && version == THUMB_VERSION && size == THUMB_SIZE) {
+                    file.read(reinterpret_cast<char*>(tile), sizeof(tile));
+                    loaded = file.good();
+                }
+            }
+        }
+
+        if (!loaded) {
+            GenerateThumbnail(entry, tile);
+            if (!entry.IsDirectory) {
+                std::ofstream file(ThumbnailCachePath(entry), std::ios::binary);
+                if (file) {
+                    uint32_t size = THUMB_SIZE;
+                    file.write(reinterpret_cast<const char*>(&THUMB_MAGIC), sizeof(THUMB_MAGIC));
+                    file.write(reinterpret_cast<const char*>(&THUMB_VERSION),
+                               sizeof(THUMB_VERSION));
+                    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+                    file.write(reinterpret_cast<const char*>(tile), sizeof(tile));
+                }
+            }
+        }
+
+        // Blit into the CPU mirror; UpdateRGBA's row diff turns this into
+        // a tile-sized upload
+        int atlasX = (slot % ATLAS_COLUMNS) * THUMB_SIZE;
+        int atlasY = (slot / ATLAS_COLUMNS) * THUMB_SIZE;
+        for (int y = 0; y < THUMB_SIZE; y++) {
+            std::memcpy(&m_AtlasPixels[((atlasY + y) * ATLAS_DIM + atlasX) * 4],
+                        &tile[y * THUMB_SIZE * 4], THUMB_SIZE * 4);
+        }
+        m_AtlasDirty = true;
+
+        entry.ThumbSlot = slot;
+        return slot;
     }
 
     void AssetBrowserPanel::OnImGuiRender() {
-        // ImGui::Begin("Asset Browser");
-        
-        // Back button
-        // if (m_CurrentDirectory != m_BaseDirectory) {
-        //     if (ImGui::Button("<-")) {
-        //         m_CurrentDirectory = m_CurrentDirectory.parent_path();
-        //     }
-        // }
-        
-        // Draw directory contents as icons
-        // for (auto& entry : std::filesystem::directory_iterator(m_CurrentDirectory)) {
-        //     const auto& path = entry.path();
-        //     auto relativePath = std::filesystem::relative(path, m_BaseDirectory);
-        //     std::string filename = relativePath.filename().string();
-        //     
-        //     if (entry.is_directory()) {
-        //         // Draw folder icon
-        //     } else {
-        //         // Draw file icon based on extension
-        //     }
-        // }
-        
-        // ImGui::End();
+        // Finished background scans land even while the panel is hidden,
+        // so re-opening it shows the latest listing immediately
+        AdoptScanIfReady();
+
+        // Hidden dock tabs and collapsed windows skip the body - and the
+        // change probe: polling the filesystem for a listing nobody can
+        // see is wasted readdirs. Probing resumes when the tab does.
+        if (!ImGui::Begin("Asset Browser")) {
+            ImGui::End();
+            return;
+        }
+
+        ProbeForChanges(ImGui::GetIO().DeltaTime);
+
+        if (m_CurrentDirectory != m_BaseDirectory) {
+            if (ImGui::Button("<-")) {
+                m_CurrentDirectory = m_CurrentDirectory.parent_path();
+                RequestScan(m_CurrentDirectory);
+            }
+            ImGui::SameLine();
+        }
+        ImGui::TextDisabled("%s%s", m_CurrentDirectory.string().c_str(),
+                            m_ScanInFlight ? " (scanning...)" : "");
+        ImGui::Separator();
+
+        const float cellSize = THUMB_SIZE + 16.0f;
+        int columns = std::max(1, static_cast<int>(ImGui::GetContentRegionAvail().x / cellSize));
+        int rowCount = (static_cast<int>(m_Entries.size()) + columns - 1) / columns;
+
+        std::filesystem::path navigateTo;
+
+        // Rows are virtualized; thumbnails are acquired (and generated)
+        // only for entries that actually reach the screen
+        ImGuiListClipper clipper;
+        clipper.Begin(rowCount, cellSize + ImGui::GetTextLineHeightWithSpacing());
+        while (clipper.Step()) {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+                for (int col = 0; col < columns; col++) {
+                    size_t index = static_cast<size_t>(row) * columns + col;
+                    if (index >= m_Entries.size()) {
+                        break;
+                    }
+                    AssetEntry& entry = m_Entries[index];
+
+                    if (col > 0) {
+                        ImGui::SameLine();
+                    }
+                    ImGui::PushID(static_cast<int>(index));
+                    ImGui::BeginGroup();
+
+                    int slot = AcquireThumbnail(entry);
+                    float u0 = static_cast<float>(slot % ATLAS_COLUMNS) / ATLAS_COLUMNS;
+                    float v0 = static_cast<float>(slot / ATLAS_COLUMNS) / ATLAS_COLUMNS;
+                    float uvStep = 1.0f / ATLAS_COLUMNS;
+
+                    ImGui::Image(reinterpret_cast<ImTextureID>(m_Atlas->GetDescriptorSet()),
+                                 ImVec2{static_cast<float>(THUMB_SIZE),
+                                        static_cast<float>(THUMB_SIZE)},
+                                 ImVec2{u0, v0}, ImVec2{u0 + uvStep, v0 + uvStep});
+                    if (entry.IsDirectory && ImGui::IsItemHovered() &&
+                        ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
+                        navigateTo = entry.Path;
+                    }
+
+                    ImGui::PushTextWrapPos(ImGui::GetCursorPos().x + THUMB_SIZE);
+                    ImGui::TextWrapped("%s", entry.Name.c_str());
+                    ImGui::PopTextWrapPos();
+
+                    ImGui::EndGroup();
+                    ImGui::PopID();
+                }
+            }
+        }
+
+        ImGui::End();
+
+        if (!navigateTo.empty()) {
+            m_CurrentDirectory = navigateTo;
+            RequestScan(m_CurrentDirectory);
+        }
+
+        if (m_AtlasDirty) {
+            m_Atlas->UpdateRGBA(m_AtlasPixels.data(), m_AtlasPixels.size());
+            m_Atlas->FlushUploads();
+            m_AtlasDirty = false;
+        }
     }
 
 }
@@ -1,22 +1,153 @@
 #include "Panels/PropertiesPanel.h"
 
+#include <imgui.h>
+
+#include <cstring>
+
 namespace Genesis {
 
+    void PropertiesPanel::RefreshCache() {
+        Scene* scene = m_SelectedEntity.GetScene();
+        bool sameEntity = m_SelectedEntity.GetID() == m_CachedEntityID;
+
+        if (!sameEntity) {
+            // Selection changed: rebuild the component list outright
+            m_Cache.clear();
+            for (const ComponentDescriptor& descriptor : GetComponentDescriptors()) {
+                if (!descriptor.Has(m_SelectedEntity)) {
+                    continue;
+                }
+                CachedComponent cached;
+                cached.Descriptor = &descriptor;
+                void* component = descriptor.Get(m_SelectedEntity);
+                cached.Values.reserve(descriptor.Fields->size());
+                for (const PropertyField& field : *descriptor.Fields) {
+                    cached.Values.push_back(ReadProperty(component, field));
+                }
+                m_Cache.push_back(std::move(cached));
+            }
+        } else {
+            // Same entity, component data moved: re-read per field and
+            // overwrite only the values that actually differ, so widget
+            // state for untouched fields is left alone
+            for (CachedComponent& cached : m_Cache) {
+                if (!cached.Descriptor->Has(m_SelectedEntity)) {
+                    continue;
+                }
+                void* component = cached.Descriptor->Get(m_SelectedEntity);
+                const std::vector<PropertyField>& fields = *cached.Descriptor->Fields;
+                for (size_t i = 0; i < fields.size(); i++) {
+                    PropertyValue current = ReadProperty(component, fields[i]);
+                    if (std::memcmp(current.Bytes, cached.Values[i].Bytes,
+                                    PropertyTypeSize(fields[i].Type)) != 0) {
+                        cached.Values[i] = current;
+                    }
+                }
+            }
+        }
+
+        m_CachedEntityID = m_SelectedEntity.GetID();
+        m_CachedComponentVersion = scene ? scene->GetComponentVersion() : UINT64_MAX;
+    }
+
+    void PropertiesPanel::SubmitEdit(CachedComponent& cached, size_t fieldIndex,
+                                     const PropertyValue& newValue) {
+        const PropertyField& field = (*cached.Descriptor->Fields)[fieldIndex];
+        auto command = std::make_unique<SetPropertyCommand>(
+            m_SelectedEntity, cached.Descriptor, &field, cached.Values[fieldIndex], newValue);
+
+        // The cache adopts the new value directly and then re-syncs to the
+        // bumped component version, so the edit does not trigger a full
+        // re-read next frame
+        cached.Values[fieldIndex] = newValue;
+
+        if (m_CommandHandler) {
+            m_CommandHandler(std::move(command));
+        } else {
+            command->Execute();
+        }
+
+        if (Scene* scene = m_SelectedEntity.GetScene()) {
+            m_CachedComponentVersion = scene->GetComponentVersion();
+        }
+    }
+
+    void PropertiesPanel::DrawComponent(CachedComponent& cached) {
+        if (!ImGui::CollapsingHeader(cached.Descriptor->Name, ImGuiTreeNodeFlags_DefaultOpen)) {
+            return;
+        }
+
+        const std::vector<PropertyField>& fields = *cached.Descriptor->Fields;
+        for (size_t i = 0; i < fields.size(); i++) {
+            const PropertyField& field = fields[i];
+            PropertyValue value = cached.Values[i];
+            bool edited = false;
+
+            switch (field.Type) {
+                case PropertyType::Float:
+                    edited = ImGui::DragFloat(field.Name,
+                                              reinterpret_cast<float*>(value.Bytes), field.Speed,
+                                              field.Min, field.Max);
+                    break;
+                case PropertyType::Float3:
+                    edited = ImGui::DragFloat3(field.Name,
+                                               reinterpret_cast<float*>(value.Bytes), field.Speed,
+                                               field.Min, field.Max);
+                    break;
+                case PropertyType::Color3:
+                    edited = ImGui::ColorEdit3(field.Name,
+                                               reinterpret_cast<float*>(value.Bytes));
+                    break;
+                case PropertyType::Bool:
+                    edited = ImGui::Checkbox(field.Name,
+                                             reinterpret_cast<bool*>(value.Bytes));
+                    break;
+                case PropertyType::Int:
+                    edited = ImGui::DragInt(field.Name, reinterpret_cast<int*>(value.Bytes),
+                                            field.Speed, static_cast<int>(field.Min),
+                                            static_cast<int>(field.Max));
+                    break;
+            }
+
+            if (edited) {
+                SubmitEdit(cached, i, value);
+            }
+        }
+    }
+
     void PropertiesPanel::OnImGuiRender() {
-        // ImGui::Begin("Properties");
+        // Hidden dock tabs and collapsed windows skip the whole body
+        if (!ImGui::Begin("Properties")) {
+            ImGui::End();
+            return;
+        }
+
+        bool active = ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) ||
+                      ImGui::IsWindowHovered(ImGuiHoveredFlags_RootAndChildWindows);
+        bool mayRefresh = m_RefreshPolicy.Tick(active, ImGui::GetIO().DeltaTime);
+
         if (m_SelectedEntity) {
-            DrawComponents(m_SelectedEntity);
+            Scene* scene = m_SelectedEntity.GetScene();
+            // Selection changes re-read immediately even in the
+            // background; gizmo-driven component edits land at the
+            // throttled rate when nobody is looking at the panel
+            bool stale = m_SelectedEntity.GetID() != m_CachedEntityID ||
+                         (mayRefresh &&
+                          scene && scene->GetComponentVersion() != m_CachedComponentVersion);
+            if (stale) {
+                RefreshCache();
+            }
+
+            for (CachedComponent& cached : m_Cache) {
+                DrawComponent(cached);
+            }
+        } else {
+            ImGui::TextDisabled("No entity selected");
+            m_CachedEntityID = 0;
+            m_Cache.clear();
         }
-        // ImGui::End();
-    }
 
-    void PropertiesPanel::DrawComponents(Entity entity) {
-        // Draw all component editors for selected entity
-        // - Transform
-        // - Mesh Renderer
-        // - Camera
-        // - Lights
-        // - etc.
+        ImGui::End();
     }
 
 }
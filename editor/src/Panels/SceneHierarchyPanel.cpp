@@ -1,7 +1,24 @@
 #include "Panels/SceneHierarchyPanel.h"
 
+#include <imgui.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cfloat>
+
 namespace Genesis {
 
+    namespace {
+
+        std::string ToLower(const std::string& text) {
+            std::string lower = text;
+            std::transform(lower.begin(), lower.end(), lower.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return lower;
+        }
+
+    }
+
     SceneHierarchyPanel::SceneHierarchyPanel(const std::shared_ptr<Scene>& scene)
         : m_Scene(scene) {
     }
@@ -9,16 +26,130 @@ namespace Genesis {
     void SceneHierarchyPanel::SetScene(const std::shared_ptr<Scene>& scene) {
         m_Scene = scene;
         m_SelectedEntity = {};
+        m_CachedVersion = UINT64_MAX;
+    }
+
+    void SceneHierarchyPanel::RebuildEntityCache() {
+        m_CachedEntities.clear();
+        m_Scene->ForEachEntity([&](Entity entity, NameHandle name) {
+            m_CachedEntities.push_back({entity.GetID(), name});
+        });
+
+        std::sort(m_CachedEntities.begin(), m_CachedEntities.end(),
+                  [](const CachedEntity& a, const CachedEntity& b) {
+                      // Equal handles mean equal names - skip the string
+                      // compare for the repeated bulk-created names
+                      if (a.Name != b.Name) {
+                          const std::string& nameA = NameTable::Resolve(a.Name);
+                          const std::string& nameB = NameTable::Resolve(b.Name);
+                          if (nameA != nameB)
+                              return nameA < nameB;
+                      }
+                      return a.ID < b.ID;
+                  });
+
+        m_CachedVersion = m_Scene->GetEntityListVersion();
+
+        // The cached indices point into the rebuilt vector; refilter from
+        // scratch regardless of what the search box held before
+        ApplyFilter(m_AppliedFilter, false);
+    }
+
+    void SceneHierarchyPanel::ApplyFilter(const std::string& lowerFilter, bool narrowing) {
+        if (lowerFilter.empty()) {
+            m_FilteredIndices.resize(m_CachedEntities.size());
+            for (uint32_t i = 0; i < m_FilteredIndices.size(); i++) {
+                m_FilteredIndices[i] = i;
+            }
+        } else if (narrowing) {
+            // The new filter extends the previous one, so every match is
+            // already in the current result set - refine it in place
+            m_FilteredIndices.erase(
+                std::remove_if(m_FilteredIndices.begin(), m_FilteredIndices.end(),
+                               [&](uint32_t index) {
+                                   return NameTable::ResolveLower(m_CachedEntities[index].Name)
+                                              .find(lowerFilter) == std::string::npos;
+                               }),
+                m_FilteredIndices.end());
+        } else {
+            m_FilteredIndices.clear();
+            for (uint32_t i = 0; i < m_CachedEntities.size(); i++) {
+                if (NameTable::ResolveLower(m_CachedEntities[i].Name).find(lowerFilter) !=
+                    std::string::npos) {
+                    m_FilteredIndices.push_back(i);
+                }
+            }
+        }
+        m_AppliedFilter = lowerFilter;
     }
 
     void SceneHierarchyPanel::OnImGuiRender() {
-        // ImGui::Begin("Scene Hierarchy");
-        // Draw all entities in scene
-        // ImGui::End();
+        // Hidden dock tabs and collapsed windows skip the whole body
+        if (!ImGui::Begin("Scene Hierarchy")) {
+            ImGui::End();
+            return;
+        }
+
+        bool active = ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) ||
+                      ImGui::IsWindowHovered(ImGuiHoveredFlags_RootAndChildWindows);
+        bool mayRefresh = m_RefreshPolicy.Tick(active, ImGui::GetIO().DeltaTime);
+
+        if (m_Scene) {
+            // Background panels pick up entity-list changes at the
+            // throttled rate instead of the frame after they happen
+            if (mayRefresh && m_CachedVersion != m_Scene->GetEntityListVersion()) {
+                RebuildEntityCache();
+            }
+
+            ImGui::SetNextItemWidth(-FLT_MIN);
+            if (ImGui::InputTextWithHint("##Search", "Search...", m_SearchBuffer,
+                                         sizeof(m_SearchBuffer))) {
+                std::string lowerFilter = ToLower(m_SearchBuffer);
+                bool narrowing = !m_AppliedFilter.empty() &&
+                                 lowerFilter.find(m_AppliedFilter) == 0;
+                ApplyFilter(lowerFilter, narrowing);
+            }
+
+            if (!m_AppliedFilter.empty()) {
+                ImGui::TextDisabled("%d / %d", static_cast<int>(m_FilteredIndices.size()),
+                                    static_cast<int>(m_CachedEntities.size()));
+            }
+
+            // Only rows inside the scroll region get widgets; a 50k-entity
+            // scene submits a screenful of tree nodes, not 50k
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(m_FilteredIndices.size()));
+            while (clipper.Step()) {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+                    DrawEntityNode(m_CachedEntities[m_FilteredIndices[row]]);
+                }
+            }
+
+            // Click on empty space deselects
+            if (ImGui::IsMouseClicked(ImGuiMouseButton_Left) && ImGui::IsWindowHovered() &&
+                !ImGui::IsAnyItemHovered()) {
+                m_SelectedEntity = {};
+            }
+        }
+
+        ImGui::End();
     }
 
-    void SceneHierarchyPanel::DrawEntityNode(Entity entity) {
-        // Draw entity in tree view
+    void SceneHierarchyPanel::DrawEntityNode(const CachedEntity& entry) {
+        // Flat rows (no parenting yet); leaf nodes keep row heights
+        // uniform, which the clipper requires
+        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_Leaf |
+                                   ImGuiTreeNodeFlags_NoTreePushOnOpen |
+                                   ImGuiTreeNodeFlags_SpanAvailWidth;
+        if (m_SelectedEntity.GetID() == entry.ID) {
+            flags |= ImGuiTreeNodeFlags_Selected;
+        }
+
+        ImGui::TreeNodeEx(reinterpret_cast<void*>(static_cast<uintptr_t>(entry.ID)), flags, "%s",
+                          NameTable::Resolve(entry.Name).c_str());
+        if (ImGui::IsItemClicked()) {
+            m_SelectedEntity = Entity(entry.ID, m_Scene.get());
+        }
     }
 
     void SceneHierarchyPanel::DrawComponents(Entity entity) {
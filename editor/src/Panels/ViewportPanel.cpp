@@ -1,27 +1,105 @@
 #include "Panels/ViewportPanel.h"
 
+#include <genesis/renderer/VulkanSwapchain.h>
+
+#include <imgui.h>
+
+#include <algorithm>
+
 namespace Genesis {
 
+    void ViewportPanel::Init(Renderer& renderer) {
+        m_Renderer = &renderer;
+
+        // Swapchain formats make the target's render pass compatible with
+        // the pipelines the scene already uses (see ViewportTarget)
+        VulkanSwapchain& swapchain = renderer.GetSwapchain();
+        VkExtent2D extent = swapchain.GetExtent();
+        m_Target.Init(renderer.GetDevice(), swapchain.GetImageFormat(),
+                      swapchain.GetDepthFormat(), extent.width, extent.height);
+        m_ViewportSize = {static_cast<float>(extent.width), static_cast<float>(extent.height)};
+    }
+
+    void ViewportPanel::Shutdown() {
+        m_Target.Shutdown();
+        m_Renderer = nullptr;
+    }
+
     void ViewportPanel::OnImGuiRender() {
-        // ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2{0, 0});
-        // ImGui::Begin("Viewport");
-        
-        // m_IsFocused = ImGui::IsWindowFocused();
-        // m_IsHovered = ImGui::IsWindowHovered();
-        
-        // Get viewport size
-        // auto viewportPanelSize = ImGui::GetContentRegionAvail();
-        // m_ViewportSize = {viewportPanelSize.x, viewportPanelSize.y};
-        
-        // Draw framebuffer texture
-        // ImGui::Image(textureID, ImVec2{m_ViewportSize.x, m_ViewportSize.y});
-        
-        // ImGui::End();
-        // ImGui::PopStyleVar();
+        ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2{0, 0});
+        ImGui::Begin("Viewport");
+
+        m_IsFocused = ImGui::IsWindowFocused();
+        m_IsHovered = ImGui::IsWindowHovered();
+
+        ImVec2 boundsMin = ImGui::GetWindowContentRegionMin();
+        ImVec2 boundsMax = ImGui::GetWindowContentRegionMax();
+        ImVec2 windowPos = ImGui::GetWindowPos();
+        m_ViewportBounds[0] = {windowPos.x + boundsMin.x, windowPos.y + boundsMin.y};
+        m_ViewportBounds[1] = {windowPos.x + boundsMax.x, windowPos.y + boundsMax.y};
+
+        ImVec2 viewportPanelSize = ImGui::GetContentRegionAvail();
+        m_ViewportSize = {viewportPanelSize.x, viewportPanelSize.y};
+
+        // The target renders at panel size times the dynamic scale; the
+        // image below stays panel-sized, so the linear sampler upscales
+        // the cheaper render while the camera is in motion
+        bool manipulating = m_IsHovered && (ImGui::IsMouseDown(ImGuiMouseButton_Left) ||
+                                            ImGui::IsMouseDown(ImGuiMouseButton_Right) ||
+                                            ImGui::IsMouseDown(ImGuiMouseButton_Middle));
+        m_RenderScale = manipulating ? MANIPULATION_SCALE : 1.0f;
+
+        if (m_Target.IsValid()) {
+            ImGui::Image(reinterpret_cast<ImTextureID>(m_Target.GetImGuiDescriptor()),
+                         ImVec2{m_ViewportSize.x, m_ViewportSize.y});
+        }
+
+        // Click-to-pick: hand the renderer the cursor position normalized to
+        // the panel - the ID buffer renders at whatever scale the target is
+        // at, so normalized coordinates stay correct during manipulation
+        if (m_Renderer && m_IsHovered && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
+            ImVec2 mouse = ImGui::GetMousePos();
+            glm::vec2 extent = m_ViewportBounds[1] - m_ViewportBounds[0];
+            if (extent.x >= 1.0f && extent.y >= 1.0f) {
+                m_Renderer->RequestPick((mouse.x - m_ViewportBounds[0].x) / extent.x,
+                                        (mouse.y - m_ViewportBounds[0].y) / extent.y);
+            }
+        }
+
+        ImGui::End();
+        ImGui::PopStyleVar();
     }
 
     void ViewportPanel::OnUpdate(float deltaTime) {
-        // Handle viewport-specific updates
+        if (!m_Renderer || m_ViewportSize.x < 1.0f || m_ViewportSize.y < 1.0f) {
+            return;
+        }
+
+        uint32_t desiredWidth = std::max(1u, static_cast<uint32_t>(m_ViewportSize.x * m_RenderScale));
+        uint32_t desiredHeight = std::max(1u, static_cast<uint32_t>(m_ViewportSize.y * m_RenderScale));
+
+        VkExtent2D current = m_Target.GetExtent();
+        if (desiredWidth == current.width && desiredHeight == current.height) {
+            m_ResizePending = false;
+            return;
+        }
+
+        // Dropping resolution applies immediately so a drag gets cheap on
+        // its first frame; growing back (or following a panel resize)
+        // waits for the size to settle, since Resize stalls on device idle
+        bool shrinking = desiredWidth < current.width && desiredHeight < current.height;
+        if (!m_ResizePending || desiredWidth != m_PendingWidth || desiredHeight != m_PendingHeight) {
+            m_ResizePending = true;
+            m_ResizeTimer = 0.0f;
+            m_PendingWidth = desiredWidth;
+            m_PendingHeight = desiredHeight;
+        }
+        m_ResizeTimer += deltaTime;
+
+        if (shrinking || m_ResizeTimer >= RESIZE_DEBOUNCE_SECONDS) {
+            m_Target.Resize(desiredWidth, desiredHeight);
+            m_ResizePending = false;
+        }
     }
 
 }
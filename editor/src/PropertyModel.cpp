@@ -0,0 +1,87 @@
+#include "PropertyModel.h"
+
+namespace Genesis {
+
+    size_t PropertyTypeSize(PropertyType type) {
+        switch (type) {
+            case PropertyType::Float: return sizeof(float);
+            case PropertyType::Float3: return sizeof(float) * 3;
+            case PropertyType::Color3: return sizeof(float) * 3;
+            case PropertyType::Bool: return sizeof(bool);
+            case PropertyType::Int: return sizeof(int);
+        }
+        return 0;
+    }
+
+    namespace {
+
+        template<typename T>
+        bool HasComponent(Entity entity) {
+            return entity.HasComponent<T>();
+        }
+
+        template<typename T>
+        void* GetComponent(Entity entity) {
+            return &entity.GetComponent<T>();
+        }
+
+        const std::vector<PropertyField> TRANSFORM_FIELDS = {
+            {"Position", PropertyType::Float3, offsetof(TransformComponent, Position), 0.1f},
+            {"Rotation", PropertyType::Float3, offsetof(TransformComponent, Rotation), 0.01f},
+            {"Scale", PropertyType::Float3, offsetof(TransformComponent, Scale), 0.05f},
+        };
+
+        const std::vector<PropertyField> MESH_RENDERER_FIELDS = {
+            {"Color", PropertyType::Color3, offsetof(MeshRendererComponent, Color)},
+            {"Visible", PropertyType::Bool, offsetof(MeshRendererComponent, Visible)},
+            {"Cast Shadows", PropertyType::Bool, offsetof(MeshRendererComponent, CastShadows)},
+            {"Receive Shadows", PropertyType::Bool,
+             offsetof(MeshRendererComponent, ReceiveShadows)},
+        };
+
+        const std::vector<PropertyField> CAMERA_FIELDS = {
+            {"Primary", PropertyType::Bool, offsetof(CameraComponent, Primary)},
+            {"FOV", PropertyType::Float, offsetof(CameraComponent, FOV), 0.5f, 1.0f, 179.0f},
+            {"Near Clip", PropertyType::Float, offsetof(CameraComponent, NearClip), 0.01f, 0.001f,
+             100.0f},
+            {"Far Clip", PropertyType::Float, offsetof(CameraComponent, FarClip), 1.0f, 1.0f,
+             100000.0f},
+        };
+
+        const std::vector<PropertyField> DIRECTIONAL_LIGHT_FIELDS = {
+            {"Direction", PropertyType::Float3, offsetof(DirectionalLightComponent, Direction),
+             0.01f},
+            {"Color", PropertyType::Color3, offsetof(DirectionalLightComponent, Color)},
+            {"Intensity", PropertyType::Float, offsetof(DirectionalLightComponent, Intensity),
+             0.05f, 0.0f, 100.0f},
+            {"Cast Shadows", PropertyType::Bool,
+             offsetof(DirectionalLightComponent, CastShadows)},
+        };
+
+        const std::vector<PropertyField> POINT_LIGHT_FIELDS = {
+            {"Color", PropertyType::Color3, offsetof(PointLightComponent, Color)},
+            {"Intensity", PropertyType::Float, offsetof(PointLightComponent, Intensity), 0.05f,
+             0.0f, 100.0f},
+            {"Radius", PropertyType::Float, offsetof(PointLightComponent, Radius), 0.1f, 0.0f,
+             1000.0f},
+        };
+
+    }
+
+    const std::vector<ComponentDescriptor>& GetComponentDescriptors() {
+        static const std::vector<ComponentDescriptor> descriptors = {
+            {"Transform", HasComponent<TransformComponent>, GetComponent<TransformComponent>,
+             &TRANSFORM_FIELDS},
+            {"Mesh Renderer", HasComponent<MeshRendererComponent>,
+             GetComponent<MeshRendererComponent>, &MESH_RENDERER_FIELDS},
+            {"Camera", HasComponent<CameraComponent>, GetComponent<CameraComponent>,
+             &CAMERA_FIELDS},
+            {"Directional Light", HasComponent<DirectionalLightComponent>,
+             GetComponent<DirectionalLightComponent>, &DIRECTIONAL_LIGHT_FIELDS},
+            {"Point Light", HasComponent<PointLightComponent>, GetComponent<PointLightComponent>,
+             &POINT_LIGHT_FIELDS},
+        };
+        return descriptors;
+    }
+
+}
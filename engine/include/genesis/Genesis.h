@@ -3,6 +3,9 @@
 // Core
 #include "genesis/core/Application.h"
 #include "genesis/core/Log.h"
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/FrameScheduler.h"
+#include "genesis/core/Profiler.h"
 #include "genesis/core/Layer.h"
 #include "genesis/core/Input.h"
 #include "genesis/core/KeyCodes.h"
@@ -12,6 +15,7 @@
 #include "genesis/renderer/Renderer.h"
 #include "genesis/renderer/Camera.h"
 #include "genesis/renderer/Mesh.h"
+#include "genesis/renderer/MeshCache.h"
 #include "genesis/renderer/Light.h"
 #include "genesis/renderer/InstancedRenderer.h"
 
@@ -43,6 +47,10 @@
 // World
 #include "genesis/world/Chunk.h"
 #include "genesis/world/ChunkManager.h"
+#include "genesis/world/DeterminismValidator.h"
+#include "genesis/world/HeadlessBenchmark.h"
+#include "genesis/world/TerrainExporter.h"
+#include "genesis/world/SettingsPreset.h"
 
 // ImGui
 #include "genesis/imgui/ImGuiLayer.h"
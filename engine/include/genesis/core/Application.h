@@ -1,7 +1,10 @@
 #pragma once
 
+#include "genesis/core/Event.h"
+
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Genesis {
 
@@ -25,6 +28,8 @@ namespace Genesis {
     class Window;
     class LayerStack;
     class Renderer;
+    class FrameScheduler;
+    class JobCounter;
 
     class Application {
     public:
@@ -42,21 +47,50 @@ namespace Genesis {
 
         Renderer& GetRenderer() { return *m_Renderer; }
 
+        // Frame-budgeted task queue, drained once per frame after layer
+        // updates (see FrameScheduler.h)
+        FrameScheduler& GetScheduler() { return *m_Scheduler; }
+
+        // Simulation tick length in seconds. OnUpdate stays per-frame with
+        // the real delta (input, cameras, streaming); OnFixedUpdate runs on
+        // an accumulator at exactly this step, so simulation cost no longer
+        // scales with display refresh and ticks are deterministic.
+        void SetFixedTimestep(float seconds) { m_FixedTimestep = seconds; }
+        float GetFixedTimestep() const { return m_FixedTimestep; }
+
+        // Fraction [0,1) of the next tick already accumulated when the
+        // frame rendered; renderers interpolate between the last two tick
+        // states with it
+        float GetFixedAlpha() const { return m_FixedAlpha; }
+
     protected:
         virtual void OnInit() {}
         virtual void OnShutdown() {}
         virtual void OnUpdate(float deltaTime) {}
+        virtual void OnFixedUpdate(float fixedDeltaTime) {}
 
     private:
         void ProcessEvents();
 
+        // Block until the worker-thread Vulkan bring-up has finished,
+        // pumping window events so the window stays responsive meanwhile
+        void WaitForRendererInit();
+
     private:
         ApplicationConfig m_Config;
         std::unique_ptr<Window> m_Window;
         std::unique_ptr<LayerStack> m_LayerStack;
         std::unique_ptr<Renderer> m_Renderer;
+        std::unique_ptr<FrameScheduler> m_Scheduler;
+        std::unique_ptr<JobCounter> m_RendererInit;
+        // Scratch buffer the window's event queue is swapped into each
+        // frame (see ProcessEvents); reused to keep the drain allocation-free
+        std::vector<Event> m_FrameEvents;
         bool m_Running = true;
         float m_LastFrameTime = 0.0f;
+        float m_FixedTimestep = 1.0f / 30.0f;
+        float m_FixedAccumulator = 0.0f;
+        float m_FixedAlpha = 0.0f;
 
         static Application* s_Instance;
     };
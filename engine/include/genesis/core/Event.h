@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Genesis {
+
+    enum class EventType : uint8_t {
+        None = 0,
+        WindowResized,
+        WindowClosed,
+        KeyPressed,
+        KeyReleased,
+        MouseButtonPressed,
+        MouseButtonReleased,
+        MouseMoved,
+        MouseScrolled,
+    };
+
+    // Plain tagged value type rather than a class hierarchy: events are
+    // queued by value in the window and drained once per frame, so they
+    // stay trivially copyable and allocation-free. Continuous events
+    // (cursor moves, scroll ticks) are coalesced at enqueue time - see
+    // Window::SetupCallbacks - which bounds per-frame dispatch cost no
+    // matter the device report rate.
+    class Event {
+    public:
+        EventType Type = EventType::None;
+
+        // Set by a layer to stop propagation to the layers beneath it;
+        // dispatch runs overlays first (see Application::ProcessEvents)
+        bool Handled = false;
+
+        union {
+            struct { uint32_t Width; uint32_t Height; } Resize;
+            struct { int32_t KeyCode; int32_t Mods; bool Repeat; } Key;
+            struct { int32_t Button; int32_t Mods; } MouseButton;
+            struct { float X; float Y; } MouseMove;
+            struct { float XOffset; float YOffset; } Scroll;
+        };
+
+        Event() : Resize{0, 0} {}
+        explicit Event(EventType type) : Type(type), Resize{0, 0} {}
+
+        bool IsMouseEvent() const {
+            return Type == EventType::MouseButtonPressed ||
+                   Type == EventType::MouseButtonReleased ||
+                   Type == EventType::MouseMoved ||
+                   Type == EventType::MouseScrolled;
+        }
+
+        bool IsKeyEvent() const {
+            return Type == EventType::KeyPressed || Type == EventType::KeyReleased;
+        }
+    };
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace Genesis {
+
+    // Frame-budgeted task scheduler. Systems enqueue interruptible work
+    // items (upload a mesh, stitch a border, generate an LOD) and the
+    // application drains them once per frame until a time slice expires;
+    // whatever is left carries over to the next frame. A task returns true
+    // when finished, or false to be resumed on a later frame, so long jobs
+    // should be split into resumable steps rather than running to
+    // completion in one call.
+    class FrameScheduler {
+    public:
+        // Returns true when the task is complete; false re-queues it
+        using Task = std::function<bool()>;
+
+        // Queue a task for main-thread execution under the frame budget.
+        // The name shows up in trace logging when a task overruns.
+        void Enqueue(Task task, const std::string& name = "Task");
+
+        // Run queued tasks until the budget expires or the queue empties.
+        // Called once per frame by Application::Run on the main thread.
+        void Execute();
+
+        void SetBudget(float milliseconds) { m_BudgetMs = milliseconds; }
+        float GetBudget() const { return m_BudgetMs; }
+
+        size_t GetPendingCount() const;
+
+    private:
+        struct ScheduledTask {
+            Task Work;
+            std::string Name;
+        };
+
+        std::deque<ScheduledTask> m_Tasks;
+        mutable std::mutex m_Mutex; // Worker threads may enqueue follow-up work
+        float m_BudgetMs = 2.0f;
+    };
+
+}
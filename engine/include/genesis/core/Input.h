@@ -1,9 +1,23 @@
 #pragma once
 
+#include <bitset>
+
 #include <glm/glm.hpp>
 
 namespace Genesis {
 
+    // Immutable per-frame input state. The main thread captures the live
+    // window state once per frame (Application::ProcessEvents) and
+    // publishes it through a double buffer; every query below reads the
+    // published snapshot, so worker threads can poll input lock-free
+    // without touching GLFW (which is main-thread only) and hot update
+    // loops stop paying per-call platform queries.
+    struct InputSnapshot {
+        std::bitset<512> Keys;       // Indexed by key code
+        std::bitset<8> MouseButtons; // Indexed by mouse button code
+        glm::vec2 MousePosition{0.0f};
+    };
+
     class Input {
     public:
         static bool IsKeyPressed(int keycode);
@@ -11,6 +25,13 @@ namespace Genesis {
         static glm::vec2 GetMousePosition();
         static float GetMouseX();
         static float GetMouseY();
+
+        // The full snapshot, for systems that sample many keys at once
+        static const InputSnapshot& GetSnapshot();
+
+        // Capture the window state into the inactive buffer and publish
+        // it. Main thread only, once per frame.
+        static void CaptureSnapshot();
     };
 
 }
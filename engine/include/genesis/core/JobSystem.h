@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Genesis {
+
+    // Tracks a group of jobs in flight. Pass one counter to several
+    // Execute calls to fan work out, then Wait on it to join, or hand it
+    // to ExecuteAfter to chain follow-up work without blocking anybody.
+    // Counters must outlive every job registered against them.
+    class JobCounter {
+    public:
+        bool IsZero() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+    private:
+        struct Followup {
+            std::function<void()> Function;
+            JobCounter* Counter = nullptr;
+        };
+
+        std::atomic<uint32_t> m_Pending{0};
+        std::mutex m_FollowupMutex;
+        std::vector<Followup> m_Followups;
+
+        friend class JobSystem;
+    };
+
+    // Engine-wide worker pool for task parallelism.
+    //
+    // Each worker owns a deque it pushes and pops at the back (newest
+    // first, for cache locality); an idle worker steals from the front of
+    // its siblings' deques, so load balances without a single contended
+    // queue. Waiting threads - including the main thread - execute queued
+    // jobs themselves instead of sleeping, which keeps fork-join patterns
+    // like ParallelFor deadlock-free even when every worker is busy.
+    class JobSystem {
+    public:
+        // workerCount 0 sizes the pool to hardware threads minus one,
+        // leaving a core for the thread that submits
+        static void Init(uint32_t workerCount = 0);
+        static void Shutdown();
+        static JobSystem& Get();
+        static bool IsInitialized();
+
+        // Queue a job. When a counter is given it is incremented now and
+        // decremented when the job finishes, so Wait and ExecuteAfter can
+        // observe completion.
+        void Execute(std::function<void()> job, JobCounter* counter = nullptr);
+
+        // Queue a job that only becomes runnable once every job counted on
+        // `dependency` has finished; runs immediately if it already has
+        void ExecuteAfter(JobCounter& dependency, std::function<void()> job,
+                          JobCounter* counter = nullptr);
+
+        // Fork-join loop over [0, count): batches of groupSize indices are
+        // distributed across the workers and the call returns when every
+        // index has run. The calling thread works on batches too.
+        void ParallelFor(uint32_t count, uint32_t groupSize,
+                         const std::function<void(uint32_t)>& body);
+
+        // Block until the counter's jobs have all finished, helping with
+        // queued work instead of idling
+        void Wait(JobCounter& counter);
+
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    private:
+        struct Job {
+            std::function<void()> Function;
+            JobCounter* Counter = nullptr;
+        };
+
+        // One worker's deque. The owner pushes and pops at the back;
+        // thieves take from the front, so the two ends rarely contend on
+        // the same job.
+        struct WorkerQueue {
+            std::deque<Job> Jobs;
+            std::mutex Mutex;
+        };
+
+        JobSystem() = default;
+        ~JobSystem() = default;
+
+        void StartWorkers(uint32_t workerCount);
+        void StopWorkers();
+        void WorkerLoop(uint32_t workerIndex);
+
+        void Enqueue(Job&& job);
+        // Pop from own queue (back) or steal from a sibling (front);
+        // queueIndex ~0u means the caller owns no queue and only steals
+        bool TryGetJob(uint32_t queueIndex, Job& outJob);
+        void RunJob(Job& job);
+        static void FinishJob(JobCounter* counter);
+
+        std::vector<std::thread> m_Workers;
+        std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+        std::atomic<uint32_t> m_NextQueue{0}; // Round-robin submission target
+        std::atomic<bool> m_Stop{false};
+
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCondition;
+
+        static JobSystem* s_Instance;
+    };
+
+}
@@ -12,6 +12,9 @@ namespace Genesis {
         virtual void OnAttach() {}
         virtual void OnDetach() {}
         virtual void OnUpdate(float deltaTime) {}
+        // Fixed-rate simulation tick (see Application::SetFixedTimestep);
+        // may run zero or several times per rendered frame
+        virtual void OnFixedUpdate(float fixedDeltaTime) {}
         virtual void OnRender() {}
         virtual void OnImGuiRender() {}
         virtual void OnEvent(class Event& event) {}
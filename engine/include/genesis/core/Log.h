@@ -15,6 +15,10 @@ namespace Genesis {
         Fatal
     };
 
+    // Asynchronous logger: the macros below format on the calling thread,
+    // but the timestamping and console write happen on a background thread
+    // fed through a lock-free ring (see Log.cpp). Fatal bypasses the queue
+    // and flushes, since an abort usually follows.
     class Log {
     public:
         static void Init();
@@ -22,6 +26,9 @@ namespace Genesis {
 
         static void SetLevel(LogLevel level);
 
+        // Block until every message published so far has been written
+        static void Flush();
+
         template<typename... Args>
         static void Trace(const char* fmt, Args&&... args) {
             LogMessage(LogLevel::Trace, fmt, std::forward<Args>(args)...);
@@ -86,9 +93,15 @@ namespace Genesis {
 
 }
 
-// Convenience macros
-#define GEN_TRACE(...) ::Genesis::Log::Trace(__VA_ARGS__)
-#define GEN_DEBUG(...) ::Genesis::Log::Debug(__VA_ARGS__)
+// Convenience macros. Trace and debug strip to nothing outside debug
+// builds - the format arguments are not even evaluated.
+#ifdef GENESIS_DEBUG
+    #define GEN_TRACE(...) ::Genesis::Log::Trace(__VA_ARGS__)
+    #define GEN_DEBUG(...) ::Genesis::Log::Debug(__VA_ARGS__)
+#else
+    #define GEN_TRACE(...)
+    #define GEN_DEBUG(...)
+#endif
 #define GEN_INFO(...)  ::Genesis::Log::Info(__VA_ARGS__)
 #define GEN_WARN(...)  ::Genesis::Log::Warn(__VA_ARGS__)
 #define GEN_ERROR(...) ::Genesis::Log::Error(__VA_ARGS__)
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Compile-time switch for the heap instrumentation. On by default; define
+// to 0 to compile the global new/delete hooks and all counters out.
+#ifndef GEN_ENABLE_MEMORY_TRACKING
+#define GEN_ENABLE_MEMORY_TRACKING 1
+#endif
+
+namespace Genesis {
+
+    // Subsystem buckets for heap accounting. Untagged catches everything
+    // allocated outside a MemoryScope (startup, third-party internals).
+    enum class MemoryTag : uint32_t {
+        Untagged = 0,
+        Renderer,
+        ChunkManager,
+        Hydrology,
+        ECS,
+        UI,
+        Count
+    };
+
+    // Per-subsystem heap accounting fed by the global operator new/delete
+    // replacements (see MemoryTracker.cpp). Every allocation is charged to
+    // the innermost MemoryScope on the allocating thread; frees are charged
+    // to the tag the block was allocated under, whichever thread frees it,
+    // so cross-thread hand-offs (worker-generated meshes freed on the main
+    // thread) balance out.
+    class MemoryTracker {
+    public:
+        struct TagStats {
+            uint64_t CurrentBytes = 0;
+            uint64_t PeakBytes = 0;
+            // Allocation count of the last completed frame (see EndFrame)
+            uint64_t FrameAllocations = 0;
+            uint64_t TotalAllocations = 0;
+        };
+
+        // Innermost tag on the calling thread; nesting is per-thread and
+        // bounded, pushes past the fixed depth keep the current tag
+        static void PushTag(MemoryTag tag);
+        static void PopTag();
+        static MemoryTag CurrentTag();
+
+        static TagStats GetStats(MemoryTag tag);
+        static const char* TagName(MemoryTag tag);
+
+        // Latch the running per-frame allocation counters and zero them;
+        // called once per frame from the application loop
+        static void EndFrame();
+
+        static bool IsEnabled() { return GEN_ENABLE_MEMORY_TRACKING != 0; }
+
+        // Called by the operator new/delete replacements only
+        static void OnAlloc(size_t bytes, MemoryTag tag);
+        static void OnFree(size_t bytes, MemoryTag tag);
+    };
+
+    // RAII helper behind GEN_MEM_SCOPE. Must not live across a coroutine
+    // suspension point - the tag stack is thread-local and the resume may
+    // land on another thread.
+    class MemoryScope {
+    public:
+        explicit MemoryScope(MemoryTag tag) { MemoryTracker::PushTag(tag); }
+        ~MemoryScope() { MemoryTracker::PopTag(); }
+
+        MemoryScope(const MemoryScope&) = delete;
+        MemoryScope& operator=(const MemoryScope&) = delete;
+    };
+
+}
+
+#define GEN_MEM_CONCAT2(a, b) a##b
+#define GEN_MEM_CONCAT(a, b) GEN_MEM_CONCAT2(a, b)
+
+// Charge heap traffic in the enclosing scope to the given subsystem
+#define GEN_MEM_SCOPE(tag) \
+    ::Genesis::MemoryScope GEN_MEM_CONCAT(_genMemScope, __LINE__)(tag)
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Genesis {
+
+    // Lightweight scoped CPU profiler. GEN_PROFILE_SCOPE records begin/end
+    // timestamps into a per-thread ring buffer - no locks, no allocation,
+    // no string copies on the hot path (names must be string literals) -
+    // so it stays on in production builds. Profiler::DumpTrace writes the
+    // rings out as chrome://tracing JSON for offline inspection of hitchy
+    // frames.
+    class Profiler {
+    public:
+        struct Event {
+            const char* Name = nullptr;
+            uint64_t StartUs = 0;
+            uint64_t EndUs = 0;
+        };
+
+        // Record one completed scope on the calling thread. Overwrites the
+        // oldest event once the thread's ring fills.
+        static void Record(const char* name, uint64_t startUs, uint64_t endUs);
+
+        // Write every thread's retained events to a chrome://tracing JSON
+        // file (open via chrome://tracing or https://ui.perfetto.dev).
+        // Returns false if the file could not be written.
+        static bool DumpTrace(const std::string& path);
+
+        // Append every retained event that started at or after sinceUs to
+        // out, across all threads. Same tearing caveat as DumpTrace: events
+        // being written during the snapshot may be skipped.
+        static void Collect(std::vector<Event>& out, uint64_t sinceUs = 0);
+
+        // Microseconds since process profiling began, on the steady clock
+        static uint64_t NowMicroseconds() {
+            using namespace std::chrono;
+            return static_cast<uint64_t>(
+                duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+        }
+    };
+
+    // RAII helper behind GEN_PROFILE_SCOPE
+    class ProfileScope {
+    public:
+        explicit ProfileScope(const char* name)
+            : m_Name(name), m_StartUs(Profiler::NowMicroseconds()) {}
+
+        ~ProfileScope() {
+            Profiler::Record(m_Name, m_StartUs, Profiler::NowMicroseconds());
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* m_Name;
+        uint64_t m_StartUs;
+    };
+
+}
+
+#define GEN_PROFILE_CONCAT2(a, b) a##b
+#define GEN_PROFILE_CONCAT(a, b) GEN_PROFILE_CONCAT2(a, b)
+
+// Time the enclosing scope; name must be a string literal
+#define GEN_PROFILE_SCOPE(name) \
+    ::Genesis::ProfileScope GEN_PROFILE_CONCAT(_genProfileScope, __LINE__)(name)
+#define GEN_PROFILE_FUNCTION() GEN_PROFILE_SCOPE(__FUNCTION__)
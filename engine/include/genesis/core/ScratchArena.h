@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Genesis
+{
+
+    /**
+     * Thread-local bump allocator for stage-scoped temporaries.
+     *
+     * Procedural generation allocates a lot of short-lived working memory -
+     * worklists, flood-fill stacks, priority-queue storage - all freed at
+     * the end of the stage that built them and reallocated for the next
+     * chunk. With many workers generating at once those churn the global
+     * allocator; a scratch arena turns each into a pointer bump from a
+     * per-thread block that stays warm for the life of the worker.
+     *
+     * Usage: open a ScratchScope (GEN_SCRATCH_SCOPE) at the top of a stage
+     * and build temporaries as ScratchVector<T>. Individual frees are
+     * no-ops; the scope's destructor rewinds the arena to where it started,
+     * releasing everything the stage allocated at once. Scopes nest.
+     *
+     * Rules that follow from the design:
+     *  - Scratch containers must not outlive the scope that allocated them,
+     *    and results that escape the stage belong in normal vectors.
+     *  - The arena is thread-local, so neither a scope nor a scratch
+     *    container may cross a thread boundary - in particular, neither may
+     *    live across a coroutine suspension point, because the coroutine
+     *    can resume on a different worker.
+     *  - Growing a scratch container abandons its old storage until the
+     *    scope rewinds; reserve up front where the size is known.
+     */
+    class ScratchArena
+    {
+    public:
+        // Rewind point: which block the arena was on and how far into it
+        struct Marker
+        {
+            size_t Block = 0;
+            size_t Offset = 0;
+        };
+
+        // The calling thread's arena; created on first use and kept for the
+        // life of the thread
+        static ScratchArena &Get();
+
+        void *Allocate(size_t size, size_t alignment);
+
+        Marker Mark() const { return {m_BlockIndex, m_Offset}; }
+        void Rewind(const Marker &marker);
+
+        // Total block memory this thread's arena has reserved
+        size_t CapacityBytes() const;
+
+    private:
+        // Large enough that a typical chunk stage never leaves the first
+        // block; oversized requests get a dedicated block of their own size
+        static constexpr size_t BLOCK_SIZE = 1u << 20;
+
+        struct Block
+        {
+            std::unique_ptr<uint8_t[]> Data;
+            size_t Size = 0;
+        };
+
+        std::vector<Block> m_Blocks;
+        size_t m_BlockIndex = 0;
+        size_t m_Offset = 0;
+    };
+
+    // Rewinds the thread's arena to where it was at construction
+    class ScratchScope
+    {
+    public:
+        ScratchScope() : m_Marker(ScratchArena::Get().Mark()) {}
+        ~ScratchScope() { ScratchArena::Get().Rewind(m_Marker); }
+
+        ScratchScope(const ScratchScope &) = delete;
+        ScratchScope &operator=(const ScratchScope &) = delete;
+
+    private:
+        ScratchArena::Marker m_Marker;
+    };
+
+    // STL allocator over the calling thread's arena. deallocate is a no-op;
+    // memory comes back when the enclosing ScratchScope rewinds.
+    template <typename T>
+    class ScratchAllocator
+    {
+    public:
+        using value_type = T;
+
+        ScratchAllocator() = default;
+        template <typename U>
+        ScratchAllocator(const ScratchAllocator<U> &) {}
+
+        T *allocate(size_t count)
+        {
+            return static_cast<T *>(ScratchArena::Get().Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T *, size_t) {}
+
+        // All instances on one thread share that thread's arena
+        bool operator==(const ScratchAllocator &) const { return true; }
+        bool operator!=(const ScratchAllocator &) const { return false; }
+    };
+
+    template <typename T>
+    using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
+}
+
+#define GEN_SCRATCH_CONCAT2(a, b) a##b
+#define GEN_SCRATCH_CONCAT(a, b) GEN_SCRATCH_CONCAT2(a, b)
+
+// Rewind the calling thread's scratch arena when the enclosing scope ends
+#define GEN_SCRATCH_SCOPE() \
+    ::Genesis::ScratchScope GEN_SCRATCH_CONCAT(_genScratchScope, __LINE__)
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "genesis/core/Event.h"
+
 #include <string>
-#include <functional>
+#include <vector>
 
 struct GLFWwindow;
 
@@ -11,19 +13,23 @@ namespace Genesis {
 
     class Window {
     public:
-        using EventCallbackFn = std::function<void(class Event&)>;
-
         Window(const WindowProps& props);
         ~Window();
 
         void OnUpdate();
         void PollEvents();
 
+        // Move this frame's queued events into out (swap-based, so both
+        // buffers keep their capacity). The GLFW callbacks enqueue with
+        // coalescing: consecutive cursor moves collapse to the latest
+        // position, scroll ticks accumulate their deltas and a resize
+        // drag keeps only the final size.
+        void DrainEvents(std::vector<Event>& out);
+
         uint32_t GetWidth() const { return m_Data.Width; }
         uint32_t GetHeight() const { return m_Data.Height; }
         float GetAspectRatio() const { return static_cast<float>(m_Data.Width) / static_cast<float>(m_Data.Height); }
 
-        void SetEventCallback(const EventCallbackFn& callback) { m_Data.EventCallback = callback; }
         void SetVSync(bool enabled);
         bool IsVSync() const { return m_Data.VSync; }
 
@@ -45,7 +51,7 @@ namespace Genesis {
             uint32_t Width = 0;
             uint32_t Height = 0;
             bool VSync = false;
-            EventCallbackFn EventCallback;
+            std::vector<Event> EventQueue;
         };
 
         WindowData m_Data;
@@ -19,7 +19,11 @@ namespace Genesis {
         TagComponent(const std::string& tag) : Tag(tag) {}
     };
 
-    // Transform component
+    // Transform component. The world and normal matrices are cached and
+    // rebuilt only when the source fields change; since the pools store
+    // components densely (see Registry), the cached matrices of all
+    // entities form a contiguous strided array that render and culling
+    // passes walk without recomputing anything per frame.
     struct TransformComponent {
         glm::vec3 Position{0.0f, 0.0f, 0.0f};
         glm::vec3 Rotation{0.0f, 0.0f, 0.0f};  // Euler angles in radians
@@ -28,11 +32,24 @@ namespace Genesis {
         TransformComponent() = default;
         TransformComponent(const glm::vec3& position) : Position(position) {}
 
-        glm::mat4 GetTransform() const {
-            glm::mat4 rotation = glm::toMat4(glm::quat(Rotation));
-            return glm::translate(glm::mat4(1.0f), Position)
-                 * rotation
-                 * glm::scale(glm::mat4(1.0f), Scale);
+        void SetPosition(const glm::vec3& position) { Position = position; CacheDirty = true; }
+        void SetRotation(const glm::vec3& rotation) { Rotation = rotation; CacheDirty = true; }
+        void SetScale(const glm::vec3& scale) { Scale = scale; CacheDirty = true; }
+
+        const glm::mat4& GetTransform() const {
+            if (CacheStale()) {
+                RebuildCache();
+            }
+            return CachedWorld;
+        }
+
+        // Inverse-transpose of the world matrix, for transforming normals
+        // under non-uniform scale. Computed once per change, not per draw.
+        const glm::mat4& GetNormalMatrix() const {
+            if (CacheStale()) {
+                RebuildCache();
+            }
+            return CachedNormal;
         }
 
         glm::vec3 GetForward() const {
@@ -50,6 +67,36 @@ namespace Genesis {
         glm::vec3 GetUp() const {
             return glm::normalize(glm::cross(GetRight(), GetForward()));
         }
+
+        // Cache state. Everything stays public (single access level) so the
+        // struct keeps standard layout for the editor's offsetof-based
+        // property tables, which also means the source fields above can be
+        // written directly without going through the setters - so staleness
+        // is detected by comparing against the values the cache was built
+        // from, with the dirty flag as a fast path for the setters.
+        mutable glm::vec3 CachedPosition{0.0f, 0.0f, 0.0f};
+        mutable glm::vec3 CachedRotation{0.0f, 0.0f, 0.0f};
+        mutable glm::vec3 CachedScale{0.0f, 0.0f, 0.0f};
+        mutable glm::mat4 CachedWorld{1.0f};
+        mutable glm::mat4 CachedNormal{1.0f};
+        mutable bool CacheDirty = true;
+
+        bool CacheStale() const {
+            return CacheDirty || Position != CachedPosition
+                || Rotation != CachedRotation || Scale != CachedScale;
+        }
+
+        void RebuildCache() const {
+            glm::mat4 rotation = glm::toMat4(glm::quat(Rotation));
+            CachedWorld = glm::translate(glm::mat4(1.0f), Position)
+                        * rotation
+                        * glm::scale(glm::mat4(1.0f), Scale);
+            CachedNormal = glm::transpose(glm::inverse(CachedWorld));
+            CachedPosition = Position;
+            CachedRotation = Rotation;
+            CachedScale = Scale;
+            CacheDirty = false;
+        }
     };
 
     // Mesh renderer component
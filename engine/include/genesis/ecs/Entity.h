@@ -30,6 +30,7 @@ namespace Genesis {
 
         bool IsValid() const { return m_EntityID != 0 && m_Scene != nullptr; }
         uint64_t GetID() const { return m_EntityID; }
+        Scene* GetScene() const { return m_Scene; }
 
         operator bool() const { return IsValid(); }
         operator uint64_t() const { return m_EntityID; }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Genesis {
+
+    // 32-bit handle to an interned name. Handles for equal strings are
+    // equal, so comparison and hashing are integer operations, and a
+    // default-constructed handle names the empty string.
+    struct NameHandle {
+        uint32_t Index = 0;
+
+        bool operator==(const NameHandle& other) const { return Index == other.Index; }
+        bool operator!=(const NameHandle& other) const { return Index != other.Index; }
+    };
+
+    // Process-wide string interning table behind NameHandle.
+    //
+    // Entity names repeat heavily - bulk creation stamps out "Tree",
+    // "Rock" and friends by the thousand - so storing a std::string per
+    // entity means per-entity heap allocations and cache-missing string
+    // compares in UI-frequency code. Interning stores each unique name
+    // once and hands out stable 32-bit handles; the strings are never
+    // freed, so resolved references stay valid for the life of the
+    // process. Intern takes a lock (names are created rarely); Resolve is
+    // lock-free since entries are append-only.
+    class NameTable {
+    public:
+        static NameHandle Intern(std::string_view name);
+
+        static const std::string& Resolve(NameHandle handle);
+
+        // Lower-cased form of the name, computed once per unique name; the
+        // hierarchy panel's case-insensitive filter matches against this
+        // instead of lowering every entity's name on each cache rebuild
+        static const std::string& ResolveLower(NameHandle handle);
+
+        static size_t UniqueNameCount();
+    };
+
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Genesis {
+
+    // Sequential per-component-type ids, assigned on first use; they index
+    // the registry's pool table directly, so component access never hashes
+    inline uint32_t NextComponentTypeID() {
+        static uint32_t s_Next = 0;
+        return s_Next++;
+    }
+
+    template<typename T>
+    uint32_t ComponentTypeID() {
+        static uint32_t s_ID = NextComponentTypeID();
+        return s_ID;
+    }
+
+    // Type-erased pool interface so the registry can remove and clone
+    // components during entity destruction and scene copies
+    class IComponentPool {
+    public:
+        virtual ~IComponentPool() = default;
+
+        virtual bool Has(uint64_t entity) const = 0;
+        virtual void Remove(uint64_t entity) = 0;
+        virtual void Clear() = 0;
+        virtual size_t Size() const = 0;
+        virtual uint64_t EntityAt(size_t denseIndex) const = 0;
+        virtual std::unique_ptr<IComponentPool> Clone() const = 0;
+        virtual void CopyInto(IComponentPool& target) const = 0;
+    };
+
+    // Sparse-set storage for one component type. Components live in one
+    // contiguous dense array with a parallel entity-id array; a sparse
+    // array indexed by entity id points at the dense slot. Add, get,
+    // remove and has are O(1), removal swap-and-pops so the dense array
+    // never holds holes, and iterating a pool walks memory linearly.
+    template<typename T>
+    class ComponentPool : public IComponentPool {
+    public:
+        static constexpr size_t NPOS = static_cast<size_t>(-1);
+
+        template<typename... Args>
+        T& Emplace(uint64_t entity, Args&&... args) {
+            size_t index = DenseIndex(entity);
+            if (index != NPOS) {
+                // AddComponent on an existing component replaces it
+                m_Components[index] = T(std::forward<Args>(args)...);
+                return m_Components[index];
+            }
+
+            if (entity >= m_Sparse.size()) {
+                m_Sparse.resize(entity + 1, NPOS);
+            }
+            m_Sparse[entity] = m_Components.size();
+            m_Entities.push_back(entity);
+            m_Components.emplace_back(std::forward<Args>(args)...);
+            return m_Components.back();
+        }
+
+        T& Get(uint64_t entity) { return m_Components[m_Sparse[entity]]; }
+        const T& Get(uint64_t entity) const { return m_Components[m_Sparse[entity]]; }
+
+        bool Has(uint64_t entity) const override { return DenseIndex(entity) != NPOS; }
+
+        void Remove(uint64_t entity) override {
+            size_t index = DenseIndex(entity);
+            if (index == NPOS) {
+                return;
+            }
+
+            // Swap-and-pop keeps the dense arrays contiguous
+            size_t last = m_Components.size() - 1;
+            if (index != last) {
+                m_Components[index] = std::move(m_Components[last]);
+                m_Entities[index] = m_Entities[last];
+                m_Sparse[m_Entities[index]] = index;
+            }
+            m_Components.pop_back();
+            m_Entities.pop_back();
+            m_Sparse[entity] = NPOS;
+        }
+
+        void Clear() override {
+            m_Components.clear();
+            m_Entities.clear();
+            m_Sparse.clear();
+        }
+
+        size_t Size() const override { return m_Components.size(); }
+        uint64_t EntityAt(size_t denseIndex) const override { return m_Entities[denseIndex]; }
+
+        std::unique_ptr<IComponentPool> Clone() const override {
+            return std::make_unique<ComponentPool<T>>(*this);
+        }
+
+        void CopyInto(IComponentPool& target) const override {
+            // Vector assignment reuses the target's capacity, so repeated
+            // copies into the same pool stop allocating after the first
+            auto& pool = static_cast<ComponentPool<T>&>(target);
+            pool.m_Components = m_Components;
+            pool.m_Entities = m_Entities;
+            pool.m_Sparse = m_Sparse;
+        }
+
+        // Dense arrays, for systems that iterate a whole pool linearly
+        T* Data() { return m_Components.data(); }
+        const std::vector<uint64_t>& Entities() const { return m_Entities; }
+
+    private:
+        size_t DenseIndex(uint64_t entity) const {
+            return entity < m_Sparse.size() ? m_Sparse[entity] : NPOS;
+        }
+
+        std::vector<T> m_Components;      // Dense component data
+        std::vector<uint64_t> m_Entities; // Dense entity ids, parallel to the data
+        std::vector<size_t> m_Sparse;     // Entity id -> dense index (NPOS = absent)
+    };
+
+    // One pool per component type, indexed by ComponentTypeID. Views drive
+    // iteration from the smallest pool involved and probe the others with
+    // O(1) sparse lookups.
+    class Registry {
+    public:
+        template<typename T>
+        ComponentPool<T>& Pool() {
+            uint32_t id = ComponentTypeID<T>();
+            if (id >= m_Pools.size()) {
+                m_Pools.resize(id + 1);
+            }
+            if (!m_Pools[id]) {
+                m_Pools[id] = std::make_unique<ComponentPool<T>>();
+            }
+            return *static_cast<ComponentPool<T>*>(m_Pools[id].get());
+        }
+
+        // Entity ids holding every listed component
+        template<typename... Components>
+        std::vector<uint64_t> View() {
+            IComponentPool* pools[] = {&Pool<Components>()...};
+
+            IComponentPool* driver = pools[0];
+            for (IComponentPool* pool : pools) {
+                if (pool->Size() < driver->Size()) {
+                    driver = pool;
+                }
+            }
+
+            std::vector<uint64_t> result;
+            result.reserve(driver->Size());
+            for (size_t i = 0; i < driver->Size(); i++) {
+                uint64_t entity = driver->EntityAt(i);
+                bool all = true;
+                for (IComponentPool* pool : pools) {
+                    if (pool != driver && !pool->Has(entity)) {
+                        all = false;
+                        break;
+                    }
+                }
+                if (all) {
+                    result.push_back(entity);
+                }
+            }
+            return result;
+        }
+
+        // Invoke func(entity, Components&...) for every matching entity
+        template<typename... Components, typename Func>
+        void Each(Func&& func) {
+            for (uint64_t entity : View<Components...>()) {
+                func(entity, Pool<Components>().Get(entity)...);
+            }
+        }
+
+        void RemoveAll(uint64_t entity) {
+            for (auto& pool : m_Pools) {
+                if (pool) {
+                    pool->Remove(entity);
+                }
+            }
+        }
+
+        void Clear() {
+            for (auto& pool : m_Pools) {
+                if (pool) {
+                    pool->Clear();
+                }
+            }
+        }
+
+        // Deep copy into another registry, reusing the target's pools and
+        // their storage when it has been copied into before. Pool slots line
+        // up because ComponentTypeID is process-global.
+        void CopyInto(Registry& target) const {
+            if (target.m_Pools.size() < m_Pools.size()) {
+                target.m_Pools.resize(m_Pools.size());
+            }
+            for (size_t i = 0; i < target.m_Pools.size(); i++) {
+                if (i < m_Pools.size() && m_Pools[i]) {
+                    if (target.m_Pools[i]) {
+                        m_Pools[i]->CopyInto(*target.m_Pools[i]);
+                    } else {
+                        target.m_Pools[i] = m_Pools[i]->Clone();
+                    }
+                } else if (target.m_Pools[i]) {
+                    target.m_Pools[i]->Clear();
+                }
+            }
+        }
+
+    private:
+        std::vector<std::unique_ptr<IComponentPool>> m_Pools;
+    };
+
+}
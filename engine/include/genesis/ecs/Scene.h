@@ -1,16 +1,27 @@
 #pragma once
 
+#include "genesis/ecs/Entity.h"
+#include "genesis/ecs/NameTable.h"
+#include "genesis/ecs/Registry.h"
+#include "genesis/ecs/SystemScheduler.h"
+#include "genesis/core/JobSystem.h"
+
 #include <string>
 #include <vector>
-#include <memory>
-#include <unordered_map>
 
 namespace Genesis {
 
-    class Entity;
     class Renderer;
 
     class Scene {
+        struct EntityData {
+            uint64_t ID;
+            bool Active;
+            // Interned: one shared allocation per unique name, and bulk
+            // creation of same-named entities allocates nothing
+            NameHandle Name;
+        };
+
     public:
         Scene(const std::string& name = "Untitled Scene");
         ~Scene();
@@ -18,44 +29,152 @@ namespace Genesis {
         Entity CreateEntity(const std::string& name = "Entity");
         void DestroyEntity(Entity entity);
 
+        // Recreate an entity under a known ID (editor undo of a destroy);
+        // the ID counter advances past it so later creates never collide
+        Entity CreateEntityWithID(uint64_t id, const std::string& name);
+
+        const std::string& GetEntityName(uint64_t id) const;
+        NameHandle GetEntityNameHandle(uint64_t id) const;
+
         void OnUpdate(float deltaTime);
         void OnRender(Renderer& renderer);
 
         const std::string& GetName() const { return m_Name; }
         void SetName(const std::string& name) { m_Name = name; }
 
+        // Entities holding every listed component. Iteration is driven from
+        // the smallest pool's dense array, so the common single-component
+        // case is a straight linear walk.
         template<typename... Components>
-        auto GetEntitiesWith() { return m_Registry.view<Components...>(); }
+        std::vector<Entity> GetEntitiesWith() {
+            std::vector<Entity> entities;
+            auto ids = m_Registry.View<Components...>();
+            entities.reserve(ids.size());
+            for (uint64_t id : ids) {
+                entities.emplace_back(id, this);
+            }
+            return entities;
+        }
+
+        // Invoke func(entity, Components&...) per match without building an
+        // entity list; component references come straight from the pools
+        template<typename... Components, typename Func>
+        void ForEach(Func&& func) {
+            m_Registry.Each<Components...>([&](uint64_t id, Components&... components) {
+                func(Entity(id, this), components...);
+            });
+        }
+
+        // ForEach fanned out over the job system workers: the matching
+        // entity list is built once, then index ranges run concurrently.
+        // For use inside systems - the callback must stay within the
+        // component set its system declared, and must not create or
+        // destroy entities. Small matches run inline; the fork-join
+        // overhead only pays for itself in bulk.
+        template<typename... Components, typename Func>
+        void ParallelForEach(Func&& func, uint32_t groupSize = 64) {
+            std::vector<uint64_t> ids = m_Registry.View<Components...>();
+            if (!JobSystem::IsInitialized() || ids.size() < groupSize) {
+                for (uint64_t id : ids) {
+                    func(Entity(id, this), m_Registry.Pool<Components>().Get(id)...);
+                }
+                return;
+            }
+            JobSystem::Get().ParallelFor(static_cast<uint32_t>(ids.size()), groupSize,
+                                         [&](uint32_t i) {
+                uint64_t id = ids[i];
+                func(Entity(id, this), m_Registry.Pool<Components>().Get(id)...);
+            });
+        }
+
+        // Monotonic counter bumped whenever the entity list changes
+        // (create, destroy, clear, snapshot restore). Editor panels key
+        // cached derived lists off it instead of rebuilding per frame.
+        uint64_t GetEntityListVersion() const { return m_EntityListVersion; }
+
+        // Companion counter for component data: anything mutating a
+        // component outside the normal simulation path (editor commands,
+        // gizmos) bumps it so cached property views know to re-read
+        uint64_t GetComponentVersion() const { return m_ComponentVersion; }
+        void MarkComponentsChanged() { m_ComponentVersion++; }
+
+        // Visit every live entity with its name handle, in creation
+        // order; resolve through NameTable where display text is needed
+        template<typename Func>
+        void ForEachEntity(Func&& func) {
+            for (const EntityData& data : m_Entities) {
+                if (data.Active) {
+                    func(Entity(data.ID, this), data.Name);
+                }
+            }
+        }
+
+        size_t GetEntityCount() const { return m_Entities.size(); }
 
         // Scene management
         void Clear();
         void CopyTo(Scene& other);
 
+        // Play-mode snapshot: a reusable deep copy of the entity list and
+        // every component pool. Storage persists across Take/Restore, so
+        // after the first capture a play-mode toggle is a handful of
+        // pool-sized buffer copies with no per-entity allocations.
+        class Snapshot {
+        private:
+            friend class Scene;
+
+            std::vector<EntityData> m_Entities;
+            uint64_t m_NextID = 1;
+            Registry m_Registry;
+        };
+
+        void TakeSnapshot(Snapshot& out);
+        void RestoreSnapshot(const Snapshot& snapshot);
+
         // Internal registry access (for ECS)
-        auto& GetRegistry() { return m_Registry; }
+        Registry& GetRegistry() { return m_Registry; }
+
+        // Per-frame systems; OnUpdate runs them, overlapping the ones
+        // whose declared component accesses cannot conflict
+        SystemScheduler& GetSystems() { return m_Systems; }
 
     private:
         friend class Entity;
 
         std::string m_Name;
-        
-        // Simple entity storage - in production, use entt or similar
-        struct EntityData {
-            uint64_t ID;
-            bool Active;
-            std::string Name;
-        };
-        
-        struct Registry {
-            std::vector<EntityData> Entities;
-            uint64_t NextID = 1;
-            
-            template<typename... Components>
-            std::vector<uint64_t> view() { return {}; } // Placeholder
-        };
-        
+        std::vector<EntityData> m_Entities;
+        uint64_t m_NextID = 1;
+        uint64_t m_EntityListVersion = 0;
+        uint64_t m_ComponentVersion = 0;
         Registry m_Registry;
-        std::unordered_map<uint64_t, std::unique_ptr<class EntityComponents>> m_Components;
+        SystemScheduler m_Systems;
     };
 
+    // Entity component access, declared in Entity.h; defined here because
+    // the templates need the full Scene definition
+    template<typename T, typename... Args>
+    T& Entity::AddComponent(Args&&... args) {
+        return m_Scene->m_Registry.Pool<T>().Emplace(m_EntityID, std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    T& Entity::GetComponent() {
+        return m_Scene->m_Registry.Pool<T>().Get(m_EntityID);
+    }
+
+    template<typename T>
+    const T& Entity::GetComponent() const {
+        return m_Scene->m_Registry.Pool<T>().Get(m_EntityID);
+    }
+
+    template<typename T>
+    bool Entity::HasComponent() const {
+        return m_Scene->m_Registry.Pool<T>().Has(m_EntityID);
+    }
+
+    template<typename T>
+    void Entity::RemoveComponent() {
+        m_Scene->m_Registry.Pool<T>().Remove(m_EntityID);
+    }
+
 }
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "genesis/ecs/Registry.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Genesis {
+
+    class Scene;
+
+    // Bitmask over ComponentTypeIDs, for declaring which component types a
+    // system touches. IDs are assigned sequentially on first use (see
+    // Registry), so the first 64 registered types fit; the engine is
+    // nowhere near that.
+    template<typename... Components>
+    uint64_t ComponentMask() {
+        uint64_t mask = 0;
+        ((mask |= 1ull << ComponentTypeID<Components>()), ...);
+        return mask;
+    }
+
+    // Runs registered systems once per frame, overlapping systems whose
+    // declared component accesses cannot conflict. Two systems conflict
+    // when either one writes a component type the other reads or writes.
+    // Registration order is the serial order: systems are grouped into
+    // waves greedily - a wave grows until the next system conflicts with
+    // one already in it - and each wave fans out on the job system with a
+    // join before the next, so a conflicting pair never runs concurrently
+    // and never reorders.
+    class SystemScheduler {
+    public:
+        using SystemFn = std::function<void(Scene&, float)>;
+
+        // reads/writes are ComponentMask<...>() values; a system that
+        // touches no components (or only external state) passes zero for
+        // both and parallelizes with everything. The name must be a string
+        // literal (it feeds GEN_PROFILE_SCOPE, which keeps the pointer).
+        void Register(const char* name, uint64_t reads, uint64_t writes, SystemFn update);
+
+        // Run every system once for this frame
+        void Run(Scene& scene, float deltaTime);
+
+        size_t SystemCount() const { return m_Systems.size(); }
+
+    private:
+        struct System {
+            const char* Name = nullptr;
+            uint64_t Reads = 0;
+            uint64_t Writes = 0;
+            SystemFn Update;
+        };
+
+        static bool Conflicts(const System& a, const System& b);
+        void RunWave(Scene& scene, float deltaTime, size_t first, size_t count);
+
+        std::vector<System> m_Systems;
+    };
+
+}
@@ -1,13 +1,20 @@
 #pragma once
 
 #include "genesis/core/Layer.h"
+#include "genesis/renderer/VulkanBuffer.h"
+
 #include <vulkan/vulkan.h>
+#include <memory>
+#include <vector>
+
+struct ImDrawData;
 
 namespace Genesis
 {
 
     class VulkanDevice;
     class VulkanSwapchain;
+    class VulkanPipeline;
 
     class ImGuiLayer : public Layer
     {
@@ -28,9 +35,35 @@ namespace Genesis
         void CreateDescriptorPool();
         void SetupImGuiStyle();
 
+        // Own draw-data path replacing ImGui_ImplVulkan_RenderDrawData: the
+        // stock backend maps and unmaps its buffers every frame, this one
+        // writes through persistently mapped per-frame-in-flight buffers
+        void CreateRenderResources();
+        void DestroyRenderResources();
+        void RenderDrawData(ImDrawData *drawData, VkCommandBuffer cmd);
+
     private:
+        // Geometry for one frame in flight. Capacities grow by doubling and
+        // the buffers stay mapped for their whole lifetime, so a steady UI
+        // performs zero allocations and zero map calls per frame.
+        struct FrameGeometry
+        {
+            VulkanBuffer VertexBuffer;
+            VulkanBuffer IndexBuffer;
+            VkDeviceSize VertexCapacity = 0;
+            VkDeviceSize IndexCapacity = 0;
+        };
+
+        void EnsureGeometryCapacity(FrameGeometry &geometry, VkDeviceSize vertexBytes,
+                                    VkDeviceSize indexBytes);
+
         VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
         bool m_BlockEvents = true;
+
+        VkDescriptorSetLayout m_TextureSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        std::unique_ptr<VulkanPipeline> m_Pipeline;
+        std::vector<FrameGeometry> m_Geometry; // one per frame in flight
     };
 
 }
@@ -2,13 +2,176 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_access.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/quaternion.hpp>
+#include <cstdint>
 #include <random>
 #include <cmath>
 
+// SSE2 is baseline on every x86-64 target; other architectures fall back
+// to the scalar paths below
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GEN_MATH_SSE 1
+    #include <emmintrin.h>
+#endif
+
 namespace Genesis {
 
+    // Axis-aligned bounding box, 16-byte aligned so the min/max pairs load
+    // as single vector registers in the culling paths
+    struct alignas(16) AABB {
+        glm::vec3 Min{0.0f};
+        float _PadMin = 0.0f;
+        glm::vec3 Max{0.0f};
+        float _PadMax = 0.0f;
+
+        AABB() = default;
+        AABB(const glm::vec3& min, const glm::vec3& max) : Min(min), Max(max) {}
+
+        glm::vec3 Center() const { return (Min + Max) * 0.5f; }
+        glm::vec3 Extents() const { return (Max - Min) * 0.5f; }
+
+        void Expand(const glm::vec3& point) {
+            Min = glm::min(Min, point);
+            Max = glm::max(Max, point);
+        }
+
+        // Tight AABB of this box under an affine transform (Arvo's method:
+        // center moves with the full matrix, extents with its absolute
+        // value), without visiting the eight corners
+        AABB Transformed(const glm::mat4& transform) const {
+            glm::vec3 center = glm::vec3(transform * glm::vec4(Center(), 1.0f));
+            glm::mat3 absRotation(
+                glm::abs(glm::vec3(transform[0])),
+                glm::abs(glm::vec3(transform[1])),
+                glm::abs(glm::vec3(transform[2])));
+            glm::vec3 extents = absRotation * Extents();
+            return AABB(center - extents, center + extents);
+        }
+    };
+
+    // Eight AABBs in struct-of-arrays layout: each component array feeds
+    // the 4-wide vector lanes directly in Frustum::TestBatch
+    struct alignas(16) AABBBatch8 {
+        float MinX[8];
+        float MinY[8];
+        float MinZ[8];
+        float MaxX[8];
+        float MaxY[8];
+        float MaxZ[8];
+
+        void Set(size_t index, const glm::vec3& min, const glm::vec3& max) {
+            MinX[index] = min.x;
+            MinY[index] = min.y;
+            MinZ[index] = min.z;
+            MaxX[index] = max.x;
+            MaxY[index] = max.y;
+            MaxZ[index] = max.z;
+        }
+    };
+
+    // View frustum as six inward-facing planes (xyz = normal, w = distance),
+    // extracted from a view-projection matrix (Gribb/Hartmann method)
+    struct Frustum {
+        glm::vec4 Planes[6];
+
+        static Frustum FromViewProjection(const glm::mat4& viewProjection) {
+            Frustum frustum;
+            glm::vec4 row0 = glm::row(viewProjection, 0);
+            glm::vec4 row1 = glm::row(viewProjection, 1);
+            glm::vec4 row2 = glm::row(viewProjection, 2);
+            glm::vec4 row3 = glm::row(viewProjection, 3);
+
+            frustum.Planes[0] = row3 + row0; // Left
+            frustum.Planes[1] = row3 - row0; // Right
+            frustum.Planes[2] = row3 + row1; // Bottom
+            frustum.Planes[3] = row3 - row1; // Top
+            frustum.Planes[4] = row3 + row2; // Near
+            frustum.Planes[5] = row3 - row2; // Far
+
+            for (auto& plane : frustum.Planes) {
+                float length = glm::length(glm::vec3(plane));
+                if (length > 1e-6f) {
+                    plane /= length;
+                }
+            }
+            return frustum;
+        }
+
+        // Conservative AABB test: true if the box is at least partially inside
+        bool IntersectsAABB(const glm::vec3& min, const glm::vec3& max) const {
+            for (const auto& plane : Planes) {
+                // Positive vertex: corner farthest along the plane normal
+                glm::vec3 positive(
+                    plane.x >= 0.0f ? max.x : min.x,
+                    plane.y >= 0.0f ? max.y : min.y,
+                    plane.z >= 0.0f ? max.z : min.z);
+
+                if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool IntersectsAABB(const AABB& box) const {
+            return IntersectsAABB(box.Min, box.Max);
+        }
+
+        // Batched conservative test: bit i of the result is set if box i is
+        // at least partially inside. Runs the positive-vertex test for all
+        // eight boxes per plane across vector lanes, so culling loops in
+        // ChunkManager and InstancedRenderer pay one call per eight boxes.
+        uint8_t TestBatch(const AABBBatch8& batch) const {
+#ifdef GEN_MATH_SSE
+            // Start fully visible; each plane clears lanes that fall
+            // entirely outside it
+            __m128 insideLo = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            __m128 insideHi = insideLo;
+
+            for (const auto& plane : Planes) {
+                __m128 px = _mm_set1_ps(plane.x);
+                __m128 py = _mm_set1_ps(plane.y);
+                __m128 pz = _mm_set1_ps(plane.z);
+                __m128 pw = _mm_set1_ps(plane.w);
+
+                // Positive vertex per axis: max when the normal component
+                // is non-negative, min otherwise - uniform per plane, so
+                // pick the source array scalar-side
+                const float* xs = plane.x >= 0.0f ? batch.MaxX : batch.MinX;
+                const float* ys = plane.y >= 0.0f ? batch.MaxY : batch.MinY;
+                const float* zs = plane.z >= 0.0f ? batch.MaxZ : batch.MinZ;
+
+                __m128 distLo = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(px, _mm_load_ps(xs)),
+                               _mm_mul_ps(py, _mm_load_ps(ys))),
+                    _mm_add_ps(_mm_mul_ps(pz, _mm_load_ps(zs)), pw));
+                __m128 distHi = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(px, _mm_load_ps(xs + 4)),
+                               _mm_mul_ps(py, _mm_load_ps(ys + 4))),
+                    _mm_add_ps(_mm_mul_ps(pz, _mm_load_ps(zs + 4)), pw));
+
+                insideLo = _mm_and_ps(insideLo, _mm_cmpge_ps(distLo, _mm_setzero_ps()));
+                insideHi = _mm_and_ps(insideHi, _mm_cmpge_ps(distHi, _mm_setzero_ps()));
+            }
+
+            return static_cast<uint8_t>(_mm_movemask_ps(insideLo) |
+                                        (_mm_movemask_ps(insideHi) << 4));
+#else
+            uint8_t mask = 0;
+            for (size_t i = 0; i < 8; i++) {
+                glm::vec3 min(batch.MinX[i], batch.MinY[i], batch.MinZ[i]);
+                glm::vec3 max(batch.MaxX[i], batch.MaxY[i], batch.MaxZ[i]);
+                if (IntersectsAABB(min, max)) {
+                    mask |= static_cast<uint8_t>(1u << i);
+                }
+            }
+            return mask;
+#endif
+        }
+    };
+
     class Math {
     public:
         static constexpr float PI = 3.14159265358979323846f;
@@ -61,6 +224,16 @@ namespace Genesis {
         // Distance helpers
         static float Distance(const glm::vec3& a, const glm::vec3& b) { return glm::distance(a, b); }
         static float DistanceSquared(const glm::vec3& a, const glm::vec3& b) { return glm::distance2(a, b); }
+
+        // Affine transform helpers that skip the w divide and the fourth
+        // row a full mat4 * vec4 pays for
+        static glm::vec3 TransformPoint(const glm::mat4& m, const glm::vec3& p) {
+            return glm::vec3(m[0]) * p.x + glm::vec3(m[1]) * p.y + glm::vec3(m[2]) * p.z + glm::vec3(m[3]);
+        }
+
+        static glm::vec3 TransformDirection(const glm::mat4& m, const glm::vec3& d) {
+            return glm::vec3(m[0]) * d.x + glm::vec3(m[1]) * d.y + glm::vec3(m[2]) * d.z;
+        }
     };
 
     // Procedural generation helpers
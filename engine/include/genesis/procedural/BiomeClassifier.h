@@ -153,11 +153,17 @@ namespace Genesis
         /**
          * Classify all cells based on climate data.
          *
+         * When a dirty region is supplied and the grid dimensions are
+         * unchanged, only cells inside the region are re-weighted;
+         * everything else keeps its previous classification.
+         *
          * @param climate  Climate data (temperature, moisture, fertility)
          * @param wetlands Wetland data for wetland biome classification
+         * @param region   Optional changed-cell region; nullptr = full pass
          */
         void Classify(const ClimateData &climate,
-                      const WetlandData *wetlands = nullptr);
+                      const WetlandData *wetlands = nullptr,
+                      const DirtyRegion *region = nullptr);
 
         /**
          * Get the biome data.
@@ -193,11 +199,22 @@ namespace Genesis
 
     private:
         /**
-         * Compute biome weights for a single cell.
-         * Uses smooth thresholds for soft classification.
+         * Evaluate the full threshold rule set for one (temperature,
+         * moisture) pair. Returns unnormalized weights without the wetland
+         * modifier or the temperate fallback - those are applied per cell
+         * by Classify. Only used to build the lookup table; per-cell
+         * classification goes through LookupBaseWeights.
+         */
+        BiomeWeights ComputeBiomeWeights(float temperature, float moisture) const;
+
+        /**
+         * Fetch precomputed weights by the quantized climate bytes. The
+         * 256x256 table covers the exact storage domain of the quantized
+         * temperature/moisture fields, so a fetch reproduces per-cell rule
+         * evaluation bit for bit. The thresholds are compile-time
+         * constants, so one lazily built table serves every classifier.
          */
-        BiomeWeights ComputeBiomeWeights(float temperature, float moisture,
-                                         float fertility, bool isWetland) const;
+        static const BiomeWeights &LookupBaseWeights(uint8_t temperature, uint8_t moisture);
 
         /**
          * Smooth threshold function for biome boundaries.
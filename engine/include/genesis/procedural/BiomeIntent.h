@@ -174,6 +174,12 @@ namespace Genesis
         // Domain warping for climate zones
         float climateWarpStrength = 0.2f;
         float climateWarpScale = 0.5f;
+
+        // Climate noise resolution divisor. FBM is evaluated on a coarse
+        // lattice (one sample per N cells) and bilinearly interpolated;
+        // climate noise is low-frequency so 4 (32x32 on a 128 chunk) is
+        // visually identical at ~1/16 the FBM calls. 1 = full resolution.
+        int resolutionDivisor = 4;
     };
 
     /**
@@ -2,6 +2,7 @@
 
 #include "genesis/procedural/BiomeIntent.h"
 #include "genesis/procedural/HydrologyData.h"
+#include "genesis/core/ScratchArena.h"
 #include "genesis/procedural/Noise.h"
 #include <glm/glm.hpp>
 #include <vector>
@@ -20,23 +21,26 @@ namespace Genesis
      */
     struct ClimateData
     {
+        // All fields are bounded and smooth, so they stay resident as
+        // one byte per cell; accessors convert to float on read.
+
         // Section 27.1: Temperature field [-1, 1]
         // Negative = cold (polar), Positive = hot (tropical)
-        std::vector<float> temperature;
+        QuantizedField temperature{-1.0f, 1.0f};
 
         // Section 27.2: Moisture field [0, 1]
         // 0 = arid, 1 = saturated
-        std::vector<float> moisture;
+        QuantizedField moisture;
 
         // Section 27.3: Fertility field [0, 1]
         // 0 = barren, 1 = lush
-        std::vector<float> fertility;
+        QuantizedField fertility;
 
         // Altitude cooling factor [0, 1]
-        std::vector<float> altitudeCooling;
+        QuantizedField altitudeCooling;
 
         // Rain shadow intensity [0, 1]
-        std::vector<float> rainShadow;
+        QuantizedField rainShadow;
 
         int width = 0;
         int depth = 0;
@@ -46,20 +50,20 @@ namespace Genesis
             width = w;
             depth = d;
             size_t size = static_cast<size_t>(w) * d;
-            temperature.resize(size, 0.0f);
-            moisture.resize(size, 0.5f);
-            fertility.resize(size, 0.5f);
-            altitudeCooling.resize(size, 0.0f);
-            rainShadow.resize(size, 0.0f);
+            temperature.Resize(size, 0.0f);
+            moisture.Resize(size, 0.5f);
+            fertility.Resize(size, 0.5f);
+            altitudeCooling.Resize(size, 0.0f);
+            rainShadow.Resize(size, 0.0f);
         }
 
         void Clear()
         {
-            std::fill(temperature.begin(), temperature.end(), 0.0f);
-            std::fill(moisture.begin(), moisture.end(), 0.5f);
-            std::fill(fertility.begin(), fertility.end(), 0.5f);
-            std::fill(altitudeCooling.begin(), altitudeCooling.end(), 0.0f);
-            std::fill(rainShadow.begin(), rainShadow.end(), 0.0f);
+            temperature.Fill(0.0f);
+            moisture.Fill(0.5f);
+            fertility.Fill(0.5f);
+            altitudeCooling.Fill(0.0f);
+            rainShadow.Fill(0.0f);
         }
 
         size_t Index(int x, int z) const { return static_cast<size_t>(z) * width + x; }
@@ -78,7 +82,7 @@ namespace Genesis
         /**
          * Initialize with noise generator and settings.
          */
-        void Initialize(SimplexNoise *noise, const ClimateSettings &settings);
+        void Initialize(const SimplexNoise *noise, const ClimateSettings &settings);
 
         /**
          * Generate all climate fields.
@@ -192,7 +196,29 @@ namespace Genesis
          */
         void ComputeSimplifiedFertility();
 
-        SimplexNoise *m_Noise = nullptr;
+        /**
+         * Evaluate FBM on a coarse lattice: one sample every
+         * resolutionDivisor cells, plus one guard column/row so bilinear
+         * lookups never read past the edge. Climate noise is low-frequency,
+         * so interpolating the lattice is visually identical to per-cell
+         * FBM at a fraction of the cost.
+         */
+        ScratchVector<float> SampleNoiseLattice(float frequency,
+                                              int octaves,
+                                              float cellSize,
+                                              float worldOffsetX,
+                                              float worldOffsetZ,
+                                              int &latticeWidth) const;
+
+        /**
+         * Bilinearly sample a coarse noise lattice at a full-resolution cell.
+         */
+        float SampleLattice(const ScratchVector<float> &lattice,
+                            int latticeWidth,
+                            int x,
+                            int z) const;
+
+        const SimplexNoise *m_Noise = nullptr;
         ClimateSettings m_Settings;
         ClimateData m_Data;
     };
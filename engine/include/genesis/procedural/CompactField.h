@@ -0,0 +1,142 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace Genesis
+{
+
+    /**
+     * Compact per-cell field storage for hydrology and climate grids.
+     *
+     * These fields are smooth and mostly bounded, so keeping them resident
+     * as full floats for every loaded chunk wastes memory: bounded fields
+     * quantize to one byte over a fixed range and unbounded-but-smooth
+     * fields store IEEE 754 half floats, cutting per-chunk field memory to
+     * a quarter. Conversion happens in the accessors - callers keep reading
+     * plain floats through operator[] and write through Set().
+     */
+
+    /**
+     * Field bounded to a fixed [min, max] range, quantized to uint8
+     * (256 steps over the range).
+     */
+    class QuantizedField
+    {
+    public:
+        QuantizedField() = default;
+        QuantizedField(float minValue, float maxValue)
+            : m_Min(minValue), m_Max(maxValue)
+        {
+        }
+
+        void Resize(size_t size, float fillValue)
+        {
+            m_Data.resize(size, Encode(fillValue));
+        }
+
+        void Fill(float value)
+        {
+            std::fill(m_Data.begin(), m_Data.end(), Encode(value));
+        }
+
+        float operator[](size_t i) const { return Decode(m_Data[i]); }
+        void Set(size_t i, float value) { m_Data[i] = Encode(value); }
+
+        // Stored byte, for indexing precomputed 256-entry lookup tables
+        // over the quantized domain
+        uint8_t Raw(size_t i) const { return m_Data[i]; }
+
+        size_t size() const { return m_Data.size(); }
+
+    private:
+        uint8_t Encode(float value) const
+        {
+            float t = (value - m_Min) / (m_Max - m_Min);
+            t = std::clamp(t, 0.0f, 1.0f);
+            return static_cast<uint8_t>(t * 255.0f + 0.5f);
+        }
+
+        float Decode(uint8_t raw) const
+        {
+            return m_Min + (m_Max - m_Min) * (static_cast<float>(raw) * (1.0f / 255.0f));
+        }
+
+        std::vector<uint8_t> m_Data;
+        float m_Min = 0.0f;
+        float m_Max = 1.0f;
+    };
+
+    /**
+     * Unbounded smooth field stored as IEEE 754 half floats.
+     * Values beyond half range saturate to +-65504; subnormals flush to zero.
+     */
+    class HalfField
+    {
+    public:
+        void Resize(size_t size, float fillValue)
+        {
+            m_Data.resize(size, Encode(fillValue));
+        }
+
+        void Fill(float value)
+        {
+            std::fill(m_Data.begin(), m_Data.end(), Encode(value));
+        }
+
+        float operator[](size_t i) const { return Decode(m_Data[i]); }
+        void Set(size_t i, float value) { m_Data[i] = Encode(value); }
+
+        size_t size() const { return m_Data.size(); }
+
+    private:
+        static uint16_t Encode(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            uint32_t sign = (bits >> 16) & 0x8000u;
+            int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFFu) - 127 + 15;
+            uint32_t mantissa = bits & 0x007FFFFFu;
+
+            if (exponent >= 31)
+            {
+                return static_cast<uint16_t>(sign | 0x7BFFu); // Saturate to half max
+            }
+            if (exponent <= 0)
+            {
+                return static_cast<uint16_t>(sign); // Flush subnormals to zero
+            }
+
+            return static_cast<uint16_t>(sign |
+                                         (static_cast<uint32_t>(exponent) << 10) |
+                                         (mantissa >> 13));
+        }
+
+        static float Decode(uint16_t raw)
+        {
+            uint32_t sign = (static_cast<uint32_t>(raw) & 0x8000u) << 16;
+            uint32_t exponent = (raw >> 10) & 0x1Fu;
+            uint32_t mantissa = raw & 0x3FFu;
+
+            uint32_t bits;
+            if (exponent == 0)
+            {
+                bits = sign; // Zero (subnormals flushed on encode)
+            }
+            else
+            {
+                bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+            }
+
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        std::vector<uint16_t> m_Data;
+    };
+
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "genesis/procedural/OceanMask.h"
 #include <glm/glm.hpp>
+#include <array>
 #include <vector>
 #include <cstdint>
 
@@ -91,6 +93,36 @@ namespace Genesis
         bool InBounds(int x, int z) const { return x >= 0 && x < width && z >= 0 && z < depth; }
     };
 
+    /**
+     * Per-edge flow accumulation leaving a chunk, for cross-chunk drainage
+     * stitching. Mirrors the ChunkOceanBoundary mechanism: ChunkManager
+     * exchanges these between neighbors and feeds them back in through
+     * AddBoundaryInflow so rivers keep their accumulation across borders.
+     */
+    struct ChunkDrainageBoundary
+    {
+        std::vector<uint32_t> negX; // Outflow along -X edge (indexed by z)
+        std::vector<uint32_t> posX; // Outflow along +X edge (indexed by z)
+        std::vector<uint32_t> negZ; // Outflow along -Z edge (indexed by x)
+        std::vector<uint32_t> posZ; // Outflow along +Z edge (indexed by x)
+
+        void Resize(int size)
+        {
+            negX.assign(size, 0);
+            posX.assign(size, 0);
+            negZ.assign(size, 0);
+            posZ.assign(size, 0);
+        }
+
+        void Clear()
+        {
+            std::fill(negX.begin(), negX.end(), 0);
+            std::fill(posX.begin(), posX.end(), 0);
+            std::fill(negZ.begin(), negZ.end(), 0);
+            std::fill(posZ.begin(), posZ.end(), 0);
+        }
+    };
+
     /**
      * Computes drainage topology from heightmap data.
      */
@@ -172,6 +204,25 @@ namespace Genesis
          */
         std::vector<glm::ivec2> FindPits() const;
 
+        /**
+         * Get the accumulation flowing out across each chunk edge.
+         * Valid after Compute(); excludes flow received back on the same
+         * edge, so neighbor exchange can iterate without echoing.
+         */
+        const ChunkDrainageBoundary &GetBoundaryOutflow() const { return m_BoundaryOutflow; }
+
+        /**
+         * Inject a neighbor chunk's boundary outflow along one of our edges.
+         * Only the delta against what this edge already received is applied,
+         * and it propagates downstream from the edge cells only - affected
+         * flow paths are re-accumulated, not the whole chunk.
+         *
+         * @param edge    Which of our edges the flow arrives on
+         * @param inflow  Neighbor's outflow along the shared edge
+         * @return true if any cell's accumulation changed
+         */
+        bool AddBoundaryInflow(ChunkEdge edge, const std::vector<uint32_t> &inflow);
+
     private:
         // Compute flow direction for a single cell using steepest descent
         FlowDirection ComputeCellFlowDirection(const std::vector<float> &heightmap,
@@ -183,7 +234,23 @@ namespace Genesis
                                int x, int z,
                                float cellSize) const;
 
+        // Steepest in-bounds descent for edge cells (their stored direction
+        // is the Boundary tag), so cross-chunk inflow knows where to enter
+        void ComputeEdgeInflowDirections(const std::vector<float> &heightmap,
+                                         float seaLevel);
+
+        // Refresh m_BoundaryOutflow from current edge-cell accumulation
+        void ComputeBoundaryOutflow();
+
+        // Map an edge index to the edge cell coordinates
+        void EdgeCell(ChunkEdge edge, int i, int &outX, int &outZ) const;
+
         DrainageData m_Data;
+
+        // Cross-chunk stitching state
+        ChunkDrainageBoundary m_BoundaryOutflow;
+        ChunkDrainageBoundary m_ReceivedInflow;                // Per-edge inflow already applied
+        std::array<std::vector<int8_t>, 4> m_EdgeInflowDir{}; // Indexed by ChunkEdge
     };
 
 }
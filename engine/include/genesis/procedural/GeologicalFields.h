@@ -3,6 +3,10 @@
 #include "genesis/procedural/Noise.h"
 #include "genesis/procedural/TerrainIntent.h"
 #include <glm/glm.hpp>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace Genesis
 {
@@ -167,8 +171,100 @@ namespace Genesis
 
         TerrainIntent m_Intent;
         GeologicalFieldSettings m_FieldSettings;
-        SimplexNoise m_Noise;
+        std::shared_ptr<const SimplexNoise> m_Noise;
         uint32_t m_Seed = 12345;
     };
 
+    /**
+     * Shared world-space cache of geological field samples.
+     *
+     * The geological fields vary over kilometres (frequencies around
+     * 0.0003-0.0008 per world unit), so evaluating the generator per terrain
+     * cell repeats nearly identical FBM work everywhere. The cache instead
+     * evaluates the generator once per coarse lattice point and answers
+     * queries with a bilinear blend of the four surrounding lattice samples.
+     * Lattice samples are grouped into tiles built lazily and kept for the
+     * lifetime of the world, so the expensive field evaluation runs once per
+     * world region no matter how many chunks sample it.
+     *
+     * Sampling is safe from the chunk worker threads.
+     */
+    class GeologicalFieldCache
+    {
+    public:
+        GeologicalFieldCache() = default;
+
+        /**
+         * Configure the backing generator from a TerrainIntent.
+         * Drops all cached tiles.
+         */
+        void Configure(const TerrainIntent &intent, uint32_t seed);
+
+        /**
+         * Set the spacing between lattice samples in world units.
+         * Drops all cached tiles.
+         */
+        void SetSampleSpacing(float spacing);
+        float GetSampleSpacing() const { return m_SampleSpacing; }
+
+        /**
+         * Sample all geological fields at a world position.
+         * Bilinearly interpolated from the cached coarse lattice.
+         */
+        GeologicalFields SampleFields(float worldX, float worldZ);
+
+        /**
+         * Drop all cached tiles.
+         */
+        void Clear();
+
+        /**
+         * Number of resident tiles (for diagnostics).
+         */
+        size_t GetTileCount() const;
+
+        /**
+         * Access the backing generator for non-cached queries
+         * (ComputeBaseHeight, ocean depth, settings).
+         */
+        const GeologicalFieldGenerator &GetGenerator() const { return m_Generator; }
+
+    private:
+        // Lattice samples per tile side; one tile covers
+        // TILE_SIZE * sampleSpacing world units
+        static constexpr int TILE_SIZE = 32;
+
+        struct TileCoordHash
+        {
+            size_t operator()(const glm::ivec2 &coord) const
+            {
+                return std::hash<int>()(coord.x) ^ (std::hash<int>()(coord.y) << 16);
+            }
+        };
+
+        struct Tile
+        {
+            std::vector<GeologicalFields> samples; // TILE_SIZE * TILE_SIZE
+        };
+
+        /**
+         * Fetch the field sample at a lattice point, building its tile on
+         * first touch. Caller must hold m_Mutex.
+         */
+        const GeologicalFields &LatticeSample(int latticeX, int latticeZ);
+
+        // Floor division for negative-safe lattice-to-tile mapping
+        static int FloorDiv(int value, int divisor);
+
+        static GeologicalFields LerpFields(const GeologicalFields &a,
+                                           const GeologicalFields &b,
+                                           float t);
+
+        GeologicalFieldGenerator m_Generator;
+        float m_SampleSpacing = 64.0f;
+
+        std::unordered_map<glm::ivec2, Tile, TileCoordHash> m_Tiles;
+        mutable std::mutex m_Mutex;
+    };
+
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "genesis/procedural/CompactField.h"
 #include "genesis/procedural/DrainageGraph.h"
 #include "genesis/procedural/RiverGenerator.h"
 #include "genesis/procedural/LakeGenerator.h"
@@ -10,12 +11,76 @@
 namespace Genesis
 {
 
+    /**
+     * Axis-aligned cell rectangle (inclusive bounds) recording where a
+     * per-cell field changed. Hydrology reports one of these per compute
+     * pass so downstream stages (wetlands, biome re-weighting) can
+     * reprocess only the affected region instead of the whole grid.
+     */
+    struct DirtyRegion
+    {
+        int minX = 0;
+        int minZ = 0;
+        int maxX = -1; // Empty while max < min
+        int maxZ = -1;
+
+        bool Empty() const { return maxX < minX || maxZ < minZ; }
+
+        void Reset()
+        {
+            minX = 0;
+            minZ = 0;
+            maxX = -1;
+            maxZ = -1;
+        }
+
+        void MarkAll(int width, int depth)
+        {
+            minX = 0;
+            minZ = 0;
+            maxX = width - 1;
+            maxZ = depth - 1;
+        }
+
+        void Expand(int x, int z)
+        {
+            if (Empty())
+            {
+                minX = maxX = x;
+                minZ = maxZ = z;
+            }
+            else
+            {
+                minX = std::min(minX, x);
+                maxX = std::max(maxX, x);
+                minZ = std::min(minZ, z);
+                maxZ = std::max(maxZ, z);
+            }
+        }
+
+        void Merge(const DirtyRegion &other)
+        {
+            if (other.Empty())
+                return;
+            Expand(other.minX, other.minZ);
+            Expand(other.maxX, other.maxZ);
+        }
+
+        bool Contains(int x, int z) const
+        {
+            return x >= minX && x <= maxX && z >= minZ && z <= maxZ;
+        }
+    };
+
     /**
      * Section 24: Hydrology Output Fields
      *
      * Unified hydrology data structure containing all water-related fields
      * computed from drainage, rivers, and lakes. These fields are cached
      * per chunk for runtime queries by biomes, vegetation, and rendering.
+     *
+     * Smooth derived fields stay resident in compact storage (half floats,
+     * or one byte for [0,1]-bounded values); accessors convert to float.
      */
     struct HydrologyData
     {
@@ -23,22 +88,24 @@ namespace Genesis
         std::vector<WaterType> waterType;
 
         // Field: WaterSurfaceHeight - For rendering water planes
+        // Kept at full precision: feeds water plane placement directly
         std::vector<float> waterSurfaceHeight;
 
         // Field: FlowAccumulation - Used by biomes for moisture
         std::vector<uint32_t> flowAccumulation;
 
         // Field: DistanceToWater - Used by moisture calculation
-        std::vector<float> distanceToWater;
+        // "No water in range" saturates to half max rather than FLT_MAX
+        HalfField distanceToWater;
 
         // Field: DrainageDirection - Debug / tools
         std::vector<FlowDirection> drainageDirection;
 
         // Field: Slope - Used for wetland detection
-        std::vector<float> slope;
+        HalfField slope;
 
-        // Field: Moisture - Derived from flow, distance, humidity
-        std::vector<float> moisture;
+        // Field: Moisture - Derived from flow, distance, humidity [0, 1]
+        QuantizedField moisture;
 
         int width = 0;
         int depth = 0;
@@ -51,10 +118,10 @@ namespace Genesis
             waterType.resize(size, WaterType::None);
             waterSurfaceHeight.resize(size, 0.0f);
             flowAccumulation.resize(size, 0);
-            distanceToWater.resize(size, std::numeric_limits<float>::max());
+            distanceToWater.Resize(size, std::numeric_limits<float>::max());
             drainageDirection.resize(size, FlowDirection::Pit);
-            slope.resize(size, 0.0f);
-            moisture.resize(size, 0.0f);
+            slope.Resize(size, 0.0f);
+            moisture.Resize(size, 0.0f);
         }
 
         void Clear()
@@ -62,10 +129,10 @@ namespace Genesis
             std::fill(waterType.begin(), waterType.end(), WaterType::None);
             std::fill(waterSurfaceHeight.begin(), waterSurfaceHeight.end(), 0.0f);
             std::fill(flowAccumulation.begin(), flowAccumulation.end(), 0);
-            std::fill(distanceToWater.begin(), distanceToWater.end(), std::numeric_limits<float>::max());
+            distanceToWater.Fill(std::numeric_limits<float>::max());
             std::fill(drainageDirection.begin(), drainageDirection.end(), FlowDirection::Pit);
-            std::fill(slope.begin(), slope.end(), 0.0f);
-            std::fill(moisture.begin(), moisture.end(), 0.0f);
+            slope.Fill(0.0f);
+            moisture.Fill(0.0f);
         }
 
         size_t Index(int x, int z) const { return static_cast<size_t>(z) * width + x; }
@@ -140,6 +207,14 @@ namespace Genesis
          */
         const HydrologyData &GetData() const { return m_Data; }
 
+        /**
+         * Get the cell region whose fields changed in the last Compute().
+         * A resize or first compute marks the whole grid; a recompute with
+         * mostly identical inputs (e.g. a small sea-level nudge) yields a
+         * tight rectangle for incremental downstream passes.
+         */
+        const DirtyRegion &GetDirtyRegion() const { return m_DirtyRegion; }
+
         /**
          * Query water type at a cell.
          */
@@ -204,6 +279,7 @@ namespace Genesis
 
         HydrologySettings m_Settings;
         HydrologyData m_Data;
+        DirtyRegion m_DirtyRegion;
     };
 
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "genesis/procedural/DrainageGraph.h"
+#include "genesis/core/ScratchArena.h"
 #include <glm/glm.hpp>
 #include <vector>
 #include <cstdint>
@@ -168,36 +169,30 @@ namespace Genesis
 
     private:
         /**
-         * Section 22.1: Basin Detection
-         * Trace flow graph - if no ocean reachability → basin
-         */
-        void DetectBasins(const DrainageGraph &drainage,
-                          const std::vector<float> &heightmap,
-                          float seaLevel);
-
-        /**
-         * Flood-fill from a pit cell to find connected basin cells.
-         */
-        LakeBasin FloodFillBasin(const DrainageGraph &drainage,
-                                 const std::vector<float> &heightmap,
-                                 int startX, int startZ,
-                                 float fillHeight,
-                                 std::vector<bool> &visited) const;
-
-        /**
-         * Section 22.2: Lake Fill
-         * Find lowest surrounding saddle and fill basin to that height.
+         * Section 22.1/22.2: Basin detection and fill in one sweep.
+         *
+         * Barnes priority-flood: a binary min-heap frontier seeded from the
+         * grid boundary and ocean cells sweeps inward in height order. Every
+         * cell's fill level (terrain height, or the saddle height water ponds
+         * up to inside a depression) is computed in a single O(n log n) pass.
+         *
+         * @param outFill    Fill level per cell (>= terrain height)
+         * @param outParent  Cell each cell was flooded from (-1 for seeds);
+         *                   walking parents out of a depression reaches its saddle
          */
-        void FillLakes(const std::vector<float> &heightmap);
+        void PriorityFlood(const std::vector<float> &heightmap,
+                           float seaLevel,
+                           ScratchVector<float> &outFill,
+                           ScratchVector<int32_t> &outParent) const;
 
         /**
-         * Find the lowest spill point around a basin.
+         * Collect connected depressed regions (fill > terrain) into basins,
+         * drop those under the size/depth thresholds, and register the rest
+         * as indexed regions in the lake network.
          */
-        bool FindSpillPoint(const LakeBasin &basin,
-                            const std::vector<float> &heightmap,
-                            glm::ivec2 &outSpillPoint,
-                            float &outSpillHeight,
-                            int &outDirection) const;
+        void ExtractBasins(const std::vector<float> &heightmap,
+                           const ScratchVector<float> &fill,
+                           const ScratchVector<int32_t> &parent);
 
         /**
          * Section 22.3: Lake Terrain Adjustment
@@ -216,11 +211,6 @@ namespace Genesis
                           const LakeBasin &basin,
                           float cellSize) const;
 
-        /**
-         * Check if a cell can reach the ocean via flow.
-         */
-        bool CanReachOcean(const DrainageGraph &drainage, int x, int z) const;
-
         LakeSettings m_Settings;
         LakeNetwork m_Network;
     };
@@ -102,6 +102,70 @@ namespace Genesis
         }
     };
 
+    /**
+     * Packed per-cell material: the two highest-weighted materials plus an
+     * 8-bit blend factor. After normalization almost every cell has at most
+     * two significant weights, so keeping only the dominant pair shrinks
+     * resident material data from 32 bytes per cell to 3 with no visible
+     * difference after blending.
+     */
+    struct PackedMaterial
+    {
+        MaterialType primary = MaterialType::Dirt;
+        MaterialType secondary = MaterialType::Dirt;
+
+        // Secondary's share of the pair in 1/255 steps (0 = pure primary)
+        uint8_t blend = 0;
+
+        /**
+         * Pack the dominant pair of a full weight vector.
+         */
+        static PackedMaterial Pack(const MaterialWeights &weights)
+        {
+            size_t first = 0;
+            for (size_t i = 1; i < weights.weights.size(); i++)
+            {
+                if (weights.weights[i] > weights.weights[first])
+                {
+                    first = i;
+                }
+            }
+
+            size_t second = first == 0 ? 1 : 0;
+            for (size_t i = 0; i < weights.weights.size(); i++)
+            {
+                if (i != first && weights.weights[i] > weights.weights[second])
+                {
+                    second = i;
+                }
+            }
+
+            PackedMaterial packed;
+            packed.primary = static_cast<MaterialType>(first);
+            packed.secondary = static_cast<MaterialType>(second);
+
+            float pairSum = weights.weights[first] + weights.weights[second];
+            if (pairSum > 0.0f)
+            {
+                packed.blend = static_cast<uint8_t>(
+                    weights.weights[second] / pairSum * 255.0f + 0.5f);
+            }
+            return packed;
+        }
+
+        /**
+         * Expand back to a full weight vector (pair renormalized to 1.0).
+         */
+        MaterialWeights Unpack() const
+        {
+            MaterialWeights weights;
+            float secondaryShare = static_cast<float>(blend) * (1.0f / 255.0f);
+            weights[primary] = 1.0f - secondaryShare;
+            weights[secondary] += secondaryShare;
+            return weights;
+        }
+    };
+
     /**
      * Settings for material blending.
      */
@@ -132,12 +196,11 @@ namespace Genesis
     };
 
     /**
-     * Material data per cell.
+     * Material data per cell, stored packed (dominant pair + blend).
      */
     struct MaterialData
     {
-        std::vector<MaterialWeights> cellMaterials; // Material weights per cell
-        std::vector<MaterialType> dominantMaterial; // Dominant material per cell
+        std::vector<PackedMaterial> cellMaterials; // Packed materials per cell
 
         int width = 0;
         int depth = 0;
@@ -148,16 +211,11 @@ namespace Genesis
             depth = d;
             size_t size = static_cast<size_t>(w) * d;
             cellMaterials.resize(size);
-            dominantMaterial.resize(size, MaterialType::Dirt);
         }
 
         void Clear()
         {
-            for (auto &mw : cellMaterials)
-            {
-                mw = MaterialWeights();
-            }
-            std::fill(dominantMaterial.begin(), dominantMaterial.end(), MaterialType::Dirt);
+            std::fill(cellMaterials.begin(), cellMaterials.end(), PackedMaterial());
         }
 
         size_t Index(int x, int z) const { return static_cast<size_t>(z) * width + x; }
@@ -208,10 +266,15 @@ namespace Genesis
         const MaterialData &GetData() const { return m_Data; }
 
         /**
-         * Get material weights at a cell.
+         * Get material weights at a cell (unpacked from the dominant pair).
          */
         MaterialWeights GetMaterialWeights(int x, int z) const;
 
+        /**
+         * Get the packed material at a cell without expanding.
+         */
+        PackedMaterial GetPackedMaterial(int x, int z) const;
+
         /**
          * Get dominant material at a cell.
          */
@@ -1,11 +1,16 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace Genesis {
 
-    // Simplex noise implementation for procedural generation
+    // Simplex noise implementation for procedural generation.
+    // Holds its permutation table inline (no heap allocation), so per-chunk
+    // noise objects can live on the stack or inside worker-local state.
     class SimplexNoise {
     public:
         SimplexNoise(uint32_t seed = 0);
@@ -23,6 +28,26 @@ namespace Genesis {
         // Ridge noise (inverted absolute value for mountain ridges)
         float RidgeNoise(float x, float y, int octaves, float persistence = 0.5f, float lacunarity = 2.0f) const;
 
+        // Derivative-returning variants: value plus analytic d/dx and d/dy in
+        // one evaluation, instead of three finite-difference samples. The
+        // derivatives are exact for Noise/FBM; RidgeNoise is exact except at
+        // the (measure-zero) ridge creases where |noise| is not smooth.
+        float NoiseDeriv(float x, float y, float& outDx, float& outDy) const;
+        float FBMDeriv(float x, float y, int octaves, float persistence, float lacunarity,
+                       float& outDx, float& outDy) const;
+        float RidgeNoiseDeriv(float x, float y, int octaves, float persistence, float lacunarity,
+                              float& outDx, float& outDy) const;
+
+        // Batch variants: evaluate n points at once. On AVX2 hardware the 2D
+        // noise kernel runs 8 lanes per iteration; elsewhere it falls back to
+        // the scalar path. Results match the single-point functions. Terrain
+        // generation feeds whole heightmap rows through these.
+        void Noise(const float* xs, const float* ys, float* out, size_t n) const;
+        void FBM(const float* xs, const float* ys, float* out, size_t n,
+                 int octaves, float persistence = 0.5f, float lacunarity = 2.0f) const;
+        void RidgeNoise(const float* xs, const float* ys, float* out, size_t n,
+                        int octaves, float persistence = 0.5f, float lacunarity = 2.0f) const;
+
         // Domain warped noise - warps input coordinates for more organic patterns
         float WarpedNoise(float x, float y, float warpStrength = 1.0f, float warpScale = 1.0f) const;
         float WarpedFBM(float x, float y, int octaves, float persistence = 0.5f, float lacunarity = 2.0f,
@@ -34,11 +59,41 @@ namespace Genesis {
 
         void SetSeed(uint32_t seed);
 
+        // Seed-shuffled permutation table (512 entries), e.g. for uploading
+        // to a GPU noise evaluator that must match the CPU results
+        const std::array<uint8_t, 512>& GetPermutation() const { return m_Permutation; }
+
     private:
         float Grad(int hash, float x, float y) const;
         float Grad(int hash, float x, float y, float z) const;
-        
-        std::vector<int> m_Permutation;
+
+#if defined(__AVX2__)
+        void NoiseBatch8(const float* xs, const float* ys, float* out) const;
+#endif
+
+        // Inline fixed table: 512 bytes, stays hot in L1 across the hashing
+        // done by every octave of every sample
+        alignas(64) std::array<uint8_t, 512> m_Permutation;
+#if defined(__AVX2__)
+        // 32-bit mirror of m_Permutation for the gather instructions in the
+        // batch kernel (gathers load 4-byte lanes)
+        alignas(32) std::array<int32_t, 512> m_PermutationWide;
+#endif
+    };
+
+    // Per-seed cache of immutable SimplexNoise instances.
+    //
+    // Everything generating against one world seed needs the same
+    // permutation tables, but terrain, geology and climate each used to
+    // construct (and on seed change rebuild) a private copy - and chunk
+    // stages built fresh ones per chunk. Get returns one shared read-only
+    // instance per seed, so all the workers generating different chunks
+    // hash through the same tables sitting warm in cache. The returned
+    // noise is const; anything needing a differently-seeded table asks for
+    // it by seed instead of mutating.
+    class NoiseState {
+    public:
+        static std::shared_ptr<const SimplexNoise> Get(uint32_t seed);
     };
 
 }
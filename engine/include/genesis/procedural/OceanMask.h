@@ -1,10 +1,12 @@
 #pragma once
 
+#include "genesis/core/ScratchArena.h"
+
 #include <glm/glm.hpp>
 #include <vector>
 #include <functional>
-#include <queue>
-#include <unordered_set>
+#include <algorithm>
+#include <cstdint>
 
 namespace Genesis
 {
@@ -54,6 +56,41 @@ namespace Genesis
         }
     };
 
+    // Dense per-cell flag grid packed 64 cells per word. Row-major like the
+    // grids it mirrors; word-at-a-time operations keep clears and emptiness
+    // checks off the per-cell path.
+    class CellBitMask
+    {
+    public:
+        void Resize(size_t cellCount)
+        {
+            m_Bits.assign((cellCount + 63) / 64, 0);
+        }
+
+        void Clear()
+        {
+            std::fill(m_Bits.begin(), m_Bits.end(), 0);
+        }
+
+        bool Test(size_t i) const { return (m_Bits[i >> 6] >> (i & 63)) & 1ull; }
+        void Set(size_t i) { m_Bits[i >> 6] |= 1ull << (i & 63); }
+
+        bool Any() const
+        {
+            for (uint64_t word : m_Bits)
+            {
+                if (word)
+                    return true;
+            }
+            return false;
+        }
+
+        const std::vector<uint64_t> &Words() const { return m_Bits; }
+
+    private:
+        std::vector<uint64_t> m_Bits;
+    };
+
     class OceanMask
     {
     public:
@@ -119,28 +156,20 @@ namespace Genesis
         bool IsInlandLake(int x, int z) const;
 
         /**
-         * Get the full ocean mask array
+         * Get the full ocean mask (packed 64 cells per word)
          */
-        const std::vector<bool> &GetOceanMask() const { return m_OceanMask; }
+        const CellBitMask &GetOceanMask() const { return m_OceanMask; }
 
         /**
-         * Get the below-sea-level mask array
+         * Get the below-sea-level mask (packed 64 cells per word)
          */
-        const std::vector<bool> &GetBelowSeaMask() const { return m_BelowSeaMask; }
+        const CellBitMask &GetBelowSeaMask() const { return m_BelowSeaMask; }
 
         /**
          * Check if any cell is below sea level
          * Used to determine if water plane should be generated at all
          */
-        bool HasAnyBelowSeaLevel() const
-        {
-            for (bool b : m_BelowSeaMask)
-            {
-                if (b)
-                    return true;
-            }
-            return false;
-        }
+        bool HasAnyBelowSeaLevel() const { return m_BelowSeaMask.Any(); }
 
         /**
          * Check if flood fill has been performed
@@ -162,14 +191,16 @@ namespace Genesis
             return x >= 0 && x < m_Width && z >= 0 && z < m_Depth;
         }
 
-        void FloodFillBFS(const std::vector<std::pair<int, int>> &seeds);
+        // Scanline fill: spans are expanded whole rows at a time, with only
+        // span starts pushed onto a plain vector stack
+        void FloodFillScanline(const ScratchVector<std::pair<int, int>> &seeds);
         void UpdateBoundaryFromMask();
 
         int m_Width = 0;
         int m_Depth = 0;
 
-        std::vector<bool> m_BelowSeaMask; // Cells below sea level
-        std::vector<bool> m_OceanMask;    // Cells that are ocean (connected to boundary)
+        CellBitMask m_BelowSeaMask; // Cells below sea level
+        CellBitMask m_OceanMask;    // Cells that are ocean (connected to boundary)
 
         ChunkOceanBoundary m_Boundary; // Edge connectivity for cross-chunk propagation
         bool m_FloodFillComplete = false;
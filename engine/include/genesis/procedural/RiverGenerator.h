@@ -111,6 +111,46 @@ namespace Genesis
         bool InBounds(int x, int z) const { return x >= 0 && x < width && z >= 0 && z < depth; }
     };
 
+    /**
+     * Grid-bucketed spatial index over river segments.
+     *
+     * Segments are binned by cell position into BUCKET_SIZE^2 buckets laid
+     * out in CSR form (one offset array, one packed index array), so a
+     * nearest-segment query touches only the buckets within range instead
+     * of scanning the whole segment list. Built once per Generate; queries
+     * are cheap enough to poll every frame.
+     */
+    class RiverSegmentIndex
+    {
+    public:
+        // Cells per bucket side; 128-cell chunks bin into a 16x16 grid
+        static constexpr int BUCKET_SIZE = 8;
+
+        void Build(const RiverNetwork &network);
+        void Clear();
+
+        /**
+         * Find the segment whose cell center is nearest to a position.
+         * @param cellX           Query position in (fractional) cell coordinates
+         * @param cellZ           Query position in (fractional) cell coordinates
+         * @param maxRadiusCells  Give up beyond this distance
+         * @return Segment index into RiverNetwork::segments, or -1 if none in range
+         */
+        int FindNearest(float cellX, float cellZ, float maxRadiusCells) const;
+
+        bool Empty() const { return m_SegmentCells.empty(); }
+
+    private:
+        // Buckets scanned in rings: ring r only holds segments at least
+        // (r-1)*BUCKET_SIZE cells away, so the search stops as soon as the
+        // best hit beats the next ring's lower bound
+        int m_BucketsX = 0;
+        int m_BucketsZ = 0;
+        std::vector<uint32_t> m_BucketStart;    // CSR offsets, m_BucketsX*m_BucketsZ+1 entries
+        std::vector<uint32_t> m_SegmentIndices; // Segment indices packed by bucket
+        std::vector<glm::ivec2> m_SegmentCells; // Cell per segment, for distance tests
+    };
+
     /**
      * Generates rivers and streams from drainage data.
      */
@@ -178,6 +218,14 @@ namespace Genesis
          */
         bool IsWater(int x, int z) const;
 
+        /**
+         * Nearest river segment to a (fractional) cell position, or nullptr
+         * if none within maxRadiusCells. O(1) via the bucketed index.
+         */
+        const RiverSegment *FindNearestSegment(float cellX, float cellZ, float maxRadiusCells) const;
+
+        const RiverSegmentIndex &GetSegmentIndex() const { return m_SegmentIndex; }
+
     private:
         // Classify cells based on flow accumulation
         void ClassifyCells(const DrainageGraph &drainage,
@@ -200,6 +248,7 @@ namespace Genesis
 
         RiverSettings m_Settings;
         RiverNetwork m_Network;
+        RiverSegmentIndex m_SegmentIndex;
         float m_CellSize = 1.0f;
     };
 
@@ -4,6 +4,7 @@
 #include "genesis/renderer/Mesh.h"
 #include <glm/glm.hpp>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace Genesis
@@ -106,24 +107,29 @@ namespace Genesis
 
     private:
         /**
-         * Generate ribbon vertices for a river segment.
+         * Append an indexed ribbon for one river path.
          *
-         * @param segment     River segment
-         * @param nextSegment Next segment (for smooth connection), or nullptr
-         * @param heightmap   Terrain heights
-         * @param cellSize    World units per cell
-         * @param chunkOffset Chunk world offset
-         * @param vertices    Output vertices
-         * @param indices     Output indices
+         * One left/right vertex pair is emitted per channel point and shared
+         * by the quads on both sides, instead of four vertices per segment.
+         * Pairs already emitted for a segment (keyed in segmentPairBase) are
+         * welded: a tributary's final point reuses the main channel's pair,
+         * and stretches whose pairs all exist are not re-triangulated.
+         *
+         * @param segmentIndices  Path segments, source to terminus
+         * @param network         River network data
+         * @param cellSize        World units per cell
+         * @param chunkOffset     Chunk world offset
+         * @param segmentPairBase Segment index -> base vertex of its pair
+         * @param vertices        Output vertices
+         * @param indices         Output indices
          */
-        void GenerateRibbonSegment(const RiverSegment &segment,
-                                   const RiverSegment *nextSegment,
-                                   const std::vector<float> &heightmap,
-                                   int gridWidth,
-                                   float cellSize,
-                                   const glm::vec3 &chunkOffset,
-                                   std::vector<Vertex> &vertices,
-                                   std::vector<uint32_t> &indices) const;
+        void AppendChannelRibbon(const std::vector<size_t> &segmentIndices,
+                                 const RiverNetwork &network,
+                                 float cellSize,
+                                 const glm::vec3 &chunkOffset,
+                                 std::unordered_map<int, uint32_t> &segmentPairBase,
+                                 std::vector<Vertex> &vertices,
+                                 std::vector<uint32_t> &indices) const;
 
         /**
          * Compute perpendicular direction for ribbon width.
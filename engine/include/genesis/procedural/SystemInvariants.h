@@ -1,7 +1,8 @@
 #pragma once
 
 #include "genesis/core/Log.h"
-#include <string>
+#include <cmath>
+#include <cstdint>
 
 namespace Genesis
 {
@@ -94,7 +95,7 @@ namespace Genesis
      * @param previous  The last completed stage
      * @return true if order is valid, false if invariant violated
      */
-    inline bool ValidatePipelineOrder(PipelineStage current, PipelineStage previous)
+    constexpr bool ValidatePipelineOrder(PipelineStage current, PipelineStage previous)
     {
         // Stage numbers must be monotonically increasing
         return static_cast<uint8_t>(current) > static_cast<uint8_t>(previous);
@@ -107,12 +108,14 @@ namespace Genesis
      * @param completed Bitmask of completed stages
      * @return true if all prerequisites are met
      */
-    inline bool CanExecuteStage(PipelineStage stage, uint16_t completedMask)
+    constexpr uint16_t PipelineStageBit(PipelineStage stage)
     {
-        auto bit = [](PipelineStage s)
-        {
-            return static_cast<uint16_t>(1 << static_cast<uint8_t>(s));
-        };
+        return static_cast<uint16_t>(1 << static_cast<uint8_t>(stage));
+    }
+
+    constexpr bool CanExecuteStage(PipelineStage stage, uint16_t completedMask)
+    {
+        auto bit = PipelineStageBit;
 
         switch (stage)
         {
@@ -151,6 +154,37 @@ namespace Genesis
         }
     }
 
+    // ------------------------------------------------------------------------
+    // Structural invariants, proven at compile time. These encode the stage
+    // dependency graph itself, so they cost nothing at runtime and a change
+    // that breaks the pipeline ordering fails the build.
+    // ------------------------------------------------------------------------
+
+    // The completed-stage mask is a uint16_t
+    static_assert(static_cast<uint8_t>(PipelineStage::Count) <= 16,
+                  "PipelineStage no longer fits the completion bitmask");
+
+    // Invariant 1: geometry precedes water
+    static_assert(!CanExecuteStage(PipelineStage::DrainageComputation, 0) &&
+                      CanExecuteStage(PipelineStage::DrainageComputation,
+                                      PipelineStageBit(PipelineStage::HeightmapGeneration)),
+                  "Drainage must require a generated heightmap");
+    static_assert(!CanExecuteStage(PipelineStage::RiverGeneration,
+                                   PipelineStageBit(PipelineStage::HeightmapGeneration)),
+                  "Rivers must require drainage, not just a heightmap");
+
+    // Invariant 2: climate precedes biomes
+    static_assert(!CanExecuteStage(PipelineStage::BiomeClassification,
+                                   PipelineStageBit(PipelineStage::HeightmapGeneration)),
+                  "Biome classification must require climate data");
+
+    // Stage ordering is monotonic by construction
+    static_assert(ValidatePipelineOrder(PipelineStage::MeshGeneration,
+                                        PipelineStage::MaterialBlending) &&
+                      !ValidatePipelineOrder(PipelineStage::HeightmapGeneration,
+                                             PipelineStage::MeshGeneration),
+                  "Pipeline order comparison broken");
+
     /**
      * Tracks pipeline execution state and validates invariants.
      */
@@ -237,8 +271,20 @@ namespace Genesis
 
     // ========================================================================
     // Invariant Assertion Macros
+    //
+    // Runtime checks compile to nothing unless GENESIS_VALIDATE_INVARIANTS is
+    // defined, so the shipping hot path pays zero and validation is one build
+    // flag away. The _SAMPLED variants check every Nth cell (N overridable
+    // via GENESIS_INVARIANT_SAMPLE_N) for cheap production telemetry inside
+    // per-cell generation loops.
     // ========================================================================
 
+#ifndef GENESIS_INVARIANT_SAMPLE_N
+#define GENESIS_INVARIANT_SAMPLE_N 64
+#endif
+
+#ifdef GENESIS_VALIDATE_INVARIANTS
+
     /**
      * Assert that geometry (heightmap) has been generated before water systems.
      */
@@ -279,6 +325,28 @@ namespace Genesis
         }                                                                                   \
     } while (0)
 
+    /**
+     * Sampled form of GEN_INVARIANT_MATERIALS_BLENDED for per-cell loops:
+     * validates one cell in every GENESIS_INVARIANT_SAMPLE_N.
+     */
+#define GEN_INVARIANT_MATERIALS_BLENDED_SAMPLED(weights, cellIndex)    \
+    do                                                                 \
+    {                                                                  \
+        if ((cellIndex) % GENESIS_INVARIANT_SAMPLE_N == 0)             \
+        {                                                              \
+            GEN_INVARIANT_MATERIALS_BLENDED(weights);                  \
+        }                                                              \
+    } while (0)
+
+#else
+
+#define GEN_INVARIANT_GEOMETRY_FIRST(validator) ((void)0)
+#define GEN_INVARIANT_WATER_BEFORE_BIOMES(validator) ((void)0)
+#define GEN_INVARIANT_MATERIALS_BLENDED(weights) ((void)0)
+#define GEN_INVARIANT_MATERIALS_BLENDED_SAMPLED(weights, cellIndex) ((void)0)
+
+#endif // GENESIS_VALIDATE_INVARIANTS
+
     // ========================================================================
     // Section 31: Determinism & Chunking Guidelines
     // ========================================================================
@@ -314,11 +382,13 @@ namespace Genesis
      * @param chunkZ    Chunk Z coordinate
      * @return Deterministic seed for this chunk
      */
-    inline uint32_t ComputeChunkSeed(uint32_t worldSeed, int chunkX, int chunkZ)
+    constexpr uint32_t ComputeChunkSeed(uint32_t worldSeed, int chunkX, int chunkZ)
     {
+        // Multiply in unsigned space: signed overflow would be undefined,
+        // which also bars constexpr evaluation
         return worldSeed ^
-               (static_cast<uint32_t>(chunkX * 198491317) ^
-                static_cast<uint32_t>(chunkZ * 6542989));
+               (static_cast<uint32_t>(chunkX) * 198491317u ^
+                static_cast<uint32_t>(chunkZ) * 6542989u);
     }
 
     /**
@@ -5,11 +5,16 @@
 #include "genesis/procedural/MaterialBlender.h"
 #include "genesis/procedural/BiomeClassifier.h"
 #include "genesis/renderer/Mesh.h"
+#include <algorithm>
+#include <array>
 #include <memory>
 
 namespace Genesis
 {
 
+    class HeightfieldCompute;
+    class ErosionCompute;
+
     struct TerrainSettings
     {
         // Grid dimensions
@@ -64,6 +69,7 @@ namespace Genesis
         float slopeErosionStrength = 0.15f; // How much steep slopes erode (0-1)
         float slopeThreshold = 0.5f;        // Slope angle threshold for erosion
         float valleyDepth = 0.3f;           // How deep valleys carve (0-1)
+        int erosionDownsample = 1;          // 1 = full res; 2/4 erodes a coarser grid and reinjects detail
 
         // Hydraulic erosion (higher quality, slower)
         bool useHydraulicErosion = false; // Enable particle-based erosion
@@ -72,14 +78,26 @@ namespace Genesis
         float erosionCapacity = 4.0f;     // Sediment carrying capacity
         float erosionDeposition = 0.3f;   // Rate of sediment deposition
         float erosionEvaporation = 0.02f; // Water evaporation rate
+        int gpuErosionDroplets = 50000;   // Droplet count for the GPU erosion backend
 
         // Low-poly style
-        bool flatShading = true; // Use face normals instead of smooth normals
+        bool flatShading = true; // Face normals on provoking vertices instead of smooth normals
 
         // Biome-based coloring
         bool useBiomeColors = true; // Use biome classification for terrain colors
     };
 
+    // Raw (pre-erosion) heightmap border samples of a chunk. Raw sampling is
+    // seamless across chunks, so one chunk's edge can be handed to its
+    // neighbor instead of re-evaluating the layered noise stack per sample.
+    struct HeightmapBorders
+    {
+        std::vector<float> negX; // x = 0 column, indexed by z
+        std::vector<float> posX; // x = width column, indexed by z
+        std::vector<float> negZ; // z = 0 row, indexed by x
+        std::vector<float> posZ; // z = depth row, indexed by x
+    };
+
     class TerrainGenerator
     {
     public:
@@ -101,11 +119,37 @@ namespace Genesis
         // Generate terrain mesh at world offset with biome-based coloring
         std::shared_ptr<Mesh> GenerateAtOffset(float offsetX, float offsetZ, const MaterialBlender *materialBlender, const BiomeClassifier *biomeClassifier);
 
+        // Generate a reduced-resolution mesh from the cached heightmap, sampling
+        // every lodStep cells. Meshes with lodStep > 1 get perimeter skirts so
+        // neighbors rendered at different LODs don't show cracks.
+        std::shared_ptr<Mesh> GenerateLodAtOffset(float offsetX, float offsetZ, int lodStep, const MaterialBlender *materialBlender, const BiomeClassifier *biomeClassifier);
+
         // Generate heightmap array at local origin
         std::vector<float> GenerateHeightmap();
 
-        // Generate heightmap array at world offset (for chunked terrain)
-        std::vector<float> GenerateHeightmapAtOffset(float offsetX, float offsetZ);
+        // Generate heightmap array at world offset (for chunked terrain).
+        // If borders are provided, matching edges reuse the neighbor's raw
+        // samples instead of evaluating the noise stack again.
+        std::vector<float> GenerateHeightmapAtOffset(float offsetX, float offsetZ, const HeightmapBorders *borders = nullptr);
+
+        // True when the continental field is deep ocean across the whole
+        // chunk footprint, probed on a sparse grid - the field varies over
+        // kilometres while a chunk spans a few hundred metres, so a coarse
+        // probe cannot miss land the full stack would have produced. Chunks
+        // inside the coastline blend band report false and take the full
+        // pipeline.
+        bool IsFullyOceanAt(float offsetX, float offsetZ) const;
+
+        // Fast heightmap path for chunks IsFullyOceanAt approved: the
+        // deep-ocean seabed reduced to its surviving terms (2-octave base
+        // FBM and floor variation; ridge and uplift are zeroed by a full
+        // ocean mask), sampled on a coarse lattice and bilinearly refined.
+        // No warp, no erosion, no peak shaping - all invisible under tens
+        // of metres of water. Border handover works as in the full path.
+        std::vector<float> GenerateOceanHeightmapAtOffset(float offsetX, float offsetZ, const HeightmapBorders *borders = nullptr);
+
+        // Raw border samples of the last generated heightmap, for the border cache
+        const HeightmapBorders &GetRawBorders() const { return m_RawBorders; }
 
         // Get height at world position (for placing objects)
         float GetHeightAt(float worldX, float worldZ) const;
@@ -113,30 +157,162 @@ namespace Genesis
         // Get the cached heightmap (must call GenerateHeightmap first)
         const std::vector<float> &GetCachedHeightmap() const { return m_CachedHeightmap; }
 
+        // Restore a previously generated heightmap (e.g. from the chunk disk cache)
+        void SetCachedHeightmap(std::vector<float> heightmap, float offsetX, float offsetZ)
+        {
+            m_CachedHeightmap = std::move(heightmap);
+            m_ChunkOrigin = glm::vec2(offsetX, offsetZ);
+        }
+
         // Get color from material weights (material-based coloring)
         static glm::vec3 GetMaterialColor(const MaterialWeights &weights);
+        static glm::vec3 GetMaterialColor(const PackedMaterial &packed);
 
         // Sample raw height at world position (no erosion/shaping)
         // Useful for querying terrain height before full generation
         float SampleRawHeight(float worldX, float worldZ) const;
 
+        // Raw height plus analytic slope in one evaluation. outGradient is
+        // d(height)/d(worldX, worldZ) in world units, computed through the
+        // derivative-returning noise variants instead of finite differences.
+        // The domain-warp offsets are treated as locally constant (their
+        // Jacobian is dropped), which is accurate at the configured warp
+        // frequencies.
+        float SampleHeightWithGradient(float worldX, float worldZ, glm::vec2 &outGradient) const;
+
+        // Batch version of SampleRawHeight: evaluates n world positions at
+        // once, feeding each noise layer through the SIMD batch API of
+        // SimplexNoise. Heightmap generation calls this per row.
+        void SampleRawHeightRow(const float *worldXs, const float *worldZs, float *out, size_t n) const;
+
+        // Optional GPU backend for raw heightfield evaluation. When set (and
+        // available), GenerateHeightmapAtOffset fills the extended grid with a
+        // single compute dispatch instead of per-sample CPU noise. The backend
+        // submits on the graphics queue, so only enable it when generation
+        // runs on the thread that owns rendering. Pass nullptr to disable.
+        static void SetComputeBackend(HeightfieldCompute *compute) { s_ComputeBackend = compute; }
+
+        // Optional GPU backend for hydraulic erosion. When set (and
+        // available), GenerateHeightmapAtOffset erodes the extended
+        // heightfield with settings.gpuErosionDroplets droplets in one
+        // compute dispatch instead of the serial CPU particle loop. Same
+        // queue constraints as the heightfield backend.
+        static void SetErosionBackend(ErosionCompute *erosion) { s_ErosionBackend = erosion; }
+
     private:
-        // Apply erosion to heightmap in-place
-        void ApplySlopeErosion(std::vector<float> &heightmap, int width, int depth) const;
+        // Coarse warp-offset cache. The domain-warp field varies far more
+        // slowly than the sampling grid (warpScale is a fraction of
+        // noiseScale), so heightmap generation evaluates the warp FBM stack
+        // only every WARP_CACHE_STRIDE cells on a world-anchored lattice and
+        // bilinearly interpolates between the cache points. The lattice is
+        // anchored to absolute world coordinates so neighboring chunks
+        // interpolate from the same points and raw borders stay bit-identical.
+        struct WarpOffsetCache
+        {
+            bool valid = false;
+            int width = 0;                // Lattice points along X
+            int depth = 0;                // Lattice points along Z
+            float originX = 0.0f;         // World position of lattice point (0, 0)
+            float originZ = 0.0f;
+            float spacing = 1.0f;         // World distance between lattice points
+            std::vector<float> offsetX;   // Accumulated warp offsets, noise space
+            std::vector<float> offsetZ;
+        };
+
+        static constexpr int WARP_CACHE_STRIDE = 8;
+
+        // Precompiled power curve. ridgePower and upliftPower come from the
+        // intent layer and only change with the settings, yet x^p runs per
+        // cell inside the height kernels. SetSettings bakes each exponent
+        // into a flat table over [0, 1] once, so the per-cell cost collapses
+        // to a lerped table read; the analytic-gradient path reads its
+        // derivative from the same bake.
+        struct PowerCurve
+        {
+            static constexpr int RESOLUTION = 256;
+
+            void Bake(float power);
+
+            float Sample(float x) const
+            {
+                float fx = std::clamp(x, 0.0f, 1.0f) * RESOLUTION;
+                int i = std::min(static_cast<int>(fx), RESOLUTION - 1);
+                float t = fx - i;
+                return values[i] + (values[i + 1] - values[i]) * t;
+            }
+
+            // d/dx x^p at x, from the baked knots
+            float Derivative(float x) const
+            {
+                float fx = std::clamp(x, 0.0f, 1.0f) * RESOLUTION;
+                int i = std::min(static_cast<int>(fx), RESOLUTION - 1);
+                float t = fx - i;
+                return derivatives[i] + (derivatives[i + 1] - derivatives[i]) * t;
+            }
+
+            std::array<float, RESOLUTION + 1> values{};
+            std::array<float, RESOLUTION + 1> derivatives{};
+        };
+
+        // Feature bits for the specialized row kernels. SampleRawHeightRow
+        // folds the TerrainSettings flags into a mask once per call and
+        // dispatches to a kernel instantiation where every feature test is
+        // if constexpr, so the per-sample loops carry no flag branches.
+        static constexpr uint32_t FEATURE_CONTINENTAL = 1u << 0;
+        static constexpr uint32_t FEATURE_RIDGE = 1u << 1;
+        static constexpr uint32_t FEATURE_WARP = 1u << 2;
+        static constexpr uint32_t FEATURE_UPLIFT = 1u << 3;
+
+        template <uint32_t Features>
+        void SampleRawHeightRowKernel(const float *worldXs, const float *worldZs, float *out, size_t n) const;
+
+        // Populate m_WarpCache covering the given world rectangle. Cleared
+        // again at the end of heightmap generation so stray queries never
+        // interpolate outside the lattice.
+        void BuildWarpCache(float minWorldX, float minWorldZ, float maxWorldX, float maxWorldZ);
+
+        // Exact accumulated warp offsets (noise space) for a batch of world
+        // positions; this is the full per-level FBM loop the cache amortizes.
+        void ComputeWarpOffsetRow(const float *worldXs, const float *worldZs,
+                                  float *outDx, float *outDz, size_t n) const;
+
+        // Apply erosion to heightmap in-place. cellSize is passed explicitly
+        // because the downsampled erosion path runs on a coarser grid.
+        void ApplySlopeErosion(std::vector<float> &heightmap, int width, int depth, float cellSize) const;
         void ApplyHydraulicErosion(std::vector<float> &heightmap, int width, int depth, float offsetX, float offsetZ) const;
+
+        // Run the erosion passes (settings.erosionDownsample > 1) on a
+        // downsampled heightfield, then reinject the high-frequency detail:
+        // result = upsample(erode(downsample(h))) + (h - upsample(downsample(h)))
+        void ApplyErosionDownsampled(std::vector<float> &heightmap, int width, int depth,
+                                     float offsetX, float offsetZ, int downsample) const;
+
+        // Bilinearly upsample a coarse grid (spacing = step fine cells) onto
+        // the full-resolution grid
+        void UpsampleBilinear(const std::vector<float> &src, int srcWidth, int srcDepth,
+                              std::vector<float> &dst, int dstWidth, int dstDepth, int step) const;
         void ApplyPeakShaping(std::vector<float> &heightmap, int width, int depth) const;
 
-        // Build mesh from heightmap
-        std::shared_ptr<Mesh> BuildMeshFromHeightmap(const std::vector<float> &heightmap, float offsetX, float offsetZ, const MaterialBlender *materialBlender = nullptr, const BiomeClassifier *biomeClassifier = nullptr) const;
+        // Build mesh from heightmap (lodStep > 1 samples a coarser grid and adds skirts)
+        std::shared_ptr<Mesh> BuildMeshFromHeightmap(const std::vector<float> &heightmap, float offsetX, float offsetZ, const MaterialBlender *materialBlender = nullptr, const BiomeClassifier *biomeClassifier = nullptr, int lodStep = 1) const;
 
         // Bilinear height sampling for hydraulic erosion
         float SampleHeightBilinear(const std::vector<float> &heightmap, int width, float x, float z) const;
         glm::vec2 SampleGradientBilinear(const std::vector<float> &heightmap, int width, float x, float z) const;
 
         TerrainSettings m_Settings;
-        SimplexNoise m_Noise;
+        // Shared immutable per-seed state; every generator (and every
+        // worker) on this seed references the same permutation tables
+        std::shared_ptr<const SimplexNoise> m_Noise;
         std::vector<float> m_CachedHeightmap;
+        HeightmapBorders m_RawBorders;
+        WarpOffsetCache m_WarpCache;
+        PowerCurve m_RidgeCurve;  // Baked x^ridgePower
+        PowerCurve m_UpliftCurve; // Baked x^upliftPower
         glm::vec2 m_ChunkOrigin{0.0f, 0.0f}; // World origin of cached heightmap
+
+        static HeightfieldCompute *s_ComputeBackend;
+        static ErosionCompute *s_ErosionBackend;
     };
 
 }
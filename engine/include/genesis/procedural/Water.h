@@ -56,6 +56,17 @@ namespace Genesis
             float width, float depth,
             int subdivisions = 16,
             float height = 0.0f);
+
+        // Generate a camera-centered ocean grid at y = 0: uniform cells of
+        // innerCellSize around the origin, growing geometrically outward
+        // until the grid spans radius in every direction. Built once and
+        // drawn every frame with a translation to (camera xz, sea level) -
+        // the vertex shader displaces waves from world position, so the
+        // grid itself never rebuilds, not even when sea level changes.
+        static std::shared_ptr<Mesh> GenerateOceanGrid(
+            float innerCellSize,
+            int innerCells = 64,
+            float radius = 1500.0f);
     };
 
 } // namespace Genesis
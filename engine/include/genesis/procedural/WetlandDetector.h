@@ -98,9 +98,16 @@ namespace Genesis
         /**
          * Detect wetlands from hydrology data.
          *
+         * When a dirty region is supplied and the grid dimensions are
+         * unchanged, only cells inside the region are re-evaluated - pass
+         * HydrologyGenerator::GetDirtyRegion() after an incremental
+         * hydrology update (e.g. a sea-level nudge) to skip the 99% of
+         * cells whose inputs did not move.
+         *
          * @param hydrology  Computed hydrology data
+         * @param region     Optional changed-cell region; nullptr = full scan
          */
-        void Detect(const HydrologyData &hydrology);
+        void Detect(const HydrologyData &hydrology, const DirtyRegion *region = nullptr);
 
         /**
          * Get the wetland data.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "genesis/math/Math.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -20,7 +21,14 @@ namespace Genesis {
 
         const glm::mat4& GetProjectionMatrix() const { return m_ProjectionMatrix; }
         const glm::mat4& GetViewMatrix() const { return m_ViewMatrix; }
-        glm::mat4 GetViewProjectionMatrix() const { return m_ProjectionMatrix * m_ViewMatrix; }
+
+        // Memoized: recomputed at most once per setter call, however many
+        // consumers (UBO upload, chunk culling, instance culling) read it
+        const glm::mat4& GetViewProjectionMatrix() const;
+
+        // Frustum planes extracted from the memoized view-projection,
+        // cached under the same dirty flag
+        const Frustum& GetFrustum() const;
 
         const glm::vec3& GetPosition() const { return m_Position; }
         const glm::vec3& GetRotation() const { return m_Rotation; }
@@ -39,11 +47,17 @@ namespace Genesis {
     private:
         void RecalculateViewMatrix();
         void RecalculateProjectionMatrix();
+        void RecalculateDerived() const;
 
     private:
         glm::mat4 m_ProjectionMatrix{1.0f};
         glm::mat4 m_ViewMatrix{1.0f};
 
+        // Derived state, rebuilt lazily when a setter dirtied it
+        mutable glm::mat4 m_ViewProjectionMatrix{1.0f};
+        mutable Frustum m_Frustum{};
+        mutable bool m_DerivedDirty = true;
+
         glm::vec3 m_Position{0.0f, 0.0f, 0.0f};
         glm::vec3 m_Rotation{0.0f, 0.0f, 0.0f};
 
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "genesis/renderer/GpuAllocator.h"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+namespace Genesis
+{
+
+    class VulkanDevice;
+
+    // World-space RGBA8 atlas of per-cell terrain debug fields (R = height,
+    // G = log flow accumulation, B = moisture, A = biome id), sampled by the
+    // terrain fragment shader to colorize debug views on the GPU.
+    //
+    // Chunks map to atlas slots toroidally (chunk coordinate modulo
+    // CHUNKS_PER_SIDE), so the shader needs no origin bookkeeping: the
+    // fractional part of worldXZ over the atlas world period is the UV.
+    // As long as the loaded ring is smaller than CHUNKS_PER_SIDE no two
+    // resident chunks share a slot. One texture bound once in the global
+    // descriptor set serves every chunk, which keeps the multi-draw
+    // indirect terrain path working without per-draw descriptors.
+    class DebugFieldAtlas
+    {
+    public:
+        // 16 x 16 chunk slots; at the default 128-cell chunk this is a
+        // 2048 x 2048 texture (16 MB)
+        static constexpr int CHUNKS_PER_SIDE = 16;
+
+        DebugFieldAtlas() = default;
+        ~DebugFieldAtlas();
+
+        void Init(VulkanDevice &device, int chunkTexels);
+        void Shutdown();
+
+        // Write one chunk's field block (chunkTexels^2 RGBA texels) into its
+        // toroidal slot. Nothing reaches the GPU until FlushUploads.
+        void UpdateChunk(int chunkX, int chunkZ, const uint8_t *rgba);
+
+        // Upload all queued slots in one submission
+        void FlushUploads();
+
+        VkImageView GetImageView() const { return m_ImageView; }
+        VkSampler GetSampler() const { return m_Sampler; }
+        bool IsValid() const { return m_Image != VK_NULL_HANDLE; }
+        int GetChunkTexels() const { return m_ChunkTexels; }
+
+    private:
+        struct SlotRect
+        {
+            int X = 0;
+            int Y = 0;
+        };
+
+        VulkanDevice *m_Device = nullptr;
+        int m_ChunkTexels = 0;
+        int m_Size = 0; // Texels per atlas side
+
+        VkImage m_Image = VK_NULL_HANDLE;
+        GpuAllocation m_ImageAllocation;
+        VkImageView m_ImageView = VK_NULL_HANDLE;
+        VkSampler m_Sampler = VK_NULL_HANDLE;
+
+        VkBuffer m_StagingBuffer = VK_NULL_HANDLE;
+        GpuAllocation m_StagingAllocation;
+
+        // CPU mirror; slot updates write through it and FlushUploads copies
+        // the queued slot rectangles out of it
+        std::vector<uint8_t> m_Pixels;
+        std::vector<SlotRect> m_DirtySlots;
+        bool m_Initialized = false;
+    };
+
+}
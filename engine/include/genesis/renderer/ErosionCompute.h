@@ -0,0 +1,71 @@
+#pragma once
+
+#include "genesis/renderer/VulkanBuffer.h"
+#include "genesis/renderer/VulkanPipeline.h"
+
+#include <vulkan/vulkan.h>
+#include <mutex>
+#include <vector>
+
+namespace Genesis {
+
+    class VulkanDevice;
+    struct TerrainSettings;
+
+    // GPU hydraulic erosion. Simulates one water droplet per compute thread
+    // against a GPU-resident heightfield, so droplet counts in the tens of
+    // thousands run at interactive speeds where the serial CPU particle loop
+    // in TerrainGenerator is capped at a few hundred.
+    //
+    // Droplets run concurrently against the pre-erosion heightfield and
+    // accumulate their height changes into a fixed-point delta buffer with
+    // integer atomics; the deltas are applied to the heightmap on readback.
+    // Unlike the serial CPU loop, droplets therefore don't see each other's
+    // carving within one dispatch - at the droplet counts this enables the
+    // difference is not visible.
+    //
+    // The shader is optional: if assets/shaders/erosion.comp.spv is not
+    // present, Init logs a warning and IsAvailable() returns false so callers
+    // fall back to the CPU erosion path.
+    //
+    // Same queue constraints as HeightfieldCompute: dispatches go through the
+    // single-time command helpers on the shared graphics queue, so only call
+    // Erode from the thread that owns rendering.
+    class ErosionCompute {
+    public:
+        ErosionCompute() = default;
+        ~ErosionCompute();
+
+        void Init(VulkanDevice& device);
+        void Shutdown();
+
+        bool IsAvailable() const { return m_Available; }
+
+        // Erodes the (width * depth) heightmap in-place with
+        // settings.gpuErosionDroplets droplets. offsetX/offsetZ seed the
+        // droplet RNG per chunk, like the CPU path. Returns false when the
+        // compute path is unavailable or the dispatch fails.
+        bool Erode(const TerrainSettings& settings, std::vector<float>& heightmap,
+                   int width, int depth, float offsetX, float offsetZ);
+
+    private:
+        void CreateDescriptorResources();
+        void EnsureBuffers(VkDeviceSize heightSize);
+
+    private:
+        VulkanDevice* m_Device = nullptr;
+        bool m_Available = false;
+
+        VulkanPipeline m_Pipeline;
+        VkDescriptorSetLayout m_DescriptorSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        // Allocated from the device's shared descriptor pools
+        VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
+
+        VulkanBuffer m_HeightBuffer; // Host-visible heightfield, read by droplets
+        VulkanBuffer m_DeltaBuffer;  // Fixed-point height deltas, atomicAdd target
+
+        std::mutex m_DispatchMutex;
+    };
+
+}
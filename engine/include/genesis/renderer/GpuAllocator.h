@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <vector>
+
+namespace Genesis {
+
+    // A sub-allocation handed out by GpuAllocator. Memory/Offset identify the
+    // range inside a shared block; Mapped is the CPU pointer to the start of
+    // the range when the memory is host-visible (blocks stay persistently
+    // mapped, so no vkMapMemory per allocation).
+    struct GpuAllocation {
+        VkDeviceMemory Memory = VK_NULL_HANDLE;
+        VkDeviceSize Offset = 0;
+        VkDeviceSize Size = 0;
+        void* Mapped = nullptr;
+        uint32_t MemoryTypeIndex = 0;
+        int32_t BlockIndex = -1; // -1 = dedicated allocation, not in a block
+
+        bool IsValid() const { return Memory != VK_NULL_HANDLE; }
+    };
+
+    // Block-based device memory allocator. vkAllocateMemory is slow and
+    // drivers cap the total allocation count (commonly 4096), which a
+    // streaming world with several buffers per chunk exhausts quickly.
+    // Instead, memory is carved out of large shared blocks with first-fit
+    // free lists; freed ranges coalesce with their neighbours for reuse.
+    // Buffers and optimal-tiled images never share a block, which sidesteps
+    // bufferImageGranularity aliasing rules.
+    class GpuAllocator {
+    public:
+        GpuAllocator() = default;
+        ~GpuAllocator();
+
+        void Init(VkPhysicalDevice physicalDevice, VkDevice device);
+        void Shutdown();
+
+        // Allocates memory satisfying the given requirements. Pass
+        // linear = false for optimal-tiled images. Oversized requests get a
+        // dedicated VkDeviceMemory of their own.
+        GpuAllocation Allocate(const VkMemoryRequirements& requirements,
+                               VkMemoryPropertyFlags properties, bool linear = true);
+        void Free(const GpuAllocation& allocation);
+
+        // Number of device memory blocks currently allocated
+        size_t GetBlockCount() const { return m_Blocks.size(); }
+
+    private:
+        struct FreeRange {
+            VkDeviceSize Offset = 0;
+            VkDeviceSize Size = 0;
+        };
+
+        struct Block {
+            VkDeviceMemory Memory = VK_NULL_HANDLE;
+            VkDeviceSize Size = 0;
+            void* Mapped = nullptr;
+            uint32_t MemoryTypeIndex = 0;
+            bool Linear = true;
+            std::vector<FreeRange> FreeRanges; // Sorted by offset
+        };
+
+        bool AllocateFromBlock(Block& block, VkDeviceSize size, VkDeviceSize alignment,
+                               VkDeviceSize& outOffset);
+        static void ReleaseRange(std::vector<FreeRange>& freeList,
+                                 VkDeviceSize offset, VkDeviceSize size);
+        uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const;
+
+    private:
+        static constexpr VkDeviceSize BLOCK_SIZE = 64 * 1024 * 1024;
+        // Requests past this size get their own VkDeviceMemory instead of
+        // fragmenting a shared block
+        static constexpr VkDeviceSize DEDICATED_THRESHOLD = BLOCK_SIZE / 2;
+
+        VkPhysicalDevice m_PhysicalDevice = VK_NULL_HANDLE;
+        VkDevice m_Device = VK_NULL_HANDLE;
+        std::vector<Block> m_Blocks; // Indices stay stable; blocks live until Shutdown
+    };
+
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+#include <array>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Genesis
+{
+
+    class VulkanDevice;
+    struct RenderStats;
+
+    /**
+     * GPU timestamp instrumentation built on a VkQueryPool.
+     *
+     * Each render stage brackets its commands with BeginZone/EndZone, which
+     * write top/bottom-of-pipe timestamps. Results are resolved when the same
+     * frame-in-flight slot comes around again (its fence has been waited on
+     * by then, so the queries are ready without stalling) and published
+     * through RenderStats::GpuZones; zones recorded several times in one
+     * frame under the same name are summed.
+     *
+     * A per-zone sample ring is kept so the editor can graph timings over
+     * the last HISTORY_SIZE frames.
+     *
+     * All methods degrade to no-ops when the device lacks usable timestamps.
+     */
+    class GpuProfiler
+    {
+    public:
+        // 2 queries per zone instance
+        static constexpr uint32_t MAX_QUERIES_PER_FRAME = 128;
+        static constexpr uint32_t HISTORY_SIZE = 120;
+
+        struct ZoneHistory
+        {
+            std::array<float, HISTORY_SIZE> Samples{};
+            uint32_t Head = 0; // Next write position; oldest sample
+        };
+
+        GpuProfiler() = default;
+
+        void Init(VulkanDevice &device, uint32_t framesInFlight);
+        void Shutdown();
+
+        // Resolves the results this frame slot wrote last time round into
+        // stats, then resets its query range. Must be recorded outside a
+        // render pass (vkCmdResetQueryPool requirement).
+        void BeginFrame(VkCommandBuffer cmd, uint32_t frameIndex, RenderStats &stats);
+
+        // Zones may nest; every BeginZone needs a matching EndZone in the
+        // same frame. Names should be string literals or otherwise stable.
+        // Safe to call from several command-recording threads at once, but a
+        // zone must begin and end on the same thread (the nesting stack is
+        // per thread).
+        void BeginZone(VkCommandBuffer cmd, const char *name);
+        void EndZone(VkCommandBuffer cmd);
+
+        bool IsSupported() const { return m_Supported; }
+
+        // Per-zone sample rings for graphing; keyed by zone name
+        const std::unordered_map<std::string, ZoneHistory> &GetHistory() const { return m_History; }
+
+    private:
+        struct ZoneRecord
+        {
+            std::string Name;
+            uint32_t BeginQuery = 0;
+            uint32_t EndQuery = 0;
+        };
+
+        struct FrameQueries
+        {
+            std::vector<ZoneRecord> Zones;
+            uint32_t NextQuery = 0; // Relative to the slot's base query index
+        };
+
+        void ResolveFrame(FrameQueries &frame, uint32_t baseQuery, RenderStats &stats);
+
+    private:
+        VulkanDevice *m_Device = nullptr;
+        VkQueryPool m_QueryPool = VK_NULL_HANDLE;
+        std::vector<FrameQueries> m_Frames;
+        std::mutex m_ZoneMutex; // Guards query allocation across recording threads
+        uint32_t m_CurrentFrame = 0;
+        float m_TimestampPeriod = 0.0f; // Nanoseconds per tick
+        bool m_Supported = false;
+
+        std::unordered_map<std::string, ZoneHistory> m_History;
+    };
+
+}
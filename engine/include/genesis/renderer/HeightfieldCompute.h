@@ -0,0 +1,82 @@
+#pragma once
+
+#include "genesis/renderer/VulkanBuffer.h"
+#include "genesis/renderer/VulkanPipeline.h"
+#include "genesis/procedural/Noise.h"
+
+#include <vulkan/vulkan.h>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace Genesis {
+
+    class VulkanDevice;
+    struct TerrainSettings;
+
+    // GPU heightfield generator. Evaluates the same layered noise stack as
+    // TerrainGenerator::SampleRawHeight (continental field, base FBM, warped
+    // ridge noise, uplift mask, ocean depth bias) for a whole grid in a single
+    // compute dispatch, then reads the heights back through a host-visible
+    // storage buffer.
+    //
+    // The shader is optional: if assets/shaders/heightfield.comp.spv is not
+    // present, Init logs a warning and IsAvailable() returns false so callers
+    // fall back to the CPU path.
+    //
+    // Generate serializes its own dispatches with an internal mutex, but it
+    // submits on the shared graphics queue via the single-time command helpers.
+    // Callers must ensure no other thread is submitting to that queue at the
+    // same time - in practice that means calling Generate from the thread that
+    // owns rendering, not from the chunk generation workers.
+    class HeightfieldCompute {
+    public:
+        HeightfieldCompute() = default;
+        ~HeightfieldCompute();
+
+        void Init(VulkanDevice& device);
+        void Shutdown();
+
+        bool IsAvailable() const { return m_Available; }
+
+        // Fills outHeights with (width * depth) samples starting at world
+        // position (originX, originZ), spaced by settings.cellSize. Returns
+        // false when the compute path is unavailable or the dispatch fails.
+        bool Generate(const TerrainSettings& settings, float originX, float originZ,
+                      int width, int depth, std::vector<float>& outHeights);
+
+        // Non-blocking variant: records the same dispatch but routes the
+        // result through the device's readback ring instead of waiting on
+        // queue idle, so several requests pipeline while the GPU works. The
+        // callback runs inside VulkanDevice::PollReadbacks one to two frames
+        // later, on the polling (render) thread. Returns false when the
+        // compute path is unavailable; the callback is then never invoked.
+        bool GenerateAsync(const TerrainSettings& settings, float originX, float originZ,
+                           int width, int depth,
+                           std::function<void(std::vector<float> heights)> callback);
+
+    private:
+        void CreateDescriptorResources();
+        void EnsureHeightBuffer(VkDeviceSize size);
+        void UploadPermutation(uint32_t seed);
+
+    private:
+        VulkanDevice* m_Device = nullptr;
+        bool m_Available = false;
+
+        VulkanPipeline m_Pipeline;
+        VkDescriptorSetLayout m_DescriptorSetLayout = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        // Allocated from the device's shared descriptor pools
+        VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
+
+        VulkanBuffer m_HeightBuffer;      // Host-visible readback target
+        VulkanBuffer m_PermutationBuffer; // 512-entry simplex permutation table
+
+        uint32_t m_UploadedSeed = 0;
+        bool m_PermutationUploaded = false;
+
+        std::mutex m_DispatchMutex;
+    };
+
+}
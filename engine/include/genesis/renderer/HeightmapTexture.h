@@ -1,5 +1,7 @@
 #pragma once
 
+#include "genesis/renderer/GpuAllocator.h"
+
 #include <vulkan/vulkan.h>
 #include <vector>
 
@@ -11,14 +13,52 @@ namespace Genesis
     class HeightmapTexture
     {
     public:
+        // Texel storage. RGBA8 is the general-purpose path (colored
+        // previews, icon atlases); R16 stores a single normalized height
+        // channel at half the memory and upload bandwidth, with the view
+        // swizzled to broadcast red so ImGui still shows grayscale.
+        enum class Format
+        {
+            RGBA8,
+            R16,
+        };
+
+        // Texel region awaiting upload, in image coordinates
+        struct DirtyRect
+        {
+            int X = 0;
+            int Y = 0;
+            int Width = 0;
+            int Height = 0;
+        };
+
         HeightmapTexture() = default;
         ~HeightmapTexture();
 
-        void Create(VulkanDevice &device, int width, int height);
+        // generateMips allocates and maintains a full mip chain: every
+        // flush re-derives the chain from the base level on the GPU, so
+        // consumers drawn far below native size (the minimap) sample the
+        // right level instead of magnifying a huge base texture.
+        void Create(VulkanDevice &device, int width, int height,
+                    Format format = Format::RGBA8, bool generateMips = false);
         void Destroy();
+
+        // Full-image updates diff against the previous contents and upload
+        // only the rows that actually changed; scrubbing a setting that
+        // shifts a few texels costs a few texels, not the whole texture.
         void Update(const std::vector<float> &heightData, float minHeight, float maxHeight);
+
+        // RGBA8 textures only
         void UpdateRGBA(const uint8_t *rgbaData, size_t dataSize);
 
+        // Partial update for callers that know their dirty area (heightData
+        // is still the full-size grid). Regions queue up and coalesce;
+        // nothing reaches the GPU until FlushUploads, so several chunk-sized
+        // rects per frame become one transfer.
+        void UpdateRegion(const std::vector<float> &heightData, float minHeight, float maxHeight,
+                          const DirtyRect &rect);
+        void FlushUploads();
+
         VkDescriptorSet GetDescriptorSet() const { return m_DescriptorSet; }
         int GetWidth() const { return m_Width; }
         int GetHeight() const { return m_Height; }
@@ -28,21 +68,42 @@ namespace Genesis
         void CreateImage(VulkanDevice &device);
         void CreateSampler(VulkanDevice &device);
         void CreateDescriptorSet(VulkanDevice &device);
-        uint32_t FindMemoryType(VulkanDevice &device, uint32_t typeFilter, VkMemoryPropertyFlags properties);
+
+        // Diffs newPixels against the CPU mirror row by row, queues a rect
+        // per run of changed rows and adopts newPixels as the new mirror
+        void DiffAndQueue(const uint8_t *newPixels);
+        void QueueDirtyRect(DirtyRect rect);
+
+        // Rebuilds mip levels 1..N-1 from the base level by blit chain.
+        // Entered with level 0 in TRANSFER_DST; leaves every level in
+        // SHADER_READ_ONLY.
+        void GenerateMipChain(VkCommandBuffer commandBuffer);
+
+        VkFormat GetVkFormat() const;
+        size_t BytesPerTexel() const { return m_Format == Format::R16 ? 2 : 4; }
 
     private:
         VulkanDevice *m_Device = nullptr;
         int m_Width = 0;
         int m_Height = 0;
+        Format m_Format = Format::RGBA8;
+        uint32_t m_MipLevels = 1;
 
         VkImage m_Image = VK_NULL_HANDLE;
-        VkDeviceMemory m_ImageMemory = VK_NULL_HANDLE;
+        GpuAllocation m_ImageAllocation;
         VkImageView m_ImageView = VK_NULL_HANDLE;
         VkSampler m_Sampler = VK_NULL_HANDLE;
         VkDescriptorSet m_DescriptorSet = VK_NULL_HANDLE;
 
         VkBuffer m_StagingBuffer = VK_NULL_HANDLE;
-        VkDeviceMemory m_StagingMemory = VK_NULL_HANDLE;
+        GpuAllocation m_StagingAllocation;
+
+        // CPU mirror of the image contents; diffed against by the full
+        // updates and written through by UpdateRegion. Host-visible staging
+        // memory is write-combined, so reads diff against this instead.
+        std::vector<uint8_t> m_Pixels;
+        std::vector<DirtyRect> m_DirtyRects;
+        bool m_Initialized = false;
     };
 
 }
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "genesis/renderer/Mesh.h"
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+#include <memory>
+#include <vector>
+
+namespace Genesis
+{
+
+    class VulkanDevice;
+    class VulkanBuffer;
+    class VulkanPipeline;
+    struct RenderStats;
+
+    /**
+     * Multi-draw indirect rendering of chunk terrain.
+     *
+     * Chunk terrain shares one material and pipeline, yet was issued as a
+     * Bind/Draw plus a push constant update per chunk mesh - 100+ draw
+     * calls per frame once LOD and water meshes are counted. This renderer
+     * sub-allocates terrain geometry from shared mega vertex/index buffers
+     * and draws every visible chunk with a single vkCmdDrawIndexedIndirect
+     * call. Per-chunk transforms live in a storage buffer indexed in the
+     * vertex shader by gl_InstanceIndex: each indirect command is issued
+     * with instanceCount 1 and firstInstance set to its draw slot, which
+     * gives the shader a per-draw index without requiring the
+     * shaderDrawParameters feature that gl_DrawID would need.
+     */
+    class IndirectTerrainRenderer
+    {
+    public:
+        IndirectTerrainRenderer() = default;
+        ~IndirectTerrainRenderer();
+
+        /**
+         * Initialize shared buffers, pipeline and per-frame resources.
+         *
+         * @param globalSetLayout  The renderer's set 0 layout (GlobalUBO)
+         * @param framesInFlight   Renderer::MAX_FRAMES_IN_FLIGHT
+         * @param shadowRenderPass Optional depth-only pass the shadow
+         *                         pipeline targets; null skips FlushShadows
+         *                         support
+         */
+        void Init(VulkanDevice &device, VkDescriptorSetLayout globalSetLayout,
+                  VkRenderPass renderPass, uint32_t framesInFlight,
+                  VkRenderPass shadowRenderPass = VK_NULL_HANDLE,
+                  VkDescriptorSetLayout materialArrayLayout = VK_NULL_HANDLE);
+
+        /**
+         * Bindless material texture set (see MaterialTextureArray), bound
+         * once at set 2 for the whole batch when the layout was passed to
+         * Init. Null leaves the slot unbound; shaders then must not index
+         * the array.
+         */
+        void SetMaterialDescriptorSet(VkDescriptorSet set) { m_MaterialSet = set; }
+
+        /**
+         * Shutdown and release resources.
+         */
+        void Shutdown();
+
+        /**
+         * Copy a mesh into the shared buffers. Grows the buffers when full.
+         * Returns an invalid allocation if the mesh cannot be placed.
+         */
+        TerrainMeshAllocation Allocate(const std::vector<Vertex> &vertices,
+                                       const std::vector<uint32_t> &indices);
+
+        /**
+         * Return an allocation's ranges to the free lists.
+         */
+        void Free(const TerrainMeshAllocation &allocation);
+
+        /**
+         * Begin a new frame - reset the draw list.
+         */
+        void BeginFrame();
+
+        /**
+         * Queue one terrain mesh for the next flush.
+         */
+        void Submit(const TerrainMeshAllocation &allocation, const glm::mat4 &transform);
+
+        bool HasPendingDraws() const { return !m_PendingDraws.empty(); }
+
+        /**
+         * Record the indirect draw covering everything submitted since the
+         * previous flush. Leaves the terrain-indirect pipeline bound; the
+         * caller restores its own pipeline afterwards.
+         */
+        void Flush(VkCommandBuffer commandBuffer, VkDescriptorSet globalSet,
+                   uint32_t frameIndex, RenderStats &stats);
+
+        /**
+         * Record the frame's already-flushed draws again, depth-only from
+         * the light's point of view, into an open shadow render pass. The
+         * caller has set the cascade's viewport; the light matrix rides a
+         * push constant so one call per cascade reuses this frame's
+         * transform and indirect buffers untouched.
+         */
+        void FlushShadows(VkCommandBuffer commandBuffer, VkDescriptorSet globalSet,
+                          uint32_t frameIndex, const glm::mat4 &lightViewProj,
+                          RenderStats &stats);
+
+        /**
+         * Draws flushed so far this frame, i.e. the range FlushShadows
+         * re-issues.
+         */
+        uint32_t GetFrameDrawCount() const { return m_FrameDrawOffset; }
+
+        /**
+         * Bumped whenever pool geometry is added or freed; shadow caching
+         * uses it to detect that the static scene changed.
+         */
+        uint64_t GetGeometryVersion() const { return m_GeometryVersion; }
+
+        bool IsInitialized() const { return m_Device != nullptr; }
+
+        /**
+         * Mega buffer handles for passes that draw pooled allocations
+         * directly instead of through the indirect batch (the pick pass);
+         * vertices are TerrainVertex, indices uint32.
+         */
+        VkBuffer GetPoolVertexBuffer() const;
+        VkBuffer GetPoolIndexBuffer() const;
+
+        /**
+         * Depth pre-pass: when enabled (the default), Flush rasterizes the
+         * batch once through a position-only pipeline before shading, so
+         * early-Z rejects every occluded fragment and the shading pass
+         * touches each pixel exactly once. Wins on fragment-bound GPUs;
+         * disable when vertex work dominates.
+         */
+        void SetDepthPrePass(bool enabled) { m_DepthPrePass = enabled; }
+        bool IsDepthPrePassEnabled() const { return m_DepthPrePass; }
+
+    private:
+        // Matches the TransformData block in lowpoly_indirect.vert
+        struct DrawTransform
+        {
+            glm::mat4 ModelMatrix{1.0f};
+            glm::mat4 NormalMatrix{1.0f};
+        };
+
+        struct PendingDraw
+        {
+            TerrainMeshAllocation allocation;
+            DrawTransform transform;
+        };
+
+        // Free span in the vertex or index mega buffer, in elements
+        struct FreeRange
+        {
+            uint32_t offset;
+            uint32_t count;
+        };
+
+        // Per frame-in-flight transform and indirect command storage, so
+        // one frame's buffers are never rewritten while the GPU reads them
+        struct FrameResources
+        {
+            std::unique_ptr<VulkanBuffer> transformBuffer;
+            std::unique_ptr<VulkanBuffer> indirectBuffer;
+            VkDescriptorSet transformSet = VK_NULL_HANDLE;
+        };
+
+        void CreateMegaBuffers();
+        void CreateFrameResources(uint32_t framesInFlight);
+        void CreatePipeline(VkDescriptorSetLayout globalSetLayout, VkRenderPass renderPass);
+        void CreateShadowPipeline(VkDescriptorSetLayout globalSetLayout,
+                                  VkRenderPass shadowRenderPass);
+
+        // First-fit allocation from a sorted, coalesced free list
+        static bool AllocateRange(std::vector<FreeRange> &freeList, uint32_t count,
+                                  uint32_t &offset);
+        static void ReleaseRange(std::vector<FreeRange> &freeList, uint32_t offset,
+                                 uint32_t count);
+
+        // Replace a mega buffer with a larger one, copying the live contents
+        void GrowBuffer(std::unique_ptr<VulkanBuffer> &buffer, uint32_t &capacity,
+                        uint32_t requiredCount, uint32_t elementSize,
+                        VkBufferUsageFlags usage, std::vector<FreeRange> &freeList);
+
+        VulkanDevice *m_Device = nullptr;
+
+        // Shared geometry storage
+        std::unique_ptr<VulkanBuffer> m_VertexBuffer;
+        std::unique_ptr<VulkanBuffer> m_IndexBuffer;
+        uint32_t m_VertexCapacity = 0;
+        uint32_t m_IndexCapacity = 0;
+        std::vector<FreeRange> m_FreeVertexRanges;
+        std::vector<FreeRange> m_FreeIndexRanges;
+
+        std::vector<FrameResources> m_Frames;
+
+        VkDescriptorSetLayout m_TransformSetLayout = VK_NULL_HANDLE;
+        // Bindless material array (set 2); null when the device lacks
+        // descriptor indexing and the pipeline layout stays at two sets
+        VkDescriptorSetLayout m_MaterialSetLayout = VK_NULL_HANDLE;
+        VkDescriptorSet m_MaterialSet = VK_NULL_HANDLE;
+        VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        std::unique_ptr<VulkanPipeline> m_Pipeline;
+        std::unique_ptr<VulkanPipeline> m_DepthPipeline;
+        bool m_DepthPrePass = true;
+
+        // Shadow cascade rendering reuses the frame buffers under its own
+        // layout: same descriptor sets plus a light matrix push constant
+        VkPipelineLayout m_ShadowPipelineLayout = VK_NULL_HANDLE;
+        std::unique_ptr<VulkanPipeline> m_ShadowPipeline;
+
+        std::vector<PendingDraw> m_PendingDraws;
+        // Draw slots already flushed this frame (buffer write offset)
+        uint32_t m_FrameDrawOffset = 0;
+        // Incremented on every Allocate/Free (see GetGeometryVersion)
+        uint64_t m_GeometryVersion = 0;
+
+        static constexpr uint32_t INITIAL_VERTEX_CAPACITY = 2u * 1024 * 1024;
+        static constexpr uint32_t INITIAL_INDEX_CAPACITY = 8u * 1024 * 1024;
+        static constexpr uint32_t MAX_DRAWS_PER_FRAME = 2048;
+    };
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "genesis/renderer/Mesh.h"
+#include "genesis/math/Math.h"
 #include <glm/glm.hpp>
 #include <vulkan/vulkan.h>
 #include <memory>
@@ -11,6 +12,8 @@ namespace Genesis
 
     class VulkanDevice;
     class VulkanBuffer;
+    class VulkanPipeline;
+    struct RenderStats;
 
     /**
      * Section 30.3: Instanced Rendering
@@ -32,17 +35,40 @@ namespace Genesis
     };
 
     /**
-     * Batch of instances for a single mesh type.
+     * Persistent batch of instances for a single mesh type.
+     *
+     * Instance data lives on the GPU between frames; the dirty mask marks
+     * which frame-in-flight buffers still need a re-upload after the CPU
+     * list changed.
      */
     struct InstanceBatch
     {
-        std::vector<InstanceData> instances;
         Mesh *mesh = nullptr; // Shared mesh for all instances
-        uint32_t instanceCount = 0;
+        std::vector<InstanceData> instances;
+
+        // One set of buffers per frame in flight so a re-upload never
+        // rewrites a buffer the GPU is still reading. The cull pass reads
+        // the source buffer and compacts survivors into the visible buffer;
+        // the indirect buffer carries the resulting draw command.
+        std::vector<std::unique_ptr<VulkanBuffer>> buffers;
+        std::vector<std::unique_ptr<VulkanBuffer>> visibleBuffers;
+        std::vector<std::unique_ptr<VulkanBuffer>> indirectBuffers;
+        std::vector<VkDescriptorSet> cullSets;
+        std::vector<size_t> capacities; // Per-slot capacity in instances
+        uint32_t dirtyMask = 0;         // Bit n: slot n's source buffer is stale
+
+        float boundingRadius = 1.0f; // Mesh-space bounding sphere for cull tests
     };
 
     /**
      * Manages instanced rendering for vegetation and props.
+     *
+     * Batches are persistent: SetInstances replaces a mesh's instance list
+     * and marks its buffers dirty, and the cull pass re-uploads only dirty
+     * buffers. While nothing changes, a frame does no instance CPU work and
+     * no uploads. A compute pass frustum- and distance-culls each batch on
+     * the GPU, so each batch draws as one vkCmdDrawIndexedIndirect whose
+     * instance count only covers what survived.
      */
     class InstancedRenderer
     {
@@ -51,10 +77,13 @@ namespace Genesis
         ~InstancedRenderer();
 
         /**
-         * Initialize the instanced renderer.
+         * Initialize the instanced pipeline and per-frame resources.
+         *
+         * @param globalSetLayout The renderer's set 0 layout (GlobalUBO)
+         * @param framesInFlight  Renderer::MAX_FRAMES_IN_FLIGHT
          */
-        void Init(VulkanDevice &device, VkDescriptorSetLayout descriptorSetLayout,
-                  VkRenderPass renderPass);
+        void Init(VulkanDevice &device, VkDescriptorSetLayout globalSetLayout,
+                  VkRenderPass renderPass, uint32_t framesInFlight);
 
         /**
          * Shutdown and release resources.
@@ -62,45 +91,40 @@ namespace Genesis
         void Shutdown();
 
         /**
-         * Begin a new frame - clear instance data.
+         * Replace the instance list for a mesh and mark its buffers dirty.
+         * Call only when the instances actually change (chunk load/unload);
+         * an empty list removes the mesh from drawing.
          */
-        void BeginFrame();
+        void SetInstances(Mesh *mesh, const std::vector<InstanceData> &instances);
 
         /**
-         * Add instances for rendering.
-         *
-         * @param mesh      Shared mesh for all instances
-         * @param positions Instance positions (world space)
-         * @param scale     Uniform scale for all instances
+         * Supply the camera for this frame's GPU cull pass. Call before the
+         * renderer begins the frame; until the first call every instance is
+         * treated as visible.
          */
-        void AddInstances(Mesh *mesh,
-                          const std::vector<glm::vec3> &positions,
-                          float scale = 1.0f);
+        void SetCullCamera(const glm::vec3 &position, const glm::mat4 &viewProjection);
 
         /**
-         * Add instances with individual transforms.
-         *
-         * @param mesh      Shared mesh
-         * @param instances Per-instance transform data
+         * Instances farther than this from the camera are culled on the GPU
+         * (0 = unlimited).
          */
-        void AddInstances(Mesh *mesh,
-                          const std::vector<InstanceData> &instances);
+        void SetMaxDrawDistance(float distance) { m_MaxDrawDistance = distance; }
+        float GetMaxDrawDistance() const { return m_MaxDrawDistance; }
 
         /**
-         * Upload instance data to GPU.
-         * Call after all AddInstances calls and before Draw.
+         * Record the culling dispatches for every batch, re-uploading any
+         * source buffer the dirty mask marks stale. Must be recorded outside
+         * a render pass, before the draws that consume the results.
          */
-        void UploadInstances();
+        void RecordCull(VkCommandBuffer commandBuffer, uint32_t frameIndex);
 
         /**
-         * Draw all instanced batches.
-         *
-         * @param commandBuffer Active command buffer
-         * @param viewProjection Combined view-projection matrix
+         * Record one indirect instanced draw per batch using the surviving
+         * instances from RecordCull. Leaves the instanced pipeline bound;
+         * the caller restores its own pipeline afterwards.
          */
-        void Draw(VkCommandBuffer commandBuffer,
-                  VkDescriptorSet descriptorSet,
-                  VkPipelineLayout pipelineLayout);
+        void Draw(VkCommandBuffer commandBuffer, VkDescriptorSet globalSet,
+                  uint32_t frameIndex, RenderStats &stats);
 
         /**
          * Get total instance count across all batches.
@@ -110,23 +134,38 @@ namespace Genesis
         /**
          * Get number of draw calls.
          */
-        uint32_t GetDrawCallCount() const { return static_cast<uint32_t>(m_Batches.size()); }
+        uint32_t GetDrawCallCount() const;
+
+        bool IsInitialized() const { return m_Device != nullptr; }
 
     private:
-        void CreateInstanceBuffer();
-        void CreatePipeline(VkDescriptorSetLayout descriptorSetLayout, VkRenderPass renderPass);
+        void CreatePipeline(VkDescriptorSetLayout globalSetLayout, VkRenderPass renderPass);
+        void CreateCullResources();
+        void UploadBatch(InstanceBatch &batch, uint32_t frameIndex);
+        void EnsureBatchResources(InstanceBatch &batch, uint32_t frameIndex);
 
         VulkanDevice *m_Device = nullptr;
-        std::unique_ptr<VulkanBuffer> m_InstanceBuffer;
         VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
-        VkPipeline m_Pipeline = VK_NULL_HANDLE;
+        std::unique_ptr<VulkanPipeline> m_Pipeline;
+
+        // Compute culling resources
+        VkDescriptorSetLayout m_CullSetLayout = VK_NULL_HANDLE;
+        VkDescriptorPool m_CullDescriptorPool = VK_NULL_HANDLE;
+        VkPipelineLayout m_CullPipelineLayout = VK_NULL_HANDLE;
+        std::unique_ptr<VulkanPipeline> m_CullPipeline;
+
+        Frustum m_CullFrustum{};
+        glm::vec3 m_CullCameraPosition{0.0f};
+        bool m_CullValid = false;
+        float m_MaxDrawDistance = 0.0f;
 
         std::vector<InstanceBatch> m_Batches;
-        std::vector<InstanceData> m_AllInstances;
-        size_t m_InstanceBufferCapacity = 0;
+        uint32_t m_FramesInFlight = 0;
 
         static constexpr size_t INITIAL_INSTANCE_CAPACITY = 10000;
         static constexpr size_t MAX_INSTANCES = 100000;
+        static constexpr uint32_t MAX_BATCHES = 16;
+        static constexpr uint32_t CULL_WORKGROUP_SIZE = 256;
     };
 
     /**
@@ -42,8 +42,10 @@ namespace Genesis {
         float FogEnd = 200.0f;
     };
 
-    // Maximum lights supported in shader
-    constexpr int MAX_POINT_LIGHTS = 4;
+    // Maximum lights in the global UBO array. Fragments do not iterate all
+    // of them: the renderer bins lights into screen-space clusters and each
+    // fragment shades only its cluster's list.
+    constexpr int MAX_POINT_LIGHTS = 256;
 
     class LightManager {
     public:
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "genesis/renderer/GpuAllocator.h"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+
+namespace Genesis
+{
+
+    class VulkanDevice;
+
+    // Bindless material texture registry: one runtime-sized array of
+    // combined image samplers in a single descriptor set, bound once for
+    // the whole terrain pass and indexed in-shader by the material IDs
+    // MaterialBlender packs into the vertex stream. Adding a material
+    // texture is a Register call that writes one slot (the set uses
+    // update-after-bind, so slots can be filled while earlier frames are
+    // still in flight) - no pipeline, layout, or bind-sequence changes no
+    // matter how many materials artists add.
+    //
+    // Slot 0 always holds a 1x1 white fallback, so shaders can multiply
+    // the sampled texel into the vertex color unconditionally: materials
+    // without a registered texture shade exactly as before.
+    //
+    // Requires the descriptor-indexing features the device enables when
+    // available (see VulkanDevice::SupportsDescriptorIndexing); without
+    // them Init logs a note and IsAvailable() returns false.
+    class MaterialTextureArray
+    {
+    public:
+        // Upper bound on registered textures; sized generously ahead of
+        // the material palette (8 types x albedo/normal leaves headroom)
+        static constexpr uint32_t MAX_TEXTURES = 64;
+
+        MaterialTextureArray() = default;
+        ~MaterialTextureArray();
+
+        void Init(VulkanDevice &device);
+        void Shutdown();
+
+        bool IsAvailable() const { return m_Set != VK_NULL_HANDLE; }
+
+        // Write view/sampler into the next free slot and return its index
+        // (what the material table stores for the shader). Returns 0 - the
+        // white fallback - when the array is unavailable or full.
+        uint32_t Register(VkImageView view, VkSampler sampler);
+
+        VkDescriptorSetLayout GetLayout() const { return m_Layout; }
+        VkDescriptorSet GetDescriptorSet() const { return m_Set; }
+
+    private:
+        void CreateFallbackTexture();
+
+    private:
+        VulkanDevice *m_Device = nullptr;
+
+        VkDescriptorSetLayout m_Layout = VK_NULL_HANDLE;
+        // Private pool: the shared device pools are not created with the
+        // update-after-bind flag this set needs
+        VkDescriptorPool m_Pool = VK_NULL_HANDLE;
+        VkDescriptorSet m_Set = VK_NULL_HANDLE;
+        uint32_t m_NextSlot = 0;
+
+        // 1x1 white fallback occupying slot 0
+        VkImage m_FallbackImage = VK_NULL_HANDLE;
+        GpuAllocation m_FallbackAllocation;
+        VkImageView m_FallbackView = VK_NULL_HANDLE;
+        VkSampler m_FallbackSampler = VK_NULL_HANDLE;
+    };
+
+}
@@ -9,6 +9,7 @@ namespace Genesis {
 
     class VulkanDevice;
     class VulkanBuffer;
+    class IndirectTerrainRenderer;
 
     struct Vertex {
         glm::vec3 Position;
@@ -25,16 +26,59 @@ namespace Genesis {
         }
     };
 
+    // Compact vertex for pooled terrain geometry: 16 bytes against 44 for
+    // Vertex. Chunk-local positions fit three half floats (grid coordinates
+    // are small multiples of the cell size, so shared chunk borders quantize
+    // identically), normals octahedral-encode into two snorm8 channels and
+    // colors into RGBA8; terrain never samples textures, so the UV channel
+    // is dropped. Generation still emits full Vertex data - the terrain pool
+    // packs on upload (see IndirectTerrainRenderer::Allocate).
+    struct TerrainVertex {
+        uint16_t Position[4]; // half3 + pad, VK_FORMAT_R16G16B16A16_SFLOAT
+        int8_t Normal[2];     // Octahedral, VK_FORMAT_R8G8_SNORM
+        uint8_t Color[4];     // VK_FORMAT_R8G8B8A8_UNORM
+        uint8_t Pad[2];
+
+        static std::vector<VkVertexInputBindingDescription> GetBindingDescriptions();
+        static std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions();
+
+        // Quantize one full vertex into the compact format
+        static TerrainVertex Pack(const Vertex& vertex);
+    };
+
+    static_assert(sizeof(TerrainVertex) == 16, "TerrainVertex must stay tightly packed");
+
+    // Where a mesh lives inside the shared terrain mega buffers
+    // (see IndirectTerrainRenderer). Offsets are in elements, not bytes.
+    struct TerrainMeshAllocation {
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        int32_t vertexOffset = 0;
+        uint32_t vertexCount = 0;
+
+        bool IsValid() const { return indexCount > 0; }
+    };
+
     class Mesh {
     public:
         Mesh() = default;
         // CPU-only mesh (for procedural generation before GPU upload)
         Mesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+        Mesh(std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices);
         // GPU-ready mesh
         Mesh(VulkanDevice& device, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
         ~Mesh();
 
         void Init(VulkanDevice& device, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+        // Upload that consumes the CPU data; with retainCpuData=false the
+        // vectors are freed after the GPU buffers are filled (halves peak
+        // memory for streamed meshes that are never read back)
+        void Init(VulkanDevice& device, std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices, bool retainCpuData);
+        // Upload into the shared terrain mega buffers instead of dedicated
+        // per-mesh GPU buffers; the renderer then batches the mesh through
+        // the multi-draw indirect path. Falls back to dedicated buffers if
+        // the pool cannot take the mesh.
+        void Init(VulkanDevice& device, IndirectTerrainRenderer& pool, std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices);
         void Shutdown();
 
         void Bind(VkCommandBuffer commandBuffer) const;
@@ -42,9 +86,31 @@ namespace Genesis {
 
         uint32_t GetVertexCount() const { return m_VertexCount; }
         uint32_t GetIndexCount() const { return m_IndexCount; }
+
+        // Object-space bounds captured at construction; they stay valid
+        // after the CPU copy is released, so culling never needs vertices
+        const glm::vec3& GetBoundsMin() const { return m_BoundsMin; }
+        const glm::vec3& GetBoundsMax() const { return m_BoundsMax; }
+        // Distance from the object-space origin to the farthest AABB
+        // corner: a conservative bounding-sphere radius for cull tests
+        float GetBoundingRadius() const;
+
+        // Resident in the shared terrain buffers (no dedicated GPU buffers;
+        // Bind/Draw must not be called, drawing goes through the batch)
+        bool IsPooled() const { return m_Pool != nullptr; }
+        const TerrainMeshAllocation& GetPoolAllocation() const { return m_PoolAllocation; }
+        // Whether the CPU copy is still resident. Uploads that passed
+        // retainCpuData=false (and pooled meshes) keep only the counts and
+        // bounds; GetVertices/GetIndices return empty vectors for them.
+        bool HasCpuData() const { return !m_Vertices.empty(); }
         const std::vector<Vertex>& GetVertices() const { return m_Vertices; }
         const std::vector<uint32_t>& GetIndices() const { return m_Indices; }
 
+        // Move the CPU-side data out (counts stay valid); used to hand buffers
+        // from a build-time mesh to its GPU twin without copying
+        std::vector<Vertex> TakeVertices() { return std::move(m_Vertices); }
+        std::vector<uint32_t> TakeIndices() { return std::move(m_Indices); }
+
         // Low-poly mesh generators
         static std::unique_ptr<Mesh> CreateCube(VulkanDevice& device, const glm::vec3& color = glm::vec3(1.0f));
         static std::unique_ptr<Mesh> CreatePlane(VulkanDevice& device, float size = 1.0f, const glm::vec3& color = glm::vec3(0.3f, 0.8f, 0.3f));
@@ -52,18 +118,32 @@ namespace Genesis {
         static std::unique_ptr<Mesh> CreateLowPolyTree(VulkanDevice& device);
         static std::unique_ptr<Mesh> CreateLowPolyRock(VulkanDevice& device);
 
+        // Reorder triangles for post-transform vertex cache locality
+        // (Tipsify). Generators emit grid scan order or path order, which
+        // revisits each shared vertex long after it fell out of the cache;
+        // this pass keeps triangles around recently used vertices together.
+        // Only whole triangles move - the index order within each triangle
+        // is preserved, so flat shading keeps its provoking vertices. Run
+        // on generated meshes before upload.
+        static void OptimizeForVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount);
+
     private:
         void CreateVertexBuffer(VulkanDevice& device, const std::vector<Vertex>& vertices);
         void CreateIndexBuffer(VulkanDevice& device, const std::vector<uint32_t>& indices);
+        void CaptureBounds(const std::vector<Vertex>& vertices);
 
     private:
         VulkanDevice* m_Device = nullptr;
+        IndirectTerrainRenderer* m_Pool = nullptr;
+        TerrainMeshAllocation m_PoolAllocation;
         std::unique_ptr<VulkanBuffer> m_VertexBuffer;
         std::unique_ptr<VulkanBuffer> m_IndexBuffer;
         std::vector<Vertex> m_Vertices;
         std::vector<uint32_t> m_Indices;
         uint32_t m_VertexCount = 0;
         uint32_t m_IndexCount = 0;
+        glm::vec3 m_BoundsMin{0.0f};
+        glm::vec3 m_BoundsMax{0.0f};
     };
 
 }
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "genesis/renderer/Mesh.h"
+#include <mutex>
+#include <vector>
+
+namespace Genesis {
+
+    // Pool of reusable vertex/index build buffers for procedural mesh
+    // generation. Generators acquire a buffer pair, append into it (capacity
+    // is retained across uses) and release it once the data has been handed to
+    // a Mesh. This stops chunk streaming from growing and freeing
+    // multi-megabyte vectors per generation and fragmenting the heap.
+    // Thread-safe: generation workers acquire and release concurrently.
+    class MeshArena {
+    public:
+        struct BuildBuffers {
+            std::vector<Vertex> Vertices;
+            std::vector<uint32_t> Indices;
+        };
+
+        static MeshArena& Get();
+
+        BuildBuffers Acquire();
+        void Release(BuildBuffers&& buffers);
+
+    private:
+        // Enough for every generation worker plus the main thread
+        static constexpr size_t MAX_POOLED_BUFFERS = 16;
+
+        std::mutex m_Mutex;
+        std::vector<BuildBuffers> m_FreeBuffers;
+    };
+
+}
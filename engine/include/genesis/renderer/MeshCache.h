@@ -0,0 +1,65 @@
+#pragma once
+
+#include "genesis/renderer/Mesh.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace Genesis {
+
+    class VulkanDevice;
+
+    // Device-scoped cache for the primitive meshes built by the Mesh::Create*
+    // factories. Primitives are keyed by their descriptor (type plus
+    // parameters), built on first request, and handed out as shared immutable
+    // meshes: N callers share one set of GPU buffers, and code that keys
+    // batches on Mesh* (see InstanceBatch) reliably sees one pointer per
+    // primitive. Owned by the Renderer; meshes live until Shutdown.
+    class MeshCache {
+    public:
+        void Init(VulkanDevice& device) { m_Device = &device; }
+        void Shutdown();
+
+        std::shared_ptr<Mesh> GetCube(const glm::vec3& color = glm::vec3(1.0f));
+        std::shared_ptr<Mesh> GetPlane(float size = 1.0f, const glm::vec3& color = glm::vec3(0.3f, 0.8f, 0.3f));
+        std::shared_ptr<Mesh> GetIcosphere(int subdivisions = 1, const glm::vec3& color = glm::vec3(1.0f));
+        std::shared_ptr<Mesh> GetLowPolyTree();
+        std::shared_ptr<Mesh> GetLowPolyRock();
+
+        size_t GetCachedMeshCount() const { return m_Meshes.size(); }
+
+    private:
+        enum class PrimitiveType : uint8_t {
+            Cube,
+            Plane,
+            Icosphere,
+            LowPolyTree,
+            LowPolyRock
+        };
+
+        // Exact parameter match: primitives requested with identical
+        // arguments share a mesh, anything else builds its own
+        struct PrimitiveKey {
+            PrimitiveType type = PrimitiveType::Cube;
+            int subdivisions = 0;
+            float size = 0.0f;
+            glm::vec3 color{0.0f};
+
+            bool operator==(const PrimitiveKey& other) const {
+                return type == other.type && subdivisions == other.subdivisions &&
+                       size == other.size && color == other.color;
+            }
+        };
+
+        struct PrimitiveKeyHash {
+            size_t operator()(const PrimitiveKey& key) const;
+        };
+
+        std::shared_ptr<Mesh> GetOrCreate(const PrimitiveKey& key);
+
+        VulkanDevice* m_Device = nullptr;
+        std::unordered_map<PrimitiveKey, std::shared_ptr<Mesh>, PrimitiveKeyHash> m_Meshes;
+    };
+
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "genesis/renderer/GpuAllocator.h"
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Genesis
+{
+
+    class VulkanDevice;
+    class VulkanBuffer;
+    class VulkanPipeline;
+    class IndirectTerrainRenderer;
+    class Mesh;
+
+    // Pick IDs are caller-defined nonzero 32-bit values; 0 means "nothing
+    // under the cursor". Terrain chunks pack their grid coordinate with the
+    // top bit set so consumers can tell chunks from entities.
+    constexpr uint32_t PICK_ID_CHUNK_BIT = 0x80000000u;
+
+    inline uint32_t PackChunkPickID(int chunkX, int chunkZ)
+    {
+        // 15 bits per axis, biased; covers a +/-16k chunk grid
+        uint32_t x = static_cast<uint32_t>(chunkX + 0x4000) & 0x7FFFu;
+        uint32_t z = static_cast<uint32_t>(chunkZ + 0x4000) & 0x7FFFu;
+        return PICK_ID_CHUNK_BIT | (x << 15) | z;
+    }
+
+    inline void UnpackChunkPickID(uint32_t id, int &chunkX, int &chunkZ)
+    {
+        chunkX = static_cast<int>((id >> 15) & 0x7FFFu) - 0x4000;
+        chunkZ = static_cast<int>(id & 0x7FFFu) - 0x4000;
+    }
+
+    /**
+     * GPU ID-buffer picking for viewport selection.
+     *
+     * Renders the frame's pick-tagged draws into a 1x1 R32_UINT target: the
+     * viewport is the full scene extent offset by the cursor position, so
+     * the one rasterized pixel is exactly the pixel under the cursor. The
+     * result rides the device readback ring and arrives a frame or two
+     * later - picking stays O(1) per click no matter how much geometry the
+     * ray would otherwise have to test, and the CPU never blocks.
+     *
+     * Pooled terrain meshes draw through the shared mega buffers with a
+     * per-draw vkCmdDrawIndexed (the pick pass is one small pixel, so the
+     * indirect batching the main pass needs buys nothing here); everything
+     * else binds its own buffers as usual.
+     */
+    class PickingPass
+    {
+    public:
+        struct PickDraw
+        {
+            const Mesh *MeshPtr = nullptr;
+            glm::mat4 Transform{1.0f};
+            uint32_t ID = 0;
+        };
+
+        PickingPass() = default;
+        ~PickingPass();
+
+        void Init(VulkanDevice &device, VkDescriptorSetLayout globalSetLayout,
+                  VkFormat depthFormat);
+        void Shutdown();
+
+        /**
+         * Records the pick pass and the pixel copy into a readback command
+         * buffer and submits it through the readback ring. cursorX/cursorY
+         * are pixels in the scene view whose extent is viewExtent; the
+         * callback receives the pick ID once the fence signals.
+         *
+         * @param terrainPool Source of the mega buffers pooled draws live in
+         */
+        void Submit(VulkanDevice &device, VkDescriptorSet globalSet,
+                    IndirectTerrainRenderer &terrainPool,
+                    const std::vector<PickDraw> &draws,
+                    uint32_t cursorX, uint32_t cursorY, VkExtent2D viewExtent,
+                    std::function<void(uint32_t id)> callback);
+
+    private:
+        void CreateRenderPass(VkFormat depthFormat);
+        void CreateTarget(VkFormat depthFormat);
+        void CreatePipelines(VkDescriptorSetLayout globalSetLayout);
+
+    private:
+        // Model matrix for the vertex stage, pick ID for the fragment stage
+        struct PushData
+        {
+            glm::mat4 ModelMatrix{1.0f};
+            uint32_t PickID = 0;
+        };
+
+        VulkanDevice *m_Device = nullptr;
+
+        VkRenderPass m_RenderPass = VK_NULL_HANDLE;
+        VkImage m_ColorImage = VK_NULL_HANDLE;
+        VkImageView m_ColorView = VK_NULL_HANDLE;
+        GpuAllocation m_ColorAllocation;
+        VkImage m_DepthImage = VK_NULL_HANDLE;
+        VkImageView m_DepthView = VK_NULL_HANDLE;
+        GpuAllocation m_DepthAllocation;
+        VkFramebuffer m_Framebuffer = VK_NULL_HANDLE;
+
+        // The rendered ID pixel, copied here and then into the readback ring
+        std::unique_ptr<VulkanBuffer> m_PixelBuffer;
+
+        VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+        std::unique_ptr<VulkanPipeline> m_MeshPipeline;
+        std::unique_ptr<VulkanPipeline> m_TerrainPipeline;
+    };
+
+}
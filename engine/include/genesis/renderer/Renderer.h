@@ -1,10 +1,20 @@
 #pragma once
 
+#include "genesis/renderer/DebugFieldAtlas.h"
 #include "genesis/renderer/Light.h"
+#include "genesis/renderer/GpuProfiler.h"
+#include "genesis/renderer/MaterialTextureArray.h"
+#include "genesis/renderer/MeshCache.h"
+#include "genesis/renderer/PickingPass.h"
+#include "genesis/renderer/ShaderHotReload.h"
+#include "genesis/renderer/ShadowMap.h"
+#include "genesis/renderer/UboRing.h"
 #include "genesis/procedural/Water.h"
 #include <glm/glm.hpp>
 #include <vulkan/vulkan.h>
+#include <chrono>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace Genesis
@@ -13,17 +23,33 @@ namespace Genesis
     class VulkanContext;
     class VulkanDevice;
     class VulkanSwapchain;
+    enum class PresentMode;
     class VulkanPipeline;
     class VulkanBuffer;
     class Camera;
     class Mesh;
     class Scene;
+    class IndirectTerrainRenderer;
+    class InstancedRenderer;
+    class ViewportTarget;
+
+    // Resolved GPU time for one named zone (summed across repeats)
+    struct GpuZoneTiming
+    {
+        std::string Name;
+        float Milliseconds = 0.0f;
+    };
 
     struct RenderStats
     {
         uint32_t DrawCalls = 0;
         uint32_t TriangleCount = 0;
         float FrameTime = 0.0f;
+
+        // GPU timings resolved MAX_FRAMES_IN_FLIGHT frames behind the CPU;
+        // GpuTime is the whole-frame "Frame" zone
+        float GpuTime = 0.0f;
+        std::vector<GpuZoneTiming> GpuZones;
     };
 
     // Push constant for model matrix
@@ -40,6 +66,18 @@ namespace Genesis
         glm::vec4 ColorAndRadius{1.0f};       // xyz = color, w = radius
     };
 
+    // Froxel grid for clustered point-light culling: screen-space tiles
+    // subdivided into logarithmic depth slices. Lights are binned on the CPU
+    // each frame; fragments shade only their cluster's index list. The grid
+    // dimensions must match the shaders.
+    constexpr int CLUSTER_GRID_X = 16;
+    constexpr int CLUSTER_GRID_Y = 8;
+    constexpr int CLUSTER_GRID_Z = 8;
+    constexpr int CLUSTER_COUNT = CLUSTER_GRID_X * CLUSTER_GRID_Y * CLUSTER_GRID_Z;
+    constexpr int MAX_LIGHTS_PER_CLUSTER = 8;
+    // Per-cluster record in the storage buffer: light count, then indices
+    constexpr int CLUSTER_STRIDE = MAX_LIGHTS_PER_CLUSTER + 1;
+
     // Uniform buffer for global scene data
     struct GlobalUBO
     {
@@ -60,6 +98,31 @@ namespace Genesis
 
         // Fog
         glm::vec4 FogColorAndDensity{0.7f, 0.8f, 0.9f, 0.0f}; // xyz = color, w = density
+
+        // Clustered lighting: x = depth slice scale, y = depth slice bias,
+        // z = tile width in pixels, w = tile height in pixels
+        glm::vec4 ClusterParams{0.0f};
+
+        // Sun shadow cascades: light-space matrices and split depths
+        // (xyz = cascade far depths, w = shadow distance; 0 = shadows off)
+        glm::mat4 SunCascadeViewProj[ShadowMap::CASCADE_COUNT]{};
+        glm::vec4 CascadeSplits{0.0f};
+
+        // Water animation and appearance, fed from WaterSettings each frame.
+        // All wave motion is vertex-shader displacement driven by these
+        // values, so animating water costs no CPU writes or mesh uploads.
+        // x = time, y = wave height, z = wave speed, w = transparency
+        glm::vec4 WaterParams{0.0f, 0.15f, 1.0f, 0.7f};
+        glm::vec4 WaterShallowColor{0.1f, 0.5f, 0.6f, 0.0f};
+        glm::vec4 WaterDeepColor{0.0f, 0.2f, 0.4f, 0.0f};
+
+        // GPU terrain debug overlay (see DebugFieldAtlas). Switching views
+        // only rewrites these values - no mesh rebuilds.
+        // x = mode (0 = off, 1 = height, 2 = flow, 3 = moisture, 4 = biome),
+        // y = overlay opacity
+        glm::vec4 DebugParams{0.0f, 0.7f, 0.0f, 0.0f};
+        // x = 1 / atlas world period, for toroidal world-to-UV mapping
+        glm::vec4 DebugAtlasParams{0.0f};
     };
 
     class Renderer
@@ -79,21 +142,99 @@ namespace Genesis
         void BeginScene(const Camera &camera);
         void EndScene();
 
-        void Draw(const Mesh &mesh, const glm::mat4 &transform);
+        // Draw calls between BeginScene and EndFrame are queued, not recorded:
+        // EndFrame records the opaque and water stages into secondary command
+        // buffers on worker threads and executes them into the primary render
+        // pass. Submitted meshes must stay alive until EndFrame returns.
+        // A nonzero pickId tags the draw for the ID-buffer pick pass
+        // (see RequestPick); zero leaves it unpickable.
+        void Draw(const Mesh &mesh, const glm::mat4 &transform, uint32_t pickId = 0);
+        // Variant for callers that already hold the normal matrix (e.g. a
+        // TransformComponent's cache); skips the per-submission
+        // inverse-transpose entirely
+        void Draw(const Mesh &mesh, const glm::mat4 &transform, const glm::mat4 &normalMatrix,
+                  uint32_t pickId = 0);
         void DrawWater(const Mesh &mesh, const glm::mat4 &transform);
+        void DrawWater(const Mesh &mesh, const glm::mat4 &transform, const glm::mat4 &normalMatrix);
+        // Draw every persistent instance batch (see GetInstancedRenderer)
+        void DrawInstanced();
         void RenderScene(Scene &scene);
 
         void OnWindowResize(uint32_t width, uint32_t height);
 
+        // Presentation control; switching schedules a swapchain recreation
+        // at the end of the current frame
+        void SetPresentMode(PresentMode mode);
+        PresentMode GetPresentMode() const;
+
+        // Frame pacing: when enabled and presentation is vsynced, BeginFrame
+        // delays the CPU frame start toward the predicted next vsync so the
+        // frame completes just in time instead of queueing early. Cuts
+        // input-to-photon latency without tearing.
+        void SetFramePacing(bool enabled) { m_FramePacingEnabled = enabled; }
+        bool IsFramePacingEnabled() const { return m_FramePacingEnabled; }
+
         VulkanContext &GetContext() { return *m_Context; }
         VulkanDevice &GetDevice() { return *m_Device; }
         VulkanSwapchain &GetSwapchain() { return *m_Swapchain; }
         VkCommandBuffer GetCurrentCommandBuffer() const { return m_CommandBuffers[m_CurrentFrameIndex]; }
+        uint32_t GetCurrentFrameIndex() const { return m_CurrentFrameIndex; }
+
+        // Secondary command buffer the UI stage (ImGui) records into; open
+        // between BeginFrame and EndFrame. The primary buffer cannot take
+        // draws directly once the render pass runs on secondaries.
+        VkCommandBuffer GetUiCommandBuffer() const { return m_UiSecondaries[m_CurrentFrameIndex]; }
 
         // Lighting
         LightManager &GetLightManager() { return m_LightManager; }
         const LightManager &GetLightManager() const { return m_LightManager; }
 
+        // Shared terrain geometry pool and multi-draw indirect batch.
+        // Meshes uploaded through it are batched automatically by Draw.
+        IndirectTerrainRenderer &GetTerrainRenderer() { return *m_TerrainIndirect; }
+
+        // Persistent instance batches for vegetation and props; feed it via
+        // SetInstances when instance lists change and draw with DrawInstanced
+        InstancedRenderer &GetInstancedRenderer() { return *m_InstancedRenderer; }
+
+        // Shared primitive meshes (cubes, trees, rocks, ...), built once per
+        // distinct descriptor and shared between all callers
+        MeshCache &GetMeshCache() { return m_MeshCache; }
+
+        // Cached cascaded sun shadows: terrain renders into a cascade only
+        // when its cache key changes (sun moved, chunks loaded/unloaded,
+        // footprint shifted), so a static scene pays nothing per frame
+        void SetShadowsEnabled(bool enabled) { m_ShadowsEnabled = enabled; }
+        bool AreShadowsEnabled() const { return m_ShadowsEnabled; }
+        ShadowMap &GetShadowMap() { return *m_ShadowMap; }
+
+        // Redirect the scene and water stages into an offscreen target
+        // (editor viewport); the swapchain pass then carries only the UI,
+        // which presents the target through ImGui::Image. The target's
+        // attachments use the swapchain formats, so its render pass is
+        // compatible and the existing pipelines render into it unchanged.
+        // Pass nullptr to draw everything to the swapchain again. The
+        // target must outlive any frame that rendered into it.
+        void SetViewportTarget(ViewportTarget *target) { m_ViewportTarget = target; }
+        ViewportTarget *GetViewportTarget() const { return m_ViewportTarget; }
+
+        // GPU terrain debug overlay: field data lives in the atlas, the
+        // fragment shader selects and colorizes per the mode uniform, so
+        // switching views is instant and allocation-free
+        void SetDebugView(int mode, float opacity)
+        {
+            m_DebugViewMode = mode;
+            m_DebugViewOpacity = opacity;
+        }
+        // World-space size the atlas wraps over; set by the chunk manager
+        // once chunk dimensions are known
+        void SetDebugAtlasWorldSize(float worldSize) { m_DebugAtlasWorldSize = worldSize; }
+        DebugFieldAtlas &GetDebugFieldAtlas() { return m_DebugFieldAtlas; }
+
+        // Bindless material texture registry the terrain pass binds once
+        // (set 2); Register new material textures through this
+        MaterialTextureArray &GetMaterialTextures() { return m_MaterialTextures; }
+
         // Water
         WaterSettings &GetWaterSettings() { return m_WaterSettings; }
         const WaterSettings &GetWaterSettings() const { return m_WaterSettings; }
@@ -103,10 +244,30 @@ namespace Genesis
         const RenderStats &GetStats() const { return m_Stats; }
         void ResetStats();
 
+        // Stage GPU zones ("Terrain", "Water", "Vegetation", "ImGui") are
+        // recorded by the renderer itself around each secondary
+        GpuProfiler &GetGpuProfiler() { return m_GpuProfiler; }
+
+        // GPU ID-buffer picking: renders this frame's pick-tagged draws into
+        // a 1x1 ID target at the cursor and reads the pixel back through the
+        // readback ring, so picking costs O(1) CPU time regardless of scene
+        // size. Coordinates are normalized (0..1) across the scene view -
+        // the viewport target when one is set, the swapchain otherwise. The
+        // result arrives one to two frames later; TryTakePickResult returns
+        // true once and hands over the ID (0 = nothing hit).
+        void RequestPick(float normX, float normY);
+        bool TryTakePickResult(uint32_t &id);
+
+        // Watches registered pipelines' SPIR-V binaries and swaps in rebuilt
+        // pipelines between frames; the renderer's own pipelines are
+        // registered in Init, subsystems may add theirs here too
+        ShaderHotReload &GetShaderHotReload() { return m_ShaderHotReload; }
+
         bool IsFrameInProgress() const { return m_FrameStarted; }
 
     private:
         void CreateCommandBuffers();
+        void CreateSecondaryCommandBuffers();
         void CreateSyncObjects();
         void CreateDescriptorSetLayout();
         void CreatePipelineLayout();
@@ -118,15 +279,64 @@ namespace Genesis
 
         void RecreateSwapchain();
 
+        // Bins the frame's point lights into the froxel grid and writes the
+        // per-cluster index lists into this frame's cluster buffer
+        void UpdateLightClusters(const Camera &camera);
+
+        // Per-stage secondary recording, run from worker threads in EndFrame.
+        // Each writes draw call counts into its own stats so the workers do
+        // not race on m_Stats; the results are merged after the join.
+        void BeginSecondary(VkCommandBuffer cmd, bool toViewportTarget = false);
+        void RecordSceneSecondary(VkCommandBuffer cmd, RenderStats &stats);
+        void RecordWaterSecondary(VkCommandBuffer cmd, RenderStats &stats);
+
     private:
+        // A draw queued during the frame and recorded at EndFrame. SortKey
+        // orders the stage's draw list before recording: the stage split
+        // (terrain pool / scene / water secondaries) already separates
+        // pipelines, so the key packs mesh identity above camera distance
+        // for opaque draws (grouping identical meshes so buffer rebinds are
+        // elided) and inverted distance above mesh for water (back to front
+        // for blending).
+        struct PendingDraw
+        {
+            const Mesh *MeshPtr = nullptr;
+            glm::mat4 Transform{1.0f};
+            // Carried with the draw so record time never computes an inverse
+            glm::mat4 Normal{1.0f};
+            uint64_t SortKey = 0;
+        };
+
         std::unique_ptr<VulkanContext> m_Context;
         std::unique_ptr<VulkanDevice> m_Device;
         std::unique_ptr<VulkanSwapchain> m_Swapchain;
         std::unique_ptr<VulkanPipeline> m_Pipeline;
         std::unique_ptr<VulkanPipeline> m_WaterPipeline;
+        std::unique_ptr<IndirectTerrainRenderer> m_TerrainIndirect;
+        std::unique_ptr<InstancedRenderer> m_InstancedRenderer;
+        std::unique_ptr<ShadowMap> m_ShadowMap;
 
         // Command buffers
         std::vector<VkCommandBuffer> m_CommandBuffers;
+        // Primary buffers the dirty shadow cascades record into, submitted
+        // ahead of the frame's main command buffer
+        std::vector<VkCommandBuffer> m_ShadowCommandBuffers;
+
+        // Secondary command buffers, one set per render stage (scene, water,
+        // UI) so the stages record in parallel. Each stage owns its pool:
+        // command pools are externally synchronized, so a pool per recording
+        // thread is required.
+        VkCommandPool m_ScenePool = VK_NULL_HANDLE;
+        VkCommandPool m_WaterPool = VK_NULL_HANDLE;
+        VkCommandPool m_UiPool = VK_NULL_HANDLE;
+        std::vector<VkCommandBuffer> m_SceneSecondaries;
+        std::vector<VkCommandBuffer> m_WaterSecondaries;
+        std::vector<VkCommandBuffer> m_UiSecondaries;
+
+        // Draws queued between BeginScene and EndFrame
+        std::vector<PendingDraw> m_PendingDraws;
+        std::vector<PendingDraw> m_PendingWaterDraws;
+        bool m_InstancedRequested = false;
 
         // Synchronization
         std::vector<VkSemaphore> m_ImageAvailableSemaphores;
@@ -141,7 +351,23 @@ namespace Genesis
         VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
         VkDescriptorPool m_DescriptorPool = VK_NULL_HANDLE;
         std::vector<VkDescriptorSet> m_DescriptorSets;
-        std::vector<std::unique_ptr<VulkanBuffer>> m_UniformBuffers;
+
+        // Per-frame uniform data lives in persistently mapped rings, one
+        // aligned slice per frame in flight; BeginScene writes straight
+        // into the current slice (see UboRing)
+        UboRing m_GlobalUboRing;
+
+        // Per-cluster light index lists (binding 1); the binning in
+        // UpdateLightClusters fills the mapped slice in place
+        UboRing m_ClusterRing;
+
+        // Frame pacing state: exponential averages of the present interval
+        // and the CPU+queue work time feed the vsync prediction in BeginFrame
+        bool m_FramePacingEnabled = false;
+        std::chrono::steady_clock::time_point m_LastPresentTime{};
+        std::chrono::steady_clock::time_point m_FrameStartTime{};
+        float m_PresentIntervalMs = 0.0f;
+        float m_FrameWorkMs = 0.0f;
 
         // Frame state
         uint32_t m_CurrentFrameIndex = 0;
@@ -158,10 +384,39 @@ namespace Genesis
 
         // Lighting
         LightManager m_LightManager;
+        bool m_ShadowsEnabled = true;
+
+        // Offscreen viewport redirection; m_SceneOffscreen latches the
+        // choice in BeginFrame so a mid-frame SetViewportTarget cannot
+        // desynchronize the pass structure EndFrame closes
+        ViewportTarget *m_ViewportTarget = nullptr;
+        bool m_SceneOffscreen = false;
 
         // Water
         WaterSettings m_WaterSettings;
 
+        MeshCache m_MeshCache;
+
+        // Bindless material textures (see GetMaterialTextures)
+        MaterialTextureArray m_MaterialTextures;
+
+        // GPU debug view overlay
+        DebugFieldAtlas m_DebugFieldAtlas;
+        int m_DebugViewMode = 0;
+        float m_DebugViewOpacity = 0.7f;
+        float m_DebugAtlasWorldSize = 0.0f;
+
+        ShaderHotReload m_ShaderHotReload;
+
+        // ID-buffer picking (see RequestPick)
+        std::unique_ptr<PickingPass> m_PickingPass;
+        std::vector<PickingPass::PickDraw> m_PickDraws;
+        bool m_PickRequested = false;
+        glm::vec2 m_PickCursor{0.0f};
+        bool m_PickResultValid = false;
+        uint32_t m_PickResult = 0;
+
+        GpuProfiler m_GpuProfiler;
         RenderStats m_Stats;
     };
 
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Genesis
+{
+
+    class VulkanPipeline;
+
+    // Polls the SPIR-V binaries behind registered pipelines and rebuilds a
+    // pipeline whenever one of its shaders changes on disk. The rebuild runs
+    // on a JobSystem worker against the device's pipeline cache; Update()
+    // commits the finished pipeline between frames and the old handle is
+    // retired only after every frame in flight has moved past it, so editing
+    // a shader never restarts the editor or stalls the render loop.
+    class ShaderHotReload
+    {
+    public:
+        // Begins watching every shader file the pipeline was created from.
+        // The pipeline must outlive this watcher (or be unregistered first).
+        void Watch(VulkanPipeline *pipeline);
+        void Unwatch(VulkanPipeline *pipeline);
+
+        // Call once per frame, outside any render pass: checks file stamps on
+        // a throttle, kicks rebuild jobs, and swaps in finished pipelines
+        void Update();
+
+    private:
+        // Seconds between directory stats - shader edits are human-paced, so
+        // per-frame polling would be pure filesystem noise
+        static constexpr float POLL_INTERVAL_SECONDS = 0.5f;
+
+        enum class BuildState : int
+        {
+            Running = 0,
+            Succeeded = 1,
+            Failed = 2
+        };
+
+        struct Entry
+        {
+            VulkanPipeline *Pipeline = nullptr;
+            std::vector<std::string> Paths;
+            std::vector<std::filesystem::file_time_type> Stamps;
+            // Shared with the worker job; null when no build is in flight
+            std::shared_ptr<std::atomic<int>> Build;
+        };
+
+        std::vector<Entry> m_Entries;
+        std::chrono::steady_clock::time_point m_LastPoll{};
+    };
+
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "genesis/renderer/GpuAllocator.h"
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+#include <array>
+#include <cstdint>
+
+namespace Genesis
+{
+
+    class VulkanDevice;
+    class Camera;
+
+    /**
+     * Cascaded shadow maps for the sun, with a static-geometry cache.
+     *
+     * Three cascades cover the view frustum out to the shadow distance,
+     * each a depth-only render of the terrain from the sun's direction
+     * into one layer of a D32 array image. The terrain is static between
+     * chunk loads and the sun rarely moves, so a cascade is re-rendered
+     * only when its cache key changes: the sun swung past an angular
+     * threshold, chunk geometry was added or removed, or the cascade's
+     * texel-snapped footprint shifted under camera movement. With a
+     * stationary sun and camera the per-frame shadow cost is zero - the
+     * cached depth layers simply keep being sampled.
+     */
+    class ShadowMap
+    {
+    public:
+        static constexpr int CASCADE_COUNT = 3;
+        static constexpr uint32_t RESOLUTION = 2048;
+
+        void Init(VulkanDevice &device);
+        void Shutdown();
+
+        /**
+         * Place the cascades for this frame's camera and sun. A cascade
+         * only adopts a new light matrix - and becomes dirty - when its
+         * cache key actually changed; otherwise the matrix that the cached
+         * depth was rendered with stays in effect, so sampling and cached
+         * content never disagree.
+         *
+         * @param staticGeometryVersion Bumped by the caller whenever shadow
+         *                              casting geometry changes
+         */
+        void UpdateCascades(const Camera &camera, const glm::vec3 &sunDirection,
+                            uint64_t staticGeometryVersion);
+
+        bool HasDirtyCascades() const;
+        bool IsCascadeDirty(int cascade) const { return m_Cascades[cascade].Dirty; }
+        void MarkCascadeClean(int cascade) { m_Cascades[cascade].Dirty = false; }
+
+        // Force every cascade to re-render on its next frame
+        void InvalidateAll();
+
+        const glm::mat4 &GetCascadeViewProj(int cascade) const { return m_Cascades[cascade].ViewProj; }
+
+        // View-space depth where this cascade hands over to the next
+        float GetCascadeSplit(int cascade) const { return m_Cascades[cascade].SplitDepth; }
+
+        // Furthest view-space depth that receives shadows
+        float GetShadowDistance() const { return m_ShadowDistance; }
+        void SetShadowDistance(float distance);
+
+        VkRenderPass GetRenderPass() const { return m_RenderPass; }
+        VkFramebuffer GetFramebuffer(int cascade) const { return m_Cascades[cascade].Framebuffer; }
+        VkExtent2D GetExtent() const { return {RESOLUTION, RESOLUTION}; }
+
+        // Array view over all cascade layers plus the comparison sampler,
+        // for binding as a sampler2DArrayShadow
+        VkImageView GetImageView() const { return m_ArrayView; }
+        VkSampler GetSampler() const { return m_Sampler; }
+
+    private:
+        struct Cascade
+        {
+            glm::mat4 ViewProj{1.0f};
+            float SplitDepth = 0.0f;
+            // Cache key: the texel-snapped light-space footprint the cached
+            // depth was rendered with
+            glm::vec2 SnappedOrigin{0.0f};
+            float Radius = 0.0f;
+            bool Dirty = true;
+            VkImageView LayerView = VK_NULL_HANDLE;
+            VkFramebuffer Framebuffer = VK_NULL_HANDLE;
+        };
+
+        void CreateRenderPass();
+        void CreateImage();
+        void CreateFramebuffers();
+        void CreateSampler();
+
+        VulkanDevice *m_Device = nullptr;
+
+        VkRenderPass m_RenderPass = VK_NULL_HANDLE;
+        VkImage m_Image = VK_NULL_HANDLE;
+        GpuAllocation m_ImageAllocation;
+        VkImageView m_ArrayView = VK_NULL_HANDLE;
+        VkSampler m_Sampler = VK_NULL_HANDLE;
+
+        std::array<Cascade, CASCADE_COUNT> m_Cascades;
+
+        // Everything re-renders when the sun swings past ~0.25 degrees;
+        // below that the cached depth is visually indistinguishable
+        static constexpr float SUN_DOT_THRESHOLD = 0.99999f;
+
+        // Pull the light's near plane back this far so casters between the
+        // light and the frustum slice (tall terrain uphill) still land in
+        // the map
+        static constexpr float CASTER_MARGIN = 60.0f;
+
+        glm::vec3 m_CachedSunDirection{0.0f};
+        uint64_t m_CachedGeometryVersion = UINT64_MAX;
+        float m_ShadowDistance = 160.0f;
+    };
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "genesis/renderer/VulkanBuffer.h"
+
+#include <vulkan/vulkan.h>
+
+namespace Genesis {
+
+    class VulkanDevice;
+
+    // One persistently mapped host-visible buffer carved into equally
+    // sized per-frame slices, aligned to the device's offset alignment
+    // for the given usage. Each frame's descriptor points at its slice,
+    // so per-frame uniform data is written straight into mapped memory:
+    // no map/unmap traffic and one allocation covering every frame in
+    // flight. A slice may only be written while its frame's fence
+    // guarantees the GPU is done reading it - the renderer's frame loop
+    // already provides that.
+    class UboRing {
+    public:
+        void Init(VulkanDevice& device, VkDeviceSize sliceSize, uint32_t sliceCount,
+                  VkBufferUsageFlags usage);
+        void Shutdown();
+
+        // CPU address of a slice; stable for the ring's whole lifetime
+        void* SliceMapped(uint32_t slice) const;
+
+        // Byte offset of a slice inside the buffer (for descriptor writes)
+        VkDeviceSize SliceOffset(uint32_t slice) const { return slice * m_AlignedSliceSize; }
+
+        // The requested slice size - the descriptor range, not the
+        // alignment-padded stride
+        VkDeviceSize GetSliceSize() const { return m_SliceSize; }
+
+        VkBuffer GetBuffer() const { return m_Buffer.GetBuffer(); }
+
+    private:
+        VulkanBuffer m_Buffer;
+        VkDeviceSize m_SliceSize = 0;
+        VkDeviceSize m_AlignedSliceSize = 0;
+    };
+
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "genesis/renderer/GpuAllocator.h"
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+
+namespace Genesis
+{
+
+    class VulkanDevice;
+
+    /**
+     * Offscreen scene render target for an editor viewport.
+     *
+     * Color and depth attachments use the swapchain's formats, which makes
+     * the render pass Vulkan render-pass-compatible with the swapchain
+     * pass: every scene pipeline and secondary command buffer recorded
+     * against the swapchain pass works here unchanged. The color image is
+     * also sampled - the pass's finalLayout hands it to the fragment stage
+     * with an external dependency, and an ImGui descriptor set lets panels
+     * present it with ImGui::Image.
+     *
+     * Resize recreates the attachments at a new extent, which is how
+     * dynamic resolution scaling works: the displayed quad stays
+     * panel-sized and the linear sampler upscales a smaller render.
+     */
+    class ViewportTarget
+    {
+    public:
+        ~ViewportTarget();
+
+        void Init(VulkanDevice &device, VkFormat colorFormat, VkFormat depthFormat,
+                  uint32_t width, uint32_t height);
+        void Shutdown();
+
+        // Recreate the attachments at a new extent. Waits for the device
+        // to go idle, so callers should debounce (see ViewportPanel).
+        void Resize(uint32_t width, uint32_t height);
+
+        VkRenderPass GetRenderPass() const { return m_RenderPass; }
+        VkFramebuffer GetFramebuffer() const { return m_Framebuffer; }
+        VkExtent2D GetExtent() const { return {m_Width, m_Height}; }
+
+        // Descriptor for ImGui::Image presentation
+        VkDescriptorSet GetImGuiDescriptor() const { return m_ImGuiDescriptor; }
+
+        bool IsValid() const { return m_Framebuffer != VK_NULL_HANDLE; }
+
+    private:
+        void CreateRenderPass();
+        void CreateAttachments();
+        void DestroyAttachments();
+
+        VulkanDevice *m_Device = nullptr;
+        VkFormat m_ColorFormat = VK_FORMAT_UNDEFINED;
+        VkFormat m_DepthFormat = VK_FORMAT_UNDEFINED;
+        uint32_t m_Width = 0;
+        uint32_t m_Height = 0;
+
+        VkRenderPass m_RenderPass = VK_NULL_HANDLE;
+
+        VkImage m_ColorImage = VK_NULL_HANDLE;
+        GpuAllocation m_ColorAllocation;
+        VkImageView m_ColorView = VK_NULL_HANDLE;
+
+        VkImage m_DepthImage = VK_NULL_HANDLE;
+        GpuAllocation m_DepthAllocation;
+        VkImageView m_DepthView = VK_NULL_HANDLE;
+
+        VkFramebuffer m_Framebuffer = VK_NULL_HANDLE;
+        VkSampler m_Sampler = VK_NULL_HANDLE;
+        VkDescriptorSet m_ImGuiDescriptor = VK_NULL_HANDLE;
+    };
+
+}
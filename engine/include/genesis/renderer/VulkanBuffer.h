@@ -1,5 +1,7 @@
 #pragma once
 
+#include "genesis/renderer/GpuAllocator.h"
+
 #include <vulkan/vulkan.h>
 
 namespace Genesis {
@@ -22,7 +24,7 @@ namespace Genesis {
         void Flush(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
 
         VkBuffer GetBuffer() const { return m_Buffer; }
-        VkDeviceMemory GetMemory() const { return m_Memory; }
+        VkDeviceMemory GetMemory() const { return m_Allocation.Memory; }
         void* GetMappedMemory() const { return m_Mapped; }
         VkDeviceSize GetSize() const { return m_Size; }
 
@@ -35,7 +37,7 @@ namespace Genesis {
     private:
         VulkanDevice* m_Device = nullptr;
         VkBuffer m_Buffer = VK_NULL_HANDLE;
-        VkDeviceMemory m_Memory = VK_NULL_HANDLE;
+        GpuAllocation m_Allocation;
         void* m_Mapped = nullptr;
         VkDeviceSize m_Size = 0;
     };
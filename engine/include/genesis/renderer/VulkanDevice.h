@@ -1,14 +1,30 @@
 #pragma once
 
+#include "genesis/renderer/GpuAllocator.h"
+
 #include <vulkan/vulkan.h>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <optional>
 
 namespace Genesis {
 
+    class VulkanBuffer;
+
     struct QueueFamilyIndices {
         std::optional<uint32_t> GraphicsFamily;
         std::optional<uint32_t> PresentFamily;
+        // Dedicated transfer-only family (typically the GPU's DMA engine);
+        // falls back to the graphics family when none exists
+        std::optional<uint32_t> TransferFamily;
+        // Compute-capable family without graphics, so generation dispatches
+        // overlap rendering instead of serializing with it; falls back to
+        // the graphics family when none exists
+        std::optional<uint32_t> ComputeFamily;
 
         bool IsComplete() const {
             return GraphicsFamily.has_value() && PresentFamily.has_value();
@@ -33,20 +49,153 @@ namespace Genesis {
         VkPhysicalDevice GetPhysicalDevice() const { return m_PhysicalDevice; }
         VkQueue GetGraphicsQueue() const { return m_GraphicsQueue; }
         VkQueue GetPresentQueue() const { return m_PresentQueue; }
+        VkQueue GetTransferQueue() const { return m_TransferQueue; }
+        VkQueue GetComputeQueue() const { return m_ComputeQueue; }
         VkCommandPool GetCommandPool() const { return m_CommandPool; }
 
+        // Disk-backed pipeline cache shared by every pipeline creation.
+        // Loaded in Init and persisted in Shutdown so relaunches skip the
+        // driver's shader compilation; internally synchronized, so pipelines
+        // may be created from several threads at once.
+        VkPipelineCache GetPipelineCache() const { return m_PipelineCache; }
+
+        // Whether transfers run on their own queue family, concurrently with
+        // graphics work, rather than sharing the graphics queue
+        bool HasDedicatedTransferQueue() const {
+            return m_QueueFamilies.TransferFamily != m_QueueFamilies.GraphicsFamily;
+        }
+
+        // Whether generation compute runs on its own queue family,
+        // overlapping graphics work, rather than sharing the graphics queue
+        bool HasDedicatedComputeQueue() const {
+            return m_QueueFamilies.ComputeFamily != m_QueueFamilies.GraphicsFamily;
+        }
+
         const QueueFamilyIndices& GetQueueFamilies() const { return m_QueueFamilies; }
         SwapchainSupportDetails QuerySwapchainSupport() const;
 
+        // Block-based device memory allocator all buffers and textures
+        // sub-allocate from instead of calling vkAllocateMemory per resource
+        GpuAllocator& GetAllocator() { return m_Allocator; }
+
         void WaitIdle() const;
 
         VkCommandBuffer BeginSingleTimeCommands();
         void EndSingleTimeCommands(VkCommandBuffer commandBuffer);
 
+        // Single-shot command buffer on the async compute queue for
+        // generation dispatches (heightfield, erosion). Unlike the
+        // single-time helpers this waits on a fence for just this
+        // submission - never on rendering - and it holds an internal lock
+        // from Begin to End, since chunk workers dispatch concurrently.
+        // Falls back to the graphics queue when no dedicated compute
+        // family exists.
+        VkCommandBuffer BeginComputeCommands();
+        void EndComputeCommands(VkCommandBuffer commandBuffer);
+
+        // Persistent staging ring for buffer uploads. StageToBuffer copies
+        // data into a reusable host-visible ring and records a transfer to the
+        // destination buffer. Between BeginTransferBatch/EndTransferBatch all
+        // transfers are recorded into a single command buffer and submitted
+        // once to the transfer queue; outside a batch each call submits
+        // immediately and waits (but still reuses the ring instead of
+        // allocating a one-off staging buffer).
+        //
+        // EndTransferBatch does NOT wait: it returns a ticket that completes
+        // asynchronously while the caller keeps running. Poll it with
+        // IsTransferComplete before letting the GPU read the destination
+        // buffers; a ticket of 0 means nothing was submitted.
+        void BeginTransferBatch();
+        uint64_t EndTransferBatch();
+        void StageToBuffer(const void* data, VkDeviceSize size, VkBuffer dstBuffer,
+                           VkDeviceSize dstOffset = 0);
+
+        // Polls in-flight transfer fences (reclaiming finished command
+        // buffers) and reports whether the given ticket has completed
+        bool IsTransferComplete(uint64_t ticket);
+
+        // Blocks until every submitted transfer has completed
+        void WaitForTransfers();
+
+        // Asynchronous GPU-to-CPU readback: the staging ring in reverse.
+        // SubmitReadback appends a copy of the source range into a slice of a
+        // host-visible readback ring to a command buffer the caller has been
+        // recording into (BeginReadbackCommands hands out a fresh one, so
+        // compute passes can put their dispatch and the copy in the same
+        // submission), then submits on the graphics queue behind a fence.
+        //
+        // Nothing blocks: PollReadbacks - called once per frame by the
+        // renderer - runs each request's callback with the mapped slice once
+        // its fence has signalled, typically one to two frames after
+        // submission. Requests larger than the ring get a one-off buffer
+        // that lives with the request.
+        //
+        // Like the transfer batch API this is not internally synchronized;
+        // submit and poll from the thread that owns rendering.
+        // Passing onComputeQueue records and submits on the async compute
+        // queue instead, so a dispatch-plus-copy request never serializes
+        // with rendering; ignored when no dedicated compute family exists.
+        // The same flag must be given to both calls of a request.
+        using ReadbackCallback = std::function<void(const void* data, VkDeviceSize size)>;
+        VkCommandBuffer BeginReadbackCommands(bool onComputeQueue = false);
+        uint64_t SubmitReadback(VkCommandBuffer commandBuffer, VkBuffer srcBuffer,
+                                VkDeviceSize srcOffset, VkDeviceSize size,
+                                ReadbackCallback callback, bool onComputeQueue = false);
+
+        // Convenience wrapper when no extra commands precede the copy
+        uint64_t RequestReadback(VkBuffer srcBuffer, VkDeviceSize srcOffset,
+                                 VkDeviceSize size, ReadbackCallback callback);
+
+        // Retires every finished readback, invoking its callback
+        void PollReadbacks();
+
+        // Polls, then reports whether the given ticket has completed
+        bool IsReadbackComplete(uint64_t ticket);
+
+        // Blocks until every submitted readback has completed (callbacks
+        // still run); used on shutdown
+        void WaitForReadbacks();
+
+        // Pooled descriptor set allocation shared by every subsystem, so
+        // single-purpose sets stop creating their own one-set pools. Pools
+        // grow on demand: when the current one runs out a new one is added
+        // and the allocation retried. Sets live until Shutdown - there is
+        // no per-set free, matching how the engine uses them.
+        //
+        // GetCachedImageDescriptor additionally caches single-image sets by
+        // (layout, sampler, view): repeated requests for the same texture -
+        // chunk streaming re-registering a regenerated heightmap preview,
+        // for instance - return the existing set with no allocation or
+        // descriptor write. Like the transfer API this is not internally
+        // synchronized; allocate from the thread that owns rendering.
+        VkDescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout layout);
+        VkDescriptorSet GetCachedImageDescriptor(VkDescriptorSetLayout layout,
+                                                 VkSampler sampler, VkImageView view,
+                                                 VkImageLayout imageLayout =
+                                                     VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        // Whether one indirect call may cover several draws
+        // (vkCmdDrawIndexedIndirect with drawCount > 1)
+        bool SupportsMultiDrawIndirect() const { return m_MultiDrawIndirect; }
+
+        // Whether the descriptor-indexing feature set behind the bindless
+        // material texture array (runtime-sized, partially bound,
+        // update-after-bind sampler arrays) was enabled at device creation
+        bool SupportsDescriptorIndexing() const { return m_DescriptorIndexing; }
+
     private:
         void PickPhysicalDevice(VkInstance instance, VkSurfaceKHR surface);
         void CreateLogicalDevice(VkSurfaceKHR surface);
         void CreateCommandPool();
+        VkDescriptorPool GrowDescriptorPool();
+        void LoadPipelineCache();
+        void SavePipelineCache();
+
+        VkCommandBuffer BeginTransferCommands();
+        uint64_t SubmitTransferCommands(VkCommandBuffer commandBuffer);
+        void RetireTransfer();
+        void RetireReadback();
+        VkDeviceSize AllocateReadbackSlice(VkDeviceSize size);
 
         bool IsDeviceSuitable(VkPhysicalDevice device, VkSurfaceKHR surface);
         QueueFamilyIndices FindQueueFamilies(VkPhysicalDevice device, VkSurfaceKHR surface);
@@ -58,10 +207,85 @@ namespace Genesis {
         VkDevice m_Device = VK_NULL_HANDLE;
         VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
         VkQueue m_PresentQueue = VK_NULL_HANDLE;
+        VkQueue m_TransferQueue = VK_NULL_HANDLE;
+        VkQueue m_ComputeQueue = VK_NULL_HANDLE;
         VkCommandPool m_CommandPool = VK_NULL_HANDLE;
+        VkCommandPool m_TransferCommandPool = VK_NULL_HANDLE;
+        VkCommandPool m_ComputeCommandPool = VK_NULL_HANDLE;
+        // Serializes compute-queue command recording and submission across
+        // chunk worker threads (held from BeginComputeCommands to
+        // EndComputeCommands; command pools are externally synchronized).
+        // Recursive because SubmitReadback may retire an earlier
+        // compute-queue readback - freeing from the compute pool - while
+        // the calling thread already holds the lock for its own recording.
+        std::recursive_mutex m_ComputeMutex;
+        VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
         VkSurfaceKHR m_Surface = VK_NULL_HANDLE;
 
         QueueFamilyIndices m_QueueFamilies;
+        GpuAllocator m_Allocator;
+        bool m_MultiDrawIndirect = false;
+        bool m_DescriptorIndexing = false;
+
+        // Shared descriptor pools (see AllocateDescriptorSet); the cache
+        // key packs layout, sampler and view handles
+        struct ImageDescriptorKey {
+            VkDescriptorSetLayout Layout;
+            VkSampler Sampler;
+            VkImageView View;
+
+            bool operator==(const ImageDescriptorKey& other) const {
+                return Layout == other.Layout && Sampler == other.Sampler && View == other.View;
+            }
+        };
+        struct ImageDescriptorKeyHash {
+            size_t operator()(const ImageDescriptorKey& key) const;
+        };
+        std::vector<VkDescriptorPool> m_DescriptorPools;
+        std::unordered_map<ImageDescriptorKey, VkDescriptorSet, ImageDescriptorKeyHash>
+            m_ImageDescriptorCache;
+
+        // Staging ring state (see BeginTransferBatch/StageToBuffer)
+        static constexpr VkDeviceSize STAGING_RING_SIZE = 32 * 1024 * 1024;
+        std::unique_ptr<VulkanBuffer> m_StagingRing;
+        VkDeviceSize m_StagingHead = 0;
+        VkCommandBuffer m_TransferCommands = VK_NULL_HANDLE;
+        bool m_TransferBatchOpen = false;
+
+        // Submitted-but-unfinished transfer batches, oldest first. Fences on
+        // one queue signal in submission order, so tracking the last retired
+        // ticket is enough to answer completion queries for earlier ones.
+        struct InFlightTransfer {
+            uint64_t Ticket = 0;
+            VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+            VkFence Fence = VK_NULL_HANDLE;
+        };
+        std::deque<InFlightTransfer> m_InFlightTransfers;
+        uint64_t m_NextTransferTicket = 1;
+        uint64_t m_LastCompletedTicket = 0;
+
+        // Readback ring state (see SubmitReadback). Slices are allocated at
+        // the head and reclaimed oldest-first as fences signal; a collision
+        // with a live slice stalls the submitter, never corrupts data.
+        static constexpr VkDeviceSize READBACK_RING_SIZE = 16 * 1024 * 1024;
+        std::unique_ptr<VulkanBuffer> m_ReadbackRing;
+        VkDeviceSize m_ReadbackHead = 0;
+
+        struct InFlightReadback {
+            uint64_t Ticket = 0;
+            VkCommandBuffer CommandBuffer = VK_NULL_HANDLE;
+            // Pool the command buffer came from (graphics or compute)
+            VkCommandPool Pool = VK_NULL_HANDLE;
+            VkFence Fence = VK_NULL_HANDLE;
+            VkDeviceSize Offset = 0;
+            VkDeviceSize Size = 0;
+            // Oversized requests bypass the ring with a dedicated buffer
+            std::unique_ptr<VulkanBuffer> OwnBuffer;
+            ReadbackCallback Callback;
+        };
+        std::deque<InFlightReadback> m_InFlightReadbacks;
+        uint64_t m_NextReadbackTicket = 1;
+        uint64_t m_LastCompletedReadback = 0;
 
         const std::vector<const char*> m_DeviceExtensions = {
             VK_KHR_SWAPCHAIN_EXTENSION_NAME
@@ -18,6 +18,10 @@ namespace Genesis {
         VkPipelineDepthStencilStateCreateInfo DepthStencilState{};
         std::vector<VkDynamicState> DynamicStates;
         VkPipelineDynamicStateCreateInfo DynamicStateInfo{};
+        // Optional vertex input override; when left empty the standard Mesh
+        // Vertex bindings and attributes are used
+        std::vector<VkVertexInputBindingDescription> VertexBindings;
+        std::vector<VkVertexInputAttributeDescription> VertexAttributes;
         VkPipelineLayout PipelineLayout = VK_NULL_HANDLE;
         VkRenderPass RenderPass = VK_NULL_HANDLE;
         uint32_t Subpass = 0;
@@ -30,6 +34,12 @@ namespace Genesis {
 
         void Init(VulkanDevice& device, const std::string& vertPath, const std::string& fragPath,
                   const PipelineConfig& config);
+        // Vertex-only variant for depth pre-passes: no fragment stage, pair
+        // with DepthOnlyPipelineConfig so color writes are off
+        void InitDepthOnly(VulkanDevice& device, const std::string& vertPath,
+                           const PipelineConfig& config);
+        // Compute variant - only needs a shader and a layout, no fixed-function state
+        void InitCompute(VulkanDevice& device, const std::string& compPath, VkPipelineLayout layout);
         void Shutdown();
 
         void Bind(VkCommandBuffer commandBuffer);
@@ -37,19 +47,67 @@ namespace Genesis {
         VkPipeline GetPipeline() const { return m_Pipeline; }
         VkPipelineLayout GetLayout() const { return m_PipelineLayout; }
 
+        // Hot reload (see ShaderHotReload). Init stores its creation
+        // parameters, so a replacement VkPipeline can be built from the
+        // on-disk shaders at any time - including on a worker thread,
+        // since pipeline creation is thread-safe. CommitReplacement swaps
+        // the new handle in between frames; the old one is parked and
+        // destroyed by TickRetirement once no frame in flight can still
+        // reference it.
+        std::vector<std::string> GetShaderPaths() const;
+        bool BuildReplacement();
+        bool HasReplacementReady() const { return m_ReplacementReady; }
+        void CommitReplacement(int retireAfterFrames);
+        void TickRetirement();
+
         static void DefaultPipelineConfig(PipelineConfig& config);
         static void TransparentPipelineConfig(PipelineConfig& config);
+        // Depth writes only: color writes masked out, for depth pre-passes
+        static void DepthOnlyPipelineConfig(PipelineConfig& config);
+        // Depth-only into a color-less shadow render pass: depth bias on,
+        // culling off, zero color blend attachments
+        static void ShadowPipelineConfig(PipelineConfig& config);
 
     private:
         std::vector<char> ReadFile(const std::string& filepath);
         VkShaderModule CreateShaderModule(const std::vector<char>& code);
+        VkPipeline CreateGraphicsPipeline(VkShaderModule vertModule, VkShaderModule fragModule);
+        VkPipeline CreateComputePipeline(VkShaderModule compModule);
 
     private:
+        enum class Kind { None, Graphics, DepthOnly, Compute };
+
+        // A pipeline (and its modules) that has been replaced but may still
+        // be referenced by a frame in flight; destroyed once FramesLeft
+        // reaches zero
+        struct RetiredPipeline {
+            VkPipeline Pipeline = VK_NULL_HANDLE;
+            VkShaderModule VertModule = VK_NULL_HANDLE;
+            VkShaderModule FragModule = VK_NULL_HANDLE;
+            VkShaderModule CompModule = VK_NULL_HANDLE;
+            int FramesLeft = 0;
+        };
+
         VulkanDevice* m_Device = nullptr;
         VkPipeline m_Pipeline = VK_NULL_HANDLE;
         VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
         VkShaderModule m_VertShaderModule = VK_NULL_HANDLE;
         VkShaderModule m_FragShaderModule = VK_NULL_HANDLE;
+        VkShaderModule m_CompShaderModule = VK_NULL_HANDLE;
+        VkPipelineBindPoint m_BindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+
+        // Creation parameters retained for BuildReplacement. The copied
+        // config's internal pointers (pAttachments, pDynamicStates) dangle
+        // and are re-pointed at the copy's own members before use.
+        Kind m_Kind = Kind::None;
+        std::string m_VertPath;
+        std::string m_FragPath;
+        std::string m_CompPath;
+        PipelineConfig m_Config;
+
+        RetiredPipeline m_Replacement;
+        bool m_ReplacementReady = false;
+        std::vector<RetiredPipeline> m_Retired;
     };
 
 }
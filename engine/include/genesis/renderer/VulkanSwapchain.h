@@ -7,6 +7,14 @@ namespace Genesis {
 
     class VulkanDevice;
 
+    // Preferred presentation mode. Fifo is always available; the others fall
+    // back (Immediate -> Mailbox -> Fifo) when the surface lacks them.
+    enum class PresentMode {
+        Fifo,      // vsync, no tearing, highest latency
+        Mailbox,   // vsync, no tearing, newest-frame replacement
+        Immediate  // no vsync, tearing possible, lowest latency
+    };
+
     class VulkanSwapchain {
     public:
         VulkanSwapchain() = default;
@@ -14,10 +22,18 @@ namespace Genesis {
 
         void Init(VulkanDevice& device, VkSurfaceKHR surface, uint32_t width, uint32_t height);
         void Shutdown();
+
+        // Minimal-recreation resize path: the retiring swapchain is handed
+        // to the driver as oldSwapchain so its images can be reused, and
+        // only the size-dependent pieces (views, depth buffer, framebuffers)
+        // are rebuilt. The render pass survives unless the surface format
+        // changed, so pipelines - which use dynamic viewport/scissor - are
+        // never touched by a resize.
         void Recreate(uint32_t width, uint32_t height);
 
         VkSwapchainKHR GetSwapchain() const { return m_Swapchain; }
         VkFormat GetImageFormat() const { return m_ImageFormat; }
+        VkFormat GetDepthFormat() { return FindDepthFormat(); }
         VkExtent2D GetExtent() const { return m_Extent; }
         VkRenderPass GetRenderPass() const { return m_RenderPass; }
         
@@ -27,6 +43,13 @@ namespace Genesis {
         VkResult AcquireNextImage(VkSemaphore semaphore, uint32_t* imageIndex);
         VkResult Present(VkQueue queue, VkSemaphore waitSemaphore, uint32_t imageIndex);
 
+        // Takes effect on the next Recreate; use Renderer::SetPresentMode
+        // for runtime switching, which schedules the recreation
+        void SetPreferredPresentMode(PresentMode mode) { m_PreferredMode = mode; }
+        PresentMode GetPreferredPresentMode() const { return m_PreferredMode; }
+        // The mode the current swapchain was actually created with
+        VkPresentModeKHR GetActivePresentMode() const { return m_ActivePresentMode; }
+
         static constexpr int MAX_FRAMES_IN_FLIGHT = 2;
 
     private:
@@ -36,6 +59,9 @@ namespace Genesis {
         void CreateDepthResources();
         void CreateFramebuffers();
         void Cleanup();
+        // Destroys only what a resize invalidates; the swapchain handle and
+        // render pass are left for CreateSwapchain/Recreate to deal with
+        void CleanupSizeDependent();
 
         VkSurfaceFormatKHR ChooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& formats);
         VkPresentModeKHR ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& modes);
@@ -50,6 +76,9 @@ namespace Genesis {
         VkFormat m_ImageFormat;
         VkExtent2D m_Extent;
 
+        PresentMode m_PreferredMode = PresentMode::Mailbox;
+        VkPresentModeKHR m_ActivePresentMode = VK_PRESENT_MODE_FIFO_KHR;
+
         std::vector<VkImage> m_Images;
         std::vector<VkImageView> m_ImageViews;
         std::vector<VkFramebuffer> m_Framebuffers;
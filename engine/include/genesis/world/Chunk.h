@@ -12,7 +12,11 @@
 #include "genesis/procedural/BiomeClassifier.h"
 #include "genesis/procedural/LakeMeshGenerator.h"
 #include "genesis/procedural/RiverMeshGenerator.h"
+#include "genesis/renderer/InstancedRenderer.h"
+#include "genesis/world/GenerationCoroutine.h"
+#include "genesis/world/HeightQuadtree.h"
 #include <glm/glm.hpp>
+#include <array>
 #include <memory>
 
 namespace Genesis
@@ -26,20 +30,53 @@ namespace Genesis
         Unloading
     };
 
+    // Hydrology detail tiers. Coarse runs the same drainage/river/lake
+    // pipeline on a quarter-resolution heightmap (~1/16 the cost), enough
+    // for distant water to be visible; Full is the per-cell pipeline.
+    enum class HydrologyLod
+    {
+        None,
+        Coarse,
+        Full
+    };
+
     class VulkanDevice;
 
     class Chunk
     {
     public:
+        // LOD pyramid levels; level N samples every (1 << N) cells, so a 128-cell
+        // chunk produces 128/64/32/16-cell meshes
+        static constexpr int LOD_COUNT = 4;
+
+        // Heightmap downsample factor for HydrologyLod::Coarse
+        static constexpr int COARSE_HYDROLOGY_DIVISOR = 4;
+
         Chunk(int x, int z, int size, float cellSize);
         ~Chunk();
 
         // Generate terrain for this chunk
-        // Set computeHydrology=false for distant chunks to skip expensive water calculations
-        void Generate(const TerrainSettings &settings, uint32_t worldSeed, float seaLevel = 0.0f, bool computeHydrology = true);
+        // Use HydrologyLod::Coarse or None for distant chunks to reduce or skip water calculations
+        // Optional borders reuse raw edge samples from already-generated neighbors
+        void Generate(const TerrainSettings &settings, uint32_t worldSeed, float seaLevel = 0.0f, HydrologyLod hydrologyLod = HydrologyLod::Full, const HeightmapBorders *borders = nullptr);
+
+        // The same pipeline as Generate, staged: co_yields at every phase
+        // boundary (heightmap, each hydrology step, climate, per-LOD
+        // meshing, water meshes, objects) so the caller can interleave or
+        // park generation between stages. settings is taken by value and
+        // borders must stay valid until the coroutine finishes - both
+        // outlive any suspension that way.
+        GenerationCoroutine GenerateStaged(TerrainSettings settings, uint32_t worldSeed, float seaLevel, HydrologyLod hydrologyLod, const HeightmapBorders *borders);
 
-        // Upload mesh to GPU
-        void Upload(VulkanDevice &device);
+        // Upload mesh to GPU. Terrain LOD meshes go into the shared indirect
+        // pool when one is provided; lake and river meshes keep dedicated buffers.
+        // Copies run asynchronously on the transfer queue: the chunk stays in
+        // Loading (skipped by rendering) until PollUpload sees them complete
+        void Upload(VulkanDevice &device, IndirectTerrainRenderer *terrainPool = nullptr);
+
+        // Returns true once the async upload has finished, flipping the
+        // chunk to Loaded on the call that observes completion
+        bool PollUpload(VulkanDevice &device);
 
         // Unload from GPU (keep CPU data for quick reload)
         void Unload();
@@ -47,6 +84,21 @@ namespace Genesis
         // Full cleanup
         void Destroy();
 
+        // Approximate bytes of CPU-side data this chunk holds (heightmaps,
+        // hydrology fields, retained mesh copies, object instances)
+        size_t GetCpuMemoryUsage() const;
+
+        // Drop the CPU-side generation data once the GPU meshes are
+        // resident. The disk cache (or regeneration) restores it on a
+        // revisit; height queries fall back to direct noise sampling.
+        void ReleaseCpuData();
+
+        // Seed the heightmap from the manager's warm compressed store
+        // before Generate, which then skips the noise stack for it. Only
+        // valid while world settings are unchanged; the manager clears the
+        // store on regeneration.
+        void RestoreWarmHeightmap(std::vector<float> heightmap);
+
         // Getters
         int GetChunkX() const { return m_ChunkX; }
         int GetChunkZ() const { return m_ChunkZ; }
@@ -54,18 +106,29 @@ namespace Genesis
         glm::vec3 GetWorldPosition() const;
         ChunkState GetState() const { return m_State; }
         Mesh *GetMesh() const { return m_Mesh.get(); }
-        Mesh *GetWaterMesh() const { return m_WaterMesh.get(); }
-        bool HasWater() const { return m_HasWater; }
+        Mesh *GetLodMesh(int lod) const;
 
         // Get height at local position within chunk
         float GetHeightAt(float localX, float localZ) const;
 
+        // Vertical bounds of the generated heightmap (for culling AABBs)
+        float GetMinHeight() const { return m_MinHeight; }
+        float GetMaxHeight() const { return m_MaxHeight; }
+
+        // Nearest ray-vs-terrain hit via the min/max height quadtree built
+        // during generation. origin is chunk-local in XZ with world-space
+        // Y; only the [tMin, tMax] segment is tested. Returns false when
+        // nothing is hit or the CPU heightmap (and with it the quadtree)
+        // has been released.
+        bool RaycastTerrain(const glm::vec3 &localOrigin, const glm::vec3 &direction,
+                            float tMin, float tMax, float &outT) const;
+
         // Check if world position is within this chunk
         bool ContainsWorldPosition(float worldX, float worldZ) const;
 
-        // Object positions (world coordinates)
-        const std::vector<glm::vec3> &GetTreePositions() const { return m_TreePositions; }
-        const std::vector<glm::vec3> &GetRockPositions() const { return m_RockPositions; }
+        // Object instances (world coordinates), ready for the instanced renderer
+        const std::vector<InstanceData> &GetTreeInstances() const { return m_TreeInstances; }
+        const std::vector<InstanceData> &GetRockInstances() const { return m_RockInstances; }
 
         // Ocean mask access
         OceanMask &GetOceanMask() { return m_OceanMask; }
@@ -77,11 +140,21 @@ namespace Genesis
         // Check if a cell is an inland lake (below sea level but NOT connected)
         bool IsInlandLakeAt(int cellX, int cellZ) const { return m_OceanMask.IsInlandLake(cellX, cellZ); }
 
-        // Regenerate water mesh after ocean mask update
-        void RegenerateWater(float seaLevel, bool useOceanMask);
-
         // Access to hydrology data for rendering
         const HydrologyData &GetHydrologyData() const { return m_HydrologyData; }
+
+        // Hydrology tier this chunk was generated with; ChunkManager
+        // re-queues chunks whose tier is below what their distance warrants
+        HydrologyLod GetHydrologyLod() const { return m_HydrologyLod; }
+
+        // Cross-chunk drainage stitching (driven by ChunkManager)
+        DrainageGraph &GetDrainageGraph() { return m_DrainageGraph; }
+        const DrainageGraph &GetDrainageGraph() const { return m_DrainageGraph; }
+        bool HasDrainageData() const { return m_DrainageGraph.GetData().width > 0; }
+
+        // Copy stitched flow accumulation back into the cached hydrology
+        // fields after neighbors exchanged boundary flow
+        void RefreshStitchedAccumulation();
         const ClimateData &GetClimateData() const { return m_ClimateGenerator.GetData(); }
         const MaterialData &GetMaterialData() const { return m_MaterialBlender.GetData(); }
         const BiomeData &GetBiomeData() const { return m_BiomeClassifier.GetData(); }
@@ -89,6 +162,22 @@ namespace Genesis
         // Get biome weights at a cell position
         BiomeWeights GetBiomeWeights(int cellX, int cellZ) const { return m_BiomeClassifier.GetBiomeWeights(cellX, cellZ); }
 
+        // Nearest river segment to a local XZ position (world units within
+        // this chunk), or nullptr if none within maxDistance. Served by the
+        // bucketed index built during hydrology generation, so it is cheap
+        // enough to poll every frame (water avoidance, audio emitters).
+        const RiverSegment *FindNearestRiverSegment(float localX, float localZ, float maxDistance) const;
+
+        // World-space position of a segment returned by
+        // FindNearestRiverSegment: cell center at water surface height
+        glm::vec3 GetRiverSegmentWorldPosition(const RiverSegment &segment) const;
+
+        // Fill one DebugFieldAtlas block (m_Size^2 RGBA texels, one per
+        // cell): R = normalized height, G = log flow accumulation,
+        // B = moisture, A = biome id. Returns false when the CPU-side
+        // generation data needed to build it has been released.
+        bool BuildDebugFieldBlock(std::vector<uint8_t> &outRgba) const;
+
         // Access to lake and river meshes
         Mesh *GetLakeMesh() const { return m_LakeMesh.get(); }
         Mesh *GetRiverMesh() const { return m_RiverMesh.get(); }
@@ -97,14 +186,16 @@ namespace Genesis
 
     private:
         std::shared_ptr<Mesh> GenerateTerrainMesh(float offsetX, float offsetZ, uint32_t worldSeed);
-        void GenerateHydrology(float seaLevel);
+        // Full-resolution hydrology as coroutine stages: drainage, rivers,
+        // lakes, then the unified field computation
+        GenerationCoroutine GenerateHydrologyStaged(float seaLevel);
+        void GenerateCoarseHydrology(float seaLevel); // Quarter-resolution pipeline for mid-distance chunks
         void GenerateClimateAndMaterials(float seaLevel);
         void GenerateClimateAndBiomes(float seaLevel); // Lightweight version without full hydrology
         void GenerateWaterMeshes(float seaLevel);
         void GenerateObjects(uint32_t worldSeed, float seaLevel);
-        void GenerateWater(float seaLevel);
-        void GenerateWaterWithOceanMask(float seaLevel);
         float GetHeightAtLocal(float localX, float localZ) const;
+        void ComputeHeightBounds();
 
         int m_ChunkX; // Chunk coordinate (not world position)
         int m_ChunkZ;
@@ -113,16 +204,24 @@ namespace Genesis
 
         ChunkState m_State = ChunkState::Unloaded;
 
+        // Transfer-queue ticket for the in-flight upload batch (0 = none)
+        uint64_t m_UploadTicket = 0;
+
         std::unique_ptr<Mesh> m_Mesh;
-        std::unique_ptr<Mesh> m_WaterMesh;
+        // Reduced-resolution terrain meshes for levels 1..LOD_COUNT-1 (level 0 is m_Mesh)
+        std::array<std::unique_ptr<Mesh>, LOD_COUNT> m_LodMeshes;
         std::unique_ptr<Mesh> m_LakeMesh;
         std::unique_ptr<Mesh> m_RiverMesh;
-        bool m_HasWater = false;
         bool m_HasLakes = false;
         bool m_HasRivers = false;
 
+        float m_MinHeight = 0.0f;
+        float m_MaxHeight = 0.0f;
+
         TerrainGenerator m_TerrainGenerator;
         OceanMask m_OceanMask;
+        // Min/max pyramid over the cached heightmap; dropped with it
+        HeightQuadtree m_HeightQuadtree;
 
         // Hydrology pipeline components
         DrainageGraph m_DrainageGraph;
@@ -130,6 +229,9 @@ namespace Genesis
         LakeGenerator m_LakeGenerator;
         HydrologyGenerator m_HydrologyGenerator;
         HydrologyData m_HydrologyData;
+        HydrologyLod m_HydrologyLod = HydrologyLod::None;
+        // Downsampled heightmap the coarse tier ran on (empty otherwise)
+        std::vector<float> m_CoarseHeightmap;
 
         // Climate and material systems
         ClimateGenerator m_ClimateGenerator;
@@ -140,11 +242,21 @@ namespace Genesis
         LakeMeshGenerator m_LakeMeshGenerator;
         RiverMeshGenerator m_RiverMeshGenerator;
 
-        // Object positions within this chunk (world coordinates)
-        std::vector<glm::vec3> m_TreePositions;
-        std::vector<glm::vec3> m_RockPositions;
+        // Object instances within this chunk (world coordinates), stored in
+        // the instanced renderer's layout so aggregation is a plain copy
+        std::vector<InstanceData> m_TreeInstances;
+        std::vector<InstanceData> m_RockInstances;
+
+        // Last ChunkManager frame this chunk was rendered; orders LRU
+        // eviction under the CPU memory budget
+        uint64_t m_LastRenderedFrame = 0;
+
+        // Set by RestoreWarmHeightmap; Generate consumes them once
+        std::vector<float> m_WarmHeightmap;
+        bool m_HeightmapRestored = false;
 
         friend class ChunkManager;
+        friend class ChunkCache;
     };
 
 }
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "genesis/procedural/TerrainGenerator.h"
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <mutex>
+
+namespace Genesis
+{
+
+    // ChunkManager-level cache of raw heightmap border samples. When a chunk
+    // finishes generating, its four edges are stored here; a neighbor generated
+    // later gathers the opposing edges as a halo and skips re-evaluating the
+    // noise stack for every shared border sample. Thread-safe, since generation
+    // workers store and gather concurrently.
+    class ChunkBorderCache
+    {
+    public:
+        void Store(const glm::ivec2 &coord, const HeightmapBorders &borders);
+
+        // Assemble a halo for the chunk at coord from cached neighbor edges.
+        // Edges with no cached neighbor are left empty and get sampled normally.
+        HeightmapBorders Gather(const glm::ivec2 &coord) const;
+
+        // Drop entries farther than keepRadius chunks (Chebyshev) from center
+        void Prune(const glm::ivec2 &center, int keepRadius);
+
+        void Clear();
+
+    private:
+        struct CoordHash
+        {
+            size_t operator()(const glm::ivec2 &coord) const
+            {
+                return std::hash<int>()(coord.x) ^ (std::hash<int>()(coord.y) << 16);
+            }
+        };
+
+        mutable std::mutex m_Mutex;
+        std::unordered_map<glm::ivec2, HeightmapBorders, CoordHash> m_Borders;
+    };
+
+}
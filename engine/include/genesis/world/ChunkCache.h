@@ -0,0 +1,82 @@
+#pragma once
+
+#include "genesis/world/Chunk.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Genesis
+{
+
+    // Binary on-disk cache of generated chunks, packed into region files of
+    // REGION_SIZE x REGION_SIZE chunks keyed by (seed, terrain settings
+    // hash). Each region opens with a sparse slot table; per-chunk payloads
+    // follow, with the heightmap section delta-compressed through
+    // HeightmapCodec and mesh/instance sections stored raw. Generation is
+    // fully deterministic, so a hit replaces the whole procedural pipeline
+    // with a memory-mapped table lookup and payload decode.
+    //
+    // Writes are asynchronous: Save snapshots the chunk into a byte buffer
+    // on the calling thread and hands it to a single writer thread, which
+    // appends payloads and patches slot table entries behind the frame. The
+    // one writer also serializes all region-file mutation, so no per-file
+    // locking is needed.
+    class ChunkCache
+    {
+    public:
+        // Chunks per region file side (8x8 = 64 slots per file)
+        static constexpr int REGION_SIZE = 8;
+
+        explicit ChunkCache(const std::string &directory = "cache/regions");
+        ~ChunkCache();
+
+        // Try to restore a generated chunk from its region file. Returns
+        // false on miss or key mismatch (stale seed/settings/sea level), in
+        // which case the caller runs the normal generation pipeline.
+        bool TryLoad(Chunk &chunk, const TerrainSettings &settings, uint32_t worldSeed, float seaLevel) const;
+
+        // Queue a freshly generated chunk for write-behind. Must be called
+        // while the chunk still holds CPU-side mesh data (before GPU
+        // upload); the snapshot is taken before this returns.
+        void Save(const Chunk &chunk, const TerrainSettings &settings, uint32_t worldSeed, float seaLevel);
+
+        const std::string &GetDirectory() const { return m_Directory; }
+
+        // Stable hash over the settings that influence generation output
+        static uint64_t HashSettings(const TerrainSettings &settings);
+
+    private:
+        // A serialized chunk waiting for the writer thread. Kept queued
+        // until the region file is patched so TryLoad can serve a chunk
+        // that is written-behind but not yet on disk.
+        struct PendingWrite
+        {
+            std::string path;
+            int slot = 0;
+            uint32_t seed = 0;
+            uint64_t settingsHash = 0;
+            int32_t chunkSize = 0;
+            float cellSize = 0.0f;
+            float seaLevel = 0.0f;
+            std::vector<uint8_t> payload;
+        };
+
+        std::string RegionPath(int regionX, int regionZ, uint32_t worldSeed, uint64_t settingsHash) const;
+
+        void WriterLoop();
+        void CommitWrite(const PendingWrite &write);
+
+        std::string m_Directory;
+
+        mutable std::mutex m_QueueMutex;
+        std::condition_variable m_QueueCondition;
+        std::deque<PendingWrite> m_WriteQueue;
+        std::thread m_WriterThread;
+        bool m_StopWriter = false;
+    };
+
+}
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Genesis
+{
+
+    // Hash function for chunk coordinates. std::hash<int> is the identity
+    // on common stdlibs, so the coordinates are packed into 64 bits and run
+    // through the splitmix64 finalizer to spread the small values chunks
+    // actually use across the whole hash range.
+    struct ChunkCoordHash
+    {
+        size_t operator()(const glm::ivec2 &coord) const
+        {
+            uint64_t h = (static_cast<uint64_t>(static_cast<uint32_t>(coord.x)) << 32) |
+                         static_cast<uint32_t>(coord.y);
+            h ^= h >> 30;
+            h *= 0xBF58476D1CE4E5B9ull;
+            h ^= h >> 27;
+            h *= 0x94D049BB133111EBull;
+            h ^= h >> 31;
+            return static_cast<size_t>(h);
+        }
+    };
+
+    // Flat open-addressing map from chunk coordinate to T. Entries live in
+    // one contiguous slot array with linear probing (power-of-two capacity,
+    // tombstone deletion), so lookups touch a single cache line instead of
+    // chasing the per-node heap allocations of std::unordered_map. Supports
+    // the subset of the std::unordered_map interface ChunkManager uses;
+    // iteration order is unspecified and iterators are invalidated by any
+    // insertion.
+    template <typename T>
+    class ChunkCoordMap
+    {
+    public:
+        using value_type = std::pair<glm::ivec2, T>;
+
+    private:
+        enum SlotState : uint8_t
+        {
+            Empty = 0,
+            Occupied,
+            Tombstone
+        };
+
+        struct Slot
+        {
+            value_type KV;
+            uint8_t State = Empty;
+        };
+
+        template <typename SlotPtr, typename Pair>
+        class BasicIterator
+        {
+        public:
+            BasicIterator(SlotPtr slot, SlotPtr end) : m_Slot(slot), m_End(end)
+            {
+                SkipVacant();
+            }
+
+            Pair &operator*() const { return m_Slot->KV; }
+            Pair *operator->() const { return &m_Slot->KV; }
+
+            BasicIterator &operator++()
+            {
+                ++m_Slot;
+                SkipVacant();
+                return *this;
+            }
+
+            bool operator==(const BasicIterator &other) const { return m_Slot == other.m_Slot; }
+            bool operator!=(const BasicIterator &other) const { return m_Slot != other.m_Slot; }
+
+        private:
+            void SkipVacant()
+            {
+                while (m_Slot != m_End && m_Slot->State != Occupied)
+                    ++m_Slot;
+            }
+
+            SlotPtr m_Slot;
+            SlotPtr m_End;
+
+            friend class ChunkCoordMap;
+        };
+
+    public:
+        using iterator = BasicIterator<Slot *, value_type>;
+        using const_iterator = BasicIterator<const Slot *, const value_type>;
+
+        iterator begin() { return iterator(SlotsBegin(), SlotsEnd()); }
+        iterator end() { return iterator(SlotsEnd(), SlotsEnd()); }
+        const_iterator begin() const { return const_iterator(SlotsBegin(), SlotsEnd()); }
+        const_iterator end() const { return const_iterator(SlotsEnd(), SlotsEnd()); }
+
+        size_t size() const { return m_Size; }
+        bool empty() const { return m_Size == 0; }
+
+        iterator find(const glm::ivec2 &key)
+        {
+            return iterator(FindSlot(key), SlotsEnd());
+        }
+
+        const_iterator find(const glm::ivec2 &key) const
+        {
+            return const_iterator(FindSlot(key), SlotsEnd());
+        }
+
+        // Inserts a default-constructed value if the key is absent
+        T &operator[](const glm::ivec2 &key)
+        {
+            Slot *slot = FindSlot(key);
+            if (slot != SlotsEnd())
+                return slot->KV.second;
+
+            Grow(m_Size + 1);
+
+            // The key is known absent, so the first vacant slot along the
+            // probe chain (reclaiming a tombstone if one comes first) is the
+            // correct insertion point
+            size_t i = ChunkCoordHash{}(key) & m_Mask;
+            while (m_Slots[i].State == Occupied)
+                i = (i + 1) & m_Mask;
+
+            if (m_Slots[i].State == Empty)
+                m_Used++;
+            m_Slots[i].KV.first = key;
+            m_Slots[i].KV.second = T{};
+            m_Slots[i].State = Occupied;
+            m_Size++;
+            return m_Slots[i].KV.second;
+        }
+
+        iterator erase(iterator it)
+        {
+            it.m_Slot->KV.second = T{};
+            it.m_Slot->State = Tombstone;
+            m_Size--;
+            ++it;
+            return it;
+        }
+
+        void clear()
+        {
+            m_Slots = std::vector<Slot>();
+            m_Mask = 0;
+            m_Size = 0;
+            m_Used = 0;
+        }
+
+    private:
+        Slot *SlotsBegin() { return m_Slots.data(); }
+        Slot *SlotsEnd() { return m_Slots.data() + m_Slots.size(); }
+        const Slot *SlotsBegin() const { return m_Slots.data(); }
+        const Slot *SlotsEnd() const { return m_Slots.data() + m_Slots.size(); }
+
+        const Slot *FindSlot(const glm::ivec2 &key) const
+        {
+            if (m_Slots.empty())
+                return SlotsEnd();
+
+            // The load factor cap guarantees a run of occupied/tombstone
+            // slots always ends at an empty one, terminating the probe
+            size_t i = ChunkCoordHash{}(key) & m_Mask;
+            while (m_Slots[i].State != Empty)
+            {
+                if (m_Slots[i].State == Occupied && m_Slots[i].KV.first == key)
+                    return &m_Slots[i];
+                i = (i + 1) & m_Mask;
+            }
+            return SlotsEnd();
+        }
+
+        Slot *FindSlot(const glm::ivec2 &key)
+        {
+            return const_cast<Slot *>(static_cast<const ChunkCoordMap *>(this)->FindSlot(key));
+        }
+
+        // Keeps occupied + tombstone slots under 3/4 of capacity before an
+        // insert: grows when mostly live, rebuilds in place when tombstones
+        // dominate
+        void Grow(size_t sizeAfterInsert)
+        {
+            size_t capacity = m_Slots.size();
+            if (capacity == 0)
+            {
+                Rehash(16);
+                return;
+            }
+            if ((m_Used + 1) * 4 > capacity * 3)
+            {
+                Rehash(sizeAfterInsert * 4 > capacity * 3 ? capacity * 2 : capacity);
+            }
+        }
+
+        void Rehash(size_t newCapacity)
+        {
+            std::vector<Slot> old = std::move(m_Slots);
+            m_Slots = std::vector<Slot>(newCapacity);
+            m_Mask = newCapacity - 1;
+            m_Size = 0;
+            m_Used = 0;
+            for (Slot &slot : old)
+            {
+                if (slot.State == Occupied)
+                    (*this)[slot.KV.first] = std::move(slot.KV.second);
+            }
+        }
+
+        std::vector<Slot> m_Slots;
+        size_t m_Mask = 0;
+        size_t m_Size = 0; // Occupied slots
+        size_t m_Used = 0; // Occupied + tombstone slots
+    };
+
+}
@@ -1,18 +1,30 @@
 #pragma once
 
 #include "genesis/world/Chunk.h"
+#include "genesis/world/ChunkCache.h"
+#include "genesis/world/ChunkBorderCache.h"
+#include "genesis/world/ChunkCoordMap.h"
+#include "genesis/world/HeightmapCodec.h"
 #include "genesis/procedural/TerrainGenerator.h"
 #include "genesis/procedural/OceanMask.h"
 #include <glm/glm.hpp>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
+#include <span>
 #include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 namespace Genesis
 {
 
     class VulkanDevice;
     class Renderer;
+    class Camera;
 
     struct WorldSettings
     {
@@ -21,6 +33,10 @@ namespace Genesis
         float cellSize = 0.25f; // World units per cell
         int viewDistance = 3;   // Chunks to load in each direction
         int hydrologyDistance = 1; // Only compute full hydrology within this distance
+        // Quarter-resolution hydrology out to this distance (rivers and
+        // lakes visible without the full per-cell pipeline); chunks upgrade
+        // in place as the camera nears
+        int coarseHydrologyDistance = 3;
 
         // World seed
         uint32_t seed = 12345;
@@ -32,6 +48,27 @@ namespace Genesis
         bool waterEnabled = true;
         bool useOceanMask = true; // Use flood-fill ocean detection
 
+        // Exchange boundary flow accumulation between neighboring chunks so
+        // rivers keep their upstream contribution across chunk borders
+        bool stitchDrainage = true;
+
+        // Settings changes regenerate in two waves: a cheap preview pass
+        // (2 octaves, no warp, no erosion, no hydrology) for instant visual
+        // feedback, then a full-quality refinement pass that swaps the meshes
+        bool progressiveRefinement = true;
+
+        // CPU-side residency budget for loaded chunks (heightmaps, hydrology
+        // fields, retained mesh data). When the total exceeds this, the
+        // least-recently-rendered chunks release their CPU data; the disk
+        // cache restores it on a revisit. 0 disables the budget.
+        size_t cpuMemoryBudget = 2ull * 1024 * 1024 * 1024;
+
+        // Budget for the warm store of compressed heightmaps kept after a
+        // chunk leaves the active ring (see HeightmapCodec). The delta+RLE
+        // encoding runs 5-10x smaller than raw floats, so this keeps a much
+        // larger world warm than raw retention would. 0 disables it.
+        size_t warmHeightmapBudget = 256ull * 1024 * 1024;
+
         // Terrain settings
         TerrainSettings terrainSettings;
 
@@ -43,34 +80,62 @@ namespace Genesis
         }
     };
 
-    // Hash function for chunk coordinates
-    struct ChunkCoordHash
-    {
-        size_t operator()(const glm::ivec2 &coord) const
-        {
-            return std::hash<int>()(coord.x) ^ (std::hash<int>()(coord.y) << 16);
-        }
-    };
-
     class ChunkManager
     {
     public:
         ChunkManager();
         ~ChunkManager();
 
-        void Initialize(VulkanDevice &device, const WorldSettings &settings);
+        // Optional terrainRenderer routes chunk terrain meshes into the
+        // shared multi-draw indirect pool instead of per-mesh buffers
+        void Initialize(VulkanDevice &device, const WorldSettings &settings,
+                        IndirectTerrainRenderer *terrainRenderer = nullptr);
         void Shutdown();
 
         // Update chunks based on camera position
         void Update(const glm::vec3 &cameraPosition);
 
-        // Render all loaded chunks
-        void Render(Renderer &renderer);
+        // Render loaded chunks visible to the camera, front to back
+        void Render(Renderer &renderer, const Camera &camera);
 
-        // Get height at world position (samples from appropriate chunk)
+        // Get height at world position (samples from appropriate chunk).
+        // Safe to call from any thread: queries pin the published chunk
+        // snapshot and traverse it lock-free while Update keeps loading
+        // and unloading on the main thread.
         float GetHeightAt(float worldX, float worldZ) const;
 
-        // Get chunk at world position
+        // Batched height queries (positions are world XZ). Queries are
+        // grouped by owning chunk so each chunk is resolved once per group
+        // and heights read straight out of its cached heightmap; positions
+        // with no loaded chunk fall back to batched raw noise evaluation.
+        // Use this for placement and ground-following instead of per-point
+        // GetHeightAt calls.
+        void GetHeightsAt(std::span<const glm::vec2> positions, std::span<float> outHeights) const;
+
+        // Nearest ray-vs-terrain hit within maxDistance. Walks the chunk
+        // grid along the ray and descends each loaded chunk's min/max
+        // height quadtree, so empty space above the terrain is skipped in
+        // a handful of node visits instead of fixed-step height sampling.
+        // Use this for camera collision, picking fallback, and
+        // line-of-sight tests. Returns false when nothing is hit; rays
+        // only intersect chunks that are loaded and still hold their CPU
+        // heightmap. outHit receives the world-space hit position.
+        bool RaycastTerrain(const glm::vec3 &origin, const glm::vec3 &direction,
+                            float maxDistance, glm::vec3 &outHit) const;
+
+        // Nearest river segment to a world position within maxDistance, or
+        // nullptr if no loaded chunk in range has one. Checks every chunk
+        // the search circle overlaps, so hits across a chunk border are
+        // found too. Backed by each chunk's bucketed segment index; cheap
+        // enough to poll every frame. outPosition (optional) receives the
+        // segment's world-space cell center at water surface height.
+        const RiverSegment *FindNearestRiverSegment(float worldX, float worldZ, float maxDistance,
+                                                    glm::vec3 *outPosition = nullptr) const;
+
+        // Get chunk at world position. The pointer stays valid while the
+        // chunk remains published; off-thread callers should prefer the
+        // height/raycast/river queries above, which pin one snapshot for
+        // their whole run instead of dereferencing a returned pointer.
         Chunk *GetChunkAt(float worldX, float worldZ) const;
         Chunk *GetChunkByCoord(int chunkX, int chunkZ) const;
 
@@ -87,42 +152,322 @@ namespace Genesis
         void RequestRegeneration() { m_NeedsRegeneration = true; }
         bool NeedsRegeneration() const { return m_NeedsRegeneration; }
 
+        // Live-preview a candidate settings tweak on just the camera's
+        // chunk: queues one preview-quality regeneration (reduced octaves,
+        // hydrology off) ahead of all other jobs, without committing the
+        // settings. Cheap enough to call every frame during a slider drag;
+        // a no-op while a previous preview of the chunk is still pending.
+        void PreviewChunkAtCamera(const TerrainSettings &settings);
+
         // Stats
         int GetLoadedChunkCount() const { return static_cast<int>(m_LoadedChunks.size()); }
+        int GetPendingChunkCount() const { return static_cast<int>(m_PendingChunks.size()); }
+
+        // Max GPU uploads of finished chunks per Update call (keeps frame time stable)
+        void SetUploadBudget(int chunksPerFrame) { m_UploadBudgetPerFrame = chunksPerFrame; }
+
+        // Approximate CPU bytes held by all loaded chunks (see
+        // Chunk::GetCpuMemoryUsage)
+        size_t GetCpuMemoryUsage() const;
+
+        void SetCpuMemoryBudget(size_t bytes) { m_Settings.cpuMemoryBudget = bytes; }
+        size_t GetCpuMemoryBudget() const { return m_Settings.cpuMemoryBudget; }
 
-        // Access to all tree/rock positions for rendering
-        const std::vector<glm::vec3> &GetAllTreePositions() const { return m_AllTreePositions; }
-        const std::vector<glm::vec3> &GetAllRockPositions() const { return m_AllRockPositions; }
+        // Aggregated tree/rock instances, ready for InstancedRenderer::SetInstances.
+        // Chunks occupy stable ranges inside these arrays; slots freed by an
+        // unload hold degenerate zero-scale instances (rejected by the GPU
+        // cull pass) until a later load reuses them.
+        const std::vector<InstanceData> &GetAllTreeInstances() const { return m_TreeInstancePool.instances; }
+        const std::vector<InstanceData> &GetAllRockInstances() const { return m_RockInstancePool.instances; }
+
+        // Bumped whenever chunk load/unload rebuilds the aggregated instance
+        // lists; lets callers re-upload instance buffers only on change
+        uint64_t GetObjectsVersion() const { return m_ObjectsVersion; }
 
         // Ocean mask system
         void SetUseOceanMask(bool useOceanMask) { m_Settings.useOceanMask = useOceanMask; }
         bool GetUseOceanMask() const { return m_Settings.useOceanMask; }
 
     private:
+        // A generation job owns its chunk until the worker finishes; the main
+        // thread then uploads it and inserts it into m_LoadedChunks.
+        struct ChunkJob
+        {
+            std::unique_ptr<Chunk> chunk;
+            TerrainSettings terrainSettings;
+            uint32_t seed = 0;
+            float seaLevel = 0.0f;
+            HydrologyLod hydrologyLod = HydrologyLod::None;
+            bool prefetch = false; // Speculative load, yields to regular jobs
+            bool preview = false;  // Cheap first pass, skips disk and border caches
+
+            // Staged generation state for jobs parked between coroutine
+            // stages (see WorkerLoop). The halo lives on the heap so the
+            // pointer the coroutine captured survives the job being moved
+            // back into the queue.
+            GenerationCoroutine pipeline;
+            std::unique_ptr<HeightmapBorders> halo;
+            bool started = false;
+            bool warmRestored = false;
+        };
+
+        // Unloaded chunks keep their GPU buffers alive until every frame that
+        // may still reference them has had its fence waited on by the
+        // renderer, and until every reader snapshot that could still name
+        // them has unpinned (see ChunkTable)
+        struct DeferredChunkDelete
+        {
+            std::unique_ptr<Chunk> chunk;
+            int framesRemaining = 0;
+            uint64_t retireEpoch = 0; // Stamped by the publish that removed it
+        };
+
         glm::ivec2 WorldToChunkCoord(float worldX, float worldZ) const;
         glm::vec3 ChunkCoordToWorld(int chunkX, int chunkZ) const;
         void LoadChunk(int chunkX, int chunkZ);
+        void QueueChunkLoad(int chunkX, int chunkZ, bool prefetch = false, bool preview = false);
         void UnloadChunk(int chunkX, int chunkZ);
-        void RebuildObjectPositions();
+        void PrefetchAlongVelocity(const glm::ivec2 &cameraChunk);
+        void ProcessDeferredDeletes(bool force = false);
+
+        // Release CPU-side chunk data, least recently rendered first, until
+        // the total is back under the configured budget
+        void EnforceMemoryBudget();
+
+        // Lock-free published snapshot of m_LoadedChunks. Update mutates
+        // m_LoadedChunks freely on the main thread and re-publishes an
+        // immutable coord->chunk table after each change; const queries pin
+        // the current epoch in a per-thread slot, walk their table without
+        // taking a lock, and unpin. A retired table - or a chunk removed
+        // from one - is only freed once every pinned epoch has advanced
+        // past its retirement, so a reader can never observe a freed
+        // chunk. Epochs start at 1; 0 marks an idle reader slot.
+        struct ChunkTable
+        {
+            uint64_t epoch = 0; // First epoch this table was current for
+            ChunkCoordMap<Chunk *> chunks;
+        };
+
+        struct RetiredTable
+        {
+            std::unique_ptr<const ChunkTable> table;
+            uint64_t epoch = 0; // Last epoch this table was current for
+        };
+
+        static constexpr uint64_t READER_IDLE = 0;
+        static constexpr int MAX_READER_SLOTS = 64;
+
+        struct ReaderSlot
+        {
+            std::atomic<uint64_t> epoch{READER_IDLE};
+        };
+
+        // RAII pin over the published table for the duration of one query.
+        // Nested pins on one thread reuse the outer pin; a thread beyond
+        // the slot capacity serializes against reclamation with a mutex
+        // instead (slots comfortably outnumber engine threads).
+        class ChunkTableReader
+        {
+        public:
+            explicit ChunkTableReader(const ChunkManager &manager);
+            ~ChunkTableReader();
+
+            ChunkTableReader(const ChunkTableReader &) = delete;
+            ChunkTableReader &operator=(const ChunkTableReader &) = delete;
+
+            const ChunkTable *operator->() const { return m_Table; }
+            explicit operator bool() const { return m_Table != nullptr; }
+
+        private:
+            const ChunkManager *m_Manager = nullptr;
+            const ChunkTable *m_Table = nullptr;
+            std::atomic<uint64_t> *m_Slot = nullptr;
+            bool m_OverflowLocked = false;
+        };
+
+        // Must accompany every change to m_LoadedChunks: builds the next
+        // table, publishes it with one pointer store, retires the old one
+        // and stamps freshly deferred chunks with the retirement epoch
+        void PublishChunkTable();
+
+        // Smallest epoch any reader currently has pinned, or UINT64_MAX
+        // when none is active; retirements older than this are unreachable
+        uint64_t MinPinnedEpoch() const;
+
+        // This thread's pin slot index, claimed on first use; -1 once the
+        // slots are exhausted (reader falls back to the overflow mutex)
+        int ClaimReaderSlot() const;
+
+        // Warm heightmap store: compressed retention for chunks leaving the
+        // active ring, consumed by a later generation of the same chunk
+        void StoreWarmHeightmap(const glm::ivec2 &coord, const std::vector<float> &heightmap);
+        std::vector<float> TakeWarmHeightmap(const glm::ivec2 &coord);
+        void ClearWarmHeightmaps();
+        void StartWorkers();
+        void StopWorkers();
+        void WorkerLoop();
+        void ProcessCompletedChunks();
+        void PollUploadingChunks();
+        void FlushPendingJobs();
+
+        // Incremental instance aggregation: register or release one chunk's
+        // tree/rock instances in the pooled arrays and bump the objects
+        // version if anything moved
+        void AddChunkObjects(const glm::ivec2 &coord, const Chunk &chunk);
+        void RemoveChunkObjects(const glm::ivec2 &coord);
+
+        // Push field blocks of freshly loaded chunks into the renderer's
+        // debug atlas (no-op when nothing is dirty)
+        void UploadDebugFieldBlocks(Renderer &renderer);
         void PerformRegeneration();
 
-        // Ocean mask flood fill across all loaded chunks
-        void PerformOceanFloodFill();
+        // Queue every loaded chunk for regeneration, nearest first. Preview
+        // waves use MakePreviewSettings and skip hydrology.
+        void QueueRegenerationWave(bool preview);
+
+        // Reduced settings for the progressive preview pass
+        static TerrainSettings MakePreviewSettings(const TerrainSettings &settings);
+
+        // Ocean connectivity is propagated through a budgeted per-frame
+        // queue instead of a synchronous world-wide convergence loop, so a
+        // coastline chunk arriving can't ripple a multi-chunk re-flood into
+        // the frame that loaded it. A wave finish queues every loaded chunk;
+        // a steady-state chunk load queues just itself, and any chunk whose
+        // mask changes re-queues its four neighbors until the propagation
+        // settles.
+        void QueueOceanFloodFill();
+        void QueueOceanConnectivityUpdate(const glm::ivec2 &coord);
+        void ProcessOceanConnectivityQueue();
+
+        // Absorb ocean connectivity flowing in across any of the four
+        // neighbor borders; returns true if the mask gained ocean cells
+        bool AbsorbNeighborOceanConnectivity(const glm::ivec2 &coord, OceanMask &mask);
         bool IsChunkAtWorldBoundary(int chunkX, int chunkZ, ChunkEdge edge) const;
 
+        // Exchange boundary flow accumulation between a freshly loaded chunk
+        // and its neighbors, re-stitching only along affected borders
+        void StitchChunkDrainage(const glm::ivec2 &start);
+
+        // Hydrology tier a chunk at this coordinate should be generated with,
+        // based on Chebyshev distance from the camera chunk
+        HydrologyLod HydrologyLodForChunk(int chunkX, int chunkZ) const;
+
+        // Re-queue loaded chunks whose hydrology tier is below what their
+        // current distance warrants (upgrade in place as the camera nears)
+        void QueueHydrologyUpgrades(const glm::ivec2 &cameraChunk);
+
     private:
         VulkanDevice *m_Device = nullptr;
+        IndirectTerrainRenderer *m_TerrainRenderer = nullptr;
         WorldSettings m_Settings;
+        ChunkCache m_ChunkCache;
+        ChunkBorderCache m_BorderCache;
 
-        std::unordered_map<glm::ivec2, std::unique_ptr<Chunk>, ChunkCoordHash> m_LoadedChunks;
+        ChunkCoordMap<std::unique_ptr<Chunk>> m_LoadedChunks;
         glm::ivec2 m_LastCameraChunk{INT_MAX, INT_MAX};
 
-        std::vector<glm::vec3> m_AllTreePositions;
-        std::vector<glm::vec3> m_AllRockPositions;
+        // Snapshot publication state (see ChunkTable above)
+        std::atomic<const ChunkTable *> m_PublishedChunkTable{nullptr};
+        std::atomic<uint64_t> m_ChunkEpoch{1};
+        mutable ReaderSlot m_ReaderSlots[MAX_READER_SLOTS];
+        mutable std::atomic<int> m_ClaimedReaderSlots{0};
+        mutable std::mutex m_ReaderOverflowMutex;
+        std::vector<RetiredTable> m_RetiredTables;
+
+        // Monotonic Update counter; Render stamps it onto visible chunks so
+        // the memory budget can evict in least-recently-rendered order
+        uint64_t m_FrameCounter = 0;
+
+        // Camera movement tracking for directional prefetch. Chunks up to
+        // PREFETCH_RING beyond the view distance, in the direction the camera
+        // is heading, are generated speculatively at reduced priority.
+        static constexpr int PREFETCH_RING = 2;
+        glm::vec3 m_LastCameraPosition{0.0f};
+        glm::vec2 m_CameraVelocity{0.0f}; // Smoothed per-frame XZ delta
+        bool m_HasLastCameraPosition = false;
+
+        std::vector<DeferredChunkDelete> m_DeferredDeletes;
+
+        // Chunks whose debug atlas slot is stale; drained by Render
+        std::vector<glm::ivec2> m_DebugFieldDirty;
+
+        // Compressed heightmaps of chunks outside the active ring, FIFO
+        // evicted once warmHeightmapBudget is exceeded. Workers take
+        // entries during generation, the main thread stores on unload.
+        std::unordered_map<glm::ivec2, CompressedHeightmap, ChunkCoordHash> m_WarmHeightmaps;
+        std::deque<glm::ivec2> m_WarmOrder;
+        size_t m_WarmBytes = 0;
+        std::mutex m_WarmMutex;
+
+        // Chunks inserted into m_LoadedChunks whose GPU upload is still in
+        // flight on the transfer queue; polled each Update
+        std::vector<glm::ivec2> m_UploadingChunks;
+
+        // Pooled per-chunk instance aggregation. Each chunk's instances live
+        // in one contiguous range of the shared array, allocated first-fit
+        // from a free list on load and released on unload, so a chunk event
+        // moves O(one chunk) of data instead of rebuilding the whole array.
+        // Freed ranges are sentinel-filled (zero scale, far below the world)
+        // so the arrays stay directly consumable by the instanced renderer;
+        // a trailing free range shrinks the array instead.
+        struct InstanceRangePool
+        {
+            struct Range
+            {
+                uint32_t first = 0;
+                uint32_t count = 0;
+            };
+
+            std::vector<InstanceData> instances;
+            ChunkCoordMap<Range> ranges;
+            std::vector<Range> freeBlocks; // Sorted by first, coalesced
+
+            // Replace (or insert) a chunk's range; returns true if the
+            // arrays changed
+            bool Assign(const glm::ivec2 &coord, const std::vector<InstanceData> &data);
+            bool Release(const glm::ivec2 &coord);
+            void Clear();
+
+        private:
+            uint32_t Allocate(uint32_t count);
+            void FreeRange(Range range);
+        };
+
+        InstanceRangePool m_TreeInstancePool;
+        InstanceRangePool m_RockInstancePool;
+        uint64_t m_ObjectsVersion = 0;
+
+        // Single ocean surface shared by the whole world: a camera-centered
+        // grid (fine cells near the camera, geometrically coarser outward)
+        // drawn once per frame with a translation to (camera xz, sea level).
+        // The vertex shader supplies the wave displacement, so sea level
+        // changes move the transform instead of rebuilding any geometry.
+        std::unique_ptr<Mesh> m_OceanMesh;
+        float m_OceanCellSize = 0.0f; // Inner cell size, also the follow snap increment
 
         glm::mat4 m_TerrainTransform{1.0f};
         bool m_NeedsRegeneration = false;
         bool m_NeedsOceanFloodFill = false;
+        bool m_NeedsRefinementWave = false; // Full-quality pass after the preview wave lands
+
+        // Pending ocean connectivity work, drained a few chunks per frame.
+        // Coords in m_OceanUnseeded still need their local flood fill from
+        // the world boundary before absorbing neighbor connectivity.
+        std::deque<glm::ivec2> m_OceanUpdateQueue;
+        std::unordered_set<glm::ivec2, ChunkCoordHash> m_OceanQueuedChunks;
+        std::unordered_set<glm::ivec2, ChunkCoordHash> m_OceanUnseeded;
+
+        // Async generation job system. Workers run Chunk::Generate off the main
+        // thread; the main thread only performs GPU uploads (budgeted per frame).
+        std::vector<std::thread> m_Workers;
+        std::deque<ChunkJob> m_JobQueue;
+        std::deque<std::unique_ptr<Chunk>> m_CompletedChunks;
+        std::unordered_set<glm::ivec2, ChunkCoordHash> m_PendingChunks;
+        std::mutex m_JobMutex;
+        std::mutex m_CompletedMutex;
+        std::condition_variable m_JobCondition;
+        std::atomic<bool> m_StopWorkers{false};
+        int m_UploadBudgetPerFrame = 2;
     };
 
 }
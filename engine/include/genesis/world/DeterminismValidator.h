@@ -0,0 +1,55 @@
+#pragma once
+
+#include "genesis/world/ChunkManager.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Genesis
+{
+
+    /**
+     * Headless check that chunk generation is deterministic under the job
+     * system. Generates a fixed grid of chunks twice - once serially on the
+     * calling thread, once with every chunk dispatched as a job - hashes
+     * each output field per chunk, and diffs the two runs.
+     *
+     * Generation is pure CPU work (no device is touched until Upload), so
+     * this runs without a window or Vulkan instance. Any mismatch means a
+     * generation stage reads state that depends on scheduling order -
+     * typically shared generator scratch or an iteration order over an
+     * unordered container - and must be fixed before parallel generation
+     * can be trusted. Run the same seed on each target platform to also
+     * catch cross-platform float divergence.
+     */
+    class DeterminismValidator
+    {
+    public:
+        // One field whose hash differed between the serial and parallel run
+        struct Mismatch
+        {
+            glm::ivec2 coord{0, 0};
+            const char *field = nullptr;
+            uint64_t serialHash = 0;
+            uint64_t parallelHash = 0;
+        };
+
+        struct Report
+        {
+            int chunksCompared = 0;
+            std::vector<Mismatch> mismatches;
+
+            bool Passed() const { return mismatches.empty(); }
+        };
+
+        // Generate chunks in [-radius, radius]^2 serially and in parallel
+        // and compare per-field hashes. Requires an initialized JobSystem.
+        static Report Run(const WorldSettings &settings, int radius = 2);
+
+        // Self-contained entry point for a command-line invocation: brings
+        // up logging and the job system if needed, runs the comparison,
+        // logs the report, and returns a process exit code (0 = identical).
+        static int RunStandalone(int radius = 2);
+    };
+
+}
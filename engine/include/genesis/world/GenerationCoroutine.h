@@ -0,0 +1,107 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace Genesis
+{
+
+    // Hand-driven coroutine for staged chunk generation.
+    //
+    // Chunk::Generate used to run heightmap, hydrology, climate, meshing,
+    // water meshes and object placement as one monolithic call. Expressed
+    // as a coroutine that co_yields a stage name at each phase boundary,
+    // the same pipeline becomes schedulable: ChunkManager's workers resume
+    // one stage at a time and can park a partially generated chunk between
+    // stages - to the job queue, never mid-phase - when something more
+    // urgent arrives, then pick it up later without redoing completed
+    // phases.
+    //
+    // The coroutine starts suspended; nothing runs until the first
+    // Resume(). Stage names must be string literals (they are not copied).
+    class GenerationCoroutine
+    {
+    public:
+        struct promise_type
+        {
+            const char *Stage = "";
+            std::exception_ptr Exception;
+
+            GenerationCoroutine get_return_object()
+            {
+                return GenerationCoroutine(
+                    std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            std::suspend_always yield_value(const char *stage) noexcept
+            {
+                Stage = stage;
+                return {};
+            }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept { Exception = std::current_exception(); }
+        };
+
+        GenerationCoroutine() = default;
+        explicit GenerationCoroutine(std::coroutine_handle<promise_type> handle)
+            : m_Handle(handle)
+        {
+        }
+
+        ~GenerationCoroutine()
+        {
+            if (m_Handle)
+            {
+                m_Handle.destroy();
+            }
+        }
+
+        GenerationCoroutine(GenerationCoroutine &&other) noexcept
+            : m_Handle(std::exchange(other.m_Handle, nullptr))
+        {
+        }
+
+        GenerationCoroutine &operator=(GenerationCoroutine &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_Handle)
+                {
+                    m_Handle.destroy();
+                }
+                m_Handle = std::exchange(other.m_Handle, nullptr);
+            }
+            return *this;
+        }
+
+        GenerationCoroutine(const GenerationCoroutine &) = delete;
+        GenerationCoroutine &operator=(const GenerationCoroutine &) = delete;
+
+        // Run the next stage. Returns true while more stages remain, false
+        // once the pipeline has finished. Rethrows anything the stage threw.
+        bool Resume()
+        {
+            if (!m_Handle || m_Handle.done())
+            {
+                return false;
+            }
+            m_Handle.resume();
+            if (m_Handle.promise().Exception)
+            {
+                std::rethrow_exception(m_Handle.promise().Exception);
+            }
+            return !m_Handle.done();
+        }
+
+        bool Done() const { return !m_Handle || m_Handle.done(); }
+
+        // Name of the stage the pipeline last suspended at
+        const char *CurrentStage() const { return m_Handle ? m_Handle.promise().Stage : ""; }
+
+    private:
+        std::coroutine_handle<promise_type> m_Handle;
+    };
+
+}
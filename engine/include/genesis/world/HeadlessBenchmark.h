@@ -0,0 +1,60 @@
+#pragma once
+
+#include "genesis/world/ChunkManager.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Genesis
+{
+
+    // Headless batch generation: runs the full chunk pipeline (hydrology,
+    // climate, biomes, meshes - everything but GPU upload) over an N x N
+    // grid on the job system, then reports per-stage timing statistics and
+    // a world content hash. Doubles as a pre-baking tool: generated chunks
+    // are written to the disk cache, so a later interactive run of the same
+    // settings loads them instead of regenerating.
+    //
+    // Reached via `terragen --headless [N]`; no window, swapchain or ImGui
+    // is created, which makes it suitable for CI performance tracking.
+    class HeadlessBenchmark
+    {
+    public:
+        struct StageStats
+        {
+            std::string name;
+            int count = 0;
+            double meanMs = 0.0;
+            double p99Ms = 0.0;
+            double totalMs = 0.0;
+        };
+
+        struct Report
+        {
+            int chunksGenerated = 0;
+            double totalSeconds = 0.0;
+            double chunksPerSecond = 0.0;
+            // Per-chunk wall time across workers
+            double chunkMeanMs = 0.0;
+            double chunkP99Ms = 0.0;
+            // Generation stages aggregated from the profiler rings,
+            // slowest first
+            std::vector<StageStats> stages;
+            // FNV-1a over every chunk's heightmap, order-independent;
+            // nightly runs compare it to catch silent output drift
+            uint64_t worldHash = 0;
+        };
+
+        // Generate gridSize x gridSize chunks centered on the origin with
+        // full hydrology. When bakeToCache is set, each chunk is also saved
+        // through ChunkCache.
+        static Report Run(const WorldSettings &settings, int gridSize, bool bakeToCache);
+
+        // CLI entry point: initializes logging and the job system, runs
+        // with default world settings, logs the report. Returns a process
+        // exit code.
+        static int RunStandalone(int gridSize = 8);
+    };
+
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Genesis
+{
+
+    // Min/max height pyramid over a chunk's cached heightmap for fast
+    // ray-vs-terrain queries. A ray march with point sampling needs dozens
+    // of height lookups per query; descending the pyramid skips nodes whose
+    // [min, max] height band the ray never enters, so open air above
+    // terrain is crossed in a handful of node visits and only the cells
+    // near the surface are intersected exactly.
+    //
+    // Built once from the finished heightmap during chunk generation
+    // (one min/max pair per cell at the base, halved per level) and
+    // dropped together with the heightmap when the chunk's CPU data is
+    // released.
+    class HeightQuadtree
+    {
+    public:
+        // heightmap holds width x depth samples (chunk grids are
+        // (size+1)^2); cellSize is the world distance between samples
+        void Build(const std::vector<float> &heightmap, int width, int depth, float cellSize);
+        void Clear();
+        bool IsBuilt() const { return !m_Levels.empty(); }
+
+        size_t GetMemoryUsage() const;
+
+        // Nearest intersection of a ray with the heightfield surface.
+        // origin and direction are chunk-local in XZ with world-space Y;
+        // direction need not be normalized. Only the [tMin, tMax] segment
+        // is tested, so callers can clip the ray to the chunk's footprint.
+        // heightmap must be the array the pyramid was built from; leaf
+        // cells are intersected against the same two triangles per cell
+        // the mesh builder emits. On a hit, outT receives the ray
+        // parameter (position = origin + direction * outT).
+        bool Raycast(const glm::vec3 &origin, const glm::vec3 &direction,
+                     float tMin, float tMax,
+                     const std::vector<float> &heightmap, float &outT) const;
+
+    private:
+        struct Level
+        {
+            int width = 0; // Nodes along X
+            int depth = 0; // Nodes along Z
+            std::vector<float> minH;
+            std::vector<float> maxH;
+        };
+
+        bool RaycastNode(int level, int x, int z,
+                         const glm::vec3 &origin, const glm::vec3 &direction,
+                         const glm::vec3 &invDir, float tMin, float tMax,
+                         const std::vector<float> &heightmap, float &outT) const;
+
+        // Exact leaf test: the cell's two triangles
+        bool RaycastCell(int cellX, int cellZ,
+                         const glm::vec3 &origin, const glm::vec3 &direction,
+                         float tMin, float tMax,
+                         const std::vector<float> &heightmap, float &outT) const;
+
+        int m_SampleWidth = 0; // Heightmap samples along X
+        int m_SampleDepth = 0;
+        float m_CellSize = 1.0f;
+
+        // m_Levels[0] has one node per cell; each following level halves
+        // the node count (rounding up), the last level is a single root
+        std::vector<Level> m_Levels;
+    };
+
+}
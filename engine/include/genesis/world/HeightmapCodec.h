@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Genesis
+{
+
+    // Compressed heightmap held in RAM for chunks outside the active ring.
+    // Rows are delta-encoded against the previously decoded sample and the
+    // deltas stored as half floats, with runs of repeated deltas
+    // run-length encoded - flat regions (ocean, plains) collapse to a few
+    // tokens. The encoder accumulates against its own decoded output, so
+    // error stays bounded at half-float delta precision instead of
+    // drifting across a row.
+    struct CompressedHeightmap
+    {
+        std::vector<uint16_t> Tokens;
+        int Width = 0;
+        int Depth = 0;
+
+        bool Empty() const { return Tokens.empty(); }
+        size_t SizeBytes() const { return Tokens.capacity() * sizeof(uint16_t); }
+    };
+
+    namespace HeightmapCodec
+    {
+        CompressedHeightmap Compress(const std::vector<float> &heightmap, int width, int depth);
+        std::vector<float> Decompress(const CompressedHeightmap &compressed);
+    }
+
+}
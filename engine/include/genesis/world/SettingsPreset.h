@@ -0,0 +1,45 @@
+#pragma once
+
+#include "genesis/world/ChunkManager.h"
+
+#include <string>
+#include <vector>
+
+namespace Genesis
+{
+
+    // Versioned binary serialization of WorldSettings (including the full
+    // TerrainSettings block) for named preset files. Fields are written
+    // individually in a fixed order, never as a struct dump, so padding and
+    // layout changes can't corrupt saved presets; unknown future fields are
+    // covered by the version bump rule (append fields, bump the version,
+    // old loaders reject newer files, new loaders default missing fields).
+    //
+    // Floats round-trip bit-exactly, and the header stores the same
+    // settings hash the chunk disk cache keys its region files on
+    // (ChunkCache::HashSettings), so loading a preset lands on the exact
+    // hash its chunks were baked under and the cache stays warm across
+    // preset switches.
+    class SettingsPreset
+    {
+    public:
+        // Write settings to path (parent directories are created).
+        // Returns false on I/O failure.
+        static bool Save(const std::string &path, const WorldSettings &settings);
+
+        // Read a preset into outSettings, which keeps its defaults for any
+        // field the file's version predates. Recomputes the derived sea
+        // level. Returns false on I/O failure, bad magic, or a newer
+        // version than this build understands.
+        static bool Load(const std::string &path, WorldSettings &outSettings);
+
+        // Preset names (file stems) found in directory, sorted.
+        static std::vector<std::string> List(const std::string &directory);
+
+        // Path of a named preset inside directory.
+        static std::string PathFor(const std::string &directory, const std::string &name);
+
+        static constexpr const char *FILE_EXTENSION = ".gpreset";
+    };
+
+}
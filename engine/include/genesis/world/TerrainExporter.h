@@ -0,0 +1,62 @@
+#pragma once
+
+#include "genesis/world/ChunkManager.h"
+
+#include <cstdint>
+#include <string>
+
+namespace Genesis
+{
+
+    // Tiled export of the procedural terrain to image files for external
+    // tools (DCC packages, other engines). The world is walked tile by
+    // tile through TerrainGenerator::GenerateHeightmapAtOffset and
+    // MaterialBlender, so the output matches what the runtime generates,
+    // and each tile streams straight to disk: memory use is bounded by
+    // tile size regardless of how large the exported world is, and tiles
+    // are generated in parallel on the job system.
+    //
+    // Heightmaps are 16-bit grayscale PNGs normalized over the full
+    // height range (ocean floor to peak); splatmaps are 8-bit RGBA PNGs
+    // storing the packed dominant material pair per cell
+    // (R = primary id, G = secondary id, B = blend, A = 255), matching
+    // PackedMaterial rather than a fixed four-channel weight layout.
+    // The PNG encoder is self-contained (stored deflate blocks), keeping
+    // the engine free of image library dependencies.
+    //
+    // Reached via `terragen --export [N]`.
+    class TerrainExporter
+    {
+    public:
+        struct ExportSettings
+        {
+            std::string directory = "export";
+
+            // Exported world side length in cells, centered on the origin
+            int worldSize = 8192;
+
+            // Cells per tile side; each tile becomes one file pair
+            int tileSize = 1024;
+
+            bool exportHeight = true;
+            bool exportSplat = true;
+        };
+
+        struct Report
+        {
+            int tilesWritten = 0;
+            double totalSeconds = 0.0;
+            uint64_t bytesWritten = 0;
+        };
+
+        // Generate and write every tile. Adjacent tiles sample the same
+        // world-space noise, so edges line up seamlessly when stitched.
+        static Report Run(const WorldSettings &world, const ExportSettings &settings);
+
+        // CLI entry point: initializes logging and the job system, exports
+        // a worldSize x worldSize world with default settings, logs the
+        // report. Returns a process exit code.
+        static int RunStandalone(int worldSize = 8192);
+    };
+
+}
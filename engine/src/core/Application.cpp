@@ -1,18 +1,26 @@
 #include "genesis/core/Application.h"
 #include "genesis/core/Window.h"
 #include "genesis/core/Log.h"
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/FrameScheduler.h"
+#include "genesis/core/Input.h"
 #include "genesis/core/Layer.h"
 #include "genesis/renderer/Renderer.h"
 #include "genesis/imgui/ImGuiLayer.h"
+#include "genesis/core/MemoryTracker.h"
 
 #include <GLFW/glfw3.h>
 #include <chrono>
+#include <thread>
 
 namespace Genesis
 {
 
     Application *Application::s_Instance = nullptr;
 
+    // Most fixed ticks one frame may run before the backlog is dropped
+    static constexpr int MAX_FIXED_STEPS = 4;
+
     // LayerStack implementation
     class LayerStack
     {
@@ -63,6 +71,8 @@ namespace Genesis
 
         std::vector<Layer *>::iterator begin() { return m_Layers.begin(); }
         std::vector<Layer *>::iterator end() { return m_Layers.end(); }
+        std::vector<Layer *>::reverse_iterator rbegin() { return m_Layers.rbegin(); }
+        std::vector<Layer *>::reverse_iterator rend() { return m_Layers.rend(); }
 
         Layer *FindImGuiLayer()
         {
@@ -88,16 +98,28 @@ namespace Genesis
         Log::Init();
         GEN_INFO("Genesis Engine v0.1.0 initializing...");
 
+        JobSystem::Init();
+
         m_Window = Window::Create(config.Window);
         m_LayerStack = std::make_unique<LayerStack>();
+        m_Scheduler = std::make_unique<FrameScheduler>();
         m_Renderer = std::make_unique<Renderer>();
-        m_Renderer->Init(*m_Window);
 
-        GEN_INFO("Genesis Engine initialized successfully!");
+        // Phased startup: the window is up, so run the full Vulkan
+        // bring-up (instance, device, swapchain, pipelines) on a worker
+        // while the main thread returns to the client and pumps events.
+        // Run() joins before the first layer touches the renderer.
+        m_RendererInit = std::make_unique<JobCounter>();
+        JobSystem::Get().Execute([this] { m_Renderer->Init(*m_Window); },
+                                 m_RendererInit.get());
     }
 
     Application::~Application()
     {
+        // If the client tore down before Run(), the renderer may still be
+        // initializing on a worker
+        WaitForRendererInit();
+
         OnShutdown();
 
         // Destroy layers first (they may hold GPU resources)
@@ -108,12 +130,32 @@ namespace Genesis
         m_Renderer.reset();
 
         m_Window.reset();
+        JobSystem::Shutdown();
         Log::Shutdown();
         s_Instance = nullptr;
     }
 
+    void Application::WaitForRendererInit()
+    {
+        if (!m_RendererInit)
+            return;
+
+        while (!m_RendererInit->IsZero())
+        {
+            m_Window->PollEvents();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        m_RendererInit.reset();
+
+        GEN_INFO("Genesis Engine initialized successfully!");
+    }
+
     void Application::Run()
     {
+        // Join the worker-thread Vulkan bring-up; OnInit and the layers
+        // below are the first code that touches the renderer
+        WaitForRendererInit();
+
         OnInit();
 
         auto lastTime = std::chrono::high_resolution_clock::now();
@@ -126,7 +168,8 @@ namespace Genesis
 
             ProcessEvents();
 
-            // Update layers
+            // Per-frame updates: input, cameras, streaming - anything
+            // that should track the display rate
             for (Layer *layer : *m_LayerStack)
             {
                 layer->OnUpdate(deltaTime);
@@ -134,6 +177,34 @@ namespace Genesis
 
             OnUpdate(deltaTime);
 
+            // Fixed-rate simulation: the accumulator carries leftover time
+            // across frames, so tick count and step size are independent of
+            // refresh rate. The step cap sheds backlog after a long stall
+            // instead of spiraling (each extra tick would lengthen the
+            // frame that is already late).
+            m_FixedAccumulator += deltaTime;
+            int fixedSteps = 0;
+            while (m_FixedAccumulator >= m_FixedTimestep && fixedSteps < MAX_FIXED_STEPS)
+            {
+                for (Layer *layer : *m_LayerStack)
+                {
+                    layer->OnFixedUpdate(m_FixedTimestep);
+                }
+                OnFixedUpdate(m_FixedTimestep);
+
+                m_FixedAccumulator -= m_FixedTimestep;
+                fixedSteps++;
+            }
+            if (m_FixedAccumulator >= m_FixedTimestep)
+            {
+                m_FixedAccumulator = m_FixedTimestep;
+            }
+            m_FixedAlpha = m_FixedAccumulator / m_FixedTimestep;
+
+            // Drain budgeted background work (mesh uploads, stitching,
+            // regeneration steps); leftovers carry to the next frame
+            m_Scheduler->Execute();
+
             // Render - only if BeginFrame succeeds (swapchain might be recreating)
             if (m_Renderer->BeginFrame())
             {
@@ -146,6 +217,7 @@ namespace Genesis
                 Layer *imguiLayerBase = m_LayerStack->FindImGuiLayer();
                 if (imguiLayerBase)
                 {
+                    GEN_MEM_SCOPE(MemoryTag::UI);
                     ImGuiLayer *imguiLayer = static_cast<ImGuiLayer *>(imguiLayerBase);
                     imguiLayer->Begin();
                     for (Layer *layer : *m_LayerStack)
@@ -157,6 +229,9 @@ namespace Genesis
 
                 m_Renderer->EndFrame();
             }
+
+            // Latch per-frame allocation counts for the performance HUD
+            MemoryTracker::EndFrame();
         }
     }
 
@@ -178,6 +253,30 @@ namespace Genesis
     void Application::ProcessEvents()
     {
         m_Window->PollEvents();
+
+        // Publish this frame's input snapshot; all Input queries (on any
+        // thread) read it instead of the live GLFW state
+        Input::CaptureSnapshot();
+
+        // Dispatch the frame's queued events, overlays first so the UI can
+        // mark events handled before the layers beneath see them. The
+        // window coalesced continuous events at enqueue time, so this loop
+        // is bounded per frame regardless of device report rate.
+        m_Window->DrainEvents(m_FrameEvents);
+        for (Event &event : m_FrameEvents)
+        {
+            for (auto it = m_LayerStack->rbegin(); it != m_LayerStack->rend(); ++it)
+            {
+                (*it)->OnEvent(event);
+                if (event.Handled)
+                    break;
+            }
+
+            if (event.Type == EventType::WindowClosed && !event.Handled)
+            {
+                m_Running = false;
+            }
+        }
     }
 
 }
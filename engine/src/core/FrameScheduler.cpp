@@ -0,0 +1,63 @@
+#include "genesis/core/FrameScheduler.h"
+#include "genesis/core/Log.h"
+
+#include <chrono>
+
+namespace Genesis {
+
+    void FrameScheduler::Enqueue(Task task, const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Tasks.push_back({std::move(task), name});
+    }
+
+    void FrameScheduler::Execute() {
+        using Clock = std::chrono::steady_clock;
+
+        auto start = Clock::now();
+        auto budget = std::chrono::duration<float, std::milli>(m_BudgetMs);
+
+        // Cap the pass at the tasks queued when it started; tasks enqueued
+        // or re-queued during the pass wait for the next frame, so a task
+        // that yields (or spawns follow-ups) cannot spin the loop forever
+        size_t remaining;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            remaining = m_Tasks.size();
+        }
+
+        while (remaining > 0) {
+            ScheduledTask task;
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                if (m_Tasks.empty())
+                    break;
+                task = std::move(m_Tasks.front());
+                m_Tasks.pop_front();
+            }
+            remaining--;
+
+            auto taskStart = Clock::now();
+            bool done = task.Work();
+            auto taskMs = std::chrono::duration<float, std::milli>(Clock::now() - taskStart);
+
+            if (taskMs > budget) {
+                GEN_TRACE("FrameScheduler: task '{}' ran {}ms, over the {}ms budget - split it into smaller steps",
+                          task.Name, taskMs.count(), m_BudgetMs);
+            }
+
+            if (!done) {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Tasks.push_back(std::move(task));
+            }
+
+            if (Clock::now() - start >= budget)
+                break;
+        }
+    }
+
+    size_t FrameScheduler::GetPendingCount() const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Tasks.size();
+    }
+
+}
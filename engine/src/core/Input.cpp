@@ -4,25 +4,37 @@
 
 #include <GLFW/glfw3.h>
 
+#include <atomic>
+
 namespace Genesis {
 
+    namespace {
+
+        // Double buffer: the main thread fills the inactive slot and
+        // publishes its index with a release store; readers on any thread
+        // acquire-load the index and see a complete, coherent frame of
+        // input. Snapshots are immutable once published.
+        InputSnapshot s_Snapshots[2];
+        std::atomic<int> s_Published{0};
+
+    }
+
     bool Input::IsKeyPressed(int keycode) {
-        auto* window = Application::Get().GetWindow().GetNativeWindow();
-        auto state = glfwGetKey(window, keycode);
-        return state == GLFW_PRESS || state == GLFW_REPEAT;
+        const InputSnapshot& snapshot = GetSnapshot();
+        if (keycode < 0 || keycode >= static_cast<int>(snapshot.Keys.size()))
+            return false;
+        return snapshot.Keys[keycode];
     }
 
     bool Input::IsMouseButtonPressed(int button) {
-        auto* window = Application::Get().GetWindow().GetNativeWindow();
-        auto state = glfwGetMouseButton(window, button);
-        return state == GLFW_PRESS;
+        const InputSnapshot& snapshot = GetSnapshot();
+        if (button < 0 || button >= static_cast<int>(snapshot.MouseButtons.size()))
+            return false;
+        return snapshot.MouseButtons[button];
     }
 
     glm::vec2 Input::GetMousePosition() {
-        auto* window = Application::Get().GetWindow().GetNativeWindow();
-        double xPos, yPos;
-        glfwGetCursorPos(window, &xPos, &yPos);
-        return { static_cast<float>(xPos), static_cast<float>(yPos) };
+        return GetSnapshot().MousePosition;
     }
 
     float Input::GetMouseX() {
@@ -33,4 +45,30 @@ namespace Genesis {
         return GetMousePosition().y;
     }
 
+    const InputSnapshot& Input::GetSnapshot() {
+        return s_Snapshots[s_Published.load(std::memory_order_acquire)];
+    }
+
+    void Input::CaptureSnapshot() {
+        auto* window = Application::Get().GetWindow().GetNativeWindow();
+
+        int back = 1 - s_Published.load(std::memory_order_relaxed);
+        InputSnapshot& snapshot = s_Snapshots[back];
+
+        for (int key = GLFW_KEY_SPACE; key <= GLFW_KEY_LAST; key++) {
+            auto state = glfwGetKey(window, key);
+            snapshot.Keys[key] = (state == GLFW_PRESS || state == GLFW_REPEAT);
+        }
+
+        for (int button = 0; button <= GLFW_MOUSE_BUTTON_LAST; button++) {
+            snapshot.MouseButtons[button] = (glfwGetMouseButton(window, button) == GLFW_PRESS);
+        }
+
+        double xPos, yPos;
+        glfwGetCursorPos(window, &xPos, &yPos);
+        snapshot.MousePosition = {static_cast<float>(xPos), static_cast<float>(yPos)};
+
+        s_Published.store(back, std::memory_order_release);
+    }
+
 }
@@ -0,0 +1,263 @@
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Genesis
+{
+
+    JobSystem *JobSystem::s_Instance = nullptr;
+
+    void JobSystem::Init(uint32_t workerCount)
+    {
+        if (s_Instance)
+        {
+            return;
+        }
+
+        if (workerCount == 0)
+        {
+            uint32_t hardware = std::thread::hardware_concurrency();
+            workerCount = hardware > 1 ? hardware - 1 : 1;
+        }
+
+        s_Instance = new JobSystem();
+        s_Instance->StartWorkers(workerCount);
+
+        GEN_INFO("JobSystem: {} workers", workerCount);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        if (!s_Instance)
+        {
+            return;
+        }
+
+        s_Instance->StopWorkers();
+        delete s_Instance;
+        s_Instance = nullptr;
+    }
+
+    JobSystem &JobSystem::Get()
+    {
+        GEN_ASSERT(s_Instance, "JobSystem::Init has not been called!");
+        return *s_Instance;
+    }
+
+    bool JobSystem::IsInitialized()
+    {
+        return s_Instance != nullptr;
+    }
+
+    void JobSystem::StartWorkers(uint32_t workerCount)
+    {
+        m_Queues.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; i++)
+        {
+            m_Queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 0; i < workerCount; i++)
+        {
+            m_Workers.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    void JobSystem::StopWorkers()
+    {
+        m_Stop.store(true);
+        m_WakeCondition.notify_all();
+
+        for (auto &worker : m_Workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+        m_Workers.clear();
+        m_Queues.clear();
+    }
+
+    void JobSystem::WorkerLoop(uint32_t workerIndex)
+    {
+        Job job;
+        while (!m_Stop.load())
+        {
+            if (TryGetJob(workerIndex, job))
+            {
+                RunJob(job);
+                continue;
+            }
+
+            // Every queue came up empty; sleep until new work arrives
+            std::unique_lock<std::mutex> lock(m_WakeMutex);
+            m_WakeCondition.wait_for(lock, std::chrono::milliseconds(2));
+        }
+    }
+
+    void JobSystem::Enqueue(Job &&job)
+    {
+        // Round-robin keeps the queues evenly fed; stealing evens out
+        // whatever imbalance remains once jobs start varying in cost
+        uint32_t target = m_NextQueue.fetch_add(1) % static_cast<uint32_t>(m_Queues.size());
+        {
+            std::lock_guard<std::mutex> lock(m_Queues[target]->Mutex);
+            m_Queues[target]->Jobs.push_back(std::move(job));
+        }
+        m_WakeCondition.notify_one();
+    }
+
+    bool JobSystem::TryGetJob(uint32_t queueIndex, Job &outJob)
+    {
+        uint32_t queueCount = static_cast<uint32_t>(m_Queues.size());
+
+        // Own queue first, newest job first (best cache locality)
+        if (queueIndex < queueCount)
+        {
+            WorkerQueue &own = *m_Queues[queueIndex];
+            std::lock_guard<std::mutex> lock(own.Mutex);
+            if (!own.Jobs.empty())
+            {
+                outJob = std::move(own.Jobs.back());
+                own.Jobs.pop_back();
+                return true;
+            }
+        }
+
+        // Steal from the front of a sibling's queue - the oldest job, which
+        // its owner is least likely to touch next
+        uint32_t start = queueIndex < queueCount ? queueIndex + 1 : 0;
+        for (uint32_t i = 0; i < queueCount; i++)
+        {
+            WorkerQueue &victim = *m_Queues[(start + i) % queueCount];
+            std::lock_guard<std::mutex> lock(victim.Mutex);
+            if (!victim.Jobs.empty())
+            {
+                outJob = std::move(victim.Jobs.front());
+                victim.Jobs.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void JobSystem::RunJob(Job &job)
+    {
+        job.Function();
+        FinishJob(job.Counter);
+        job = Job{};
+    }
+
+    void JobSystem::FinishJob(JobCounter *counter)
+    {
+        if (!counter)
+        {
+            return;
+        }
+
+        if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // Last job of the group: release anything chained on us
+            std::vector<JobCounter::Followup> followups;
+            {
+                std::lock_guard<std::mutex> lock(counter->m_FollowupMutex);
+                followups.swap(counter->m_Followups);
+            }
+            for (auto &followup : followups)
+            {
+                Get().Execute(std::move(followup.Function), followup.Counter);
+            }
+        }
+    }
+
+    void JobSystem::Execute(std::function<void()> job, JobCounter *counter)
+    {
+        if (counter)
+        {
+            counter->m_Pending.fetch_add(1, std::memory_order_acq_rel);
+        }
+        Enqueue(Job{std::move(job), counter});
+    }
+
+    void JobSystem::ExecuteAfter(JobCounter &dependency, std::function<void()> job,
+                                 JobCounter *counter)
+    {
+        {
+            std::lock_guard<std::mutex> lock(dependency.m_FollowupMutex);
+            if (!dependency.IsZero())
+            {
+                // Register on the follow-up counter now, so a Wait issued
+                // before the dependency resolves still sees this job
+                if (counter)
+                {
+                    counter->m_Pending.fetch_add(1, std::memory_order_acq_rel);
+                }
+                dependency.m_Followups.push_back({std::move(job), counter});
+                return;
+            }
+        }
+
+        // Dependency already finished; run through the normal path
+        Execute(std::move(job), counter);
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t groupSize,
+                                const std::function<void(uint32_t)> &body)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        groupSize = std::max(groupSize, 1u);
+
+        // Small enough to not be worth the queue round trip
+        if (count <= groupSize || m_Workers.empty())
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                body(i);
+            }
+            return;
+        }
+
+        JobCounter counter;
+        for (uint32_t begin = 0; begin < count; begin += groupSize)
+        {
+            uint32_t end = std::min(begin + groupSize, count);
+            Execute([&body, begin, end]
+                    {
+                        for (uint32_t i = begin; i < end; i++)
+                        {
+                            body(i);
+                        }
+                    },
+                    &counter);
+        }
+        Wait(counter);
+    }
+
+    void JobSystem::Wait(JobCounter &counter)
+    {
+        // Work instead of sleeping: the caller drains queued jobs (its own
+        // ParallelFor batches included) until the group completes, so a
+        // fully busy pool can never deadlock a joining thread
+        Job job;
+        while (!counter.IsZero())
+        {
+            if (TryGetJob(~0u, job))
+            {
+                RunJob(job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+}
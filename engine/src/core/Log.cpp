@@ -1,65 +1,217 @@
 #include "genesis/core/Log.h"
-#include <iostream>
+#include <atomic>
+#include <chrono>
 #include <ctime>
 #include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace Genesis {
 
     LogLevel Log::s_LogLevel = LogLevel::Trace;
 
+    // Async backend: producers enqueue preformatted records into a
+    // lock-free bounded MPSC ring (Vyukov-style sequence numbers) and a
+    // background thread drains it to the console. Hot paths pay for the
+    // message formatting and one CAS; the localtime/iostream work happens
+    // off-thread. Fatal messages flush the ring and write synchronously so
+    // they survive the abort that usually follows.
+    namespace {
+
+        struct LogRecord {
+            LogLevel Level = LogLevel::Trace;
+            std::time_t Time = 0;
+            std::string Message;
+        };
+
+        constexpr size_t RING_SIZE = 1024; // Power of two
+        constexpr size_t RING_MASK = RING_SIZE - 1;
+
+        struct RingSlot {
+            std::atomic<size_t> Sequence{0};
+            LogRecord Record;
+        };
+
+        std::unique_ptr<RingSlot[]> s_Ring;
+        std::atomic<size_t> s_Head{0}; // Next slot to claim (producers)
+        std::atomic<size_t> s_Tail{0}; // Next slot to drain (consumer writes, Flush reads)
+
+        std::thread s_Consumer;
+        std::atomic<bool> s_Running{false};
+        std::atomic<size_t> s_Dropped{0};
+        std::mutex s_OutputMutex; // Serializes direct writes with the consumer
+
+        bool TryEnqueue(LogRecord&& record) {
+            size_t pos = s_Head.load(std::memory_order_relaxed);
+            for (;;) {
+                RingSlot& slot = s_Ring[pos & RING_MASK];
+                size_t seq = slot.Sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0) {
+                    if (s_Head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                } else if (diff < 0) {
+                    return false; // Ring full
+                } else {
+                    pos = s_Head.load(std::memory_order_relaxed);
+                }
+            }
+            RingSlot& slot = s_Ring[pos & RING_MASK];
+            slot.Record = std::move(record);
+            slot.Sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryDequeue(LogRecord& record) {
+            size_t tail = s_Tail.load(std::memory_order_relaxed);
+            RingSlot& slot = s_Ring[tail & RING_MASK];
+            size_t seq = slot.Sequence.load(std::memory_order_acquire);
+            if (seq != tail + 1)
+                return false;
+            record = std::move(slot.Record);
+            slot.Record.Message.clear();
+            slot.Sequence.store(tail + RING_SIZE, std::memory_order_release);
+            s_Tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        void WriteRecord(const LogRecord& record) {
+            auto tm = *std::localtime(&record.Time);
+
+            // Color codes for terminal
+            const char* colorCode = "\033[0m";
+            const char* levelStr = "UNKNOWN";
+
+            switch (record.Level) {
+                case LogLevel::Trace:
+                    colorCode = "\033[37m";  // White
+                    levelStr = "TRACE";
+                    break;
+                case LogLevel::Debug:
+                    colorCode = "\033[36m";  // Cyan
+                    levelStr = "DEBUG";
+                    break;
+                case LogLevel::Info:
+                    colorCode = "\033[32m";  // Green
+                    levelStr = "INFO";
+                    break;
+                case LogLevel::Warn:
+                    colorCode = "\033[33m";  // Yellow
+                    levelStr = "WARN";
+                    break;
+                case LogLevel::Error:
+                    colorCode = "\033[31m";  // Red
+                    levelStr = "ERROR";
+                    break;
+                case LogLevel::Fatal:
+                    colorCode = "\033[35m";  // Magenta
+                    levelStr = "FATAL";
+                    break;
+            }
+
+            std::cout << colorCode << "["
+                      << std::put_time(&tm, "%H:%M:%S") << "] "
+                      << "[" << levelStr << "] "
+                      << record.Message
+                      << "\033[0m" << "\n";
+        }
+
+        void DrainOnce() {
+            LogRecord record;
+            std::lock_guard<std::mutex> lock(s_OutputMutex);
+            while (TryDequeue(record)) {
+                WriteRecord(record);
+            }
+            size_t dropped = s_Dropped.exchange(0);
+            if (dropped > 0) {
+                LogRecord notice;
+                notice.Level = LogLevel::Warn;
+                notice.Time = std::time(nullptr);
+                notice.Message = "Log ring overflowed, dropped " + std::to_string(dropped) +
+                                 " message(s)";
+                WriteRecord(notice);
+            }
+            std::cout.flush();
+        }
+
+        void ConsumerLoop() {
+            while (s_Running.load()) {
+                DrainOnce();
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            // Final drain picks up anything enqueued during shutdown
+            DrainOnce();
+        }
+
+    }
+
     void Log::Init() {
         s_LogLevel = LogLevel::Trace;
+
+        if (s_Running.load())
+            return;
+
+        s_Ring = std::make_unique<RingSlot[]>(RING_SIZE);
+        for (size_t i = 0; i < RING_SIZE; i++) {
+            s_Ring[i].Sequence.store(i, std::memory_order_relaxed);
+        }
+        s_Head.store(0);
+        s_Tail.store(0);
+
+        s_Running.store(true);
+        s_Consumer = std::thread(ConsumerLoop);
     }
 
     void Log::Shutdown() {
-        // Cleanup if needed
+        if (!s_Running.load())
+            return;
+
+        s_Running.store(false);
+        if (s_Consumer.joinable())
+            s_Consumer.join();
+        s_Ring.reset();
     }
 
     void Log::SetLevel(LogLevel level) {
         s_LogLevel = level;
     }
 
+    void Log::Flush() {
+        if (!s_Running.load())
+            return;
+
+        // The consumer owns the tail; wait for it to catch up to everything
+        // published before this call
+        size_t target = s_Head.load(std::memory_order_acquire);
+        while (s_Tail.load(std::memory_order_acquire) < target && s_Running.load()) {
+            std::this_thread::yield();
+        }
+    }
+
     void Log::Output(LogLevel level, const std::string& message) {
-        // Get current time
-        auto now = std::time(nullptr);
-        auto tm = *std::localtime(&now);
-
-        // Color codes for terminal
-        const char* colorCode = "\033[0m";
-        const char* levelStr = "UNKNOWN";
-
-        switch (level) {
-            case LogLevel::Trace:
-                colorCode = "\033[37m";  // White
-                levelStr = "TRACE";
-                break;
-            case LogLevel::Debug:
-                colorCode = "\033[36m";  // Cyan
-                levelStr = "DEBUG";
-                break;
-            case LogLevel::Info:
-                colorCode = "\033[32m";  // Green
-                levelStr = "INFO";
-                break;
-            case LogLevel::Warn:
-                colorCode = "\033[33m";  // Yellow
-                levelStr = "WARN";
-                break;
-            case LogLevel::Error:
-                colorCode = "\033[31m";  // Red
-                levelStr = "ERROR";
-                break;
-            case LogLevel::Fatal:
-                colorCode = "\033[35m";  // Magenta
-                levelStr = "FATAL";
-                break;
+        LogRecord record;
+        record.Level = level;
+        record.Time = std::time(nullptr);
+        record.Message = message;
+
+        // Fatal is about to abort the process: flush the backlog so the
+        // output keeps its order, then write this record synchronously
+        if (level == LogLevel::Fatal || !s_Running.load()) {
+            if (s_Running.load())
+                Flush();
+            std::lock_guard<std::mutex> lock(s_OutputMutex);
+            WriteRecord(record);
+            std::cout.flush();
+            return;
         }
 
-        std::cout << colorCode << "["
-                  << std::put_time(&tm, "%H:%M:%S") << "] "
-                  << "[" << levelStr << "] "
-                  << message
-                  << "\033[0m" << std::endl;
+        if (!TryEnqueue(std::move(record))) {
+            // Ring full under a logging burst; dropping beats stalling the
+            // frame, and the consumer reports the count
+            s_Dropped.fetch_add(1);
+        }
     }
 
 }
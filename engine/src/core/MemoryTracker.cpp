@@ -0,0 +1,213 @@
+#include "genesis/core/MemoryTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Genesis {
+
+    namespace {
+
+        constexpr uint32_t TAG_COUNT = static_cast<uint32_t>(MemoryTag::Count);
+        constexpr uint32_t MAX_SCOPE_DEPTH = 8;
+
+        // Constant-initialized so the counters are valid before any static
+        // constructor runs (the replaced operator new is live from the very
+        // first allocation in the process)
+        struct TagCounters {
+            std::atomic<uint64_t> CurrentBytes{0};
+            std::atomic<uint64_t> PeakBytes{0};
+            std::atomic<uint64_t> FrameAllocations{0};
+            std::atomic<uint64_t> LatchedFrameAllocations{0};
+            std::atomic<uint64_t> TotalAllocations{0};
+        };
+
+        TagCounters s_Counters[TAG_COUNT];
+
+        thread_local MemoryTag t_TagStack[MAX_SCOPE_DEPTH];
+        thread_local uint32_t t_TagDepth = 0;
+
+        const char* const s_TagNames[TAG_COUNT] = {
+            "Untagged", "Renderer", "ChunkManager", "Hydrology", "ECS", "UI",
+        };
+
+    }
+
+    void MemoryTracker::PushTag(MemoryTag tag) {
+        if (t_TagDepth < MAX_SCOPE_DEPTH) {
+            t_TagStack[t_TagDepth] = tag;
+        }
+        t_TagDepth++;
+    }
+
+    void MemoryTracker::PopTag() {
+        if (t_TagDepth > 0) {
+            t_TagDepth--;
+        }
+    }
+
+    MemoryTag MemoryTracker::CurrentTag() {
+        if (t_TagDepth == 0) {
+            return MemoryTag::Untagged;
+        }
+        uint32_t top = t_TagDepth <= MAX_SCOPE_DEPTH ? t_TagDepth : MAX_SCOPE_DEPTH;
+        return t_TagStack[top - 1];
+    }
+
+    void MemoryTracker::OnAlloc(size_t bytes, MemoryTag tag) {
+        TagCounters& counters = s_Counters[static_cast<uint32_t>(tag)];
+        uint64_t current = counters.CurrentBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        counters.FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        // Monotonic max; racing updates settle on the true peak
+        uint64_t peak = counters.PeakBytes.load(std::memory_order_relaxed);
+        while (current > peak &&
+               !counters.PeakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+        }
+    }
+
+    void MemoryTracker::OnFree(size_t bytes, MemoryTag tag) {
+        s_Counters[static_cast<uint32_t>(tag)].CurrentBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    MemoryTracker::TagStats MemoryTracker::GetStats(MemoryTag tag) {
+        const TagCounters& counters = s_Counters[static_cast<uint32_t>(tag)];
+        TagStats stats;
+        stats.CurrentBytes = counters.CurrentBytes.load(std::memory_order_relaxed);
+        stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+        stats.FrameAllocations = counters.LatchedFrameAllocations.load(std::memory_order_relaxed);
+        stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    const char* MemoryTracker::TagName(MemoryTag tag) {
+        return s_TagNames[static_cast<uint32_t>(tag)];
+    }
+
+    void MemoryTracker::EndFrame() {
+        for (TagCounters& counters : s_Counters) {
+            counters.LatchedFrameAllocations.store(
+                counters.FrameAllocations.exchange(0, std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+    }
+
+}
+
+#if GEN_ENABLE_MEMORY_TRACKING
+
+// Global operator new/delete replacements. Each block is over-allocated
+// by a 32-byte header recording the requested size, the tag it was
+// charged to, and the raw base pointer (the user pointer shifts for
+// over-aligned requests), so frees debit the right bucket regardless of
+// which thread or scope releases the block. Foreign pointers (from
+// malloc in third-party code) never reach these - operator delete only
+// pairs with operator new, which is replaced for the whole process.
+namespace {
+
+    constexpr size_t HEADER_SIZE = 32;
+    constexpr uint32_t HEADER_MAGIC = 0x47454E4Du; // 'GENM'
+
+    struct AllocationHeader {
+        void* Base;
+        size_t Size;
+        uint32_t Tag;
+        uint32_t Magic;
+    };
+
+    static_assert(sizeof(AllocationHeader) <= HEADER_SIZE,
+                  "Allocation header must fit the reserved prefix");
+
+    void* TrackedAlloc(size_t size, size_t alignment) {
+        size_t slack = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+        void* base = std::malloc(size + slack + sizeof(AllocationHeader));
+        if (!base) {
+            return nullptr;
+        }
+
+        // First aligned address leaving room for the header in front
+        uintptr_t raw = reinterpret_cast<uintptr_t>(base) + sizeof(AllocationHeader);
+        uintptr_t user = (raw + slack - 1) & ~(static_cast<uintptr_t>(slack) - 1);
+
+        auto* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+        header->Base = base;
+        header->Size = size;
+        header->Tag = static_cast<uint32_t>(Genesis::MemoryTracker::CurrentTag());
+        header->Magic = HEADER_MAGIC;
+
+        Genesis::MemoryTracker::OnAlloc(size, static_cast<Genesis::MemoryTag>(header->Tag));
+        return reinterpret_cast<void*>(user);
+    }
+
+    void TrackedFree(void* ptr) {
+        if (!ptr) {
+            return;
+        }
+        auto* header = reinterpret_cast<AllocationHeader*>(ptr) - 1;
+        if (header->Magic != HEADER_MAGIC) {
+            // Not ours (allocated before these hooks were linked in some
+            // translation unit mix); better to leak the accounting than
+            // to free a bogus base pointer
+            std::free(ptr);
+            return;
+        }
+        header->Magic = 0;
+        Genesis::MemoryTracker::OnFree(header->Size, static_cast<Genesis::MemoryTag>(header->Tag));
+        std::free(header->Base);
+    }
+
+}
+
+void* operator new(size_t size) {
+    void* ptr = TrackedAlloc(size, alignof(std::max_align_t));
+    if (!ptr) {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    void* ptr = TrackedAlloc(size, alignof(std::max_align_t));
+    if (!ptr) {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    void* ptr = TrackedAlloc(size, static_cast<size_t>(alignment));
+    if (!ptr) {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    void* ptr = TrackedAlloc(size, static_cast<size_t>(alignment));
+    if (!ptr) {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAlloc(size, alignof(std::max_align_t));
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAlloc(size, alignof(std::max_align_t));
+}
+
+void operator delete(void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+
+#endif // GEN_ENABLE_MEMORY_TRACKING
@@ -0,0 +1,115 @@
+#include "genesis/core/Profiler.h"
+#include "genesis/core/Log.h"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Genesis {
+
+    namespace {
+
+        // One ring per thread, registered on first use and kept alive for
+        // the process lifetime so DumpTrace can read rings of threads that
+        // have already exited. Only the owning thread writes; DumpTrace
+        // reads without stopping writers, which can tear the handful of
+        // events being written during the dump - acceptable for a profiler.
+        constexpr size_t RING_CAPACITY = 16384; // Per thread
+
+        struct ThreadRing {
+            uint32_t ThreadID = 0;
+            std::vector<Profiler::Event> Events{RING_CAPACITY};
+            std::atomic<uint64_t> Written{0}; // Total events ever recorded
+        };
+
+        std::mutex s_RegistryMutex;
+        std::vector<ThreadRing*> s_Registry;
+        std::atomic<uint32_t> s_NextThreadID{0};
+
+        ThreadRing& GetThreadRing() {
+            // Leaked deliberately: rings outlive their threads so a dump
+            // after a worker exits still sees its events
+            thread_local ThreadRing* t_Ring = [] {
+                auto* ring = new ThreadRing();
+                ring->ThreadID = s_NextThreadID.fetch_add(1);
+                std::lock_guard<std::mutex> lock(s_RegistryMutex);
+                s_Registry.push_back(ring);
+                return ring;
+            }();
+            return *t_Ring;
+        }
+
+    }
+
+    void Profiler::Record(const char* name, uint64_t startUs, uint64_t endUs) {
+        ThreadRing& ring = GetThreadRing();
+        uint64_t written = ring.Written.load(std::memory_order_relaxed);
+        Event& slot = ring.Events[written % RING_CAPACITY];
+        slot.Name = name;
+        slot.StartUs = startUs;
+        slot.EndUs = endUs;
+        ring.Written.store(written + 1, std::memory_order_release);
+    }
+
+    bool Profiler::DumpTrace(const std::string& path) {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            GEN_ERROR("Profiler: failed to open trace file '{}'", path);
+            return false;
+        }
+
+        file << "{\"traceEvents\":[";
+
+        std::lock_guard<std::mutex> lock(s_RegistryMutex);
+        bool first = true;
+        size_t total = 0;
+        for (const ThreadRing* ring : s_Registry) {
+            uint64_t written = ring->Written.load(std::memory_order_acquire);
+            uint64_t count = written < RING_CAPACITY ? written : RING_CAPACITY;
+            uint64_t begin = written - count;
+
+            for (uint64_t i = begin; i < written; i++) {
+                const Event& event = ring->Events[i % RING_CAPACITY];
+                if (!event.Name || event.EndUs < event.StartUs)
+                    continue; // Slot torn by a concurrent write
+
+                if (!first)
+                    file << ",";
+                first = false;
+
+                file << "{\"name\":\"" << event.Name
+                     << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << ring->ThreadID
+                     << ",\"ts\":" << event.StartUs
+                     << ",\"dur\":" << (event.EndUs - event.StartUs) << "}";
+                total++;
+            }
+        }
+
+        file << "]}";
+
+        GEN_INFO("Profiler: wrote {} events from {} thread(s) to '{}'",
+                 total, s_Registry.size(), path);
+        return true;
+    }
+
+    void Profiler::Collect(std::vector<Event>& out, uint64_t sinceUs) {
+        std::lock_guard<std::mutex> lock(s_RegistryMutex);
+        for (const ThreadRing* ring : s_Registry) {
+            uint64_t written = ring->Written.load(std::memory_order_acquire);
+            uint64_t count = written < RING_CAPACITY ? written : RING_CAPACITY;
+            uint64_t begin = written - count;
+
+            for (uint64_t i = begin; i < written; i++) {
+                const Event& event = ring->Events[i % RING_CAPACITY];
+                if (!event.Name || event.EndUs < event.StartUs)
+                    continue; // Slot torn by a concurrent write
+                if (event.StartUs < sinceUs)
+                    continue;
+                out.push_back(event);
+            }
+        }
+    }
+
+}
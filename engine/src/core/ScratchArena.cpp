@@ -0,0 +1,60 @@
+#include "genesis/core/ScratchArena.h"
+
+namespace Genesis
+{
+
+    ScratchArena &ScratchArena::Get()
+    {
+        static thread_local ScratchArena s_Arena;
+        return s_Arena;
+    }
+
+    void *ScratchArena::Allocate(size_t size, size_t alignment)
+    {
+        if (size == 0)
+        {
+            size = 1;
+        }
+
+        while (true)
+        {
+            if (m_BlockIndex == m_Blocks.size())
+            {
+                Block block;
+                block.Size = size > BLOCK_SIZE ? size : BLOCK_SIZE;
+                block.Data = std::make_unique<uint8_t[]>(block.Size);
+                m_Blocks.push_back(std::move(block));
+            }
+
+            Block &block = m_Blocks[m_BlockIndex];
+            size_t aligned = (m_Offset + alignment - 1) & ~(alignment - 1);
+            if (aligned + size <= block.Size)
+            {
+                m_Offset = aligned + size;
+                return block.Data.get() + aligned;
+            }
+
+            // Block exhausted: move on, reusing a later block from an
+            // earlier high-water mark if one exists
+            m_BlockIndex++;
+            m_Offset = 0;
+        }
+    }
+
+    void ScratchArena::Rewind(const Marker &marker)
+    {
+        m_BlockIndex = marker.Block;
+        m_Offset = marker.Offset;
+    }
+
+    size_t ScratchArena::CapacityBytes() const
+    {
+        size_t total = 0;
+        for (const Block &block : m_Blocks)
+        {
+            total += block.Size;
+        }
+        return total;
+    }
+
+}
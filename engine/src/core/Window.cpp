@@ -70,6 +70,11 @@ namespace Genesis {
         glfwPollEvents();
     }
 
+    void Window::DrainEvents(std::vector<Event>& out) {
+        out.clear();
+        out.swap(m_Data.EventQueue);
+    }
+
     void Window::SetVSync(bool enabled) {
         // VSync is handled by Vulkan swapchain present mode
         m_Data.VSync = enabled;
@@ -79,31 +84,72 @@ namespace Genesis {
         return glfwWindowShouldClose(m_Window);
     }
 
+    // Callbacks only enqueue; dispatch happens once per frame when the
+    // application drains the queue. Continuous events coalesce here so a
+    // high-report-rate mouse costs one queue entry per frame, not one
+    // dispatch chain per hardware report.
     void Window::SetupCallbacks() {
         glfwSetWindowSizeCallback(m_Window, [](GLFWwindow* window, int width, int height) {
             WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
             data.Width = width;
             data.Height = height;
+
+            // Only the final size of a resize drag matters
+            if (!data.EventQueue.empty() && data.EventQueue.back().Type == EventType::WindowResized) {
+                data.EventQueue.back().Resize = {data.Width, data.Height};
+                return;
+            }
+            Event event(EventType::WindowResized);
+            event.Resize = {data.Width, data.Height};
+            data.EventQueue.push_back(event);
         });
 
         glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window) {
-            // Window close event
+            WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+            data.EventQueue.push_back(Event(EventType::WindowClosed));
         });
 
         glfwSetKeyCallback(m_Window, [](GLFWwindow* window, int key, int scancode, int action, int mods) {
-            // Key events
+            WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+            Event event(action == GLFW_RELEASE ? EventType::KeyReleased : EventType::KeyPressed);
+            event.Key = {key, mods, action == GLFW_REPEAT};
+            data.EventQueue.push_back(event);
         });
 
         glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* window, int button, int action, int mods) {
-            // Mouse button events
+            WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+            Event event(action == GLFW_RELEASE ? EventType::MouseButtonReleased
+                                               : EventType::MouseButtonPressed);
+            event.MouseButton = {button, mods};
+            data.EventQueue.push_back(event);
         });
 
         glfwSetScrollCallback(m_Window, [](GLFWwindow* window, double xOffset, double yOffset) {
-            // Scroll events
+            WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+
+            // Merge consecutive scroll ticks into one accumulated delta
+            if (!data.EventQueue.empty() && data.EventQueue.back().Type == EventType::MouseScrolled) {
+                data.EventQueue.back().Scroll.XOffset += static_cast<float>(xOffset);
+                data.EventQueue.back().Scroll.YOffset += static_cast<float>(yOffset);
+                return;
+            }
+            Event event(EventType::MouseScrolled);
+            event.Scroll = {static_cast<float>(xOffset), static_cast<float>(yOffset)};
+            data.EventQueue.push_back(event);
         });
 
         glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xPos, double yPos) {
-            // Cursor position events
+            WindowData& data = *static_cast<WindowData*>(glfwGetWindowUserPointer(window));
+
+            // Consecutive moves collapse to the latest position; anything
+            // that cares about the path samples the per-frame snapshot
+            if (!data.EventQueue.empty() && data.EventQueue.back().Type == EventType::MouseMoved) {
+                data.EventQueue.back().MouseMove = {static_cast<float>(xPos), static_cast<float>(yPos)};
+                return;
+            }
+            Event event(EventType::MouseMoved);
+            event.MouseMove = {static_cast<float>(xPos), static_cast<float>(yPos)};
+            data.EventQueue.push_back(event);
         });
     }
 
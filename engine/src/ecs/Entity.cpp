@@ -7,7 +7,7 @@ namespace Genesis {
         : m_EntityID(id), m_Scene(scene) {
     }
 
-    // Template implementations would go here for a full ECS
-    // For now, this is a placeholder for the skeleton
+    // Component access templates are defined at the bottom of Scene.h,
+    // where the full Scene definition is available
 
 }
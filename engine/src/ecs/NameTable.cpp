@@ -0,0 +1,98 @@
+#include "genesis/ecs/NameTable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <mutex>
+#include <unordered_map>
+
+namespace Genesis {
+
+    namespace {
+
+        struct Entry {
+            std::string Name;
+            std::string Lower;
+        };
+
+        // Entries live in fixed-size chunks published through atomics, so
+        // Resolve never takes the intern lock: a handle only exists after
+        // its entry (and its chunk pointer) were stored with release order.
+        constexpr uint32_t CHUNK_SIZE = 1024;
+        constexpr uint32_t MAX_CHUNKS = 4096;
+
+        std::atomic<Entry*> s_Chunks[MAX_CHUNKS];
+        std::atomic<uint32_t> s_Count{0};
+
+        std::mutex s_InternMutex;
+        // Keys view the stored entry strings, which never move or free
+        std::unordered_map<std::string_view, uint32_t>& LookupMap() {
+            static std::unordered_map<std::string_view, uint32_t> s_Lookup;
+            return s_Lookup;
+        }
+
+        Entry& EntryAt(uint32_t index) {
+            return s_Chunks[index / CHUNK_SIZE].load(std::memory_order_acquire)[index % CHUNK_SIZE];
+        }
+
+        uint32_t InternLocked(std::string_view name) {
+            auto& lookup = LookupMap();
+            auto it = lookup.find(name);
+            if (it != lookup.end()) {
+                return it->second;
+            }
+
+            uint32_t index = s_Count.load(std::memory_order_relaxed);
+            uint32_t chunk = index / CHUNK_SIZE;
+            if (chunk >= MAX_CHUNKS) {
+                // Out of handle space; alias everything past the cap to the
+                // last interned name rather than crash
+                return index - 1;
+            }
+            if (s_Chunks[chunk].load(std::memory_order_relaxed) == nullptr) {
+                s_Chunks[chunk].store(new Entry[CHUNK_SIZE], std::memory_order_release);
+            }
+
+            Entry& entry = EntryAt(index);
+            entry.Name.assign(name);
+            entry.Lower.resize(name.size());
+            std::transform(name.begin(), name.end(), entry.Lower.begin(),
+                           [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+            lookup.emplace(std::string_view(entry.Name), index);
+            s_Count.store(index + 1, std::memory_order_release);
+            return index;
+        }
+
+    }
+
+    NameHandle NameTable::Intern(std::string_view name) {
+        std::lock_guard<std::mutex> lock(s_InternMutex);
+        // Handle 0 is always the empty string so default handles resolve
+        if (s_Count.load(std::memory_order_relaxed) == 0) {
+            InternLocked(std::string_view());
+        }
+        return {InternLocked(name)};
+    }
+
+    const std::string& NameTable::Resolve(NameHandle handle) {
+        if (handle.Index >= s_Count.load(std::memory_order_acquire)) {
+            static const std::string empty;
+            return empty;
+        }
+        return EntryAt(handle.Index).Name;
+    }
+
+    const std::string& NameTable::ResolveLower(NameHandle handle) {
+        if (handle.Index >= s_Count.load(std::memory_order_acquire)) {
+            static const std::string empty;
+            return empty;
+        }
+        return EntryAt(handle.Index).Lower;
+    }
+
+    size_t NameTable::UniqueNameCount() {
+        return s_Count.load(std::memory_order_acquire);
+    }
+
+}
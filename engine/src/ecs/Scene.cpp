@@ -1,12 +1,40 @@
 #include "genesis/ecs/Scene.h"
-#include "genesis/ecs/Entity.h"
 #include "genesis/ecs/Components.h"
 #include "genesis/renderer/Renderer.h"
+#include "genesis/core/MemoryTracker.h"
+
+#include <algorithm>
 
 namespace Genesis {
 
     Scene::Scene(const std::string& name)
         : m_Name(name) {
+        // Built-in system: rebuild stale transform caches in bulk before
+        // anything reads them, striding the dense pool across the workers.
+        // Render submission then only ever copies matrices.
+        m_Systems.Register("TransformCache", 0, ComponentMask<TransformComponent>(),
+                           [](Scene& scene, float) {
+            ComponentPool<TransformComponent>& pool = scene.m_Registry.Pool<TransformComponent>();
+            uint32_t count = static_cast<uint32_t>(pool.Size());
+            if (count == 0) {
+                return;
+            }
+
+            TransformComponent* transforms = pool.Data();
+            auto refresh = [transforms](uint32_t i) {
+                if (transforms[i].CacheStale()) {
+                    transforms[i].RebuildCache();
+                }
+            };
+
+            if (JobSystem::IsInitialized() && count >= 64) {
+                JobSystem::Get().ParallelFor(count, 64, refresh);
+            } else {
+                for (uint32_t i = 0; i < count; i++) {
+                    refresh(i);
+                }
+            }
+        });
     }
 
     Scene::~Scene() {
@@ -14,54 +42,87 @@ namespace Genesis {
     }
 
     Entity Scene::CreateEntity(const std::string& name) {
-        uint64_t id = m_Registry.NextID++;
-        m_Registry.Entities.push_back({id, true, name.empty() ? "Entity" : name});
-        m_Components[id] = std::make_unique<EntityComponents>();
+        uint64_t id = m_NextID++;
+        m_Entities.push_back({id, true, NameTable::Intern(name.empty() ? "Entity" : name)});
+        m_EntityListVersion++;
+        return Entity(id, this);
+    }
+
+    Entity Scene::CreateEntityWithID(uint64_t id, const std::string& name) {
+        m_Entities.push_back({id, true, NameTable::Intern(name.empty() ? "Entity" : name)});
+        if (id >= m_NextID) {
+            m_NextID = id + 1;
+        }
+        m_EntityListVersion++;
         return Entity(id, this);
     }
 
+    const std::string& Scene::GetEntityName(uint64_t id) const {
+        return NameTable::Resolve(GetEntityNameHandle(id));
+    }
+
+    NameHandle Scene::GetEntityNameHandle(uint64_t id) const {
+        auto it = std::find_if(m_Entities.begin(), m_Entities.end(),
+            [&](const EntityData& e) { return e.ID == id; });
+        // A miss yields the default handle, which resolves to ""
+        return it != m_Entities.end() ? it->Name : NameHandle{};
+    }
+
     void Scene::DestroyEntity(Entity entity) {
-        auto it = std::find_if(m_Registry.Entities.begin(), m_Registry.Entities.end(),
+        auto it = std::find_if(m_Entities.begin(), m_Entities.end(),
             [&](const EntityData& e) { return e.ID == entity.GetID(); });
-        
-        if (it != m_Registry.Entities.end()) {
-            m_Registry.Entities.erase(it);
-            m_Components.erase(entity.GetID());
+
+        if (it != m_Entities.end()) {
+            m_Entities.erase(it);
+            m_Registry.RemoveAll(entity.GetID());
+            m_EntityListVersion++;
         }
     }
 
     void Scene::OnUpdate(float deltaTime) {
-        // Update systems here
-        // For now, just placeholder
+        GEN_MEM_SCOPE(MemoryTag::ECS);
+        m_Systems.Run(*this, deltaTime);
     }
 
     void Scene::OnRender(Renderer& renderer) {
-        // Find camera and render
-        // For now, just placeholder
+        // Submission reads straight out of the dense component pools; the
+        // transforms hand back cached world and normal matrices, so entities
+        // that have not moved cost two matrix copies and no math
+        m_Registry.Each<TransformComponent, MeshRendererComponent>(
+            [&](uint64_t, TransformComponent& transform, MeshRendererComponent& meshRenderer) {
+                if (!meshRenderer.Visible || !meshRenderer.MeshData) {
+                    return;
+                }
+                renderer.Draw(*meshRenderer.MeshData, transform.GetTransform(),
+                              transform.GetNormalMatrix());
+            });
     }
 
     void Scene::Clear() {
-        m_Registry.Entities.clear();
-        m_Components.clear();
+        m_Entities.clear();
+        m_Registry.Clear();
+        m_EntityListVersion++;
     }
 
     void Scene::CopyTo(Scene& other) {
         other.m_Name = m_Name + " (Copy)";
-        // Deep copy entities and components
+        other.m_Entities = m_Entities;
+        other.m_NextID = m_NextID;
+        other.m_EntityListVersion++;
+        m_Registry.CopyInto(other.m_Registry);
     }
 
-    // EntityComponents storage (simple implementation)
-    class EntityComponents {
-    public:
-        std::optional<TagComponent> Tag;
-        std::optional<TransformComponent> Transform;
-        std::optional<MeshRendererComponent> MeshRenderer;
-        std::optional<CameraComponent> Camera;
-        std::optional<DirectionalLightComponent> DirectionalLight;
-        std::optional<PointLightComponent> PointLight;
-        std::optional<ProceduralMeshComponent> ProceduralMesh;
-        std::optional<RigidbodyComponent> Rigidbody;
-        std::optional<BoxColliderComponent> BoxCollider;
-    };
+    void Scene::TakeSnapshot(Snapshot& out) {
+        out.m_Entities = m_Entities;
+        out.m_NextID = m_NextID;
+        m_Registry.CopyInto(out.m_Registry);
+    }
+
+    void Scene::RestoreSnapshot(const Snapshot& snapshot) {
+        m_Entities = snapshot.m_Entities;
+        m_NextID = snapshot.m_NextID;
+        snapshot.m_Registry.CopyInto(m_Registry);
+        m_EntityListVersion++;
+    }
 
 }
@@ -0,0 +1,68 @@
+#include "genesis/ecs/SystemScheduler.h"
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/Profiler.h"
+
+namespace Genesis {
+
+    void SystemScheduler::Register(const char* name, uint64_t reads, uint64_t writes,
+                                   SystemFn update) {
+        m_Systems.push_back({name, reads, writes, std::move(update)});
+    }
+
+    bool SystemScheduler::Conflicts(const System& a, const System& b) {
+        return (a.Writes & (b.Reads | b.Writes)) != 0 ||
+               (b.Writes & (a.Reads | a.Writes)) != 0;
+    }
+
+    void SystemScheduler::Run(Scene& scene, float deltaTime) {
+        size_t first = 0;
+        while (first < m_Systems.size()) {
+            // Grow the wave while the next system conflicts with nothing
+            // already in it
+            size_t count = 1;
+            while (first + count < m_Systems.size()) {
+                const System& candidate = m_Systems[first + count];
+                bool clean = true;
+                for (size_t i = 0; i < count; i++) {
+                    if (Conflicts(candidate, m_Systems[first + i])) {
+                        clean = false;
+                        break;
+                    }
+                }
+                if (!clean) {
+                    break;
+                }
+                count++;
+            }
+
+            RunWave(scene, deltaTime, first, count);
+            first += count;
+        }
+    }
+
+    void SystemScheduler::RunWave(Scene& scene, float deltaTime, size_t first, size_t count) {
+        // A one-system wave (or no worker pool) runs inline; fanning out a
+        // single job would just add a queue round trip
+        if (count == 1 || !JobSystem::IsInitialized()) {
+            for (size_t i = 0; i < count; i++) {
+                System& system = m_Systems[first + i];
+                GEN_PROFILE_SCOPE(system.Name);
+                system.Update(scene, deltaTime);
+            }
+            return;
+        }
+
+        JobCounter wave;
+        for (size_t i = 0; i < count; i++) {
+            System& system = m_Systems[first + i];
+            JobSystem::Get().Execute([&system, &scene, deltaTime]() {
+                GEN_PROFILE_SCOPE(system.Name);
+                system.Update(scene, deltaTime);
+            }, &wave);
+        }
+        // Wait helps drain the queue, so the main thread runs wave members
+        // too instead of idling
+        JobSystem::Get().Wait(wave);
+    }
+
+}
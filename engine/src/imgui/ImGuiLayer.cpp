@@ -6,6 +6,7 @@
 #include "genesis/renderer/VulkanDevice.h"
 #include "genesis/renderer/VulkanSwapchain.h"
 #include "genesis/renderer/VulkanContext.h"
+#include "genesis/renderer/VulkanPipeline.h"
 
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
@@ -13,6 +14,8 @@
 
 #include <GLFW/glfw3.h>
 
+#include <cstring>
+
 namespace Genesis
 {
 
@@ -66,6 +69,8 @@ namespace Genesis
         ImGui_ImplVulkan_CreateFontsTexture();
         device.EndSingleTimeCommands(commandBuffer);
 
+        CreateRenderResources();
+
         GEN_INFO("ImGui layer initialized");
     }
 
@@ -74,6 +79,8 @@ namespace Genesis
         auto &device = Application::Get().GetRenderer().GetDevice();
         device.WaitIdle();
 
+        DestroyRenderResources();
+
         ImGui_ImplVulkan_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
@@ -91,9 +98,10 @@ namespace Genesis
     {
         if (m_BlockEvents)
         {
+            // Stop events ImGui wants from reaching the layers beneath
             ImGuiIO &io = ImGui::GetIO();
-            // Block events if ImGui wants them
-            // event.Handled |= io.WantCaptureMouse || io.WantCaptureKeyboard;
+            event.Handled |= event.IsMouseEvent() && io.WantCaptureMouse;
+            event.Handled |= event.IsKeyEvent() && io.WantCaptureKeyboard;
         }
     }
 
@@ -107,8 +115,260 @@ namespace Genesis
     void ImGuiLayer::End()
     {
         ImGui::Render();
-        ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(),
-                                        Application::Get().GetRenderer().GetCurrentCommandBuffer());
+        auto &renderer = Application::Get().GetRenderer();
+        // The renderer wraps the UI secondary in an "ImGui" GPU zone and
+        // executes it after the scene and water stages
+        RenderDrawData(ImGui::GetDrawData(), renderer.GetUiCommandBuffer());
+    }
+
+    void ImGuiLayer::CreateRenderResources()
+    {
+        auto &renderer = Application::Get().GetRenderer();
+        auto &device = renderer.GetDevice();
+
+        // Set 0, binding 0: the texture the draw command samples. The
+        // backend's ImGui_ImplVulkan_AddTexture sets use the same layout,
+        // so font and user-texture descriptors bind here unchanged.
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 1;
+        layoutInfo.pBindings = &binding;
+        if (vkCreateDescriptorSetLayout(device.GetDevice(), &layoutInfo, nullptr,
+                                        &m_TextureSetLayout) != VK_SUCCESS)
+        {
+            GEN_ERROR("Failed to create ImGui descriptor set layout!");
+            return;
+        }
+
+        // Push constants carry the clip-space scale and translate
+        VkPushConstantRange pushRange{};
+        pushRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        pushRange.offset = 0;
+        pushRange.size = sizeof(float) * 4;
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &m_TextureSetLayout;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+        if (vkCreatePipelineLayout(device.GetDevice(), &pipelineLayoutInfo, nullptr,
+                                   &m_PipelineLayout) != VK_SUCCESS)
+        {
+            GEN_ERROR("Failed to create ImGui pipeline layout!");
+            return;
+        }
+
+        PipelineConfig config{};
+        VulkanPipeline::DefaultPipelineConfig(config);
+        config.RasterizationState.cullMode = VK_CULL_MODE_NONE;
+        config.DepthStencilState.depthTestEnable = VK_FALSE;
+        config.DepthStencilState.depthWriteEnable = VK_FALSE;
+        config.ColorBlendAttachment.blendEnable = VK_TRUE;
+        config.ColorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+        config.ColorBlendAttachment.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        config.ColorBlendAttachment.colorBlendOp = VK_BLEND_OP_ADD;
+        config.ColorBlendAttachment.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
+        config.ColorBlendAttachment.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        config.ColorBlendAttachment.alphaBlendOp = VK_BLEND_OP_ADD;
+
+        config.VertexBindings = {{0, sizeof(ImDrawVert), VK_VERTEX_INPUT_RATE_VERTEX}};
+        config.VertexAttributes = {
+            {0, 0, VK_FORMAT_R32G32_SFLOAT, static_cast<uint32_t>(offsetof(ImDrawVert, pos))},
+            {1, 0, VK_FORMAT_R32G32_SFLOAT, static_cast<uint32_t>(offsetof(ImDrawVert, uv))},
+            {2, 0, VK_FORMAT_R8G8B8A8_UNORM, static_cast<uint32_t>(offsetof(ImDrawVert, col))},
+        };
+
+        config.PipelineLayout = m_PipelineLayout;
+        config.RenderPass = renderer.GetSwapchain().GetRenderPass();
+
+        m_Pipeline = std::make_unique<VulkanPipeline>();
+        m_Pipeline->Init(device, "assets/shaders/imgui.vert.spv", "assets/shaders/imgui.frag.spv",
+                         config);
+
+        m_Geometry.resize(Renderer::MAX_FRAMES_IN_FLIGHT);
+    }
+
+    void ImGuiLayer::DestroyRenderResources()
+    {
+        auto &device = Application::Get().GetRenderer().GetDevice();
+
+        for (FrameGeometry &geometry : m_Geometry)
+        {
+            geometry.VertexBuffer.Shutdown();
+            geometry.IndexBuffer.Shutdown();
+        }
+        m_Geometry.clear();
+
+        if (m_Pipeline)
+        {
+            m_Pipeline->Shutdown();
+            m_Pipeline.reset();
+        }
+        if (m_PipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(device.GetDevice(), m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+        if (m_TextureSetLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(device.GetDevice(), m_TextureSetLayout, nullptr);
+            m_TextureSetLayout = VK_NULL_HANDLE;
+        }
+    }
+
+    void ImGuiLayer::EnsureGeometryCapacity(FrameGeometry &geometry, VkDeviceSize vertexBytes,
+                                            VkDeviceSize indexBytes)
+    {
+        auto &device = Application::Get().GetRenderer().GetDevice();
+
+        // Doubling amortizes growth; once the UI's working set peaks the
+        // buffers never change again. Replacing this frame's buffers is
+        // safe: BeginFrame already waited on this frame index's fence.
+        auto grow = [](VkDeviceSize capacity, VkDeviceSize needed, VkDeviceSize minimum)
+        {
+            VkDeviceSize next = capacity > 0 ? capacity : minimum;
+            while (next < needed)
+            {
+                next *= 2;
+            }
+            return next;
+        };
+
+        if (geometry.VertexCapacity < vertexBytes)
+        {
+            geometry.VertexBuffer.Shutdown();
+            geometry.VertexCapacity = grow(geometry.VertexCapacity, vertexBytes, 256 * 1024);
+            geometry.VertexBuffer.Init(device, geometry.VertexCapacity,
+                                       VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                           VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            geometry.VertexBuffer.Map();
+        }
+        if (geometry.IndexCapacity < indexBytes)
+        {
+            geometry.IndexBuffer.Shutdown();
+            geometry.IndexCapacity = grow(geometry.IndexCapacity, indexBytes, 64 * 1024);
+            geometry.IndexBuffer.Init(device, geometry.IndexCapacity,
+                                      VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+                                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                          VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            geometry.IndexBuffer.Map();
+        }
+    }
+
+    void ImGuiLayer::RenderDrawData(ImDrawData *drawData, VkCommandBuffer cmd)
+    {
+        if (!drawData || drawData->TotalVtxCount == 0 || !m_Pipeline)
+        {
+            return;
+        }
+
+        int fbWidth = static_cast<int>(drawData->DisplaySize.x * drawData->FramebufferScale.x);
+        int fbHeight = static_cast<int>(drawData->DisplaySize.y * drawData->FramebufferScale.y);
+        if (fbWidth <= 0 || fbHeight <= 0)
+        {
+            return;
+        }
+
+        auto &renderer = Application::Get().GetRenderer();
+        FrameGeometry &geometry = m_Geometry[renderer.GetCurrentFrameIndex()];
+
+        VkDeviceSize vertexBytes = static_cast<VkDeviceSize>(drawData->TotalVtxCount) *
+                                   sizeof(ImDrawVert);
+        VkDeviceSize indexBytes = static_cast<VkDeviceSize>(drawData->TotalIdxCount) *
+                                  sizeof(ImDrawIdx);
+        EnsureGeometryCapacity(geometry, vertexBytes, indexBytes);
+
+        // Straight memcpy into the persistent mappings; the memory is
+        // host-coherent so no flush is needed either
+        auto *vtxDst = static_cast<ImDrawVert *>(geometry.VertexBuffer.GetMappedMemory());
+        auto *idxDst = static_cast<ImDrawIdx *>(geometry.IndexBuffer.GetMappedMemory());
+        for (int i = 0; i < drawData->CmdListsCount; i++)
+        {
+            const ImDrawList *list = drawData->CmdLists[i];
+            std::memcpy(vtxDst, list->VtxBuffer.Data, list->VtxBuffer.Size * sizeof(ImDrawVert));
+            std::memcpy(idxDst, list->IdxBuffer.Data, list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            vtxDst += list->VtxBuffer.Size;
+            idxDst += list->IdxBuffer.Size;
+        }
+
+        m_Pipeline->Bind(cmd);
+
+        VkBuffer vertexBuffer = geometry.VertexBuffer.GetBuffer();
+        VkDeviceSize vertexOffset = 0;
+        vkCmdBindVertexBuffers(cmd, 0, 1, &vertexBuffer, &vertexOffset);
+        vkCmdBindIndexBuffer(cmd, geometry.IndexBuffer.GetBuffer(), 0,
+                             sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16
+                                                    : VK_INDEX_TYPE_UINT32);
+
+        VkViewport viewport{0.0f, 0.0f, static_cast<float>(fbWidth),
+                            static_cast<float>(fbHeight), 0.0f, 1.0f};
+        vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+        float pushConstants[4];
+        pushConstants[0] = 2.0f / drawData->DisplaySize.x; // scale
+        pushConstants[1] = 2.0f / drawData->DisplaySize.y;
+        pushConstants[2] = -1.0f - drawData->DisplayPos.x * pushConstants[0]; // translate
+        pushConstants[3] = -1.0f - drawData->DisplayPos.y * pushConstants[1];
+        vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                           sizeof(pushConstants), pushConstants);
+
+        ImVec2 clipOff = drawData->DisplayPos;
+        ImVec2 clipScale = drawData->FramebufferScale;
+
+        uint32_t globalIdxOffset = 0;
+        int32_t globalVtxOffset = 0;
+        for (int i = 0; i < drawData->CmdListsCount; i++)
+        {
+            const ImDrawList *list = drawData->CmdLists[i];
+            for (const ImDrawCmd &drawCmd : list->CmdBuffer)
+            {
+                if (drawCmd.UserCallback)
+                {
+                    drawCmd.UserCallback(list, &drawCmd);
+                    continue;
+                }
+
+                ImVec2 clipMin((drawCmd.ClipRect.x - clipOff.x) * clipScale.x,
+                               (drawCmd.ClipRect.y - clipOff.y) * clipScale.y);
+                ImVec2 clipMax((drawCmd.ClipRect.z - clipOff.x) * clipScale.x,
+                               (drawCmd.ClipRect.w - clipOff.y) * clipScale.y);
+                clipMin.x = clipMin.x < 0.0f ? 0.0f : clipMin.x;
+                clipMin.y = clipMin.y < 0.0f ? 0.0f : clipMin.y;
+                clipMax.x = clipMax.x > fbWidth ? static_cast<float>(fbWidth) : clipMax.x;
+                clipMax.y = clipMax.y > fbHeight ? static_cast<float>(fbHeight) : clipMax.y;
+                if (clipMax.x <= clipMin.x || clipMax.y <= clipMin.y)
+                {
+                    continue;
+                }
+
+                VkRect2D scissor{};
+                scissor.offset = {static_cast<int32_t>(clipMin.x),
+                                  static_cast<int32_t>(clipMin.y)};
+                scissor.extent = {static_cast<uint32_t>(clipMax.x - clipMin.x),
+                                  static_cast<uint32_t>(clipMax.y - clipMin.y)};
+                vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+                // Texture IDs are the backend's descriptor sets (fonts and
+                // ImGui_ImplVulkan_AddTexture registrations alike)
+                auto descriptor = reinterpret_cast<VkDescriptorSet>(drawCmd.GetTexID());
+                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout,
+                                        0, 1, &descriptor, 0, nullptr);
+
+                vkCmdDrawIndexed(cmd, drawCmd.ElemCount, 1,
+                                 globalIdxOffset + drawCmd.IdxOffset,
+                                 globalVtxOffset + static_cast<int32_t>(drawCmd.VtxOffset), 0);
+            }
+            globalIdxOffset += static_cast<uint32_t>(list->IdxBuffer.Size);
+            globalVtxOffset += list->VtxBuffer.Size;
+        }
     }
 
     void ImGuiLayer::CreateDescriptorPool()
@@ -6,30 +6,73 @@ namespace Genesis
 {
 
     void BiomeClassifier::Classify(const ClimateData &climate,
-                                   const WetlandData *wetlands)
+                                   const WetlandData *wetlands,
+                                   const DirtyRegion *region)
     {
-        m_Data.Resize(climate.width, climate.depth);
-        m_Data.Clear();
+        // Incremental mode re-weights only the changed region; every cell
+        // visited is fully rewritten, so no per-cell reset is needed
+        bool incremental = region != nullptr &&
+                           m_Data.width == climate.width &&
+                           m_Data.depth == climate.depth;
 
-        for (int z = 0; z < climate.depth; z++)
+        if (incremental && region->Empty())
         {
-            for (int x = 0; x < climate.width; x++)
+            return; // Nothing changed upstream
+        }
+
+        int minX = 0;
+        int minZ = 0;
+        int maxX = climate.width - 1;
+        int maxZ = climate.depth - 1;
+
+        if (incremental)
+        {
+            minX = std::max(region->minX, 0);
+            minZ = std::max(region->minZ, 0);
+            maxX = std::min(region->maxX, climate.width - 1);
+            maxZ = std::min(region->maxZ, climate.depth - 1);
+        }
+        else
+        {
+            m_Data.Resize(climate.width, climate.depth);
+            m_Data.Clear();
+        }
+
+        for (int z = minZ; z <= maxZ; z++)
+        {
+            for (int x = minX; x <= maxX; x++)
             {
                 size_t idx = m_Data.Index(x, z);
 
-                float temperature = climate.temperature[idx];
-                float moisture = climate.moisture[idx];
-                float fertility = climate.fertility[idx];
-
                 bool isWetland = false;
                 if (wetlands && wetlands->InBounds(x, z))
                 {
                     isWetland = wetlands->isWetland[wetlands->Index(x, z)];
                 }
 
-                // Compute biome weights
-                BiomeWeights weights = ComputeBiomeWeights(temperature, moisture,
-                                                           fertility, isWetland);
+                // One table fetch by the stored climate bytes replaces the
+                // full rule evaluation
+                BiomeWeights weights = LookupBaseWeights(climate.temperature.Raw(idx),
+                                                         climate.moisture.Raw(idx));
+
+                // Wetland override - if wetland conditions met, strongly
+                // weight wetland while still allowing other biomes to blend
+                if (isWetland)
+                {
+                    weights[BiomeType::Wetland] += 0.7f;
+                }
+
+                // Default to temperate if no strong classification
+                float totalWeight = 0.0f;
+                for (float w : weights.weights)
+                {
+                    totalWeight += w;
+                }
+                if (totalWeight < 0.01f)
+                {
+                    weights[BiomeType::Temperate] = 1.0f;
+                }
+
                 weights.Normalize();
 
                 m_Data.cellBiomes[idx] = weights;
@@ -38,21 +81,13 @@ namespace Genesis
         }
     }
 
-    BiomeWeights BiomeClassifier::ComputeBiomeWeights(float temperature, float moisture,
-                                                      float fertility, bool isWetland) const
+    BiomeWeights BiomeClassifier::ComputeBiomeWeights(float temperature, float moisture) const
     {
         BiomeWeights weights;
 
         // Section 28: Biome classification via continuous thresholds
         // Temperature range: [-1, 1], Moisture range: [0, 1]
 
-        // Wetland override - if wetland conditions met, strongly weight wetland
-        if (isWetland)
-        {
-            weights[BiomeType::Wetland] = 0.7f;
-            // Still allow other biomes to blend
-        }
-
         // === Temperature-based classifications ===
 
         // Polar: temperature < -0.6
@@ -116,20 +151,38 @@ namespace Genesis
                            SmoothThreshold(-moisture, -0.7f, 0.15f);
         weights[BiomeType::Temperate] += tempWeight;
 
-        // Ensure at least some weight exists
-        float totalWeight = 0.0f;
-        for (size_t i = 0; i < static_cast<size_t>(BiomeType::Count); i++)
-        {
-            totalWeight += weights.weights[i];
-        }
+        return weights;
+    }
 
-        if (totalWeight < 0.01f)
+    const BiomeWeights &BiomeClassifier::LookupBaseWeights(uint8_t temperature, uint8_t moisture)
+    {
+        // Evaluating the rule set for all 256x256 quantized (temperature,
+        // moisture) pairs costs a few milliseconds once; afterwards every
+        // cell and every GetBiomeWeights query is a single fetch. Magic
+        // statics make the lazy build safe from the chunk worker threads.
+        static const std::vector<BiomeWeights> table = []
         {
-            // Default to temperate if no strong classification
-            weights[BiomeType::Temperate] = 1.0f;
-        }
+            std::vector<BiomeWeights> lut(256 * 256);
+            BiomeClassifier scratch;
 
-        return weights;
+            for (int t = 0; t < 256; t++)
+            {
+                // Decode exactly like QuantizedField: temperature spans
+                // [-1, 1], moisture spans [0, 1]
+                float temp = -1.0f + 2.0f * (static_cast<float>(t) * (1.0f / 255.0f));
+
+                for (int m = 0; m < 256; m++)
+                {
+                    float moist = static_cast<float>(m) * (1.0f / 255.0f);
+                    lut[static_cast<size_t>(t) * 256 + m] =
+                        scratch.ComputeBiomeWeights(temp, moist);
+                }
+            }
+
+            return lut;
+        }();
+
+        return table[static_cast<size_t>(temperature) * 256 + moisture];
     }
 
     float BiomeClassifier::SmoothThreshold(float value, float threshold, float width) const
@@ -1,11 +1,12 @@
 #include "genesis/procedural/ClimateGenerator.h"
+#include "genesis/core/ScratchArena.h"
 #include <algorithm>
 #include <cmath>
 
 namespace Genesis
 {
 
-    void ClimateGenerator::Initialize(SimplexNoise *noise, const ClimateSettings &settings)
+    void ClimateGenerator::Initialize(const SimplexNoise *noise, const ClimateSettings &settings)
     {
         m_Noise = noise;
         m_Settings = settings;
@@ -74,29 +75,27 @@ namespace Genesis
         // tempNoise = FBM(x * climateFreq, z * climateFreq)
         // temperature = temperatureBias + tempNoise * temperatureRange - altitudeCooling(height)
 
+        // Noise on a coarse lattice; per-cell terms stay full resolution.
+        // The lattice is a stage temporary out of the scratch arena.
+        GEN_SCRATCH_SCOPE();
+        int latticeWidth = 0;
+        ScratchVector<float> tempLattice = SampleNoiseLattice(
+            m_Settings.temperatureFrequency, 4, cellSize,
+            worldOffsetX, worldOffsetZ, latticeWidth);
+
         for (int z = 0; z < m_Data.depth; z++)
         {
             for (int x = 0; x < m_Data.width; x++)
             {
                 size_t idx = m_Data.Index(x, z);
 
-                // World coordinates for noise sampling
-                float worldX = worldOffsetX + x * cellSize;
-                float worldZ = worldOffsetZ + z * cellSize;
-
                 // Sample climate noise
-                float tempNoise = m_Noise->FBM(
-                    worldX * m_Settings.temperatureFrequency,
-                    worldZ * m_Settings.temperatureFrequency,
-                    4,    // octaves
-                    0.5f, // persistence
-                    2.0f  // lacunarity
-                );
+                float tempNoise = SampleLattice(tempLattice, latticeWidth, x, z);
 
                 // Altitude cooling
                 float height = heightmap[idx];
                 float altCooling = ComputeAltitudeCooling(height, seaLevel, heightScale);
-                m_Data.altitudeCooling[idx] = altCooling;
+                m_Data.altitudeCooling.Set(idx, altCooling);
 
                 // Section 27.1 formula:
                 // temperature = temperatureBias + tempNoise * temperatureRange - altitudeCooling
@@ -108,7 +107,7 @@ namespace Genesis
                                     altCooling * m_Settings.elevationLapseRate * heightScale;
 
                 // Clamp to [-1, 1]
-                m_Data.temperature[idx] = std::clamp(temperature, -1.0f, 1.0f);
+                m_Data.temperature.Set(idx, std::clamp(temperature, -1.0f, 1.0f));
             }
         }
     }
@@ -124,27 +123,24 @@ namespace Genesis
         // Section 27.2: Moisture Field
         // moisture = humidity + waterProximityBoost - rainShadowPenalty - altitudePenalty
 
+        // Noise on a coarse lattice; per-cell terms stay full resolution
+        GEN_SCRATCH_SCOPE();
+        int latticeWidth = 0;
+        ScratchVector<float> precipLattice = SampleNoiseLattice(
+            m_Settings.precipitationFrequency, 3, cellSize,
+            worldOffsetX, worldOffsetZ, latticeWidth);
+
         for (int z = 0; z < m_Data.depth; z++)
         {
             for (int x = 0; x < m_Data.width; x++)
             {
                 size_t idx = m_Data.Index(x, z);
 
-                // World coordinates for noise sampling
-                float worldX = worldOffsetX + x * cellSize;
-                float worldZ = worldOffsetZ + z * cellSize;
-
                 // Base humidity from settings (rainfall baseline)
                 float humidity = m_Settings.basePrecipitation;
 
                 // Add precipitation noise variation
-                float precipNoise = m_Noise->FBM(
-                    worldX * m_Settings.precipitationFrequency,
-                    worldZ * m_Settings.precipitationFrequency,
-                    3,    // octaves
-                    0.5f, // persistence
-                    2.0f  // lacunarity
-                );
+                float precipNoise = SampleLattice(precipLattice, latticeWidth, x, z);
                 humidity += precipNoise * m_Settings.precipitationVariation;
 
                 // Water proximity boost (from hydrology)
@@ -183,7 +179,7 @@ namespace Genesis
                 }
 
                 // Clamp to [0, 1]
-                m_Data.moisture[idx] = std::clamp(moisture, 0.0f, 1.0f);
+                m_Data.moisture.Set(idx, std::clamp(moisture, 0.0f, 1.0f));
             }
         }
     }
@@ -219,7 +215,7 @@ namespace Genesis
                 }
 
                 // Clamp to [0, 1]
-                m_Data.fertility[idx] = std::clamp(fertility, 0.0f, 1.0f);
+                m_Data.fertility.Set(idx, std::clamp(fertility, 0.0f, 1.0f));
             }
         }
     }
@@ -243,11 +239,12 @@ namespace Genesis
         // Rain shadow: mountains block moisture from prevailing wind direction
         // Assume prevailing wind from west (negative X direction)
         // Cells downwind (east) of mountains receive less moisture
+        //
+        // Single directional sweep: cells are processed in wind order and
+        // the accumulated blocking height propagates in one traversal, like
+        // a scanline shadow algorithm. No per-cell upwind march, no
+        // intermediate buffer.
 
-        // First pass: compute max upwind elevation for each cell
-        std::vector<float> maxUpwindHeight(heightmap.size(), 0.0f);
-
-        // Scan from west to east (following wind direction)
         for (int z = 0; z < m_Data.depth; z++)
         {
             float runningMax = 0.0f;
@@ -263,29 +260,16 @@ namespace Genesis
                 // Decay the running max slightly (distance effect)
                 runningMax *= 0.995f;
 
-                maxUpwindHeight[idx] = runningMax;
-            }
-        }
-
-        // Second pass: compute rain shadow intensity
-        for (int z = 0; z < m_Data.depth; z++)
-        {
-            for (int x = 0; x < m_Data.width; x++)
-            {
-                size_t idx = m_Data.Index(x, z);
-                float height = heightmap[idx];
-                float upwindMax = maxUpwindHeight[idx];
-
                 // Rain shadow intensity based on height difference
                 // If we're lower than upwind terrain, we're in shadow
-                if (upwindMax > height)
+                if (runningMax > height)
                 {
-                    float shadowDepth = (upwindMax - height) / 50.0f; // Normalize
-                    m_Data.rainShadow[idx] = std::clamp(shadowDepth, 0.0f, 1.0f);
+                    float shadowDepth = (runningMax - height) / 50.0f; // Normalize
+                    m_Data.rainShadow.Set(idx, std::clamp(shadowDepth, 0.0f, 1.0f));
                 }
                 else
                 {
-                    m_Data.rainShadow[idx] = 0.0f;
+                    m_Data.rainShadow.Set(idx, 0.0f);
                 }
             }
         }
@@ -322,27 +306,24 @@ namespace Genesis
         // Simplified moisture calculation using only world-coherent noise
         // No chunk-local rain shadow or hydrology - ensures seamless boundaries
 
+        // Noise on a coarse lattice; per-cell terms stay full resolution
+        GEN_SCRATCH_SCOPE();
+        int latticeWidth = 0;
+        ScratchVector<float> precipLattice = SampleNoiseLattice(
+            m_Settings.precipitationFrequency, 3, cellSize,
+            worldOffsetX, worldOffsetZ, latticeWidth);
+
         for (int z = 0; z < m_Data.depth; z++)
         {
             for (int x = 0; x < m_Data.width; x++)
             {
                 size_t idx = m_Data.Index(x, z);
 
-                // World coordinates for noise sampling
-                float worldX = worldOffsetX + x * cellSize;
-                float worldZ = worldOffsetZ + z * cellSize;
-
                 // Base humidity from settings
                 float humidity = m_Settings.basePrecipitation;
 
                 // Add precipitation noise variation (world-coherent)
-                float precipNoise = m_Noise->FBM(
-                    worldX * m_Settings.precipitationFrequency,
-                    worldZ * m_Settings.precipitationFrequency,
-                    3,    // octaves
-                    0.5f, // persistence
-                    2.0f  // lacunarity
-                );
+                float precipNoise = SampleLattice(precipLattice, latticeWidth, x, z);
                 humidity += precipNoise * m_Settings.precipitationVariation;
 
                 // Altitude penalty (high elevations are drier)
@@ -361,7 +342,7 @@ namespace Genesis
                 float moisture = humidity - altitudePenalty - evaporationLoss;
 
                 // Clamp to [0, 1]
-                m_Data.moisture[idx] = std::clamp(moisture, 0.0f, 1.0f);
+                m_Data.moisture.Set(idx, std::clamp(moisture, 0.0f, 1.0f));
             }
         }
     }
@@ -391,9 +372,70 @@ namespace Genesis
                 // Combined fertility - use vegetationDensity as fertility multiplier
                 float fertility = tempFactor * moistFactor * m_Settings.vegetationDensity;
 
-                m_Data.fertility[idx] = std::clamp(fertility, 0.0f, 1.0f);
+                m_Data.fertility.Set(idx, std::clamp(fertility, 0.0f, 1.0f));
             }
         }
     }
 
+    ScratchVector<float> ClimateGenerator::SampleNoiseLattice(float frequency,
+                                                            int octaves,
+                                                            float cellSize,
+                                                            float worldOffsetX,
+                                                            float worldOffsetZ,
+                                                            int &latticeWidth) const
+    {
+        int divisor = std::max(1, m_Settings.resolutionDivisor);
+
+        // One sample per divisor cells, plus a guard column/row so the
+        // bilinear lookup for the last cells has an upper neighbor
+        latticeWidth = (m_Data.width + divisor - 1) / divisor + 1;
+        int latticeDepth = (m_Data.depth + divisor - 1) / divisor + 1;
+
+        ScratchVector<float> lattice(static_cast<size_t>(latticeWidth) * latticeDepth);
+
+        for (int lz = 0; lz < latticeDepth; lz++)
+        {
+            for (int lx = 0; lx < latticeWidth; lx++)
+            {
+                // Lattice samples stay in world space so chunk boundaries
+                // remain seamless
+                float worldX = worldOffsetX + (lx * divisor) * cellSize;
+                float worldZ = worldOffsetZ + (lz * divisor) * cellSize;
+
+                lattice[static_cast<size_t>(lz) * latticeWidth + lx] = m_Noise->FBM(
+                    worldX * frequency,
+                    worldZ * frequency,
+                    octaves,
+                    0.5f, // persistence
+                    2.0f  // lacunarity
+                );
+            }
+        }
+
+        return lattice;
+    }
+
+    float ClimateGenerator::SampleLattice(const ScratchVector<float> &lattice,
+                                          int latticeWidth,
+                                          int x,
+                                          int z) const
+    {
+        int divisor = std::max(1, m_Settings.resolutionDivisor);
+
+        int cellX = x / divisor;
+        int cellZ = z / divisor;
+        float tx = static_cast<float>(x - cellX * divisor) / divisor;
+        float tz = static_cast<float>(z - cellZ * divisor) / divisor;
+
+        size_t base = static_cast<size_t>(cellZ) * latticeWidth + cellX;
+        float n00 = lattice[base];
+        float n10 = lattice[base + 1];
+        float n01 = lattice[base + latticeWidth];
+        float n11 = lattice[base + latticeWidth + 1];
+
+        float north = n00 + (n10 - n00) * tx;
+        float south = n01 + (n11 - n01) * tx;
+        return north + (south - north) * tz;
+    }
+
 }
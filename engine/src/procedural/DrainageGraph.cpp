@@ -1,11 +1,27 @@
 #include "genesis/procedural/DrainageGraph.h"
+#include "genesis/core/ScratchArena.h"
 #include <algorithm>
-#include <queue>
 #include <cmath>
 
 namespace Genesis
 {
 
+    // Select a boundary's per-edge vector, matching the edge enumeration
+    static std::vector<uint32_t> &EdgeVector(ChunkDrainageBoundary &boundary, ChunkEdge edge)
+    {
+        switch (edge)
+        {
+        case ChunkEdge::NegativeX:
+            return boundary.negX;
+        case ChunkEdge::PositiveX:
+            return boundary.posX;
+        case ChunkEdge::NegativeZ:
+            return boundary.negZ;
+        default:
+            return boundary.posZ;
+        }
+    }
+
     void DrainageGraph::Compute(const std::vector<float> &heightmap,
                                 int width, int depth,
                                 float cellSize,
@@ -13,6 +29,13 @@ namespace Genesis
     {
         ComputeFlowDirections(heightmap, width, depth, cellSize, seaLevel);
         ComputeFlowAccumulation();
+
+        // Cross-chunk stitching state starts fresh for the new grid
+        int edgeSize = std::max(width, depth);
+        m_BoundaryOutflow.Resize(edgeSize);
+        m_ReceivedInflow.Resize(edgeSize);
+        ComputeEdgeInflowDirections(heightmap, seaLevel);
+        ComputeBoundaryOutflow();
     }
 
     void DrainageGraph::ComputeFlowDirections(const std::vector<float> &heightmap,
@@ -42,8 +65,13 @@ namespace Genesis
         // Reset accumulation
         std::fill(m_Data.flowAccumulation.begin(), m_Data.flowAccumulation.end(), 0);
 
-        // Count incoming edges for each cell (in-degree for topological sort)
-        std::vector<int> inDegree(size, 0);
+        // Resolve every cell's downstream index once. The two passes below
+        // then run over flat arrays instead of re-decoding flow directions
+        // and bounds per visit. All three arrays are stage temporaries, so
+        // they come from the thread's scratch arena rather than the heap.
+        GEN_SCRATCH_SCOPE();
+        ScratchVector<int32_t> downstream(size, -1);
+        ScratchVector<int32_t> inDegree(size, 0);
 
         for (int z = 0; z < depth; z++)
         {
@@ -52,53 +80,209 @@ namespace Genesis
                 int downX, downZ;
                 if (GetDownstreamCell(x, z, downX, downZ))
                 {
-                    size_t downIdx = m_Data.Index(downX, downZ);
+                    int32_t downIdx = static_cast<int32_t>(m_Data.Index(downX, downZ));
+                    downstream[m_Data.Index(x, z)] = downIdx;
                     inDegree[downIdx]++;
                 }
             }
         }
 
-        // Initialize queue with cells that have no upstream contributors (sources)
-        std::queue<size_t> ready;
+        // Worklist as a flat vector consumed by index: cells are appended as
+        // their in-degree reaches zero, with none of std::queue's block
+        // allocation. Seeded with the sources (no upstream contributors).
+        ScratchVector<uint32_t> worklist;
+        worklist.reserve(size);
         for (size_t i = 0; i < size; i++)
         {
             if (inDegree[i] == 0)
             {
-                ready.push(i);
+                worklist.push_back(static_cast<uint32_t>(i));
             }
         }
 
         // Topological traversal - process cells in upstream-to-downstream order
-        while (!ready.empty())
+        for (size_t head = 0; head < worklist.size(); head++)
         {
-            size_t cellIdx = ready.front();
-            ready.pop();
+            uint32_t cellIdx = worklist[head];
 
             // Each cell contributes 1 (itself) to accumulation
             m_Data.flowAccumulation[cellIdx] += 1;
 
-            // Pass accumulation to downstream cell
-            int x = static_cast<int>(cellIdx % width);
-            int z = static_cast<int>(cellIdx / width);
-
-            int downX, downZ;
-            if (GetDownstreamCell(x, z, downX, downZ))
+            int32_t downIdx = downstream[cellIdx];
+            if (downIdx >= 0)
             {
-                size_t downIdx = m_Data.Index(downX, downZ);
-
                 // Add this cell's accumulation to downstream
                 m_Data.flowAccumulation[downIdx] += m_Data.flowAccumulation[cellIdx];
 
-                // Decrement in-degree and add to queue if ready
-                inDegree[downIdx]--;
-                if (inDegree[downIdx] == 0)
+                if (--inDegree[downIdx] == 0)
                 {
-                    ready.push(downIdx);
+                    worklist.push_back(static_cast<uint32_t>(downIdx));
                 }
             }
         }
     }
 
+    void DrainageGraph::EdgeCell(ChunkEdge edge, int i, int &outX, int &outZ) const
+    {
+        switch (edge)
+        {
+        case ChunkEdge::NegativeX:
+            outX = 0;
+            outZ = i;
+            break;
+        case ChunkEdge::PositiveX:
+            outX = m_Data.width - 1;
+            outZ = i;
+            break;
+        case ChunkEdge::NegativeZ:
+            outX = i;
+            outZ = 0;
+            break;
+        case ChunkEdge::PositiveZ:
+            outX = i;
+            outZ = m_Data.depth - 1;
+            break;
+        }
+    }
+
+    void DrainageGraph::ComputeEdgeInflowDirections(const std::vector<float> &heightmap,
+                                                    float seaLevel)
+    {
+        // Edge cells carry the Boundary tag instead of a descent direction,
+        // so cross-chunk inflow needs its own record of where water entering
+        // on each edge cell continues. Below-sea edge cells sink in place.
+        for (int e = 0; e < 4; e++)
+        {
+            ChunkEdge edge = static_cast<ChunkEdge>(e);
+            int length = (edge == ChunkEdge::NegativeX || edge == ChunkEdge::PositiveX)
+                             ? m_Data.depth
+                             : m_Data.width;
+            m_EdgeInflowDir[e].assign(length, -1);
+
+            for (int i = 0; i < length; i++)
+            {
+                int x, z;
+                EdgeCell(edge, i, x, z);
+
+                size_t idx = m_Data.Index(x, z);
+                float currentHeight = heightmap[idx];
+                if (currentHeight < seaLevel)
+                {
+                    continue; // Reached the ocean
+                }
+
+                float maxDropPerDist = 0.0f;
+                int bestDir = -1;
+
+                for (int dir = 0; dir < 8; dir++)
+                {
+                    int nx = x + FLOW_OFFSET_X[dir];
+                    int nz = z + FLOW_OFFSET_Z[dir];
+
+                    if (!m_Data.InBounds(nx, nz))
+                    {
+                        continue;
+                    }
+
+                    float drop = currentHeight - heightmap[m_Data.Index(nx, nz)];
+                    float dropPerDist = drop / FLOW_DISTANCE[dir];
+
+                    if (dropPerDist > maxDropPerDist)
+                    {
+                        maxDropPerDist = dropPerDist;
+                        bestDir = dir;
+                    }
+                }
+
+                m_EdgeInflowDir[e][i] = static_cast<int8_t>(bestDir);
+            }
+        }
+    }
+
+    void DrainageGraph::ComputeBoundaryOutflow()
+    {
+        // Everything that accumulates at an edge cell leaves the chunk
+        // there, minus what that same edge already received from the
+        // neighbor - re-exporting it would echo back and forth forever.
+        for (int e = 0; e < 4; e++)
+        {
+            ChunkEdge edge = static_cast<ChunkEdge>(e);
+            std::vector<uint32_t> &outflow = EdgeVector(m_BoundaryOutflow, edge);
+            std::vector<uint32_t> &received = EdgeVector(m_ReceivedInflow, edge);
+            int length = (edge == ChunkEdge::NegativeX || edge == ChunkEdge::PositiveX)
+                             ? m_Data.depth
+                             : m_Data.width;
+
+            for (int i = 0; i < length && i < static_cast<int>(outflow.size()); i++)
+            {
+                int x, z;
+                EdgeCell(edge, i, x, z);
+
+                uint32_t accumulation = m_Data.flowAccumulation[m_Data.Index(x, z)];
+                outflow[i] = accumulation > received[i] ? accumulation - received[i] : 0;
+            }
+        }
+    }
+
+    bool DrainageGraph::AddBoundaryInflow(ChunkEdge edge, const std::vector<uint32_t> &inflow)
+    {
+        int length = (edge == ChunkEdge::NegativeX || edge == ChunkEdge::PositiveX)
+                         ? m_Data.depth
+                         : m_Data.width;
+        std::vector<uint32_t> &received = EdgeVector(m_ReceivedInflow, edge);
+        const std::vector<int8_t> &inflowDir = m_EdgeInflowDir[static_cast<int>(edge)];
+
+        size_t maxSteps = static_cast<size_t>(m_Data.width) * m_Data.depth;
+        bool changed = false;
+
+        for (int i = 0; i < length && i < static_cast<int>(inflow.size()); i++)
+        {
+            // Only the delta against what this edge cell already received
+            // gets injected; repeated exchanges converge instead of growing
+            uint32_t delta = inflow[i] > received[i] ? inflow[i] - received[i] : 0;
+            if (delta == 0)
+            {
+                continue;
+            }
+            received[i] = inflow[i];
+
+            int x, z;
+            EdgeCell(edge, i, x, z);
+            m_Data.flowAccumulation[m_Data.Index(x, z)] += delta;
+
+            // Step off the edge along the precomputed descent, then follow
+            // the stored flow directions, carrying the delta downstream.
+            // Only the affected flow path is touched.
+            int dir = inflowDir[i];
+            if (dir >= 0)
+            {
+                x += FLOW_OFFSET_X[dir];
+                z += FLOW_OFFSET_Z[dir];
+
+                for (size_t step = 0; step < maxSteps && m_Data.InBounds(x, z); step++)
+                {
+                    m_Data.flowAccumulation[m_Data.Index(x, z)] += delta;
+
+                    int nextX, nextZ;
+                    if (!GetDownstreamCell(x, z, nextX, nextZ))
+                    {
+                        break;
+                    }
+                    x = nextX;
+                    z = nextZ;
+                }
+            }
+
+            changed = true;
+        }
+
+        if (changed)
+        {
+            ComputeBoundaryOutflow();
+        }
+        return changed;
+    }
+
     FlowDirection DrainageGraph::ComputeCellFlowDirection(const std::vector<float> &heightmap,
                                                           int x, int z,
                                                           float seaLevel) const
@@ -7,13 +7,13 @@ namespace Genesis
 {
 
     GeologicalFieldGenerator::GeologicalFieldGenerator()
-        : m_Seed(12345), m_Noise(12345)
+        : m_Noise(NoiseState::Get(12345)), m_Seed(12345)
     {
         DeriveFieldSettings(m_Intent);
     }
 
     GeologicalFieldGenerator::GeologicalFieldGenerator(const TerrainIntent &intent, uint32_t seed)
-        : m_Intent(intent), m_Seed(seed), m_Noise(seed)
+        : m_Intent(intent), m_Noise(NoiseState::Get(seed)), m_Seed(seed)
     {
         DeriveFieldSettings(intent);
     }
@@ -22,7 +22,7 @@ namespace Genesis
     {
         m_Intent = intent;
         m_Seed = seed;
-        m_Noise.SetSeed(seed);
+        m_Noise = NoiseState::Get(seed);
         DeriveFieldSettings(intent);
     }
 
@@ -72,7 +72,7 @@ namespace Genesis
         float contX = worldX * m_FieldSettings.continentalFrequency;
         float contZ = worldZ * m_FieldSettings.continentalFrequency;
 
-        float continentalNoise = m_Noise.FBM(contX, contZ,
+        float continentalNoise = m_Noise->FBM(contX, contZ,
                                              static_cast<int>(m_FieldSettings.continentalOctaves),
                                              0.5f, 2.0f);
 
@@ -90,7 +90,7 @@ namespace Genesis
         float elevZ = worldZ * m_FieldSettings.elevationFieldFrequency;
 
         // Use offset to decorrelate from continental field
-        float elevNoise = m_Noise.FBM(elevX + 100.0f, elevZ + 200.0f,
+        float elevNoise = m_Noise->FBM(elevX + 100.0f, elevZ + 200.0f,
                                       static_cast<int>(m_FieldSettings.elevationFieldOctaves),
                                       0.5f, 2.0f);
 
@@ -116,7 +116,7 @@ namespace Genesis
         float upliftZ = worldZ * upliftFreq;
 
         // Offset to decorrelate from other fields
-        float upliftNoise = m_Noise.FBM(upliftX + 500.0f, upliftZ + 700.0f, 2, 0.5f, 2.0f);
+        float upliftNoise = m_Noise->FBM(upliftX + 500.0f, upliftZ + 700.0f, 2, 0.5f, 2.0f);
         upliftNoise = (upliftNoise + 1.0f) * 0.5f; // Map to [0, 1]
 
         // Smoothstep for gradual transition
@@ -151,7 +151,7 @@ namespace Genesis
             float erosionZ = worldZ * m_FieldSettings.erosionFieldFrequency;
 
             // Offset to decorrelate
-            float erosionNoise = m_Noise.FBM(erosionX + 300.0f, erosionZ + 400.0f, 2, 0.5f, 2.0f);
+            float erosionNoise = m_Noise->FBM(erosionX + 300.0f, erosionZ + 400.0f, 2, 0.5f, 2.0f);
             erosionNoise = erosionNoise * m_FieldSettings.erosionAgeVariation;
 
             fields.erosionAge = std::clamp(
@@ -171,7 +171,7 @@ namespace Genesis
         float contX = worldX * m_FieldSettings.continentalFrequency;
         float contZ = worldZ * m_FieldSettings.continentalFrequency;
 
-        float continentalNoise = m_Noise.FBM(contX, contZ,
+        float continentalNoise = m_Noise->FBM(contX, contZ,
                                              static_cast<int>(m_FieldSettings.continentalOctaves),
                                              0.5f, 2.0f);
 
@@ -204,7 +204,7 @@ namespace Genesis
             float varX = worldX * m_FieldSettings.continentalFrequency * 5.0f;
             float varZ = worldZ * m_FieldSettings.continentalFrequency * 5.0f;
 
-            float variation = m_Noise.FBM(varX + 800.0f, varZ + 900.0f, 2, 0.5f, 2.0f);
+            float variation = m_Noise->FBM(varX + 800.0f, varZ + 900.0f, 2, 0.5f, 2.0f);
             baseDepth += variation * baseDepth * m_FieldSettings.oceanFloorVariation;
         }
 
@@ -254,4 +254,99 @@ namespace Genesis
         return t * t * (3.0f - 2.0f * t);
     }
 
+    void GeologicalFieldCache::Configure(const TerrainIntent &intent, uint32_t seed)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Generator.Configure(intent, seed);
+        m_Tiles.clear();
+    }
+
+    void GeologicalFieldCache::SetSampleSpacing(float spacing)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_SampleSpacing = std::max(spacing, 1.0f);
+        m_Tiles.clear();
+    }
+
+    GeologicalFields GeologicalFieldCache::SampleFields(float worldX, float worldZ)
+    {
+        float gridX = worldX / m_SampleSpacing;
+        float gridZ = worldZ / m_SampleSpacing;
+
+        int baseX = static_cast<int>(std::floor(gridX));
+        int baseZ = static_cast<int>(std::floor(gridZ));
+        float tx = gridX - static_cast<float>(baseX);
+        float tz = gridZ - static_cast<float>(baseZ);
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        const GeologicalFields &s00 = LatticeSample(baseX, baseZ);
+        const GeologicalFields &s10 = LatticeSample(baseX + 1, baseZ);
+        const GeologicalFields &s01 = LatticeSample(baseX, baseZ + 1);
+        const GeologicalFields &s11 = LatticeSample(baseX + 1, baseZ + 1);
+
+        return LerpFields(LerpFields(s00, s10, tx),
+                          LerpFields(s01, s11, tx), tz);
+    }
+
+    void GeologicalFieldCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Tiles.clear();
+    }
+
+    size_t GeologicalFieldCache::GetTileCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_Tiles.size();
+    }
+
+    const GeologicalFields &GeologicalFieldCache::LatticeSample(int latticeX, int latticeZ)
+    {
+        glm::ivec2 tileCoord(FloorDiv(latticeX, TILE_SIZE), FloorDiv(latticeZ, TILE_SIZE));
+
+        Tile &tile = m_Tiles[tileCoord];
+        if (tile.samples.empty())
+        {
+            // Build the whole tile on first touch; neighbouring queries
+            // almost always land in the same tile
+            tile.samples.resize(static_cast<size_t>(TILE_SIZE) * TILE_SIZE);
+
+            for (int z = 0; z < TILE_SIZE; z++)
+            {
+                for (int x = 0; x < TILE_SIZE; x++)
+                {
+                    float sampleX = static_cast<float>(tileCoord.x * TILE_SIZE + x) * m_SampleSpacing;
+                    float sampleZ = static_cast<float>(tileCoord.y * TILE_SIZE + z) * m_SampleSpacing;
+
+                    tile.samples[static_cast<size_t>(z) * TILE_SIZE + x] =
+                        m_Generator.SampleFields(sampleX, sampleZ);
+                }
+            }
+        }
+
+        int localX = latticeX - tileCoord.x * TILE_SIZE;
+        int localZ = latticeZ - tileCoord.y * TILE_SIZE;
+        return tile.samples[static_cast<size_t>(localZ) * TILE_SIZE + localX];
+    }
+
+    int GeologicalFieldCache::FloorDiv(int value, int divisor)
+    {
+        return value >= 0 ? value / divisor : (value - divisor + 1) / divisor;
+    }
+
+    GeologicalFields GeologicalFieldCache::LerpFields(const GeologicalFields &a,
+                                                      const GeologicalFields &b,
+                                                      float t)
+    {
+        GeologicalFields result;
+        result.continental = a.continental + t * (b.continental - a.continental);
+        result.elevationAmplitude = a.elevationAmplitude + t * (b.elevationAmplitude - a.elevationAmplitude);
+        result.upliftMask = a.upliftMask + t * (b.upliftMask - a.upliftMask);
+        result.ridgeValue = a.ridgeValue + t * (b.ridgeValue - a.ridgeValue);
+        result.erosionAge = a.erosionAge + t * (b.erosionAge - a.erosionAge);
+        result.oceanMask = a.oceanMask + t * (b.oceanMask - a.oceanMask);
+        return result;
+    }
+
 }
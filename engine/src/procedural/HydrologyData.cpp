@@ -1,6 +1,7 @@
 #include "genesis/procedural/HydrologyData.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <queue>
 
 namespace Genesis
@@ -13,8 +14,17 @@ namespace Genesis
                                      float cellSize)
     {
         const DrainageData &drainData = drainage.GetData();
-        m_Data.Resize(drainData.width, drainData.depth);
-        m_Data.Clear();
+
+        // Every stage below writes through a compare, expanding the dirty
+        // region only where a field actually changed. A fresh or resized
+        // grid starts from cleared fields and marks everything.
+        m_DirtyRegion.Reset();
+        if (m_Data.width != drainData.width || m_Data.depth != drainData.depth)
+        {
+            m_Data.Resize(drainData.width, drainData.depth);
+            m_Data.Clear();
+            m_DirtyRegion.MarkAll(drainData.width, drainData.depth);
+        }
 
         // Step 1: Copy drainage data (flow direction, accumulation, slope)
         CopyDrainageData(drainage);
@@ -38,9 +48,21 @@ namespace Genesis
             for (int x = 0; x < m_Data.width; x++)
             {
                 size_t idx = m_Data.Index(x, z);
+
+                bool changed = m_Data.drainageDirection[idx] != src.flowDirection[idx] ||
+                               m_Data.flowAccumulation[idx] != src.flowAccumulation[idx];
+
                 m_Data.drainageDirection[idx] = src.flowDirection[idx];
                 m_Data.flowAccumulation[idx] = src.flowAccumulation[idx];
-                m_Data.slope[idx] = src.slope[idx];
+
+                float oldSlope = m_Data.slope[idx];
+                m_Data.slope.Set(idx, src.slope[idx]);
+                changed = changed || m_Data.slope[idx] != oldSlope;
+
+                if (changed)
+                {
+                    m_DirtyRegion.Expand(x, z);
+                }
             }
         }
     }
@@ -59,13 +81,14 @@ namespace Genesis
 
                 // Check river network first (rivers take precedence for type)
                 WaterType riverType = WaterType::None;
+                float surfaceHeight = 0.0f;
                 if (riverNet.InBounds(x, z))
                 {
                     size_t rIdx = riverNet.Index(x, z);
                     riverType = riverNet.cellWaterType[rIdx];
                     if (riverType != WaterType::None)
                     {
-                        m_Data.waterSurfaceHeight[idx] = riverNet.cellSurfaceHeight[rIdx];
+                        surfaceHeight = riverNet.cellSurfaceHeight[rIdx];
                     }
                 }
 
@@ -78,26 +101,35 @@ namespace Genesis
                     {
                         lakeType = WaterType::Lake;
                         const LakeBasin &basin = lakeNet.lakes[lakeIdx];
-                        m_Data.waterSurfaceHeight[idx] = basin.surfaceHeight;
+                        surfaceHeight = basin.surfaceHeight;
                     }
                 }
 
                 // Determine final water type (priority: Ocean > Lake > River > Stream)
+                WaterType finalType = WaterType::None;
                 if (riverType == WaterType::Ocean)
                 {
-                    m_Data.waterType[idx] = WaterType::Ocean;
+                    finalType = WaterType::Ocean;
                 }
                 else if (lakeType == WaterType::Lake)
                 {
-                    m_Data.waterType[idx] = WaterType::Lake;
+                    finalType = WaterType::Lake;
                 }
                 else if (riverType == WaterType::River)
                 {
-                    m_Data.waterType[idx] = WaterType::River;
+                    finalType = WaterType::River;
                 }
                 else if (riverType == WaterType::Stream)
                 {
-                    m_Data.waterType[idx] = WaterType::Stream;
+                    finalType = WaterType::Stream;
+                }
+
+                if (m_Data.waterType[idx] != finalType ||
+                    m_Data.waterSurfaceHeight[idx] != surfaceHeight)
+                {
+                    m_Data.waterType[idx] = finalType;
+                    m_Data.waterSurfaceHeight[idx] = surfaceHeight;
+                    m_DirtyRegion.Expand(x, z);
                 }
             }
         }
@@ -105,8 +137,12 @@ namespace Genesis
 
     void HydrologyGenerator::ComputeDistanceToWater(float cellSize)
     {
-        // Multi-source BFS from all water cells
+        // Multi-source BFS from all water cells. Distances relax through a
+        // full-precision working buffer so the quantized field never feeds
+        // back into its own comparisons; the result is stored once at the end.
         std::queue<std::pair<int, int>> queue;
+        std::vector<float> distance(static_cast<size_t>(m_Data.width) * m_Data.depth,
+                                    std::numeric_limits<float>::max());
 
         // Initialize: all water cells have distance 0
         for (int z = 0; z < m_Data.depth; z++)
@@ -116,7 +152,7 @@ namespace Genesis
                 size_t idx = m_Data.Index(x, z);
                 if (m_Data.waterType[idx] != WaterType::None)
                 {
-                    m_Data.distanceToWater[idx] = 0.0f;
+                    distance[idx] = 0.0f;
                     queue.push({x, z});
                 }
             }
@@ -129,7 +165,7 @@ namespace Genesis
             queue.pop();
 
             size_t cIdx = m_Data.Index(cx, cz);
-            float currentDist = m_Data.distanceToWater[cIdx];
+            float currentDist = distance[cIdx];
 
             // Check 8 neighbors
             for (int d = 0; d < 8; d++)
@@ -145,14 +181,25 @@ namespace Genesis
                 float newDist = currentDist + stepDist;
 
                 // Only update if we found a shorter path and within max distance
-                if (newDist < m_Data.distanceToWater[nIdx] &&
+                if (newDist < distance[nIdx] &&
                     newDist < m_Settings.maxWaterDistance)
                 {
-                    m_Data.distanceToWater[nIdx] = newDist;
+                    distance[nIdx] = newDist;
                     queue.push({nx, nz});
                 }
             }
         }
+
+        for (size_t i = 0; i < distance.size(); i++)
+        {
+            float stored = m_Data.distanceToWater[i];
+            m_Data.distanceToWater.Set(i, distance[i]);
+            if (m_Data.distanceToWater[i] != stored)
+            {
+                m_DirtyRegion.Expand(static_cast<int>(i) % m_Data.width,
+                                     static_cast<int>(i) / m_Data.width);
+            }
+        }
     }
 
     void HydrologyGenerator::ComputeMoisture()
@@ -179,20 +226,26 @@ namespace Genesis
                 float humidityFactor = m_Settings.baseHumidity;
 
                 // Water cells have maximum moisture
+                float moisture;
                 if (m_Data.waterType[idx] != WaterType::None)
                 {
-                    m_Data.moisture[idx] = 1.0f;
+                    moisture = 1.0f;
                 }
                 else
                 {
-                    // Weighted combination
-                    m_Data.moisture[idx] =
+                    // Weighted combination, clamped to [0, 1]
+                    moisture = std::clamp(
                         flowFactor * m_Settings.flowMoistureWeight +
-                        proximityFactor * m_Settings.proximityMoistureWeight +
-                        humidityFactor * m_Settings.humidityWeight;
+                            proximityFactor * m_Settings.proximityMoistureWeight +
+                            humidityFactor * m_Settings.humidityWeight,
+                        0.0f, 1.0f);
+                }
 
-                    // Clamp to [0, 1]
-                    m_Data.moisture[idx] = std::clamp(m_Data.moisture[idx], 0.0f, 1.0f);
+                float stored = m_Data.moisture[idx];
+                m_Data.moisture.Set(idx, moisture);
+                if (m_Data.moisture[idx] != stored)
+                {
+                    m_DirtyRegion.Expand(x, z);
                 }
             }
         }
@@ -1,8 +1,10 @@
 #include "genesis/procedural/LakeGenerator.h"
+#include "genesis/core/ScratchArena.h"
 #include <algorithm>
 #include <cmath>
 #include <queue>
 #include <unordered_set>
+#include "genesis/core/Profiler.h"
 
 namespace Genesis
 {
@@ -11,358 +13,257 @@ namespace Genesis
                                  const std::vector<float> &heightmap,
                                  float seaLevel)
     {
+        GEN_PROFILE_SCOPE("LakeGenerator::Generate");
         const DrainageData &data = drainage.GetData();
         m_Network.Resize(data.width, data.depth);
         m_Network.Clear();
 
-        // Section 22.1: Basin Detection
-        DetectBasins(drainage, heightmap, seaLevel);
-
-        // Section 22.2: Lake Fill
-        FillLakes(heightmap);
+        // Section 22.1/22.2: depression detection and fill levels come out
+        // of a single Barnes priority-flood sweep instead of per-pit ocean
+        // reachability traces and repeated neighborhood flood fills. The
+        // fill and parent fields only live for this stage, so the whole
+        // sweep runs out of the thread's scratch arena.
+        GEN_SCRATCH_SCOPE();
+        ScratchVector<float> fill;
+        ScratchVector<int32_t> parent;
+        PriorityFlood(heightmap, seaLevel, fill, parent);
+        ExtractBasins(heightmap, fill, parent);
     }
 
-    void LakeGenerator::DetectBasins(const DrainageGraph &drainage,
-                                     const std::vector<float> &heightmap,
-                                     float seaLevel)
+    void LakeGenerator::PriorityFlood(const std::vector<float> &heightmap,
+                                      float seaLevel,
+                                      ScratchVector<float> &outFill,
+                                      ScratchVector<int32_t> &outParent) const
     {
-        const DrainageData &data = drainage.GetData();
-        std::vector<bool> visited(static_cast<size_t>(data.width) * data.depth, false);
+        const int width = m_Network.width;
+        const int depth = m_Network.depth;
+        const size_t size = static_cast<size_t>(width) * depth;
 
-        // Find all pit cells (local minima)
-        std::vector<glm::ivec2> pits = drainage.FindPits();
+        outFill.assign(heightmap.begin(), heightmap.end());
+        outParent.assign(size, -1);
 
-        for (const auto &pit : pits)
-        {
-            size_t pitIdx = static_cast<size_t>(pit.y) * data.width + pit.x;
+        ScratchVector<bool> visited(size, false);
 
-            // Skip if already visited or below sea level (ocean)
-            if (visited[pitIdx])
-                continue;
+        // Binary min-heap on fill level: pair<fill height, cell index>
+        using HeapEntry = std::pair<float, int32_t>;
+        auto cmp = [](const HeapEntry &a, const HeapEntry &b)
+        {
+            return a.first > b.first; // Min heap
+        };
+        std::priority_queue<HeapEntry, ScratchVector<HeapEntry>, decltype(cmp)>
+            frontier(cmp);
 
-            float pitHeight = heightmap[pitIdx];
-            if (pitHeight < seaLevel)
+        auto seed = [&](size_t idx)
+        {
+            if (!visited[idx])
             {
-                // Below sea level - mark as visited but don't create lake
-                visited[pitIdx] = true;
-                continue;
+                visited[idx] = true;
+                frontier.push({outFill[idx], static_cast<int32_t>(idx)});
             }
+        };
 
-            // Section 22.1: Check if pit can reach ocean
-            // If no ocean reachability → basin
-            if (!CanReachOcean(drainage, pit.x, pit.y))
-            {
-                // This pit forms a closed basin - flood fill to find extent
-                // Start with a high fill height and refine later
-                float maxFillHeight = pitHeight + m_Settings.maxDepth;
-                LakeBasin basin = FloodFillBasin(drainage, heightmap,
-                                                 pit.x, pit.y,
-                                                 maxFillHeight, visited);
-
-                // Only keep basins above minimum size AND minimum depth
-                float basinDepth = basin.spillHeight - basin.basinFloor;
-                bool meetsSize = static_cast<int>(basin.cells.size()) >= m_Settings.minBasinSize;
-                bool meetsDepth = basinDepth >= m_Settings.minBasinDepth;
-
-                if (meetsSize && meetsDepth)
-                {
-                    int lakeIndex = static_cast<int>(m_Network.lakes.size());
-
-                    // Mark cells as belonging to this lake
-                    for (const auto &cell : basin.cells)
-                    {
-                        size_t idx = m_Network.Index(cell.x, cell.y);
-                        m_Network.cellLakeIndex[idx] = lakeIndex;
-                    }
+        // Water always escapes through the grid boundary...
+        for (int x = 0; x < width; x++)
+        {
+            seed(static_cast<size_t>(x));
+            seed(static_cast<size_t>(depth - 1) * width + x);
+        }
+        for (int z = 0; z < depth; z++)
+        {
+            seed(static_cast<size_t>(z) * width);
+            seed(static_cast<size_t>(z) * width + width - 1);
+        }
 
-                    m_Network.lakes.push_back(basin);
-                }
-            }
-            else
+        // ...and through the ocean: below-sea cells drain and never pond
+        for (size_t i = 0; i < size; i++)
+        {
+            if (heightmap[i] < seaLevel)
             {
-                visited[pitIdx] = true;
+                seed(i);
             }
         }
-    }
 
-    bool LakeGenerator::CanReachOcean(const DrainageGraph &drainage, int x, int z) const
-    {
-        const DrainageData &data = drainage.GetData();
-        const int maxIterations = data.width * data.depth; // Prevent infinite loops
-
-        int currentX = x;
-        int currentZ = z;
-
-        for (int i = 0; i < maxIterations; i++)
+        // Sweep inward in height order. A cell popped at level L raises any
+        // lower unvisited neighbor to L: that neighbor sits inside a
+        // depression and ponds up to the saddle the water arrived over.
+        while (!frontier.empty())
         {
-            FlowDirection dir = drainage.GetFlowDirection(currentX, currentZ);
+            auto [level, idx] = frontier.top();
+            frontier.pop();
 
-            // Reached ocean or boundary - can reach ocean
-            if (dir == FlowDirection::Ocean || dir == FlowDirection::Boundary)
-            {
-                return true;
-            }
+            int x = idx % width;
+            int z = idx / width;
 
-            // Reached pit or flat - cannot reach ocean
-            if (dir == FlowDirection::Pit || dir == FlowDirection::Flat)
+            for (int d = 0; d < 8; d++)
             {
-                return false;
-            }
+                int nx = x + FLOW_OFFSET_X[d];
+                int nz = z + FLOW_OFFSET_Z[d];
 
-            // Follow flow direction
-            int nextX, nextZ;
-            if (!drainage.GetDownstreamCell(currentX, currentZ, nextX, nextZ))
-            {
-                return false; // No downstream cell
-            }
+                if (!m_Network.InBounds(nx, nz))
+                    continue;
 
-            currentX = nextX;
-            currentZ = nextZ;
-        }
+                size_t nIdx = m_Network.Index(nx, nz);
+                if (visited[nIdx])
+                    continue;
 
-        return false; // Exceeded iteration limit
+                visited[nIdx] = true;
+                outFill[nIdx] = std::max(heightmap[nIdx], level);
+                outParent[nIdx] = idx;
+                frontier.push({outFill[nIdx], static_cast<int32_t>(nIdx)});
+            }
+        }
     }
 
-    LakeBasin LakeGenerator::FloodFillBasin(const DrainageGraph &drainage,
-                                            const std::vector<float> &heightmap,
-                                            int startX, int startZ,
-                                            float fillHeight,
-                                            std::vector<bool> &visited) const
+    void LakeGenerator::ExtractBasins(const std::vector<float> &heightmap,
+                                      const ScratchVector<float> &fill,
+                                      const ScratchVector<int32_t> &parent)
     {
-        const DrainageData &data = drainage.GetData();
-        LakeBasin basin;
-        basin.lowestCell = glm::ivec2(startX, startZ);
-        basin.basinFloor = heightmap[static_cast<size_t>(startZ) * data.width + startX];
-        basin.spillPoint = glm::ivec2(-1, -1);
-        basin.spillHeight = fillHeight;
-        basin.hasOutflow = false;
-        basin.outflowDirection = -1;
-        basin.volume = 0.0f;
-
-        // Priority queue for filling (lowest cells first)
-        // pair<height, ivec2>
-        auto cmp = [](const std::pair<float, glm::ivec2> &a,
-                      const std::pair<float, glm::ivec2> &b)
-        {
-            return a.first > b.first; // Min heap
-        };
-        std::priority_queue<std::pair<float, glm::ivec2>,
-                            std::vector<std::pair<float, glm::ivec2>>,
-                            decltype(cmp)>
-            frontier(cmp);
+        const int width = m_Network.width;
+        const size_t size = fill.size();
 
-        // Start from the pit
-        size_t startIdx = static_cast<size_t>(startZ) * data.width + startX;
-        visited[startIdx] = true;
-        basin.cells.push_back(glm::ivec2(startX, startZ));
+        // Treat sub-epsilon ponding as numerical noise, not a lake
+        constexpr float DEPRESSION_EPSILON = 1e-4f;
 
-        // Add all neighbors to frontier
-        for (int d = 0; d < 8; d++)
+        auto depressed = [&](size_t idx)
         {
-            int nx = startX + FLOW_OFFSET_X[d];
-            int nz = startZ + FLOW_OFFSET_Z[d];
-
-            if (!data.InBounds(nx, nz))
-                continue;
+            return fill[idx] - heightmap[idx] > DEPRESSION_EPSILON;
+        };
 
-            size_t nIdx = static_cast<size_t>(nz) * data.width + nx;
-            if (!visited[nIdx])
+        auto directionTo = [](int fromX, int fromZ, int toX, int toZ)
+        {
+            for (int d = 0; d < 8; d++)
             {
-                float h = heightmap[nIdx];
-                frontier.push({h, glm::ivec2(nx, nz)});
+                if (toX == fromX + FLOW_OFFSET_X[d] &&
+                    toZ == fromZ + FLOW_OFFSET_Z[d])
+                {
+                    return d;
+                }
             }
-        }
+            return -1;
+        };
 
-        // Flood fill - expand basin to lowest surrounding saddle
-        while (!frontier.empty())
-        {
-            auto [height, cell] = frontier.top();
-            frontier.pop();
+        ScratchVector<bool> claimed(size, false);
+        ScratchVector<size_t> stack;
 
-            size_t idx = static_cast<size_t>(cell.y) * data.width + cell.x;
-            if (visited[idx])
+        for (size_t start = 0; start < size; start++)
+        {
+            if (claimed[start] || !depressed(start))
                 continue;
 
-            // Check if this cell flows into our basin
-            // If it drains elsewhere, this is a potential spill point
-            FlowDirection dir = drainage.GetFlowDirection(cell.x, cell.y);
+            // Flood the connected depressed region. Priority-flood gives
+            // every cell of one depression the same fill level - its spill
+            // height - so the component shares a single flat surface.
+            LakeBasin basin;
+            basin.lowestCell = glm::ivec2(static_cast<int>(start % width),
+                                          static_cast<int>(start / width));
+            basin.spillPoint = glm::ivec2(-1, -1);
+            basin.basinFloor = heightmap[start];
+            basin.spillHeight = fill[start];
+            basin.surfaceHeight = fill[start];
+            basin.volume = 0.0f;
+            basin.hasOutflow = false;
+            basin.outflowDirection = -1;
+
+            stack.clear();
+            stack.push_back(start);
+            claimed[start] = true;
 
-            // If this cell is higher than our current spill height, stop
-            if (height > basin.spillHeight)
+            while (!stack.empty())
             {
-                continue;
-            }
+                size_t idx = stack.back();
+                stack.pop_back();
 
-            // Check if this cell drains into the basin or is a boundary
-            int downX, downZ;
-            bool hasDownstream = drainage.GetDownstreamCell(cell.x, cell.y, downX, downZ);
+                int x = static_cast<int>(idx % width);
+                int z = static_cast<int>(idx / width);
+                basin.cells.emplace_back(x, z);
 
-            if (hasDownstream)
-            {
-                size_t downIdx = static_cast<size_t>(downZ) * data.width + downX;
-                bool drainsIntoBasis = visited[downIdx];
+                if (heightmap[idx] < basin.basinFloor)
+                {
+                    basin.basinFloor = heightmap[idx];
+                    basin.lowestCell = glm::ivec2(x, z);
+                }
 
-                if (!drainsIntoBasis)
+                for (int d = 0; d < 8; d++)
                 {
-                    // This cell drains outside - potential spill point
-                    if (height < basin.spillHeight)
-                    {
-                        basin.spillHeight = height;
-                        basin.spillPoint = cell;
-                        basin.hasOutflow = true;
+                    int nx = x + FLOW_OFFSET_X[d];
+                    int nz = z + FLOW_OFFSET_Z[d];
 
-                        // Find outflow direction
-                        for (int d = 0; d < 8; d++)
-                        {
-                            if (downX == cell.x + FLOW_OFFSET_X[d] &&
-                                downZ == cell.y + FLOW_OFFSET_Z[d])
-                            {
-                                basin.outflowDirection = d;
-                                break;
-                            }
-                        }
+                    if (!m_Network.InBounds(nx, nz))
+                        continue;
+
+                    size_t nIdx = m_Network.Index(nx, nz);
+                    if (!claimed[nIdx] && depressed(nIdx))
+                    {
+                        claimed[nIdx] = true;
+                        stack.push_back(nIdx);
                     }
-                    continue; // Don't add to basin
                 }
             }
 
-            // Add cell to basin
-            visited[idx] = true;
-            basin.cells.push_back(cell);
+            // Only keep basins above minimum size AND minimum depth
+            float basinDepth = basin.spillHeight - basin.basinFloor;
+            bool meetsSize = static_cast<int>(basin.cells.size()) >= m_Settings.minBasinSize;
+            bool meetsDepth = basinDepth >= m_Settings.minBasinDepth;
+            if (!meetsSize || !meetsDepth)
+                continue;
 
-            // Track lowest point
-            if (height < basin.basinFloor)
-            {
-                basin.basinFloor = height;
-                basin.lowestCell = cell;
-            }
+            // Cap surface depth for visual/gameplay limits
+            basin.surfaceHeight = std::min(basin.spillHeight,
+                                           basin.basinFloor + m_Settings.maxDepth);
 
-            // Add neighbors to frontier
-            for (int d = 0; d < 8; d++)
+            // Walk the flood parents out of the depression: the first
+            // non-depressed ancestor is the saddle the lake spills over
+            size_t walk = m_Network.Index(basin.lowestCell.x, basin.lowestCell.y);
+            while (parent[walk] >= 0 && depressed(static_cast<size_t>(parent[walk])))
             {
-                int nx = cell.x + FLOW_OFFSET_X[d];
-                int nz = cell.y + FLOW_OFFSET_Z[d];
-
-                if (!data.InBounds(nx, nz))
-                    continue;
-
-                size_t nIdx = static_cast<size_t>(nz) * data.width + nx;
-                if (!visited[nIdx])
-                {
-                    float h = heightmap[nIdx];
-                    frontier.push({h, glm::ivec2(nx, nz)});
-                }
+                walk = static_cast<size_t>(parent[walk]);
             }
-        }
-
-        return basin;
-    }
 
-    void LakeGenerator::FillLakes(const std::vector<float> &heightmap)
-    {
-        // Section 22.2: Lake Fill
-        // Lakes are filled to the lowest spill point
-        // Lake surface becomes flat water plane
+            if (parent[walk] >= 0)
+            {
+                size_t saddle = static_cast<size_t>(parent[walk]);
+                int saddleX = static_cast<int>(saddle % width);
+                int saddleZ = static_cast<int>(saddle / width);
 
-        for (size_t i = 0; i < m_Network.lakes.size(); i++)
-        {
-            LakeBasin &basin = m_Network.lakes[i];
+                basin.spillPoint = glm::ivec2(saddleX, saddleZ);
+                basin.hasOutflow = true;
 
-            // Find actual spill point if not already found
-            if (!basin.hasOutflow)
-            {
-                glm::ivec2 spill;
-                float spillH;
-                int spillDir;
-                if (FindSpillPoint(basin, heightmap, spill, spillH, spillDir))
+                // Outflow continues along the saddle's own flood parent when
+                // there is one, otherwise straight away from the lake
+                if (parent[saddle] >= 0)
                 {
-                    basin.spillPoint = spill;
-                    basin.spillHeight = spillH;
-                    basin.hasOutflow = true;
-                    basin.outflowDirection = spillDir;
+                    size_t next = static_cast<size_t>(parent[saddle]);
+                    basin.outflowDirection = directionTo(saddleX, saddleZ,
+                                                         static_cast<int>(next % width),
+                                                         static_cast<int>(next / width));
                 }
                 else
                 {
-                    // No spill point found - fill to max depth
-                    basin.spillHeight = basin.basinFloor + m_Settings.maxDepth;
+                    basin.outflowDirection = directionTo(static_cast<int>(walk % width),
+                                                         static_cast<int>(walk / width),
+                                                         saddleX, saddleZ);
                 }
             }
 
-            // Set surface height
-            basin.surfaceHeight = basin.spillHeight;
-
-            // Calculate volume and water depth per cell
-            basin.volume = 0.0f;
+            // Register the basin as an indexed region: per-cell lake index,
+            // water depth and surface flags for the mesh generator
+            int lakeIndex = static_cast<int>(m_Network.lakes.size());
             for (const auto &cell : basin.cells)
             {
                 size_t idx = m_Network.Index(cell.x, cell.y);
-                float terrainH = heightmap[idx];
+                m_Network.cellLakeIndex[idx] = lakeIndex;
 
-                if (terrainH < basin.surfaceHeight)
+                if (heightmap[idx] < basin.surfaceHeight)
                 {
-                    float depth = basin.surfaceHeight - terrainH;
-                    m_Network.cellLakeDepth[idx] = depth;
+                    float waterDepth = basin.surfaceHeight - heightmap[idx];
+                    m_Network.cellLakeDepth[idx] = waterDepth;
                     m_Network.isLakeSurface[idx] = true;
-                    basin.volume += depth;
+                    basin.volume += waterDepth;
                 }
             }
-        }
-    }
-
-    bool LakeGenerator::FindSpillPoint(const LakeBasin &basin,
-                                       const std::vector<float> &heightmap,
-                                       glm::ivec2 &outSpillPoint,
-                                       float &outSpillHeight,
-                                       int &outDirection) const
-    {
-        // Find the lowest cell on the basin boundary that leads outside
-        float lowestSpill = std::numeric_limits<float>::max();
-        bool found = false;
-
-        // Build set of basin cells for quick lookup
-        std::unordered_set<int64_t> basinCells;
-        for (const auto &cell : basin.cells)
-        {
-            int64_t key = (static_cast<int64_t>(cell.y) << 32) | cell.x;
-            basinCells.insert(key);
-        }
-
-        // Check all boundary cells
-        for (const auto &cell : basin.cells)
-        {
-            for (int d = 0; d < 8; d++)
-            {
-                int nx = cell.x + FLOW_OFFSET_X[d];
-                int nz = cell.y + FLOW_OFFSET_Z[d];
-
-                if (!m_Network.InBounds(nx, nz))
-                    continue;
-
-                int64_t nKey = (static_cast<int64_t>(nz) << 32) | nx;
-                if (basinCells.find(nKey) != basinCells.end())
-                    continue; // Neighbor is in basin
 
-                // This neighbor is outside the basin
-                size_t idx = m_Network.Index(cell.x, cell.y);
-                float cellHeight = heightmap[idx];
-
-                // Spill height is the max of cell height and neighbor height
-                size_t nIdx = m_Network.Index(nx, nz);
-                float neighborHeight = heightmap[nIdx];
-                float spillHeight = std::max(cellHeight, neighborHeight);
-
-                if (spillHeight < lowestSpill)
-                {
-                    lowestSpill = spillHeight;
-                    outSpillPoint = cell;
-                    outSpillHeight = spillHeight;
-                    outDirection = d;
-                    found = true;
-                }
-            }
+            m_Network.lakes.push_back(std::move(basin));
         }
-
-        return found;
     }
 
     void LakeGenerator::ApplyLakes(std::vector<float> &heightmap, float cellSize) const
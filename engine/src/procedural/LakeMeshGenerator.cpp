@@ -2,6 +2,7 @@
 #include <glm/gtc/constants.hpp>
 #include <algorithm>
 #include <cmath>
+#include <map>
 #include <set>
 
 namespace Genesis
@@ -51,9 +52,31 @@ namespace Genesis
         center /= static_cast<float>(basin.cells.size());
         meshData.center = chunkOffset + glm::vec3(center.x * cellSize, basin.surfaceHeight, center.y * cellSize);
 
-        // Generate vertices for each lake cell
-        // Use a simple grid approach - one quad per cell
-        size_t baseVertex = 0;
+        // Generate vertices for each lake cell. One quad per cell, with
+        // corner vertices shared between neighboring cells - the water
+        // shader derives its surface normal and color procedurally, so
+        // nothing per-cell needs to live on duplicated corners.
+        std::map<std::pair<int, int>, uint32_t> cornerIndices;
+
+        auto GetCornerIndex = [&](int cx, int cy, const glm::vec3 &color) -> uint32_t
+        {
+            auto it = cornerIndices.find({cx, cy});
+            if (it != cornerIndices.end())
+            {
+                return it->second;
+            }
+
+            Vertex v;
+            v.Position = glm::vec3(chunkOffset.x + cx * cellSize, basin.surfaceHeight, chunkOffset.z + cy * cellSize);
+            v.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+            v.Color = color;
+            v.TexCoord = glm::vec2(static_cast<float>(cx % 2), static_cast<float>(cy % 2));
+
+            uint32_t index = static_cast<uint32_t>(meshData.vertices.size());
+            meshData.vertices.push_back(v);
+            cornerIndices[{cx, cy}] = index;
+            return index;
+        };
 
         for (const auto &cell : basin.cells)
         {
@@ -66,52 +89,19 @@ namespace Genesis
             float depth = network.cellLakeDepth[idx];
             glm::vec3 color = ComputeDepthColor(depth);
 
-            // Cell corners in world space
-            float x0 = chunkOffset.x + cell.x * cellSize;
-            float x1 = chunkOffset.x + (cell.x + 1) * cellSize;
-            float z0 = chunkOffset.z + cell.y * cellSize;
-            float z1 = chunkOffset.z + (cell.y + 1) * cellSize;
-            float y = basin.surfaceHeight;
-
-            // Create quad vertices
-            Vertex v0, v1, v2, v3;
-
-            v0.Position = glm::vec3(x0, y, z0);
-            v0.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-            v0.Color = color;
-            v0.TexCoord = glm::vec2(0.0f, 0.0f);
-
-            v1.Position = glm::vec3(x1, y, z0);
-            v1.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-            v1.Color = color;
-            v1.TexCoord = glm::vec2(1.0f, 0.0f);
-
-            v2.Position = glm::vec3(x1, y, z1);
-            v2.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-            v2.Color = color;
-            v2.TexCoord = glm::vec2(1.0f, 1.0f);
-
-            v3.Position = glm::vec3(x0, y, z1);
-            v3.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-            v3.Color = color;
-            v3.TexCoord = glm::vec2(0.0f, 1.0f);
-
-            meshData.vertices.push_back(v0);
-            meshData.vertices.push_back(v1);
-            meshData.vertices.push_back(v2);
-            meshData.vertices.push_back(v3);
+            uint32_t i00 = GetCornerIndex(cell.x, cell.y, color);
+            uint32_t i10 = GetCornerIndex(cell.x + 1, cell.y, color);
+            uint32_t i11 = GetCornerIndex(cell.x + 1, cell.y + 1, color);
+            uint32_t i01 = GetCornerIndex(cell.x, cell.y + 1, color);
 
             // Two triangles per quad (CCW winding)
-            uint32_t base = static_cast<uint32_t>(baseVertex);
-            meshData.indices.push_back(base + 0);
-            meshData.indices.push_back(base + 3);
-            meshData.indices.push_back(base + 1);
+            meshData.indices.push_back(i00);
+            meshData.indices.push_back(i01);
+            meshData.indices.push_back(i10);
 
-            meshData.indices.push_back(base + 1);
-            meshData.indices.push_back(base + 3);
-            meshData.indices.push_back(base + 2);
-
-            baseVertex += 4;
+            meshData.indices.push_back(i10);
+            meshData.indices.push_back(i01);
+            meshData.indices.push_back(i11);
         }
 
         return meshData;
@@ -168,6 +158,10 @@ namespace Genesis
             return nullptr;
         }
 
+        // Cell-scan emission from the fill; regroup triangles for the
+        // post-transform cache before upload
+        Mesh::OptimizeForVertexCache(allIndices, static_cast<uint32_t>(allVertices.size()));
+
         return std::make_unique<Mesh>(allVertices, allIndices);
     }
 
@@ -1,4 +1,5 @@
 #include "genesis/procedural/MaterialBlender.h"
+#include "genesis/procedural/SystemInvariants.h"
 #include <algorithm>
 #include <cmath>
 
@@ -34,9 +35,9 @@ namespace Genesis
                     fertility, distanceToWater, waterType);
 
                 weights.Normalize();
+                GEN_INVARIANT_MATERIALS_BLENDED_SAMPLED(weights, idx);
 
-                m_Data.cellMaterials[idx] = weights;
-                m_Data.dominantMaterial[idx] = weights.GetDominant();
+                m_Data.cellMaterials[idx] = PackedMaterial::Pack(weights);
             }
         }
     }
@@ -144,12 +145,15 @@ namespace Genesis
     }
 
     MaterialWeights MaterialBlender::GetMaterialWeights(int x, int z) const
+    {
+        return GetPackedMaterial(x, z).Unpack();
+    }
+
+    PackedMaterial MaterialBlender::GetPackedMaterial(int x, int z) const
     {
         if (!m_Data.InBounds(x, z))
         {
-            MaterialWeights defaultWeights;
-            defaultWeights[MaterialType::Dirt] = 1.0f;
-            return defaultWeights;
+            return PackedMaterial(); // Pure dirt
         }
         return m_Data.cellMaterials[m_Data.Index(x, z)];
     }
@@ -158,7 +162,7 @@ namespace Genesis
     {
         if (!m_Data.InBounds(x, z))
             return MaterialType::Dirt;
-        return m_Data.dominantMaterial[m_Data.Index(x, z)];
+        return m_Data.cellMaterials[m_Data.Index(x, z)].primary;
     }
 
     const char *MaterialBlender::GetMaterialName(MaterialType type)
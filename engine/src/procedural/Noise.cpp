@@ -1,9 +1,15 @@
 #include "genesis/procedural/Noise.h"
 #include <algorithm>
+#include <mutex>
 #include <numeric>
 #include <random>
+#include <unordered_map>
 #include <cmath>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace Genesis {
 
     SimplexNoise::SimplexNoise(uint32_t seed) {
@@ -11,21 +17,25 @@ namespace Genesis {
     }
 
     void SimplexNoise::SetSeed(uint32_t seed) {
-        m_Permutation.resize(512);
-        
         // Initialize with values 0-255
-        std::vector<int> p(256);
+        std::array<uint8_t, 256> p;
         std::iota(p.begin(), p.end(), 0);
-        
+
         // Shuffle using seed
         std::mt19937 rng(seed);
         std::shuffle(p.begin(), p.end(), rng);
-        
+
         // Duplicate for overflow handling
         for (int i = 0; i < 256; i++) {
             m_Permutation[i] = p[i];
             m_Permutation[256 + i] = p[i];
         }
+
+#if defined(__AVX2__)
+        for (int i = 0; i < 512; i++) {
+            m_PermutationWide[i] = m_Permutation[i];
+        }
+#endif
     }
 
     float SimplexNoise::Grad(int hash, float x, float y) const {
@@ -173,6 +183,269 @@ namespace Genesis {
         return 32.0f * (n0 + n1 + n2 + n3);
     }
 
+    float SimplexNoise::NoiseDeriv(float x, float y, float& outDx, float& outDy) const {
+        const float F2 = 0.5f * (std::sqrt(3.0f) - 1.0f);
+        const float G2 = (3.0f - std::sqrt(3.0f)) / 6.0f;
+
+        float s = (x + y) * F2;
+        int i = static_cast<int>(std::floor(x + s));
+        int j = static_cast<int>(std::floor(y + s));
+
+        float t = (i + j) * G2;
+        float x0 = x - (i - t);
+        float y0 = y - (j - t);
+
+        int i1, j1;
+        if (x0 > y0) { i1 = 1; j1 = 0; }
+        else { i1 = 0; j1 = 1; }
+
+        float cornerX[3] = {x0, x0 - i1 + G2, x0 - 1.0f + 2.0f * G2};
+        float cornerY[3] = {y0, y0 - j1 + G2, y0 - 1.0f + 2.0f * G2};
+
+        int ii = i & 255;
+        int jj = j & 255;
+        int hashes[3] = {
+            m_Permutation[ii + m_Permutation[jj]],
+            m_Permutation[ii + i1 + m_Permutation[jj + j1]],
+            m_Permutation[ii + 1 + m_Permutation[jj + 1]],
+        };
+
+        float n = 0.0f;
+        float dx = 0.0f;
+        float dy = 0.0f;
+
+        for (int c = 0; c < 3; c++) {
+            float cx = cornerX[c];
+            float cy = cornerY[c];
+            float falloff = 0.5f - cx * cx - cy * cy;
+            if (falloff < 0.0f) continue;
+
+            // Gradient components of Grad(hash, x, y) = (+-u) + (+-2v)
+            int h = hashes[c] & 7;
+            float su = (h & 1) ? -1.0f : 1.0f;
+            float sv = (h & 2) ? -2.0f : 2.0f;
+            float gx = (h < 4) ? su : sv;
+            float gy = (h < 4) ? sv : su;
+
+            float dot = gx * cx + gy * cy;
+            float t2 = falloff * falloff;
+            float t4 = t2 * t2;
+
+            // d(t^4 * dot)/dx = t^4 * gx - 8x * t^3 * dot (dt/dx = -2x)
+            n += t4 * dot;
+            dx += t4 * gx - 8.0f * cx * falloff * t2 * dot;
+            dy += t4 * gy - 8.0f * cy * falloff * t2 * dot;
+        }
+
+        outDx = 70.0f * dx;
+        outDy = 70.0f * dy;
+        return 70.0f * n;
+    }
+
+    float SimplexNoise::FBMDeriv(float x, float y, int octaves, float persistence, float lacunarity,
+                                 float& outDx, float& outDy) const {
+        float total = 0.0f;
+        float totalDx = 0.0f;
+        float totalDy = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxValue = 0.0f;
+
+        for (int i = 0; i < octaves; i++) {
+            float dx, dy;
+            float n = NoiseDeriv(x * frequency, y * frequency, dx, dy);
+            total += n * amplitude;
+            // Chain rule: the octave samples at (x * frequency, y * frequency)
+            totalDx += dx * amplitude * frequency;
+            totalDy += dy * amplitude * frequency;
+            maxValue += amplitude;
+            amplitude *= persistence;
+            frequency *= lacunarity;
+        }
+
+        outDx = totalDx / maxValue;
+        outDy = totalDy / maxValue;
+        return total / maxValue;
+    }
+
+    float SimplexNoise::RidgeNoiseDeriv(float x, float y, int octaves, float persistence, float lacunarity,
+                                        float& outDx, float& outDy) const {
+        float total = 0.0f;
+        float totalDx = 0.0f;
+        float totalDy = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxValue = 0.0f;
+
+        for (int i = 0; i < octaves; i++) {
+            float dx, dy;
+            float n = NoiseDeriv(x * frequency, y * frequency, dx, dy);
+
+            // r = (1 - |n|)^2, dr = -2 (1 - |n|) sign(n) dn
+            float ridge = 1.0f - std::abs(n);
+            float sign = (n >= 0.0f) ? 1.0f : -1.0f;
+            float dFactor = -2.0f * ridge * sign * amplitude * frequency;
+
+            total += ridge * ridge * amplitude;
+            totalDx += dFactor * dx;
+            totalDy += dFactor * dy;
+            maxValue += amplitude;
+            amplitude *= persistence;
+            frequency *= lacunarity;
+        }
+
+        outDx = totalDx / maxValue;
+        outDy = totalDy / maxValue;
+        return total / maxValue;
+    }
+
+#if defined(__AVX2__)
+    // 8-lane version of the 2D Noise() above. Table lookups use gathers into
+    // the permutation vector; everything else is straight lane arithmetic.
+    void SimplexNoise::NoiseBatch8(const float* xs, const float* ys, float* out) const {
+        const __m256 F2 = _mm256_set1_ps(0.36602540378f); // 0.5 * (sqrt(3) - 1)
+        const __m256 G2 = _mm256_set1_ps(0.21132486540f); // (3 - sqrt(3)) / 6
+        const __m256 one = _mm256_set1_ps(1.0f);
+
+        __m256 x = _mm256_loadu_ps(xs);
+        __m256 y = _mm256_loadu_ps(ys);
+
+        __m256 s = _mm256_mul_ps(_mm256_add_ps(x, y), F2);
+        __m256 fi = _mm256_floor_ps(_mm256_add_ps(x, s));
+        __m256 fj = _mm256_floor_ps(_mm256_add_ps(y, s));
+
+        __m256 t = _mm256_mul_ps(_mm256_add_ps(fi, fj), G2);
+        __m256 x0 = _mm256_sub_ps(x, _mm256_sub_ps(fi, t));
+        __m256 y0 = _mm256_sub_ps(y, _mm256_sub_ps(fj, t));
+
+        // i1 = x0 > y0 ? 1 : 0; j1 = 1 - i1
+        __m256 gtMask = _mm256_cmp_ps(x0, y0, _CMP_GT_OQ);
+        __m256 i1f = _mm256_and_ps(gtMask, one);
+        __m256 j1f = _mm256_sub_ps(one, i1f);
+
+        __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, i1f), G2);
+        __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, j1f), G2);
+        __m256 twoG2 = _mm256_add_ps(G2, G2);
+        __m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, one), twoG2);
+        __m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, one), twoG2);
+
+        const __m256i wrap = _mm256_set1_epi32(255);
+        __m256i ii = _mm256_and_si256(_mm256_cvttps_epi32(fi), wrap);
+        __m256i jj = _mm256_and_si256(_mm256_cvttps_epi32(fj), wrap);
+        __m256i i1 = _mm256_cvttps_epi32(i1f);
+        __m256i j1 = _mm256_cvttps_epi32(j1f);
+        __m256i oneI = _mm256_set1_epi32(1);
+
+        const int* perm = m_PermutationWide.data();
+        __m256i pj0 = _mm256_i32gather_epi32(perm, jj, 4);
+        __m256i pj1 = _mm256_i32gather_epi32(perm, _mm256_add_epi32(jj, j1), 4);
+        __m256i pj2 = _mm256_i32gather_epi32(perm, _mm256_add_epi32(jj, oneI), 4);
+        __m256i h0 = _mm256_i32gather_epi32(perm, _mm256_add_epi32(ii, pj0), 4);
+        __m256i h1 = _mm256_i32gather_epi32(perm, _mm256_add_epi32(_mm256_add_epi32(ii, i1), pj1), 4);
+        __m256i h2 = _mm256_i32gather_epi32(perm, _mm256_add_epi32(_mm256_add_epi32(ii, oneI), pj2), 4);
+
+        // grad(hash, x, y) across lanes: h = hash & 7; u = h < 4 ? x : y,
+        // v the other one; result = (+-u) + (+-2v) based on bits 0 and 1
+        auto gradDot = [](__m256i hash, __m256 gx, __m256 gy) {
+            __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(7));
+            __m256 lt4 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), h));
+            __m256 u = _mm256_blendv_ps(gy, gx, lt4);
+            __m256 v = _mm256_blendv_ps(gx, gy, lt4);
+            __m256 signU = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31));
+            __m256 signV = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30));
+            u = _mm256_xor_ps(u, signU);
+            __m256 v2 = _mm256_xor_ps(_mm256_add_ps(v, v), signV);
+            return _mm256_add_ps(u, v2);
+        };
+
+        // Corner contribution: max(0.5 - x^2 - y^2, 0)^4 * grad
+        auto contribution = [&gradDot](__m256i hash, __m256 cx, __m256 cy) {
+            __m256 falloff = _mm256_sub_ps(_mm256_set1_ps(0.5f),
+                                           _mm256_add_ps(_mm256_mul_ps(cx, cx), _mm256_mul_ps(cy, cy)));
+            falloff = _mm256_max_ps(falloff, _mm256_setzero_ps());
+            __m256 f2 = _mm256_mul_ps(falloff, falloff);
+            return _mm256_mul_ps(_mm256_mul_ps(f2, f2), gradDot(hash, cx, cy));
+        };
+
+        __m256 n = _mm256_add_ps(contribution(h0, x0, y0),
+                                 _mm256_add_ps(contribution(h1, x1, y1), contribution(h2, x2, y2)));
+        _mm256_storeu_ps(out, _mm256_mul_ps(n, _mm256_set1_ps(70.0f)));
+    }
+#endif
+
+    void SimplexNoise::Noise(const float* xs, const float* ys, float* out, size_t n) const {
+#if defined(__AVX2__)
+        size_t simdEnd = n & ~size_t(7);
+        for (size_t i = 0; i < simdEnd; i += 8) {
+            NoiseBatch8(xs + i, ys + i, out + i);
+        }
+        for (size_t i = simdEnd; i < n; i++) {
+            out[i] = Noise(xs[i], ys[i]);
+        }
+#else
+        for (size_t i = 0; i < n; i++) {
+            out[i] = Noise(xs[i], ys[i]);
+        }
+#endif
+    }
+
+    void SimplexNoise::FBM(const float* xs, const float* ys, float* out, size_t n,
+                           int octaves, float persistence, float lacunarity) const {
+        std::fill(out, out + n, 0.0f);
+
+        std::vector<float> fx(n), fy(n), octave(n);
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxValue = 0.0f;
+
+        for (int o = 0; o < octaves; o++) {
+            for (size_t i = 0; i < n; i++) {
+                fx[i] = xs[i] * frequency;
+                fy[i] = ys[i] * frequency;
+            }
+            Noise(fx.data(), fy.data(), octave.data(), n);
+            for (size_t i = 0; i < n; i++) {
+                out[i] += octave[i] * amplitude;
+            }
+            maxValue += amplitude;
+            amplitude *= persistence;
+            frequency *= lacunarity;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            out[i] /= maxValue;
+        }
+    }
+
+    void SimplexNoise::RidgeNoise(const float* xs, const float* ys, float* out, size_t n,
+                                  int octaves, float persistence, float lacunarity) const {
+        std::fill(out, out + n, 0.0f);
+
+        std::vector<float> fx(n), fy(n), octave(n);
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxValue = 0.0f;
+
+        for (int o = 0; o < octaves; o++) {
+            for (size_t i = 0; i < n; i++) {
+                fx[i] = xs[i] * frequency;
+                fy[i] = ys[i] * frequency;
+            }
+            Noise(fx.data(), fy.data(), octave.data(), n);
+            for (size_t i = 0; i < n; i++) {
+                float v = 1.0f - std::abs(octave[i]);  // Invert to create ridges
+                out[i] += v * v * amplitude;           // Square to sharpen ridges
+            }
+            maxValue += amplitude;
+            amplitude *= persistence;
+            frequency *= lacunarity;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            out[i] /= maxValue;
+        }
+    }
+
     float SimplexNoise::FBM(float x, float y, int octaves, float persistence, float lacunarity) const {
         float total = 0.0f;
         float amplitude = 1.0f;
@@ -273,4 +546,28 @@ namespace Genesis {
         return FBM(wx, wy, octaves, persistence, lacunarity);
     }
 
+    std::shared_ptr<const SimplexNoise> NoiseState::Get(uint32_t seed) {
+        static std::mutex s_Mutex;
+        static std::unordered_map<uint32_t, std::shared_ptr<const SimplexNoise>> s_Cache;
+
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        auto it = s_Cache.find(seed);
+        if (it != s_Cache.end()) {
+            return it->second;
+        }
+
+        // Editors scrubbing the seed slider would otherwise accumulate a
+        // table per value tried; drop entries nobody references anymore
+        constexpr size_t TRIM_THRESHOLD = 8;
+        if (s_Cache.size() >= TRIM_THRESHOLD) {
+            for (auto entry = s_Cache.begin(); entry != s_Cache.end();) {
+                entry = entry->second.use_count() == 1 ? s_Cache.erase(entry) : std::next(entry);
+            }
+        }
+
+        auto noise = std::make_shared<const SimplexNoise>(seed);
+        s_Cache.emplace(seed, noise);
+        return noise;
+    }
+
 }
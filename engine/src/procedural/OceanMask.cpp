@@ -9,9 +9,9 @@ namespace Genesis
         m_Width = width;
         m_Depth = depth;
 
-        int totalCells = width * depth;
-        m_BelowSeaMask.resize(totalCells, false);
-        m_OceanMask.resize(totalCells, false);
+        size_t totalCells = static_cast<size_t>(width) * depth;
+        m_BelowSeaMask.Resize(totalCells);
+        m_OceanMask.Resize(totalCells);
 
         m_Boundary.Resize(std::max(width, depth));
         m_FloodFillComplete = false;
@@ -24,13 +24,17 @@ namespace Genesis
             return;
         }
 
+        m_BelowSeaMask.Clear();
         for (int i = 0; i < m_Width * m_Depth; i++)
         {
-            m_BelowSeaMask[i] = heightmap[i] < seaLevel;
+            if (heightmap[i] < seaLevel)
+            {
+                m_BelowSeaMask.Set(i);
+            }
         }
 
         // Reset ocean mask - needs new flood fill
-        std::fill(m_OceanMask.begin(), m_OceanMask.end(), false);
+        m_OceanMask.Clear();
         m_Boundary.Clear();
         m_FloodFillComplete = false;
     }
@@ -39,8 +43,9 @@ namespace Genesis
         const std::function<bool(ChunkEdge)> &isAtWorldBoundary,
         const ChunkOceanBoundary *neighborBoundary)
     {
-
-        std::vector<std::pair<int, int>> seeds;
+        // Seeds and the fill stack live for this call only
+        GEN_SCRATCH_SCOPE();
+        ScratchVector<std::pair<int, int>> seeds;
 
         // Collect seed points from world boundaries
         // At world boundary, all below-sea cells on that edge are potential ocean seeds
@@ -50,7 +55,7 @@ namespace Genesis
         {
             for (int z = 0; z < m_Depth; z++)
             {
-                if (m_BelowSeaMask[CellIndex(0, z)])
+                if (m_BelowSeaMask.Test(CellIndex(0, z)))
                 {
                     seeds.emplace_back(0, z);
                 }
@@ -61,7 +66,7 @@ namespace Genesis
             // Propagate from neighbor's +X edge
             for (int z = 0; z < m_Depth && z < static_cast<int>(neighborBoundary->posX.size()); z++)
             {
-                if (neighborBoundary->posX[z] && m_BelowSeaMask[CellIndex(0, z)])
+                if (neighborBoundary->posX[z] && m_BelowSeaMask.Test(CellIndex(0, z)))
                 {
                     seeds.emplace_back(0, z);
                 }
@@ -73,7 +78,7 @@ namespace Genesis
         {
             for (int z = 0; z < m_Depth; z++)
             {
-                if (m_BelowSeaMask[CellIndex(m_Width - 1, z)])
+                if (m_BelowSeaMask.Test(CellIndex(m_Width - 1, z)))
                 {
                     seeds.emplace_back(m_Width - 1, z);
                 }
@@ -83,7 +88,7 @@ namespace Genesis
         {
             for (int z = 0; z < m_Depth && z < static_cast<int>(neighborBoundary->negX.size()); z++)
             {
-                if (neighborBoundary->negX[z] && m_BelowSeaMask[CellIndex(m_Width - 1, z)])
+                if (neighborBoundary->negX[z] && m_BelowSeaMask.Test(CellIndex(m_Width - 1, z)))
                 {
                     seeds.emplace_back(m_Width - 1, z);
                 }
@@ -95,7 +100,7 @@ namespace Genesis
         {
             for (int x = 0; x < m_Width; x++)
             {
-                if (m_BelowSeaMask[CellIndex(x, 0)])
+                if (m_BelowSeaMask.Test(CellIndex(x, 0)))
                 {
                     seeds.emplace_back(x, 0);
                 }
@@ -105,7 +110,7 @@ namespace Genesis
         {
             for (int x = 0; x < m_Width && x < static_cast<int>(neighborBoundary->posZ.size()); x++)
             {
-                if (neighborBoundary->posZ[x] && m_BelowSeaMask[CellIndex(x, 0)])
+                if (neighborBoundary->posZ[x] && m_BelowSeaMask.Test(CellIndex(x, 0)))
                 {
                     seeds.emplace_back(x, 0);
                 }
@@ -117,7 +122,7 @@ namespace Genesis
         {
             for (int x = 0; x < m_Width; x++)
             {
-                if (m_BelowSeaMask[CellIndex(x, m_Depth - 1)])
+                if (m_BelowSeaMask.Test(CellIndex(x, m_Depth - 1)))
                 {
                     seeds.emplace_back(x, m_Depth - 1);
                 }
@@ -127,22 +132,23 @@ namespace Genesis
         {
             for (int x = 0; x < m_Width && x < static_cast<int>(neighborBoundary->negZ.size()); x++)
             {
-                if (neighborBoundary->negZ[x] && m_BelowSeaMask[CellIndex(x, m_Depth - 1)])
+                if (neighborBoundary->negZ[x] && m_BelowSeaMask.Test(CellIndex(x, m_Depth - 1)))
                 {
                     seeds.emplace_back(x, m_Depth - 1);
                 }
             }
         }
 
-        // Perform BFS flood fill from seeds
-        FloodFillBFS(seeds);
+        // Perform scanline flood fill from seeds
+        FloodFillScanline(seeds);
         UpdateBoundaryFromMask();
         m_FloodFillComplete = true;
     }
 
     void OceanMask::PropagateFromNeighbor(ChunkEdge edge, const std::vector<bool> &neighborEdge)
     {
-        std::vector<std::pair<int, int>> seeds;
+        GEN_SCRATCH_SCOPE();
+        ScratchVector<std::pair<int, int>> seeds;
 
         switch (edge)
         {
@@ -150,7 +156,7 @@ namespace Genesis
             // Neighbor is on our -X side, their +X edge connects to our x=0
             for (int z = 0; z < m_Depth && z < static_cast<int>(neighborEdge.size()); z++)
             {
-                if (neighborEdge[z] && m_BelowSeaMask[CellIndex(0, z)] && !m_OceanMask[CellIndex(0, z)])
+                if (neighborEdge[z] && m_BelowSeaMask.Test(CellIndex(0, z)) && !m_OceanMask.Test(CellIndex(0, z)))
                 {
                     seeds.emplace_back(0, z);
                 }
@@ -160,7 +166,7 @@ namespace Genesis
             // Neighbor is on our +X side, their -X edge connects to our x=width-1
             for (int z = 0; z < m_Depth && z < static_cast<int>(neighborEdge.size()); z++)
             {
-                if (neighborEdge[z] && m_BelowSeaMask[CellIndex(m_Width - 1, z)] && !m_OceanMask[CellIndex(m_Width - 1, z)])
+                if (neighborEdge[z] && m_BelowSeaMask.Test(CellIndex(m_Width - 1, z)) && !m_OceanMask.Test(CellIndex(m_Width - 1, z)))
                 {
                     seeds.emplace_back(m_Width - 1, z);
                 }
@@ -170,7 +176,7 @@ namespace Genesis
             // Neighbor is on our -Z side, their +Z edge connects to our z=0
             for (int x = 0; x < m_Width && x < static_cast<int>(neighborEdge.size()); x++)
             {
-                if (neighborEdge[x] && m_BelowSeaMask[CellIndex(x, 0)] && !m_OceanMask[CellIndex(x, 0)])
+                if (neighborEdge[x] && m_BelowSeaMask.Test(CellIndex(x, 0)) && !m_OceanMask.Test(CellIndex(x, 0)))
                 {
                     seeds.emplace_back(x, 0);
                 }
@@ -180,7 +186,7 @@ namespace Genesis
             // Neighbor is on our +Z side, their -Z edge connects to our z=depth-1
             for (int x = 0; x < m_Width && x < static_cast<int>(neighborEdge.size()); x++)
             {
-                if (neighborEdge[x] && m_BelowSeaMask[CellIndex(x, m_Depth - 1)] && !m_OceanMask[CellIndex(x, m_Depth - 1)])
+                if (neighborEdge[x] && m_BelowSeaMask.Test(CellIndex(x, m_Depth - 1)) && !m_OceanMask.Test(CellIndex(x, m_Depth - 1)))
                 {
                     seeds.emplace_back(x, m_Depth - 1);
                 }
@@ -190,50 +196,71 @@ namespace Genesis
 
         if (!seeds.empty())
         {
-            FloodFillBFS(seeds);
+            FloodFillScanline(seeds);
             UpdateBoundaryFromMask();
         }
     }
 
-    void OceanMask::FloodFillBFS(const std::vector<std::pair<int, int>> &seeds)
+    void OceanMask::FloodFillScanline(const ScratchVector<std::pair<int, int>> &seeds)
     {
         if (seeds.empty())
             return;
 
-        std::queue<std::pair<int, int>> queue;
-
-        // Initialize queue with seeds
-        for (const auto &seed : seeds)
+        // Fillable = below sea level and not yet marked ocean
+        auto fillable = [this](int x, int z)
         {
-            int idx = CellIndex(seed.first, seed.second);
-            if (!m_OceanMask[idx] && m_BelowSeaMask[idx])
-            {
-                m_OceanMask[idx] = true;
-                queue.push(seed);
-            }
-        }
+            int idx = CellIndex(x, z);
+            return m_BelowSeaMask.Test(idx) && !m_OceanMask.Test(idx);
+        };
 
-        // 4-directional neighbors
-        const int dx[] = {-1, 1, 0, 0};
-        const int dz[] = {0, 0, -1, 1};
+        // Span starts on a scratch-backed stack; whole rows are filled at
+        // a time, so only one entry per span is ever pushed
+        GEN_SCRATCH_SCOPE();
+        ScratchVector<std::pair<int, int>> stack(seeds);
 
-        while (!queue.empty())
+        while (!stack.empty())
         {
-            auto [x, z] = queue.front();
-            queue.pop();
+            auto [x, z] = stack.back();
+            stack.pop_back();
 
-            for (int dir = 0; dir < 4; dir++)
+            // Another span may have covered this seed already
+            if (!fillable(x, z))
+                continue;
+
+            // Expand to the full fillable span on this row
+            int left = x;
+            while (left > 0 && fillable(left - 1, z))
+                left--;
+            int right = x;
+            while (right < m_Width - 1 && fillable(right + 1, z))
+                right++;
+
+            for (int i = left; i <= right; i++)
             {
-                int nx = x + dx[dir];
-                int nz = z + dz[dir];
+                m_OceanMask.Set(CellIndex(i, z));
+            }
 
-                if (IsValidCell(nx, nz))
+            // Push one seed per fillable span in the rows above and below
+            for (int dz = -1; dz <= 1; dz += 2)
+            {
+                int nz = z + dz;
+                if (nz < 0 || nz >= m_Depth)
+                    continue;
+
+                bool inSpan = false;
+                for (int i = left; i <= right; i++)
                 {
-                    int nidx = CellIndex(nx, nz);
-                    if (m_BelowSeaMask[nidx] && !m_OceanMask[nidx])
+                    if (fillable(i, nz))
+                    {
+                        if (!inSpan)
+                        {
+                            stack.emplace_back(i, nz);
+                            inSpan = true;
+                        }
+                    }
+                    else
                     {
-                        m_OceanMask[nidx] = true;
-                        queue.emplace(nx, nz);
+                        inSpan = false;
                     }
                 }
             }
@@ -247,11 +274,11 @@ namespace Genesis
         {
             if (z < static_cast<int>(m_Boundary.negX.size()))
             {
-                m_Boundary.negX[z] = m_OceanMask[CellIndex(0, z)];
+                m_Boundary.negX[z] = m_OceanMask.Test(CellIndex(0, z));
             }
             if (z < static_cast<int>(m_Boundary.posX.size()))
             {
-                m_Boundary.posX[z] = m_OceanMask[CellIndex(m_Width - 1, z)];
+                m_Boundary.posX[z] = m_OceanMask.Test(CellIndex(m_Width - 1, z));
             }
         }
 
@@ -259,11 +286,11 @@ namespace Genesis
         {
             if (x < static_cast<int>(m_Boundary.negZ.size()))
             {
-                m_Boundary.negZ[x] = m_OceanMask[CellIndex(x, 0)];
+                m_Boundary.negZ[x] = m_OceanMask.Test(CellIndex(x, 0));
             }
             if (x < static_cast<int>(m_Boundary.posZ.size()))
             {
-                m_Boundary.posZ[x] = m_OceanMask[CellIndex(x, m_Depth - 1)];
+                m_Boundary.posZ[x] = m_OceanMask.Test(CellIndex(x, m_Depth - 1));
             }
         }
     }
@@ -272,14 +299,14 @@ namespace Genesis
     {
         if (!IsValidCell(x, z))
             return false;
-        return m_OceanMask[CellIndex(x, z)];
+        return m_OceanMask.Test(CellIndex(x, z));
     }
 
     bool OceanMask::IsBelowSeaLevel(int x, int z) const
     {
         if (!IsValidCell(x, z))
             return false;
-        return m_BelowSeaMask[CellIndex(x, z)];
+        return m_BelowSeaMask.Test(CellIndex(x, z));
     }
 
     bool OceanMask::IsInlandLake(int x, int z) const
@@ -287,7 +314,7 @@ namespace Genesis
         if (!IsValidCell(x, z))
             return false;
         int idx = CellIndex(x, z);
-        return m_BelowSeaMask[idx] && !m_OceanMask[idx];
+        return m_BelowSeaMask.Test(idx) && !m_OceanMask.Test(idx);
     }
 
 } // namespace Genesis
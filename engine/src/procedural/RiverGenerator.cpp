@@ -1,7 +1,9 @@
 #include "genesis/procedural/RiverGenerator.h"
+#include "genesis/core/ScratchArena.h"
 #include <algorithm>
 #include <cmath>
 #include <queue>
+#include "genesis/core/Profiler.h"
 
 namespace Genesis
 {
@@ -31,6 +33,7 @@ namespace Genesis
                                   const std::vector<float> &heightmap,
                                   float seaLevel)
     {
+        GEN_PROFILE_SCOPE("RiverGenerator::Generate");
         const DrainageData &data = drainage.GetData();
         m_Network.Resize(data.width, data.depth);
         m_Network.Clear();
@@ -43,6 +46,9 @@ namespace Genesis
 
         // Step 3: Trace river paths from sources to termini
         TraceRiverPaths(drainage);
+
+        // Step 4: Build the bucketed segment index for runtime proximity queries
+        m_SegmentIndex.Build(m_Network);
     }
 
     void RiverGenerator::ClassifyCells(const DrainageGraph &drainage,
@@ -138,8 +144,10 @@ namespace Genesis
     {
         const DrainageData &data = drainage.GetData();
 
-        // Build a map from cell to segment index
-        std::vector<int> cellToSegment(static_cast<size_t>(data.width) * data.depth, -1);
+        // Build a map from cell to segment index; the map and the
+        // upstream counts below are trace-stage temporaries
+        GEN_SCRATCH_SCOPE();
+        ScratchVector<int> cellToSegment(static_cast<size_t>(data.width) * data.depth, -1);
         for (size_t i = 0; i < m_Network.segments.size(); i++)
         {
             const auto &seg = m_Network.segments[i];
@@ -160,7 +168,7 @@ namespace Genesis
         }
 
         // Find river sources (segments with no upstream river/stream contributors)
-        std::vector<int> upstreamCount(m_Network.segments.size(), 0);
+        ScratchVector<int> upstreamCount(m_Network.segments.size(), 0);
         for (const auto &seg : m_Network.segments)
         {
             if (seg.downstreamIndex >= 0)
@@ -326,4 +334,117 @@ namespace Genesis
         return GetWaterType(x, z) != WaterType::None;
     }
 
+    const RiverSegment *RiverGenerator::FindNearestSegment(float cellX, float cellZ, float maxRadiusCells) const
+    {
+        int index = m_SegmentIndex.FindNearest(cellX, cellZ, maxRadiusCells);
+        return index >= 0 ? &m_Network.segments[index] : nullptr;
+    }
+
+    void RiverSegmentIndex::Clear()
+    {
+        m_BucketsX = 0;
+        m_BucketsZ = 0;
+        m_BucketStart.clear();
+        m_SegmentIndices.clear();
+        m_SegmentCells.clear();
+    }
+
+    void RiverSegmentIndex::Build(const RiverNetwork &network)
+    {
+        Clear();
+        if (network.segments.empty() || network.width <= 0 || network.depth <= 0)
+            return;
+
+        m_BucketsX = (network.width + BUCKET_SIZE - 1) / BUCKET_SIZE;
+        m_BucketsZ = (network.depth + BUCKET_SIZE - 1) / BUCKET_SIZE;
+        size_t bucketCount = static_cast<size_t>(m_BucketsX) * m_BucketsZ;
+
+        m_SegmentCells.resize(network.segments.size());
+        for (size_t i = 0; i < network.segments.size(); i++)
+        {
+            m_SegmentCells[i] = network.segments[i].cell;
+        }
+
+        // CSR fill: count per bucket, prefix sum, then scatter
+        m_BucketStart.assign(bucketCount + 1, 0);
+        auto bucketOf = [this](const glm::ivec2 &cell)
+        {
+            int bx = std::clamp(cell.x / BUCKET_SIZE, 0, m_BucketsX - 1);
+            int bz = std::clamp(cell.y / BUCKET_SIZE, 0, m_BucketsZ - 1);
+            return static_cast<size_t>(bz) * m_BucketsX + bx;
+        };
+
+        for (const glm::ivec2 &cell : m_SegmentCells)
+        {
+            m_BucketStart[bucketOf(cell) + 1]++;
+        }
+        for (size_t b = 1; b <= bucketCount; b++)
+        {
+            m_BucketStart[b] += m_BucketStart[b - 1];
+        }
+
+        m_SegmentIndices.resize(m_SegmentCells.size());
+        GEN_SCRATCH_SCOPE();
+        ScratchVector<uint32_t> cursor(m_BucketStart.begin(), m_BucketStart.end() - 1);
+        for (size_t i = 0; i < m_SegmentCells.size(); i++)
+        {
+            m_SegmentIndices[cursor[bucketOf(m_SegmentCells[i])]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    int RiverSegmentIndex::FindNearest(float cellX, float cellZ, float maxRadiusCells) const
+    {
+        if (m_SegmentCells.empty())
+            return -1;
+
+        int centerBX = std::clamp(static_cast<int>(cellX) / BUCKET_SIZE, 0, m_BucketsX - 1);
+        int centerBZ = std::clamp(static_cast<int>(cellZ) / BUCKET_SIZE, 0, m_BucketsZ - 1);
+
+        int best = -1;
+        float bestDistSq = maxRadiusCells * maxRadiusCells;
+
+        int maxRing = (static_cast<int>(maxRadiusCells) / BUCKET_SIZE) + 2;
+        for (int ring = 0; ring <= maxRing; ring++)
+        {
+            // Everything in ring r is at least (r-1) buckets away, so once
+            // the current best beats that bound no later ring can win
+            float ringMinDist = static_cast<float>((ring - 1) * BUCKET_SIZE);
+            if (ring > 0 && ringMinDist * ringMinDist > bestDistSq)
+                break;
+
+            for (int bz = centerBZ - ring; bz <= centerBZ + ring; bz++)
+            {
+                if (bz < 0 || bz >= m_BucketsZ)
+                    continue;
+                for (int bx = centerBX - ring; bx <= centerBX + ring; bx++)
+                {
+                    if (bx < 0 || bx >= m_BucketsX)
+                        continue;
+                    // Only the ring perimeter; the interior was already visited
+                    if (ring > 0 && bx != centerBX - ring && bx != centerBX + ring &&
+                        bz != centerBZ - ring && bz != centerBZ + ring)
+                    {
+                        continue;
+                    }
+
+                    size_t bucket = static_cast<size_t>(bz) * m_BucketsX + bx;
+                    for (uint32_t s = m_BucketStart[bucket]; s < m_BucketStart[bucket + 1]; s++)
+                    {
+                        uint32_t segment = m_SegmentIndices[s];
+                        float dx = static_cast<float>(m_SegmentCells[segment].x) + 0.5f - cellX;
+                        float dz = static_cast<float>(m_SegmentCells[segment].y) + 0.5f - cellZ;
+                        float distSq = dx * dx + dz * dz;
+                        if (distSq < bestDistSq)
+                        {
+                            bestDistSq = distSq;
+                            best = static_cast<int>(segment);
+                        }
+                    }
+                }
+            }
+        }
+
+        return best;
+    }
+
 }
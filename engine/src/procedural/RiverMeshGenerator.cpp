@@ -40,26 +40,15 @@ namespace Genesis
         std::vector<Vertex> allVertices;
         std::vector<uint32_t> allIndices;
 
-        // Process all river segments directly for efficiency
-        for (size_t i = 0; i < network.segments.size(); i++)
-        {
-            const auto &segment = network.segments[i];
+        // One pair cache across all paths: where a tributary joins the main
+        // channel both use the same welded vertices, and stretches shared by
+        // several traced paths are only triangulated once
+        std::unordered_map<int, uint32_t> segmentPairBase;
 
-            // Only process rivers and streams (not none/lake/ocean)
-            if (segment.type != WaterType::Stream && segment.type != WaterType::River)
-            {
-                continue;
-            }
-
-            // Find next segment for smooth connection
-            const RiverSegment *nextSegment = nullptr;
-            if (segment.downstreamIndex >= 0 && segment.downstreamIndex < static_cast<int>(network.segments.size()))
-            {
-                nextSegment = &network.segments[segment.downstreamIndex];
-            }
-
-            GenerateRibbonSegment(segment, nextSegment, heightmap, network.width,
-                                  cellSize, chunkOffset, allVertices, allIndices);
+        for (const auto &path : network.rivers)
+        {
+            AppendChannelRibbon(path.segmentIndices, network, cellSize, chunkOffset,
+                                segmentPairBase, allVertices, allIndices);
         }
 
         if (allVertices.empty())
@@ -67,6 +56,10 @@ namespace Genesis
             return nullptr;
         }
 
+        // Path-order emission strings triangles along each river; regroup
+        // them for the post-transform cache before upload
+        Mesh::OptimizeForVertexCache(allIndices, static_cast<uint32_t>(allVertices.size()));
+
         return std::make_unique<Mesh>(allVertices, allIndices);
     }
 
@@ -105,122 +98,169 @@ namespace Genesis
         }
         meshData.averageWidth = totalWidth / path.segmentIndices.size();
 
-        // Generate ribbon vertices for each segment
-        for (size_t i = 0; i < path.segmentIndices.size(); i++)
-        {
-            const auto &segment = network.segments[path.segmentIndices[i]];
-
-            // Get next segment for smooth connection
-            const RiverSegment *nextSegment = nullptr;
-            if (i + 1 < path.segmentIndices.size())
-            {
-                nextSegment = &network.segments[path.segmentIndices[i + 1]];
-            }
-
-            GenerateRibbonSegment(segment, nextSegment, heightmap, network.width,
-                                  cellSize, chunkOffset, meshData.vertices, meshData.indices);
-        }
+        // Generate the shared-vertex ribbon for this path
+        std::unordered_map<int, uint32_t> segmentPairBase;
+        AppendChannelRibbon(path.segmentIndices, network, cellSize, chunkOffset,
+                            segmentPairBase, meshData.vertices, meshData.indices);
 
         return meshData;
     }
 
-    void RiverMeshGenerator::GenerateRibbonSegment(const RiverSegment &segment,
-                                                   const RiverSegment *nextSegment,
-                                                   const std::vector<float> &heightmap,
-                                                   int gridWidth,
-                                                   float cellSize,
-                                                   const glm::vec3 &chunkOffset,
-                                                   std::vector<Vertex> &vertices,
-                                                   std::vector<uint32_t> &indices) const
+    void RiverMeshGenerator::AppendChannelRibbon(const std::vector<size_t> &segmentIndices,
+                                                 const RiverNetwork &network,
+                                                 float cellSize,
+                                                 const glm::vec3 &chunkOffset,
+                                                 std::unordered_map<int, uint32_t> &segmentPairBase,
+                                                 std::vector<Vertex> &vertices,
+                                                 std::vector<uint32_t> &indices) const
     {
-        // Current position
-        float cx = (segment.cell.x + 0.5f) * cellSize;
-        float cz = (segment.cell.y + 0.5f) * cellSize;
-        float cy = segment.surfaceHeight + m_Settings.surfaceOffset;
-
-        // Next position (for direction calculation)
-        float nx, nz;
-        if (nextSegment)
+        if (segmentIndices.empty())
+        {
+            return;
+        }
+
+        // Channel points: one per path segment, plus the downstream segment
+        // of the terminus when it has one, so the ribbon meets the channel
+        // it merges into
+        struct ChannelPoint
+        {
+            int segmentIndex; // -1 for an extrapolated terminus point
+            glm::vec2 pos;    // Chunk-local XZ center
+            float y;
+            float halfWidth;
+            glm::vec3 color;
+        };
+
+        std::vector<ChannelPoint> points;
+        points.reserve(segmentIndices.size() + 1);
+
+        auto makePoint = [&](int segIdx)
+        {
+            const RiverSegment &segment = network.segments[segIdx];
+            ChannelPoint p;
+            p.segmentIndex = segIdx;
+            p.pos = glm::vec2((segment.cell.x + 0.5f) * cellSize,
+                              (segment.cell.y + 0.5f) * cellSize);
+            p.y = segment.surfaceHeight + m_Settings.surfaceOffset;
+            p.halfWidth = segment.width * 0.5f;
+            p.color = ComputeFlowColor(segment.width, segment.depth, 0.0f);
+            return p;
+        };
+
+        for (size_t idx : segmentIndices)
+        {
+            points.push_back(makePoint(static_cast<int>(idx)));
+        }
+
+        const RiverSegment &last = network.segments[segmentIndices.back()];
+        if (last.downstreamIndex >= 0 &&
+            last.downstreamIndex < static_cast<int>(network.segments.size()))
         {
-            nx = (nextSegment->cell.x + 0.5f) * cellSize;
-            nz = (nextSegment->cell.y + 0.5f) * cellSize;
+            points.push_back(makePoint(last.downstreamIndex));
         }
         else
         {
-            // Use downstream direction from current cell
-            nx = cx + cellSize;
-            nz = cz;
+            // No downstream segment - extend one cell in the previous
+            // direction (or +X for a single isolated point)
+            ChannelPoint p = points.back();
+            p.segmentIndex = -1;
+            glm::vec2 dir(1.0f, 0.0f);
+            if (points.size() >= 2)
+            {
+                glm::vec2 prev = points[points.size() - 2].pos;
+                if (p.pos != prev)
+                {
+                    dir = glm::normalize(p.pos - prev);
+                }
+            }
+            p.pos += dir * cellSize;
+            points.push_back(p);
         }
 
-        // Direction vector
-        glm::vec2 dir = glm::normalize(glm::vec2(nx - cx, nz - cz));
-
-        // Perpendicular vector for ribbon width
-        glm::vec2 perp(-dir.y, dir.x);
-
-        float halfWidth = segment.width * 0.5f;
-
-        // Compute color based on river properties
-        float slope = 0.0f; // Could compute from height difference
-        glm::vec3 color = ComputeFlowColor(segment.width, segment.depth, slope);
-
-        // Create ribbon vertices (4 vertices per segment for quad)
-        uint32_t baseIndex = static_cast<uint32_t>(vertices.size());
-
-        // Left edge - current
-        Vertex vl0;
-        vl0.Position = glm::vec3(chunkOffset.x + cx - perp.x * halfWidth,
-                                 cy,
-                                 chunkOffset.z + cz - perp.y * halfWidth);
-        vl0.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-        vl0.Color = color;
-        vl0.TexCoord = glm::vec2(0.0f, 0.0f);
-
-        // Right edge - current
-        Vertex vr0;
-        vr0.Position = glm::vec3(chunkOffset.x + cx + perp.x * halfWidth,
-                                 cy,
-                                 chunkOffset.z + cz + perp.y * halfWidth);
-        vr0.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-        vr0.Color = color;
-        vr0.TexCoord = glm::vec2(1.0f, 0.0f);
-
-        // Next position height
-        float ny = nextSegment ? (nextSegment->surfaceHeight + m_Settings.surfaceOffset) : cy;
-
-        // Left edge - next
-        Vertex vl1;
-        vl1.Position = glm::vec3(chunkOffset.x + nx - perp.x * halfWidth,
-                                 ny,
-                                 chunkOffset.z + nz - perp.y * halfWidth);
-        vl1.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-        vl1.Color = color;
-        vl1.TexCoord = glm::vec2(0.0f, 1.0f);
-
-        // Right edge - next
-        Vertex vr1;
-        vr1.Position = glm::vec3(chunkOffset.x + nx + perp.x * halfWidth,
-                                 ny,
-                                 chunkOffset.z + nz + perp.y * halfWidth);
-        vr1.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-        vr1.Color = color;
-        vr1.TexCoord = glm::vec2(1.0f, 1.0f);
-
-        vertices.push_back(vl0);
-        vertices.push_back(vr0);
-        vertices.push_back(vl1);
-        vertices.push_back(vr1);
-
-        // Two triangles per quad (CCW winding)
-        // Triangle 1: vl0, vl1, vr0
-        indices.push_back(baseIndex + 0);
-        indices.push_back(baseIndex + 2);
-        indices.push_back(baseIndex + 1);
-
-        // Triangle 2: vr0, vl1, vr1
-        indices.push_back(baseIndex + 1);
-        indices.push_back(baseIndex + 2);
-        indices.push_back(baseIndex + 3);
+        // Emit one left/right vertex pair per point, shared between the
+        // quads on either side. Pairs cached for a segment are welded
+        // instead of duplicated.
+        std::vector<uint32_t> pairBase(points.size());
+        std::vector<bool> pairReused(points.size(), false);
+
+        for (size_t j = 0; j < points.size(); j++)
+        {
+            const ChannelPoint &point = points[j];
+
+            if (point.segmentIndex >= 0)
+            {
+                auto cached = segmentPairBase.find(point.segmentIndex);
+                if (cached != segmentPairBase.end())
+                {
+                    pairBase[j] = cached->second;
+                    pairReused[j] = true;
+                    continue;
+                }
+            }
+
+            // Direction along the channel, perpendicular for the banks
+            glm::vec2 dir(1.0f, 0.0f);
+            if (j + 1 < points.size() && points[j + 1].pos != point.pos)
+            {
+                dir = glm::normalize(points[j + 1].pos - point.pos);
+            }
+            else if (j > 0 && point.pos != points[j - 1].pos)
+            {
+                dir = glm::normalize(point.pos - points[j - 1].pos);
+            }
+            glm::vec2 perp(-dir.y, dir.x);
+
+            uint32_t base = static_cast<uint32_t>(vertices.size());
+            float v = static_cast<float>(j % 2);
+
+            Vertex left;
+            left.Position = glm::vec3(chunkOffset.x + point.pos.x - perp.x * point.halfWidth,
+                                      point.y,
+                                      chunkOffset.z + point.pos.y - perp.y * point.halfWidth);
+            left.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+            left.Color = point.color;
+            left.TexCoord = glm::vec2(0.0f, v);
+
+            Vertex right;
+            right.Position = glm::vec3(chunkOffset.x + point.pos.x + perp.x * point.halfWidth,
+                                       point.y,
+                                       chunkOffset.z + point.pos.y + perp.y * point.halfWidth);
+            right.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+            right.Color = point.color;
+            right.TexCoord = glm::vec2(1.0f, v);
+
+            vertices.push_back(left);
+            vertices.push_back(right);
+
+            pairBase[j] = base;
+            if (point.segmentIndex >= 0)
+            {
+                segmentPairBase[point.segmentIndex] = base;
+            }
+        }
+
+        // Two triangles per channel quad (CCW winding). A quad whose pairs
+        // both came from the cache lies on an already-meshed stretch.
+        for (size_t j = 0; j + 1 < points.size(); j++)
+        {
+            if (pairReused[j] && pairReused[j + 1])
+            {
+                continue;
+            }
+
+            uint32_t l0 = pairBase[j];
+            uint32_t r0 = pairBase[j] + 1;
+            uint32_t l1 = pairBase[j + 1];
+            uint32_t r1 = pairBase[j + 1] + 1;
+
+            indices.push_back(l0);
+            indices.push_back(l1);
+            indices.push_back(r0);
+
+            indices.push_back(r0);
+            indices.push_back(l1);
+            indices.push_back(r1);
+        }
     }
 
     glm::vec2 RiverMeshGenerator::ComputePerpendicular(const glm::ivec2 &current,
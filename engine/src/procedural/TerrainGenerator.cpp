@@ -1,26 +1,54 @@
 #include "genesis/procedural/TerrainGenerator.h"
+#include "genesis/renderer/ErosionCompute.h"
+#include "genesis/renderer/HeightfieldCompute.h"
+#include "genesis/renderer/MeshArena.h"
 #include <algorithm>
 #include <cmath>
+#include <execution>
+#include <numeric>
 #include <random>
 
 namespace Genesis
 {
 
+    HeightfieldCompute *TerrainGenerator::s_ComputeBackend = nullptr;
+    ErosionCompute *TerrainGenerator::s_ErosionBackend = nullptr;
+
+    void TerrainGenerator::PowerCurve::Bake(float power)
+    {
+        for (int i = 0; i <= RESOLUTION; i++)
+        {
+            float x = static_cast<float>(i) / RESOLUTION;
+            values[i] = std::pow(x, power);
+
+            // Guard the knot at x = 0, where the derivative diverges for
+            // power < 1
+            float guarded = std::max(x, 0.5f / RESOLUTION);
+            derivatives[i] = power * std::pow(guarded, power - 1.0f);
+        }
+    }
+
     TerrainGenerator::TerrainGenerator()
-        : m_Noise(m_Settings.seed)
+        : m_Noise(NoiseState::Get(m_Settings.seed))
     {
+        m_RidgeCurve.Bake(m_Settings.ridgePower);
+        m_UpliftCurve.Bake(m_Settings.upliftPower);
     }
 
     TerrainGenerator::TerrainGenerator(const TerrainSettings &settings)
-        : m_Settings(settings), m_Noise(settings.seed)
+        : m_Settings(settings), m_Noise(NoiseState::Get(settings.seed))
     {
+        m_RidgeCurve.Bake(m_Settings.ridgePower);
+        m_UpliftCurve.Bake(m_Settings.upliftPower);
     }
 
     void TerrainGenerator::SetSettings(const TerrainSettings &settings)
     {
         m_Settings = settings;
-        m_Noise.SetSeed(settings.seed);
+        m_Noise = NoiseState::Get(settings.seed);
         m_CachedHeightmap.clear();
+        m_RidgeCurve.Bake(settings.ridgePower);
+        m_UpliftCurve.Bake(settings.upliftPower);
     }
 
     float TerrainGenerator::SampleRawHeight(float worldX, float worldZ) const
@@ -37,7 +65,7 @@ namespace Genesis
             float contX = worldX * m_Settings.continentalFrequency;
             float contZ = worldZ * m_Settings.continentalFrequency;
 
-            float continentalNoise = m_Noise.FBM(contX, contZ, 2, 0.5f, 2.0f);
+            float continentalNoise = m_Noise->FBM(contX, contZ, 2, 0.5f, 2.0f);
             continentalValue = (continentalNoise + 1.0f) * 0.5f; // Map to [0, 1]
 
             // Compute ocean mask via smoothstep
@@ -57,7 +85,7 @@ namespace Genesis
 
         // Layer 1: Base terrain noise (unwarped FBM for micro-detail)
         // Warping is applied only to ridge noise for macro features
-        float baseNoise = m_Noise.FBM(noiseX, noiseZ,
+        float baseNoise = m_Noise->FBM(noiseX, noiseZ,
                                       m_Settings.octaves,
                                       m_Settings.persistence,
                                       m_Settings.lacunarity);
@@ -86,8 +114,8 @@ namespace Genesis
                     float levelWarpStrength = m_Settings.warpStrength / (1.0f + level * 0.5f);
                     float levelWarpScale = m_Settings.warpScale * (1.0f + level * 0.3f);
 
-                    float warpOffsetX = m_Noise.FBM(wx * levelWarpScale + offsetX, wz * levelWarpScale + offsetZ, 2, 0.5f, 2.0f) * levelWarpStrength;
-                    float warpOffsetZ = m_Noise.FBM(wx * levelWarpScale + offsetX2, wz * levelWarpScale + offsetZ2, 2, 0.5f, 2.0f) * levelWarpStrength;
+                    float warpOffsetX = m_Noise->FBM(wx * levelWarpScale + offsetX, wz * levelWarpScale + offsetZ, 2, 0.5f, 2.0f) * levelWarpStrength;
+                    float warpOffsetZ = m_Noise->FBM(wx * levelWarpScale + offsetX2, wz * levelWarpScale + offsetZ2, 2, 0.5f, 2.0f) * levelWarpStrength;
 
                     wx += warpOffsetX;
                     wz += warpOffsetZ;
@@ -104,13 +132,13 @@ namespace Genesis
 
             float ridgeNoiseX = ridgeCoordX * m_Settings.ridgeScale;
             float ridgeNoiseZ = ridgeCoordZ * m_Settings.ridgeScale;
-            float ridgeNoise = m_Noise.RidgeNoise(ridgeNoiseX, ridgeNoiseZ,
+            float ridgeNoise = m_Noise->RidgeNoise(ridgeNoiseX, ridgeNoiseZ,
                                                   RIDGE_OCTAVES,
                                                   RIDGE_PERSISTENCE,
                                                   RIDGE_LACUNARITY);
 
-            // Apply power function to sharpen ridge peaks
-            ridgeNoise = std::pow(ridgeNoise, m_Settings.ridgePower);
+            // Apply power function to sharpen ridge peaks (baked curve)
+            ridgeNoise = m_RidgeCurve.Sample(ridgeNoise);
 
             // Layer 3: Tectonic uplift mask (determines WHERE mountains appear)
             float upliftMask = 1.0f;
@@ -118,7 +146,7 @@ namespace Genesis
             {
                 float upliftNoiseX = worldX * m_Settings.upliftScale;
                 float upliftNoiseZ = worldZ * m_Settings.upliftScale;
-                float upliftNoise = m_Noise.FBM(upliftNoiseX, upliftNoiseZ, 2, 0.5f, 2.0f);
+                float upliftNoise = m_Noise->FBM(upliftNoiseX, upliftNoiseZ, 2, 0.5f, 2.0f);
                 upliftNoise = (upliftNoise + 1.0f) * 0.5f; // Map to [0, 1]
 
                 // Smoothstep for gradual transition from plains to mountains
@@ -126,7 +154,7 @@ namespace Genesis
                           (m_Settings.upliftThresholdHigh - m_Settings.upliftThresholdLow);
                 t = std::clamp(t, 0.0f, 1.0f);
                 upliftMask = t * t * (3.0f - 2.0f * t); // Smoothstep
-                upliftMask = std::pow(upliftMask, m_Settings.upliftPower);
+                upliftMask = m_UpliftCurve.Sample(upliftMask);
             }
 
             // Mountains don't exist in ocean areas
@@ -158,7 +186,7 @@ namespace Genesis
                 float varX = worldX * m_Settings.continentalFrequency * 5.0f;
                 float varZ = worldZ * m_Settings.continentalFrequency * 5.0f;
 
-                float variation = m_Noise.FBM(varX + 800.0f, varZ + 900.0f, 2, 0.5f, 2.0f);
+                float variation = m_Noise->FBM(varX + 800.0f, varZ + 900.0f, 2, 0.5f, 2.0f);
                 oceanDepth += variation * oceanDepth * m_Settings.oceanFloorVariation;
             }
 
@@ -170,7 +198,476 @@ namespace Genesis
         return worldHeight;
     }
 
-    void TerrainGenerator::ApplySlopeErosion(std::vector<float> &heightmap, int width, int depth) const
+    float TerrainGenerator::SampleHeightWithGradient(float worldX, float worldZ, glm::vec2 &outGradient) const
+    {
+        // Mirrors SampleRawHeight but threads analytic derivatives through
+        // every layer via the chain rule. Each d* below is the gradient of
+        // the matching value with respect to (worldX, worldZ).
+
+        // Layer 0: Continental field
+        float oceanMask = 0.0f;
+        glm::vec2 dOceanMask(0.0f);
+
+        if (m_Settings.useContinentalField)
+        {
+            float cf = m_Settings.continentalFrequency;
+            float dnx, dnz;
+            float continentalNoise = m_Noise->FBMDeriv(worldX * cf, worldZ * cf, 2, 0.5f, 2.0f, dnx, dnz);
+            glm::vec2 dValue = glm::vec2(dnx, dnz) * cf * 0.5f; // Half from the [0,1] remap
+            float continentalValue = (continentalNoise + 1.0f) * 0.5f;
+
+            float threshold = m_Settings.oceanThreshold;
+            float epsilon = m_Settings.coastlineBlend;
+            float span = (threshold + epsilon) - (threshold - epsilon);
+
+            float t = (continentalValue - (threshold - epsilon)) / span;
+            if (t > 0.0f && t < 1.0f)
+            {
+                oceanMask = 1.0f - (t * t * (3.0f - 2.0f * t));
+                dOceanMask = -(6.0f * t * (1.0f - t) / span) * dValue;
+            }
+            else
+            {
+                oceanMask = (t <= 0.0f) ? 1.0f : 0.0f;
+            }
+        }
+
+        float ns = m_Settings.noiseScale;
+        float noiseX = worldX * ns;
+        float noiseZ = worldZ * ns;
+
+        // Layer 1: Base terrain noise
+        float dbx, dbz;
+        float baseNoise = m_Noise->FBMDeriv(noiseX, noiseZ, m_Settings.octaves,
+                                           m_Settings.persistence, m_Settings.lacunarity, dbx, dbz);
+        glm::vec2 dBase = glm::vec2(dbx, dbz) * ns;
+
+        float height = baseNoise;
+        glm::vec2 dHeight = dBase;
+
+        // Layer 2: Ridge noise
+        if (m_Settings.useRidgeNoise)
+        {
+            float ridgeCoordX = noiseX;
+            float ridgeCoordZ = noiseZ;
+
+            // Warp offsets are treated as locally constant: the warped
+            // coordinates still move at d(noiseX)/d(worldX) = noiseScale
+            if (m_Settings.useWarp && m_Settings.warpLevels > 0 && m_Settings.warpStrength > 0.0f)
+            {
+                float wx = ridgeCoordX;
+                float wz = ridgeCoordZ;
+
+                for (int level = 0; level < m_Settings.warpLevels; level++)
+                {
+                    float offsetX = 5.2f + level * 17.1f;
+                    float offsetZ = 1.3f + level * 31.7f;
+                    float offsetX2 = 9.7f + level * 23.5f;
+                    float offsetZ2 = 2.8f + level * 13.9f;
+
+                    float levelWarpStrength = m_Settings.warpStrength / (1.0f + level * 0.5f);
+                    float levelWarpScale = m_Settings.warpScale * (1.0f + level * 0.3f);
+
+                    wx += m_Noise->FBM(wx * levelWarpScale + offsetX, wz * levelWarpScale + offsetZ, 2, 0.5f, 2.0f) * levelWarpStrength;
+                    wz += m_Noise->FBM(wx * levelWarpScale + offsetX2, wz * levelWarpScale + offsetZ2, 2, 0.5f, 2.0f) * levelWarpStrength;
+                }
+
+                ridgeCoordX = wx;
+                ridgeCoordZ = wz;
+            }
+
+            constexpr int RIDGE_OCTAVES = 3;
+            constexpr float RIDGE_PERSISTENCE = 0.5f;
+            constexpr float RIDGE_LACUNARITY = 2.0f;
+
+            float drx, drz;
+            float ridgeNoise = m_Noise->RidgeNoiseDeriv(ridgeCoordX * m_Settings.ridgeScale,
+                                                       ridgeCoordZ * m_Settings.ridgeScale,
+                                                       RIDGE_OCTAVES, RIDGE_PERSISTENCE, RIDGE_LACUNARITY,
+                                                       drx, drz);
+            glm::vec2 dRidge = glm::vec2(drx, drz) * (m_Settings.ridgeScale * ns);
+
+            // r^p with r in [0, 1] (baked curve)
+            float ridgeSharp = m_RidgeCurve.Sample(ridgeNoise);
+            glm::vec2 dRidgeSharp(0.0f);
+            if (ridgeNoise > 0.0f)
+            {
+                dRidgeSharp = m_RidgeCurve.Derivative(ridgeNoise) * dRidge;
+            }
+
+            // Layer 3: Uplift mask
+            float upliftMask = 1.0f;
+            glm::vec2 dUpliftMask(0.0f);
+            if (m_Settings.useUpliftMask)
+            {
+                float us = m_Settings.upliftScale;
+                float dux, duz;
+                float upliftNoise = m_Noise->FBMDeriv(worldX * us, worldZ * us, 2, 0.5f, 2.0f, dux, duz);
+                glm::vec2 dUplift = glm::vec2(dux, duz) * us * 0.5f;
+                upliftNoise = (upliftNoise + 1.0f) * 0.5f;
+
+                float span = m_Settings.upliftThresholdHigh - m_Settings.upliftThresholdLow;
+                float t = (upliftNoise - m_Settings.upliftThresholdLow) / span;
+                if (t > 0.0f && t < 1.0f)
+                {
+                    float smooth = t * t * (3.0f - 2.0f * t);
+                    glm::vec2 dSmooth = (6.0f * t * (1.0f - t) / span) * dUplift;
+                    upliftMask = m_UpliftCurve.Sample(smooth);
+                    if (smooth > 0.0f)
+                    {
+                        dUpliftMask = m_UpliftCurve.Derivative(smooth) * dSmooth;
+                    }
+                }
+                else
+                {
+                    upliftMask = (t <= 0.0f) ? 0.0f : 1.0f;
+                }
+            }
+
+            // mask = upliftMask * (1 - oceanMask)
+            float mask = upliftMask * (1.0f - oceanMask);
+            glm::vec2 dMask = dUpliftMask * (1.0f - oceanMask) - upliftMask * dOceanMask;
+
+            float w = m_Settings.ridgeWeight;
+            height = baseNoise * (1.0f - w * mask) + ridgeSharp * w * mask;
+            dHeight = dBase * (1.0f - w * mask) - baseNoise * w * dMask +
+                      dRidgeSharp * w * mask + ridgeSharp * w * dMask;
+        }
+
+        float worldHeight = m_Settings.baseHeight + (height + 1.0f) * 0.5f * m_Settings.heightScale;
+        outGradient = dHeight * (0.5f * m_Settings.heightScale);
+
+        // Ocean depth bias
+        if (m_Settings.useContinentalField && oceanMask > 0.0f)
+        {
+            float oceanDepth = m_Settings.oceanDepth;
+            glm::vec2 dOceanDepth(0.0f);
+
+            if (m_Settings.oceanFloorVariation > 0.0f)
+            {
+                float vf = m_Settings.continentalFrequency * 5.0f;
+                float dvx, dvz;
+                float variation = m_Noise->FBMDeriv(worldX * vf + 800.0f, worldZ * vf + 900.0f, 2, 0.5f, 2.0f, dvx, dvz);
+                oceanDepth += variation * m_Settings.oceanDepth * m_Settings.oceanFloorVariation;
+                dOceanDepth = glm::vec2(dvx, dvz) * (vf * m_Settings.oceanDepth * m_Settings.oceanFloorVariation);
+            }
+
+            worldHeight -= oceanDepth * oceanMask * oceanMask;
+            outGradient -= dOceanDepth * oceanMask * oceanMask +
+                           oceanDepth * 2.0f * oceanMask * dOceanMask;
+        }
+
+        return worldHeight;
+    }
+
+    void TerrainGenerator::SampleRawHeightRow(const float *worldXs, const float *worldZs, float *out, size_t n) const
+    {
+        if (n == 0)
+            return;
+
+        // Fold the settings flags into a feature mask once per call and hand
+        // the row to the matching kernel instantiation, where every feature
+        // test is resolved at compile time.
+        uint32_t features = 0;
+        if (m_Settings.useContinentalField)
+            features |= FEATURE_CONTINENTAL;
+        if (m_Settings.useRidgeNoise)
+            features |= FEATURE_RIDGE;
+        if (m_Settings.useWarp && m_Settings.warpLevels > 0 && m_Settings.warpStrength > 0.0f)
+            features |= FEATURE_WARP;
+        if (m_Settings.useUpliftMask)
+            features |= FEATURE_UPLIFT;
+
+        switch (features)
+        {
+        case 0:  SampleRawHeightRowKernel<0>(worldXs, worldZs, out, n); break;
+        case 1:  SampleRawHeightRowKernel<1>(worldXs, worldZs, out, n); break;
+        case 2:  SampleRawHeightRowKernel<2>(worldXs, worldZs, out, n); break;
+        case 3:  SampleRawHeightRowKernel<3>(worldXs, worldZs, out, n); break;
+        case 4:  SampleRawHeightRowKernel<4>(worldXs, worldZs, out, n); break;
+        case 5:  SampleRawHeightRowKernel<5>(worldXs, worldZs, out, n); break;
+        case 6:  SampleRawHeightRowKernel<6>(worldXs, worldZs, out, n); break;
+        case 7:  SampleRawHeightRowKernel<7>(worldXs, worldZs, out, n); break;
+        case 8:  SampleRawHeightRowKernel<8>(worldXs, worldZs, out, n); break;
+        case 9:  SampleRawHeightRowKernel<9>(worldXs, worldZs, out, n); break;
+        case 10: SampleRawHeightRowKernel<10>(worldXs, worldZs, out, n); break;
+        case 11: SampleRawHeightRowKernel<11>(worldXs, worldZs, out, n); break;
+        case 12: SampleRawHeightRowKernel<12>(worldXs, worldZs, out, n); break;
+        case 13: SampleRawHeightRowKernel<13>(worldXs, worldZs, out, n); break;
+        case 14: SampleRawHeightRowKernel<14>(worldXs, worldZs, out, n); break;
+        case 15: SampleRawHeightRowKernel<15>(worldXs, worldZs, out, n); break;
+        }
+    }
+
+    template <uint32_t Features>
+    void TerrainGenerator::SampleRawHeightRowKernel(const float *worldXs, const float *worldZs, float *out, size_t n) const
+    {
+        // Mirrors SampleRawHeight layer by layer, but evaluates every noise
+        // layer for the whole row through the batch API. The per-sample
+        // combine steps are plain arithmetic and stay scalar.
+        std::vector<float> bufA(n), bufB(n);
+
+        // Layer 0: Continental field (land vs ocean)
+        std::vector<float> oceanMask(n, 0.0f);
+        if constexpr ((Features & FEATURE_CONTINENTAL) != 0)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                bufA[i] = worldXs[i] * m_Settings.continentalFrequency;
+                bufB[i] = worldZs[i] * m_Settings.continentalFrequency;
+            }
+            std::vector<float> continental(n);
+            m_Noise->FBM(bufA.data(), bufB.data(), continental.data(), n, 2, 0.5f, 2.0f);
+
+            float threshold = m_Settings.oceanThreshold;
+            float epsilon = m_Settings.coastlineBlend;
+            for (size_t i = 0; i < n; i++)
+            {
+                float continentalValue = (continental[i] + 1.0f) * 0.5f;
+                float t = std::clamp((continentalValue - (threshold - epsilon)) /
+                                         ((threshold + epsilon) - (threshold - epsilon)),
+                                     0.0f, 1.0f);
+                oceanMask[i] = 1.0f - (t * t * (3.0f - 2.0f * t));
+            }
+        }
+
+        std::vector<float> noiseX(n), noiseZ(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            noiseX[i] = worldXs[i] * m_Settings.noiseScale;
+            noiseZ[i] = worldZs[i] * m_Settings.noiseScale;
+        }
+
+        // Layer 1: Base terrain noise
+        std::vector<float> baseNoise(n);
+        m_Noise->FBM(noiseX.data(), noiseZ.data(), baseNoise.data(), n,
+                    m_Settings.octaves, m_Settings.persistence, m_Settings.lacunarity);
+
+        std::vector<float> height(baseNoise);
+
+        // Layer 2: Ridge noise for mountains
+        if constexpr ((Features & FEATURE_RIDGE) != 0)
+        {
+            std::vector<float> ridgeX(noiseX), ridgeZ(noiseZ);
+
+            if constexpr ((Features & FEATURE_WARP) != 0)
+            {
+                std::vector<float> warpDx(n), warpDz(n);
+                if (m_WarpCache.valid)
+                {
+                    // Bilinear interpolation between the coarse cache points.
+                    // The cache is built to cover the whole extended grid, so
+                    // the clamps only guard against float edge cases.
+                    const WarpOffsetCache &cache = m_WarpCache;
+                    float invSpacing = 1.0f / cache.spacing;
+                    for (size_t i = 0; i < n; i++)
+                    {
+                        float gx = (worldXs[i] - cache.originX) * invSpacing;
+                        float gz = (worldZs[i] - cache.originZ) * invSpacing;
+                        int x0 = std::clamp(static_cast<int>(gx), 0, cache.width - 2);
+                        int z0 = std::clamp(static_cast<int>(gz), 0, cache.depth - 2);
+                        float fx = std::clamp(gx - x0, 0.0f, 1.0f);
+                        float fz = std::clamp(gz - z0, 0.0f, 1.0f);
+
+                        int idx = z0 * cache.width + x0;
+                        float w00 = (1.0f - fx) * (1.0f - fz);
+                        float w10 = fx * (1.0f - fz);
+                        float w01 = (1.0f - fx) * fz;
+                        float w11 = fx * fz;
+
+                        warpDx[i] = cache.offsetX[idx] * w00 + cache.offsetX[idx + 1] * w10 +
+                                    cache.offsetX[idx + cache.width] * w01 + cache.offsetX[idx + cache.width + 1] * w11;
+                        warpDz[i] = cache.offsetZ[idx] * w00 + cache.offsetZ[idx + 1] * w10 +
+                                    cache.offsetZ[idx + cache.width] * w01 + cache.offsetZ[idx + cache.width + 1] * w11;
+                    }
+                }
+                else
+                {
+                    ComputeWarpOffsetRow(worldXs, worldZs, warpDx.data(), warpDz.data(), n);
+                }
+
+                for (size_t i = 0; i < n; i++)
+                {
+                    ridgeX[i] += warpDx[i];
+                    ridgeZ[i] += warpDz[i];
+                }
+            }
+
+            constexpr int RIDGE_OCTAVES = 3;
+            constexpr float RIDGE_PERSISTENCE = 0.5f;
+            constexpr float RIDGE_LACUNARITY = 2.0f;
+
+            for (size_t i = 0; i < n; i++)
+            {
+                bufA[i] = ridgeX[i] * m_Settings.ridgeScale;
+                bufB[i] = ridgeZ[i] * m_Settings.ridgeScale;
+            }
+            std::vector<float> ridge(n);
+            m_Noise->RidgeNoise(bufA.data(), bufB.data(), ridge.data(), n,
+                               RIDGE_OCTAVES, RIDGE_PERSISTENCE, RIDGE_LACUNARITY);
+
+            // Layer 3: Tectonic uplift mask
+            std::vector<float> upliftMask(n, 1.0f);
+            if constexpr ((Features & FEATURE_UPLIFT) != 0)
+            {
+                for (size_t i = 0; i < n; i++)
+                {
+                    bufA[i] = worldXs[i] * m_Settings.upliftScale;
+                    bufB[i] = worldZs[i] * m_Settings.upliftScale;
+                }
+                std::vector<float> uplift(n);
+                m_Noise->FBM(bufA.data(), bufB.data(), uplift.data(), n, 2, 0.5f, 2.0f);
+
+                for (size_t i = 0; i < n; i++)
+                {
+                    float upliftNoise = (uplift[i] + 1.0f) * 0.5f;
+                    float t = std::clamp((upliftNoise - m_Settings.upliftThresholdLow) /
+                                             (m_Settings.upliftThresholdHigh - m_Settings.upliftThresholdLow),
+                                         0.0f, 1.0f);
+                    float mask = t * t * (3.0f - 2.0f * t);
+                    upliftMask[i] = m_UpliftCurve.Sample(mask);
+                }
+            }
+
+            for (size_t i = 0; i < n; i++)
+            {
+                float ridgeSharp = m_RidgeCurve.Sample(ridge[i]);
+                float mask = upliftMask[i] * (1.0f - oceanMask[i]);
+                float ridgeContribution = ridgeSharp * m_Settings.ridgeWeight * mask;
+                float baseWeight = 1.0f - (m_Settings.ridgeWeight * mask);
+                height[i] = baseNoise[i] * baseWeight + ridgeContribution;
+            }
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = m_Settings.baseHeight + (height[i] + 1.0f) * 0.5f * m_Settings.heightScale;
+        }
+
+        // Ocean depth bias
+        if constexpr ((Features & FEATURE_CONTINENTAL) != 0)
+        {
+            std::vector<float> variation(n, 0.0f);
+            if (m_Settings.oceanFloorVariation > 0.0f)
+            {
+                for (size_t i = 0; i < n; i++)
+                {
+                    bufA[i] = worldXs[i] * m_Settings.continentalFrequency * 5.0f + 800.0f;
+                    bufB[i] = worldZs[i] * m_Settings.continentalFrequency * 5.0f + 900.0f;
+                }
+                m_Noise->FBM(bufA.data(), bufB.data(), variation.data(), n, 2, 0.5f, 2.0f);
+            }
+
+            for (size_t i = 0; i < n; i++)
+            {
+                if (oceanMask[i] > 0.0f)
+                {
+                    float oceanDepth = m_Settings.oceanDepth;
+                    oceanDepth += variation[i] * oceanDepth * m_Settings.oceanFloorVariation;
+                    out[i] -= oceanDepth * oceanMask[i] * oceanMask[i];
+                }
+            }
+        }
+    }
+
+    void TerrainGenerator::ComputeWarpOffsetRow(const float *worldXs, const float *worldZs,
+                                                float *outDx, float *outDz, size_t n) const
+    {
+        // The exact multi-level warp loop from SampleRawHeight, batched. Each
+        // level warps the output of the previous one, so the levels stay
+        // sequential; within a level the FBM evaluations go through the batch
+        // noise API.
+        std::vector<float> wx(n), wz(n), bufA(n), bufB(n), warpX(n), warpZ(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            wx[i] = worldXs[i] * m_Settings.noiseScale;
+            wz[i] = worldZs[i] * m_Settings.noiseScale;
+        }
+
+        for (int level = 0; level < m_Settings.warpLevels; level++)
+        {
+            float offsetX = 5.2f + level * 17.1f;
+            float offsetZ = 1.3f + level * 31.7f;
+            float offsetX2 = 9.7f + level * 23.5f;
+            float offsetZ2 = 2.8f + level * 13.9f;
+
+            float levelWarpStrength = m_Settings.warpStrength / (1.0f + level * 0.5f);
+            float levelWarpScale = m_Settings.warpScale * (1.0f + level * 0.3f);
+
+            for (size_t i = 0; i < n; i++)
+            {
+                bufA[i] = wx[i] * levelWarpScale + offsetX;
+                bufB[i] = wz[i] * levelWarpScale + offsetZ;
+            }
+            m_Noise->FBM(bufA.data(), bufB.data(), warpX.data(), n, 2, 0.5f, 2.0f);
+
+            for (size_t i = 0; i < n; i++)
+            {
+                bufA[i] = wx[i] * levelWarpScale + offsetX2;
+                bufB[i] = wz[i] * levelWarpScale + offsetZ2;
+            }
+            m_Noise->FBM(bufA.data(), bufB.data(), warpZ.data(), n, 2, 0.5f, 2.0f);
+
+            for (size_t i = 0; i < n; i++)
+            {
+                wx[i] += warpX[i] * levelWarpStrength;
+                wz[i] += warpZ[i] * levelWarpStrength;
+            }
+        }
+
+        for (size_t i = 0; i < n; i++)
+        {
+            outDx[i] = wx[i] - worldXs[i] * m_Settings.noiseScale;
+            outDz[i] = wz[i] - worldZs[i] * m_Settings.noiseScale;
+        }
+    }
+
+    void TerrainGenerator::BuildWarpCache(float minWorldX, float minWorldZ, float maxWorldX, float maxWorldZ)
+    {
+        m_WarpCache.valid = false;
+        if (!m_Settings.useRidgeNoise || !m_Settings.useWarp ||
+            m_Settings.warpLevels <= 0 || m_Settings.warpStrength <= 0.0f)
+        {
+            return;
+        }
+
+        // Snap the lattice origin to a world-space multiple of the spacing so
+        // every chunk samples the warp field at the same absolute positions.
+        float spacing = WARP_CACHE_STRIDE * m_Settings.cellSize;
+        float originX = std::floor(minWorldX / spacing) * spacing;
+        float originZ = std::floor(minWorldZ / spacing) * spacing;
+        int width = static_cast<int>(std::ceil((maxWorldX - originX) / spacing)) + 2;
+        int depth = static_cast<int>(std::ceil((maxWorldZ - originZ) / spacing)) + 2;
+
+        m_WarpCache.width = width;
+        m_WarpCache.depth = depth;
+        m_WarpCache.originX = originX;
+        m_WarpCache.originZ = originZ;
+        m_WarpCache.spacing = spacing;
+        m_WarpCache.offsetX.resize(width * depth);
+        m_WarpCache.offsetZ.resize(width * depth);
+
+        std::vector<float> rowXs(width);
+        for (int x = 0; x < width; x++)
+        {
+            rowXs[x] = originX + x * spacing;
+        }
+
+        std::vector<int> rows(depth);
+        std::iota(rows.begin(), rows.end(), 0);
+        std::for_each(std::execution::par, rows.begin(), rows.end(),
+                      [&](int z)
+                      {
+                          std::vector<float> rowZs(width, originZ + z * spacing);
+                          ComputeWarpOffsetRow(rowXs.data(), rowZs.data(),
+                                               &m_WarpCache.offsetX[z * width],
+                                               &m_WarpCache.offsetZ[z * width], width);
+                      });
+
+        m_WarpCache.valid = true;
+    }
+
+    void TerrainGenerator::ApplySlopeErosion(std::vector<float> &heightmap, int width, int depth, float cellSize) const
     {
         // Simple smoothing-based erosion that doesn't create artifacts
         // Uses Laplacian smoothing weighted by slope
@@ -202,8 +699,8 @@ namespace Genesis
                     float hD = heightmap[(z + 1) * width + x];
 
                     // Calculate slope magnitude
-                    float slopeX = (hR - hL) / (2.0f * m_Settings.cellSize);
-                    float slopeZ = (hD - hU) / (2.0f * m_Settings.cellSize);
+                    float slopeX = (hR - hL) / (2.0f * cellSize);
+                    float slopeZ = (hD - hU) / (2.0f * cellSize);
                     float slope = std::sqrt(slopeX * slopeX + slopeZ * slopeZ);
 
                     // Average of neighbors (Laplacian target)
@@ -357,6 +854,100 @@ namespace Genesis
         }
     }
 
+    void TerrainGenerator::ApplyErosionDownsampled(std::vector<float> &heightmap, int width, int depth,
+                                                   float offsetX, float offsetZ, int downsample) const
+    {
+        // Erosion features are low-frequency, so the expensive shaping passes
+        // run on a downsampled copy of the heightfield. The high-frequency
+        // residual (full grid minus the upsampled coarse grid) is split off
+        // first and reinjected on top of the eroded base, so the micro-detail
+        // from the high noise octaves survives unchanged.
+        int coarseWidth = (width - 1) / downsample + 1;
+        int coarseDepth = (depth - 1) / downsample + 1;
+        if (coarseWidth < 5 || coarseDepth < 5)
+        {
+            // Too small to erode meaningfully; fall back to full resolution
+            ApplySlopeErosion(heightmap, width, depth, m_Settings.cellSize);
+            if (m_Settings.useHydraulicErosion && m_Settings.erosionIterations > 0)
+            {
+                ApplyHydraulicErosion(heightmap, width, depth, offsetX, offsetZ);
+            }
+            return;
+        }
+
+        std::vector<float> coarse(coarseWidth * coarseDepth);
+        for (int z = 0; z < coarseDepth; z++)
+        {
+            int srcZ = std::min(z * downsample, depth - 1);
+            for (int x = 0; x < coarseWidth; x++)
+            {
+                int srcX = std::min(x * downsample, width - 1);
+                coarse[z * coarseWidth + x] = heightmap[srcZ * width + srcX];
+            }
+        }
+
+        // Split off the high-frequency residual before eroding
+        std::vector<float> base(heightmap.size());
+        UpsampleBilinear(coarse, coarseWidth, coarseDepth, base, width, depth, downsample);
+        for (size_t i = 0; i < heightmap.size(); i++)
+        {
+            heightmap[i] -= base[i];
+        }
+
+        // The coarse grid's effective cell size is downsample fine cells
+        ApplySlopeErosion(coarse, coarseWidth, coarseDepth, m_Settings.cellSize * downsample);
+
+        if (m_Settings.useHydraulicErosion)
+        {
+            bool gpuEroded = false;
+            if (s_ErosionBackend)
+            {
+                gpuEroded = s_ErosionBackend->Erode(m_Settings, coarse, coarseWidth, coarseDepth, offsetX, offsetZ);
+            }
+            if (!gpuEroded && m_Settings.erosionIterations > 0)
+            {
+                ApplyHydraulicErosion(coarse, coarseWidth, coarseDepth, offsetX, offsetZ);
+            }
+        }
+
+        // Recombine: eroded base plus the preserved detail
+        UpsampleBilinear(coarse, coarseWidth, coarseDepth, base, width, depth, downsample);
+        for (size_t i = 0; i < heightmap.size(); i++)
+        {
+            heightmap[i] += base[i];
+        }
+    }
+
+    void TerrainGenerator::UpsampleBilinear(const std::vector<float> &src, int srcWidth, int srcDepth,
+                                            std::vector<float> &dst, int dstWidth, int dstDepth, int step) const
+    {
+        dst.resize(static_cast<size_t>(dstWidth) * dstDepth);
+
+        float invStep = 1.0f / step;
+        for (int z = 0; z < dstDepth; z++)
+        {
+            float gz = std::min(z * invStep, static_cast<float>(srcDepth - 1));
+            int z0 = std::min(static_cast<int>(gz), srcDepth - 2);
+            float fz = gz - z0;
+
+            for (int x = 0; x < dstWidth; x++)
+            {
+                float gx = std::min(x * invStep, static_cast<float>(srcWidth - 1));
+                int x0 = std::min(static_cast<int>(gx), srcWidth - 2);
+                float fx = gx - x0;
+
+                float h00 = src[z0 * srcWidth + x0];
+                float h10 = src[z0 * srcWidth + x0 + 1];
+                float h01 = src[(z0 + 1) * srcWidth + x0];
+                float h11 = src[(z0 + 1) * srcWidth + x0 + 1];
+
+                float h0 = h00 * (1.0f - fx) + h10 * fx;
+                float h1 = h01 * (1.0f - fx) + h11 * fx;
+                dst[z * dstWidth + x] = h0 * (1.0f - fz) + h1 * fz;
+            }
+        }
+    }
+
     void TerrainGenerator::ApplyPeakShaping(std::vector<float> &heightmap, int width, int depth) const
     {
         float minH = m_Settings.baseHeight;
@@ -393,7 +984,7 @@ namespace Genesis
         return GenerateHeightmapAtOffset(0.0f, 0.0f);
     }
 
-    std::vector<float> TerrainGenerator::GenerateHeightmapAtOffset(float offsetX, float offsetZ)
+    std::vector<float> TerrainGenerator::GenerateHeightmapAtOffset(float offsetX, float offsetZ, const HeightmapBorders *borders)
     {
         int width = m_Settings.width + 1;
         int depth = m_Settings.depth + 1;
@@ -405,40 +996,179 @@ namespace Genesis
         int extWidth = width + 2 * BORDER;
         int extDepth = depth + 2 * BORDER;
 
-        // Step 1: Generate raw heightmap (this is seamless across chunks)
+        // Optional GPU path: evaluate the whole extended grid in one compute
+        // dispatch. The raw and extended heightmaps below then just read from
+        // this instead of calling SampleRawHeight per sample.
+        std::vector<float> gpuHeightmap;
+        bool useGpu = false;
+        if (s_ComputeBackend)
+        {
+            useGpu = s_ComputeBackend->Generate(m_Settings,
+                                                offsetX - BORDER * m_Settings.cellSize,
+                                                offsetZ - BORDER * m_Settings.cellSize,
+                                                extWidth, extDepth, gpuHeightmap);
+        }
+
+        // Prime the coarse warp cache over the extended grid so the row
+        // sampler interpolates warp offsets instead of running the warp FBM
+        // stack per sample.
+        if (!useGpu)
+        {
+            BuildWarpCache(offsetX - BORDER * m_Settings.cellSize,
+                           offsetZ - BORDER * m_Settings.cellSize,
+                           offsetX + (width - 1 + BORDER) * m_Settings.cellSize,
+                           offsetZ + (depth - 1 + BORDER) * m_Settings.cellSize);
+        }
+
+        // Step 1: Generate raw heightmap (this is seamless across chunks).
+        // Edge samples handed over from an already-generated neighbor are
+        // reused; everything else evaluates the noise stack.
         std::vector<float> rawHeightmap(width * depth);
-        for (int z = 0; z < depth; z++)
+        if (useGpu)
+        {
+            for (int z = 0; z < depth; z++)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    rawHeightmap[z * width + x] = gpuHeightmap[(z + BORDER) * extWidth + (x + BORDER)];
+                }
+            }
+        }
+        else
         {
+            // Whole rows go through the SIMD batch sampler, in parallel:
+            // every row is independent, the noise object and warp cache are
+            // read-only here, and each row writes a disjoint output slice.
+            std::vector<float> rowXs(width);
             for (int x = 0; x < width; x++)
             {
-                float worldX = offsetX + x * m_Settings.cellSize;
-                float worldZ = offsetZ + z * m_Settings.cellSize;
-                rawHeightmap[z * width + x] = SampleRawHeight(worldX, worldZ);
+                rowXs[x] = offsetX + x * m_Settings.cellSize;
             }
+
+            std::vector<int> rows(depth);
+            std::iota(rows.begin(), rows.end(), 0);
+            std::for_each(std::execution::par, rows.begin(), rows.end(),
+                          [&](int z)
+                          {
+                              std::vector<float> rowZs(width, offsetZ + z * m_Settings.cellSize);
+                              SampleRawHeightRow(rowXs.data(), rowZs.data(), &rawHeightmap[z * width], width);
+                          });
         }
 
-        // Step 2: Generate extended heightmap for erosion processing
+        // Edge samples handed over from an already-generated neighbor take
+        // priority. The Z edges are applied first so the X edges win the
+        // corners, matching the order borders used to be consulted in.
+        if (borders)
+        {
+            if (static_cast<int>(borders->negZ.size()) == width)
+            {
+                std::copy(borders->negZ.begin(), borders->negZ.end(), rawHeightmap.begin());
+            }
+            if (static_cast<int>(borders->posZ.size()) == width)
+            {
+                std::copy(borders->posZ.begin(), borders->posZ.end(), rawHeightmap.begin() + (depth - 1) * width);
+            }
+            if (static_cast<int>(borders->negX.size()) == depth)
+            {
+                for (int z = 0; z < depth; z++)
+                {
+                    rawHeightmap[z * width] = borders->negX[z];
+                }
+            }
+            if (static_cast<int>(borders->posX.size()) == depth)
+            {
+                for (int z = 0; z < depth; z++)
+                {
+                    rawHeightmap[z * width + (width - 1)] = borders->posX[z];
+                }
+            }
+        }
+
+        // Keep this chunk's raw edges for the border cache
+        m_RawBorders.negX.resize(depth);
+        m_RawBorders.posX.resize(depth);
+        for (int z = 0; z < depth; z++)
+        {
+            m_RawBorders.negX[z] = rawHeightmap[z * width];
+            m_RawBorders.posX[z] = rawHeightmap[z * width + (width - 1)];
+        }
+        m_RawBorders.negZ.assign(rawHeightmap.begin(), rawHeightmap.begin() + width);
+        m_RawBorders.posZ.assign(rawHeightmap.begin() + (depth - 1) * width, rawHeightmap.end());
+
+        // Step 2: Generate extended heightmap for erosion processing. The
+        // interior is the raw heightmap we just built; only the border ring
+        // needs fresh samples.
         std::vector<float> extHeightmap(extWidth * extDepth);
-        for (int z = 0; z < extDepth; z++)
         {
-            for (int x = 0; x < extWidth; x++)
+            // Gather the ring cells and evaluate them in one batch call
+            std::vector<float> ringXs, ringZs;
+            std::vector<int> ringIndices;
+
+            for (int z = 0; z < extDepth; z++)
             {
-                float localX = (x - BORDER) * m_Settings.cellSize;
-                float localZ = (z - BORDER) * m_Settings.cellSize;
-                float worldX = offsetX + localX;
-                float worldZ = offsetZ + localZ;
-                extHeightmap[z * extWidth + x] = SampleRawHeight(worldX, worldZ);
+                for (int x = 0; x < extWidth; x++)
+                {
+                    int innerX = x - BORDER;
+                    int innerZ = z - BORDER;
+                    if (innerX >= 0 && innerX < width && innerZ >= 0 && innerZ < depth)
+                    {
+                        extHeightmap[z * extWidth + x] = rawHeightmap[innerZ * width + innerX];
+                        continue;
+                    }
+
+                    if (useGpu)
+                    {
+                        extHeightmap[z * extWidth + x] = gpuHeightmap[z * extWidth + x];
+                        continue;
+                    }
+
+                    ringXs.push_back(offsetX + innerX * m_Settings.cellSize);
+                    ringZs.push_back(offsetZ + innerZ * m_Settings.cellSize);
+                    ringIndices.push_back(z * extWidth + x);
+                }
+            }
+
+            if (!ringIndices.empty())
+            {
+                std::vector<float> ringHeights(ringIndices.size());
+                SampleRawHeightRow(ringXs.data(), ringZs.data(), ringHeights.data(), ringHeights.size());
+                for (size_t i = 0; i < ringIndices.size(); i++)
+                {
+                    extHeightmap[ringIndices[i]] = ringHeights[i];
+                }
             }
         }
 
+        // Raw sampling is done; drop the cache so later out-of-chunk queries
+        // never interpolate off the edge of a stale lattice.
+        m_WarpCache.valid = false;
+
         // Step 3: Apply erosion effects on extended heightmap
         if (m_Settings.useErosion)
         {
-            ApplySlopeErosion(extHeightmap, extWidth, extDepth);
-
-            if (m_Settings.useHydraulicErosion && m_Settings.erosionIterations > 0)
+            if (m_Settings.erosionDownsample > 1)
             {
-                ApplyHydraulicErosion(extHeightmap, extWidth, extDepth, offsetX, offsetZ);
+                ApplyErosionDownsampled(extHeightmap, extWidth, extDepth, offsetX, offsetZ,
+                                        m_Settings.erosionDownsample);
+            }
+            else
+            {
+                ApplySlopeErosion(extHeightmap, extWidth, extDepth, m_Settings.cellSize);
+
+                if (m_Settings.useHydraulicErosion)
+                {
+                    // GPU backend simulates settings.gpuErosionDroplets droplets
+                    // in one dispatch; the CPU particle loop is the fallback
+                    bool gpuEroded = false;
+                    if (s_ErosionBackend)
+                    {
+                        gpuEroded = s_ErosionBackend->Erode(m_Settings, extHeightmap, extWidth, extDepth, offsetX, offsetZ);
+                    }
+                    if (!gpuEroded && m_Settings.erosionIterations > 0)
+                    {
+                        ApplyHydraulicErosion(extHeightmap, extWidth, extDepth, offsetX, offsetZ);
+                    }
+                }
             }
         }
 
@@ -478,6 +1208,160 @@ namespace Genesis
         return m_CachedHeightmap;
     }
 
+    bool TerrainGenerator::IsFullyOceanAt(float offsetX, float offsetZ) const
+    {
+        if (!m_Settings.useContinentalField)
+        {
+            return false;
+        }
+
+        constexpr int PROBES = 5;
+        // Extra slack under the blend band so a probe grid never approves a
+        // chunk whose interior grazes the coastline transition
+        constexpr float MARGIN = 0.02f;
+
+        float spanX = m_Settings.width * m_Settings.cellSize;
+        float spanZ = m_Settings.depth * m_Settings.cellSize;
+        float limit = m_Settings.oceanThreshold - m_Settings.coastlineBlend - MARGIN;
+
+        for (int pz = 0; pz < PROBES; pz++)
+        {
+            for (int px = 0; px < PROBES; px++)
+            {
+                float worldX = offsetX + spanX * px / (PROBES - 1);
+                float worldZ = offsetZ + spanZ * pz / (PROBES - 1);
+                float continentalNoise = m_Noise->FBM(worldX * m_Settings.continentalFrequency,
+                                                     worldZ * m_Settings.continentalFrequency,
+                                                     2, 0.5f, 2.0f);
+                if ((continentalNoise + 1.0f) * 0.5f >= limit)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    std::vector<float> TerrainGenerator::GenerateOceanHeightmapAtOffset(float offsetX, float offsetZ, const HeightmapBorders *borders)
+    {
+        int width = m_Settings.width + 1;
+        int depth = m_Settings.depth + 1;
+
+        // Coarse lattice spacing in cells; the surviving noise terms are all
+        // low-frequency, so every fourth sample reconstructs them fine
+        constexpr int STEP = 4;
+        int coarseW = (width - 2) / STEP + 2;
+        int coarseD = (depth - 2) / STEP + 2;
+
+        // With a full ocean mask the height stack collapses to the base FBM
+        // (2 octaves - the higher ones are seabed-invisible) minus the
+        // varied ocean depth; ridge and uplift are zeroed, matching
+        // SampleRawHeight's deep-ocean result
+        std::vector<float> coarse(coarseW * coarseD);
+        for (int cz = 0; cz < coarseD; cz++)
+        {
+            for (int cx = 0; cx < coarseW; cx++)
+            {
+                float worldX = offsetX + std::min(cx * STEP, width - 1) * m_Settings.cellSize;
+                float worldZ = offsetZ + std::min(cz * STEP, depth - 1) * m_Settings.cellSize;
+
+                float baseNoise = m_Noise->FBM(worldX * m_Settings.noiseScale,
+                                              worldZ * m_Settings.noiseScale, 2, 0.5f, 2.0f);
+                float height = m_Settings.baseHeight +
+                               (baseNoise + 1.0f) * 0.5f * m_Settings.heightScale;
+
+                float oceanDepth = m_Settings.oceanDepth;
+                if (m_Settings.oceanFloorVariation > 0.0f)
+                {
+                    float varX = worldX * m_Settings.continentalFrequency * 5.0f;
+                    float varZ = worldZ * m_Settings.continentalFrequency * 5.0f;
+                    float variation = m_Noise->FBM(varX + 800.0f, varZ + 900.0f, 2, 0.5f, 2.0f);
+                    oceanDepth += variation * oceanDepth * m_Settings.oceanFloorVariation;
+                }
+
+                coarse[cz * coarseW + cx] = height - oceanDepth;
+            }
+        }
+
+        // Bilinear refinement back to the full grid. The last lattice
+        // column/row sits on the chunk edge, which may be closer than STEP.
+        m_CachedHeightmap.resize(width * depth);
+        auto axis = [&](int i, int count, int coarseCount, int &i0, int &i1, float &t)
+        {
+            i0 = std::min(i / STEP, coarseCount - 2);
+            i1 = i0 + 1;
+            int p0 = i0 * STEP;
+            int p1 = std::min(i1 * STEP, count - 1);
+            t = p1 > p0 ? static_cast<float>(i - p0) / static_cast<float>(p1 - p0) : 0.0f;
+        };
+
+        for (int z = 0; z < depth; z++)
+        {
+            int z0, z1;
+            float tz;
+            axis(z, depth, coarseD, z0, z1, tz);
+
+            for (int x = 0; x < width; x++)
+            {
+                int x0, x1;
+                float tx;
+                axis(x, width, coarseW, x0, x1, tx);
+
+                float h00 = coarse[z0 * coarseW + x0];
+                float h10 = coarse[z0 * coarseW + x1];
+                float h01 = coarse[z1 * coarseW + x0];
+                float h11 = coarse[z1 * coarseW + x1];
+                m_CachedHeightmap[z * width + x] =
+                    glm::mix(glm::mix(h00, h10, tx), glm::mix(h01, h11, tx), tz);
+            }
+        }
+
+        // Border handover matches the full path: a neighbor's edges win, in
+        // the same order, so shared edges agree whichever side ran first
+        if (borders)
+        {
+            if (static_cast<int>(borders->negZ.size()) == width)
+            {
+                std::copy(borders->negZ.begin(), borders->negZ.end(), m_CachedHeightmap.begin());
+            }
+            if (static_cast<int>(borders->posZ.size()) == width)
+            {
+                std::copy(borders->posZ.begin(), borders->posZ.end(),
+                          m_CachedHeightmap.begin() + (depth - 1) * width);
+            }
+            if (static_cast<int>(borders->negX.size()) == depth)
+            {
+                for (int z = 0; z < depth; z++)
+                {
+                    m_CachedHeightmap[z * width] = borders->negX[z];
+                }
+            }
+            if (static_cast<int>(borders->posX.size()) == depth)
+            {
+                for (int z = 0; z < depth; z++)
+                {
+                    m_CachedHeightmap[z * width + (width - 1)] = borders->posX[z];
+                }
+            }
+        }
+
+        m_RawBorders.negX.resize(depth);
+        m_RawBorders.posX.resize(depth);
+        for (int z = 0; z < depth; z++)
+        {
+            m_RawBorders.negX[z] = m_CachedHeightmap[z * width];
+            m_RawBorders.posX[z] = m_CachedHeightmap[z * width + (width - 1)];
+        }
+        m_RawBorders.negZ.assign(m_CachedHeightmap.begin(), m_CachedHeightmap.begin() + width);
+        m_RawBorders.posZ.assign(m_CachedHeightmap.begin() + (depth - 1) * width,
+                                 m_CachedHeightmap.end());
+
+        m_ChunkOrigin = glm::vec2(offsetX, offsetZ);
+
+        return m_CachedHeightmap;
+    }
+
     float TerrainGenerator::GetHeightAt(float worldX, float worldZ) const
     {
         if (m_CachedHeightmap.empty())
@@ -518,20 +1402,20 @@ namespace Genesis
         return h0 * (1 - fz) + h1 * fz;
     }
 
+    // Material color palette for biome-based rendering
+    static const glm::vec3 MATERIAL_COLORS[] = {
+        glm::vec3(0.50f, 0.48f, 0.45f), // Rock - gray
+        glm::vec3(0.45f, 0.35f, 0.25f), // Dirt - brown
+        glm::vec3(0.34f, 0.55f, 0.25f), // Grass - green
+        glm::vec3(0.76f, 0.70f, 0.50f), // Sand - tan
+        glm::vec3(0.95f, 0.95f, 0.97f), // Snow - white
+        glm::vec3(0.75f, 0.85f, 0.95f), // Ice - light blue
+        glm::vec3(0.35f, 0.28f, 0.20f), // Mud - dark brown
+        glm::vec3(0.15f, 0.45f, 0.55f), // Water - blue (shouldn't be rendered here)
+    };
+
     glm::vec3 TerrainGenerator::GetMaterialColor(const MaterialWeights &weights)
     {
-        // Material color palette for biome-based rendering
-        static const glm::vec3 materialColors[] = {
-            glm::vec3(0.50f, 0.48f, 0.45f), // Rock - gray
-            glm::vec3(0.45f, 0.35f, 0.25f), // Dirt - brown
-            glm::vec3(0.34f, 0.55f, 0.25f), // Grass - green
-            glm::vec3(0.76f, 0.70f, 0.50f), // Sand - tan
-            glm::vec3(0.95f, 0.95f, 0.97f), // Snow - white
-            glm::vec3(0.75f, 0.85f, 0.95f), // Ice - light blue
-            glm::vec3(0.35f, 0.28f, 0.20f), // Mud - dark brown
-            glm::vec3(0.15f, 0.45f, 0.55f), // Water - blue (shouldn't be rendered here)
-        };
-
         // Blend colors based on material weights
         glm::vec3 finalColor(0.0f);
 
@@ -540,20 +1424,31 @@ namespace Genesis
             float weight = weights.weights[i];
             if (weight > 0.0f)
             {
-                finalColor += materialColors[i] * weight;
+                finalColor += MATERIAL_COLORS[i] * weight;
             }
         }
 
         return finalColor;
     }
 
-    std::shared_ptr<Mesh> TerrainGenerator::BuildMeshFromHeightmap(const std::vector<float> &heightmap, float offsetX, float offsetZ, const MaterialBlender *materialBlender, const BiomeClassifier *biomeClassifier) const
+    glm::vec3 TerrainGenerator::GetMaterialColor(const PackedMaterial &packed)
     {
-        std::vector<Vertex> vertices;
-        std::vector<uint32_t> indices;
+        // Dominant pair only: one mix instead of an eight-way blend
+        return glm::mix(MATERIAL_COLORS[static_cast<size_t>(packed.primary)],
+                        MATERIAL_COLORS[static_cast<size_t>(packed.secondary)],
+                        static_cast<float>(packed.blend) * (1.0f / 255.0f));
+    }
+
+    std::shared_ptr<Mesh> TerrainGenerator::BuildMeshFromHeightmap(const std::vector<float> &heightmap, float offsetX, float offsetZ, const MaterialBlender *materialBlender, const BiomeClassifier *biomeClassifier, int lodStep) const
+    {
+        // Build into pooled buffers; their capacity survives across chunks
+        auto buffers = MeshArena::Get().Acquire();
+        std::vector<Vertex> &vertices = buffers.Vertices;
+        std::vector<uint32_t> &indices = buffers.Indices;
 
         int width = m_Settings.width + 1;
         int depth = m_Settings.depth + 1;
+        int step = std::max(1, lodStep);
 
         // Use consistent global height range for color normalization (not per-chunk min/max)
         // This ensures colors are consistent across chunk boundaries
@@ -565,7 +1460,9 @@ namespace Genesis
 
         // Debug visualization setup
         bool showDebug = m_Settings.debugView.activeView != DebugViewType::None;
-        SimplexNoise debugNoise(m_Settings.seed);
+        // Keep the shared_ptr alive for the duration of the visualization
+        std::shared_ptr<const SimplexNoise> debugNoisePtr = NoiseState::Get(m_Settings.seed);
+        const SimplexNoise &debugNoise = *debugNoisePtr;
 
         // Default color when no biome/material data available
         const glm::vec3 defaultGreen(0.34f, 0.55f, 0.25f);
@@ -627,91 +1524,111 @@ namespace Genesis
             }
             else if (materialBlender && materialBlender->GetData().width > 0)
             {
-                MaterialWeights weights = materialBlender->GetMaterialWeights(x, z);
-                return GetMaterialColor(weights);
+                return GetMaterialColor(materialBlender->GetPackedMaterial(x, z));
             }
             return defaultGreen;
         };
 
         if (m_Settings.flatShading)
         {
-            // Flat shading: each triangle has its own vertices with face normal
-            for (int z = 0; z < m_Settings.depth; z++)
+            // Flat shading via the provoking-vertex convention: the grid
+            // vertices stay shared exactly as in the smooth path, and each
+            // triangle's face normal and color are written to its first
+            // (provoking) vertex, which the flat-qualified shader inputs
+            // spread across the whole face. Every cell's first triangle
+            // provokes from the cell's own grid corner; the second triangle
+            // has no spare shared corner, so it leads with one duplicated
+            // vertex per cell - two vertices per cell instead of the six
+            // that fully unshared triangles needed.
+            int lodWidth = m_Settings.width / step + 1;
+            int lodDepth = m_Settings.depth / step + 1;
+
+            for (int z = 0; z < lodDepth; z++)
+            {
+                for (int x = 0; x < lodWidth; x++)
+                {
+                    int gx = x * step;
+                    int gz = z * step;
+
+                    // Normal and color are placeholders here; provoking
+                    // vertices are overwritten with face data below and the
+                    // rest are never read under flat interpolation
+                    vertices.push_back({glm::vec3(gx * m_Settings.cellSize, heightmap[gz * width + gx], gz * m_Settings.cellSize),
+                                        glm::vec3(0.0f, 1.0f, 0.0f),
+                                        defaultGreen});
+                }
+            }
+
+            for (int z = 0; z < lodDepth - 1; z++)
             {
-                for (int x = 0; x < m_Settings.width; x++)
+                for (int x = 0; x < lodWidth - 1; x++)
                 {
-                    float x0 = x * m_Settings.cellSize;
-                    float x1 = (x + 1) * m_Settings.cellSize;
-                    float z0 = z * m_Settings.cellSize;
-                    float z1 = (z + 1) * m_Settings.cellSize;
-
-                    float h00 = heightmap[z * width + x];
-                    float h10 = heightmap[z * width + (x + 1)];
-                    float h01 = heightmap[(z + 1) * width + x];
-                    float h11 = heightmap[(z + 1) * width + (x + 1)];
-
-                    glm::vec3 p00(x0, h00, z0);
-                    glm::vec3 p10(x1, h10, z0);
-                    glm::vec3 p01(x0, h01, z1);
-                    glm::vec3 p11(x1, h11, z1);
-
-                    // Triangle 1: p00, p01, p10 (CCW winding)
+                    uint32_t i00 = z * lodWidth + x;
+                    uint32_t i10 = z * lodWidth + (x + 1);
+                    uint32_t i01 = (z + 1) * lodWidth + x;
+                    uint32_t i11 = (z + 1) * lodWidth + (x + 1);
+
+                    glm::vec3 p00 = vertices[i00].Position;
+                    glm::vec3 p10 = vertices[i10].Position;
+                    glm::vec3 p01 = vertices[i01].Position;
+                    glm::vec3 p11 = vertices[i11].Position;
+
+                    // Get color for this cell
+                    glm::vec3 baseColor = GetCellColor(x * step, z * step);
+
+                    // Triangle 1: p00, p01, p10 (CCW winding), provoking vertex i00
                     glm::vec3 normal1 = glm::normalize(glm::cross(p01 - p00, p10 - p00));
-                    float avgH1 = (h00 + h10 + h01) / 3.0f;
+                    float avgH1 = (p00.y + p10.y + p01.y) / 3.0f;
 
                     // Calculate slope from normal (0 = flat, 1 = vertical cliff)
                     float slope1 = 1.0f - std::abs(normal1.y);
 
-                    // Get color for this cell
-                    glm::vec3 baseColor1 = GetCellColor(x, z);
-
                     glm::vec3 c1 = (p00 + p01 + p10) / 3.0f;
-                    glm::vec3 color1 = ComputeFinalColor(offsetX + c1.x, offsetZ + c1.z, avgH1, slope1, baseColor1);
+                    vertices[i00].Normal = normal1;
+                    vertices[i00].Color = ComputeFinalColor(offsetX + c1.x, offsetZ + c1.z, avgH1, slope1, baseColor);
 
-                    uint32_t baseIdx = static_cast<uint32_t>(vertices.size());
-                    vertices.push_back({p00, normal1, color1});
-                    vertices.push_back({p01, normal1, color1});
-                    vertices.push_back({p10, normal1, color1});
-                    indices.push_back(baseIdx);
-                    indices.push_back(baseIdx + 1);
-                    indices.push_back(baseIdx + 2);
+                    indices.push_back(i00);
+                    indices.push_back(i01);
+                    indices.push_back(i10);
 
-                    // Triangle 2: p10, p01, p11 (CCW winding)
+                    // Triangle 2: p10, p01, p11 (CCW winding); every shared
+                    // corner already provokes some cell's first triangle, so
+                    // this one leads with a duplicate of p10
                     glm::vec3 normal2 = glm::normalize(glm::cross(p01 - p10, p11 - p10));
-                    float avgH2 = (h10 + h11 + h01) / 3.0f;
+                    float avgH2 = (p10.y + p11.y + p01.y) / 3.0f;
 
                     // Calculate slope from normal (0 = flat, 1 = vertical cliff)
                     float slope2 = 1.0f - std::abs(normal2.y);
 
-                    // Get color for this cell
-                    glm::vec3 baseColor2 = GetCellColor(x, z);
-
                     glm::vec3 c2 = (p10 + p01 + p11) / 3.0f;
-                    glm::vec3 color2 = ComputeFinalColor(offsetX + c2.x, offsetZ + c2.z, avgH2, slope2, baseColor2);
+                    glm::vec3 color2 = ComputeFinalColor(offsetX + c2.x, offsetZ + c2.z, avgH2, slope2, baseColor);
 
-                    baseIdx = static_cast<uint32_t>(vertices.size());
+                    uint32_t dup = static_cast<uint32_t>(vertices.size());
                     vertices.push_back({p10, normal2, color2});
-                    vertices.push_back({p01, normal2, color2});
-                    vertices.push_back({p11, normal2, color2});
-                    indices.push_back(baseIdx);
-                    indices.push_back(baseIdx + 1);
-                    indices.push_back(baseIdx + 2);
+                    indices.push_back(dup);
+                    indices.push_back(i01);
+                    indices.push_back(i11);
                 }
             }
         }
         else
         {
             // Smooth shading: shared vertices with averaged normals
-            for (int z = 0; z < depth; z++)
+            int lodWidth = m_Settings.width / step + 1;
+            int lodDepth = m_Settings.depth / step + 1;
+
+            for (int z = 0; z < lodDepth; z++)
             {
-                for (int x = 0; x < width; x++)
+                for (int x = 0; x < lodWidth; x++)
                 {
-                    float worldX = x * m_Settings.cellSize;
-                    float worldZ = z * m_Settings.cellSize;
-                    float height = heightmap[z * width + x];
+                    int gx = x * step;
+                    int gz = z * step;
+                    float worldX = gx * m_Settings.cellSize;
+                    float worldZ = gz * m_Settings.cellSize;
+                    float height = heightmap[gz * width + gx];
 
                     // Get color for this cell
-                    glm::vec3 color = GetCellColor(x, z);
+                    glm::vec3 color = GetCellColor(gx, gz);
 
                     vertices.push_back({glm::vec3(worldX, height, worldZ),
                                         glm::vec3(0.0f, 1.0f, 0.0f),
@@ -722,14 +1639,14 @@ namespace Genesis
             // Generate indices and calculate normals
             std::vector<glm::vec3> normals(vertices.size(), glm::vec3(0.0f));
 
-            for (int z = 0; z < m_Settings.depth; z++)
+            for (int z = 0; z < lodDepth - 1; z++)
             {
-                for (int x = 0; x < m_Settings.width; x++)
+                for (int x = 0; x < lodWidth - 1; x++)
                 {
-                    uint32_t i00 = z * width + x;
-                    uint32_t i10 = z * width + (x + 1);
-                    uint32_t i01 = (z + 1) * width + x;
-                    uint32_t i11 = (z + 1) * width + (x + 1);
+                    uint32_t i00 = z * lodWidth + x;
+                    uint32_t i10 = z * lodWidth + (x + 1);
+                    uint32_t i01 = (z + 1) * lodWidth + x;
+                    uint32_t i11 = (z + 1) * lodWidth + (x + 1);
 
                     indices.push_back(i00);
                     indices.push_back(i01);
@@ -768,7 +1685,57 @@ namespace Genesis
             }
         }
 
-        return std::make_shared<Mesh>(vertices, indices);
+        // Edge skirts: vertical quads dropped from the perimeter hide the cracks
+        // that open between neighboring chunks rendered at different LODs.
+        if (step > 1)
+        {
+            float skirtDepth = step * m_Settings.cellSize * 2.0f;
+
+            auto SurfacePoint = [&](int x, int z)
+            {
+                return glm::vec3(x * m_Settings.cellSize, heightmap[z * width + x], z * m_Settings.cellSize);
+            };
+
+            auto EmitSkirtQuad = [&](const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &color)
+            {
+                glm::vec3 down(0.0f, -skirtDepth, 0.0f);
+                glm::vec3 normal = glm::normalize(glm::cross(b - a, down));
+
+                uint32_t baseIdx = static_cast<uint32_t>(vertices.size());
+                vertices.push_back({a, normal, color});
+                vertices.push_back({b, normal, color});
+                vertices.push_back({a + down, normal, color});
+                vertices.push_back({b + down, normal, color});
+
+                indices.push_back(baseIdx);
+                indices.push_back(baseIdx + 2);
+                indices.push_back(baseIdx + 1);
+                indices.push_back(baseIdx + 1);
+                indices.push_back(baseIdx + 2);
+                indices.push_back(baseIdx + 3);
+            };
+
+            for (int x = 0; x < m_Settings.width; x += step)
+            {
+                EmitSkirtQuad(SurfacePoint(x, 0), SurfacePoint(x + step, 0), GetCellColor(x, 0));
+                EmitSkirtQuad(SurfacePoint(x + step, m_Settings.depth), SurfacePoint(x, m_Settings.depth), GetCellColor(x, m_Settings.depth - 1));
+            }
+            for (int z = 0; z < m_Settings.depth; z += step)
+            {
+                EmitSkirtQuad(SurfacePoint(0, z + step), SurfacePoint(0, z), GetCellColor(0, z));
+                EmitSkirtQuad(SurfacePoint(m_Settings.width, z), SurfacePoint(m_Settings.width, z + step), GetCellColor(m_Settings.width - 1, z));
+            }
+        }
+
+        // Scan-order emission is hostile to the post-transform cache; reorder
+        // triangles before the index data is copied anywhere
+        Mesh::OptimizeForVertexCache(indices, static_cast<uint32_t>(vertices.size()));
+
+        // The mesh gets an exact-size copy; the oversized build buffers go back
+        // to the pool for the next chunk
+        auto mesh = std::make_shared<Mesh>(vertices, indices);
+        MeshArena::Get().Release(std::move(buffers));
+        return mesh;
     }
 
     std::shared_ptr<Mesh> TerrainGenerator::Generate()
@@ -803,4 +1770,14 @@ namespace Genesis
         return BuildMeshFromHeightmap(m_CachedHeightmap, offsetX, offsetZ, materialBlender, biomeClassifier);
     }
 
+    std::shared_ptr<Mesh> TerrainGenerator::GenerateLodAtOffset(float offsetX, float offsetZ, int lodStep, const MaterialBlender *materialBlender, const BiomeClassifier *biomeClassifier)
+    {
+        // Use existing heightmap if available, otherwise generate it
+        if (m_CachedHeightmap.empty())
+        {
+            GenerateHeightmapAtOffset(offsetX, offsetZ);
+        }
+        return BuildMeshFromHeightmap(m_CachedHeightmap, offsetX, offsetZ, materialBlender, biomeClassifier, lodStep);
+    }
+
 }
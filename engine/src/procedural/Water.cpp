@@ -75,4 +75,87 @@ namespace Genesis {
         return std::make_shared<Mesh>(vertices, indices);
     }
 
+    std::shared_ptr<Mesh> WaterGenerator::GenerateOceanGrid(
+        float innerCellSize,
+        int innerCells,
+        float radius) {
+
+        // Cell size grows geometrically beyond the uniform centre region.
+        // The wave displacement wavelengths are ~10-20 world units, so the
+        // fine cells only matter near the camera; far cells are coarse and
+        // their residual aliasing is sub-pixel at that distance.
+        const float growth = 1.3f;
+
+        // Build one symmetric coordinate axis from the origin outward
+        std::vector<float> positive;
+        positive.push_back(0.0f);
+        float coord = 0.0f;
+        float step = innerCellSize;
+        int cells = 0;
+        while (coord < radius) {
+            coord += step;
+            positive.push_back(coord);
+            cells++;
+            if (cells >= innerCells / 2) {
+                step *= growth;
+            }
+        }
+
+        std::vector<float> axis;
+        axis.reserve(positive.size() * 2 - 1);
+        for (size_t i = positive.size(); i-- > 1;) {
+            axis.push_back(-positive[i]);
+        }
+        for (float p : positive) {
+            axis.push_back(p);
+        }
+
+        int gridSize = static_cast<int>(axis.size());
+        float extent = positive.back();
+
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+        vertices.reserve(static_cast<size_t>(gridSize) * gridSize);
+        indices.reserve(static_cast<size_t>(gridSize - 1) * (gridSize - 1) * 6);
+
+        glm::vec3 waterColor(0.1f, 0.4f, 0.6f);
+
+        for (int z = 0; z < gridSize; z++) {
+            for (int x = 0; x < gridSize; x++) {
+                Vertex v;
+                v.Position = glm::vec3(axis[x], 0.0f, axis[z]);
+                v.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+                v.Color = waterColor;
+                v.TexCoord = glm::vec2(
+                    axis[x] / extent * 0.5f + 0.5f,
+                    axis[z] / extent * 0.5f + 0.5f);
+                vertices.push_back(v);
+            }
+        }
+
+        // Generate indices (CCW winding order)
+        for (int z = 0; z < gridSize - 1; z++) {
+            for (int x = 0; x < gridSize - 1; x++) {
+                uint32_t topLeft = static_cast<uint32_t>(z) * gridSize + x;
+                uint32_t topRight = topLeft + 1;
+                uint32_t bottomLeft = topLeft + gridSize;
+                uint32_t bottomRight = bottomLeft + 1;
+
+                indices.push_back(topLeft);
+                indices.push_back(bottomLeft);
+                indices.push_back(topRight);
+
+                indices.push_back(topRight);
+                indices.push_back(bottomLeft);
+                indices.push_back(bottomRight);
+            }
+        }
+
+        // The grid is drawn every frame; reorder its scan-order triangles
+        // for the post-transform cache once at build time
+        Mesh::OptimizeForVertexCache(indices, static_cast<uint32_t>(vertices.size()));
+
+        return std::make_shared<Mesh>(std::move(vertices), std::move(indices));
+    }
+
 } // namespace Genesis
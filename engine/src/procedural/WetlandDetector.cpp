@@ -5,17 +5,51 @@
 namespace Genesis
 {
 
-    void WetlandDetector::Detect(const HydrologyData &hydrology)
+    void WetlandDetector::Detect(const HydrologyData &hydrology, const DirtyRegion *region)
     {
-        m_Data.Resize(hydrology.width, hydrology.depth);
-        m_Data.Clear();
+        // Incremental mode needs existing data of matching dimensions;
+        // otherwise fall back to a full scan
+        bool incremental = region != nullptr &&
+                           m_Data.width == hydrology.width &&
+                           m_Data.depth == hydrology.depth;
 
-        for (int z = 0; z < hydrology.depth; z++)
+        if (incremental && region->Empty())
         {
-            for (int x = 0; x < hydrology.width; x++)
+            return; // Nothing changed upstream
+        }
+
+        int minX = 0;
+        int minZ = 0;
+        int maxX = hydrology.width - 1;
+        int maxZ = hydrology.depth - 1;
+
+        if (incremental)
+        {
+            minX = std::max(region->minX, 0);
+            minZ = std::max(region->minZ, 0);
+            maxX = std::min(region->maxX, hydrology.width - 1);
+            maxZ = std::min(region->maxZ, hydrology.depth - 1);
+        }
+        else
+        {
+            m_Data.Resize(hydrology.width, hydrology.depth);
+            m_Data.Clear();
+        }
+
+        for (int z = minZ; z <= maxZ; z++)
+        {
+            for (int x = minX; x <= maxX; x++)
             {
                 size_t idx = m_Data.Index(x, z);
 
+                // Re-evaluated cells start from a clean slate
+                if (incremental)
+                {
+                    m_Data.isWetland[idx] = false;
+                    m_Data.wetlandIntensity[idx] = 0.0f;
+                    m_Data.isFloodplain[idx] = false;
+                }
+
                 // Skip water cells - they are water bodies, not wetlands
                 if (hydrology.waterType[idx] != WaterType::None)
                 {
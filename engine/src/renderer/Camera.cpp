@@ -37,6 +37,27 @@ namespace Genesis {
 
     void Camera::LookAt(const glm::vec3& target, const glm::vec3& up) {
         m_ViewMatrix = glm::lookAt(m_Position, target, up);
+        m_DerivedDirty = true;
+    }
+
+    const glm::mat4& Camera::GetViewProjectionMatrix() const {
+        if (m_DerivedDirty) {
+            RecalculateDerived();
+        }
+        return m_ViewProjectionMatrix;
+    }
+
+    const Frustum& Camera::GetFrustum() const {
+        if (m_DerivedDirty) {
+            RecalculateDerived();
+        }
+        return m_Frustum;
+    }
+
+    void Camera::RecalculateDerived() const {
+        m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+        m_Frustum = Frustum::FromViewProjection(m_ViewProjectionMatrix);
+        m_DerivedDirty = false;
     }
 
     glm::vec3 Camera::GetForward() const {
@@ -72,6 +93,7 @@ namespace Genesis {
         glm::vec3 forward = GetForward();
         glm::vec3 target = m_Position + forward;
         m_ViewMatrix = glm::lookAt(m_Position, target, glm::vec3(0.0f, 1.0f, 0.0f));
+        m_DerivedDirty = true;
     }
 
     void Camera::RecalculateProjectionMatrix() {
@@ -88,6 +110,7 @@ namespace Genesis {
 
         // Flip Y for Vulkan
         m_ProjectionMatrix[1][1] *= -1;
+        m_DerivedDirty = true;
     }
 
 }
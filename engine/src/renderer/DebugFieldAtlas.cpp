@@ -0,0 +1,293 @@
+#include "genesis/renderer/DebugFieldAtlas.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/core/Log.h"
+
+#include <cstring>
+
+namespace Genesis
+{
+
+    namespace
+    {
+        // Floor modulo so negative chunk coordinates wrap into [0, n)
+        int WrapSlot(int chunkCoord)
+        {
+            int m = chunkCoord % DebugFieldAtlas::CHUNKS_PER_SIDE;
+            return m < 0 ? m + DebugFieldAtlas::CHUNKS_PER_SIDE : m;
+        }
+    }
+
+    DebugFieldAtlas::~DebugFieldAtlas()
+    {
+        Shutdown();
+    }
+
+    void DebugFieldAtlas::Init(VulkanDevice &device, int chunkTexels)
+    {
+        m_Device = &device;
+        m_ChunkTexels = chunkTexels;
+        m_Size = chunkTexels * CHUNKS_PER_SIDE;
+
+        VkDevice vkDevice = device.GetDevice();
+
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.width = static_cast<uint32_t>(m_Size);
+        imageInfo.extent.height = static_cast<uint32_t>(m_Size);
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+        if (vkCreateImage(vkDevice, &imageInfo, nullptr, &m_Image) != VK_SUCCESS)
+        {
+            GEN_ERROR("Failed to create debug field atlas image!");
+            return;
+        }
+
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(vkDevice, m_Image, &memRequirements);
+        m_ImageAllocation = device.GetAllocator().Allocate(memRequirements,
+                                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                           false);
+        vkBindImageMemory(vkDevice, m_Image, m_ImageAllocation.Memory, m_ImageAllocation.Offset);
+
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_Image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+
+        if (vkCreateImageView(vkDevice, &viewInfo, nullptr, &m_ImageView) != VK_SUCCESS)
+        {
+            GEN_ERROR("Failed to create debug field atlas image view!");
+            return;
+        }
+
+        // Repeat addressing matches the toroidal slot mapping: UVs are the
+        // fractional world position over the atlas period
+        VkSamplerCreateInfo samplerInfo{};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = VK_FILTER_NEAREST;
+        samplerInfo.minFilter = VK_FILTER_NEAREST;
+        samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        samplerInfo.anisotropyEnable = VK_FALSE;
+        samplerInfo.maxAnisotropy = 1.0f;
+        samplerInfo.borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK;
+        samplerInfo.unnormalizedCoordinates = VK_FALSE;
+        samplerInfo.compareEnable = VK_FALSE;
+        samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
+        samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+
+        if (vkCreateSampler(vkDevice, &samplerInfo, nullptr, &m_Sampler) != VK_SUCCESS)
+        {
+            GEN_ERROR("Failed to create debug field atlas sampler!");
+            return;
+        }
+
+        VkDeviceSize bufferSize = static_cast<VkDeviceSize>(m_Size) * m_Size * 4;
+
+        VkBufferCreateInfo bufferInfo{};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = bufferSize;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        if (vkCreateBuffer(vkDevice, &bufferInfo, nullptr, &m_StagingBuffer) != VK_SUCCESS)
+        {
+            GEN_ERROR("Failed to create debug field atlas staging buffer!");
+            return;
+        }
+
+        VkMemoryRequirements stagingMemReq;
+        vkGetBufferMemoryRequirements(vkDevice, m_StagingBuffer, &stagingMemReq);
+        m_StagingAllocation = device.GetAllocator().Allocate(stagingMemReq,
+                                                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        vkBindBufferMemory(vkDevice, m_StagingBuffer, m_StagingAllocation.Memory, m_StagingAllocation.Offset);
+
+        // First flush uploads the whole (zeroed) image so the layout is
+        // defined even before any chunk writes its block
+        m_Pixels.assign(static_cast<size_t>(m_Size) * m_Size * 4, 0);
+        FlushUploads();
+
+        GEN_DEBUG("DebugFieldAtlas created ({}x{}, {} texels per chunk)", m_Size, m_Size, m_ChunkTexels);
+    }
+
+    void DebugFieldAtlas::Shutdown()
+    {
+        if (!m_Device)
+            return;
+
+        VkDevice device = m_Device->GetDevice();
+        m_Device->WaitIdle();
+
+        if (m_StagingBuffer != VK_NULL_HANDLE)
+        {
+            vkDestroyBuffer(device, m_StagingBuffer, nullptr);
+            m_StagingBuffer = VK_NULL_HANDLE;
+        }
+        if (m_StagingAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_StagingAllocation);
+            m_StagingAllocation = GpuAllocation{};
+        }
+        if (m_Sampler != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(device, m_Sampler, nullptr);
+            m_Sampler = VK_NULL_HANDLE;
+        }
+        if (m_ImageView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(device, m_ImageView, nullptr);
+            m_ImageView = VK_NULL_HANDLE;
+        }
+        if (m_Image != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(device, m_Image, nullptr);
+            m_Image = VK_NULL_HANDLE;
+        }
+        if (m_ImageAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_ImageAllocation);
+            m_ImageAllocation = GpuAllocation{};
+        }
+
+        m_Pixels.clear();
+        m_DirtySlots.clear();
+        m_Initialized = false;
+        m_Device = nullptr;
+    }
+
+    void DebugFieldAtlas::UpdateChunk(int chunkX, int chunkZ, const uint8_t *rgba)
+    {
+        if (!m_Device || m_Image == VK_NULL_HANDLE || !rgba)
+            return;
+
+        SlotRect slot{WrapSlot(chunkX) * m_ChunkTexels, WrapSlot(chunkZ) * m_ChunkTexels};
+
+        size_t atlasRowBytes = static_cast<size_t>(m_Size) * 4;
+        size_t blockRowBytes = static_cast<size_t>(m_ChunkTexels) * 4;
+        for (int row = 0; row < m_ChunkTexels; row++)
+        {
+            std::memcpy(m_Pixels.data() + (slot.Y + row) * atlasRowBytes + static_cast<size_t>(slot.X) * 4,
+                        rgba + row * blockRowBytes, blockRowBytes);
+        }
+
+        for (const SlotRect &queued : m_DirtySlots)
+        {
+            if (queued.X == slot.X && queued.Y == slot.Y)
+                return; // Slot already queued; the mirror now holds the newest data
+        }
+        m_DirtySlots.push_back(slot);
+    }
+
+    void DebugFieldAtlas::FlushUploads()
+    {
+        if (!m_Device || m_Image == VK_NULL_HANDLE)
+            return;
+
+        // Until the first upload lands the image contents are undefined
+        // outside whatever slots were touched, so start with a full copy
+        std::vector<VkBufferImageCopy> regions;
+        size_t atlasRowBytes = static_cast<size_t>(m_Size) * 4;
+        uint8_t *staging = static_cast<uint8_t *>(m_StagingAllocation.Mapped);
+
+        if (!m_Initialized)
+        {
+            std::memcpy(staging, m_Pixels.data(), m_Pixels.size());
+
+            VkBufferImageCopy region{};
+            region.bufferRowLength = static_cast<uint32_t>(m_Size);
+            region.bufferImageHeight = static_cast<uint32_t>(m_Size);
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.layerCount = 1;
+            region.imageExtent = {static_cast<uint32_t>(m_Size), static_cast<uint32_t>(m_Size), 1};
+            regions.push_back(region);
+        }
+        else
+        {
+            if (m_DirtySlots.empty())
+                return;
+
+            // Staging mirrors the full image layout, so a slot is addressed
+            // by its top-left offset with a full-row stride
+            regions.reserve(m_DirtySlots.size());
+            for (const SlotRect &slot : m_DirtySlots)
+            {
+                for (int row = 0; row < m_ChunkTexels; row++)
+                {
+                    size_t offset = (slot.Y + row) * atlasRowBytes + static_cast<size_t>(slot.X) * 4;
+                    std::memcpy(staging + offset, m_Pixels.data() + offset,
+                                static_cast<size_t>(m_ChunkTexels) * 4);
+                }
+
+                VkBufferImageCopy region{};
+                region.bufferOffset = slot.Y * atlasRowBytes + static_cast<size_t>(slot.X) * 4;
+                region.bufferRowLength = static_cast<uint32_t>(m_Size);
+                region.bufferImageHeight = static_cast<uint32_t>(m_Size);
+                region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                region.imageSubresource.layerCount = 1;
+                region.imageOffset = {slot.X, slot.Y, 0};
+                region.imageExtent = {static_cast<uint32_t>(m_ChunkTexels),
+                                      static_cast<uint32_t>(m_ChunkTexels), 1};
+                regions.push_back(region);
+            }
+        }
+
+        VkCommandBuffer commandBuffer = m_Device->BeginSingleTimeCommands();
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        // Partial copies must preserve the surrounding texels, so after the
+        // first upload the old layout is the real one rather than UNDEFINED
+        barrier.oldLayout = m_Initialized ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+                                          : VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = m_Image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.layerCount = 1;
+        barrier.srcAccessMask = m_Initialized ? VK_ACCESS_SHADER_READ_BIT : 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+
+        vkCmdPipelineBarrier(commandBuffer,
+                             m_Initialized ? VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+                                           : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        vkCmdCopyBufferToImage(commandBuffer, m_StagingBuffer, m_Image,
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<uint32_t>(regions.size()), regions.data());
+
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        m_Device->EndSingleTimeCommands(commandBuffer);
+
+        m_DirtySlots.clear();
+        m_Initialized = true;
+    }
+
+}
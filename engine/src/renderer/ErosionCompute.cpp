@@ -0,0 +1,220 @@
+#include "genesis/renderer/ErosionCompute.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/procedural/TerrainGenerator.h"
+#include "genesis/core/Log.h"
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace Genesis {
+
+    namespace {
+
+        // Must match the push constant block in erosion.comp
+        struct ErosionParams {
+            int32_t Width;
+            int32_t Depth;
+            int32_t DropletCount;
+            uint32_t Seed;
+
+            float Inertia;
+            float Capacity;
+            float Deposition;
+            float Evaporation;
+        };
+
+        constexpr uint32_t WORKGROUP_SIZE = 64;
+
+        // Height deltas are accumulated as 16.16 fixed point so droplets can
+        // atomicAdd without float atomics extensions
+        constexpr float FIXED_POINT_SCALE = 65536.0f;
+
+    }
+
+    ErosionCompute::~ErosionCompute() {
+        if (m_Device) {
+            Shutdown();
+        }
+    }
+
+    void ErosionCompute::Init(VulkanDevice& device) {
+        m_Device = &device;
+
+        try {
+            CreateDescriptorResources();
+            m_Pipeline.InitCompute(device, "assets/shaders/erosion.comp.spv", m_PipelineLayout);
+            m_Available = true;
+            GEN_INFO("Erosion compute pipeline initialized");
+        } catch (const std::exception& e) {
+            GEN_WARN("Erosion compute unavailable, falling back to CPU erosion: {}", e.what());
+            m_Available = false;
+        }
+    }
+
+    void ErosionCompute::Shutdown() {
+        if (!m_Device) {
+            return;
+        }
+
+        VkDevice device = m_Device->GetDevice();
+
+        m_Pipeline.Shutdown();
+        m_HeightBuffer.Shutdown();
+        m_DeltaBuffer.Shutdown();
+
+        // The descriptor set came from the device's shared pools and is
+        // reclaimed with them
+        if (m_PipelineLayout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+        if (m_DescriptorSetLayout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(device, m_DescriptorSetLayout, nullptr);
+            m_DescriptorSetLayout = VK_NULL_HANDLE;
+        }
+
+        m_Available = false;
+        m_Device = nullptr;
+    }
+
+    bool ErosionCompute::Erode(const TerrainSettings& settings, std::vector<float>& heightmap,
+                               int width, int depth, float offsetX, float offsetZ) {
+        if (!m_Available || width <= 4 || depth <= 4 || settings.gpuErosionDroplets <= 0) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_DispatchMutex);
+
+        VkDeviceSize heightSize = static_cast<VkDeviceSize>(width) * depth * sizeof(float);
+        EnsureBuffers(heightSize);
+
+        m_HeightBuffer.WriteToBuffer(heightmap.data(), heightSize);
+        std::memset(m_DeltaBuffer.GetMappedMemory(), 0, heightSize);
+
+        // Same per-chunk seed derivation as the CPU droplet loop
+        int32_t chunkGridX = static_cast<int32_t>(std::floor(offsetX / (settings.width * settings.cellSize)));
+        int32_t chunkGridZ = static_cast<int32_t>(std::floor(offsetZ / (settings.depth * settings.cellSize)));
+        uint32_t chunkSeed = settings.seed ^ (static_cast<uint32_t>(chunkGridX * 198491317) ^
+                                              static_cast<uint32_t>(chunkGridZ * 6542989));
+
+        ErosionParams params{};
+        params.Width = width;
+        params.Depth = depth;
+        params.DropletCount = settings.gpuErosionDroplets;
+        params.Seed = chunkSeed;
+        params.Inertia = settings.erosionInertia;
+        params.Capacity = settings.erosionCapacity;
+        params.Deposition = settings.erosionDeposition;
+        params.Evaporation = settings.erosionEvaporation;
+
+        VkCommandBuffer commandBuffer = m_Device->BeginComputeCommands();
+
+        m_Pipeline.Bind(commandBuffer);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout,
+                                0, 1, &m_DescriptorSet, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                           0, sizeof(ErosionParams), &params);
+
+        uint32_t groups = (static_cast<uint32_t>(settings.gpuErosionDroplets) + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+        vkCmdDispatch(commandBuffer, groups, 1, 1);
+
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        m_Device->EndComputeCommands(commandBuffer);
+
+        // Apply the accumulated fixed-point deltas to the heightmap
+        const int32_t* deltas = static_cast<const int32_t*>(m_DeltaBuffer.GetMappedMemory());
+        size_t count = static_cast<size_t>(width) * depth;
+        for (size_t i = 0; i < count; i++) {
+            heightmap[i] += deltas[i] / FIXED_POINT_SCALE;
+        }
+
+        return true;
+    }
+
+    void ErosionCompute::CreateDescriptorResources() {
+        VkDevice device = m_Device->GetDevice();
+
+        // Binding 0: heightfield (read), binding 1: fixed-point deltas (atomicAdd)
+        VkDescriptorSetLayoutBinding bindings[2]{};
+        for (uint32_t i = 0; i < 2; i++) {
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 2;
+        layoutInfo.pBindings = bindings;
+
+        if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_DescriptorSetLayout) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create erosion descriptor set layout!");
+        }
+
+        VkPushConstantRange pushRange{};
+        pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushRange.offset = 0;
+        pushRange.size = sizeof(ErosionParams);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &m_DescriptorSetLayout;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+
+        if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create erosion pipeline layout!");
+        }
+
+        // One long-lived set from the device's shared descriptor pools
+        m_DescriptorSet = m_Device->AllocateDescriptorSet(m_DescriptorSetLayout);
+    }
+
+    void ErosionCompute::EnsureBuffers(VkDeviceSize heightSize) {
+        if (m_HeightBuffer.GetBuffer() != VK_NULL_HANDLE && m_HeightBuffer.GetSize() >= heightSize) {
+            return;
+        }
+
+        m_HeightBuffer.Shutdown();
+        m_HeightBuffer.Init(*m_Device, heightSize,
+                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        m_HeightBuffer.Map();
+
+        m_DeltaBuffer.Shutdown();
+        m_DeltaBuffer.Init(*m_Device, heightSize,
+                           VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        m_DeltaBuffer.Map();
+
+        VkDescriptorBufferInfo heightInfo = m_HeightBuffer.GetDescriptorInfo();
+        VkDescriptorBufferInfo deltaInfo = m_DeltaBuffer.GetDescriptorInfo();
+
+        VkWriteDescriptorSet writes[2]{};
+        writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[0].dstSet = m_DescriptorSet;
+        writes[0].dstBinding = 0;
+        writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[0].descriptorCount = 1;
+        writes[0].pBufferInfo = &heightInfo;
+
+        writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[1].dstSet = m_DescriptorSet;
+        writes[1].dstBinding = 1;
+        writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[1].descriptorCount = 1;
+        writes[1].pBufferInfo = &deltaInfo;
+
+        vkUpdateDescriptorSets(m_Device->GetDevice(), 2, writes, 0, nullptr);
+    }
+
+}
@@ -0,0 +1,198 @@
+#include "genesis/renderer/GpuAllocator.h"
+#include "genesis/core/Log.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Genesis {
+
+    GpuAllocator::~GpuAllocator() {
+        if (m_Device != VK_NULL_HANDLE) {
+            Shutdown();
+        }
+    }
+
+    void GpuAllocator::Init(VkPhysicalDevice physicalDevice, VkDevice device) {
+        m_PhysicalDevice = physicalDevice;
+        m_Device = device;
+    }
+
+    void GpuAllocator::Shutdown() {
+        for (auto& block : m_Blocks) {
+            if (block.FreeRanges.size() != 1 || block.FreeRanges[0].Size != block.Size) {
+                GEN_WARN("GpuAllocator: destroying block with live allocations");
+            }
+            if (block.Mapped) {
+                vkUnmapMemory(m_Device, block.Memory);
+            }
+            vkFreeMemory(m_Device, block.Memory, nullptr);
+        }
+        m_Blocks.clear();
+        m_Device = VK_NULL_HANDLE;
+        m_PhysicalDevice = VK_NULL_HANDLE;
+    }
+
+    GpuAllocation GpuAllocator::Allocate(const VkMemoryRequirements& requirements,
+                                         VkMemoryPropertyFlags properties, bool linear) {
+        GpuAllocation allocation;
+        allocation.MemoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+        allocation.Size = requirements.size;
+
+        bool hostVisible = (properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+
+        // Oversized requests get a dedicated allocation
+        if (requirements.size > DEDICATED_THRESHOLD) {
+            VkMemoryAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+            allocInfo.allocationSize = requirements.size;
+            allocInfo.memoryTypeIndex = allocation.MemoryTypeIndex;
+
+            if (vkAllocateMemory(m_Device, &allocInfo, nullptr, &allocation.Memory) != VK_SUCCESS) {
+                throw std::runtime_error("Failed to allocate dedicated device memory!");
+            }
+            if (hostVisible) {
+                vkMapMemory(m_Device, allocation.Memory, 0, VK_WHOLE_SIZE, 0, &allocation.Mapped);
+            }
+            return allocation;
+        }
+
+        // First fit across existing blocks of the right type and tiling class
+        for (size_t i = 0; i < m_Blocks.size(); i++) {
+            Block& block = m_Blocks[i];
+            if (block.MemoryTypeIndex != allocation.MemoryTypeIndex || block.Linear != linear) {
+                continue;
+            }
+            VkDeviceSize offset = 0;
+            if (AllocateFromBlock(block, requirements.size, requirements.alignment, offset)) {
+                allocation.Memory = block.Memory;
+                allocation.Offset = offset;
+                allocation.BlockIndex = static_cast<int32_t>(i);
+                if (block.Mapped) {
+                    allocation.Mapped = static_cast<char*>(block.Mapped) + offset;
+                }
+                return allocation;
+            }
+        }
+
+        // No room: open a new block
+        Block block;
+        block.Size = BLOCK_SIZE;
+        block.MemoryTypeIndex = allocation.MemoryTypeIndex;
+        block.Linear = linear;
+        block.FreeRanges.push_back({0, BLOCK_SIZE});
+
+        VkMemoryAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.allocationSize = BLOCK_SIZE;
+        allocInfo.memoryTypeIndex = allocation.MemoryTypeIndex;
+
+        if (vkAllocateMemory(m_Device, &allocInfo, nullptr, &block.Memory) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate device memory block!");
+        }
+        if (hostVisible) {
+            vkMapMemory(m_Device, block.Memory, 0, VK_WHOLE_SIZE, 0, &block.Mapped);
+        }
+
+        GEN_DEBUG("GpuAllocator: new {} MB block (type {}, {}), {} blocks total",
+                  BLOCK_SIZE / (1024 * 1024), allocation.MemoryTypeIndex,
+                  linear ? "linear" : "optimal", m_Blocks.size() + 1);
+
+        m_Blocks.push_back(std::move(block));
+
+        Block& newBlock = m_Blocks.back();
+        VkDeviceSize offset = 0;
+        AllocateFromBlock(newBlock, requirements.size, requirements.alignment, offset);
+        allocation.Memory = newBlock.Memory;
+        allocation.Offset = offset;
+        allocation.BlockIndex = static_cast<int32_t>(m_Blocks.size() - 1);
+        if (newBlock.Mapped) {
+            allocation.Mapped = static_cast<char*>(newBlock.Mapped) + offset;
+        }
+        return allocation;
+    }
+
+    void GpuAllocator::Free(const GpuAllocation& allocation) {
+        if (!allocation.IsValid()) {
+            return;
+        }
+
+        if (allocation.BlockIndex < 0) {
+            if (allocation.Mapped) {
+                vkUnmapMemory(m_Device, allocation.Memory);
+            }
+            vkFreeMemory(m_Device, allocation.Memory, nullptr);
+            return;
+        }
+
+        Block& block = m_Blocks[allocation.BlockIndex];
+        ReleaseRange(block.FreeRanges, allocation.Offset, allocation.Size);
+    }
+
+    bool GpuAllocator::AllocateFromBlock(Block& block, VkDeviceSize size, VkDeviceSize alignment,
+                                         VkDeviceSize& outOffset) {
+        for (auto it = block.FreeRanges.begin(); it != block.FreeRanges.end(); ++it) {
+            VkDeviceSize aligned = (it->Offset + alignment - 1) & ~(alignment - 1);
+            VkDeviceSize padding = aligned - it->Offset;
+            if (it->Size < padding + size) {
+                continue;
+            }
+
+            outOffset = aligned;
+
+            // Leading padding and trailing remainder stay on the free list;
+            // Free() re-coalesces them with the released range later
+            FreeRange trailing{aligned + size, it->Size - padding - size};
+            if (padding > 0) {
+                it->Size = padding;
+                if (trailing.Size > 0) {
+                    block.FreeRanges.insert(it + 1, trailing);
+                }
+            } else if (trailing.Size > 0) {
+                *it = trailing;
+            } else {
+                block.FreeRanges.erase(it);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void GpuAllocator::ReleaseRange(std::vector<FreeRange>& freeList,
+                                    VkDeviceSize offset, VkDeviceSize size) {
+        auto it = std::lower_bound(freeList.begin(), freeList.end(), offset,
+                                   [](const FreeRange& range, VkDeviceSize value) {
+                                       return range.Offset < value;
+                                   });
+        it = freeList.insert(it, {offset, size});
+
+        // Merge with the previous range when contiguous
+        if (it != freeList.begin()) {
+            auto prev = it - 1;
+            if (prev->Offset + prev->Size == it->Offset) {
+                prev->Size += it->Size;
+                it = freeList.erase(it) - 1;
+            }
+        }
+
+        // Merge with the next range when contiguous
+        auto next = it + 1;
+        if (next != freeList.end() && it->Offset + it->Size == next->Offset) {
+            it->Size += next->Size;
+            freeList.erase(next);
+        }
+    }
+
+    uint32_t GpuAllocator::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties) const {
+        VkPhysicalDeviceMemoryProperties memProperties;
+        vkGetPhysicalDeviceMemoryProperties(m_PhysicalDevice, &memProperties);
+
+        for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
+            if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+                return i;
+            }
+        }
+
+        throw std::runtime_error("Failed to find suitable memory type!");
+    }
+
+}
@@ -0,0 +1,187 @@
+#include "genesis/renderer/GpuProfiler.h"
+#include "genesis/renderer/Renderer.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/core/Log.h"
+
+#include <cstdint>
+
+namespace Genesis
+{
+
+    // Per-thread zone nesting stack: worker threads record different command
+    // buffers concurrently and each needs its own Begin/End pairing. Indices
+    // point into the current frame's Zones (SIZE_MAX = out-of-queries
+    // sentinel).
+    static thread_local std::vector<size_t> t_ZoneStack;
+
+    void GpuProfiler::Init(VulkanDevice &device, uint32_t framesInFlight)
+    {
+        m_Device = &device;
+
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(device.GetPhysicalDevice(), &properties);
+
+        if (properties.limits.timestampPeriod <= 0.0f ||
+            !properties.limits.timestampComputeAndGraphics)
+        {
+            GEN_WARN("GPU timestamps not supported; GPU profiling disabled");
+            return;
+        }
+        m_TimestampPeriod = properties.limits.timestampPeriod;
+
+        VkQueryPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        poolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        poolInfo.queryCount = framesInFlight * MAX_QUERIES_PER_FRAME;
+
+        if (vkCreateQueryPool(m_Device->GetDevice(), &poolInfo, nullptr, &m_QueryPool) != VK_SUCCESS)
+        {
+            GEN_WARN("Failed to create timestamp query pool; GPU profiling disabled");
+            return;
+        }
+
+        m_Frames.resize(framesInFlight);
+        m_Supported = true;
+    }
+
+    void GpuProfiler::Shutdown()
+    {
+        if (m_QueryPool != VK_NULL_HANDLE)
+        {
+            vkDestroyQueryPool(m_Device->GetDevice(), m_QueryPool, nullptr);
+            m_QueryPool = VK_NULL_HANDLE;
+        }
+        m_Frames.clear();
+        t_ZoneStack.clear();
+        m_History.clear();
+        m_Supported = false;
+        m_Device = nullptr;
+    }
+
+    void GpuProfiler::BeginFrame(VkCommandBuffer cmd, uint32_t frameIndex, RenderStats &stats)
+    {
+        if (!m_Supported)
+            return;
+
+        m_CurrentFrame = frameIndex;
+        uint32_t baseQuery = frameIndex * MAX_QUERIES_PER_FRAME;
+
+        FrameQueries &frame = m_Frames[frameIndex];
+        ResolveFrame(frame, baseQuery, stats);
+
+        frame.Zones.clear();
+        frame.NextQuery = 0;
+        t_ZoneStack.clear();
+
+        vkCmdResetQueryPool(cmd, m_QueryPool, baseQuery, MAX_QUERIES_PER_FRAME);
+    }
+
+    void GpuProfiler::BeginZone(VkCommandBuffer cmd, const char *name)
+    {
+        if (!m_Supported)
+            return;
+
+        uint32_t beginQuery;
+        {
+            std::lock_guard<std::mutex> lock(m_ZoneMutex);
+
+            FrameQueries &frame = m_Frames[m_CurrentFrame];
+            if (frame.NextQuery + 2 > MAX_QUERIES_PER_FRAME)
+            {
+                // Out of queries: push a sentinel so EndZone stays paired
+                t_ZoneStack.push_back(SIZE_MAX);
+                return;
+            }
+
+            ZoneRecord record;
+            record.Name = name;
+            record.BeginQuery = frame.NextQuery++;
+            record.EndQuery = frame.NextQuery++;
+            beginQuery = record.BeginQuery;
+            t_ZoneStack.push_back(frame.Zones.size());
+            frame.Zones.push_back(std::move(record));
+        }
+
+        // Timestamps go into this thread's own command buffer; only the
+        // bookkeeping above is shared
+        uint32_t baseQuery = m_CurrentFrame * MAX_QUERIES_PER_FRAME;
+        vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_QueryPool,
+                            baseQuery + beginQuery);
+    }
+
+    void GpuProfiler::EndZone(VkCommandBuffer cmd)
+    {
+        if (!m_Supported || t_ZoneStack.empty())
+            return;
+
+        size_t zoneIndex = t_ZoneStack.back();
+        t_ZoneStack.pop_back();
+        if (zoneIndex == SIZE_MAX)
+            return;
+
+        uint32_t endQuery;
+        {
+            // Another thread's BeginZone may be growing Zones right now
+            std::lock_guard<std::mutex> lock(m_ZoneMutex);
+            endQuery = m_Frames[m_CurrentFrame].Zones[zoneIndex].EndQuery;
+        }
+
+        uint32_t baseQuery = m_CurrentFrame * MAX_QUERIES_PER_FRAME;
+        vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_QueryPool,
+                            baseQuery + endQuery);
+    }
+
+    void GpuProfiler::ResolveFrame(FrameQueries &frame, uint32_t baseQuery, RenderStats &stats)
+    {
+        stats.GpuZones.clear();
+        stats.GpuTime = 0.0f;
+
+        if (frame.Zones.empty())
+            return;
+
+        std::vector<uint64_t> results(frame.NextQuery);
+        VkResult result = vkGetQueryPoolResults(m_Device->GetDevice(), m_QueryPool, baseQuery,
+                                                frame.NextQuery,
+                                                results.size() * sizeof(uint64_t), results.data(),
+                                                sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+        // The slot's fence was waited on before BeginFrame, so NOT_READY only
+        // happens in odd cases (e.g. device loss); just skip the frame
+        if (result != VK_SUCCESS)
+            return;
+
+        // Merge repeated zones by name, preserving first-recorded order
+        for (const ZoneRecord &zone : frame.Zones)
+        {
+            uint64_t ticks = results[zone.EndQuery] - results[zone.BeginQuery];
+            float milliseconds = static_cast<float>(ticks) * m_TimestampPeriod * 1.0e-6f;
+
+            bool merged = false;
+            for (auto &timing : stats.GpuZones)
+            {
+                if (timing.Name == zone.Name)
+                {
+                    timing.Milliseconds += milliseconds;
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged)
+            {
+                stats.GpuZones.push_back({zone.Name, milliseconds});
+            }
+        }
+
+        for (const auto &timing : stats.GpuZones)
+        {
+            if (timing.Name == "Frame")
+            {
+                stats.GpuTime = timing.Milliseconds;
+            }
+
+            ZoneHistory &history = m_History[timing.Name];
+            history.Samples[history.Head] = timing.Milliseconds;
+            history.Head = (history.Head + 1) % HISTORY_SIZE;
+        }
+    }
+
+}
@@ -0,0 +1,339 @@
+#include "genesis/renderer/HeightfieldCompute.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/procedural/TerrainGenerator.h"
+#include "genesis/core/Log.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace Genesis {
+
+    namespace {
+
+        // Must match the push constant block in heightfield.comp (scalar
+        // 4-byte members only, 120 bytes - within the 128 byte minimum limit)
+        struct HeightfieldParams {
+            float OriginX;
+            float OriginZ;
+            float CellSize;
+            int32_t Width;
+            int32_t Depth;
+
+            int32_t UseContinentalField;
+            float ContinentalFrequency;
+            float OceanThreshold;
+            float CoastlineBlend;
+            float OceanDepth;
+            float OceanFloorVariation;
+
+            float NoiseScale;
+            int32_t Octaves;
+            float Persistence;
+            float Lacunarity;
+
+            int32_t UseWarp;
+            float WarpStrength;
+            float WarpScale;
+            int32_t WarpLevels;
+
+            int32_t UseRidgeNoise;
+            float RidgeWeight;
+            float RidgePower;
+            float RidgeScale;
+
+            int32_t UseUpliftMask;
+            float UpliftScale;
+            float UpliftThresholdLow;
+            float UpliftThresholdHigh;
+            float UpliftPower;
+
+            float BaseHeight;
+            float HeightScale;
+        };
+
+        constexpr uint32_t WORKGROUP_SIZE = 8;
+
+        HeightfieldParams BuildParams(const TerrainSettings& settings, float originX, float originZ,
+                                      int width, int depth) {
+            HeightfieldParams params{};
+            params.OriginX = originX;
+            params.OriginZ = originZ;
+            params.CellSize = settings.cellSize;
+            params.Width = width;
+            params.Depth = depth;
+            params.UseContinentalField = settings.useContinentalField ? 1 : 0;
+            params.ContinentalFrequency = settings.continentalFrequency;
+            params.OceanThreshold = settings.oceanThreshold;
+            params.CoastlineBlend = settings.coastlineBlend;
+            params.OceanDepth = settings.oceanDepth;
+            params.OceanFloorVariation = settings.oceanFloorVariation;
+            params.NoiseScale = settings.noiseScale;
+            params.Octaves = settings.octaves;
+            params.Persistence = settings.persistence;
+            params.Lacunarity = settings.lacunarity;
+            params.UseWarp = settings.useWarp ? 1 : 0;
+            params.WarpStrength = settings.warpStrength;
+            params.WarpScale = settings.warpScale;
+            params.WarpLevels = settings.warpLevels;
+            params.UseRidgeNoise = settings.useRidgeNoise ? 1 : 0;
+            params.RidgeWeight = settings.ridgeWeight;
+            params.RidgePower = settings.ridgePower;
+            params.RidgeScale = settings.ridgeScale;
+            params.UseUpliftMask = settings.useUpliftMask ? 1 : 0;
+            params.UpliftScale = settings.upliftScale;
+            params.UpliftThresholdLow = settings.upliftThresholdLow;
+            params.UpliftThresholdHigh = settings.upliftThresholdHigh;
+            params.UpliftPower = settings.upliftPower;
+            params.BaseHeight = settings.baseHeight;
+            params.HeightScale = settings.heightScale;
+            return params;
+        }
+
+    }
+
+    HeightfieldCompute::~HeightfieldCompute() {
+        if (m_Device) {
+            Shutdown();
+        }
+    }
+
+    void HeightfieldCompute::Init(VulkanDevice& device) {
+        m_Device = &device;
+
+        try {
+            CreateDescriptorResources();
+            m_Pipeline.InitCompute(device, "assets/shaders/heightfield.comp.spv", m_PipelineLayout);
+            m_Available = true;
+            GEN_INFO("Heightfield compute pipeline initialized");
+        } catch (const std::exception& e) {
+            GEN_WARN("Heightfield compute unavailable, falling back to CPU generation: {}", e.what());
+            m_Available = false;
+        }
+    }
+
+    void HeightfieldCompute::Shutdown() {
+        if (!m_Device) {
+            return;
+        }
+
+        VkDevice device = m_Device->GetDevice();
+
+        m_Pipeline.Shutdown();
+        m_HeightBuffer.Shutdown();
+        m_PermutationBuffer.Shutdown();
+
+        // The descriptor set came from the device's shared pools and is
+        // reclaimed with them
+        if (m_PipelineLayout != VK_NULL_HANDLE) {
+            vkDestroyPipelineLayout(device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+        if (m_DescriptorSetLayout != VK_NULL_HANDLE) {
+            vkDestroyDescriptorSetLayout(device, m_DescriptorSetLayout, nullptr);
+            m_DescriptorSetLayout = VK_NULL_HANDLE;
+        }
+
+        m_Available = false;
+        m_Device = nullptr;
+    }
+
+    bool HeightfieldCompute::Generate(const TerrainSettings& settings, float originX, float originZ,
+                                      int width, int depth, std::vector<float>& outHeights) {
+        if (!m_Available || width <= 0 || depth <= 0) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_DispatchMutex);
+
+        VkDeviceSize requiredSize = static_cast<VkDeviceSize>(width) * depth * sizeof(float);
+        EnsureHeightBuffer(requiredSize);
+        UploadPermutation(settings.seed);
+
+        HeightfieldParams params = BuildParams(settings, originX, originZ, width, depth);
+
+        VkCommandBuffer commandBuffer = m_Device->BeginComputeCommands();
+
+        m_Pipeline.Bind(commandBuffer);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout,
+                                0, 1, &m_DescriptorSet, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                           0, sizeof(HeightfieldParams), &params);
+
+        uint32_t groupsX = (static_cast<uint32_t>(width) + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+        uint32_t groupsZ = (static_cast<uint32_t>(depth) + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+        vkCmdDispatch(commandBuffer, groupsX, groupsZ, 1);
+
+        // Make the shader writes visible to the host read below. The
+        // compute helper waits on this submission's fence - on the async
+        // compute queue, so rendering is never stalled.
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        m_Device->EndComputeCommands(commandBuffer);
+
+        outHeights.resize(static_cast<size_t>(width) * depth);
+        std::memcpy(outHeights.data(), m_HeightBuffer.GetMappedMemory(), requiredSize);
+
+        return true;
+    }
+
+    bool HeightfieldCompute::GenerateAsync(const TerrainSettings& settings, float originX, float originZ,
+                                           int width, int depth,
+                                           std::function<void(std::vector<float> heights)> callback) {
+        if (!m_Available || width <= 0 || depth <= 0) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_DispatchMutex);
+
+        VkDeviceSize requiredSize = static_cast<VkDeviceSize>(width) * depth * sizeof(float);
+        EnsureHeightBuffer(requiredSize);
+        UploadPermutation(settings.seed);
+
+        HeightfieldParams params = BuildParams(settings, originX, originZ, width, depth);
+
+        // Dispatch and readback copy in one submission on the async
+        // compute queue, overlapping whatever the graphics queue is doing
+        VkCommandBuffer commandBuffer = m_Device->BeginReadbackCommands(true);
+
+        // The previous request's ring copy reads m_HeightBuffer; order this
+        // dispatch's writes after it so back-to-back requests can share the
+        // buffer while earlier submissions are still in flight
+        VkMemoryBarrier preBarrier{};
+        preBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        preBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        preBarrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &preBarrier,
+                             0, nullptr, 0, nullptr);
+
+        m_Pipeline.Bind(commandBuffer);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout,
+                                0, 1, &m_DescriptorSet, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                           0, sizeof(HeightfieldParams), &params);
+
+        uint32_t groupsX = (static_cast<uint32_t>(width) + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+        uint32_t groupsZ = (static_cast<uint32_t>(depth) + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+        vkCmdDispatch(commandBuffer, groupsX, groupsZ, 1);
+
+        // Make the shader writes visible to the readback copy
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        size_t sampleCount = static_cast<size_t>(width) * depth;
+        m_Device->SubmitReadback(
+            commandBuffer, m_HeightBuffer.GetBuffer(), 0, requiredSize,
+            [callback = std::move(callback), sampleCount](const void* data, VkDeviceSize size) {
+                std::vector<float> heights(sampleCount);
+                std::memcpy(heights.data(), data, size);
+                callback(std::move(heights));
+            },
+            true);
+
+        return true;
+    }
+
+    void HeightfieldCompute::CreateDescriptorResources() {
+        VkDevice device = m_Device->GetDevice();
+
+        // Binding 0: height output, binding 1: permutation table
+        VkDescriptorSetLayoutBinding bindings[2]{};
+        for (uint32_t i = 0; i < 2; i++) {
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 2;
+        layoutInfo.pBindings = bindings;
+
+        if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_DescriptorSetLayout) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create heightfield descriptor set layout!");
+        }
+
+        VkPushConstantRange pushRange{};
+        pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushRange.offset = 0;
+        pushRange.size = sizeof(HeightfieldParams);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &m_DescriptorSetLayout;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+
+        if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create heightfield pipeline layout!");
+        }
+
+        // One long-lived set from the device's shared descriptor pools
+        m_DescriptorSet = m_Device->AllocateDescriptorSet(m_DescriptorSetLayout);
+
+        m_PermutationBuffer.Init(*m_Device, 512 * sizeof(int32_t),
+                                 VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        m_PermutationBuffer.Map();
+    }
+
+    void HeightfieldCompute::EnsureHeightBuffer(VkDeviceSize size) {
+        if (m_HeightBuffer.GetBuffer() != VK_NULL_HANDLE && m_HeightBuffer.GetSize() >= size) {
+            return;
+        }
+
+        m_HeightBuffer.Shutdown();
+        m_HeightBuffer.Init(*m_Device, size,
+                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        m_HeightBuffer.Map();
+
+        VkDescriptorBufferInfo heightInfo = m_HeightBuffer.GetDescriptorInfo();
+        VkDescriptorBufferInfo permInfo = m_PermutationBuffer.GetDescriptorInfo();
+
+        VkWriteDescriptorSet writes[2]{};
+        writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[0].dstSet = m_DescriptorSet;
+        writes[0].dstBinding = 0;
+        writes[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[0].descriptorCount = 1;
+        writes[0].pBufferInfo = &heightInfo;
+
+        writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[1].dstSet = m_DescriptorSet;
+        writes[1].dstBinding = 1;
+        writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        writes[1].descriptorCount = 1;
+        writes[1].pBufferInfo = &permInfo;
+
+        vkUpdateDescriptorSets(m_Device->GetDevice(), 2, writes, 0, nullptr);
+    }
+
+    void HeightfieldCompute::UploadPermutation(uint32_t seed) {
+        if (m_PermutationUploaded && seed == m_UploadedSeed) {
+            return;
+        }
+
+        // Same shared per-seed table the CPU evaluators hash through
+        std::shared_ptr<const SimplexNoise> noise = NoiseState::Get(seed);
+        const auto& permutation = noise->GetPermutation();
+
+        std::vector<int32_t> data(permutation.begin(), permutation.end());
+        m_PermutationBuffer.WriteToBuffer(data.data(), data.size() * sizeof(int32_t));
+
+        m_UploadedSeed = seed;
+        m_PermutationUploaded = true;
+    }
+
+}
@@ -17,17 +17,30 @@ namespace Genesis
         Destroy();
     }
 
-    void HeightmapTexture::Create(VulkanDevice &device, int width, int height)
+    void HeightmapTexture::Create(VulkanDevice &device, int width, int height,
+                                  Format format, bool generateMips)
     {
         m_Device = &device;
         m_Width = width;
         m_Height = height;
+        m_Format = format;
+        m_MipLevels = 1;
+        if (generateMips)
+        {
+            int largest = std::max(width, height);
+            m_MipLevels = static_cast<uint32_t>(std::floor(std::log2(largest))) + 1;
+        }
 
         CreateImage(device);
         CreateSampler(device);
         CreateDescriptorSet(device);
 
-        GEN_DEBUG("HeightmapTexture created ({}x{})", width, height);
+        GEN_DEBUG("HeightmapTexture created ({}x{}, {} mips)", width, height, m_MipLevels);
+    }
+
+    VkFormat HeightmapTexture::GetVkFormat() const
+    {
+        return m_Format == Format::R16 ? VK_FORMAT_R16_UNORM : VK_FORMAT_R8G8B8A8_UNORM;
     }
 
     void HeightmapTexture::Destroy()
@@ -49,10 +62,10 @@ namespace Genesis
             vkDestroyBuffer(device, m_StagingBuffer, nullptr);
             m_StagingBuffer = VK_NULL_HANDLE;
         }
-        if (m_StagingMemory != VK_NULL_HANDLE)
+        if (m_StagingAllocation.IsValid())
         {
-            vkFreeMemory(device, m_StagingMemory, nullptr);
-            m_StagingMemory = VK_NULL_HANDLE;
+            m_Device->GetAllocator().Free(m_StagingAllocation);
+            m_StagingAllocation = GpuAllocation{};
         }
         if (m_Sampler != VK_NULL_HANDLE)
         {
@@ -69,12 +82,17 @@ namespace Genesis
             vkDestroyImage(device, m_Image, nullptr);
             m_Image = VK_NULL_HANDLE;
         }
-        if (m_ImageMemory != VK_NULL_HANDLE)
+        if (m_ImageAllocation.IsValid())
         {
-            vkFreeMemory(device, m_ImageMemory, nullptr);
-            m_ImageMemory = VK_NULL_HANDLE;
+            m_Device->GetAllocator().Free(m_ImageAllocation);
+            m_ImageAllocation = GpuAllocation{};
         }
 
+        m_Pixels.clear();
+        m_DirtyRects.clear();
+        m_Initialized = false;
+        m_Format = Format::RGBA8;
+        m_MipLevels = 1;
         m_Device = nullptr;
     }
 
@@ -88,12 +106,17 @@ namespace Genesis
         imageInfo.extent.width = static_cast<uint32_t>(m_Width);
         imageInfo.extent.height = static_cast<uint32_t>(m_Height);
         imageInfo.extent.depth = 1;
-        imageInfo.mipLevels = 1;
+        imageInfo.mipLevels = m_MipLevels;
         imageInfo.arrayLayers = 1;
-        imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        imageInfo.format = GetVkFormat();
         imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
         imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
         imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        if (m_MipLevels > 1)
+        {
+            // The mip chain is generated on the GPU by blitting level to level
+            imageInfo.usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        }
         imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
 
@@ -106,28 +129,28 @@ namespace Genesis
         VkMemoryRequirements memRequirements;
         vkGetImageMemoryRequirements(vkDevice, m_Image, &memRequirements);
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = FindMemoryType(device, memRequirements.memoryTypeBits,
-                                                   VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-        if (vkAllocateMemory(vkDevice, &allocInfo, nullptr, &m_ImageMemory) != VK_SUCCESS)
-        {
-            GEN_ERROR("Failed to allocate heightmap image memory!");
-            return;
-        }
+        // Optimal-tiled images sub-allocate from non-linear blocks
+        m_ImageAllocation = device.GetAllocator().Allocate(memRequirements,
+                                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                           false);
 
-        vkBindImageMemory(vkDevice, m_Image, m_ImageMemory, 0);
+        vkBindImageMemory(vkDevice, m_Image, m_ImageAllocation.Memory, m_ImageAllocation.Offset);
 
         VkImageViewCreateInfo viewInfo{};
         viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
         viewInfo.image = m_Image;
         viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
-        viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        viewInfo.format = GetVkFormat();
+        if (m_Format == Format::R16)
+        {
+            // Broadcast the single height channel so the ImGui widgets that
+            // display this texture keep rendering grayscale
+            viewInfo.components = {VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_R,
+                                   VK_COMPONENT_SWIZZLE_R, VK_COMPONENT_SWIZZLE_ONE};
+        }
         viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         viewInfo.subresourceRange.baseMipLevel = 0;
-        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.levelCount = m_MipLevels;
         viewInfo.subresourceRange.baseArrayLayer = 0;
         viewInfo.subresourceRange.layerCount = 1;
 
@@ -137,7 +160,8 @@ namespace Genesis
             return;
         }
 
-        VkDeviceSize bufferSize = m_Width * m_Height * 4;
+        // Staging only ever holds the base level; the chain is derived on GPU
+        VkDeviceSize bufferSize = static_cast<VkDeviceSize>(m_Width) * m_Height * BytesPerTexel();
 
         VkBufferCreateInfo bufferInfo{};
         bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -154,19 +178,10 @@ namespace Genesis
         VkMemoryRequirements stagingMemReq;
         vkGetBufferMemoryRequirements(vkDevice, m_StagingBuffer, &stagingMemReq);
 
-        VkMemoryAllocateInfo stagingAllocInfo{};
-        stagingAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        stagingAllocInfo.allocationSize = stagingMemReq.size;
-        stagingAllocInfo.memoryTypeIndex = FindMemoryType(device, stagingMemReq.memoryTypeBits,
-                                                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-        if (vkAllocateMemory(vkDevice, &stagingAllocInfo, nullptr, &m_StagingMemory) != VK_SUCCESS)
-        {
-            GEN_ERROR("Failed to allocate staging buffer memory!");
-            return;
-        }
+        m_StagingAllocation = device.GetAllocator().Allocate(stagingMemReq,
+                                                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
-        vkBindBufferMemory(vkDevice, m_StagingBuffer, m_StagingMemory, 0);
+        vkBindBufferMemory(vkDevice, m_StagingBuffer, m_StagingAllocation.Memory, m_StagingAllocation.Offset);
     }
 
     void HeightmapTexture::CreateSampler(VulkanDevice &device)
@@ -187,7 +202,7 @@ namespace Genesis
         samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
         samplerInfo.mipLodBias = 0.0f;
         samplerInfo.minLod = 0.0f;
-        samplerInfo.maxLod = 0.0f;
+        samplerInfo.maxLod = static_cast<float>(m_MipLevels - 1);
 
         if (vkCreateSampler(device.GetDevice(), &samplerInfo, nullptr, &m_Sampler) != VK_SUCCESS)
         {
@@ -201,114 +216,265 @@ namespace Genesis
                                                       VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
     }
 
-    void HeightmapTexture::Update(const std::vector<float> &heightData, float minHeight, float maxHeight)
+    // Converts a rectangle of the height grid to texels at its position in a
+    // full-image pixel buffer: grayscale RGBA, or a single normalized
+    // 16-bit channel for R16 textures
+    static void ConvertHeightRect(const std::vector<float> &heightData, float minHeight,
+                                  float maxHeight, int imageWidth,
+                                  const HeightmapTexture::DirtyRect &rect,
+                                  HeightmapTexture::Format format, uint8_t *pixels)
     {
-        if (!m_Device || m_Image == VK_NULL_HANDLE)
-            return;
-
-        VkDevice device = m_Device->GetDevice();
-
-        std::vector<uint8_t> pixels(m_Width * m_Height * 4);
-
         float range = maxHeight - minHeight;
         if (range < 0.001f)
             range = 1.0f;
 
-        for (int y = 0; y < m_Height; y++)
+        for (int y = rect.Y; y < rect.Y + rect.Height; y++)
         {
-            for (int x = 0; x < m_Width; x++)
+            for (int x = rect.X; x < rect.X + rect.Width; x++)
             {
-                int idx = y * m_Width + x;
+                int idx = y * imageWidth + x;
                 float h = (idx < static_cast<int>(heightData.size())) ? heightData[idx] : 0.0f;
                 float normalized = (h - minHeight) / range;
                 normalized = std::clamp(normalized, 0.0f, 1.0f);
 
-                uint8_t gray = static_cast<uint8_t>(normalized * 255.0f);
-
-                int pixelIdx = idx * 4;
-                pixels[pixelIdx + 0] = gray;
-                pixels[pixelIdx + 1] = gray;
-                pixels[pixelIdx + 2] = gray;
-                pixels[pixelIdx + 3] = 255;
+                if (format == HeightmapTexture::Format::R16)
+                {
+                    uint16_t value = static_cast<uint16_t>(normalized * 65535.0f);
+                    memcpy(pixels + static_cast<size_t>(idx) * 2, &value, 2);
+                }
+                else
+                {
+                    uint8_t gray = static_cast<uint8_t>(normalized * 255.0f);
+
+                    int pixelIdx = idx * 4;
+                    pixels[pixelIdx + 0] = gray;
+                    pixels[pixelIdx + 1] = gray;
+                    pixels[pixelIdx + 2] = gray;
+                    pixels[pixelIdx + 3] = 255;
+                }
             }
         }
+    }
 
-        void *data;
-        vkMapMemory(device, m_StagingMemory, 0, pixels.size(), 0, &data);
-        memcpy(data, pixels.data(), pixels.size());
-        vkUnmapMemory(device, m_StagingMemory);
+    void HeightmapTexture::Update(const std::vector<float> &heightData, float minHeight, float maxHeight)
+    {
+        if (!m_Device || m_Image == VK_NULL_HANDLE)
+            return;
 
-        VkCommandBuffer commandBuffer = m_Device->BeginSingleTimeCommands();
+        std::vector<uint8_t> pixels(static_cast<size_t>(m_Width) * m_Height * BytesPerTexel());
+        ConvertHeightRect(heightData, minHeight, maxHeight, m_Width,
+                          {0, 0, m_Width, m_Height}, m_Format, pixels.data());
 
-        VkImageMemoryBarrier barrier{};
-        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-        barrier.image = m_Image;
-        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        barrier.subresourceRange.baseMipLevel = 0;
-        barrier.subresourceRange.levelCount = 1;
-        barrier.subresourceRange.baseArrayLayer = 0;
-        barrier.subresourceRange.layerCount = 1;
-        barrier.srcAccessMask = 0;
-        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        DiffAndQueue(pixels.data());
+        FlushUploads();
+    }
 
-        vkCmdPipelineBarrier(commandBuffer,
-                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+    void HeightmapTexture::UpdateRGBA(const uint8_t *rgbaData, size_t dataSize)
+    {
+        if (!m_Device || m_Image == VK_NULL_HANDLE || !rgbaData)
+            return;
 
-        VkBufferImageCopy region{};
-        region.bufferOffset = 0;
-        region.bufferRowLength = 0;
-        region.bufferImageHeight = 0;
-        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel = 0;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount = 1;
-        region.imageOffset = {0, 0, 0};
-        region.imageExtent = {static_cast<uint32_t>(m_Width), static_cast<uint32_t>(m_Height), 1};
+        if (m_Format != Format::RGBA8)
+        {
+            GEN_ERROR("UpdateRGBA called on a non-RGBA8 heightmap texture");
+            return;
+        }
 
-        vkCmdCopyBufferToImage(commandBuffer, m_StagingBuffer, m_Image,
-                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+        size_t expectedSize = static_cast<size_t>(m_Width) * m_Height * 4;
+        if (dataSize < expectedSize)
+        {
+            GEN_ERROR("UpdateRGBA: Data size {} is less than expected {}", dataSize, expectedSize);
+            return;
+        }
 
-        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        DiffAndQueue(rgbaData);
+        FlushUploads();
+    }
 
-        vkCmdPipelineBarrier(commandBuffer,
-                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+    void HeightmapTexture::UpdateRegion(const std::vector<float> &heightData, float minHeight,
+                                        float maxHeight, const DirtyRect &rect)
+    {
+        if (!m_Device || m_Image == VK_NULL_HANDLE)
+            return;
 
-        m_Device->EndSingleTimeCommands(commandBuffer);
+        DirtyRect clipped;
+        clipped.X = std::clamp(rect.X, 0, m_Width);
+        clipped.Y = std::clamp(rect.Y, 0, m_Height);
+        clipped.Width = std::min(rect.X + rect.Width, m_Width) - clipped.X;
+        clipped.Height = std::min(rect.Y + rect.Height, m_Height) - clipped.Y;
+        if (clipped.Width <= 0 || clipped.Height <= 0)
+            return;
+
+        size_t totalBytes = static_cast<size_t>(m_Width) * m_Height * BytesPerTexel();
+        if (m_Pixels.size() != totalBytes)
+            m_Pixels.assign(totalBytes, 0);
+
+        ConvertHeightRect(heightData, minHeight, maxHeight, m_Width, clipped, m_Format,
+                          m_Pixels.data());
+        QueueDirtyRect(clipped);
     }
 
-    void HeightmapTexture::UpdateRGBA(const uint8_t *rgbaData, size_t dataSize)
+    void HeightmapTexture::DiffAndQueue(const uint8_t *newPixels)
     {
-        if (!m_Device || m_Image == VK_NULL_HANDLE || !rgbaData)
+        size_t texelBytes = BytesPerTexel();
+        size_t totalBytes = static_cast<size_t>(m_Width) * m_Height * texelBytes;
+
+        if (m_Pixels.size() != totalBytes)
+        {
+            // No mirror yet: everything is new
+            m_Pixels.assign(newPixels, newPixels + totalBytes);
+            QueueDirtyRect({0, 0, m_Width, m_Height});
             return;
+        }
 
-        VkDevice device = m_Device->GetDevice();
+        size_t rowBytes = static_cast<size_t>(m_Width) * texelBytes;
+        int runStart = -1;
+        int runMinX = 0;
+        int runMaxX = 0;
 
-        size_t expectedSize = static_cast<size_t>(m_Width) * m_Height * 4;
-        if (dataSize < expectedSize)
+        auto emitRun = [&](int endRow)
         {
-            GEN_ERROR("UpdateRGBA: Data size {} is less than expected {}", dataSize, expectedSize);
+            QueueDirtyRect({runMinX, runStart, runMaxX - runMinX + 1, endRow - runStart});
+            runStart = -1;
+        };
+
+        for (int y = 0; y < m_Height; y++)
+        {
+            uint8_t *oldRow = m_Pixels.data() + y * rowBytes;
+            const uint8_t *newRow = newPixels + y * rowBytes;
+            if (memcmp(oldRow, newRow, rowBytes) == 0)
+            {
+                if (runStart >= 0)
+                    emitRun(y);
+                continue;
+            }
+
+            // Narrow the row's changed span to texel granularity from both
+            // ends; the memcmp above guarantees a difference exists
+            int firstX = 0;
+            while (memcmp(oldRow + firstX * texelBytes, newRow + firstX * texelBytes, texelBytes) == 0)
+                firstX++;
+            int lastX = m_Width - 1;
+            while (memcmp(oldRow + lastX * texelBytes, newRow + lastX * texelBytes, texelBytes) == 0)
+                lastX--;
+
+            if (runStart < 0)
+            {
+                runStart = y;
+                runMinX = firstX;
+                runMaxX = lastX;
+            }
+            else
+            {
+                runMinX = std::min(runMinX, firstX);
+                runMaxX = std::max(runMaxX, lastX);
+            }
+            memcpy(oldRow, newRow, rowBytes);
+        }
+        if (runStart >= 0)
+            emitRun(m_Height);
+    }
+
+    void HeightmapTexture::QueueDirtyRect(DirtyRect rect)
+    {
+        // Merge with any queued rect it overlaps or touches; repeat because
+        // the union can reach rects the original did not
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (auto it = m_DirtyRects.begin(); it != m_DirtyRects.end(); ++it)
+            {
+                bool nearX = rect.X <= it->X + it->Width && it->X <= rect.X + rect.Width;
+                bool nearY = rect.Y <= it->Y + it->Height && it->Y <= rect.Y + rect.Height;
+                if (!nearX || !nearY)
+                    continue;
+
+                int x0 = std::min(rect.X, it->X);
+                int y0 = std::min(rect.Y, it->Y);
+                int x1 = std::max(rect.X + rect.Width, it->X + it->Width);
+                int y1 = std::max(rect.Y + rect.Height, it->Y + it->Height);
+                rect = {x0, y0, x1 - x0, y1 - y0};
+                m_DirtyRects.erase(it);
+                merged = true;
+                break;
+            }
+        }
+        m_DirtyRects.push_back(rect);
+
+        // Past this point separate copy regions stop paying for themselves;
+        // collapse everything into the bounding rectangle
+        constexpr size_t MAX_DIRTY_RECTS = 16;
+        if (m_DirtyRects.size() > MAX_DIRTY_RECTS)
+        {
+            DirtyRect bounds = m_DirtyRects.front();
+            for (const DirtyRect &r : m_DirtyRects)
+            {
+                int x0 = std::min(bounds.X, r.X);
+                int y0 = std::min(bounds.Y, r.Y);
+                int x1 = std::max(bounds.X + bounds.Width, r.X + r.Width);
+                int y1 = std::max(bounds.Y + bounds.Height, r.Y + r.Height);
+                bounds = {x0, y0, x1 - x0, y1 - y0};
+            }
+            m_DirtyRects.clear();
+            m_DirtyRects.push_back(bounds);
+        }
+    }
+
+    void HeightmapTexture::FlushUploads()
+    {
+        if (!m_Device || m_Image == VK_NULL_HANDLE)
             return;
+
+        // Until the first upload lands the image contents are undefined
+        // outside whatever region was touched, so start with a full copy
+        if (!m_Initialized && !m_DirtyRects.empty())
+        {
+            m_DirtyRects.clear();
+            m_DirtyRects.push_back({0, 0, m_Width, m_Height});
         }
+        if (m_DirtyRects.empty())
+            return;
 
-        void *data;
-        vkMapMemory(device, m_StagingMemory, 0, expectedSize, 0, &data);
-        memcpy(data, rgbaData, expectedSize);
-        vkUnmapMemory(device, m_StagingMemory);
+        size_t texelBytes = BytesPerTexel();
+        size_t rowBytes = static_cast<size_t>(m_Width) * texelBytes;
+        uint8_t *staging = static_cast<uint8_t *>(m_StagingAllocation.Mapped);
+
+        // Staging mirrors the full image layout, so a sub-rectangle is
+        // addressed by its top-left offset with a full-row stride
+        std::vector<VkBufferImageCopy> regions;
+        regions.reserve(m_DirtyRects.size());
+        for (const DirtyRect &rect : m_DirtyRects)
+        {
+            for (int y = rect.Y; y < rect.Y + rect.Height; y++)
+            {
+                size_t offset = y * rowBytes + static_cast<size_t>(rect.X) * texelBytes;
+                memcpy(staging + offset, m_Pixels.data() + offset,
+                       static_cast<size_t>(rect.Width) * texelBytes);
+            }
+
+            VkBufferImageCopy region{};
+            region.bufferOffset = rect.Y * rowBytes + static_cast<size_t>(rect.X) * texelBytes;
+            region.bufferRowLength = static_cast<uint32_t>(m_Width);
+            region.bufferImageHeight = static_cast<uint32_t>(m_Height);
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.mipLevel = 0;
+            region.imageSubresource.baseArrayLayer = 0;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset = {rect.X, rect.Y, 0};
+            region.imageExtent = {static_cast<uint32_t>(rect.Width),
+                                  static_cast<uint32_t>(rect.Height), 1};
+            regions.push_back(region);
+        }
 
         VkCommandBuffer commandBuffer = m_Device->BeginSingleTimeCommands();
 
         VkImageMemoryBarrier barrier{};
         barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        // Partial copies must preserve the surrounding texels, so after the
+        // first upload the old layout is the real one rather than UNDEFINED
+        barrier.oldLayout = m_Initialized ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+                                          : VK_IMAGE_LAYOUT_UNDEFINED;
         barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
         barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
@@ -318,54 +484,123 @@ namespace Genesis
         barrier.subresourceRange.levelCount = 1;
         barrier.subresourceRange.baseArrayLayer = 0;
         barrier.subresourceRange.layerCount = 1;
-        barrier.srcAccessMask = 0;
+        barrier.srcAccessMask = m_Initialized ? VK_ACCESS_SHADER_READ_BIT : 0;
         barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 
         vkCmdPipelineBarrier(commandBuffer,
-                             VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             m_Initialized ? VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+                                           : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT,
                              0, 0, nullptr, 0, nullptr, 1, &barrier);
 
-        VkBufferImageCopy region{};
-        region.bufferOffset = 0;
-        region.bufferRowLength = 0;
-        region.bufferImageHeight = 0;
-        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel = 0;
-        region.imageSubresource.baseArrayLayer = 0;
-        region.imageSubresource.layerCount = 1;
-        region.imageOffset = {0, 0, 0};
-        region.imageExtent = {static_cast<uint32_t>(m_Width), static_cast<uint32_t>(m_Height), 1};
-
         vkCmdCopyBufferToImage(commandBuffer, m_StagingBuffer, m_Image,
-                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               static_cast<uint32_t>(regions.size()), regions.data());
 
-        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-
-        vkCmdPipelineBarrier(commandBuffer,
-                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                             0, 0, nullptr, 0, nullptr, 1, &barrier);
+        if (m_MipLevels > 1)
+        {
+            // Even a partial base-level update invalidates the chain below
+            // it; re-deriving the whole chain on the GPU is cheaper than the
+            // bookkeeping to shrink the dirty area per level
+            GenerateMipChain(commandBuffer);
+        }
+        else
+        {
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+            vkCmdPipelineBarrier(commandBuffer,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        }
 
         m_Device->EndSingleTimeCommands(commandBuffer);
+
+        m_DirtyRects.clear();
+        m_Initialized = true;
     }
 
-    uint32_t HeightmapTexture::FindMemoryType(VulkanDevice &device, uint32_t typeFilter, VkMemoryPropertyFlags properties)
+    void HeightmapTexture::GenerateMipChain(VkCommandBuffer commandBuffer)
     {
-        VkPhysicalDeviceMemoryProperties memProperties;
-        vkGetPhysicalDeviceMemoryProperties(device.GetPhysicalDevice(), &memProperties);
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = m_Image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+        barrier.subresourceRange.levelCount = 1;
 
-        for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++)
+        int srcWidth = m_Width;
+        int srcHeight = m_Height;
+        for (uint32_t level = 1; level < m_MipLevels; level++)
         {
-            if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties)
-            {
-                return i;
-            }
+            // The freshly written level above becomes the blit source
+            barrier.subresourceRange.baseMipLevel = level - 1;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+            barrier.subresourceRange.baseMipLevel = level;
+            barrier.oldLayout = m_Initialized ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+                                              : VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcAccessMask = m_Initialized ? VK_ACCESS_SHADER_READ_BIT : 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            vkCmdPipelineBarrier(commandBuffer,
+                                 m_Initialized ? VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+                                               : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+            int dstWidth = std::max(srcWidth / 2, 1);
+            int dstHeight = std::max(srcHeight / 2, 1);
+
+            VkImageBlit blit{};
+            blit.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            blit.srcSubresource.mipLevel = level - 1;
+            blit.srcSubresource.baseArrayLayer = 0;
+            blit.srcSubresource.layerCount = 1;
+            blit.srcOffsets[1] = {srcWidth, srcHeight, 1};
+            blit.dstSubresource = blit.srcSubresource;
+            blit.dstSubresource.mipLevel = level;
+            blit.dstOffsets[1] = {dstWidth, dstHeight, 1};
+
+            vkCmdBlitImage(commandBuffer,
+                           m_Image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           m_Image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                           1, &blit, VK_FILTER_LINEAR);
+
+            // The consumed source level is done; hand it to the shaders
+            barrier.subresourceRange.baseMipLevel = level - 1;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer,
+                                 VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+            srcWidth = dstWidth;
+            srcHeight = dstHeight;
         }
 
-        GEN_ERROR("Failed to find suitable memory type!");
-        return 0;
+        // The last level was only ever a blit destination
+        barrier.subresourceRange.baseMipLevel = m_MipLevels - 1;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &barrier);
     }
 
 }
@@ -0,0 +1,648 @@
+#include "genesis/renderer/IndirectTerrainRenderer.h"
+#include "genesis/renderer/Renderer.h"
+#include "genesis/renderer/VulkanBuffer.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/renderer/VulkanPipeline.h"
+#include "genesis/core/Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace Genesis
+{
+
+    IndirectTerrainRenderer::~IndirectTerrainRenderer()
+    {
+        Shutdown();
+    }
+
+    void IndirectTerrainRenderer::Init(VulkanDevice &device, VkDescriptorSetLayout globalSetLayout,
+                                       VkRenderPass renderPass, uint32_t framesInFlight,
+                                       VkRenderPass shadowRenderPass,
+                                       VkDescriptorSetLayout materialArrayLayout)
+    {
+        m_Device = &device;
+        m_MaterialSetLayout = materialArrayLayout;
+
+        CreateMegaBuffers();
+        CreateFrameResources(framesInFlight);
+        CreatePipeline(globalSetLayout, renderPass);
+        if (shadowRenderPass != VK_NULL_HANDLE)
+        {
+            CreateShadowPipeline(globalSetLayout, shadowRenderPass);
+        }
+
+        m_PendingDraws.reserve(256);
+
+        GEN_INFO("IndirectTerrainRenderer: {} vertices / {} indices shared capacity, multiDrawIndirect {}",
+                 m_VertexCapacity, m_IndexCapacity,
+                 device.SupportsMultiDrawIndirect() ? "enabled" : "unsupported (per-draw fallback)");
+    }
+
+    void IndirectTerrainRenderer::Shutdown()
+    {
+        if (!m_Device)
+        {
+            return;
+        }
+
+        VkDevice device = m_Device->GetDevice();
+
+        if (m_ShadowPipeline)
+        {
+            m_ShadowPipeline->Shutdown();
+            m_ShadowPipeline.reset();
+        }
+
+        if (m_ShadowPipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(device, m_ShadowPipelineLayout, nullptr);
+            m_ShadowPipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_DepthPipeline)
+        {
+            m_DepthPipeline->Shutdown();
+            m_DepthPipeline.reset();
+        }
+
+        if (m_Pipeline)
+        {
+            m_Pipeline->Shutdown();
+            m_Pipeline.reset();
+        }
+
+        if (m_PipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_DescriptorPool != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorPool(device, m_DescriptorPool, nullptr);
+            m_DescriptorPool = VK_NULL_HANDLE;
+        }
+
+        if (m_TransformSetLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(device, m_TransformSetLayout, nullptr);
+            m_TransformSetLayout = VK_NULL_HANDLE;
+        }
+
+        for (auto &frame : m_Frames)
+        {
+            if (frame.transformBuffer)
+                frame.transformBuffer->Shutdown();
+            if (frame.indirectBuffer)
+                frame.indirectBuffer->Shutdown();
+        }
+        m_Frames.clear();
+
+        if (m_VertexBuffer)
+        {
+            m_VertexBuffer->Shutdown();
+            m_VertexBuffer.reset();
+        }
+        if (m_IndexBuffer)
+        {
+            m_IndexBuffer->Shutdown();
+            m_IndexBuffer.reset();
+        }
+
+        m_FreeVertexRanges.clear();
+        m_FreeIndexRanges.clear();
+        m_PendingDraws.clear();
+        m_Device = nullptr;
+    }
+
+    void IndirectTerrainRenderer::CreateMegaBuffers()
+    {
+        m_VertexCapacity = INITIAL_VERTEX_CAPACITY;
+        m_IndexCapacity = INITIAL_INDEX_CAPACITY;
+
+        // TRANSFER_SRC so contents survive a growth copy into a larger buffer.
+        // The pool stores the compact TerrainVertex format; full Vertex data
+        // is packed on the way in (see Allocate).
+        m_VertexBuffer = std::make_unique<VulkanBuffer>();
+        m_VertexBuffer->Init(*m_Device, static_cast<VkDeviceSize>(m_VertexCapacity) * sizeof(TerrainVertex),
+                             VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                                 VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        m_IndexBuffer = std::make_unique<VulkanBuffer>();
+        m_IndexBuffer->Init(*m_Device, static_cast<VkDeviceSize>(m_IndexCapacity) * sizeof(uint32_t),
+                            VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                                VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        m_FreeVertexRanges = {{0, m_VertexCapacity}};
+        m_FreeIndexRanges = {{0, m_IndexCapacity}};
+    }
+
+    void IndirectTerrainRenderer::CreateFrameResources(uint32_t framesInFlight)
+    {
+        // Transform storage set layout (set 1 of the indirect pipeline)
+        VkDescriptorSetLayoutBinding transformBinding{};
+        transformBinding.binding = 0;
+        transformBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        transformBinding.descriptorCount = 1;
+        transformBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 1;
+        layoutInfo.pBindings = &transformBinding;
+
+        if (vkCreateDescriptorSetLayout(m_Device->GetDevice(), &layoutInfo, nullptr,
+                                        &m_TransformSetLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create terrain transform set layout!");
+        }
+
+        VkDescriptorPoolSize poolSize{};
+        poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        poolSize.descriptorCount = framesInFlight;
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.poolSizeCount = 1;
+        poolInfo.pPoolSizes = &poolSize;
+        poolInfo.maxSets = framesInFlight;
+
+        if (vkCreateDescriptorPool(m_Device->GetDevice(), &poolInfo, nullptr,
+                                   &m_DescriptorPool) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create terrain transform descriptor pool!");
+        }
+
+        m_Frames.resize(framesInFlight);
+        for (auto &frame : m_Frames)
+        {
+            frame.transformBuffer = std::make_unique<VulkanBuffer>();
+            frame.transformBuffer->Init(*m_Device, MAX_DRAWS_PER_FRAME * sizeof(DrawTransform),
+                                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            frame.transformBuffer->Map();
+
+            frame.indirectBuffer = std::make_unique<VulkanBuffer>();
+            frame.indirectBuffer->Init(*m_Device,
+                                       MAX_DRAWS_PER_FRAME * sizeof(VkDrawIndexedIndirectCommand),
+                                       VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                           VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            frame.indirectBuffer->Map();
+
+            VkDescriptorSetAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocInfo.descriptorPool = m_DescriptorPool;
+            allocInfo.descriptorSetCount = 1;
+            allocInfo.pSetLayouts = &m_TransformSetLayout;
+
+            if (vkAllocateDescriptorSets(m_Device->GetDevice(), &allocInfo,
+                                         &frame.transformSet) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to allocate terrain transform descriptor set!");
+            }
+
+            VkDescriptorBufferInfo bufferInfo = frame.transformBuffer->GetDescriptorInfo();
+
+            VkWriteDescriptorSet write{};
+            write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write.dstSet = frame.transformSet;
+            write.dstBinding = 0;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            write.descriptorCount = 1;
+            write.pBufferInfo = &bufferInfo;
+
+            vkUpdateDescriptorSets(m_Device->GetDevice(), 1, &write, 0, nullptr);
+        }
+    }
+
+    void IndirectTerrainRenderer::CreatePipeline(VkDescriptorSetLayout globalSetLayout,
+                                                 VkRenderPass renderPass)
+    {
+        // Set 2 is the bindless material texture array; left out of the
+        // layout entirely when the device could not enable it
+        VkDescriptorSetLayout setLayouts[] = {globalSetLayout, m_TransformSetLayout,
+                                              m_MaterialSetLayout};
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = m_MaterialSetLayout != VK_NULL_HANDLE ? 3 : 2;
+        pipelineLayoutInfo.pSetLayouts = setLayouts;
+
+        if (vkCreatePipelineLayout(m_Device->GetDevice(), &pipelineLayoutInfo, nullptr,
+                                   &m_PipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create terrain indirect pipeline layout!");
+        }
+
+        PipelineConfig config{};
+        VulkanPipeline::DefaultPipelineConfig(config);
+        config.RenderPass = renderPass;
+        config.PipelineLayout = m_PipelineLayout;
+
+        // The pool stores the compact TerrainVertex format
+        config.VertexBindings = TerrainVertex::GetBindingDescriptions();
+        config.VertexAttributes = TerrainVertex::GetAttributeDescriptions();
+
+        // LESS_OR_EQUAL so the shading pass passes the depth test against
+        // its own pre-pass depth; behaves like LESS when the pre-pass is off
+        config.DepthStencilState.depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
+
+        m_Pipeline = std::make_unique<VulkanPipeline>();
+        // Flat fragment variant: terrain meshes carry per-face normals and
+        // colors on the provoking vertex of each triangle
+        m_Pipeline->Init(*m_Device, "assets/shaders/lowpoly_indirect.vert.spv",
+                         "assets/shaders/lowpoly_flat.frag.spv", config);
+
+        PipelineConfig depthConfig{};
+        VulkanPipeline::DepthOnlyPipelineConfig(depthConfig);
+        depthConfig.RenderPass = renderPass;
+        depthConfig.PipelineLayout = m_PipelineLayout;
+        depthConfig.VertexBindings = TerrainVertex::GetBindingDescriptions();
+        depthConfig.VertexAttributes = TerrainVertex::GetAttributeDescriptions();
+
+        m_DepthPipeline = std::make_unique<VulkanPipeline>();
+        m_DepthPipeline->InitDepthOnly(*m_Device, "assets/shaders/lowpoly_indirect_depth.vert.spv",
+                                       depthConfig);
+    }
+
+    void IndirectTerrainRenderer::CreateShadowPipeline(VkDescriptorSetLayout globalSetLayout,
+                                                       VkRenderPass shadowRenderPass)
+    {
+        // Same set layouts as the main layout so this frame's transform set
+        // binds unchanged, plus the cascade's light matrix as a push constant
+        VkDescriptorSetLayout setLayouts[] = {globalSetLayout, m_TransformSetLayout};
+
+        VkPushConstantRange pushConstantRange{};
+        pushConstantRange.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        pushConstantRange.offset = 0;
+        pushConstantRange.size = sizeof(glm::mat4);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 2;
+        pipelineLayoutInfo.pSetLayouts = setLayouts;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+        if (vkCreatePipelineLayout(m_Device->GetDevice(), &pipelineLayoutInfo, nullptr,
+                                   &m_ShadowPipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create terrain shadow pipeline layout!");
+        }
+
+        PipelineConfig config{};
+        VulkanPipeline::ShadowPipelineConfig(config);
+        config.RenderPass = shadowRenderPass;
+        config.PipelineLayout = m_ShadowPipelineLayout;
+        config.VertexBindings = TerrainVertex::GetBindingDescriptions();
+        config.VertexAttributes = TerrainVertex::GetAttributeDescriptions();
+
+        m_ShadowPipeline = std::make_unique<VulkanPipeline>();
+        m_ShadowPipeline->InitDepthOnly(*m_Device, "assets/shaders/lowpoly_indirect_shadow.vert.spv",
+                                        config);
+    }
+
+    TerrainMeshAllocation IndirectTerrainRenderer::Allocate(const std::vector<Vertex> &vertices,
+                                                            const std::vector<uint32_t> &indices)
+    {
+        TerrainMeshAllocation allocation;
+
+        if (!m_Device || vertices.empty() || indices.empty())
+        {
+            return allocation;
+        }
+
+        uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+        uint32_t indexCount = static_cast<uint32_t>(indices.size());
+
+        uint32_t vertexOffset = 0;
+        if (!AllocateRange(m_FreeVertexRanges, vertexCount, vertexOffset))
+        {
+            GrowBuffer(m_VertexBuffer, m_VertexCapacity, vertexCount, sizeof(TerrainVertex),
+                       VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, m_FreeVertexRanges);
+            if (!AllocateRange(m_FreeVertexRanges, vertexCount, vertexOffset))
+            {
+                GEN_WARN("IndirectTerrainRenderer: vertex pool cannot place {} vertices", vertexCount);
+                return allocation;
+            }
+        }
+
+        uint32_t firstIndex = 0;
+        if (!AllocateRange(m_FreeIndexRanges, indexCount, firstIndex))
+        {
+            GrowBuffer(m_IndexBuffer, m_IndexCapacity, indexCount, sizeof(uint32_t),
+                       VK_BUFFER_USAGE_INDEX_BUFFER_BIT, m_FreeIndexRanges);
+            if (!AllocateRange(m_FreeIndexRanges, indexCount, firstIndex))
+            {
+                ReleaseRange(m_FreeVertexRanges, vertexOffset, vertexCount);
+                GEN_WARN("IndirectTerrainRenderer: index pool cannot place {} indices", indexCount);
+                return allocation;
+            }
+        }
+
+        // Quantize into the compact terrain format on the way into the pool
+        std::vector<TerrainVertex> packed;
+        packed.reserve(vertices.size());
+        for (const Vertex &vertex : vertices)
+        {
+            packed.push_back(TerrainVertex::Pack(vertex));
+        }
+
+        m_Device->StageToBuffer(packed.data(),
+                                static_cast<VkDeviceSize>(vertexCount) * sizeof(TerrainVertex),
+                                m_VertexBuffer->GetBuffer(),
+                                static_cast<VkDeviceSize>(vertexOffset) * sizeof(TerrainVertex));
+        m_Device->StageToBuffer(indices.data(),
+                                static_cast<VkDeviceSize>(indexCount) * sizeof(uint32_t),
+                                m_IndexBuffer->GetBuffer(),
+                                static_cast<VkDeviceSize>(firstIndex) * sizeof(uint32_t));
+
+        allocation.firstIndex = firstIndex;
+        allocation.indexCount = indexCount;
+        allocation.vertexOffset = static_cast<int32_t>(vertexOffset);
+        allocation.vertexCount = vertexCount;
+        m_GeometryVersion++;
+        return allocation;
+    }
+
+    void IndirectTerrainRenderer::Free(const TerrainMeshAllocation &allocation)
+    {
+        if (!allocation.IsValid())
+        {
+            return;
+        }
+
+        ReleaseRange(m_FreeVertexRanges, static_cast<uint32_t>(allocation.vertexOffset),
+                     allocation.vertexCount);
+        ReleaseRange(m_FreeIndexRanges, allocation.firstIndex, allocation.indexCount);
+        m_GeometryVersion++;
+    }
+
+    void IndirectTerrainRenderer::BeginFrame()
+    {
+        m_PendingDraws.clear();
+        m_FrameDrawOffset = 0;
+    }
+
+    VkBuffer IndirectTerrainRenderer::GetPoolVertexBuffer() const
+    {
+        return m_VertexBuffer ? m_VertexBuffer->GetBuffer() : VK_NULL_HANDLE;
+    }
+
+    VkBuffer IndirectTerrainRenderer::GetPoolIndexBuffer() const
+    {
+        return m_IndexBuffer ? m_IndexBuffer->GetBuffer() : VK_NULL_HANDLE;
+    }
+
+    void IndirectTerrainRenderer::Submit(const TerrainMeshAllocation &allocation,
+                                         const glm::mat4 &transform)
+    {
+        if (!allocation.IsValid())
+        {
+            return;
+        }
+
+        if (m_FrameDrawOffset + m_PendingDraws.size() >= MAX_DRAWS_PER_FRAME)
+        {
+            GEN_WARN("IndirectTerrainRenderer: draw budget of {} exceeded, dropping draw",
+                     MAX_DRAWS_PER_FRAME);
+            return;
+        }
+
+        PendingDraw draw;
+        draw.allocation = allocation;
+        draw.transform.ModelMatrix = transform;
+        draw.transform.NormalMatrix = glm::transpose(glm::inverse(transform));
+        m_PendingDraws.push_back(draw);
+    }
+
+    void IndirectTerrainRenderer::Flush(VkCommandBuffer commandBuffer, VkDescriptorSet globalSet,
+                                        uint32_t frameIndex, RenderStats &stats)
+    {
+        if (m_PendingDraws.empty())
+        {
+            return;
+        }
+
+        FrameResources &frame = m_Frames[frameIndex];
+        uint32_t drawCount = static_cast<uint32_t>(m_PendingDraws.size());
+
+        auto *transforms = static_cast<DrawTransform *>(frame.transformBuffer->GetMappedMemory());
+        auto *commands = static_cast<VkDrawIndexedIndirectCommand *>(frame.indirectBuffer->GetMappedMemory());
+
+        for (uint32_t i = 0; i < drawCount; i++)
+        {
+            const PendingDraw &draw = m_PendingDraws[i];
+            uint32_t slot = m_FrameDrawOffset + i;
+
+            transforms[slot] = draw.transform;
+
+            VkDrawIndexedIndirectCommand &cmd = commands[slot];
+            cmd.indexCount = draw.allocation.indexCount;
+            cmd.instanceCount = 1;
+            cmd.firstIndex = draw.allocation.firstIndex;
+            cmd.vertexOffset = draw.allocation.vertexOffset;
+            // Carries the draw slot into gl_InstanceIndex for the transform fetch
+            cmd.firstInstance = slot;
+
+            stats.TriangleCount += draw.allocation.indexCount / 3;
+        }
+
+        VkDescriptorSet sets[] = {globalSet, frame.transformSet};
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout,
+                                0, 2, sets, 0, nullptr);
+        if (m_MaterialSetLayout != VK_NULL_HANDLE && m_MaterialSet != VK_NULL_HANDLE)
+        {
+            // One bind covers every material for the whole batch
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                    m_PipelineLayout, 2, 1, &m_MaterialSet, 0, nullptr);
+        }
+
+        VkBuffer vertexBuffers[] = {m_VertexBuffer->GetBuffer()};
+        VkDeviceSize offsets[] = {0};
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(commandBuffer, m_IndexBuffer->GetBuffer(), 0, VK_INDEX_TYPE_UINT32);
+
+        VkDeviceSize commandOffset = static_cast<VkDeviceSize>(m_FrameDrawOffset) *
+                                     sizeof(VkDrawIndexedIndirectCommand);
+
+        auto recordDraws = [&]()
+        {
+            if (m_Device->SupportsMultiDrawIndirect())
+            {
+                vkCmdDrawIndexedIndirect(commandBuffer, frame.indirectBuffer->GetBuffer(),
+                                         commandOffset, drawCount,
+                                         sizeof(VkDrawIndexedIndirectCommand));
+            }
+            else
+            {
+                // drawCount > 1 needs the multiDrawIndirect feature; fall back to
+                // one indirect call per draw (still no pipeline/buffer rebinds)
+                for (uint32_t i = 0; i < drawCount; i++)
+                {
+                    vkCmdDrawIndexedIndirect(commandBuffer, frame.indirectBuffer->GetBuffer(),
+                                             commandOffset + i * sizeof(VkDrawIndexedIndirectCommand),
+                                             1, sizeof(VkDrawIndexedIndirectCommand));
+                }
+            }
+            stats.DrawCalls++;
+        };
+
+        // Depth pre-pass: rasterize the batch position-only first so the
+        // shading pass below only passes the depth test on the nearest
+        // surface per pixel (LESS_OR_EQUAL against its own depth)
+        if (m_DepthPrePass)
+        {
+            m_DepthPipeline->Bind(commandBuffer);
+            recordDraws();
+        }
+
+        m_Pipeline->Bind(commandBuffer);
+        recordDraws();
+
+        m_FrameDrawOffset += drawCount;
+        m_PendingDraws.clear();
+    }
+
+    void IndirectTerrainRenderer::FlushShadows(VkCommandBuffer commandBuffer,
+                                               VkDescriptorSet globalSet, uint32_t frameIndex,
+                                               const glm::mat4 &lightViewProj, RenderStats &stats)
+    {
+        if (!m_ShadowPipeline || m_FrameDrawOffset == 0)
+        {
+            return;
+        }
+
+        FrameResources &frame = m_Frames[frameIndex];
+
+        m_ShadowPipeline->Bind(commandBuffer);
+
+        VkDescriptorSet sets[] = {globalSet, frame.transformSet};
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                m_ShadowPipelineLayout, 0, 2, sets, 0, nullptr);
+        vkCmdPushConstants(commandBuffer, m_ShadowPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                           sizeof(glm::mat4), &lightViewProj);
+
+        VkBuffer vertexBuffers[] = {m_VertexBuffer->GetBuffer()};
+        VkDeviceSize offsets[] = {0};
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
+        vkCmdBindIndexBuffer(commandBuffer, m_IndexBuffer->GetBuffer(), 0, VK_INDEX_TYPE_UINT32);
+
+        // Re-issue everything the main pass flushed this frame from slot 0;
+        // firstInstance already carries each command's transform slot
+        if (m_Device->SupportsMultiDrawIndirect())
+        {
+            vkCmdDrawIndexedIndirect(commandBuffer, frame.indirectBuffer->GetBuffer(), 0,
+                                     m_FrameDrawOffset, sizeof(VkDrawIndexedIndirectCommand));
+        }
+        else
+        {
+            for (uint32_t i = 0; i < m_FrameDrawOffset; i++)
+            {
+                vkCmdDrawIndexedIndirect(commandBuffer, frame.indirectBuffer->GetBuffer(),
+                                         i * sizeof(VkDrawIndexedIndirectCommand), 1,
+                                         sizeof(VkDrawIndexedIndirectCommand));
+            }
+        }
+        stats.DrawCalls++;
+    }
+
+    bool IndirectTerrainRenderer::AllocateRange(std::vector<FreeRange> &freeList, uint32_t count,
+                                                uint32_t &offset)
+    {
+        for (size_t i = 0; i < freeList.size(); i++)
+        {
+            if (freeList[i].count >= count)
+            {
+                offset = freeList[i].offset;
+                freeList[i].offset += count;
+                freeList[i].count -= count;
+                if (freeList[i].count == 0)
+                {
+                    freeList.erase(freeList.begin() + i);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void IndirectTerrainRenderer::ReleaseRange(std::vector<FreeRange> &freeList, uint32_t offset,
+                                               uint32_t count)
+    {
+        // Keep the list sorted by offset and merge with both neighbours
+        auto it = std::lower_bound(freeList.begin(), freeList.end(), offset,
+                                   [](const FreeRange &range, uint32_t value)
+                                   {
+                                       return range.offset < value;
+                                   });
+        it = freeList.insert(it, {offset, count});
+
+        if (it != freeList.begin())
+        {
+            auto prev = it - 1;
+            if (prev->offset + prev->count == it->offset)
+            {
+                prev->count += it->count;
+                it = freeList.erase(it) - 1;
+            }
+        }
+
+        auto next = it + 1;
+        if (next != freeList.end() && it->offset + it->count == next->offset)
+        {
+            it->count += next->count;
+            freeList.erase(next);
+        }
+    }
+
+    void IndirectTerrainRenderer::GrowBuffer(std::unique_ptr<VulkanBuffer> &buffer,
+                                             uint32_t &capacity, uint32_t requiredCount,
+                                             uint32_t elementSize, VkBufferUsageFlags usage,
+                                             std::vector<FreeRange> &freeList)
+    {
+        uint32_t newCapacity = capacity;
+        while (newCapacity - capacity < requiredCount)
+        {
+            newCapacity *= 2;
+        }
+
+        GEN_INFO("IndirectTerrainRenderer: growing shared buffer from {} to {} elements",
+                 capacity, newCapacity);
+
+        auto newBuffer = std::make_unique<VulkanBuffer>();
+        newBuffer->Init(*m_Device, static_cast<VkDeviceSize>(newCapacity) * elementSize,
+                        usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+        // An open transfer batch may hold copies recorded against the old
+        // buffer handle; submit them before it is destroyed
+        uint64_t flushedBatch = m_Device->EndTransferBatch();
+
+        // The old buffer may still be referenced by in-flight frames
+        m_Device->WaitIdle();
+        m_Device->WaitForTransfers();
+
+        VulkanBuffer::CopyBuffer(*m_Device, buffer->GetBuffer(), newBuffer->GetBuffer(),
+                                 static_cast<VkDeviceSize>(capacity) * elementSize);
+
+        buffer->Shutdown();
+        buffer = std::move(newBuffer);
+
+        ReleaseRange(freeList, capacity, newCapacity - capacity);
+        capacity = newCapacity;
+
+        // Restore the caller's batch so subsequent stages keep recording
+        if (flushedBatch != 0)
+        {
+            m_Device->BeginTransferBatch();
+        }
+    }
+
+}
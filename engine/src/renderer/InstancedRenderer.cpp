@@ -1,14 +1,25 @@
 #include "genesis/renderer/InstancedRenderer.h"
 #include "genesis/renderer/VulkanDevice.h"
 #include "genesis/renderer/VulkanBuffer.h"
+#include "genesis/renderer/VulkanPipeline.h"
+#include "genesis/renderer/Renderer.h"
 #include "genesis/core/Log.h"
 #include <glm/glm.hpp>
 #include <random>
 #include <cmath>
+#include <stdexcept>
 
 namespace
 {
     constexpr float TWO_PI = 6.28318530717958647692f;
+
+    // Must match the CullData push constant block in vegetation_cull.comp
+    struct CullPushConstants
+    {
+        glm::vec4 FrustumPlanes[6];
+        glm::vec4 CameraPositionAndMaxDistance; // xyz = camera, w = max distance (0 = unlimited)
+        glm::vec4 RadiusAndCount;               // x = bounding radius, y = instance count
+    };
 }
 
 namespace Genesis
@@ -54,92 +65,101 @@ namespace Genesis
         Shutdown();
     }
 
-    void InstancedRenderer::Init(VulkanDevice &device, VkDescriptorSetLayout descriptorSetLayout,
-                                 VkRenderPass renderPass)
+    void InstancedRenderer::Init(VulkanDevice &device, VkDescriptorSetLayout globalSetLayout,
+                                 VkRenderPass renderPass, uint32_t framesInFlight)
     {
         m_Device = &device;
-        CreateInstanceBuffer();
-        // Note: Pipeline creation would require instanced shader variants
-        // For now, we'll use the standard pipeline with manual instance handling
+        m_FramesInFlight = framesInFlight;
+
+        CreatePipeline(globalSetLayout, renderPass);
+        CreateCullResources();
+
+        GEN_INFO("Instanced renderer initialized ({} frames in flight)", framesInFlight);
     }
 
     void InstancedRenderer::Shutdown()
     {
-        if (m_Device)
+        if (!m_Device)
+        {
+            return;
+        }
+
+        VkDevice device = m_Device->GetDevice();
+
+        for (auto &batch : m_Batches)
         {
-            if (m_Pipeline != VK_NULL_HANDLE)
+            for (auto &buffer : batch.buffers)
             {
-                vkDestroyPipeline(m_Device->GetDevice(), m_Pipeline, nullptr);
-                m_Pipeline = VK_NULL_HANDLE;
+                if (buffer)
+                {
+                    buffer->Shutdown();
+                }
             }
-
-            if (m_InstanceBuffer)
+            for (auto &buffer : batch.visibleBuffers)
             {
-                m_InstanceBuffer->Shutdown();
-                m_InstanceBuffer.reset();
+                if (buffer)
+                {
+                    buffer->Shutdown();
+                }
+            }
+            for (auto &buffer : batch.indirectBuffers)
+            {
+                if (buffer)
+                {
+                    buffer->Shutdown();
+                }
             }
-
-            m_Device = nullptr;
         }
-
         m_Batches.clear();
-        m_AllInstances.clear();
-    }
 
-    void InstancedRenderer::BeginFrame()
-    {
-        m_Batches.clear();
-        m_AllInstances.clear();
-    }
+        if (m_CullPipeline)
+        {
+            m_CullPipeline->Shutdown();
+            m_CullPipeline.reset();
+        }
 
-    void InstancedRenderer::AddInstances(Mesh *mesh,
-                                         const std::vector<glm::vec3> &positions,
-                                         float scale)
-    {
-        if (!mesh || positions.empty())
+        if (m_CullPipelineLayout != VK_NULL_HANDLE)
         {
-            return;
+            vkDestroyPipelineLayout(device, m_CullPipelineLayout, nullptr);
+            m_CullPipelineLayout = VK_NULL_HANDLE;
         }
 
-        // Find or create batch for this mesh
-        InstanceBatch *batch = nullptr;
-        for (auto &b : m_Batches)
+        if (m_CullDescriptorPool != VK_NULL_HANDLE)
         {
-            if (b.mesh == mesh)
-            {
-                batch = &b;
-                break;
-            }
+            vkDestroyDescriptorPool(device, m_CullDescriptorPool, nullptr);
+            m_CullDescriptorPool = VK_NULL_HANDLE;
         }
 
-        if (!batch)
+        if (m_CullSetLayout != VK_NULL_HANDLE)
         {
-            m_Batches.emplace_back();
-            batch = &m_Batches.back();
-            batch->mesh = mesh;
+            vkDestroyDescriptorSetLayout(device, m_CullSetLayout, nullptr);
+            m_CullSetLayout = VK_NULL_HANDLE;
+        }
+
+        if (m_Pipeline)
+        {
+            m_Pipeline->Shutdown();
+            m_Pipeline.reset();
         }
 
-        // Add instances
-        for (const auto &pos : positions)
+        if (m_PipelineLayout != VK_NULL_HANDLE)
         {
-            InstanceData instance;
-            instance.PositionAndScale = glm::vec4(pos, scale);
-            instance.RotationAndTint = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
-            batch->instances.push_back(instance);
+            vkDestroyPipelineLayout(device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
         }
 
-        batch->instanceCount = static_cast<uint32_t>(batch->instances.size());
+        m_CullValid = false;
+        m_Device = nullptr;
     }
 
-    void InstancedRenderer::AddInstances(Mesh *mesh,
-                                         const std::vector<InstanceData> &instances)
+    void InstancedRenderer::SetInstances(Mesh *mesh, const std::vector<InstanceData> &instances)
     {
-        if (!mesh || instances.empty())
+        if (!mesh)
         {
             return;
         }
 
-        // Find or create batch for this mesh
+        // Find or create the persistent batch for this mesh
         InstanceBatch *batch = nullptr;
         for (auto &b : m_Batches)
         {
@@ -152,87 +172,170 @@ namespace Genesis
 
         if (!batch)
         {
+            if (m_Batches.size() >= MAX_BATCHES)
+            {
+                GEN_WARN("Instance batch limit ({}) reached; mesh ignored", MAX_BATCHES);
+                return;
+            }
+
             m_Batches.emplace_back();
             batch = &m_Batches.back();
             batch->mesh = mesh;
+            batch->buffers.resize(m_FramesInFlight);
+            batch->visibleBuffers.resize(m_FramesInFlight);
+            batch->indirectBuffers.resize(m_FramesInFlight);
+            batch->cullSets.resize(m_FramesInFlight, VK_NULL_HANDLE);
+            batch->capacities.resize(m_FramesInFlight, 0);
+
+            // Conservative bounding sphere for the cull tests, derived from
+            // the bounds the mesh captured at upload - no CPU vertices needed
+            float radius = mesh->GetBoundingRadius();
+            batch->boundingRadius = radius > 0.0f ? radius : 1.0f;
         }
 
-        batch->instances.insert(batch->instances.end(), instances.begin(), instances.end());
-        batch->instanceCount = static_cast<uint32_t>(batch->instances.size());
+        batch->instances = instances;
+        if (batch->instances.size() > MAX_INSTANCES)
+        {
+            GEN_WARN("Instance batch exceeds {} instances ({}); truncating",
+                     MAX_INSTANCES, batch->instances.size());
+            batch->instances.resize(MAX_INSTANCES);
+        }
+
+        // Every frame-in-flight buffer is now stale
+        batch->dirtyMask = (1u << m_FramesInFlight) - 1;
     }
 
-    void InstancedRenderer::UploadInstances()
+    void InstancedRenderer::SetCullCamera(const glm::vec3 &position, const glm::mat4 &viewProjection)
     {
-        // Collect all instances
-        m_AllInstances.clear();
-        for (const auto &batch : m_Batches)
-        {
-            m_AllInstances.insert(m_AllInstances.end(),
-                                  batch.instances.begin(),
-                                  batch.instances.end());
-        }
+        m_CullCameraPosition = position;
+        m_CullFrustum = Frustum::FromViewProjection(viewProjection);
+        m_CullValid = true;
+    }
 
-        if (m_AllInstances.empty() || !m_InstanceBuffer)
+    void InstancedRenderer::RecordCull(VkCommandBuffer commandBuffer, uint32_t frameIndex)
+    {
+        if (!m_Device || m_Batches.empty())
         {
             return;
         }
 
-        // Resize buffer if needed
-        size_t requiredSize = m_AllInstances.size() * sizeof(InstanceData);
-        if (requiredSize > m_InstanceBufferCapacity)
+        bool dispatched = false;
+
+        for (auto &batch : m_Batches)
         {
-            m_InstanceBuffer->Shutdown();
+            if (!batch.mesh || batch.instances.empty())
+            {
+                continue;
+            }
+
+            EnsureBatchResources(batch, frameIndex);
 
-            size_t newCapacity = std::max(requiredSize, m_InstanceBufferCapacity * 2);
-            newCapacity = std::min(newCapacity, MAX_INSTANCES * sizeof(InstanceData));
+            // This slot's fence was waited on at BeginFrame, so its buffers
+            // are safe to rewrite here
+            if (batch.dirtyMask & (1u << frameIndex))
+            {
+                UploadBatch(batch, frameIndex);
+                batch.dirtyMask &= ~(1u << frameIndex);
+            }
+
+            // Reset the indirect command; the dispatch fills instanceCount
+            VkDrawIndexedIndirectCommand command{};
+            command.indexCount = batch.mesh->GetIndexCount();
+            batch.indirectBuffers[frameIndex]->WriteToBuffer(&command, sizeof(command));
+
+            if (!dispatched)
+            {
+                m_CullPipeline->Bind(commandBuffer);
+                dispatched = true;
+            }
 
-            m_InstanceBuffer->Init(*m_Device, newCapacity,
-                                   VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-            m_InstanceBuffer->Map();
-            m_InstanceBufferCapacity = newCapacity;
+            CullPushConstants push{};
+            if (m_CullValid)
+            {
+                for (int i = 0; i < 6; i++)
+                {
+                    push.FrustumPlanes[i] = m_CullFrustum.Planes[i];
+                }
+            }
+            else
+            {
+                // No camera yet: planes that accept every position
+                for (auto &plane : push.FrustumPlanes)
+                {
+                    plane = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+                }
+            }
+            push.CameraPositionAndMaxDistance = glm::vec4(m_CullCameraPosition,
+                                                          m_CullValid ? m_MaxDrawDistance : 0.0f);
+            push.RadiusAndCount = glm::vec4(batch.boundingRadius,
+                                            static_cast<float>(batch.instances.size()),
+                                            0.0f, 0.0f);
+
+            vkCmdPushConstants(commandBuffer, m_CullPipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT,
+                               0, sizeof(CullPushConstants), &push);
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                    m_CullPipelineLayout, 0, 1, &batch.cullSets[frameIndex],
+                                    0, nullptr);
+
+            uint32_t groups = (static_cast<uint32_t>(batch.instances.size()) +
+                               CULL_WORKGROUP_SIZE - 1) / CULL_WORKGROUP_SIZE;
+            vkCmdDispatch(commandBuffer, groups, 1, 1);
         }
 
-        // Upload data
-        m_InstanceBuffer->WriteToBuffer(m_AllInstances.data(), requiredSize);
+        if (dispatched)
+        {
+            // The indirect draws consume the compacted instances and the
+            // draw command the dispatches just wrote
+            VkMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+                                    VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                 VK_PIPELINE_STAGE_VERTEX_INPUT_BIT |
+                                     VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+                                 0, 1, &barrier, 0, nullptr, 0, nullptr);
+        }
     }
 
-    void InstancedRenderer::Draw(VkCommandBuffer commandBuffer,
-                                 VkDescriptorSet descriptorSet,
-                                 VkPipelineLayout pipelineLayout)
+    void InstancedRenderer::Draw(VkCommandBuffer commandBuffer, VkDescriptorSet globalSet,
+                                 uint32_t frameIndex, RenderStats &stats)
     {
-        if (m_AllInstances.empty() || !m_InstanceBuffer)
+        if (!m_Device || m_Batches.empty())
         {
             return;
         }
 
-        // Note: For true instanced rendering, we would:
-        // 1. Bind the instance buffer as vertex buffer binding 1
-        // 2. Use vkCmdDrawIndexedInstanced with instance count
-        // This requires shader support for instance attributes
+        bool pipelineBound = false;
 
-        // Current implementation: draw each instance separately
-        // (inefficient but works with existing shaders)
-        size_t instanceOffset = 0;
-        for (const auto &batch : m_Batches)
+        for (auto &batch : m_Batches)
         {
-            if (!batch.mesh || batch.instances.empty())
+            if (!batch.mesh || batch.instances.empty() || !batch.visibleBuffers[frameIndex])
             {
                 continue;
             }
 
-            // For each instance, we would normally use push constants
-            // to set the transform. This is a placeholder for full instancing.
-            batch.mesh->Bind(commandBuffer);
-
-            for (const auto &instance : batch.instances)
+            if (!pipelineBound)
             {
-                // In a full implementation, this would be a single
-                // vkCmdDrawIndexed with instanceCount = batch.instanceCount
-                batch.mesh->Draw(commandBuffer);
+                m_Pipeline->Bind(commandBuffer);
+                vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                        m_PipelineLayout, 0, 1, &globalSet, 0, nullptr);
+                pipelineBound = true;
             }
 
-            instanceOffset += batch.instances.size();
+            VkBuffer instanceBuffer = batch.visibleBuffers[frameIndex]->GetBuffer();
+            VkDeviceSize offset = 0;
+            vkCmdBindVertexBuffers(commandBuffer, 1, 1, &instanceBuffer, &offset);
+
+            batch.mesh->Bind(commandBuffer);
+            vkCmdDrawIndexedIndirect(commandBuffer, batch.indirectBuffers[frameIndex]->GetBuffer(),
+                                     0, 1, sizeof(VkDrawIndexedIndirectCommand));
+
+            // Triangle count uses the pre-cull instance count; the survivor
+            // count only exists on the GPU
+            stats.DrawCalls++;
+            stats.TriangleCount += batch.mesh->GetIndexCount() / 3 *
+                                   static_cast<uint32_t>(batch.instances.size());
         }
     }
 
@@ -241,29 +344,224 @@ namespace Genesis
         uint32_t total = 0;
         for (const auto &batch : m_Batches)
         {
-            total += batch.instanceCount;
+            total += static_cast<uint32_t>(batch.instances.size());
         }
         return total;
     }
 
-    void InstancedRenderer::CreateInstanceBuffer()
+    uint32_t InstancedRenderer::GetDrawCallCount() const
     {
-        m_InstanceBuffer = std::make_unique<VulkanBuffer>();
-
-        VkDeviceSize bufferSize = INITIAL_INSTANCE_CAPACITY * sizeof(InstanceData);
-        m_InstanceBuffer->Init(*m_Device, bufferSize,
-                               VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-        m_InstanceBuffer->Map();
-        m_InstanceBufferCapacity = bufferSize;
+        uint32_t count = 0;
+        for (const auto &batch : m_Batches)
+        {
+            if (batch.mesh && !batch.instances.empty())
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    void InstancedRenderer::UploadBatch(InstanceBatch &batch, uint32_t frameIndex)
+    {
+        batch.buffers[frameIndex]->WriteToBuffer(batch.instances.data(),
+                                                 batch.instances.size() * sizeof(InstanceData));
+    }
+
+    void InstancedRenderer::EnsureBatchResources(InstanceBatch &batch, uint32_t frameIndex)
+    {
+        bool needsDescriptorUpdate = false;
+
+        if (!batch.indirectBuffers[frameIndex])
+        {
+            batch.indirectBuffers[frameIndex] = std::make_unique<VulkanBuffer>();
+            batch.indirectBuffers[frameIndex]->Init(
+                *m_Device, sizeof(VkDrawIndexedIndirectCommand),
+                VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            batch.indirectBuffers[frameIndex]->Map();
+            needsDescriptorUpdate = true;
+        }
+
+        if (batch.instances.size() > batch.capacities[frameIndex])
+        {
+            size_t newCapacity = std::max(batch.capacities[frameIndex] * 2,
+                                          INITIAL_INSTANCE_CAPACITY);
+            newCapacity = std::max(newCapacity, batch.instances.size());
+            newCapacity = std::min(newCapacity, MAX_INSTANCES);
+
+            if (batch.buffers[frameIndex])
+            {
+                batch.buffers[frameIndex]->Shutdown();
+            }
+            else
+            {
+                batch.buffers[frameIndex] = std::make_unique<VulkanBuffer>();
+            }
+
+            // Source instances: written by the CPU, read by the cull pass
+            batch.buffers[frameIndex]->Init(*m_Device, newCapacity * sizeof(InstanceData),
+                                            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            batch.buffers[frameIndex]->Map();
+
+            if (batch.visibleBuffers[frameIndex])
+            {
+                batch.visibleBuffers[frameIndex]->Shutdown();
+            }
+            else
+            {
+                batch.visibleBuffers[frameIndex] = std::make_unique<VulkanBuffer>();
+            }
+
+            // Survivors: written by the cull pass, read as instance attributes
+            batch.visibleBuffers[frameIndex]->Init(
+                *m_Device, newCapacity * sizeof(InstanceData),
+                VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+            batch.capacities[frameIndex] = newCapacity;
+            needsDescriptorUpdate = true;
+        }
+
+        if (batch.cullSets[frameIndex] == VK_NULL_HANDLE)
+        {
+            VkDescriptorSetAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocInfo.descriptorPool = m_CullDescriptorPool;
+            allocInfo.descriptorSetCount = 1;
+            allocInfo.pSetLayouts = &m_CullSetLayout;
+
+            if (vkAllocateDescriptorSets(m_Device->GetDevice(), &allocInfo,
+                                         &batch.cullSets[frameIndex]) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to allocate cull descriptor set!");
+            }
+            needsDescriptorUpdate = true;
+        }
+
+        if (needsDescriptorUpdate)
+        {
+            VkDescriptorBufferInfo bufferInfos[3]{};
+            bufferInfos[0].buffer = batch.buffers[frameIndex]->GetBuffer();
+            bufferInfos[0].range = VK_WHOLE_SIZE;
+            bufferInfos[1].buffer = batch.visibleBuffers[frameIndex]->GetBuffer();
+            bufferInfos[1].range = VK_WHOLE_SIZE;
+            bufferInfos[2].buffer = batch.indirectBuffers[frameIndex]->GetBuffer();
+            bufferInfos[2].range = VK_WHOLE_SIZE;
+
+            VkWriteDescriptorSet writes[3]{};
+            for (uint32_t i = 0; i < 3; i++)
+            {
+                writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+                writes[i].dstSet = batch.cullSets[frameIndex];
+                writes[i].dstBinding = i;
+                writes[i].descriptorCount = 1;
+                writes[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                writes[i].pBufferInfo = &bufferInfos[i];
+            }
+
+            vkUpdateDescriptorSets(m_Device->GetDevice(), 3, writes, 0, nullptr);
+        }
     }
 
-    void InstancedRenderer::CreatePipeline(VkDescriptorSetLayout descriptorSetLayout,
+    void InstancedRenderer::CreatePipeline(VkDescriptorSetLayout globalSetLayout,
                                            VkRenderPass renderPass)
     {
-        // Pipeline creation for instanced rendering would go here
-        // This requires instanced vertex shader variants
-        // For now, we use the standard pipeline
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &globalSetLayout;
+
+        if (vkCreatePipelineLayout(m_Device->GetDevice(), &pipelineLayoutInfo, nullptr,
+                                   &m_PipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create instanced pipeline layout!");
+        }
+
+        PipelineConfig config{};
+        VulkanPipeline::DefaultPipelineConfig(config);
+        config.RenderPass = renderPass;
+        config.PipelineLayout = m_PipelineLayout;
+
+        // Vertex data at binding 0, per-instance data at binding 1
+        config.VertexBindings = Vertex::GetBindingDescriptions();
+        config.VertexAttributes = Vertex::GetAttributeDescriptions();
+
+        auto instanceBindings = InstanceData::GetBindingDescription();
+        auto instanceAttributes = InstanceData::GetAttributeDescriptions();
+        config.VertexBindings.insert(config.VertexBindings.end(),
+                                     instanceBindings.begin(), instanceBindings.end());
+        config.VertexAttributes.insert(config.VertexAttributes.end(),
+                                       instanceAttributes.begin(), instanceAttributes.end());
+
+        m_Pipeline = std::make_unique<VulkanPipeline>();
+        m_Pipeline->Init(*m_Device, "assets/shaders/lowpoly_instanced.vert.spv",
+                         "assets/shaders/lowpoly.frag.spv", config);
+    }
+
+    void InstancedRenderer::CreateCullResources()
+    {
+        VkDevice device = m_Device->GetDevice();
+
+        // Set 0: source instances, visible instances, indirect command
+        VkDescriptorSetLayoutBinding bindings[3]{};
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            bindings[i].binding = i;
+            bindings[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[i].descriptorCount = 1;
+            bindings[i].stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        }
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.bindingCount = 3;
+        layoutInfo.pBindings = bindings;
+
+        if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_CullSetLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create cull descriptor set layout!");
+        }
+
+        uint32_t maxSets = MAX_BATCHES * m_FramesInFlight;
+
+        VkDescriptorPoolSize poolSize{};
+        poolSize.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        poolSize.descriptorCount = maxSets * 3;
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.maxSets = maxSets;
+        poolInfo.poolSizeCount = 1;
+        poolInfo.pPoolSizes = &poolSize;
+
+        if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_CullDescriptorPool) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create cull descriptor pool!");
+        }
+
+        VkPushConstantRange pushRange{};
+        pushRange.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushRange.size = sizeof(CullPushConstants);
+
+        VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+        pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipelineLayoutInfo.setLayoutCount = 1;
+        pipelineLayoutInfo.pSetLayouts = &m_CullSetLayout;
+        pipelineLayoutInfo.pushConstantRangeCount = 1;
+        pipelineLayoutInfo.pPushConstantRanges = &pushRange;
+
+        if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr,
+                                   &m_CullPipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create cull pipeline layout!");
+        }
+
+        m_CullPipeline = std::make_unique<VulkanPipeline>();
+        m_CullPipeline->InitCompute(*m_Device, "assets/shaders/vegetation_cull.comp.spv",
+                                    m_CullPipelineLayout);
     }
 
     // ==================== VegetationSpawner ====================
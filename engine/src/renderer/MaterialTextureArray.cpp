@@ -0,0 +1,279 @@
+#include "genesis/renderer/MaterialTextureArray.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/renderer/VulkanBuffer.h"
+#include "genesis/core/Log.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace Genesis
+{
+
+    MaterialTextureArray::~MaterialTextureArray()
+    {
+        if (m_Device)
+        {
+            Shutdown();
+        }
+    }
+
+    void MaterialTextureArray::Init(VulkanDevice &device)
+    {
+        m_Device = &device;
+
+        if (!device.SupportsDescriptorIndexing())
+        {
+            GEN_INFO("Descriptor indexing unavailable; material textures stay on vertex colors");
+            return;
+        }
+
+        VkDevice vkDevice = device.GetDevice();
+
+        // One runtime-sized sampler array, partially bound so only the
+        // registered slots need valid descriptors, update-after-bind so
+        // Register never has to wait out frames in flight
+        VkDescriptorSetLayoutBinding binding{};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        binding.descriptorCount = MAX_TEXTURES;
+        binding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+
+        VkDescriptorBindingFlags bindingFlags =
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+            VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT;
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo{};
+        flagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        flagsInfo.bindingCount = 1;
+        flagsInfo.pBindingFlags = &bindingFlags;
+
+        VkDescriptorSetLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutInfo.pNext = &flagsInfo;
+        layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        layoutInfo.bindingCount = 1;
+        layoutInfo.pBindings = &binding;
+
+        if (vkCreateDescriptorSetLayout(vkDevice, &layoutInfo, nullptr, &m_Layout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create material texture array layout!");
+        }
+
+        VkDescriptorPoolSize poolSize{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, MAX_TEXTURES};
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+        poolInfo.maxSets = 1;
+        poolInfo.poolSizeCount = 1;
+        poolInfo.pPoolSizes = &poolSize;
+
+        if (vkCreateDescriptorPool(vkDevice, &poolInfo, nullptr, &m_Pool) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create material texture array pool!");
+        }
+
+        uint32_t variableCount = MAX_TEXTURES;
+        VkDescriptorSetVariableDescriptorCountAllocateInfo countInfo{};
+        countInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO;
+        countInfo.descriptorSetCount = 1;
+        countInfo.pDescriptorCounts = &variableCount;
+
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext = &countInfo;
+        allocInfo.descriptorPool = m_Pool;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &m_Layout;
+
+        if (vkAllocateDescriptorSets(vkDevice, &allocInfo, &m_Set) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to allocate material texture array set!");
+        }
+
+        CreateFallbackTexture();
+
+        // Slot 0: the white fallback
+        m_NextSlot = 0;
+        Register(m_FallbackView, m_FallbackSampler);
+
+        GEN_INFO("Material texture array initialized ({} slots, bindless)", MAX_TEXTURES);
+    }
+
+    void MaterialTextureArray::Shutdown()
+    {
+        if (!m_Device)
+        {
+            return;
+        }
+
+        VkDevice vkDevice = m_Device->GetDevice();
+
+        if (m_FallbackSampler != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(vkDevice, m_FallbackSampler, nullptr);
+            m_FallbackSampler = VK_NULL_HANDLE;
+        }
+        if (m_FallbackView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(vkDevice, m_FallbackView, nullptr);
+            m_FallbackView = VK_NULL_HANDLE;
+        }
+        if (m_FallbackImage != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(vkDevice, m_FallbackImage, nullptr);
+            m_FallbackImage = VK_NULL_HANDLE;
+        }
+        if (m_FallbackAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_FallbackAllocation);
+            m_FallbackAllocation = GpuAllocation{};
+        }
+
+        if (m_Pool != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorPool(vkDevice, m_Pool, nullptr);
+            m_Pool = VK_NULL_HANDLE;
+            m_Set = VK_NULL_HANDLE;
+        }
+        if (m_Layout != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(vkDevice, m_Layout, nullptr);
+            m_Layout = VK_NULL_HANDLE;
+        }
+
+        m_NextSlot = 0;
+        m_Device = nullptr;
+    }
+
+    uint32_t MaterialTextureArray::Register(VkImageView view, VkSampler sampler)
+    {
+        if (m_Set == VK_NULL_HANDLE)
+        {
+            return 0;
+        }
+        if (m_NextSlot >= MAX_TEXTURES)
+        {
+            GEN_WARN("Material texture array full ({} slots); texture falls back to slot 0",
+                     MAX_TEXTURES);
+            return 0;
+        }
+
+        uint32_t slot = m_NextSlot++;
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.sampler = sampler;
+        imageInfo.imageView = view;
+        imageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = m_Set;
+        write.dstBinding = 0;
+        write.dstArrayElement = slot;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.descriptorCount = 1;
+        write.pImageInfo = &imageInfo;
+
+        vkUpdateDescriptorSets(m_Device->GetDevice(), 1, &write, 0, nullptr);
+        return slot;
+    }
+
+    void MaterialTextureArray::CreateFallbackTexture()
+    {
+        VkDevice vkDevice = m_Device->GetDevice();
+
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent = {1, 1, 1};
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+        if (vkCreateImage(vkDevice, &imageInfo, nullptr, &m_FallbackImage) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create material fallback image!");
+        }
+
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(vkDevice, m_FallbackImage, &memRequirements);
+        m_FallbackAllocation = m_Device->GetAllocator().Allocate(memRequirements,
+                                                                 VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                                 false);
+        vkBindImageMemory(vkDevice, m_FallbackImage, m_FallbackAllocation.Memory,
+                          m_FallbackAllocation.Offset);
+
+        // One opaque white texel through a throwaway staging buffer
+        const uint32_t whiteTexel = 0xFFFFFFFFu;
+        VulkanBuffer staging;
+        staging.Init(*m_Device, sizeof(whiteTexel), VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        staging.Map();
+        std::memcpy(staging.GetMappedMemory(), &whiteTexel, sizeof(whiteTexel));
+
+        VkCommandBuffer commandBuffer = m_Device->BeginSingleTimeCommands();
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = m_FallbackImage;
+        barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        VkBufferImageCopy region{};
+        region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        region.imageExtent = {1, 1, 1};
+        vkCmdCopyBufferToImage(commandBuffer, staging.GetBuffer(), m_FallbackImage,
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+        m_Device->EndSingleTimeCommands(commandBuffer);
+        staging.Shutdown();
+
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_FallbackImage;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        viewInfo.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+        if (vkCreateImageView(vkDevice, &viewInfo, nullptr, &m_FallbackView) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create material fallback image view!");
+        }
+
+        VkSamplerCreateInfo samplerInfo{};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = VK_FILTER_LINEAR;
+        samplerInfo.minFilter = VK_FILTER_LINEAR;
+        samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+
+        if (vkCreateSampler(vkDevice, &samplerInfo, nullptr, &m_FallbackSampler) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create material fallback sampler!");
+        }
+    }
+
+}
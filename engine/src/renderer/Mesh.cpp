@@ -1,7 +1,10 @@
 #include "genesis/renderer/Mesh.h"
+#include "genesis/renderer/IndirectTerrainRenderer.h"
 #include "genesis/renderer/VulkanBuffer.h"
 #include "genesis/renderer/VulkanDevice.h"
 
+#include <glm/gtc/packing.hpp>
+
 #include <cmath>
 
 namespace Genesis {
@@ -44,10 +47,85 @@ namespace Genesis {
         return attributeDescriptions;
     }
 
+    std::vector<VkVertexInputBindingDescription> TerrainVertex::GetBindingDescriptions() {
+        std::vector<VkVertexInputBindingDescription> bindingDescriptions(1);
+        bindingDescriptions[0].binding = 0;
+        bindingDescriptions[0].stride = sizeof(TerrainVertex);
+        bindingDescriptions[0].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+        return bindingDescriptions;
+    }
+
+    std::vector<VkVertexInputAttributeDescription> TerrainVertex::GetAttributeDescriptions() {
+        std::vector<VkVertexInputAttributeDescription> attributeDescriptions(3);
+
+        // Position (half floats; fixed-function fetch expands to vec4)
+        attributeDescriptions[0].binding = 0;
+        attributeDescriptions[0].location = 0;
+        attributeDescriptions[0].format = VK_FORMAT_R16G16B16A16_SFLOAT;
+        attributeDescriptions[0].offset = offsetof(TerrainVertex, Position);
+
+        // Octahedral normal (decoded in the vertex shader)
+        attributeDescriptions[1].binding = 0;
+        attributeDescriptions[1].location = 1;
+        attributeDescriptions[1].format = VK_FORMAT_R8G8_SNORM;
+        attributeDescriptions[1].offset = offsetof(TerrainVertex, Normal);
+
+        // Color
+        attributeDescriptions[2].binding = 0;
+        attributeDescriptions[2].location = 2;
+        attributeDescriptions[2].format = VK_FORMAT_R8G8B8A8_UNORM;
+        attributeDescriptions[2].offset = offsetof(TerrainVertex, Color);
+
+        return attributeDescriptions;
+    }
+
+    TerrainVertex TerrainVertex::Pack(const Vertex& vertex) {
+        TerrainVertex packed{};
+
+        uint32_t xy = glm::packHalf2x16(glm::vec2(vertex.Position.x, vertex.Position.y));
+        uint32_t zw = glm::packHalf2x16(glm::vec2(vertex.Position.z, 1.0f));
+        packed.Position[0] = static_cast<uint16_t>(xy & 0xFFFFu);
+        packed.Position[1] = static_cast<uint16_t>(xy >> 16);
+        packed.Position[2] = static_cast<uint16_t>(zw & 0xFFFFu);
+        packed.Position[3] = static_cast<uint16_t>(zw >> 16);
+
+        // Octahedral encoding: project onto the octahedron, fold the lower
+        // hemisphere over the XY plane
+        glm::vec3 normal = vertex.Normal;
+        float manhattan = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+        glm::vec2 oct(0.0f);
+        if (manhattan > 1e-6f) {
+            normal /= manhattan;
+            oct = glm::vec2(normal.x, normal.y);
+            if (normal.z < 0.0f) {
+                oct = (1.0f - glm::abs(glm::vec2(normal.y, normal.x))) *
+                      glm::vec2(normal.x >= 0.0f ? 1.0f : -1.0f,
+                                normal.y >= 0.0f ? 1.0f : -1.0f);
+            }
+        }
+        packed.Normal[0] = static_cast<int8_t>(std::lround(glm::clamp(oct.x, -1.0f, 1.0f) * 127.0f));
+        packed.Normal[1] = static_cast<int8_t>(std::lround(glm::clamp(oct.y, -1.0f, 1.0f) * 127.0f));
+
+        packed.Color[0] = static_cast<uint8_t>(glm::clamp(vertex.Color.r, 0.0f, 1.0f) * 255.0f + 0.5f);
+        packed.Color[1] = static_cast<uint8_t>(glm::clamp(vertex.Color.g, 0.0f, 1.0f) * 255.0f + 0.5f);
+        packed.Color[2] = static_cast<uint8_t>(glm::clamp(vertex.Color.b, 0.0f, 1.0f) * 255.0f + 0.5f);
+        packed.Color[3] = 255;
+
+        return packed;
+    }
+
     Mesh::Mesh(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices)
         : m_Vertices(vertices), m_Indices(indices), 
           m_VertexCount(static_cast<uint32_t>(vertices.size())),
           m_IndexCount(static_cast<uint32_t>(indices.size())) {
+        CaptureBounds(m_Vertices);
+    }
+
+    Mesh::Mesh(std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices)
+        : m_Vertices(std::move(vertices)), m_Indices(std::move(indices)) {
+        m_VertexCount = static_cast<uint32_t>(m_Vertices.size());
+        m_IndexCount = static_cast<uint32_t>(m_Indices.size());
+        CaptureBounds(m_Vertices);
     }
 
     Mesh::Mesh(VulkanDevice& device, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
@@ -66,12 +144,74 @@ namespace Genesis {
         m_Indices = indices;
         m_VertexCount = static_cast<uint32_t>(vertices.size());
         m_IndexCount = static_cast<uint32_t>(indices.size());
+        CaptureBounds(vertices);
 
         CreateVertexBuffer(device, vertices);
         CreateIndexBuffer(device, indices);
     }
 
+    void Mesh::Init(VulkanDevice& device, std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices, bool retainCpuData) {
+        m_Device = &device;
+        m_Vertices = std::move(vertices);
+        m_Indices = std::move(indices);
+        m_VertexCount = static_cast<uint32_t>(m_Vertices.size());
+        m_IndexCount = static_cast<uint32_t>(m_Indices.size());
+        CaptureBounds(m_Vertices);
+
+        CreateVertexBuffer(device, m_Vertices);
+        CreateIndexBuffer(device, m_Indices);
+
+        if (!retainCpuData) {
+            m_Vertices.clear();
+            m_Vertices.shrink_to_fit();
+            m_Indices.clear();
+            m_Indices.shrink_to_fit();
+        }
+    }
+
+    void Mesh::Init(VulkanDevice& device, IndirectTerrainRenderer& pool, std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices) {
+        TerrainMeshAllocation allocation = pool.Allocate(vertices, indices);
+        if (!allocation.IsValid()) {
+            // Shared buffers rejected the mesh; keep it renderable on its own
+            Init(device, std::move(vertices), std::move(indices), false);
+            return;
+        }
+
+        m_Device = &device;
+        m_Pool = &pool;
+        m_PoolAllocation = allocation;
+        m_VertexCount = static_cast<uint32_t>(vertices.size());
+        m_IndexCount = static_cast<uint32_t>(indices.size());
+        CaptureBounds(vertices);
+    }
+
+    void Mesh::CaptureBounds(const std::vector<Vertex>& vertices) {
+        if (vertices.empty()) {
+            m_BoundsMin = glm::vec3(0.0f);
+            m_BoundsMax = glm::vec3(0.0f);
+            return;
+        }
+        m_BoundsMin = m_BoundsMax = vertices[0].Position;
+        for (const Vertex& vertex : vertices) {
+            m_BoundsMin = glm::min(m_BoundsMin, vertex.Position);
+            m_BoundsMax = glm::max(m_BoundsMax, vertex.Position);
+        }
+    }
+
+    float Mesh::GetBoundingRadius() const {
+        // The farthest point of a box from the origin is one of its
+        // corners, and every vertex sits inside the box, so this is a
+        // valid (if conservative) bounding sphere
+        glm::vec3 corner = glm::max(glm::abs(m_BoundsMin), glm::abs(m_BoundsMax));
+        return glm::length(corner);
+    }
+
     void Mesh::Shutdown() {
+        if (m_Pool) {
+            m_Pool->Free(m_PoolAllocation);
+            m_Pool = nullptr;
+            m_PoolAllocation = {};
+        }
         if (m_IndexBuffer) {
             m_IndexBuffer->Shutdown();
             m_IndexBuffer.reset();
@@ -86,41 +226,23 @@ namespace Genesis {
     void Mesh::CreateVertexBuffer(VulkanDevice& device, const std::vector<Vertex>& vertices) {
         VkDeviceSize bufferSize = sizeof(vertices[0]) * vertices.size();
 
-        // Staging buffer
-        VulkanBuffer stagingBuffer;
-        stagingBuffer.Init(device, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-        stagingBuffer.Map();
-        stagingBuffer.WriteToBuffer(vertices.data());
-        stagingBuffer.Unmap();
-
-        // Device local vertex buffer
+        // Device local vertex buffer, filled through the device staging ring
         m_VertexBuffer = std::make_unique<VulkanBuffer>();
         m_VertexBuffer->Init(device, bufferSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
-        VulkanBuffer::CopyBuffer(device, stagingBuffer.GetBuffer(), m_VertexBuffer->GetBuffer(), bufferSize);
-        stagingBuffer.Shutdown();
+        device.StageToBuffer(vertices.data(), bufferSize, m_VertexBuffer->GetBuffer());
     }
 
     void Mesh::CreateIndexBuffer(VulkanDevice& device, const std::vector<uint32_t>& indices) {
         VkDeviceSize bufferSize = sizeof(indices[0]) * indices.size();
 
-        // Staging buffer
-        VulkanBuffer stagingBuffer;
-        stagingBuffer.Init(device, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-                           VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-        stagingBuffer.Map();
-        stagingBuffer.WriteToBuffer(indices.data());
-        stagingBuffer.Unmap();
-
-        // Device local index buffer
+        // Device local index buffer, filled through the device staging ring
         m_IndexBuffer = std::make_unique<VulkanBuffer>();
         m_IndexBuffer->Init(device, bufferSize, VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
 
-        VulkanBuffer::CopyBuffer(device, stagingBuffer.GetBuffer(), m_IndexBuffer->GetBuffer(), bufferSize);
-        stagingBuffer.Shutdown();
+        device.StageToBuffer(indices.data(), bufferSize, m_IndexBuffer->GetBuffer());
     }
 
     void Mesh::Bind(VkCommandBuffer commandBuffer) const {
@@ -336,4 +458,121 @@ namespace Genesis {
         return mesh;
     }
 
+    void Mesh::OptimizeForVertexCache(std::vector<uint32_t>& indices, uint32_t vertexCount) {
+        // Tipsify (Sander et al. 2007): linear time, no cache simulation in
+        // the inner loop. The model cache size is deliberately conservative;
+        // orders tuned for a small FIFO also run well on larger caches.
+        constexpr uint32_t CACHE_SIZE = 24;
+
+        size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2 || vertexCount == 0) {
+            return;
+        }
+
+        // Vertex -> triangle adjacency in counting-sort layout
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (uint32_t index : indices) {
+            offsets[index + 1]++;
+        }
+        for (uint32_t v = 0; v < vertexCount; v++) {
+            offsets[v + 1] += offsets[v];
+        }
+        std::vector<uint32_t> adjacency(indices.size());
+        {
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t t = 0; t < triangleCount; t++) {
+                for (int c = 0; c < 3; c++) {
+                    adjacency[cursor[indices[t * 3 + c]]++] = static_cast<uint32_t>(t);
+                }
+            }
+        }
+
+        std::vector<uint32_t> liveTriangles(vertexCount);
+        for (uint32_t v = 0; v < vertexCount; v++) {
+            liveTriangles[v] = offsets[v + 1] - offsets[v];
+        }
+
+        // Per-vertex timestamp of the last cache entry; a vertex is modeled
+        // as resident while (timestamp - entry) <= CACHE_SIZE
+        std::vector<uint32_t> cacheTime(vertexCount, 0);
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<uint32_t> deadEndStack;
+        std::vector<uint32_t> candidates;
+        candidates.reserve(16);
+
+        std::vector<uint32_t> output;
+        output.reserve(indices.size());
+
+        uint32_t timestamp = CACHE_SIZE + 1;
+        uint32_t scanCursor = 0; // Next unvisited vertex when the stack runs dry
+        int64_t fanning = 0;     // Current focus vertex, -1 when the mesh is done
+
+        while (fanning >= 0) {
+            candidates.clear();
+
+            // Emit every live triangle around the focus vertex
+            for (uint32_t a = offsets[fanning]; a < offsets[fanning + 1]; a++) {
+                uint32_t t = adjacency[a];
+                if (emitted[t]) {
+                    continue;
+                }
+                emitted[t] = true;
+
+                for (int c = 0; c < 3; c++) {
+                    uint32_t v = indices[t * 3 + c];
+                    output.push_back(v);
+                    deadEndStack.push_back(v);
+                    candidates.push_back(v);
+                    liveTriangles[v]--;
+                    if (timestamp - cacheTime[v] > CACHE_SIZE) {
+                        cacheTime[v] = timestamp;
+                        timestamp++;
+                    }
+                }
+            }
+
+            // Next focus: the 1-ring vertex whose remaining triangles fit in
+            // the cache alongside it, preferring the one closest to eviction
+            fanning = -1;
+            int64_t bestPriority = -1;
+            for (uint32_t v : candidates) {
+                if (liveTriangles[v] == 0) {
+                    continue;
+                }
+                int64_t priority = 0;
+                if (timestamp - cacheTime[v] + 2 * liveTriangles[v] <= CACHE_SIZE) {
+                    priority = timestamp - cacheTime[v];
+                }
+                if (priority > bestPriority) {
+                    bestPriority = priority;
+                    fanning = v;
+                }
+            }
+
+            // Dead end: backtrack through recently emitted vertices, then
+            // fall back to an input-order scan for the next live vertex
+            if (fanning < 0) {
+                while (!deadEndStack.empty()) {
+                    uint32_t v = deadEndStack.back();
+                    deadEndStack.pop_back();
+                    if (liveTriangles[v] > 0) {
+                        fanning = v;
+                        break;
+                    }
+                }
+                if (fanning < 0) {
+                    while (scanCursor < vertexCount) {
+                        if (liveTriangles[scanCursor] > 0) {
+                            fanning = scanCursor;
+                            break;
+                        }
+                        scanCursor++;
+                    }
+                }
+            }
+        }
+
+        indices = std::move(output);
+    }
+
 }
@@ -0,0 +1,31 @@
+#include "genesis/renderer/MeshArena.h"
+
+namespace Genesis {
+
+    MeshArena& MeshArena::Get() {
+        static MeshArena instance;
+        return instance;
+    }
+
+    MeshArena::BuildBuffers MeshArena::Acquire() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (!m_FreeBuffers.empty()) {
+            BuildBuffers buffers = std::move(m_FreeBuffers.back());
+            m_FreeBuffers.pop_back();
+            return buffers;
+        }
+        return {};
+    }
+
+    void MeshArena::Release(BuildBuffers&& buffers) {
+        // Keep the capacity, drop the contents
+        buffers.Vertices.clear();
+        buffers.Indices.clear();
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_FreeBuffers.size() < MAX_POOLED_BUFFERS) {
+            m_FreeBuffers.push_back(std::move(buffers));
+        }
+    }
+
+}
@@ -0,0 +1,103 @@
+#include "genesis/renderer/MeshCache.h"
+#include "genesis/core/Log.h"
+#include <cstring>
+
+namespace Genesis {
+
+    size_t MeshCache::PrimitiveKeyHash::operator()(const PrimitiveKey& key) const {
+        // Combine the raw bits of every field; exact-match keying means
+        // bit-identical floats are the only ones that must collide
+        auto mix = [](size_t seed, uint32_t value) {
+            return seed ^ (static_cast<size_t>(value) + 0x9E3779B9u + (seed << 6) + (seed >> 2));
+        };
+
+        uint32_t bits[5] = {};
+        std::memcpy(&bits[0], &key.size, sizeof(float));
+        std::memcpy(&bits[1], &key.color.x, sizeof(float));
+        std::memcpy(&bits[2], &key.color.y, sizeof(float));
+        std::memcpy(&bits[3], &key.color.z, sizeof(float));
+        bits[4] = static_cast<uint32_t>(key.subdivisions);
+
+        size_t hash = static_cast<size_t>(key.type);
+        for (uint32_t b : bits) {
+            hash = mix(hash, b);
+        }
+        return hash;
+    }
+
+    void MeshCache::Shutdown() {
+        for (auto& [key, mesh] : m_Meshes) {
+            mesh->Shutdown();
+        }
+        m_Meshes.clear();
+        m_Device = nullptr;
+    }
+
+    std::shared_ptr<Mesh> MeshCache::GetCube(const glm::vec3& color) {
+        PrimitiveKey key;
+        key.type = PrimitiveType::Cube;
+        key.color = color;
+        return GetOrCreate(key);
+    }
+
+    std::shared_ptr<Mesh> MeshCache::GetPlane(float size, const glm::vec3& color) {
+        PrimitiveKey key;
+        key.type = PrimitiveType::Plane;
+        key.size = size;
+        key.color = color;
+        return GetOrCreate(key);
+    }
+
+    std::shared_ptr<Mesh> MeshCache::GetIcosphere(int subdivisions, const glm::vec3& color) {
+        PrimitiveKey key;
+        key.type = PrimitiveType::Icosphere;
+        key.subdivisions = subdivisions;
+        key.color = color;
+        return GetOrCreate(key);
+    }
+
+    std::shared_ptr<Mesh> MeshCache::GetLowPolyTree() {
+        PrimitiveKey key;
+        key.type = PrimitiveType::LowPolyTree;
+        return GetOrCreate(key);
+    }
+
+    std::shared_ptr<Mesh> MeshCache::GetLowPolyRock() {
+        PrimitiveKey key;
+        key.type = PrimitiveType::LowPolyRock;
+        return GetOrCreate(key);
+    }
+
+    std::shared_ptr<Mesh> MeshCache::GetOrCreate(const PrimitiveKey& key) {
+        GEN_ASSERT(m_Device, "MeshCache used before Init");
+
+        auto it = m_Meshes.find(key);
+        if (it != m_Meshes.end()) {
+            return it->second;
+        }
+
+        std::unique_ptr<Mesh> mesh;
+        switch (key.type) {
+        case PrimitiveType::Cube:
+            mesh = Mesh::CreateCube(*m_Device, key.color);
+            break;
+        case PrimitiveType::Plane:
+            mesh = Mesh::CreatePlane(*m_Device, key.size, key.color);
+            break;
+        case PrimitiveType::Icosphere:
+            mesh = Mesh::CreateIcosphere(*m_Device, key.subdivisions, key.color);
+            break;
+        case PrimitiveType::LowPolyTree:
+            mesh = Mesh::CreateLowPolyTree(*m_Device);
+            break;
+        case PrimitiveType::LowPolyRock:
+            mesh = Mesh::CreateLowPolyRock(*m_Device);
+            break;
+        }
+
+        std::shared_ptr<Mesh> shared(std::move(mesh));
+        m_Meshes[key] = shared;
+        return shared;
+    }
+
+}
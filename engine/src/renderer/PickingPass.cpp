@@ -0,0 +1,432 @@
+#include "genesis/renderer/PickingPass.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/renderer/VulkanBuffer.h"
+#include "genesis/renderer/VulkanPipeline.h"
+#include "genesis/renderer/IndirectTerrainRenderer.h"
+#include "genesis/renderer/Mesh.h"
+#include "genesis/core/Log.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace Genesis
+{
+
+    PickingPass::~PickingPass()
+    {
+        Shutdown();
+    }
+
+    void PickingPass::Init(VulkanDevice &device, VkDescriptorSetLayout globalSetLayout,
+                           VkFormat depthFormat)
+    {
+        m_Device = &device;
+
+        CreateRenderPass(depthFormat);
+        CreateTarget(depthFormat);
+        CreatePipelines(globalSetLayout);
+
+        m_PixelBuffer = std::make_unique<VulkanBuffer>();
+        m_PixelBuffer->Init(device, sizeof(uint32_t),
+                            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    }
+
+    void PickingPass::Shutdown()
+    {
+        if (!m_Device)
+        {
+            return;
+        }
+
+        VkDevice device = m_Device->GetDevice();
+
+        if (m_MeshPipeline)
+        {
+            m_MeshPipeline->Shutdown();
+            m_MeshPipeline.reset();
+        }
+        if (m_TerrainPipeline)
+        {
+            m_TerrainPipeline->Shutdown();
+            m_TerrainPipeline.reset();
+        }
+        if (m_PipelineLayout != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(device, m_PipelineLayout, nullptr);
+            m_PipelineLayout = VK_NULL_HANDLE;
+        }
+        if (m_PixelBuffer)
+        {
+            m_PixelBuffer->Shutdown();
+            m_PixelBuffer.reset();
+        }
+        if (m_Framebuffer != VK_NULL_HANDLE)
+        {
+            vkDestroyFramebuffer(device, m_Framebuffer, nullptr);
+            m_Framebuffer = VK_NULL_HANDLE;
+        }
+        if (m_ColorView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(device, m_ColorView, nullptr);
+            m_ColorView = VK_NULL_HANDLE;
+        }
+        if (m_ColorImage != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(device, m_ColorImage, nullptr);
+            m_ColorImage = VK_NULL_HANDLE;
+        }
+        if (m_ColorAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_ColorAllocation);
+            m_ColorAllocation = GpuAllocation{};
+        }
+        if (m_DepthView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(device, m_DepthView, nullptr);
+            m_DepthView = VK_NULL_HANDLE;
+        }
+        if (m_DepthImage != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(device, m_DepthImage, nullptr);
+            m_DepthImage = VK_NULL_HANDLE;
+        }
+        if (m_DepthAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_DepthAllocation);
+            m_DepthAllocation = GpuAllocation{};
+        }
+        if (m_RenderPass != VK_NULL_HANDLE)
+        {
+            vkDestroyRenderPass(device, m_RenderPass, nullptr);
+            m_RenderPass = VK_NULL_HANDLE;
+        }
+
+        m_Device = nullptr;
+    }
+
+    void PickingPass::Submit(VulkanDevice &device, VkDescriptorSet globalSet,
+                             IndirectTerrainRenderer &terrainPool,
+                             const std::vector<PickDraw> &draws,
+                             uint32_t cursorX, uint32_t cursorY, VkExtent2D viewExtent,
+                             std::function<void(uint32_t id)> callback)
+    {
+        VkCommandBuffer cmd = device.BeginReadbackCommands();
+
+        VkClearValue clears[2]{};
+        clears[0].color.uint32[0] = 0;
+        clears[1].depthStencil = {1.0f, 0};
+
+        VkRenderPassBeginInfo passInfo{};
+        passInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        passInfo.renderPass = m_RenderPass;
+        passInfo.framebuffer = m_Framebuffer;
+        passInfo.renderArea = {{0, 0}, {1, 1}};
+        passInfo.clearValueCount = 2;
+        passInfo.pClearValues = clears;
+
+        vkCmdBeginRenderPass(cmd, &passInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+        // The viewport spans the full scene view but is shifted so the
+        // cursor's pixel lands on the target's single texel; rasterization
+        // outside the 1x1 scissor is discarded, so the camera projection
+        // matches the main pass exactly while only one pixel is shaded
+        VkViewport viewport{};
+        viewport.x = -static_cast<float>(cursorX);
+        viewport.y = -static_cast<float>(cursorY);
+        viewport.width = static_cast<float>(viewExtent.width);
+        viewport.height = static_cast<float>(viewExtent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+        VkRect2D scissor{{0, 0}, {1, 1}};
+        vkCmdSetScissor(cmd, 0, 1, &scissor);
+
+        bool meshPipelineBound = false;
+        const Mesh *boundMesh = nullptr;
+        for (const PickDraw &draw : draws)
+        {
+            if (draw.MeshPtr->IsPooled())
+            {
+                continue;
+            }
+
+            if (!meshPipelineBound)
+            {
+                m_MeshPipeline->Bind(cmd);
+                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout,
+                                        0, 1, &globalSet, 0, nullptr);
+                meshPipelineBound = true;
+            }
+
+            PushData push{};
+            push.ModelMatrix = draw.Transform;
+            push.PickID = draw.ID;
+            vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                               sizeof(glm::mat4), &push.ModelMatrix);
+            vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT,
+                               sizeof(glm::mat4), sizeof(uint32_t), &push.PickID);
+
+            if (draw.MeshPtr != boundMesh)
+            {
+                draw.MeshPtr->Bind(cmd);
+                boundMesh = draw.MeshPtr;
+            }
+            draw.MeshPtr->Draw(cmd);
+        }
+
+        // Pooled terrain: bind the mega buffers once and issue each
+        // allocation's range directly
+        bool terrainBound = false;
+        for (const PickDraw &draw : draws)
+        {
+            if (!draw.MeshPtr->IsPooled())
+            {
+                continue;
+            }
+
+            if (!terrainBound)
+            {
+                m_TerrainPipeline->Bind(cmd);
+                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout,
+                                        0, 1, &globalSet, 0, nullptr);
+                VkBuffer vertexBuffer = terrainPool.GetPoolVertexBuffer();
+                VkDeviceSize offset = 0;
+                vkCmdBindVertexBuffers(cmd, 0, 1, &vertexBuffer, &offset);
+                vkCmdBindIndexBuffer(cmd, terrainPool.GetPoolIndexBuffer(), 0,
+                                     VK_INDEX_TYPE_UINT32);
+                terrainBound = true;
+            }
+
+            PushData push{};
+            push.ModelMatrix = draw.Transform;
+            push.PickID = draw.ID;
+            vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                               sizeof(glm::mat4), &push.ModelMatrix);
+            vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_FRAGMENT_BIT,
+                               sizeof(glm::mat4), sizeof(uint32_t), &push.PickID);
+
+            const TerrainMeshAllocation &allocation = draw.MeshPtr->GetPoolAllocation();
+            vkCmdDrawIndexed(cmd, allocation.indexCount, 1, allocation.firstIndex,
+                             allocation.vertexOffset, 0);
+        }
+
+        vkCmdEndRenderPass(cmd);
+
+        // The pass's finalLayout is TRANSFER_SRC; pull the pixel into the
+        // staging buffer the readback ring then copies out of
+        VkBufferImageCopy region{};
+        region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        region.imageSubresource.layerCount = 1;
+        region.imageExtent = {1, 1, 1};
+        vkCmdCopyImageToBuffer(cmd, m_ColorImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                               m_PixelBuffer->GetBuffer(), 1, &region);
+
+        VkBufferMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer = m_PixelBuffer->GetBuffer();
+        barrier.size = sizeof(uint32_t);
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             0, 0, nullptr, 1, &barrier, 0, nullptr);
+
+        device.SubmitReadback(cmd, m_PixelBuffer->GetBuffer(), 0, sizeof(uint32_t),
+                              [callback = std::move(callback)](const void *data, VkDeviceSize)
+                              {
+                                  uint32_t id = 0;
+                                  std::memcpy(&id, data, sizeof(id));
+                                  callback(id);
+                              });
+    }
+
+    void PickingPass::CreateRenderPass(VkFormat depthFormat)
+    {
+        // One uint color texel plus a depth texel so the nearest surface
+        // wins the pick, exactly as it wins the visible pixel
+        VkAttachmentDescription attachments[2]{};
+        attachments[0].format = VK_FORMAT_R32_UINT;
+        attachments[0].samples = VK_SAMPLE_COUNT_1_BIT;
+        attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachments[0].finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+        attachments[1].format = depthFormat;
+        attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
+        attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachments[1].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference colorRef{};
+        colorRef.attachment = 0;
+        colorRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference depthRef{};
+        depthRef.attachment = 1;
+        depthRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkSubpassDescription subpass{};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &colorRef;
+        subpass.pDepthStencilAttachment = &depthRef;
+
+        // Order the previous pick's transfer read before this pass's clear,
+        // and the attachment write before the pixel copy that follows
+        VkSubpassDependency dependencies[2]{};
+        dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[0].dstSubpass = 0;
+        dependencies[0].srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dependencies[0].srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+        dependencies[1].srcSubpass = 0;
+        dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        dependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+        VkRenderPassCreateInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        renderPassInfo.attachmentCount = 2;
+        renderPassInfo.pAttachments = attachments;
+        renderPassInfo.subpassCount = 1;
+        renderPassInfo.pSubpasses = &subpass;
+        renderPassInfo.dependencyCount = 2;
+        renderPassInfo.pDependencies = dependencies;
+
+        if (vkCreateRenderPass(m_Device->GetDevice(), &renderPassInfo, nullptr, &m_RenderPass) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create picking render pass!");
+        }
+    }
+
+    void PickingPass::CreateTarget(VkFormat depthFormat)
+    {
+        VkDevice device = m_Device->GetDevice();
+
+        auto createImage = [&](VkFormat format, VkImageUsageFlags usage,
+                               VkImage &image, GpuAllocation &allocation)
+        {
+            VkImageCreateInfo imageInfo{};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.extent = {1, 1, 1};
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = format;
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageInfo.usage = usage;
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+            if (vkCreateImage(device, &imageInfo, nullptr, &image) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create picking image!");
+            }
+
+            VkMemoryRequirements memRequirements;
+            vkGetImageMemoryRequirements(device, image, &memRequirements);
+            allocation = m_Device->GetAllocator().Allocate(memRequirements,
+                                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                           false);
+            vkBindImageMemory(device, image, allocation.Memory, allocation.Offset);
+        };
+
+        auto createView = [&](VkImage image, VkFormat format, VkImageAspectFlags aspect,
+                              VkImageView &view)
+        {
+            VkImageViewCreateInfo viewInfo{};
+            viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            viewInfo.image = image;
+            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            viewInfo.format = format;
+            viewInfo.subresourceRange.aspectMask = aspect;
+            viewInfo.subresourceRange.levelCount = 1;
+            viewInfo.subresourceRange.layerCount = 1;
+
+            if (vkCreateImageView(device, &viewInfo, nullptr, &view) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create picking image view!");
+            }
+        };
+
+        createImage(VK_FORMAT_R32_UINT,
+                    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                    m_ColorImage, m_ColorAllocation);
+        createView(m_ColorImage, VK_FORMAT_R32_UINT, VK_IMAGE_ASPECT_COLOR_BIT, m_ColorView);
+
+        createImage(depthFormat, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                    m_DepthImage, m_DepthAllocation);
+        createView(m_DepthImage, depthFormat, VK_IMAGE_ASPECT_DEPTH_BIT, m_DepthView);
+
+        VkImageView attachments[] = {m_ColorView, m_DepthView};
+        VkFramebufferCreateInfo framebufferInfo{};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = m_RenderPass;
+        framebufferInfo.attachmentCount = 2;
+        framebufferInfo.pAttachments = attachments;
+        framebufferInfo.width = 1;
+        framebufferInfo.height = 1;
+        framebufferInfo.layers = 1;
+
+        if (vkCreateFramebuffer(device, &framebufferInfo, nullptr, &m_Framebuffer) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create picking framebuffer!");
+        }
+    }
+
+    void PickingPass::CreatePipelines(VkDescriptorSetLayout globalSetLayout)
+    {
+        VkPushConstantRange ranges[2]{};
+        ranges[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        ranges[0].offset = 0;
+        ranges[0].size = sizeof(glm::mat4);
+        ranges[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        ranges[1].offset = sizeof(glm::mat4);
+        ranges[1].size = sizeof(uint32_t);
+
+        VkPipelineLayoutCreateInfo layoutInfo{};
+        layoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        layoutInfo.setLayoutCount = 1;
+        layoutInfo.pSetLayouts = &globalSetLayout;
+        layoutInfo.pushConstantRangeCount = 2;
+        layoutInfo.pPushConstantRanges = ranges;
+
+        if (vkCreatePipelineLayout(m_Device->GetDevice(), &layoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create picking pipeline layout!");
+        }
+
+        PipelineConfig config{};
+        VulkanPipeline::DefaultPipelineConfig(config);
+        config.PipelineLayout = m_PipelineLayout;
+        config.RenderPass = m_RenderPass;
+
+        m_MeshPipeline = std::make_unique<VulkanPipeline>();
+        m_MeshPipeline->Init(*m_Device, "assets/shaders/picking.vert.spv",
+                             "assets/shaders/picking.frag.spv", config);
+
+        // Same pass over the pooled terrain vertex format; the shader only
+        // consumes the position attribute
+        config.VertexBindings = TerrainVertex::GetBindingDescriptions();
+        config.VertexAttributes = TerrainVertex::GetAttributeDescriptions();
+
+        m_TerrainPipeline = std::make_unique<VulkanPipeline>();
+        m_TerrainPipeline->Init(*m_Device, "assets/shaders/picking_terrain.vert.spv",
+                                "assets/shaders/picking.frag.spv", config);
+    }
+
+}
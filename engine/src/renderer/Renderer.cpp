@@ -6,12 +6,22 @@
 #include "genesis/renderer/VulkanBuffer.h"
 #include "genesis/renderer/Camera.h"
 #include "genesis/renderer/Mesh.h"
+#include "genesis/renderer/IndirectTerrainRenderer.h"
+#include "genesis/renderer/InstancedRenderer.h"
+#include "genesis/renderer/ViewportTarget.h"
+#include "genesis/ecs/Scene.h"
 #include "genesis/core/Window.h"
 #include "genesis/core/Log.h"
+#include "genesis/core/Profiler.h"
+#include "genesis/core/MemoryTracker.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
+#include <future>
 #include <stdexcept>
+#include <thread>
 
 namespace Genesis
 {
@@ -33,16 +43,68 @@ namespace Genesis
         m_Swapchain = std::make_unique<VulkanSwapchain>();
         m_Swapchain->Init(*m_Device, m_Context->GetSurface(), window.GetWidth(), window.GetHeight());
 
+        // Shadow map precedes the descriptor layout: set 0 binding 2
+        // samples its cascade array
+        m_ShadowMap = std::make_unique<ShadowMap>();
+        m_ShadowMap->Init(*m_Device);
+
+        // Debug field atlas precedes it too: set 0 binding 3 samples it.
+        // Sized for the default 128-cell chunk; chunks of other sizes skip
+        // the GPU overlay (see ChunkManager)
+        m_DebugFieldAtlas.Init(*m_Device, 128);
+
+        // Bindless material array; a no-op holding a null set when the
+        // device lacks descriptor indexing
+        m_MaterialTextures.Init(*m_Device);
+
         CreateCommandBuffers();
+        CreateSecondaryCommandBuffers();
         CreateSyncObjects();
         CreateDescriptorSetLayout();
         CreatePipelineLayout();
-        CreatePipeline();
-        CreateWaterPipeline();
+
+        // The default and water pipelines are independent of everything below,
+        // so their driver-side shader compilation runs on worker threads while
+        // the main thread keeps initializing. Pipeline creation against the
+        // shared device cache is thread-safe; get() propagates any exception.
+        auto pipelineTask = std::async(std::launch::async, [this] { CreatePipeline(); });
+        auto waterPipelineTask = std::async(std::launch::async, [this] { CreateWaterPipeline(); });
+
         CreateUniformBuffers();
         CreateDescriptorPool();
         CreateDescriptorSets();
 
+        // Terrain and instanced pipelines compile on the main thread,
+        // overlapping the two workers
+        m_TerrainIndirect = std::make_unique<IndirectTerrainRenderer>();
+        m_TerrainIndirect->Init(*m_Device, m_DescriptorSetLayout,
+                                m_Swapchain->GetRenderPass(), MAX_FRAMES_IN_FLIGHT,
+                                m_ShadowMap->GetRenderPass(),
+                                m_MaterialTextures.GetLayout());
+        if (m_MaterialTextures.IsAvailable())
+        {
+            m_TerrainIndirect->SetMaterialDescriptorSet(m_MaterialTextures.GetDescriptorSet());
+        }
+
+        m_InstancedRenderer = std::make_unique<InstancedRenderer>();
+        m_InstancedRenderer->Init(*m_Device, m_DescriptorSetLayout,
+                                  m_Swapchain->GetRenderPass(), MAX_FRAMES_IN_FLIGHT);
+
+        m_PickingPass = std::make_unique<PickingPass>();
+        m_PickingPass->Init(*m_Device, m_DescriptorSetLayout, m_Swapchain->GetDepthFormat());
+
+        pipelineTask.get();
+        waterPipelineTask.get();
+
+        // Shader hot reload: edits to the SPIR-V behind these pipelines get
+        // picked up, rebuilt on a worker, and swapped in between frames
+        m_ShaderHotReload.Watch(m_Pipeline.get());
+        m_ShaderHotReload.Watch(m_WaterPipeline.get());
+
+        m_MeshCache.Init(*m_Device);
+
+        m_GpuProfiler.Init(*m_Device, MAX_FRAMES_IN_FLIGHT);
+
         GEN_INFO("Vulkan renderer initialized!");
     }
 
@@ -52,13 +114,45 @@ namespace Genesis
 
         VkDevice device = m_Device->GetDevice();
 
-        // Cleanup uniform buffers
-        for (auto &buffer : m_UniformBuffers)
+        // Drain any in-flight shader rebuild jobs before their pipelines die
+        m_ShaderHotReload.Unwatch(m_Pipeline.get());
+        m_ShaderHotReload.Unwatch(m_WaterPipeline.get());
+
+        m_GpuProfiler.Shutdown();
+
+        m_MeshCache.Shutdown();
+
+        if (m_InstancedRenderer)
+        {
+            m_InstancedRenderer->Shutdown();
+            m_InstancedRenderer.reset();
+        }
+
+        if (m_PickingPass)
         {
-            if (buffer)
-                buffer->Shutdown();
+            m_PickingPass->Shutdown();
+            m_PickingPass.reset();
         }
-        m_UniformBuffers.clear();
+
+        if (m_TerrainIndirect)
+        {
+            m_TerrainIndirect->Shutdown();
+            m_TerrainIndirect.reset();
+        }
+
+        if (m_ShadowMap)
+        {
+            m_ShadowMap->Shutdown();
+            m_ShadowMap.reset();
+        }
+
+        m_DebugFieldAtlas.Shutdown();
+
+        m_MaterialTextures.Shutdown();
+
+        // Cleanup uniform rings
+        m_GlobalUboRing.Shutdown();
+        m_ClusterRing.Shutdown();
 
         // Cleanup descriptor resources
         if (m_DescriptorPool != VK_NULL_HANDLE)
@@ -85,6 +179,18 @@ namespace Genesis
         if (m_Pipeline)
             m_Pipeline->Shutdown();
 
+        // Stage command pools (frees their secondaries with them)
+        VkCommandPool stagePools[] = {m_ScenePool, m_WaterPool, m_UiPool};
+        for (VkCommandPool pool : stagePools)
+        {
+            if (pool != VK_NULL_HANDLE)
+                vkDestroyCommandPool(device, pool, nullptr);
+        }
+        m_ScenePool = m_WaterPool = m_UiPool = VK_NULL_HANDLE;
+        m_SceneSecondaries.clear();
+        m_WaterSecondaries.clear();
+        m_UiSecondaries.clear();
+
         // Cleanup sync objects
         for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
         {
@@ -125,6 +231,49 @@ namespace Genesis
         {
             throw std::runtime_error("Failed to allocate command buffers!");
         }
+
+        // Separate primaries for shadow cascade renders, so frames with no
+        // dirty cascade submit the main buffer alone
+        m_ShadowCommandBuffers.resize(MAX_FRAMES_IN_FLIGHT);
+        allocInfo.commandBufferCount = static_cast<uint32_t>(m_ShadowCommandBuffers.size());
+
+        if (vkAllocateCommandBuffers(m_Device->GetDevice(), &allocInfo, m_ShadowCommandBuffers.data()) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to allocate shadow command buffers!");
+        }
+    }
+
+    void Renderer::CreateSecondaryCommandBuffers()
+    {
+        VkCommandPool *pools[] = {&m_ScenePool, &m_WaterPool, &m_UiPool};
+        std::vector<VkCommandBuffer> *buffers[] = {&m_SceneSecondaries, &m_WaterSecondaries,
+                                                   &m_UiSecondaries};
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            VkCommandPoolCreateInfo poolInfo{};
+            poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.queueFamilyIndex = m_Device->GetQueueFamilies().GraphicsFamily.value();
+            poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+
+            if (vkCreateCommandPool(m_Device->GetDevice(), &poolInfo, nullptr, pools[i]) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create stage command pool!");
+            }
+
+            buffers[i]->resize(MAX_FRAMES_IN_FLIGHT);
+
+            VkCommandBufferAllocateInfo allocInfo{};
+            allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool = *pools[i];
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandBufferCount = static_cast<uint32_t>(buffers[i]->size());
+
+            if (vkAllocateCommandBuffers(m_Device->GetDevice(), &allocInfo, buffers[i]->data()) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to allocate stage command buffers!");
+            }
+        }
     }
 
     void Renderer::CreateSyncObjects()
@@ -162,17 +311,38 @@ namespace Genesis
 
     void Renderer::CreateDescriptorSetLayout()
     {
-        VkDescriptorSetLayoutBinding uboLayoutBinding{};
-        uboLayoutBinding.binding = 0;
-        uboLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        uboLayoutBinding.descriptorCount = 1;
-        uboLayoutBinding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
-        uboLayoutBinding.pImmutableSamplers = nullptr;
+        VkDescriptorSetLayoutBinding bindings[4]{};
+        bindings[0].binding = 0;
+        bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        bindings[0].descriptorCount = 1;
+        bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
+        bindings[0].pImmutableSamplers = nullptr;
+
+        // Clustered light index lists
+        bindings[1].binding = 1;
+        bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        bindings[1].descriptorCount = 1;
+        bindings[1].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        bindings[1].pImmutableSamplers = nullptr;
+
+        // Sun shadow cascade array (comparison sampled)
+        bindings[2].binding = 2;
+        bindings[2].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        bindings[2].descriptorCount = 1;
+        bindings[2].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        bindings[2].pImmutableSamplers = nullptr;
+
+        // Terrain debug field atlas (sampled only when a debug view is active)
+        bindings[3].binding = 3;
+        bindings[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        bindings[3].descriptorCount = 1;
+        bindings[3].stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT;
+        bindings[3].pImmutableSamplers = nullptr;
 
         VkDescriptorSetLayoutCreateInfo layoutInfo{};
         layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-        layoutInfo.bindingCount = 1;
-        layoutInfo.pBindings = &uboLayoutBinding;
+        layoutInfo.bindingCount = 4;
+        layoutInfo.pBindings = bindings;
 
         if (vkCreateDescriptorSetLayout(m_Device->GetDevice(), &layoutInfo, nullptr, &m_DescriptorSetLayout) != VK_SUCCESS)
         {
@@ -224,28 +394,31 @@ namespace Genesis
 
     void Renderer::CreateUniformBuffers()
     {
-        VkDeviceSize bufferSize = sizeof(GlobalUBO);
-        m_UniformBuffers.resize(MAX_FRAMES_IN_FLIGHT);
-
-        for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
-        {
-            m_UniformBuffers[i] = std::make_unique<VulkanBuffer>();
-            m_UniformBuffers[i]->Init(*m_Device, bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
-                                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-            m_UniformBuffers[i]->Map();
-        }
+        // One persistently mapped ring each, sliced per frame in flight;
+        // BeginScene and the cluster binning write the slices directly
+        m_GlobalUboRing.Init(*m_Device, sizeof(GlobalUBO), MAX_FRAMES_IN_FLIGHT,
+                             VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+        VkDeviceSize clusterSize = sizeof(uint32_t) * CLUSTER_COUNT * CLUSTER_STRIDE;
+        m_ClusterRing.Init(*m_Device, clusterSize, MAX_FRAMES_IN_FLIGHT,
+                           VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
     }
 
     void Renderer::CreateDescriptorPool()
     {
-        VkDescriptorPoolSize poolSize{};
-        poolSize.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        poolSize.descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+        VkDescriptorPoolSize poolSizes[3]{};
+        poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        poolSizes[0].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+        poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        poolSizes[1].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
+        // Two sampled images per set: shadow cascades and the debug atlas
+        poolSizes[2].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        poolSizes[2].descriptorCount = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT) * 2;
 
         VkDescriptorPoolCreateInfo poolInfo{};
         poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        poolInfo.poolSizeCount = 1;
-        poolInfo.pPoolSizes = &poolSize;
+        poolInfo.poolSizeCount = 3;
+        poolInfo.pPoolSizes = poolSizes;
         poolInfo.maxSets = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT);
 
         if (vkCreateDescriptorPool(m_Device->GetDevice(), &poolInfo, nullptr, &m_DescriptorPool) != VK_SUCCESS)
@@ -272,23 +445,82 @@ namespace Genesis
 
         for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
         {
-            VkDescriptorBufferInfo bufferInfo = m_UniformBuffers[i]->GetDescriptorInfo(sizeof(GlobalUBO));
-
-            VkWriteDescriptorSet descriptorWrite{};
-            descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-            descriptorWrite.dstSet = m_DescriptorSets[i];
-            descriptorWrite.dstBinding = 0;
-            descriptorWrite.dstArrayElement = 0;
-            descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-            descriptorWrite.descriptorCount = 1;
-            descriptorWrite.pBufferInfo = &bufferInfo;
-
-            vkUpdateDescriptorSets(m_Device->GetDevice(), 1, &descriptorWrite, 0, nullptr);
+            // Each frame's set points at its slice of the shared rings
+            VkDescriptorBufferInfo bufferInfo{m_GlobalUboRing.GetBuffer(),
+                                              m_GlobalUboRing.SliceOffset(static_cast<uint32_t>(i)),
+                                              sizeof(GlobalUBO)};
+            VkDescriptorBufferInfo clusterInfo{m_ClusterRing.GetBuffer(),
+                                               m_ClusterRing.SliceOffset(static_cast<uint32_t>(i)),
+                                               m_ClusterRing.GetSliceSize()};
+
+            VkDescriptorImageInfo shadowInfo{};
+            shadowInfo.sampler = m_ShadowMap->GetSampler();
+            shadowInfo.imageView = m_ShadowMap->GetImageView();
+            shadowInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+            VkDescriptorImageInfo debugAtlasInfo{};
+            debugAtlasInfo.sampler = m_DebugFieldAtlas.GetSampler();
+            debugAtlasInfo.imageView = m_DebugFieldAtlas.GetImageView();
+            debugAtlasInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+            VkWriteDescriptorSet descriptorWrites[4]{};
+            descriptorWrites[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[0].dstSet = m_DescriptorSets[i];
+            descriptorWrites[0].dstBinding = 0;
+            descriptorWrites[0].dstArrayElement = 0;
+            descriptorWrites[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            descriptorWrites[0].descriptorCount = 1;
+            descriptorWrites[0].pBufferInfo = &bufferInfo;
+
+            descriptorWrites[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[1].dstSet = m_DescriptorSets[i];
+            descriptorWrites[1].dstBinding = 1;
+            descriptorWrites[1].dstArrayElement = 0;
+            descriptorWrites[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            descriptorWrites[1].descriptorCount = 1;
+            descriptorWrites[1].pBufferInfo = &clusterInfo;
+
+            descriptorWrites[2].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[2].dstSet = m_DescriptorSets[i];
+            descriptorWrites[2].dstBinding = 2;
+            descriptorWrites[2].dstArrayElement = 0;
+            descriptorWrites[2].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            descriptorWrites[2].descriptorCount = 1;
+            descriptorWrites[2].pImageInfo = &shadowInfo;
+
+            descriptorWrites[3].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            descriptorWrites[3].dstSet = m_DescriptorSets[i];
+            descriptorWrites[3].dstBinding = 3;
+            descriptorWrites[3].dstArrayElement = 0;
+            descriptorWrites[3].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            descriptorWrites[3].descriptorCount = 1;
+            descriptorWrites[3].pImageInfo = &debugAtlasInfo;
+
+            vkUpdateDescriptorSets(m_Device->GetDevice(), 4, descriptorWrites, 0, nullptr);
         }
     }
 
     bool Renderer::BeginFrame()
     {
+        GEN_PROFILE_SCOPE("Renderer::BeginFrame");
+        // Frame pacing: start the CPU frame as late as the measured work
+        // time allows, so it completes just before the predicted vsync
+        // instead of waiting in the queue. Skipped for immediate mode,
+        // where present intervals carry no vsync signal.
+        if (m_FramePacingEnabled && m_PresentIntervalMs > 0.0f &&
+            m_Swapchain->GetActivePresentMode() != VK_PRESENT_MODE_IMMEDIATE_KHR)
+        {
+            // Half a millisecond of slack absorbs scheduler jitter
+            float delayMs = m_PresentIntervalMs - m_FrameWorkMs - 0.5f;
+            if (delayMs > 0.0f)
+            {
+                auto delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<float, std::milli>(delayMs));
+                std::this_thread::sleep_until(m_LastPresentTime + delay);
+            }
+        }
+        m_FrameStartTime = std::chrono::steady_clock::now();
+
         VkDevice device = m_Device->GetDevice();
 
         // Wait for the frame we're about to render to be done
@@ -320,6 +552,10 @@ namespace Genesis
 
         vkResetFences(device, 1, &m_InFlightFences[m_CurrentFrameIndex]);
 
+        // Commit any rebuilt shader pipelines before recording starts; the
+        // fence wait above guarantees this frame slot's old handles are free
+        m_ShaderHotReload.Update();
+
         // Begin command buffer
         VkCommandBuffer cmd = m_CommandBuffers[m_CurrentFrameIndex];
         vkResetCommandBuffer(cmd, 0);
@@ -332,13 +568,40 @@ namespace Genesis
             throw std::runtime_error("Failed to begin recording command buffer!");
         }
 
+        // Resolve last round's GPU timings and reset this slot's queries;
+        // query pool resets must happen outside the render pass
+        ResetStats();
+        m_GpuProfiler.BeginFrame(cmd, m_CurrentFrameIndex, m_Stats);
+        m_GpuProfiler.BeginZone(cmd, "Frame");
+
+        // GPU vegetation culling runs before the render pass so the
+        // indirect draws recorded inside it see this frame's results
+        m_GpuProfiler.BeginZone(cmd, "VegetationCull");
+        m_InstancedRenderer->RecordCull(cmd, m_CurrentFrameIndex);
+        m_GpuProfiler.EndZone(cmd);
+
+        // With a viewport target registered, the scene renders offscreen
+        // and the swapchain pass (begun in EndFrame) carries only the UI.
+        // Latched here so the pass structure stays consistent even if the
+        // target changes mid-frame.
+        m_SceneOffscreen = m_ViewportTarget && m_ViewportTarget->IsValid();
+
         // Begin render pass
         VkRenderPassBeginInfo renderPassInfo{};
         renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        renderPassInfo.renderPass = m_Swapchain->GetRenderPass();
-        renderPassInfo.framebuffer = m_Swapchain->GetFramebuffer(m_CurrentImageIndex);
         renderPassInfo.renderArea.offset = {0, 0};
-        renderPassInfo.renderArea.extent = m_Swapchain->GetExtent();
+        if (m_SceneOffscreen)
+        {
+            renderPassInfo.renderPass = m_ViewportTarget->GetRenderPass();
+            renderPassInfo.framebuffer = m_ViewportTarget->GetFramebuffer();
+            renderPassInfo.renderArea.extent = m_ViewportTarget->GetExtent();
+        }
+        else
+        {
+            renderPassInfo.renderPass = m_Swapchain->GetRenderPass();
+            renderPassInfo.framebuffer = m_Swapchain->GetFramebuffer(m_CurrentImageIndex);
+            renderPassInfo.renderArea.extent = m_Swapchain->GetExtent();
+        }
 
         std::array<VkClearValue, 2> clearValues{};
         clearValues[0].color = {{0.1f, 0.1f, 0.15f, 1.0f}}; // Dark blue-gray background
@@ -347,43 +610,192 @@ namespace Genesis
         renderPassInfo.clearValueCount = static_cast<uint32_t>(clearValues.size());
         renderPassInfo.pClearValues = clearValues.data();
 
-        vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        // All draws go into per-stage secondaries recorded at EndFrame; the
+        // primary only executes them (viewport/scissor are set per secondary)
+        vkCmdBeginRenderPass(cmd, &renderPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 
-        // Set viewport and scissor
-        VkViewport viewport{};
-        viewport.x = 0.0f;
-        viewport.y = 0.0f;
-        viewport.width = static_cast<float>(m_Swapchain->GetExtent().width);
-        viewport.height = static_cast<float>(m_Swapchain->GetExtent().height);
-        viewport.minDepth = 0.0f;
-        viewport.maxDepth = 1.0f;
-        vkCmdSetViewport(cmd, 0, 1, &viewport);
+        m_PendingDraws.clear();
+        m_PendingWaterDraws.clear();
+        m_PickDraws.clear();
+        m_InstancedRequested = false;
 
-        VkRect2D scissor{};
-        scissor.offset = {0, 0};
-        scissor.extent = m_Swapchain->GetExtent();
-        vkCmdSetScissor(cmd, 0, 1, &scissor);
+        // The UI secondary stays open for ImGui to record into during
+        // OnImGuiRender; EndFrame closes it
+        VkCommandBuffer uiCmd = m_UiSecondaries[m_CurrentFrameIndex];
+        BeginSecondary(uiCmd);
+        m_GpuProfiler.BeginZone(uiCmd, "ImGui");
 
         m_FrameStarted = true;
-        ResetStats();
         return true;
     }
 
     void Renderer::EndFrame()
     {
+        GEN_PROFILE_SCOPE("Renderer::EndFrame");
+        GEN_MEM_SCOPE(MemoryTag::Renderer);
         if (!m_FrameStarted)
             return;
 
         VkCommandBuffer cmd = m_CommandBuffers[m_CurrentFrameIndex];
+        VkCommandBuffer sceneCmd = m_SceneSecondaries[m_CurrentFrameIndex];
+        VkCommandBuffer waterCmd = m_WaterSecondaries[m_CurrentFrameIndex];
+        VkCommandBuffer uiCmd = m_UiSecondaries[m_CurrentFrameIndex];
+
+        // Record the scene and water stages on worker threads while the main
+        // thread closes the UI secondary. Each worker fills its own stats so
+        // nothing races; draw counts merge after the join.
+        RenderStats sceneStats{};
+        RenderStats waterStats{};
+        auto sceneTask = std::async(std::launch::async,
+                                    [&] { RecordSceneSecondary(sceneCmd, sceneStats); });
+        auto waterTask = std::async(std::launch::async,
+                                    [&] { RecordWaterSecondary(waterCmd, waterStats); });
+
+        m_GpuProfiler.EndZone(uiCmd);
+        if (vkEndCommandBuffer(uiCmd) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to record UI command buffer!");
+        }
+
+        sceneTask.get();
+        waterTask.get();
+
+        m_Stats.DrawCalls += sceneStats.DrawCalls + waterStats.DrawCalls;
+        m_Stats.TriangleCount += sceneStats.TriangleCount + waterStats.TriangleCount;
+
+        // Re-render only the invalidated shadow cascades, after the scene
+        // worker has filled this frame's terrain indirect buffers. On a
+        // static frame every cascade is clean and the block is skipped
+        // entirely - the cached depth keeps being sampled for free.
+        bool shadowsRecorded = false;
+        if (m_ShadowsEnabled && m_ShadowMap->HasDirtyCascades())
+        {
+            VkCommandBuffer shadowCmd = m_ShadowCommandBuffers[m_CurrentFrameIndex];
+            vkResetCommandBuffer(shadowCmd, 0);
 
-        // End render pass and command buffer
-        vkCmdEndRenderPass(cmd);
+            VkCommandBufferBeginInfo shadowBegin{};
+            shadowBegin.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            if (vkBeginCommandBuffer(shadowCmd, &shadowBegin) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to begin shadow command buffer!");
+            }
+
+            VkExtent2D shadowExtent = m_ShadowMap->GetExtent();
+            VkViewport shadowViewport{0.0f, 0.0f, static_cast<float>(shadowExtent.width),
+                                      static_cast<float>(shadowExtent.height), 0.0f, 1.0f};
+            VkRect2D shadowScissor{{0, 0}, shadowExtent};
+
+            VkClearValue shadowClear{};
+            shadowClear.depthStencil = {1.0f, 0};
+
+            for (int cascade = 0; cascade < ShadowMap::CASCADE_COUNT; cascade++)
+            {
+                if (!m_ShadowMap->IsCascadeDirty(cascade))
+                    continue;
+
+                VkRenderPassBeginInfo passInfo{};
+                passInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+                passInfo.renderPass = m_ShadowMap->GetRenderPass();
+                passInfo.framebuffer = m_ShadowMap->GetFramebuffer(cascade);
+                passInfo.renderArea = {{0, 0}, shadowExtent};
+                passInfo.clearValueCount = 1;
+                passInfo.pClearValues = &shadowClear;
+
+                vkCmdBeginRenderPass(shadowCmd, &passInfo, VK_SUBPASS_CONTENTS_INLINE);
+                vkCmdSetViewport(shadowCmd, 0, 1, &shadowViewport);
+                vkCmdSetScissor(shadowCmd, 0, 1, &shadowScissor);
+
+                m_TerrainIndirect->FlushShadows(shadowCmd, m_DescriptorSets[m_CurrentFrameIndex],
+                                                m_CurrentFrameIndex,
+                                                m_ShadowMap->GetCascadeViewProj(cascade), m_Stats);
+
+                vkCmdEndRenderPass(shadowCmd);
+                m_ShadowMap->MarkCascadeClean(cascade);
+            }
+
+            if (vkEndCommandBuffer(shadowCmd) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to record shadow command buffer!");
+            }
+            shadowsRecorded = true;
+        }
+
+        if (m_SceneOffscreen)
+        {
+            // Scene and water finish in the offscreen viewport target,
+            // whose pass dependencies hand the color image to the fragment
+            // stage; the swapchain pass then draws only the UI, which
+            // samples the target through its ImGui descriptor
+            VkCommandBuffer sceneSecondaries[] = {sceneCmd, waterCmd};
+            vkCmdExecuteCommands(cmd, 2, sceneSecondaries);
+            vkCmdEndRenderPass(cmd);
+
+            VkClearValue uiClear[2]{};
+            uiClear[0].color = {{0.1f, 0.1f, 0.15f, 1.0f}};
+            uiClear[1].depthStencil = {1.0f, 0};
+
+            VkRenderPassBeginInfo uiPassInfo{};
+            uiPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            uiPassInfo.renderPass = m_Swapchain->GetRenderPass();
+            uiPassInfo.framebuffer = m_Swapchain->GetFramebuffer(m_CurrentImageIndex);
+            uiPassInfo.renderArea = {{0, 0}, m_Swapchain->GetExtent()};
+            uiPassInfo.clearValueCount = 2;
+            uiPassInfo.pClearValues = uiClear;
+
+            vkCmdBeginRenderPass(cmd, &uiPassInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            vkCmdExecuteCommands(cmd, 1, &uiCmd);
+            vkCmdEndRenderPass(cmd);
+            m_GpuProfiler.EndZone(cmd);
+        }
+        else
+        {
+            // Execution order is stage order: opaque scene, then transparent
+            // water, then UI on top
+            VkCommandBuffer secondaries[] = {sceneCmd, waterCmd, uiCmd};
+            vkCmdExecuteCommands(cmd, 3, secondaries);
+
+            // End render pass, then close the whole-frame GPU zone opened in
+            // BeginFrame (a secondary-contents pass admits no other commands)
+            vkCmdEndRenderPass(cmd);
+            m_GpuProfiler.EndZone(cmd);
+        }
 
         if (vkEndCommandBuffer(cmd) != VK_SUCCESS)
         {
             throw std::runtime_error("Failed to record command buffer!");
         }
 
+        // Pick pass: an independent small submission through the readback
+        // ring, issued ahead of the main submit so it executes before the
+        // frame fence this frame slot's UBO rewrite waits on
+        if (m_PickRequested)
+        {
+            m_PickRequested = false;
+            if (!m_PickDraws.empty())
+            {
+                VkExtent2D pickExtent = m_SceneOffscreen ? m_ViewportTarget->GetExtent()
+                                                         : m_Swapchain->GetExtent();
+                uint32_t px = static_cast<uint32_t>(
+                    glm::clamp(m_PickCursor.x, 0.0f, 1.0f) * (pickExtent.width - 1));
+                uint32_t py = static_cast<uint32_t>(
+                    glm::clamp(m_PickCursor.y, 0.0f, 1.0f) * (pickExtent.height - 1));
+
+                m_PickingPass->Submit(*m_Device, m_DescriptorSets[m_CurrentFrameIndex],
+                                      *m_TerrainIndirect, m_PickDraws, px, py, pickExtent,
+                                      [this](uint32_t id)
+                                      {
+                                          m_PickResult = id;
+                                          m_PickResultValid = true;
+                                      });
+            }
+            else
+            {
+                // Nothing pickable this frame; deliver the miss immediately
+                m_PickResult = 0;
+                m_PickResultValid = true;
+            }
+        }
+
         // Submit command buffer - use frame-indexed semaphores
         VkSubmitInfo submitInfo{};
         submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -393,8 +805,17 @@ namespace Genesis
         submitInfo.waitSemaphoreCount = 1;
         submitInfo.pWaitSemaphores = waitSemaphores;
         submitInfo.pWaitDstStageMask = waitStages;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = &cmd;
+
+        // Shadow cascades execute before the main pass; the shadow render
+        // pass dependencies order its depth writes against the fragment
+        // reads that sample them
+        VkCommandBuffer submitBuffers[2];
+        uint32_t submitCount = 0;
+        if (shadowsRecorded)
+            submitBuffers[submitCount++] = m_ShadowCommandBuffers[m_CurrentFrameIndex];
+        submitBuffers[submitCount++] = cmd;
+        submitInfo.commandBufferCount = submitCount;
+        submitInfo.pCommandBuffers = submitBuffers;
 
         VkSemaphore signalSemaphores[] = {m_RenderFinishedSemaphoresPerImage[m_CurrentImageIndex]};
         submitInfo.signalSemaphoreCount = 1;
@@ -418,17 +839,57 @@ namespace Genesis
             throw std::runtime_error("Failed to present swap chain image!");
         }
 
+        // Update the pacing estimates; implausible intervals (first frame,
+        // debugger stalls, swapchain recreation) are discarded
+        auto now = std::chrono::steady_clock::now();
+        float interval = std::chrono::duration<float, std::milli>(now - m_LastPresentTime).count();
+        if (interval > 1.0f && interval < 100.0f)
+        {
+            m_PresentIntervalMs = m_PresentIntervalMs > 0.0f
+                                      ? glm::mix(m_PresentIntervalMs, interval, 0.1f)
+                                      : interval;
+        }
+        float work = std::chrono::duration<float, std::milli>(now - m_FrameStartTime).count();
+        m_FrameWorkMs = m_FrameWorkMs > 0.0f ? glm::mix(m_FrameWorkMs, work, 0.1f) : work;
+        m_LastPresentTime = now;
+
         m_CurrentFrameIndex = (m_CurrentFrameIndex + 1) % MAX_FRAMES_IN_FLIGHT;
         m_FrameStarted = false;
     }
 
+    void Renderer::SetPresentMode(PresentMode mode)
+    {
+        if (m_Swapchain->GetPreferredPresentMode() == mode)
+            return;
+
+        m_Swapchain->SetPreferredPresentMode(mode);
+        // Recreating mid-frame would pull the framebuffers out from under
+        // the recorded secondaries; EndFrame picks the flag up after present
+        m_SwapchainNeedsRecreation = true;
+    }
+
+    PresentMode Renderer::GetPresentMode() const
+    {
+        return m_Swapchain->GetPreferredPresentMode();
+    }
+
     void Renderer::BeginScene(const Camera &camera)
     {
+        // Deliver GPU compute results whose fences signalled since last
+        // frame (heightfield readbacks and the like)
+        m_Device->PollReadbacks();
+
         // Update uniform buffer with camera matrices
         m_GlobalUBO.ViewMatrix = camera.GetViewMatrix();
         m_GlobalUBO.ProjectionMatrix = camera.GetProjectionMatrix();
-        // Pack time into w component for water shader
-        m_GlobalUBO.CameraPosition = glm::vec4(camera.GetPosition(), m_Time);
+        m_GlobalUBO.CameraPosition = glm::vec4(camera.GetPosition(), 0.0f);
+
+        // Water animation runs entirely in the vertex shader off these
+        // parameters; no water mesh is ever touched on the CPU
+        m_GlobalUBO.WaterParams = glm::vec4(m_Time, m_WaterSettings.waveHeight,
+                                            m_WaterSettings.waveSpeed, m_WaterSettings.transparency);
+        m_GlobalUBO.WaterShallowColor = glm::vec4(m_WaterSettings.shallowColor, 0.0f);
+        m_GlobalUBO.WaterDeepColor = glm::vec4(m_WaterSettings.deepColor, 0.0f);
 
         // Update lighting data from LightManager
         const auto &dirLight = m_LightManager.GetDirectionalLight();
@@ -452,40 +913,209 @@ namespace Genesis
             m_GlobalUBO.PointLights[i].ColorAndRadius = glm::vec4(light.Color, radius);
         }
 
-        m_UniformBuffers[m_CurrentFrameIndex]->WriteToBuffer(&m_GlobalUBO, sizeof(GlobalUBO));
+        UpdateLightClusters(camera);
+
+        // Place the shadow cascades. A cascade only adopts a new matrix
+        // when it goes dirty, so the matrices the shaders sample with are
+        // always the ones the cached depth was rendered with.
+        if (m_ShadowsEnabled)
+        {
+            m_ShadowMap->UpdateCascades(camera, glm::vec3(m_GlobalUBO.SunDirection),
+                                        m_TerrainIndirect->GetGeometryVersion());
+            for (int i = 0; i < ShadowMap::CASCADE_COUNT; i++)
+            {
+                m_GlobalUBO.SunCascadeViewProj[i] = m_ShadowMap->GetCascadeViewProj(i);
+                m_GlobalUBO.CascadeSplits[i] = m_ShadowMap->GetCascadeSplit(i);
+            }
+            m_GlobalUBO.CascadeSplits.w = m_ShadowMap->GetShadowDistance();
+        }
+        else
+        {
+            m_GlobalUBO.CascadeSplits = glm::vec4(0.0f);
+        }
+
+        m_GlobalUBO.DebugParams = glm::vec4(static_cast<float>(m_DebugViewMode),
+                                            m_DebugViewOpacity, 0.0f, 0.0f);
+        m_GlobalUBO.DebugAtlasParams.x =
+            m_DebugAtlasWorldSize > 0.0f ? 1.0f / m_DebugAtlasWorldSize : 0.0f;
+
+        // The CPU mirror stays authoritative (draw sorting and culling read
+        // it); publishing is one copy into the frame's mapped slice
+        std::memcpy(m_GlobalUboRing.SliceMapped(m_CurrentFrameIndex), &m_GlobalUBO, sizeof(GlobalUBO));
+
+        m_TerrainIndirect->BeginFrame();
+    }
+
+    void Renderer::UpdateLightClusters(const Camera &camera)
+    {
+        int lightCount = std::min(static_cast<int>(m_LightManager.GetPointLights().size()),
+                                  MAX_POINT_LIGHTS);
+
+        // Logarithmic depth slices: slice = log(viewDepth) * scale + bias
+        float nearClip = camera.GetNearClip();
+        float farClip = camera.GetFarClip();
+        float sliceScale = static_cast<float>(CLUSTER_GRID_Z) / std::log(farClip / nearClip);
+        float sliceBias = -sliceScale * std::log(nearClip);
+
+        VkExtent2D extent = m_Swapchain->GetExtent();
+        m_GlobalUBO.ClusterParams = glm::vec4(sliceScale, sliceBias,
+                                              static_cast<float>(extent.width) / CLUSTER_GRID_X,
+                                              static_cast<float>(extent.height) / CLUSTER_GRID_Y);
+
+        // Bin straight into the frame's mapped slice; the in-flight fence
+        // guarantees the GPU finished reading it
+        uint32_t *clusterData = static_cast<uint32_t *>(m_ClusterRing.SliceMapped(m_CurrentFrameIndex));
+        std::memset(clusterData, 0, sizeof(uint32_t) * CLUSTER_COUNT * CLUSTER_STRIDE);
+
+        // NDC maps back to view space as x = ndc_x * depth / P[0][0] (and
+        // P[1][1] for y, which carries the Vulkan Y flip)
+        const glm::mat4 &proj = m_GlobalUBO.ProjectionMatrix;
+        float invProjX = 1.0f / proj[0][0];
+        float invProjY = 1.0f / proj[1][1];
+
+        for (int index = 0; index < lightCount; index++)
+        {
+            const PointLightData &light = m_GlobalUBO.PointLights[index];
+            glm::vec3 viewPos = glm::vec3(m_GlobalUBO.ViewMatrix *
+                                          glm::vec4(glm::vec3(light.PositionAndIntensity), 1.0f));
+            float radius = light.ColorAndRadius.w;
+
+            // View space looks down -Z
+            float depth = -viewPos.z;
+            if (depth + radius < nearClip || depth - radius > farClip)
+                continue;
+
+            float minDepth = std::max(depth - radius, nearClip);
+            float maxDepth = std::min(depth + radius, farClip);
+            int sliceMin = std::clamp(static_cast<int>(std::log(minDepth) * sliceScale + sliceBias),
+                                      0, CLUSTER_GRID_Z - 1);
+            int sliceMax = std::clamp(static_cast<int>(std::log(maxDepth) * sliceScale + sliceBias),
+                                      0, CLUSTER_GRID_Z - 1);
+
+            // The sphere's NDC footprint is widest at one of the depth
+            // extremes, so evaluating both bounds is conservative
+            float ndc[4] = {(viewPos.x - radius) / (minDepth * invProjX),
+                            (viewPos.x + radius) / (minDepth * invProjX),
+                            (viewPos.x - radius) / (maxDepth * invProjX),
+                            (viewPos.x + radius) / (maxDepth * invProjX)};
+            float minNdcX = std::min({ndc[0], ndc[1], ndc[2], ndc[3]});
+            float maxNdcX = std::max({ndc[0], ndc[1], ndc[2], ndc[3]});
+
+            float ndcY[4] = {(viewPos.y - radius) / (minDepth * invProjY),
+                             (viewPos.y + radius) / (minDepth * invProjY),
+                             (viewPos.y - radius) / (maxDepth * invProjY),
+                             (viewPos.y + radius) / (maxDepth * invProjY)};
+            float minNdcY = std::min({ndcY[0], ndcY[1], ndcY[2], ndcY[3]});
+            float maxNdcY = std::max({ndcY[0], ndcY[1], ndcY[2], ndcY[3]});
+
+            int tileMinX = std::clamp(static_cast<int>((minNdcX + 1.0f) * 0.5f * CLUSTER_GRID_X),
+                                      0, CLUSTER_GRID_X - 1);
+            int tileMaxX = std::clamp(static_cast<int>((maxNdcX + 1.0f) * 0.5f * CLUSTER_GRID_X),
+                                      0, CLUSTER_GRID_X - 1);
+            int tileMinY = std::clamp(static_cast<int>((minNdcY + 1.0f) * 0.5f * CLUSTER_GRID_Y),
+                                      0, CLUSTER_GRID_Y - 1);
+            int tileMaxY = std::clamp(static_cast<int>((maxNdcY + 1.0f) * 0.5f * CLUSTER_GRID_Y),
+                                      0, CLUSTER_GRID_Y - 1);
+
+            for (int z = sliceMin; z <= sliceMax; z++)
+            {
+                for (int y = tileMinY; y <= tileMaxY; y++)
+                {
+                    for (int x = tileMinX; x <= tileMaxX; x++)
+                    {
+                        size_t slot = static_cast<size_t>((z * CLUSTER_GRID_Y + y) * CLUSTER_GRID_X + x) *
+                                      CLUSTER_STRIDE;
+                        uint32_t &count = clusterData[slot];
+                        if (count < MAX_LIGHTS_PER_CLUSTER)
+                        {
+                            clusterData[slot + 1 + count] = static_cast<uint32_t>(index);
+                            count++;
+                        }
+                    }
+                }
+            }
+        }
 
-        // Bind pipeline and descriptor sets
-        VkCommandBuffer cmd = m_CommandBuffers[m_CurrentFrameIndex];
-        m_Pipeline->Bind(cmd);
-        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
-                                &m_DescriptorSets[m_CurrentFrameIndex], 0, nullptr);
     }
 
     void Renderer::EndScene()
     {
-        // Flush any batched draw calls (for future optimization)
+        // Nothing to flush: queued draws are recorded into the stage
+        // secondaries when EndFrame runs
     }
 
-    void Renderer::Draw(const Mesh &mesh, const glm::mat4 &transform)
+    namespace
+    {
+        // Camera distances are non-negative, so their raw float bits compare
+        // in the same order as the values and pack into sort keys directly
+        uint32_t DepthBits(float depth)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &depth, sizeof(bits));
+            return bits;
+        }
+
+        uint64_t MeshBits(const Mesh &mesh)
+        {
+            // Heap pointers identify the mesh; the low alignment bits carry
+            // no information
+            return (reinterpret_cast<uintptr_t>(&mesh) >> 4) & 0xFFFFFFFull;
+        }
+    }
+
+    void Renderer::Draw(const Mesh &mesh, const glm::mat4 &transform, uint32_t pickId)
     {
         if (!m_FrameStarted)
             return;
 
-        VkCommandBuffer cmd = m_CommandBuffers[m_CurrentFrameIndex];
+        // Tagged draws also land in the pick list, pooled or not; the pick
+        // pass draws pooled allocations directly from the mega buffers
+        if (pickId != 0)
+            m_PickDraws.push_back({&mesh, transform, pickId});
+
+        // Pooled terrain meshes are batched and issued as one multi-draw
+        // indirect call; stats are counted at flush
+        if (mesh.IsPooled())
+        {
+            m_TerrainIndirect->Submit(mesh.GetPoolAllocation(), transform);
+            return;
+        }
+
+        // Mesh above depth: identical meshes draw consecutively (their
+        // buffer binds are elided at record time), front to back within
+        float depth = glm::length(glm::vec3(transform[3]) - glm::vec3(m_GlobalUBO.CameraPosition));
+        uint64_t key = (MeshBits(mesh) << 32) | DepthBits(depth);
+        // No caller-supplied normal matrix; derive it once here rather than
+        // at record time (and never for pooled meshes, which returned above)
+        m_PendingDraws.push_back({&mesh, transform, glm::transpose(glm::inverse(transform)), key});
+    }
+
+    void Renderer::Draw(const Mesh &mesh, const glm::mat4 &transform,
+                        const glm::mat4 &normalMatrix, uint32_t pickId)
+    {
+        if (!m_FrameStarted)
+            return;
+
+        if (pickId != 0)
+            m_PickDraws.push_back({&mesh, transform, pickId});
 
-        // Push model matrix
-        PushConstantData push{};
-        push.ModelMatrix = transform;
-        push.NormalMatrix = glm::transpose(glm::inverse(transform));
+        if (mesh.IsPooled())
+        {
+            m_TerrainIndirect->Submit(mesh.GetPoolAllocation(), transform);
+            return;
+        }
 
-        vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PushConstantData), &push);
+        float depth = glm::length(glm::vec3(transform[3]) - glm::vec3(m_GlobalUBO.CameraPosition));
+        uint64_t key = (MeshBits(mesh) << 32) | DepthBits(depth);
+        m_PendingDraws.push_back({&mesh, transform, normalMatrix, key});
+    }
 
-        // Bind and draw mesh
-        mesh.Bind(cmd);
-        mesh.Draw(cmd);
+    void Renderer::DrawInstanced()
+    {
+        if (!m_FrameStarted || !m_InstancedRenderer)
+            return;
 
-        m_Stats.DrawCalls++;
-        m_Stats.TriangleCount += mesh.GetIndexCount() / 3;
+        m_InstancedRequested = true;
     }
 
     void Renderer::DrawWater(const Mesh &mesh, const glm::mat4 &transform)
@@ -493,36 +1123,178 @@ namespace Genesis
         if (!m_FrameStarted || !m_WaterSettings.enabled)
             return;
 
-        VkCommandBuffer cmd = m_CommandBuffers[m_CurrentFrameIndex];
+        // Water blends, so depth dominates the key, inverted for back-to-
+        // front submission; mesh identity only breaks ties
+        float depth = glm::length(glm::vec3(transform[3]) - glm::vec3(m_GlobalUBO.CameraPosition));
+        uint64_t key = (static_cast<uint64_t>(~DepthBits(depth)) << 32) | MeshBits(mesh);
+        m_PendingWaterDraws.push_back({&mesh, transform, glm::transpose(glm::inverse(transform)), key});
+    }
 
-        // Switch to water pipeline
-        m_WaterPipeline->Bind(cmd);
-        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
-                                &m_DescriptorSets[m_CurrentFrameIndex], 0, nullptr);
+    void Renderer::DrawWater(const Mesh &mesh, const glm::mat4 &transform,
+                             const glm::mat4 &normalMatrix)
+    {
+        if (!m_FrameStarted || !m_WaterSettings.enabled)
+            return;
 
-        // Push model matrix
-        PushConstantData push{};
-        push.ModelMatrix = transform;
-        push.NormalMatrix = glm::transpose(glm::inverse(transform));
+        float depth = glm::length(glm::vec3(transform[3]) - glm::vec3(m_GlobalUBO.CameraPosition));
+        uint64_t key = (static_cast<uint64_t>(~DepthBits(depth)) << 32) | MeshBits(mesh);
+        m_PendingWaterDraws.push_back({&mesh, transform, normalMatrix, key});
+    }
 
-        vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0, sizeof(PushConstantData), &push);
+    void Renderer::BeginSecondary(VkCommandBuffer cmd, bool toViewportTarget)
+    {
+        // Scene secondaries inherit the swapchain render pass even when they
+        // execute in the viewport target's pass - the two are render-pass
+        // compatible by construction (same attachment formats and samples)
+        VkCommandBufferInheritanceInfo inheritance{};
+        inheritance.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritance.renderPass = m_Swapchain->GetRenderPass();
+        inheritance.subpass = 0;
+        inheritance.framebuffer = toViewportTarget
+                                      ? m_ViewportTarget->GetFramebuffer()
+                                      : m_Swapchain->GetFramebuffer(m_CurrentImageIndex);
 
-        // Bind and draw mesh
-        mesh.Bind(cmd);
-        mesh.Draw(cmd);
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                          VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        beginInfo.pInheritanceInfo = &inheritance;
 
-        m_Stats.DrawCalls++;
-        m_Stats.TriangleCount += mesh.GetIndexCount() / 3;
+        if (vkBeginCommandBuffer(cmd, &beginInfo) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to begin secondary command buffer!");
+        }
 
-        // Switch back to opaque pipeline for any subsequent draws
-        m_Pipeline->Bind(cmd);
-        vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
-                                &m_DescriptorSets[m_CurrentFrameIndex], 0, nullptr);
+        // Dynamic state does not inherit; every secondary sets its own
+        VkExtent2D extent =
+            toViewportTarget ? m_ViewportTarget->GetExtent() : m_Swapchain->GetExtent();
+
+        VkViewport viewport{};
+        viewport.x = 0.0f;
+        viewport.y = 0.0f;
+        viewport.width = static_cast<float>(extent.width);
+        viewport.height = static_cast<float>(extent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        vkCmdSetViewport(cmd, 0, 1, &viewport);
+
+        VkRect2D scissor{};
+        scissor.offset = {0, 0};
+        scissor.extent = extent;
+        vkCmdSetScissor(cmd, 0, 1, &scissor);
+    }
+
+    void Renderer::RecordSceneSecondary(VkCommandBuffer cmd, RenderStats &stats)
+    {
+        BeginSecondary(cmd, m_SceneOffscreen);
+
+        // Batched terrain first, then immediate draws, then vegetation -
+        // the order the immediate-mode path used to interleave
+        if (m_TerrainIndirect->HasPendingDraws())
+        {
+            m_GpuProfiler.BeginZone(cmd, "Terrain");
+            m_TerrainIndirect->Flush(cmd, m_DescriptorSets[m_CurrentFrameIndex],
+                                     m_CurrentFrameIndex, stats);
+            m_GpuProfiler.EndZone(cmd);
+        }
+
+        if (!m_PendingDraws.empty())
+        {
+            std::sort(m_PendingDraws.begin(), m_PendingDraws.end(),
+                      [](const PendingDraw &a, const PendingDraw &b)
+                      { return a.SortKey < b.SortKey; });
+
+            m_Pipeline->Bind(cmd);
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
+                                    &m_DescriptorSets[m_CurrentFrameIndex], 0, nullptr);
+
+            const Mesh *boundMesh = nullptr;
+            for (const PendingDraw &draw : m_PendingDraws)
+            {
+                PushConstantData push{};
+                push.ModelMatrix = draw.Transform;
+                push.NormalMatrix = draw.Normal;
+
+                vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                   sizeof(PushConstantData), &push);
+
+                // The sort grouped identical meshes; rebind only on change
+                if (draw.MeshPtr != boundMesh)
+                {
+                    draw.MeshPtr->Bind(cmd);
+                    boundMesh = draw.MeshPtr;
+                }
+                draw.MeshPtr->Draw(cmd);
+
+                stats.DrawCalls++;
+                stats.TriangleCount += draw.MeshPtr->GetIndexCount() / 3;
+            }
+        }
+
+        if (m_InstancedRequested)
+        {
+            m_GpuProfiler.BeginZone(cmd, "Vegetation");
+            m_InstancedRenderer->Draw(cmd, m_DescriptorSets[m_CurrentFrameIndex],
+                                      m_CurrentFrameIndex, stats);
+            m_GpuProfiler.EndZone(cmd);
+        }
+
+        if (vkEndCommandBuffer(cmd) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to record scene command buffer!");
+        }
+    }
+
+    void Renderer::RecordWaterSecondary(VkCommandBuffer cmd, RenderStats &stats)
+    {
+        BeginSecondary(cmd, m_SceneOffscreen);
+
+        if (!m_PendingWaterDraws.empty())
+        {
+            m_GpuProfiler.BeginZone(cmd, "Water");
+
+            // Back to front (see DrawWater's key); equal depths group by mesh
+            std::sort(m_PendingWaterDraws.begin(), m_PendingWaterDraws.end(),
+                      [](const PendingDraw &a, const PendingDraw &b)
+                      { return a.SortKey < b.SortKey; });
+
+            m_WaterPipeline->Bind(cmd);
+            vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1,
+                                    &m_DescriptorSets[m_CurrentFrameIndex], 0, nullptr);
+
+            const Mesh *boundMesh = nullptr;
+            for (const PendingDraw &draw : m_PendingWaterDraws)
+            {
+                PushConstantData push{};
+                push.ModelMatrix = draw.Transform;
+                push.NormalMatrix = draw.Normal;
+
+                vkCmdPushConstants(cmd, m_PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                   sizeof(PushConstantData), &push);
+
+                if (draw.MeshPtr != boundMesh)
+                {
+                    draw.MeshPtr->Bind(cmd);
+                    boundMesh = draw.MeshPtr;
+                }
+                draw.MeshPtr->Draw(cmd);
+
+                stats.DrawCalls++;
+                stats.TriangleCount += draw.MeshPtr->GetIndexCount() / 3;
+            }
+
+            m_GpuProfiler.EndZone(cmd);
+        }
+
+        if (vkEndCommandBuffer(cmd) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to record water command buffer!");
+        }
     }
 
     void Renderer::RenderScene(Scene &scene)
     {
-        // Iterate through scene entities and render (future implementation)
+        scene.OnRender(*this);
     }
 
     void Renderer::OnWindowResize(uint32_t width, uint32_t height)
@@ -550,29 +1322,49 @@ namespace Genesis
         m_ImagesInFlight.clear();
         m_ImagesInFlight.resize(m_Swapchain->GetImageCount(), VK_NULL_HANDLE);
 
-        // Recreate per-image render-finished semaphores if swapchain image count changed
-        VkDevice device = m_Device->GetDevice();
-        for (VkSemaphore semaphore : m_RenderFinishedSemaphoresPerImage)
+        // Per-image render-finished semaphores only go stale if the image
+        // count changed; on a plain resize the existing set carries over
+        if (m_RenderFinishedSemaphoresPerImage.size() != m_Swapchain->GetImageCount())
         {
-            if (semaphore != VK_NULL_HANDLE)
+            VkDevice device = m_Device->GetDevice();
+            for (VkSemaphore semaphore : m_RenderFinishedSemaphoresPerImage)
             {
-                vkDestroySemaphore(device, semaphore, nullptr);
+                if (semaphore != VK_NULL_HANDLE)
+                {
+                    vkDestroySemaphore(device, semaphore, nullptr);
+                }
             }
-        }
-        m_RenderFinishedSemaphoresPerImage.clear();
-        m_RenderFinishedSemaphoresPerImage.resize(m_Swapchain->GetImageCount());
+            m_RenderFinishedSemaphoresPerImage.clear();
+            m_RenderFinishedSemaphoresPerImage.resize(m_Swapchain->GetImageCount());
 
-        VkSemaphoreCreateInfo semaphoreInfo{};
-        semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-        for (size_t i = 0; i < m_RenderFinishedSemaphoresPerImage.size(); i++)
-        {
-            if (vkCreateSemaphore(device, &semaphoreInfo, nullptr, &m_RenderFinishedSemaphoresPerImage[i]) != VK_SUCCESS)
+            VkSemaphoreCreateInfo semaphoreInfo{};
+            semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            for (size_t i = 0; i < m_RenderFinishedSemaphoresPerImage.size(); i++)
             {
-                throw std::runtime_error("Failed to recreate render-finished semaphores!");
+                if (vkCreateSemaphore(device, &semaphoreInfo, nullptr, &m_RenderFinishedSemaphoresPerImage[i]) != VK_SUCCESS)
+                {
+                    throw std::runtime_error("Failed to recreate render-finished semaphores!");
+                }
             }
         }
     }
 
+    void Renderer::RequestPick(float normX, float normY)
+    {
+        m_PickRequested = true;
+        m_PickCursor = {normX, normY};
+    }
+
+    bool Renderer::TryTakePickResult(uint32_t &id)
+    {
+        if (!m_PickResultValid)
+            return false;
+
+        id = m_PickResult;
+        m_PickResultValid = false;
+        return true;
+    }
+
     void Renderer::ResetStats()
     {
         m_Stats.DrawCalls = 0;
@@ -0,0 +1,128 @@
+#include "genesis/renderer/ShaderHotReload.h"
+#include "genesis/renderer/VulkanPipeline.h"
+#include "genesis/renderer/Renderer.h"
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/Log.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace Genesis
+{
+
+    void ShaderHotReload::Watch(VulkanPipeline *pipeline)
+    {
+        Entry entry;
+        entry.Pipeline = pipeline;
+        entry.Paths = pipeline->GetShaderPaths();
+        entry.Stamps.resize(entry.Paths.size());
+        for (size_t i = 0; i < entry.Paths.size(); ++i)
+        {
+            std::error_code ec;
+            entry.Stamps[i] = std::filesystem::last_write_time(entry.Paths[i], ec);
+        }
+        m_Entries.push_back(std::move(entry));
+    }
+
+    void ShaderHotReload::Unwatch(VulkanPipeline *pipeline)
+    {
+        for (auto &entry : m_Entries)
+        {
+            // A rebuild job may still be running against this pipeline; it
+            // only touches the replacement slot, so waiting it out here keeps
+            // Unwatch safe to call right before the pipeline is destroyed
+            if (entry.Pipeline == pipeline && entry.Build)
+            {
+                while (entry.Build->load() == static_cast<int>(BuildState::Running))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(),
+                                       [pipeline](const Entry &entry)
+                                       { return entry.Pipeline == pipeline; }),
+                        m_Entries.end());
+    }
+
+    void ShaderHotReload::Update()
+    {
+        auto now = std::chrono::steady_clock::now();
+        float sincePoll = std::chrono::duration<float>(now - m_LastPoll).count();
+        bool poll = sincePoll >= POLL_INTERVAL_SECONDS;
+        if (poll)
+        {
+            m_LastPoll = now;
+        }
+
+        for (auto &entry : m_Entries)
+        {
+            // Retire handles from earlier swaps once their frames have drained
+            entry.Pipeline->TickRetirement();
+
+            if (entry.Build)
+            {
+                int state = entry.Build->load(std::memory_order_acquire);
+                if (state == static_cast<int>(BuildState::Running))
+                {
+                    continue;
+                }
+
+                if (state == static_cast<int>(BuildState::Succeeded))
+                {
+                    // The old pipeline may still be referenced by the other
+                    // frame in flight, so it outlives the swap by that many frames
+                    entry.Pipeline->CommitReplacement(Renderer::MAX_FRAMES_IN_FLIGHT);
+                    GEN_INFO("Hot reloaded shader pipeline ({})", entry.Paths.front());
+                }
+                entry.Build = nullptr;
+            }
+
+            if (!poll)
+            {
+                continue;
+            }
+
+            bool changed = false;
+            for (size_t i = 0; i < entry.Paths.size(); ++i)
+            {
+                std::error_code ec;
+                auto stamp = std::filesystem::last_write_time(entry.Paths[i], ec);
+                if (!ec && stamp != entry.Stamps[i])
+                {
+                    // Record the stamp up front: a failed build (e.g. the
+                    // compiler was mid-write) retries when the file settles
+                    // and its stamp moves again, not every poll
+                    entry.Stamps[i] = stamp;
+                    changed = true;
+                }
+            }
+
+            if (!changed)
+            {
+                continue;
+            }
+
+            entry.Build = std::make_shared<std::atomic<int>>(static_cast<int>(BuildState::Running));
+            VulkanPipeline *pipeline = entry.Pipeline;
+            auto build = entry.Build;
+            auto job = [pipeline, build]()
+            {
+                bool ok = pipeline->BuildReplacement();
+                build->store(static_cast<int>(ok ? BuildState::Succeeded : BuildState::Failed),
+                             std::memory_order_release);
+            };
+
+            if (JobSystem::IsInitialized())
+            {
+                JobSystem::Get().Execute(job);
+            }
+            else
+            {
+                job();
+            }
+        }
+    }
+
+}
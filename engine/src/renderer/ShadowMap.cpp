@@ -0,0 +1,429 @@
+#include "genesis/renderer/ShadowMap.h"
+#include "genesis/renderer/Camera.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/core/Log.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Genesis
+{
+
+    void ShadowMap::Init(VulkanDevice &device)
+    {
+        m_Device = &device;
+
+        CreateRenderPass();
+        CreateImage();
+        CreateFramebuffers();
+        CreateSampler();
+
+        // Move the whole array into the sampling layout up front so the
+        // shadow descriptor is valid before the first cascade ever renders
+        VkCommandBuffer cmd = device.BeginSingleTimeCommands();
+
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = m_Image;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = CASCADE_COUNT;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                             0, nullptr, 0, nullptr, 1, &barrier);
+
+        device.EndSingleTimeCommands(cmd);
+
+        GEN_INFO("ShadowMap: {} cascades at {}x{}, shadow distance {}",
+                 CASCADE_COUNT, RESOLUTION, RESOLUTION, m_ShadowDistance);
+    }
+
+    void ShadowMap::Shutdown()
+    {
+        if (!m_Device)
+        {
+            return;
+        }
+
+        VkDevice device = m_Device->GetDevice();
+
+        for (auto &cascade : m_Cascades)
+        {
+            if (cascade.Framebuffer != VK_NULL_HANDLE)
+            {
+                vkDestroyFramebuffer(device, cascade.Framebuffer, nullptr);
+                cascade.Framebuffer = VK_NULL_HANDLE;
+            }
+            if (cascade.LayerView != VK_NULL_HANDLE)
+            {
+                vkDestroyImageView(device, cascade.LayerView, nullptr);
+                cascade.LayerView = VK_NULL_HANDLE;
+            }
+        }
+
+        if (m_Sampler != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(device, m_Sampler, nullptr);
+            m_Sampler = VK_NULL_HANDLE;
+        }
+        if (m_ArrayView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(device, m_ArrayView, nullptr);
+            m_ArrayView = VK_NULL_HANDLE;
+        }
+        if (m_Image != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(device, m_Image, nullptr);
+            m_Image = VK_NULL_HANDLE;
+        }
+        if (m_ImageAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_ImageAllocation);
+            m_ImageAllocation = GpuAllocation{};
+        }
+        if (m_RenderPass != VK_NULL_HANDLE)
+        {
+            vkDestroyRenderPass(device, m_RenderPass, nullptr);
+            m_RenderPass = VK_NULL_HANDLE;
+        }
+
+        m_Device = nullptr;
+    }
+
+    void ShadowMap::CreateRenderPass()
+    {
+        VkAttachmentDescription depthAttachment{};
+        depthAttachment.format = VK_FORMAT_D32_SFLOAT;
+        depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        depthAttachment.finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        VkAttachmentReference depthRef{};
+        depthRef.attachment = 0;
+        depthRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkSubpassDescription subpass{};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 0;
+        subpass.pDepthStencilAttachment = &depthRef;
+
+        // Previous frames sample the cached layer in their fragment stage;
+        // the second dependency makes this frame's depth writes visible to
+        // the fragment stage that samples them
+        VkSubpassDependency dependencies[2]{};
+        dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[0].dstSubpass = 0;
+        dependencies[0].srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        dependencies[0].dstStageMask = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+                                       VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        dependencies[0].dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+        dependencies[1].srcSubpass = 0;
+        dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[1].srcStageMask = VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+        dependencies[1].srcAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        VkRenderPassCreateInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        renderPassInfo.attachmentCount = 1;
+        renderPassInfo.pAttachments = &depthAttachment;
+        renderPassInfo.subpassCount = 1;
+        renderPassInfo.pSubpasses = &subpass;
+        renderPassInfo.dependencyCount = 2;
+        renderPassInfo.pDependencies = dependencies;
+
+        if (vkCreateRenderPass(m_Device->GetDevice(), &renderPassInfo, nullptr, &m_RenderPass) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create shadow render pass!");
+        }
+    }
+
+    void ShadowMap::CreateImage()
+    {
+        VkDevice device = m_Device->GetDevice();
+
+        VkImageCreateInfo imageInfo{};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.extent.width = RESOLUTION;
+        imageInfo.extent.height = RESOLUTION;
+        imageInfo.extent.depth = 1;
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = CASCADE_COUNT;
+        imageInfo.format = VK_FORMAT_D32_SFLOAT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageInfo.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+        if (vkCreateImage(device, &imageInfo, nullptr, &m_Image) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create shadow map image!");
+        }
+
+        VkMemoryRequirements memRequirements;
+        vkGetImageMemoryRequirements(device, m_Image, &memRequirements);
+
+        // Optimal-tiled images sub-allocate from non-linear blocks
+        m_ImageAllocation = m_Device->GetAllocator().Allocate(memRequirements,
+                                                              VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                              false);
+
+        vkBindImageMemory(device, m_Image, m_ImageAllocation.Memory, m_ImageAllocation.Offset);
+
+        VkImageViewCreateInfo viewInfo{};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = m_Image;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+        viewInfo.format = VK_FORMAT_D32_SFLOAT;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+        viewInfo.subresourceRange.baseMipLevel = 0;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = CASCADE_COUNT;
+
+        if (vkCreateImageView(m_Device->GetDevice(), &viewInfo, nullptr, &m_ArrayView) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create shadow map array view!");
+        }
+    }
+
+    void ShadowMap::CreateFramebuffers()
+    {
+        for (int i = 0; i < CASCADE_COUNT; i++)
+        {
+            VkImageViewCreateInfo viewInfo{};
+            viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            viewInfo.image = m_Image;
+            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            viewInfo.format = VK_FORMAT_D32_SFLOAT;
+            viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+            viewInfo.subresourceRange.baseMipLevel = 0;
+            viewInfo.subresourceRange.levelCount = 1;
+            viewInfo.subresourceRange.baseArrayLayer = static_cast<uint32_t>(i);
+            viewInfo.subresourceRange.layerCount = 1;
+
+            if (vkCreateImageView(m_Device->GetDevice(), &viewInfo, nullptr,
+                                  &m_Cascades[i].LayerView) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create shadow cascade view!");
+            }
+
+            VkFramebufferCreateInfo framebufferInfo{};
+            framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+            framebufferInfo.renderPass = m_RenderPass;
+            framebufferInfo.attachmentCount = 1;
+            framebufferInfo.pAttachments = &m_Cascades[i].LayerView;
+            framebufferInfo.width = RESOLUTION;
+            framebufferInfo.height = RESOLUTION;
+            framebufferInfo.layers = 1;
+
+            if (vkCreateFramebuffer(m_Device->GetDevice(), &framebufferInfo, nullptr,
+                                    &m_Cascades[i].Framebuffer) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create shadow cascade framebuffer!");
+            }
+        }
+    }
+
+    void ShadowMap::CreateSampler()
+    {
+        // Comparison sampler: sampler2DArrayShadow resolves the depth test
+        // in hardware, and LINEAR filtering of the comparison results gives
+        // free 2x2 PCF. The white border makes everything outside a
+        // cascade's footprint unshadowed.
+        VkSamplerCreateInfo samplerInfo{};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = VK_FILTER_LINEAR;
+        samplerInfo.minFilter = VK_FILTER_LINEAR;
+        samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+        samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+        samplerInfo.borderColor = VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE;
+        samplerInfo.anisotropyEnable = VK_FALSE;
+        samplerInfo.maxAnisotropy = 1.0f;
+        samplerInfo.compareEnable = VK_TRUE;
+        samplerInfo.compareOp = VK_COMPARE_OP_LESS_OR_EQUAL;
+
+        if (vkCreateSampler(m_Device->GetDevice(), &samplerInfo, nullptr, &m_Sampler) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create shadow sampler!");
+        }
+    }
+
+    void ShadowMap::UpdateCascades(const Camera &camera, const glm::vec3 &sunDirection,
+                                   uint64_t staticGeometryVersion)
+    {
+        glm::vec3 sun = glm::normalize(sunDirection);
+
+        bool allDirty = false;
+        if (staticGeometryVersion != m_CachedGeometryVersion)
+        {
+            m_CachedGeometryVersion = staticGeometryVersion;
+            allDirty = true;
+        }
+        if (glm::dot(sun, m_CachedSunDirection) < SUN_DOT_THRESHOLD)
+        {
+            m_CachedSunDirection = sun;
+            allDirty = true;
+        }
+
+        float nearClip = camera.GetNearClip();
+        float shadowFar = std::min(camera.GetFarClip(), m_ShadowDistance);
+
+        // Practical split scheme: blend of linear and logarithmic splits
+        // keeps near-cascade texel density high without starving the far one
+        float splits[CASCADE_COUNT];
+        for (int i = 0; i < CASCADE_COUNT; i++)
+        {
+            float p = static_cast<float>(i + 1) / static_cast<float>(CASCADE_COUNT);
+            float linearSplit = nearClip + (shadowFar - nearClip) * p;
+            float logSplit = nearClip * std::pow(shadowFar / nearClip, p);
+            splits[i] = glm::mix(linearSplit, logSplit, 0.75f);
+        }
+
+        // Any up vector works as long as it is not parallel to the sun
+        glm::vec3 up = std::abs(sun.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f)
+                                               : glm::vec3(0.0f, 1.0f, 0.0f);
+
+        // Full-frustum corners in world space; slice corners interpolate
+        // along the frustum edges (linear in view depth)
+        glm::mat4 invViewProj = glm::inverse(camera.GetProjectionMatrix() * camera.GetViewMatrix());
+        const glm::vec2 ndc[4] = {{-1.0f, -1.0f}, {1.0f, -1.0f}, {-1.0f, 1.0f}, {1.0f, 1.0f}};
+        glm::vec3 nearCorners[4];
+        glm::vec3 farCorners[4];
+        for (int c = 0; c < 4; c++)
+        {
+            glm::vec4 nearPoint = invViewProj * glm::vec4(ndc[c], -1.0f, 1.0f);
+            glm::vec4 farPoint = invViewProj * glm::vec4(ndc[c], 1.0f, 1.0f);
+            nearCorners[c] = glm::vec3(nearPoint) / nearPoint.w;
+            farCorners[c] = glm::vec3(farPoint) / farPoint.w;
+        }
+
+        float clipRange = camera.GetFarClip() - nearClip;
+        // Rotation-only light frame used for texel snapping
+        glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.0f), sun, up);
+        glm::mat4 invLightRotation = glm::inverse(lightRotation);
+
+        float splitNear = nearClip;
+        for (int i = 0; i < CASCADE_COUNT; i++)
+        {
+            float splitFar = splits[i];
+            Cascade &cascade = m_Cascades[i];
+
+            float t0 = (splitNear - nearClip) / clipRange;
+            float t1 = (splitFar - nearClip) / clipRange;
+
+            // Bounding sphere of the frustum slice. A sphere keeps the
+            // ortho extent constant under camera rotation, which is what
+            // makes texel snapping - and therefore caching - possible.
+            glm::vec3 corners[8];
+            glm::vec3 center(0.0f);
+            for (int c = 0; c < 4; c++)
+            {
+                corners[c] = glm::mix(nearCorners[c], farCorners[c], t0);
+                corners[4 + c] = glm::mix(nearCorners[c], farCorners[c], t1);
+            }
+            for (const glm::vec3 &corner : corners)
+            {
+                center += corner;
+            }
+            center /= 8.0f;
+
+            float radius = 0.0f;
+            for (const glm::vec3 &corner : corners)
+            {
+                radius = std::max(radius, glm::length(corner - center));
+            }
+            // Quantized so tiny aspect/fov jitter cannot thrash the cache
+            radius = std::ceil(radius * 16.0f) / 16.0f;
+
+            // Snap the center to the shadow texel grid in light space, so a
+            // moving camera slides the ortho window in whole-texel steps
+            float texelSize = (2.0f * radius) / static_cast<float>(RESOLUTION);
+            glm::vec3 lightSpaceCenter = glm::vec3(lightRotation * glm::vec4(center, 1.0f));
+            glm::vec2 snapped(std::floor(lightSpaceCenter.x / texelSize) * texelSize,
+                              std::floor(lightSpaceCenter.y / texelSize) * texelSize);
+
+            splitNear = splitFar;
+
+            // Cache hit: the footprint this cascade was rendered with still
+            // covers the slice, so keep the cached depth and its matrix
+            if (!allDirty && !cascade.Dirty && snapped == cascade.SnappedOrigin &&
+                radius == cascade.Radius && splitFar == cascade.SplitDepth)
+            {
+                continue;
+            }
+
+            lightSpaceCenter.x = snapped.x;
+            lightSpaceCenter.y = snapped.y;
+            glm::vec3 snappedCenter = glm::vec3(invLightRotation * glm::vec4(lightSpaceCenter, 1.0f));
+
+            glm::mat4 lightView = glm::lookAt(snappedCenter - sun * (radius + CASTER_MARGIN),
+                                              snappedCenter, up);
+            // _ZO variant: the repo's GLM defaults to -1..1 clip depth, but
+            // Vulkan clips z < 0, which would drop every caster in the near
+            // half of the light volume
+            glm::mat4 lightProj = glm::orthoRH_ZO(-radius, radius, -radius, radius,
+                                                  0.0f, 2.0f * radius + CASTER_MARGIN);
+
+            cascade.ViewProj = lightProj * lightView;
+            cascade.SplitDepth = splitFar;
+            cascade.SnappedOrigin = snapped;
+            cascade.Radius = radius;
+            cascade.Dirty = true;
+        }
+    }
+
+    bool ShadowMap::HasDirtyCascades() const
+    {
+        for (const auto &cascade : m_Cascades)
+        {
+            if (cascade.Dirty)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ShadowMap::InvalidateAll()
+    {
+        for (auto &cascade : m_Cascades)
+        {
+            cascade.Dirty = true;
+        }
+    }
+
+    void ShadowMap::SetShadowDistance(float distance)
+    {
+        if (distance == m_ShadowDistance)
+        {
+            return;
+        }
+        m_ShadowDistance = distance;
+        InvalidateAll();
+    }
+
+}
@@ -0,0 +1,38 @@
+#include "genesis/renderer/UboRing.h"
+#include "genesis/renderer/VulkanDevice.h"
+
+namespace Genesis {
+
+    void UboRing::Init(VulkanDevice& device, VkDeviceSize sliceSize, uint32_t sliceCount,
+                       VkBufferUsageFlags usage) {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(device.GetPhysicalDevice(), &properties);
+
+        // Slices are bound at offsets into one buffer, so the stride must
+        // honor the device's offset alignment for the descriptor type
+        VkDeviceSize alignment = (usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)
+                                     ? properties.limits.minStorageBufferOffsetAlignment
+                                     : properties.limits.minUniformBufferOffsetAlignment;
+
+        m_SliceSize = sliceSize;
+        m_AlignedSliceSize = alignment > 1 ? (sliceSize + alignment - 1) & ~(alignment - 1)
+                                           : sliceSize;
+
+        m_Buffer.Init(device, m_AlignedSliceSize * sliceCount, usage,
+                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        m_Buffer.Map();
+    }
+
+    void UboRing::Shutdown() {
+        if (m_Buffer.GetBuffer() != VK_NULL_HANDLE) {
+            m_Buffer.Shutdown();
+        }
+        m_SliceSize = 0;
+        m_AlignedSliceSize = 0;
+    }
+
+    void* UboRing::SliceMapped(uint32_t slice) const {
+        return static_cast<char*>(m_Buffer.GetMappedMemory()) + SliceOffset(slice);
+    }
+
+}
@@ -0,0 +1,310 @@
+#include "genesis/renderer/ViewportTarget.h"
+#include "genesis/renderer/VulkanDevice.h"
+#include "genesis/core/Log.h"
+
+#include <imgui.h>
+#include <imgui_impl_vulkan.h>
+
+#include <stdexcept>
+
+namespace Genesis
+{
+
+    ViewportTarget::~ViewportTarget()
+    {
+        Shutdown();
+    }
+
+    void ViewportTarget::Init(VulkanDevice &device, VkFormat colorFormat,
+                              VkFormat depthFormat, uint32_t width, uint32_t height)
+    {
+        m_Device = &device;
+        m_ColorFormat = colorFormat;
+        m_DepthFormat = depthFormat;
+        m_Width = width;
+        m_Height = height;
+
+        CreateRenderPass();
+
+        VkSamplerCreateInfo samplerInfo{};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = VK_FILTER_LINEAR;
+        samplerInfo.minFilter = VK_FILTER_LINEAR;
+        samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+
+        if (vkCreateSampler(m_Device->GetDevice(), &samplerInfo, nullptr, &m_Sampler) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create viewport target sampler!");
+        }
+
+        CreateAttachments();
+
+        GEN_DEBUG("ViewportTarget created ({}x{})", width, height);
+    }
+
+    void ViewportTarget::Shutdown()
+    {
+        if (!m_Device)
+        {
+            return;
+        }
+
+        m_Device->WaitIdle();
+        DestroyAttachments();
+
+        VkDevice device = m_Device->GetDevice();
+        if (m_Sampler != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(device, m_Sampler, nullptr);
+            m_Sampler = VK_NULL_HANDLE;
+        }
+        if (m_RenderPass != VK_NULL_HANDLE)
+        {
+            vkDestroyRenderPass(device, m_RenderPass, nullptr);
+            m_RenderPass = VK_NULL_HANDLE;
+        }
+
+        m_Device = nullptr;
+    }
+
+    void ViewportTarget::Resize(uint32_t width, uint32_t height)
+    {
+        if (!m_Device || (width == m_Width && height == m_Height))
+        {
+            return;
+        }
+
+        m_Device->WaitIdle();
+        DestroyAttachments();
+        m_Width = width;
+        m_Height = height;
+        CreateAttachments();
+    }
+
+    void ViewportTarget::CreateRenderPass()
+    {
+        // Attachment formats and sample counts mirror the swapchain pass
+        // for render pass compatibility; only the color finalLayout differs,
+        // handing the image to samplers instead of the presentation engine
+        VkAttachmentDescription attachments[2]{};
+        attachments[0].format = m_ColorFormat;
+        attachments[0].samples = VK_SAMPLE_COUNT_1_BIT;
+        attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+        attachments[0].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[0].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachments[0].finalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+        attachments[1].format = m_DepthFormat;
+        attachments[1].samples = VK_SAMPLE_COUNT_1_BIT;
+        attachments[1].loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        attachments[1].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[1].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[1].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[1].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachments[1].finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference colorRef{};
+        colorRef.attachment = 0;
+        colorRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference depthRef{};
+        depthRef.attachment = 1;
+        depthRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkSubpassDescription subpass{};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount = 1;
+        subpass.pColorAttachments = &colorRef;
+        subpass.pDepthStencilAttachment = &depthRef;
+
+        // The UI pass samples last frame's image before this frame's
+        // attachment writes begin; the second dependency orders this
+        // frame's writes against the fragment stage that samples them
+        VkSubpassDependency dependencies[2]{};
+        dependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[0].dstSubpass = 0;
+        dependencies[0].srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        dependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+
+        dependencies[1].srcSubpass = 0;
+        dependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+        dependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        dependencies[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        VkRenderPassCreateInfo renderPassInfo{};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        renderPassInfo.attachmentCount = 2;
+        renderPassInfo.pAttachments = attachments;
+        renderPassInfo.subpassCount = 1;
+        renderPassInfo.pSubpasses = &subpass;
+        renderPassInfo.dependencyCount = 2;
+        renderPassInfo.pDependencies = dependencies;
+
+        if (vkCreateRenderPass(m_Device->GetDevice(), &renderPassInfo, nullptr, &m_RenderPass) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create viewport render pass!");
+        }
+    }
+
+    void ViewportTarget::CreateAttachments()
+    {
+        VkDevice device = m_Device->GetDevice();
+
+        auto createImage = [&](VkFormat format, VkImageUsageFlags usage,
+                               VkImage &image, GpuAllocation &allocation)
+        {
+            VkImageCreateInfo imageInfo{};
+            imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            imageInfo.imageType = VK_IMAGE_TYPE_2D;
+            imageInfo.extent.width = m_Width;
+            imageInfo.extent.height = m_Height;
+            imageInfo.extent.depth = 1;
+            imageInfo.mipLevels = 1;
+            imageInfo.arrayLayers = 1;
+            imageInfo.format = format;
+            imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+            imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            imageInfo.usage = usage;
+            imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+            imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+
+            if (vkCreateImage(device, &imageInfo, nullptr, &image) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create viewport target image!");
+            }
+
+            VkMemoryRequirements memRequirements;
+            vkGetImageMemoryRequirements(device, image, &memRequirements);
+            allocation = m_Device->GetAllocator().Allocate(memRequirements,
+                                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+                                                           false);
+            vkBindImageMemory(device, image, allocation.Memory, allocation.Offset);
+        };
+
+        auto createView = [&](VkImage image, VkFormat format, VkImageAspectFlags aspect,
+                              VkImageView &view)
+        {
+            VkImageViewCreateInfo viewInfo{};
+            viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            viewInfo.image = image;
+            viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            viewInfo.format = format;
+            viewInfo.subresourceRange.aspectMask = aspect;
+            viewInfo.subresourceRange.baseMipLevel = 0;
+            viewInfo.subresourceRange.levelCount = 1;
+            viewInfo.subresourceRange.baseArrayLayer = 0;
+            viewInfo.subresourceRange.layerCount = 1;
+
+            if (vkCreateImageView(device, &viewInfo, nullptr, &view) != VK_SUCCESS)
+            {
+                throw std::runtime_error("Failed to create viewport target view!");
+            }
+        };
+
+        createImage(m_ColorFormat,
+                    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+                    m_ColorImage, m_ColorAllocation);
+        createView(m_ColorImage, m_ColorFormat, VK_IMAGE_ASPECT_COLOR_BIT, m_ColorView);
+
+        createImage(m_DepthFormat, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                    m_DepthImage, m_DepthAllocation);
+        createView(m_DepthImage, m_DepthFormat, VK_IMAGE_ASPECT_DEPTH_BIT, m_DepthView);
+
+        VkImageView attachments[] = {m_ColorView, m_DepthView};
+        VkFramebufferCreateInfo framebufferInfo{};
+        framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        framebufferInfo.renderPass = m_RenderPass;
+        framebufferInfo.attachmentCount = 2;
+        framebufferInfo.pAttachments = attachments;
+        framebufferInfo.width = m_Width;
+        framebufferInfo.height = m_Height;
+        framebufferInfo.layers = 1;
+
+        if (vkCreateFramebuffer(device, &framebufferInfo, nullptr, &m_Framebuffer) != VK_SUCCESS)
+        {
+            throw std::runtime_error("Failed to create viewport framebuffer!");
+        }
+
+        // Move the color image into the sampling layout up front so the
+        // ImGui descriptor is valid before the first scene pass renders
+        VkCommandBuffer cmd = m_Device->BeginSingleTimeCommands();
+        VkImageMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = m_ColorImage;
+        barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = 1;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = 1;
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                             VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                             0, nullptr, 0, nullptr, 1, &barrier);
+        m_Device->EndSingleTimeCommands(cmd);
+
+        m_ImGuiDescriptor = ImGui_ImplVulkan_AddTexture(m_Sampler, m_ColorView,
+                                                        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+
+    void ViewportTarget::DestroyAttachments()
+    {
+        VkDevice device = m_Device->GetDevice();
+
+        if (m_ImGuiDescriptor != VK_NULL_HANDLE)
+        {
+            ImGui_ImplVulkan_RemoveTexture(m_ImGuiDescriptor);
+            m_ImGuiDescriptor = VK_NULL_HANDLE;
+        }
+        if (m_Framebuffer != VK_NULL_HANDLE)
+        {
+            vkDestroyFramebuffer(device, m_Framebuffer, nullptr);
+            m_Framebuffer = VK_NULL_HANDLE;
+        }
+        if (m_ColorView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(device, m_ColorView, nullptr);
+            m_ColorView = VK_NULL_HANDLE;
+        }
+        if (m_ColorImage != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(device, m_ColorImage, nullptr);
+            m_ColorImage = VK_NULL_HANDLE;
+        }
+        if (m_ColorAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_ColorAllocation);
+            m_ColorAllocation = GpuAllocation{};
+        }
+        if (m_DepthView != VK_NULL_HANDLE)
+        {
+            vkDestroyImageView(device, m_DepthView, nullptr);
+            m_DepthView = VK_NULL_HANDLE;
+        }
+        if (m_DepthImage != VK_NULL_HANDLE)
+        {
+            vkDestroyImage(device, m_DepthImage, nullptr);
+            m_DepthImage = VK_NULL_HANDLE;
+        }
+        if (m_DepthAllocation.IsValid())
+        {
+            m_Device->GetAllocator().Free(m_DepthAllocation);
+            m_DepthAllocation = GpuAllocation{};
+        }
+    }
+
+}
@@ -23,6 +23,27 @@ namespace Genesis {
         bufferInfo.usage = usage;
         bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
+        // Upload destinations are written by the transfer queue (and, for
+        // the readback ring, copied into by the async compute queue) and
+        // read by the graphics queue; concurrent sharing avoids per-use
+        // queue family ownership transfers when those are different families
+        uint32_t sharedFamilies[3] = {};
+        uint32_t sharedCount = 0;
+        if (usage & VK_BUFFER_USAGE_TRANSFER_DST_BIT) {
+            sharedFamilies[sharedCount++] = device.GetQueueFamilies().GraphicsFamily.value();
+            if (device.HasDedicatedTransferQueue()) {
+                sharedFamilies[sharedCount++] = device.GetQueueFamilies().TransferFamily.value();
+            }
+            if (device.HasDedicatedComputeQueue()) {
+                sharedFamilies[sharedCount++] = device.GetQueueFamilies().ComputeFamily.value();
+            }
+        }
+        if (sharedCount > 1) {
+            bufferInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+            bufferInfo.queueFamilyIndexCount = sharedCount;
+            bufferInfo.pQueueFamilyIndices = sharedFamilies;
+        }
+
         if (vkCreateBuffer(device.GetDevice(), &bufferInfo, nullptr, &m_Buffer) != VK_SUCCESS) {
             throw std::runtime_error("Failed to create buffer!");
         }
@@ -30,16 +51,9 @@ namespace Genesis {
         VkMemoryRequirements memRequirements;
         vkGetBufferMemoryRequirements(device.GetDevice(), m_Buffer, &memRequirements);
 
-        VkMemoryAllocateInfo allocInfo{};
-        allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-        allocInfo.allocationSize = memRequirements.size;
-        allocInfo.memoryTypeIndex = FindMemoryType(device.GetPhysicalDevice(), memRequirements.memoryTypeBits, properties);
-
-        if (vkAllocateMemory(device.GetDevice(), &allocInfo, nullptr, &m_Memory) != VK_SUCCESS) {
-            throw std::runtime_error("Failed to allocate buffer memory!");
-        }
+        m_Allocation = device.GetAllocator().Allocate(memRequirements, properties);
 
-        vkBindBufferMemory(device.GetDevice(), m_Buffer, m_Memory, 0);
+        vkBindBufferMemory(device.GetDevice(), m_Buffer, m_Allocation.Memory, m_Allocation.Offset);
     }
 
     void VulkanBuffer::Shutdown() {
@@ -50,21 +64,21 @@ namespace Genesis {
             m_Buffer = VK_NULL_HANDLE;
         }
 
-        if (m_Memory != VK_NULL_HANDLE) {
-            vkFreeMemory(m_Device->GetDevice(), m_Memory, nullptr);
-            m_Memory = VK_NULL_HANDLE;
+        if (m_Allocation.IsValid()) {
+            m_Device->GetAllocator().Free(m_Allocation);
+            m_Allocation = GpuAllocation{};
         }
     }
 
     void VulkanBuffer::Map(VkDeviceSize size, VkDeviceSize offset) {
-        vkMapMemory(m_Device->GetDevice(), m_Memory, offset, size, 0, &m_Mapped);
+        // Blocks are persistently mapped by the allocator; mapping is just
+        // pointer arithmetic into the shared range
+        (void)size;
+        m_Mapped = static_cast<char*>(m_Allocation.Mapped) + offset;
     }
 
     void VulkanBuffer::Unmap() {
-        if (m_Mapped) {
-            vkUnmapMemory(m_Device->GetDevice(), m_Memory);
-            m_Mapped = nullptr;
-        }
+        m_Mapped = nullptr;
     }
 
     void VulkanBuffer::WriteToBuffer(const void* data, VkDeviceSize size, VkDeviceSize offset) {
@@ -79,8 +93,10 @@ namespace Genesis {
     void VulkanBuffer::Flush(VkDeviceSize size, VkDeviceSize offset) {
         VkMappedMemoryRange mappedRange{};
         mappedRange.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        mappedRange.memory = m_Memory;
-        mappedRange.offset = offset;
+        mappedRange.memory = m_Allocation.Memory;
+        // Offsets are relative to the buffer; the sub-allocation shifts them
+        // within the shared block
+        mappedRange.offset = m_Allocation.Offset + offset;
         mappedRange.size = size;
         vkFlushMappedMemoryRanges(m_Device->GetDevice(), 1, &mappedRange);
     }
@@ -1,11 +1,20 @@
 #include "genesis/renderer/VulkanDevice.h"
+#include "genesis/renderer/VulkanBuffer.h"
 #include "genesis/core/Log.h"
 
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <set>
 #include <stdexcept>
 
 namespace Genesis {
 
+    // Alongside the chunk cache (see ChunkCache), relative to the working
+    // directory the apps run from
+    static constexpr const char* PIPELINE_CACHE_PATH = "cache/pipeline_cache.bin";
+
     VulkanDevice::~VulkanDevice() {
         if (m_Device != VK_NULL_HANDLE) {
             Shutdown();
@@ -17,14 +26,56 @@ namespace Genesis {
         PickPhysicalDevice(instance, surface);
         CreateLogicalDevice(surface);
         CreateCommandPool();
+        LoadPipelineCache();
+        m_Allocator.Init(m_PhysicalDevice, m_Device);
     }
 
     void VulkanDevice::Shutdown() {
+        WaitForTransfers();
+        WaitForReadbacks();
+
+        if (m_StagingRing) {
+            m_StagingRing->Shutdown();
+            m_StagingRing.reset();
+        }
+
+        if (m_ReadbackRing) {
+            m_ReadbackRing->Shutdown();
+            m_ReadbackRing.reset();
+        }
+
+        // Descriptor sets die with their pools
+        for (VkDescriptorPool pool : m_DescriptorPools) {
+            vkDestroyDescriptorPool(m_Device, pool, nullptr);
+        }
+        m_DescriptorPools.clear();
+        m_ImageDescriptorCache.clear();
+
+        if (m_ComputeCommandPool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(m_Device, m_ComputeCommandPool, nullptr);
+            m_ComputeCommandPool = VK_NULL_HANDLE;
+        }
+
+        if (m_TransferCommandPool != VK_NULL_HANDLE) {
+            vkDestroyCommandPool(m_Device, m_TransferCommandPool, nullptr);
+            m_TransferCommandPool = VK_NULL_HANDLE;
+        }
+
         if (m_CommandPool != VK_NULL_HANDLE) {
             vkDestroyCommandPool(m_Device, m_CommandPool, nullptr);
             m_CommandPool = VK_NULL_HANDLE;
         }
 
+        if (m_PipelineCache != VK_NULL_HANDLE) {
+            SavePipelineCache();
+            vkDestroyPipelineCache(m_Device, m_PipelineCache, nullptr);
+            m_PipelineCache = VK_NULL_HANDLE;
+        }
+
+        // After the staging ring: every sub-allocation must be freed before
+        // the blocks go away
+        m_Allocator.Shutdown();
+
         if (m_Device != VK_NULL_HANDLE) {
             vkDestroyDevice(m_Device, nullptr);
             m_Device = VK_NULL_HANDLE;
@@ -66,7 +117,9 @@ namespace Genesis {
         std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
         std::set<uint32_t> uniqueQueueFamilies = {
             m_QueueFamilies.GraphicsFamily.value(),
-            m_QueueFamilies.PresentFamily.value()
+            m_QueueFamilies.PresentFamily.value(),
+            m_QueueFamilies.TransferFamily.value(),
+            m_QueueFamilies.ComputeFamily.value()
         };
 
         float queuePriority = 1.0f;
@@ -79,15 +132,51 @@ namespace Genesis {
             queueCreateInfos.push_back(queueCreateInfo);
         }
 
+        VkPhysicalDeviceFeatures supportedFeatures{};
+        vkGetPhysicalDeviceFeatures(m_PhysicalDevice, &supportedFeatures);
+
         VkPhysicalDeviceFeatures deviceFeatures{};
         deviceFeatures.samplerAnisotropy = VK_TRUE;
         deviceFeatures.fillModeNonSolid = VK_TRUE;  // For wireframe rendering
+        // One vkCmdDrawIndexedIndirect with drawCount > 1 for chunk terrain;
+        // optional, the renderer falls back to per-draw indirect calls
+        m_MultiDrawIndirect = supportedFeatures.multiDrawIndirect == VK_TRUE;
+        deviceFeatures.multiDrawIndirect = supportedFeatures.multiDrawIndirect;
+
+        // Descriptor indexing (core in 1.2) for the bindless material
+        // texture array: one runtime-sized sampler array bound once for the
+        // whole terrain pass, indexed in-shader by material ID. Optional;
+        // without it MaterialTextureArray reports unavailable and shading
+        // stays on vertex colors.
+        VkPhysicalDeviceDescriptorIndexingFeatures supportedIndexing{};
+        supportedIndexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &supportedIndexing;
+        vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &features2);
+
+        m_DescriptorIndexing = supportedIndexing.runtimeDescriptorArray == VK_TRUE &&
+                               supportedIndexing.shaderSampledImageArrayNonUniformIndexing == VK_TRUE &&
+                               supportedIndexing.descriptorBindingPartiallyBound == VK_TRUE &&
+                               supportedIndexing.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE &&
+                               supportedIndexing.descriptorBindingVariableDescriptorCount == VK_TRUE;
+
+        VkPhysicalDeviceDescriptorIndexingFeatures enabledIndexing{};
+        enabledIndexing.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+        enabledIndexing.runtimeDescriptorArray = VK_TRUE;
+        enabledIndexing.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+        enabledIndexing.descriptorBindingPartiallyBound = VK_TRUE;
+        enabledIndexing.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+        enabledIndexing.descriptorBindingVariableDescriptorCount = VK_TRUE;
 
         VkDeviceCreateInfo createInfo{};
         createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
         createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
         createInfo.pQueueCreateInfos = queueCreateInfos.data();
         createInfo.pEnabledFeatures = &deviceFeatures;
+        if (m_DescriptorIndexing) {
+            createInfo.pNext = &enabledIndexing;
+        }
 
         std::vector<const char*> deviceExtensions = m_DeviceExtensions;
         
@@ -105,6 +194,15 @@ namespace Genesis {
 
         vkGetDeviceQueue(m_Device, m_QueueFamilies.GraphicsFamily.value(), 0, &m_GraphicsQueue);
         vkGetDeviceQueue(m_Device, m_QueueFamilies.PresentFamily.value(), 0, &m_PresentQueue);
+        vkGetDeviceQueue(m_Device, m_QueueFamilies.TransferFamily.value(), 0, &m_TransferQueue);
+        vkGetDeviceQueue(m_Device, m_QueueFamilies.ComputeFamily.value(), 0, &m_ComputeQueue);
+
+        if (HasDedicatedTransferQueue()) {
+            GEN_INFO("Using dedicated transfer queue (family {})", m_QueueFamilies.TransferFamily.value());
+        }
+        if (HasDedicatedComputeQueue()) {
+            GEN_INFO("Using async compute queue for generation (family {})", m_QueueFamilies.ComputeFamily.value());
+        }
     }
 
     void VulkanDevice::CreateCommandPool() {
@@ -117,6 +215,191 @@ namespace Genesis {
             GEN_FATAL("Failed to create command pool!");
             throw std::runtime_error("Failed to create command pool!");
         }
+
+        VkCommandPoolCreateInfo transferPoolInfo{};
+        transferPoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        transferPoolInfo.queueFamilyIndex = m_QueueFamilies.TransferFamily.value();
+        transferPoolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        if (vkCreateCommandPool(m_Device, &transferPoolInfo, nullptr, &m_TransferCommandPool) != VK_SUCCESS) {
+            GEN_FATAL("Failed to create transfer command pool!");
+            throw std::runtime_error("Failed to create transfer command pool!");
+        }
+
+        VkCommandPoolCreateInfo computePoolInfo{};
+        computePoolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        computePoolInfo.queueFamilyIndex = m_QueueFamilies.ComputeFamily.value();
+        computePoolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+        if (vkCreateCommandPool(m_Device, &computePoolInfo, nullptr, &m_ComputeCommandPool) != VK_SUCCESS) {
+            GEN_FATAL("Failed to create compute command pool!");
+            throw std::runtime_error("Failed to create compute command pool!");
+        }
+    }
+
+    VkDescriptorPool VulkanDevice::GrowDescriptorPool() {
+        // Generic mix covering the set shapes subsystems actually allocate;
+        // a pool that cannot serve a request just triggers another grow
+        static constexpr uint32_t SETS_PER_POOL = 128;
+        VkDescriptorPoolSize poolSizes[4]{};
+        poolSizes[0] = {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, SETS_PER_POOL * 2};
+        poolSizes[1] = {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, SETS_PER_POOL * 2};
+        poolSizes[2] = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, SETS_PER_POOL};
+        poolSizes[3] = {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, SETS_PER_POOL};
+
+        VkDescriptorPoolCreateInfo poolInfo{};
+        poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolInfo.poolSizeCount = 4;
+        poolInfo.pPoolSizes = poolSizes;
+        poolInfo.maxSets = SETS_PER_POOL;
+
+        VkDescriptorPool pool = VK_NULL_HANDLE;
+        if (vkCreateDescriptorPool(m_Device, &poolInfo, nullptr, &pool) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create shared descriptor pool!");
+        }
+        m_DescriptorPools.push_back(pool);
+        return pool;
+    }
+
+    VkDescriptorSet VulkanDevice::AllocateDescriptorSet(VkDescriptorSetLayout layout) {
+        VkDescriptorSetAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.descriptorSetCount = 1;
+        allocInfo.pSetLayouts = &layout;
+
+        VkDescriptorSet set = VK_NULL_HANDLE;
+        if (!m_DescriptorPools.empty()) {
+            allocInfo.descriptorPool = m_DescriptorPools.back();
+            VkResult result = vkAllocateDescriptorSets(m_Device, &allocInfo, &set);
+            if (result == VK_SUCCESS) {
+                return set;
+            }
+            if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL) {
+                throw std::runtime_error("Failed to allocate descriptor set!");
+            }
+        }
+
+        // First allocation, or the current pool is exhausted
+        allocInfo.descriptorPool = GrowDescriptorPool();
+        if (vkAllocateDescriptorSets(m_Device, &allocInfo, &set) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to allocate descriptor set!");
+        }
+        return set;
+    }
+
+    VkDescriptorSet VulkanDevice::GetCachedImageDescriptor(VkDescriptorSetLayout layout,
+                                                           VkSampler sampler, VkImageView view,
+                                                           VkImageLayout imageLayout) {
+        ImageDescriptorKey key{layout, sampler, view};
+        auto it = m_ImageDescriptorCache.find(key);
+        if (it != m_ImageDescriptorCache.end()) {
+            return it->second;
+        }
+
+        VkDescriptorSet set = AllocateDescriptorSet(layout);
+
+        VkDescriptorImageInfo imageInfo{};
+        imageInfo.sampler = sampler;
+        imageInfo.imageView = view;
+        imageInfo.imageLayout = imageLayout;
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = set;
+        write.dstBinding = 0;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.descriptorCount = 1;
+        write.pImageInfo = &imageInfo;
+        vkUpdateDescriptorSets(m_Device, 1, &write, 0, nullptr);
+
+        m_ImageDescriptorCache.emplace(key, set);
+        return set;
+    }
+
+    size_t VulkanDevice::ImageDescriptorKeyHash::operator()(const ImageDescriptorKey& key) const {
+        // Handle bits hashed with the usual 64-bit mix-and-combine
+        auto mix = [](size_t seed, uint64_t value) {
+            return seed ^ (std::hash<uint64_t>{}(value) + 0x9e3779b97f4a7c15ull +
+                           (seed << 6) + (seed >> 2));
+        };
+        size_t seed = mix(0, (uint64_t)key.Layout);
+        seed = mix(seed, (uint64_t)key.Sampler);
+        return mix(seed, (uint64_t)key.View);
+    }
+
+    void VulkanDevice::LoadPipelineCache() {
+        std::vector<char> initialData;
+
+        std::ifstream file(PIPELINE_CACHE_PATH, std::ios::binary | std::ios::ate);
+        if (file.is_open()) {
+            size_t fileSize = static_cast<size_t>(file.tellg());
+            initialData.resize(fileSize);
+            file.seekg(0);
+            file.read(initialData.data(), fileSize);
+        }
+
+        // Reject data written by a different GPU or driver version; the
+        // header layout is fixed by the spec
+        if (!initialData.empty()) {
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(m_PhysicalDevice, &properties);
+
+            bool valid = initialData.size() >= 16 + VK_UUID_SIZE;
+            if (valid) {
+                uint32_t headerVendor = 0;
+                uint32_t headerDevice = 0;
+                std::memcpy(&headerVendor, initialData.data() + 8, sizeof(uint32_t));
+                std::memcpy(&headerDevice, initialData.data() + 12, sizeof(uint32_t));
+                valid = headerVendor == properties.vendorID &&
+                        headerDevice == properties.deviceID &&
+                        std::memcmp(initialData.data() + 16, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+            }
+
+            if (!valid) {
+                GEN_WARN("Discarding stale pipeline cache '{}'", PIPELINE_CACHE_PATH);
+                initialData.clear();
+            }
+        }
+
+        VkPipelineCacheCreateInfo cacheInfo{};
+        cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        cacheInfo.initialDataSize = initialData.size();
+        cacheInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+        if (vkCreatePipelineCache(m_Device, &cacheInfo, nullptr, &m_PipelineCache) != VK_SUCCESS) {
+            // Not fatal: pipelines fall back to uncached creation
+            GEN_WARN("Failed to create pipeline cache, pipelines will compile uncached");
+            m_PipelineCache = VK_NULL_HANDLE;
+            return;
+        }
+
+        if (cacheInfo.initialDataSize > 0) {
+            GEN_TRACE("Loaded pipeline cache ({} bytes)", cacheInfo.initialDataSize);
+        }
+    }
+
+    void VulkanDevice::SavePipelineCache() {
+        size_t dataSize = 0;
+        if (vkGetPipelineCacheData(m_Device, m_PipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0) {
+            return;
+        }
+
+        std::vector<char> data(dataSize);
+        if (vkGetPipelineCacheData(m_Device, m_PipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+            return;
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(std::filesystem::path(PIPELINE_CACHE_PATH).parent_path(), ec);
+
+        std::ofstream file(PIPELINE_CACHE_PATH, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            GEN_WARN("Failed to write pipeline cache '{}'", PIPELINE_CACHE_PATH);
+            return;
+        }
+
+        file.write(data.data(), static_cast<std::streamsize>(dataSize));
+        GEN_TRACE("Saved pipeline cache ({} bytes)", dataSize);
     }
 
     bool VulkanDevice::IsDeviceSuitable(VkPhysicalDevice device, VkSurfaceKHR surface) {
@@ -165,6 +448,47 @@ namespace Genesis {
             i++;
         }
 
+        // Prefer a transfer-only family so uploads run on the DMA engine
+        // without contending with graphics work; accept transfer+compute
+        // before falling back to the graphics family (which always supports
+        // transfer implicitly)
+        for (uint32_t family = 0; family < queueFamilyCount; family++) {
+            VkQueueFlags flags = queueFamilies[family].queueFlags;
+            if (!(flags & VK_QUEUE_TRANSFER_BIT) || (flags & VK_QUEUE_GRAPHICS_BIT)) {
+                continue;
+            }
+            if (!(flags & VK_QUEUE_COMPUTE_BIT)) {
+                indices.TransferFamily = family;
+                break;
+            }
+            if (!indices.TransferFamily.has_value()) {
+                indices.TransferFamily = family;
+            }
+        }
+        if (!indices.TransferFamily.has_value()) {
+            indices.TransferFamily = indices.GraphicsFamily;
+        }
+
+        // Async compute family for generation dispatches: compute-capable
+        // without graphics, preferring one distinct from the transfer
+        // family so compute, DMA and rendering all run concurrently
+        for (uint32_t family = 0; family < queueFamilyCount; family++) {
+            VkQueueFlags flags = queueFamilies[family].queueFlags;
+            if (!(flags & VK_QUEUE_COMPUTE_BIT) || (flags & VK_QUEUE_GRAPHICS_BIT)) {
+                continue;
+            }
+            if (family != indices.TransferFamily.value()) {
+                indices.ComputeFamily = family;
+                break;
+            }
+            if (!indices.ComputeFamily.has_value()) {
+                indices.ComputeFamily = family;
+            }
+        }
+        if (!indices.ComputeFamily.has_value()) {
+            indices.ComputeFamily = indices.GraphicsFamily;
+        }
+
         return indices;
     }
 
@@ -248,4 +572,373 @@ namespace Genesis {
         vkFreeCommandBuffers(m_Device, m_CommandPool, 1, &commandBuffer);
     }
 
+    VkCommandBuffer VulkanDevice::BeginComputeCommands() {
+        // Released by EndComputeCommands; chunk workers dispatch
+        // concurrently and the pool is externally synchronized
+        m_ComputeMutex.lock();
+
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = m_ComputeCommandPool;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer;
+        vkAllocateCommandBuffers(m_Device, &allocInfo, &commandBuffer);
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+        return commandBuffer;
+    }
+
+    void VulkanDevice::EndComputeCommands(VkCommandBuffer commandBuffer) {
+        vkEndCommandBuffer(commandBuffer);
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence;
+        if (vkCreateFence(m_Device, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+            m_ComputeMutex.unlock();
+            GEN_FATAL("Failed to create compute fence!");
+            throw std::runtime_error("Failed to create compute fence!");
+        }
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        // Fence on just this submission: rendering on the graphics queue
+        // is never waited on, and the compute queue keeps accepting work
+        // from other callers as soon as the mutex drops
+        vkQueueSubmit(m_ComputeQueue, 1, &submitInfo, fence);
+        vkWaitForFences(m_Device, 1, &fence, VK_TRUE, UINT64_MAX);
+
+        vkDestroyFence(m_Device, fence, nullptr);
+        vkFreeCommandBuffers(m_Device, m_ComputeCommandPool, 1, &commandBuffer);
+
+        m_ComputeMutex.unlock();
+    }
+
+    VkCommandBuffer VulkanDevice::BeginTransferCommands() {
+        VkCommandBufferAllocateInfo allocInfo{};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandPool = m_TransferCommandPool;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer;
+        vkAllocateCommandBuffers(m_Device, &allocInfo, &commandBuffer);
+
+        VkCommandBufferBeginInfo beginInfo{};
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        vkBeginCommandBuffer(commandBuffer, &beginInfo);
+        return commandBuffer;
+    }
+
+    uint64_t VulkanDevice::SubmitTransferCommands(VkCommandBuffer commandBuffer) {
+        vkEndCommandBuffer(commandBuffer);
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence;
+        if (vkCreateFence(m_Device, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+            GEN_FATAL("Failed to create transfer fence!");
+            throw std::runtime_error("Failed to create transfer fence!");
+        }
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        vkQueueSubmit(m_TransferQueue, 1, &submitInfo, fence);
+
+        InFlightTransfer inFlight;
+        inFlight.Ticket = m_NextTransferTicket++;
+        inFlight.CommandBuffer = commandBuffer;
+        inFlight.Fence = fence;
+        m_InFlightTransfers.push_back(inFlight);
+        return inFlight.Ticket;
+    }
+
+    void VulkanDevice::RetireTransfer() {
+        InFlightTransfer& transfer = m_InFlightTransfers.front();
+        m_LastCompletedTicket = transfer.Ticket;
+        vkDestroyFence(m_Device, transfer.Fence, nullptr);
+        vkFreeCommandBuffers(m_Device, m_TransferCommandPool, 1, &transfer.CommandBuffer);
+        m_InFlightTransfers.pop_front();
+    }
+
+    bool VulkanDevice::IsTransferComplete(uint64_t ticket) {
+        while (!m_InFlightTransfers.empty() &&
+               vkGetFenceStatus(m_Device, m_InFlightTransfers.front().Fence) == VK_SUCCESS) {
+            RetireTransfer();
+        }
+        return ticket <= m_LastCompletedTicket;
+    }
+
+    void VulkanDevice::WaitForTransfers() {
+        while (!m_InFlightTransfers.empty()) {
+            vkWaitForFences(m_Device, 1, &m_InFlightTransfers.front().Fence, VK_TRUE, UINT64_MAX);
+            RetireTransfer();
+        }
+    }
+
+    VkCommandBuffer VulkanDevice::BeginReadbackCommands(bool onComputeQueue) {
+        // Generation dispatches ask for the async compute queue so their
+        // dispatch-plus-copy submission overlaps rendering; everything else
+        // records from the graphics pool
+        if (onComputeQueue && HasDedicatedComputeQueue()) {
+            return BeginComputeCommands();
+        }
+        return BeginSingleTimeCommands();
+    }
+
+    VkDeviceSize VulkanDevice::AllocateReadbackSlice(VkDeviceSize size) {
+        if (!m_ReadbackRing) {
+            m_ReadbackRing = std::make_unique<VulkanBuffer>();
+            m_ReadbackRing->Init(*this, READBACK_RING_SIZE, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            m_ReadbackRing->Map();
+        }
+
+        if (m_ReadbackHead + size > READBACK_RING_SIZE) {
+            m_ReadbackHead = 0;
+        }
+
+        // Backpressure: colliding with a live slice means the ring is
+        // undersized or nobody is polling. Requests retire within a frame or
+        // two in steady state, so this wait never hits in practice.
+        auto overlapsHead = [&](const InFlightReadback& readback) {
+            return !readback.OwnBuffer &&
+                   readback.Offset < m_ReadbackHead + size &&
+                   m_ReadbackHead < readback.Offset + readback.Size;
+        };
+        while (std::any_of(m_InFlightReadbacks.begin(), m_InFlightReadbacks.end(), overlapsHead)) {
+            vkWaitForFences(m_Device, 1, &m_InFlightReadbacks.front().Fence, VK_TRUE, UINT64_MAX);
+            RetireReadback();
+        }
+
+        VkDeviceSize offset = m_ReadbackHead;
+        m_ReadbackHead += (size + 15) & ~VkDeviceSize(15);
+        return offset;
+    }
+
+    uint64_t VulkanDevice::SubmitReadback(VkCommandBuffer commandBuffer, VkBuffer srcBuffer,
+                                          VkDeviceSize srcOffset, VkDeviceSize size,
+                                          ReadbackCallback callback, bool onComputeQueue) {
+        bool computeSubmit = onComputeQueue && HasDedicatedComputeQueue();
+
+        InFlightReadback readback;
+        readback.Size = size;
+        readback.Pool = computeSubmit ? m_ComputeCommandPool : m_CommandPool;
+
+        VkBuffer dstBuffer;
+        if (size > READBACK_RING_SIZE) {
+            readback.OwnBuffer = std::make_unique<VulkanBuffer>();
+            readback.OwnBuffer->Init(*this, size, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                     VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            readback.OwnBuffer->Map();
+            dstBuffer = readback.OwnBuffer->GetBuffer();
+        } else {
+            readback.Offset = AllocateReadbackSlice(size);
+            dstBuffer = m_ReadbackRing->GetBuffer();
+        }
+
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = srcOffset;
+        copyRegion.dstOffset = readback.Offset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+
+        // Make the copy visible to the host read in the callback
+        VkMemoryBarrier barrier{};
+        barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                             VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        vkEndCommandBuffer(commandBuffer);
+
+        VkFenceCreateInfo fenceInfo{};
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        VkFence fence;
+        if (vkCreateFence(m_Device, &fenceInfo, nullptr, &fence) != VK_SUCCESS) {
+            GEN_FATAL("Failed to create readback fence!");
+            throw std::runtime_error("Failed to create readback fence!");
+        }
+
+        VkSubmitInfo submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffer;
+
+        vkQueueSubmit(computeSubmit ? m_ComputeQueue : m_GraphicsQueue, 1, &submitInfo, fence);
+
+        // A compute-queue command buffer came from BeginComputeCommands,
+        // which holds the compute lock until its submission
+        if (computeSubmit) {
+            m_ComputeMutex.unlock();
+        }
+
+        readback.Ticket = m_NextReadbackTicket++;
+        readback.CommandBuffer = commandBuffer;
+        readback.Fence = fence;
+        readback.Callback = std::move(callback);
+        uint64_t ticket = readback.Ticket;
+        m_InFlightReadbacks.push_back(std::move(readback));
+        return ticket;
+    }
+
+    uint64_t VulkanDevice::RequestReadback(VkBuffer srcBuffer, VkDeviceSize srcOffset,
+                                           VkDeviceSize size, ReadbackCallback callback) {
+        return SubmitReadback(BeginReadbackCommands(), srcBuffer, srcOffset, size,
+                              std::move(callback));
+    }
+
+    void VulkanDevice::RetireReadback() {
+        InFlightReadback readback = std::move(m_InFlightReadbacks.front());
+        m_InFlightReadbacks.pop_front();
+        m_LastCompletedReadback = readback.Ticket;
+
+        if (readback.Callback) {
+            const char* data = readback.OwnBuffer
+                                   ? static_cast<const char*>(readback.OwnBuffer->GetMappedMemory())
+                                   : static_cast<const char*>(m_ReadbackRing->GetMappedMemory()) + readback.Offset;
+            readback.Callback(data, readback.Size);
+        }
+
+        vkDestroyFence(m_Device, readback.Fence, nullptr);
+        VkCommandPool pool = readback.Pool != VK_NULL_HANDLE ? readback.Pool : m_CommandPool;
+        if (pool == m_ComputeCommandPool) {
+            // A worker may be recording into the compute pool right now
+            std::lock_guard<std::recursive_mutex> lock(m_ComputeMutex);
+            vkFreeCommandBuffers(m_Device, pool, 1, &readback.CommandBuffer);
+        } else {
+            vkFreeCommandBuffers(m_Device, pool, 1, &readback.CommandBuffer);
+        }
+        if (readback.OwnBuffer) {
+            readback.OwnBuffer->Shutdown();
+        }
+    }
+
+    void VulkanDevice::PollReadbacks() {
+        while (!m_InFlightReadbacks.empty() &&
+               vkGetFenceStatus(m_Device, m_InFlightReadbacks.front().Fence) == VK_SUCCESS) {
+            RetireReadback();
+        }
+    }
+
+    bool VulkanDevice::IsReadbackComplete(uint64_t ticket) {
+        PollReadbacks();
+        return ticket <= m_LastCompletedReadback;
+    }
+
+    void VulkanDevice::WaitForReadbacks() {
+        while (!m_InFlightReadbacks.empty()) {
+            vkWaitForFences(m_Device, 1, &m_InFlightReadbacks.front().Fence, VK_TRUE, UINT64_MAX);
+            RetireReadback();
+        }
+    }
+
+    void VulkanDevice::BeginTransferBatch() {
+        if (m_TransferBatchOpen) {
+            return;
+        }
+
+        if (!m_StagingRing) {
+            m_StagingRing = std::make_unique<VulkanBuffer>();
+            m_StagingRing->Init(*this, STAGING_RING_SIZE, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                                VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            m_StagingRing->Map();
+        }
+
+        // Earlier batches may still be reading the ring; in steady state they
+        // finished frames ago and this returns immediately
+        WaitForTransfers();
+
+        m_TransferCommands = BeginTransferCommands();
+        m_StagingHead = 0;
+        m_TransferBatchOpen = true;
+    }
+
+    uint64_t VulkanDevice::EndTransferBatch() {
+        if (!m_TransferBatchOpen) {
+            return 0;
+        }
+
+        // Submit without waiting: the copy runs on the transfer queue while
+        // the caller keeps generating and the renderer keeps drawing
+        uint64_t ticket = SubmitTransferCommands(m_TransferCommands);
+        m_TransferCommands = VK_NULL_HANDLE;
+        m_TransferBatchOpen = false;
+        return ticket;
+    }
+
+    void VulkanDevice::StageToBuffer(const void* data, VkDeviceSize size, VkBuffer dstBuffer, VkDeviceSize dstOffset) {
+        // Oversized uploads bypass the ring with a one-off staging buffer
+        if (size > STAGING_RING_SIZE) {
+            VulkanBuffer stagingBuffer;
+            stagingBuffer.Init(*this, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                               VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+            stagingBuffer.Map();
+            stagingBuffer.WriteToBuffer(data, size);
+            stagingBuffer.Unmap();
+
+            VkCommandBuffer commandBuffer = BeginSingleTimeCommands();
+            VkBufferCopy copyRegion{};
+            copyRegion.srcOffset = 0;
+            copyRegion.dstOffset = dstOffset;
+            copyRegion.size = size;
+            vkCmdCopyBuffer(commandBuffer, stagingBuffer.GetBuffer(), dstBuffer, 1, &copyRegion);
+            EndSingleTimeCommands(commandBuffer);
+
+            stagingBuffer.Shutdown();
+            return;
+        }
+
+        bool ownBatch = !m_TransferBatchOpen;
+        if (ownBatch) {
+            BeginTransferBatch();
+        }
+
+        // Ring full: submit the transfers recorded so far, wait for the ring
+        // to drain, and start over. The final EndTransferBatch ticket still
+        // covers this segment - fences on one queue signal in submission order.
+        if (m_StagingHead + size > STAGING_RING_SIZE) {
+            SubmitTransferCommands(m_TransferCommands);
+            WaitForTransfers();
+            m_TransferCommands = BeginTransferCommands();
+            m_StagingHead = 0;
+        }
+
+        std::memcpy(static_cast<char*>(m_StagingRing->GetMappedMemory()) + m_StagingHead, data, size);
+
+        VkBufferCopy copyRegion{};
+        copyRegion.srcOffset = m_StagingHead;
+        copyRegion.dstOffset = dstOffset;
+        copyRegion.size = size;
+        vkCmdCopyBuffer(m_TransferCommands, m_StagingRing->GetBuffer(), dstBuffer, 1, &copyRegion);
+
+        // Keep suballocations 16-byte aligned
+        m_StagingHead += (size + 15) & ~VkDeviceSize(15);
+
+        if (ownBatch) {
+            // Callers outside an explicit batch expect the data to be
+            // resident on return
+            EndTransferBatch();
+            WaitForTransfers();
+        }
+    }
+
 }
@@ -17,33 +17,78 @@ namespace Genesis {
     void VulkanPipeline::Init(VulkanDevice& device, const std::string& vertPath, const std::string& fragPath,
                               const PipelineConfig& config) {
         m_Device = &device;
+        m_Kind = Kind::Graphics;
+        m_VertPath = vertPath;
+        m_FragPath = fragPath;
+        m_Config = config;
 
-        auto vertShaderCode = ReadFile(vertPath);
-        auto fragShaderCode = ReadFile(fragPath);
+        m_VertShaderModule = CreateShaderModule(ReadFile(vertPath));
+        m_FragShaderModule = CreateShaderModule(ReadFile(fragPath));
 
-        m_VertShaderModule = CreateShaderModule(vertShaderCode);
-        m_FragShaderModule = CreateShaderModule(fragShaderCode);
+        m_PipelineLayout = config.PipelineLayout;
+        m_Pipeline = CreateGraphicsPipeline(m_VertShaderModule, m_FragShaderModule);
+    }
+
+    void VulkanPipeline::InitDepthOnly(VulkanDevice& device, const std::string& vertPath,
+                                       const PipelineConfig& config) {
+        m_Device = &device;
+        m_Kind = Kind::DepthOnly;
+        m_VertPath = vertPath;
+        m_Config = config;
+
+        // No fragment stage: rasterized depth still lands in the attachment,
+        // and early depth tests never have shading to wait for
+        m_VertShaderModule = CreateShaderModule(ReadFile(vertPath));
+
+        m_PipelineLayout = config.PipelineLayout;
+        m_Pipeline = CreateGraphicsPipeline(m_VertShaderModule, VK_NULL_HANDLE);
+    }
+
+    void VulkanPipeline::InitCompute(VulkanDevice& device, const std::string& compPath, VkPipelineLayout layout) {
+        m_Device = &device;
+        m_BindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+        m_Kind = Kind::Compute;
+        m_CompPath = compPath;
+
+        m_CompShaderModule = CreateShaderModule(ReadFile(compPath));
+
+        m_PipelineLayout = layout;
+        m_Pipeline = CreateComputePipeline(m_CompShaderModule);
+    }
+
+    VkPipeline VulkanPipeline::CreateGraphicsPipeline(VkShaderModule vertModule, VkShaderModule fragModule) {
+        // Work from a local copy: m_Config's internal pointers refer to the
+        // struct it was copied from, so re-point them at the copy's own
+        // ColorBlendAttachment and DynamicStates before Vulkan reads them
+        PipelineConfig config = m_Config;
+        if (config.ColorBlendState.attachmentCount > 0) {
+            config.ColorBlendState.pAttachments = &config.ColorBlendAttachment;
+        }
+        config.DynamicStateInfo.dynamicStateCount = static_cast<uint32_t>(config.DynamicStates.size());
+        config.DynamicStateInfo.pDynamicStates = config.DynamicStates.data();
 
         VkPipelineShaderStageCreateInfo shaderStages[2];
 
+        shaderStages[0] = {};
         shaderStages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
         shaderStages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-        shaderStages[0].module = m_VertShaderModule;
+        shaderStages[0].module = vertModule;
         shaderStages[0].pName = "main";
-        shaderStages[0].flags = 0;
-        shaderStages[0].pNext = nullptr;
-        shaderStages[0].pSpecializationInfo = nullptr;
 
-        shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
-        shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-        shaderStages[1].module = m_FragShaderModule;
-        shaderStages[1].pName = "main";
-        shaderStages[1].flags = 0;
-        shaderStages[1].pNext = nullptr;
-        shaderStages[1].pSpecializationInfo = nullptr;
+        uint32_t stageCount = 1;
+        if (fragModule != VK_NULL_HANDLE) {
+            shaderStages[1] = {};
+            shaderStages[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+            shaderStages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+            shaderStages[1].module = fragModule;
+            shaderStages[1].pName = "main";
+            stageCount = 2;
+        }
 
-        auto bindingDescriptions = Vertex::GetBindingDescriptions();
-        auto attributeDescriptions = Vertex::GetAttributeDescriptions();
+        auto bindingDescriptions = config.VertexBindings.empty() ? Vertex::GetBindingDescriptions()
+                                                                : config.VertexBindings;
+        auto attributeDescriptions = config.VertexAttributes.empty() ? Vertex::GetAttributeDescriptions()
+                                                                     : config.VertexAttributes;
 
         VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -52,11 +97,9 @@ namespace Genesis {
         vertexInputInfo.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributeDescriptions.size());
         vertexInputInfo.pVertexAttributeDescriptions = attributeDescriptions.data();
 
-        m_PipelineLayout = config.PipelineLayout;
-
         VkGraphicsPipelineCreateInfo pipelineInfo{};
         pipelineInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        pipelineInfo.stageCount = 2;
+        pipelineInfo.stageCount = stageCount;
         pipelineInfo.pStages = shaderStages;
         pipelineInfo.pVertexInputState = &vertexInputInfo;
         pipelineInfo.pInputAssemblyState = &config.InputAssemblyState;
@@ -72,9 +115,32 @@ namespace Genesis {
         pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
         pipelineInfo.basePipelineIndex = -1;
 
-        if (vkCreateGraphicsPipelines(m_Device->GetDevice(), VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_Pipeline) != VK_SUCCESS) {
+        VkPipeline pipeline;
+        if (vkCreateGraphicsPipelines(m_Device->GetDevice(), m_Device->GetPipelineCache(), 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
             throw std::runtime_error("Failed to create graphics pipeline!");
         }
+        return pipeline;
+    }
+
+    VkPipeline VulkanPipeline::CreateComputePipeline(VkShaderModule compModule) {
+        VkPipelineShaderStageCreateInfo shaderStage{};
+        shaderStage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        shaderStage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        shaderStage.module = compModule;
+        shaderStage.pName = "main";
+
+        VkComputePipelineCreateInfo pipelineInfo{};
+        pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        pipelineInfo.stage = shaderStage;
+        pipelineInfo.layout = m_PipelineLayout;
+        pipelineInfo.basePipelineHandle = VK_NULL_HANDLE;
+        pipelineInfo.basePipelineIndex = -1;
+
+        VkPipeline pipeline;
+        if (vkCreateComputePipelines(m_Device->GetDevice(), m_Device->GetPipelineCache(), 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS) {
+            throw std::runtime_error("Failed to create compute pipeline!");
+        }
+        return pipeline;
     }
 
     void VulkanPipeline::Shutdown() {
@@ -90,14 +156,107 @@ namespace Genesis {
             m_FragShaderModule = VK_NULL_HANDLE;
         }
 
+        if (m_CompShaderModule != VK_NULL_HANDLE) {
+            vkDestroyShaderModule(device, m_CompShaderModule, nullptr);
+            m_CompShaderModule = VK_NULL_HANDLE;
+        }
+
         if (m_Pipeline != VK_NULL_HANDLE) {
             vkDestroyPipeline(device, m_Pipeline, nullptr);
             m_Pipeline = VK_NULL_HANDLE;
         }
+
+        // Flush anything hot reload still holds on to
+        auto destroyRetired = [device](RetiredPipeline& retired) {
+            if (retired.VertModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, retired.VertModule, nullptr);
+            if (retired.FragModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, retired.FragModule, nullptr);
+            if (retired.CompModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, retired.CompModule, nullptr);
+            if (retired.Pipeline != VK_NULL_HANDLE) vkDestroyPipeline(device, retired.Pipeline, nullptr);
+        };
+        for (auto& retired : m_Retired) {
+            destroyRetired(retired);
+        }
+        m_Retired.clear();
+        if (m_ReplacementReady) {
+            destroyRetired(m_Replacement);
+            m_Replacement = {};
+            m_ReplacementReady = false;
+        }
     }
 
     void VulkanPipeline::Bind(VkCommandBuffer commandBuffer) {
-        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline);
+        vkCmdBindPipeline(commandBuffer, m_BindPoint, m_Pipeline);
+    }
+
+    std::vector<std::string> VulkanPipeline::GetShaderPaths() const {
+        std::vector<std::string> paths;
+        if (!m_VertPath.empty()) paths.push_back(m_VertPath);
+        if (!m_FragPath.empty()) paths.push_back(m_FragPath);
+        if (!m_CompPath.empty()) paths.push_back(m_CompPath);
+        return paths;
+    }
+
+    bool VulkanPipeline::BuildReplacement() {
+        RetiredPipeline replacement{};
+        try {
+            if (m_Kind == Kind::Compute) {
+                replacement.CompModule = CreateShaderModule(ReadFile(m_CompPath));
+                replacement.Pipeline = CreateComputePipeline(replacement.CompModule);
+            } else {
+                replacement.VertModule = CreateShaderModule(ReadFile(m_VertPath));
+                if (m_Kind == Kind::Graphics) {
+                    replacement.FragModule = CreateShaderModule(ReadFile(m_FragPath));
+                }
+                replacement.Pipeline = CreateGraphicsPipeline(replacement.VertModule, replacement.FragModule);
+            }
+        } catch (const std::exception& e) {
+            // A failed rebuild (file mid-write, bad SPIR-V) leaves the live
+            // pipeline untouched; clean up whatever was created before the throw
+            VkDevice device = m_Device->GetDevice();
+            if (replacement.VertModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, replacement.VertModule, nullptr);
+            if (replacement.FragModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, replacement.FragModule, nullptr);
+            if (replacement.CompModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, replacement.CompModule, nullptr);
+            GEN_WARN("Shader pipeline rebuild failed: {}", e.what());
+            return false;
+        }
+
+        m_Replacement = replacement;
+        m_ReplacementReady = true;
+        return true;
+    }
+
+    void VulkanPipeline::CommitReplacement(int retireAfterFrames) {
+        if (!m_ReplacementReady) {
+            return;
+        }
+
+        RetiredPipeline retired{m_Pipeline, m_VertShaderModule, m_FragShaderModule, m_CompShaderModule,
+                                retireAfterFrames};
+        m_Retired.push_back(retired);
+
+        m_Pipeline = m_Replacement.Pipeline;
+        m_VertShaderModule = m_Replacement.VertModule;
+        m_FragShaderModule = m_Replacement.FragModule;
+        m_CompShaderModule = m_Replacement.CompModule;
+        m_Replacement = {};
+        m_ReplacementReady = false;
+    }
+
+    void VulkanPipeline::TickRetirement() {
+        for (size_t i = 0; i < m_Retired.size();) {
+            RetiredPipeline& retired = m_Retired[i];
+            if (--retired.FramesLeft > 0) {
+                ++i;
+                continue;
+            }
+
+            VkDevice device = m_Device->GetDevice();
+            if (retired.VertModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, retired.VertModule, nullptr);
+            if (retired.FragModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, retired.FragModule, nullptr);
+            if (retired.CompModule != VK_NULL_HANDLE) vkDestroyShaderModule(device, retired.CompModule, nullptr);
+            if (retired.Pipeline != VK_NULL_HANDLE) vkDestroyPipeline(device, retired.Pipeline, nullptr);
+            m_Retired.erase(m_Retired.begin() + i);
+        }
     }
 
     void VulkanPipeline::DefaultPipelineConfig(PipelineConfig& config) {
@@ -166,6 +325,33 @@ namespace Genesis {
         config.RasterizationState.cullMode = VK_CULL_MODE_NONE;
     }
 
+    void VulkanPipeline::DepthOnlyPipelineConfig(PipelineConfig& config) {
+        DefaultPipelineConfig(config);
+
+        // The subpass still has a color attachment, so the blend state must
+        // cover it - masking the writes is what makes this depth-only
+        config.ColorBlendAttachment.colorWriteMask = 0;
+    }
+
+    void VulkanPipeline::ShadowPipelineConfig(PipelineConfig& config) {
+        DefaultPipelineConfig(config);
+
+        // The shadow render pass has no color attachments at all
+        config.ColorBlendState.attachmentCount = 0;
+        config.ColorBlendState.pAttachments = nullptr;
+
+        // Constant plus slope-scaled bias pushes the stored depth away from
+        // the surface so the shadow comparison does not self-shadow (acne)
+        config.RasterizationState.depthBiasEnable = VK_TRUE;
+        config.RasterizationState.depthBiasConstantFactor = 1.25f;
+        config.RasterizationState.depthBiasSlopeFactor = 1.75f;
+
+        // A heightfield has no closed backfaces to cull, and the light
+        // projection lacks the camera's Vulkan Y flip so winding would
+        // come out reversed anyway
+        config.RasterizationState.cullMode = VK_CULL_MODE_NONE;
+    }
+
     std::vector<char> VulkanPipeline::ReadFile(const std::string& filepath) {
         std::ifstream file(filepath, std::ios::ate | std::ios::binary);
 
@@ -30,15 +30,50 @@ namespace Genesis {
     }
 
     void VulkanSwapchain::Recreate(uint32_t width, uint32_t height) {
-        Cleanup();
+        VkFormat previousFormat = m_ImageFormat;
+
+        // CreateSwapchain chains the retiring swapchain through oldSwapchain
+        // and destroys it once the replacement exists, so only the
+        // size-dependent resources need tearing down here
+        CleanupSizeDependent();
         CreateSwapchain(width, height);
         CreateImageViews();
-        CreateRenderPass();
+
+        // The render pass depends on formats, not size; it only goes stale
+        // if the surface format itself changed (new monitor, new driver
+        // preference), which is the rare case. Keeping it keeps every
+        // pipeline built against it valid - they all use dynamic
+        // viewport/scissor, so resize never touches them.
+        if (m_RenderPass == VK_NULL_HANDLE || m_ImageFormat != previousFormat) {
+            if (m_RenderPass != VK_NULL_HANDLE) {
+                GEN_WARN("Swapchain surface format changed on resize; rebuilding render pass");
+                vkDestroyRenderPass(m_Device->GetDevice(), m_RenderPass, nullptr);
+                m_RenderPass = VK_NULL_HANDLE;
+            }
+            CreateRenderPass();
+        }
+
         CreateDepthResources();
         CreateFramebuffers();
     }
 
     void VulkanSwapchain::Cleanup() {
+        CleanupSizeDependent();
+
+        VkDevice device = m_Device->GetDevice();
+
+        if (m_RenderPass != VK_NULL_HANDLE) {
+            vkDestroyRenderPass(device, m_RenderPass, nullptr);
+            m_RenderPass = VK_NULL_HANDLE;
+        }
+
+        if (m_Swapchain != VK_NULL_HANDLE) {
+            vkDestroySwapchainKHR(device, m_Swapchain, nullptr);
+            m_Swapchain = VK_NULL_HANDLE;
+        }
+    }
+
+    void VulkanSwapchain::CleanupSizeDependent() {
         VkDevice device = m_Device->GetDevice();
 
         for (auto framebuffer : m_Framebuffers) {
@@ -59,20 +94,10 @@ namespace Genesis {
             m_DepthImageMemory = VK_NULL_HANDLE;
         }
 
-        if (m_RenderPass != VK_NULL_HANDLE) {
-            vkDestroyRenderPass(device, m_RenderPass, nullptr);
-            m_RenderPass = VK_NULL_HANDLE;
-        }
-
         for (auto imageView : m_ImageViews) {
             vkDestroyImageView(device, imageView, nullptr);
         }
         m_ImageViews.clear();
-
-        if (m_Swapchain != VK_NULL_HANDLE) {
-            vkDestroySwapchainKHR(device, m_Swapchain, nullptr);
-            m_Swapchain = VK_NULL_HANDLE;
-        }
     }
 
     void VulkanSwapchain::CreateSwapchain(uint32_t width, uint32_t height) {
@@ -112,11 +137,23 @@ namespace Genesis {
         createInfo.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
         createInfo.presentMode = presentMode;
         createInfo.clipped = VK_TRUE;
-        createInfo.oldSwapchain = VK_NULL_HANDLE;
-
-        if (vkCreateSwapchainKHR(m_Device->GetDevice(), &createInfo, nullptr, &m_Swapchain) != VK_SUCCESS) {
+        // Handing the driver the retiring swapchain lets it recycle the
+        // presentable images instead of allocating a fresh set - the
+        // difference between a resize that stutters and one that doesn't
+        VkSwapchainKHR oldSwapchain = m_Swapchain;
+        createInfo.oldSwapchain = oldSwapchain;
+
+        VkSwapchainKHR newSwapchain = VK_NULL_HANDLE;
+        if (vkCreateSwapchainKHR(m_Device->GetDevice(), &createInfo, nullptr, &newSwapchain) != VK_SUCCESS) {
             throw std::runtime_error("Failed to create swap chain!");
         }
+        m_Swapchain = newSwapchain;
+
+        if (oldSwapchain != VK_NULL_HANDLE) {
+            // The old swapchain is retired by the create above; the caller
+            // already waited for its images to leave flight
+            vkDestroySwapchainKHR(m_Device->GetDevice(), oldSwapchain, nullptr);
+        }
 
         vkGetSwapchainImagesKHR(m_Device->GetDevice(), m_Swapchain, &imageCount, nullptr);
         m_Images.resize(imageCount);
@@ -124,6 +161,7 @@ namespace Genesis {
 
         m_ImageFormat = surfaceFormat.format;
         m_Extent = extent;
+        m_ActivePresentMode = presentMode;
     }
 
     void VulkanSwapchain::CreateImageViews() {
@@ -296,10 +334,22 @@ namespace Genesis {
     }
 
     VkPresentModeKHR VulkanSwapchain::ChooseSwapPresentMode(const std::vector<VkPresentModeKHR>& modes) {
-        for (const auto& mode : modes) {
-            if (mode == VK_PRESENT_MODE_MAILBOX_KHR) {
-                return mode;
+        auto supported = [&modes](VkPresentModeKHR mode) {
+            for (const auto& candidate : modes) {
+                if (candidate == mode) {
+                    return true;
+                }
             }
+            return false;
+        };
+
+        // Honor the preference with graceful fallback; FIFO is the only mode
+        // the spec guarantees
+        if (m_PreferredMode == PresentMode::Immediate && supported(VK_PRESENT_MODE_IMMEDIATE_KHR)) {
+            return VK_PRESENT_MODE_IMMEDIATE_KHR;
+        }
+        if (m_PreferredMode != PresentMode::Fifo && supported(VK_PRESENT_MODE_MAILBOX_KHR)) {
+            return VK_PRESENT_MODE_MAILBOX_KHR;
         }
         return VK_PRESENT_MODE_FIFO_KHR;
     }
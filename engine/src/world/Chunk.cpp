@@ -1,8 +1,10 @@
 #include "genesis/world/Chunk.h"
 #include "genesis/renderer/VulkanDevice.h"
-#include "genesis/procedural/Water.h"
 #include "genesis/procedural/Noise.h"
 #include "genesis/core/Log.h"
+#include "genesis/core/MemoryTracker.h"
+#include "genesis/core/Profiler.h"
+#include <algorithm>
 #include <random>
 #include <cmath>
 
@@ -35,10 +37,20 @@ namespace Genesis
                worldZ >= origin.z && worldZ < origin.z + chunkWorldSize;
     }
 
-    void Chunk::Generate(const TerrainSettings &settings, uint32_t worldSeed, float seaLevel, bool computeHydrology)
+    void Chunk::Generate(const TerrainSettings &settings, uint32_t worldSeed, float seaLevel, HydrologyLod hydrologyLod, const HeightmapBorders *borders)
     {
-        GEN_DEBUG("Chunk::Generate - heightScale: {}, noiseScale: {}, useWarp: {}, hydrology: {}",
-                  settings.heightScale, settings.noiseScale, settings.useWarp, computeHydrology);
+        GEN_PROFILE_SCOPE("Chunk::Generate");
+        // Synchronous wrapper: drive the staged pipeline to completion
+        auto pipeline = GenerateStaged(settings, worldSeed, seaLevel, hydrologyLod, borders);
+        while (pipeline.Resume())
+        {
+        }
+    }
+
+    GenerationCoroutine Chunk::GenerateStaged(TerrainSettings settings, uint32_t worldSeed, float seaLevel, HydrologyLod hydrologyLod, const HeightmapBorders *borders)
+    {
+        GEN_DEBUG("Chunk::Generate - heightScale: {}, noiseScale: {}, useWarp: {}, hydrologyLod: {}",
+                  settings.heightScale, settings.noiseScale, settings.useWarp, static_cast<int>(hydrologyLod));
 
         // Configure terrain generator
         TerrainSettings chunkSettings = settings;
@@ -50,96 +62,347 @@ namespace Genesis
 
         glm::vec3 worldPos = GetWorldPosition();
 
-        // Step 1: Generate heightmap first (needed by all subsequent systems)
-        m_TerrainGenerator.GenerateHeightmapAtOffset(worldPos.x, worldPos.z);
-        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
+        // Chunks entirely inside the deep-ocean band skip the full noise
+        // stack, hydrology and object placement: everything they would
+        // compute sits under tens of metres of water
+        bool oceanOnly = !m_HeightmapRestored && m_TerrainGenerator.IsFullyOceanAt(worldPos.x, worldPos.z);
+
+        // Step 1: Generate heightmap first (needed by all subsequent
+        // systems) - unless a warm compressed copy was restored, which
+        // replaces the whole noise stack with the decode.
+        // Profile scopes close before each co_yield so a parked chunk does
+        // not charge its suspended time to the stage.
+        {
+            GEN_PROFILE_SCOPE("Chunk::Stage::Heightmap");
+            if (m_HeightmapRestored)
+            {
+                // Handed to the generator here rather than in
+                // RestoreWarmHeightmap because SetSettings above clears its
+                // heightmap cache
+                m_TerrainGenerator.SetCachedHeightmap(std::move(m_WarmHeightmap), worldPos.x, worldPos.z);
+                m_WarmHeightmap = std::vector<float>();
+                m_HeightmapRestored = false;
+            }
+            else if (oceanOnly)
+            {
+                m_TerrainGenerator.GenerateOceanHeightmapAtOffset(worldPos.x, worldPos.z, borders);
+            }
+            else
+            {
+                m_TerrainGenerator.GenerateHeightmapAtOffset(worldPos.x, worldPos.z, borders);
+            }
+            ComputeHeightBounds();
+
+            // Min/max pyramid for ray-vs-terrain queries
+            m_HeightQuadtree.Build(m_TerrainGenerator.GetCachedHeightmap(), m_Size + 1, m_Size + 1, m_CellSize);
+        }
+        co_yield "Heightmap";
 
-        // Step 2: Run hydrology pipeline only if requested (expensive for distant chunks)
-        if (computeHydrology)
+        // Step 2: Run hydrology pipeline at the requested tier
+        m_HydrologyLod = hydrologyLod;
+        if (oceanOnly)
         {
-            GenerateHydrology(seaLevel);
-            GenerateClimateAndMaterials(seaLevel);
+            // No rivers or lakes on the open seabed; climate/biome data
+            // still feeds the mesh coloring
+            m_HydrologyLod = HydrologyLod::None;
+            GEN_PROFILE_SCOPE("Chunk::Stage::Climate");
+            GenerateClimateAndBiomes(seaLevel);
+        }
+        else if (hydrologyLod == HydrologyLod::Full)
+        {
+            // Propagate the nested pipeline's suspensions: each hydrology
+            // step is its own parkable stage
+            for (auto hydrology = GenerateHydrologyStaged(seaLevel); hydrology.Resume();)
+            {
+                co_yield hydrology.CurrentStage();
+            }
+            co_yield "Hydrology";
+            {
+                GEN_PROFILE_SCOPE("Chunk::Stage::Climate");
+                GenerateClimateAndMaterials(seaLevel);
+            }
+        }
+        else if (hydrologyLod == HydrologyLod::Coarse)
+        {
+            // Mid-distance chunks: same pipeline on a quarter-resolution
+            // heightmap, so distant rivers and lakes are visible early.
+            // ~1/16 the cost of the full tier, so it stays one stage.
+            {
+                GEN_PROFILE_SCOPE("Chunk::Stage::Hydrology");
+                GenerateCoarseHydrology(seaLevel);
+            }
+            co_yield "Hydrology";
+            {
+                GEN_PROFILE_SCOPE("Chunk::Stage::Climate");
+                GenerateClimateAndBiomes(seaLevel);
+            }
         }
         else
         {
             // For distant chunks, generate lightweight climate/biome data without full hydrology
+            GEN_PROFILE_SCOPE("Chunk::Stage::Climate");
             GenerateClimateAndBiomes(seaLevel);
         }
+        co_yield "Climate";
 
         // Step 3: Build terrain mesh (uses biome-based coloring)
-        auto terrainMesh = GenerateTerrainMesh(worldPos.x, worldPos.z, worldSeed);
-
-        if (terrainMesh)
         {
-            m_Mesh = std::make_unique<Mesh>(terrainMesh->GetVertices(), terrainMesh->GetIndices());
+            GEN_PROFILE_SCOPE("Chunk::Stage::Mesh");
+            auto terrainMesh = GenerateTerrainMesh(worldPos.x, worldPos.z, worldSeed);
+            if (terrainMesh)
+            {
+                m_Mesh = std::make_unique<Mesh>(terrainMesh->TakeVertices(), terrainMesh->TakeIndices());
+            }
         }
+        co_yield "Mesh";
 
-        // Initialize ocean mask and generate below-sea mask
-        m_OceanMask.Initialize(m_Size, m_Size);
-        if (!heightmap.empty())
+        // Build the reduced-resolution LOD pyramid from the same heightmap
+        for (int lod = 1; lod < LOD_COUNT; lod++)
         {
-            m_OceanMask.GenerateBelowSeaMask(heightmap, seaLevel);
+            {
+                GEN_PROFILE_SCOPE("Chunk::Stage::LodMesh");
+                auto lodMesh = m_TerrainGenerator.GenerateLodAtOffset(worldPos.x, worldPos.z, 1 << lod,
+                                                                      &m_MaterialBlender, &m_BiomeClassifier);
+                if (lodMesh)
+                {
+                    m_LodMeshes[lod] = std::make_unique<Mesh>(lodMesh->TakeVertices(), lodMesh->TakeIndices());
+                }
+            }
+            co_yield "LodMesh";
         }
 
-        // Step 4: Generate water meshes for lakes and rivers only if hydrology computed
-        if (computeHydrology)
         {
-            GenerateWaterMeshes(seaLevel);
+            GEN_PROFILE_SCOPE("Chunk::Stage::WaterMeshes");
+
+            // Initialize ocean mask and generate below-sea mask
+            const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
+            m_OceanMask.Initialize(m_Size, m_Size);
+            if (!heightmap.empty())
+            {
+                m_OceanMask.GenerateBelowSeaMask(heightmap, seaLevel);
+            }
+
+            // Step 4: Generate water meshes for lakes and rivers only if hydrology computed.
+            // Ocean water is not meshed per chunk: a single camera-following grid
+            // positioned at sea level covers it (see ChunkManager::Render).
+            if (!oceanOnly && hydrologyLod != HydrologyLod::None)
+            {
+                GenerateWaterMeshes(seaLevel);
+            }
         }
+        co_yield "WaterMeshes";
 
-        // Only generate ocean water plane if there's terrain below sea level
-        // Check if any cells in the ocean mask are marked as below sea level
-        if (m_OceanMask.HasAnyBelowSeaLevel())
+        // Generate object positions (fully submerged chunks place none)
+        if (!oceanOnly)
         {
-            GenerateWater(seaLevel);
+            GEN_PROFILE_SCOPE("Chunk::Stage::Objects");
+            GenerateObjects(worldSeed, seaLevel);
         }
 
-        // Generate object positions
-        GenerateObjects(worldSeed, seaLevel);
-
         m_State = ChunkState::Loading;
     }
 
     std::shared_ptr<Mesh> Chunk::GenerateTerrainMesh(float offsetX, float offsetZ, [[maybe_unused]] uint32_t worldSeed)
     {
+        GEN_PROFILE_SCOPE("Chunk::GenerateTerrainMesh");
         // Delegate all terrain generation to TerrainGenerator (single source of truth)
         // Now uses biome classifier data for coloring if available
         return m_TerrainGenerator.GenerateAtOffset(offsetX, offsetZ, &m_MaterialBlender, &m_BiomeClassifier);
     }
 
-    void Chunk::GenerateHydrology(float seaLevel)
+    GenerationCoroutine Chunk::GenerateHydrologyStaged(float seaLevel)
     {
-        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
-        if (heightmap.empty())
+        if (m_TerrainGenerator.GetCachedHeightmap().empty())
         {
-            GEN_WARN("Chunk::GenerateHydrology - No heightmap available");
-            return;
+            GEN_WARN("Chunk::GenerateHydrologyStaged - No heightmap available");
+            co_return;
         }
 
         int gridWidth = m_Size + 1;
         int gridDepth = m_Size + 1;
 
         // Step 1: Compute drainage graph (flow directions and accumulation)
-        m_DrainageGraph.Compute(heightmap, gridWidth, gridDepth, m_CellSize, seaLevel);
+        {
+            GEN_PROFILE_SCOPE("Chunk::Stage::Drainage");
+            GEN_MEM_SCOPE(MemoryTag::Hydrology);
+            m_DrainageGraph.Compute(m_TerrainGenerator.GetCachedHeightmap(), gridWidth, gridDepth,
+                                    m_CellSize, seaLevel);
+        }
+        co_yield "Drainage";
 
         // Step 2: Generate rivers from drainage data
-        m_RiverGenerator.Configure(0.5f, m_CellSize); // Default river strength
-        m_RiverGenerator.Generate(m_DrainageGraph, heightmap, seaLevel);
+        {
+            GEN_PROFILE_SCOPE("Chunk::Stage::Rivers");
+            GEN_MEM_SCOPE(MemoryTag::Hydrology);
+            m_RiverGenerator.Configure(0.5f, m_CellSize); // Default river strength
+            m_RiverGenerator.Generate(m_DrainageGraph, m_TerrainGenerator.GetCachedHeightmap(), seaLevel);
+        }
+        co_yield "Rivers";
 
         // Step 3: Generate lakes from drainage pits
-        m_LakeGenerator.Generate(m_DrainageGraph, heightmap, seaLevel);
+        {
+            GEN_PROFILE_SCOPE("Chunk::Stage::Lakes");
+            GEN_MEM_SCOPE(MemoryTag::Hydrology);
+            m_LakeGenerator.Generate(m_DrainageGraph, m_TerrainGenerator.GetCachedHeightmap(), seaLevel);
+        }
+        co_yield "Lakes";
 
         // Step 4: Compute unified hydrology data
-        m_HydrologyGenerator.Compute(m_DrainageGraph, m_RiverGenerator, m_LakeGenerator, heightmap, m_CellSize);
-        m_HydrologyData = m_HydrologyGenerator.GetData();
+        {
+            GEN_PROFILE_SCOPE("Chunk::Stage::HydrologyFields");
+            GEN_MEM_SCOPE(MemoryTag::Hydrology);
+            m_HydrologyGenerator.Compute(m_DrainageGraph, m_RiverGenerator, m_LakeGenerator,
+                                         m_TerrainGenerator.GetCachedHeightmap(), m_CellSize);
+            m_HydrologyData = m_HydrologyGenerator.GetData();
+        }
 
         GEN_DEBUG("Chunk::GenerateHydrology - Rivers: {}, Lakes: {}",
                   m_RiverGenerator.GetNetwork().rivers.size(),
                   m_LakeGenerator.GetNetwork().lakes.size());
     }
 
+    void Chunk::GenerateCoarseHydrology(float seaLevel)
+    {
+        GEN_PROFILE_SCOPE("Chunk::GenerateCoarseHydrology");
+        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
+        if (heightmap.empty())
+        {
+            GEN_WARN("Chunk::GenerateCoarseHydrology - No heightmap available");
+            return;
+        }
+
+        // Downsample the heightmap by taking every Nth sample; the coarse
+        // grid keeps the (size+1) convention so edges line up with the chunk
+        constexpr int divisor = COARSE_HYDROLOGY_DIVISOR;
+        int gridWidth = m_Size + 1;
+        int coarseSize = m_Size / divisor;
+        int coarseWidth = coarseSize + 1;
+        float coarseCellSize = m_CellSize * divisor;
+
+        m_CoarseHeightmap.resize(static_cast<size_t>(coarseWidth) * coarseWidth);
+        for (int z = 0; z < coarseWidth; z++)
+        {
+            for (int x = 0; x < coarseWidth; x++)
+            {
+                size_t srcIdx = static_cast<size_t>(z * divisor) * gridWidth + x * divisor;
+                m_CoarseHeightmap[static_cast<size_t>(z) * coarseWidth + x] = heightmap[srcIdx];
+            }
+        }
+
+        // Same pipeline as GenerateHydrology on 1/16 the cells
+        m_DrainageGraph.Compute(m_CoarseHeightmap, coarseWidth, coarseWidth, coarseCellSize, seaLevel);
+
+        m_RiverGenerator.Configure(0.5f, coarseCellSize);
+        m_RiverGenerator.Generate(m_DrainageGraph, m_CoarseHeightmap, seaLevel);
+
+        m_LakeGenerator.Generate(m_DrainageGraph, m_CoarseHeightmap, seaLevel);
+
+        m_HydrologyGenerator.Compute(m_DrainageGraph, m_RiverGenerator, m_LakeGenerator, m_CoarseHeightmap, coarseCellSize);
+        m_HydrologyData = m_HydrologyGenerator.GetData();
+
+        GEN_DEBUG("Chunk::GenerateCoarseHydrology - Rivers: {}, Lakes: {}",
+                  m_RiverGenerator.GetNetwork().rivers.size(),
+                  m_LakeGenerator.GetNetwork().lakes.size());
+    }
+
+    void Chunk::RefreshStitchedAccumulation()
+    {
+        const DrainageData &drainage = m_DrainageGraph.GetData();
+        if (drainage.flowAccumulation.size() != m_HydrologyData.flowAccumulation.size())
+        {
+            return; // Hydrology was skipped for this chunk
+        }
+
+        m_HydrologyData.flowAccumulation = drainage.flowAccumulation;
+    }
+
+    const RiverSegment *Chunk::FindNearestRiverSegment(float localX, float localZ, float maxDistance) const
+    {
+        if (m_HydrologyLod == HydrologyLod::None || !m_HasRivers)
+            return nullptr;
+
+        // Segment cells live in the grid the hydrology tier ran on: the
+        // coarse tier downsampled by COARSE_HYDROLOGY_DIVISOR
+        float hydroCellSize = m_CellSize;
+        if (m_HydrologyLod == HydrologyLod::Coarse)
+            hydroCellSize *= COARSE_HYDROLOGY_DIVISOR;
+
+        return m_RiverGenerator.FindNearestSegment(localX / hydroCellSize, localZ / hydroCellSize,
+                                                   maxDistance / hydroCellSize);
+    }
+
+    glm::vec3 Chunk::GetRiverSegmentWorldPosition(const RiverSegment &segment) const
+    {
+        float hydroCellSize = m_CellSize;
+        if (m_HydrologyLod == HydrologyLod::Coarse)
+            hydroCellSize *= COARSE_HYDROLOGY_DIVISOR;
+
+        glm::vec3 worldPos = GetWorldPosition();
+        return glm::vec3(worldPos.x + (segment.cell.x + 0.5f) * hydroCellSize,
+                         segment.surfaceHeight,
+                         worldPos.z + (segment.cell.y + 0.5f) * hydroCellSize);
+    }
+
+    bool Chunk::BuildDebugFieldBlock(std::vector<uint8_t> &outRgba) const
+    {
+        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
+        if (heightmap.empty())
+            return false;
+
+        const auto &settings = m_TerrainGenerator.GetSettings();
+        const BiomeData &biomes = m_BiomeClassifier.GetData();
+
+        int gridWidth = m_Size + 1;
+        float invHeightScale = settings.heightScale > 0.0f ? 1.0f / settings.heightScale : 0.0f;
+
+        outRgba.resize(static_cast<size_t>(m_Size) * m_Size * 4);
+
+        for (int z = 0; z < m_Size; z++)
+        {
+            for (int x = 0; x < m_Size; x++)
+            {
+                size_t texel = (static_cast<size_t>(z) * m_Size + x) * 4;
+
+                float h = heightmap[static_cast<size_t>(z) * gridWidth + x];
+                float heightNorm = glm::clamp((h - settings.baseHeight) * invHeightScale, 0.0f, 1.0f);
+                outRgba[texel + 0] = static_cast<uint8_t>(heightNorm * 255.0f + 0.5f);
+
+                // Hydrology fields may be at coarse resolution (or absent
+                // entirely at HydrologyLod::None)
+                uint8_t flowByte = 0;
+                uint8_t moistureByte = 0;
+                if (m_HydrologyData.width > 0)
+                {
+                    int hx = std::min(x * m_HydrologyData.width / m_Size, m_HydrologyData.width - 1);
+                    int hz = std::min(z * m_HydrologyData.depth / m_Size, m_HydrologyData.depth - 1);
+                    size_t hydroIdx = m_HydrologyData.Index(hx, hz);
+
+                    // Flow accumulation spans orders of magnitude; log-map it so
+                    // small streams stay visible next to trunk rivers
+                    float flowNorm = std::log2(1.0f + static_cast<float>(m_HydrologyData.flowAccumulation[hydroIdx])) / 16.0f;
+                    flowByte = static_cast<uint8_t>(glm::clamp(flowNorm, 0.0f, 1.0f) * 255.0f + 0.5f);
+                    moistureByte = m_HydrologyData.moisture.Raw(hydroIdx);
+                }
+                outRgba[texel + 1] = flowByte;
+                outRgba[texel + 2] = moistureByte;
+
+                uint8_t biomeByte = 0;
+                if (biomes.width > 0)
+                {
+                    int bx = std::min(x * biomes.width / m_Size, biomes.width - 1);
+                    int bz = std::min(z * biomes.depth / m_Size, biomes.depth - 1);
+                    biomeByte = static_cast<uint8_t>(biomes.dominantBiome[static_cast<size_t>(bz) * biomes.width + bx]);
+                }
+                outRgba[texel + 3] = biomeByte;
+            }
+        }
+
+        return true;
+    }
+
     void Chunk::GenerateClimateAndMaterials(float seaLevel)
     {
+        GEN_PROFILE_SCOPE("Chunk::GenerateClimateAndMaterials");
         const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
         const auto &settings = m_TerrainGenerator.GetSettings();
 
@@ -151,10 +414,10 @@ namespace Genesis
 
         glm::vec3 worldPos = GetWorldPosition();
 
-        // Initialize climate generator with noise
-        SimplexNoise noise(settings.seed);
+        // Initialize climate generator with the seed's shared noise state
+        std::shared_ptr<const SimplexNoise> noise = NoiseState::Get(settings.seed);
         ClimateSettings climateSettings;
-        m_ClimateGenerator.Initialize(&noise, climateSettings);
+        m_ClimateGenerator.Initialize(noise.get(), climateSettings);
 
         // Grid dimensions (heightmap is (width+1) x (depth+1))
         int gridWidth = m_Size + 1;
@@ -186,6 +449,7 @@ namespace Genesis
 
     void Chunk::GenerateClimateAndBiomes(float seaLevel)
     {
+        GEN_PROFILE_SCOPE("Chunk::GenerateClimateAndBiomes");
         // Lightweight version of GenerateClimateAndMaterials for distant chunks
         // Generates climate and biome data without full hydrology computation
         const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
@@ -199,10 +463,10 @@ namespace Genesis
 
         glm::vec3 worldPos = GetWorldPosition();
 
-        // Initialize climate generator with noise
-        SimplexNoise noise(settings.seed);
+        // Initialize climate generator with the seed's shared noise state
+        std::shared_ptr<const SimplexNoise> noise = NoiseState::Get(settings.seed);
         ClimateSettings climateSettings;
-        m_ClimateGenerator.Initialize(&noise, climateSettings);
+        m_ClimateGenerator.Initialize(noise.get(), climateSettings);
 
         // Grid dimensions (heightmap is (width+1) x (depth+1))
         int gridWidth = m_Size + 1;
@@ -225,7 +489,13 @@ namespace Genesis
 
     void Chunk::GenerateWaterMeshes([[maybe_unused]] float seaLevel)
     {
-        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
+        GEN_PROFILE_SCOPE("Chunk::GenerateWaterMeshes");
+        // Coarse-tier networks live on the downsampled grid, so their
+        // meshes scale cell coordinates by the coarse cell size
+        bool coarse = m_HydrologyLod == HydrologyLod::Coarse;
+        const auto &heightmap = coarse ? m_CoarseHeightmap
+                                       : m_TerrainGenerator.GetCachedHeightmap();
+        float meshCellSize = coarse ? m_CellSize * COARSE_HYDROLOGY_DIVISOR : m_CellSize;
 
         // Generate lake meshes in local coordinates (chunk transform handles world position)
         const auto &lakeNetwork = m_LakeGenerator.GetNetwork();
@@ -233,11 +503,11 @@ namespace Genesis
         {
             // Use zero offset - meshes should be in local chunk space
             glm::vec3 localOffset(0.0f);
-            auto lakeMeshes = m_LakeMeshGenerator.Generate(lakeNetwork, heightmap, m_CellSize, localOffset);
+            auto lakeMeshes = m_LakeMeshGenerator.Generate(lakeNetwork, heightmap, meshCellSize, localOffset);
             auto combinedLakeMesh = m_LakeMeshGenerator.CreateCombinedMesh(lakeMeshes);
             if (combinedLakeMesh && !combinedLakeMesh->GetVertices().empty())
             {
-                m_LakeMesh = std::make_unique<Mesh>(combinedLakeMesh->GetVertices(), combinedLakeMesh->GetIndices());
+                m_LakeMesh = std::make_unique<Mesh>(combinedLakeMesh->TakeVertices(), combinedLakeMesh->TakeIndices());
                 m_HasLakes = true;
             }
         }
@@ -248,10 +518,10 @@ namespace Genesis
         {
             // Use zero offset - meshes should be in local chunk space
             glm::vec3 localOffset(0.0f);
-            auto riverMesh = m_RiverMeshGenerator.GenerateCombinedMesh(riverNetwork, heightmap, m_CellSize, localOffset);
+            auto riverMesh = m_RiverMeshGenerator.GenerateCombinedMesh(riverNetwork, heightmap, meshCellSize, localOffset);
             if (riverMesh && !riverMesh->GetVertices().empty())
             {
-                m_RiverMesh = std::make_unique<Mesh>(riverMesh->GetVertices(), riverMesh->GetIndices());
+                m_RiverMesh = std::make_unique<Mesh>(riverMesh->TakeVertices(), riverMesh->TakeIndices());
                 m_HasRivers = true;
             }
         }
@@ -261,6 +531,7 @@ namespace Genesis
 
     void Chunk::GenerateObjects(uint32_t worldSeed, float seaLevel)
     {
+        GEN_PROFILE_SCOPE("Chunk::GenerateObjects");
         const auto &settings = m_TerrainGenerator.GetSettings();
         glm::vec3 worldPos = GetWorldPosition();
         float chunkWorldSize = m_Size * m_CellSize;
@@ -268,246 +539,123 @@ namespace Genesis
         uint32_t chunkSeed = worldSeed ^ (static_cast<uint32_t>(m_ChunkX * 198491317) ^
                                           static_cast<uint32_t>(m_ChunkZ * 6542989));
         std::mt19937 rng(chunkSeed);
-        std::uniform_real_distribution<float> distPos(0.0f, chunkWorldSize);
+        std::uniform_real_distribution<float> distJitter(0.15f, 0.85f);
         std::uniform_real_distribution<float> distProb(0.0f, 1.0f);
+        std::uniform_real_distribution<float> distRotation(0.0f, 6.28318530717958647692f);
+        std::uniform_real_distribution<float> distTreeScale(0.8f, 1.2f);
+        std::uniform_real_distribution<float> distRockScale(0.5f, 1.5f);
 
         float minHeight = settings.baseHeight;
         float maxHeight = settings.baseHeight + settings.heightScale;
         float heightRange = maxHeight - minHeight;
 
-        int numSamples = static_cast<int>((chunkWorldSize * chunkWorldSize) / 25.0f);
-        m_TreePositions.reserve(numSamples / 4);
-        m_RockPositions.reserve(numSamples / 6);
-
         // Normalized height thresholds for object placement
         constexpr float SHORE_LEVEL = 0.25f; // Below this is beach/shore
         constexpr float TREELINE = 0.8f;     // Above this is alpine/rock
 
-        for (int i = 0; i < numSamples; i++)
-        {
-            float localX = distPos(rng);
-            float localZ = distPos(rng);
-            float height = GetHeightAtLocal(localX, localZ);
+        // Jittered-grid Poisson-disk scatter: one candidate per spacing-sized
+        // grid cell, jittered away from the cell edges so neighbours keep
+        // their distance. Linear in candidate count with no rejection loops;
+        // the climate/biome density field decides acceptance per candidate.
+        constexpr float TREE_SPACING = 4.0f;
+        constexpr float ROCK_SPACING = 6.0f;
 
-            if (height <= seaLevel + 0.5f)
-                continue;
+        const ClimateData &climate = m_ClimateGenerator.GetData();
 
-            float worldX = worldPos.x + localX;
-            float worldZ = worldPos.z + localZ;
-            float normalizedHeight = glm::clamp((height - minHeight) / heightRange, 0.0f, 1.0f);
-            float randomValue = distProb(rng);
+        auto sampleDensityInputs = [&](float localX, float localZ,
+                                       float &fertility, BiomeWeights &weights)
+        {
+            int cellX = static_cast<int>(localX / m_CellSize);
+            int cellZ = static_cast<int>(localZ / m_CellSize);
+            weights = m_BiomeClassifier.GetBiomeWeights(cellX, cellZ);
 
-            // Trees in vegetation zones (between shore and treeline)
-            if (normalizedHeight > SHORE_LEVEL && normalizedHeight < TREELINE)
+            fertility = 0.5f;
+            if (cellX >= 0 && cellX < climate.width && cellZ >= 0 && cellZ < climate.depth)
             {
-                if (randomValue < 0.01f)
-                {
-                    m_TreePositions.push_back(glm::vec3(worldX, height, worldZ));
-                }
+                fertility = climate.fertility[climate.Index(cellX, cellZ)];
             }
+        };
 
-            // Rocks everywhere above water
-            randomValue = distProb(rng);
-            if (normalizedHeight > 0.1f)
-            {
-                if (randomValue < 0.007f)
-                {
-                    m_RockPositions.push_back(glm::vec3(worldX, height + 0.1f, worldZ));
-                }
-            }
-        }
-    }
+        // Trees: density follows fertility and the forested biome weights
+        int treeCells = static_cast<int>(chunkWorldSize / TREE_SPACING);
+        m_TreeInstances.reserve(static_cast<size_t>(treeCells) * treeCells / 8);
 
-    void Chunk::GenerateWater(float seaLevel)
-    {
-        // Generate water mesh only for cells that are actually below sea level
-        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
-        if (heightmap.empty())
+        for (int gz = 0; gz < treeCells; gz++)
         {
-            m_HasWater = false;
-            return;
-        }
+            for (int gx = 0; gx < treeCells; gx++)
+            {
+                float localX = (static_cast<float>(gx) + distJitter(rng)) * TREE_SPACING;
+                float localZ = (static_cast<float>(gz) + distJitter(rng)) * TREE_SPACING;
+                float height = GetHeightAtLocal(localX, localZ);
 
-        std::vector<Vertex> vertices;
-        std::vector<uint32_t> indices;
+                if (height <= seaLevel + 0.5f)
+                    continue;
 
-        glm::vec3 waterColor(0.1f, 0.4f, 0.6f);
-        int gridWidth = m_Size + 1;
+                float normalizedHeight = glm::clamp((height - minHeight) / heightRange, 0.0f, 1.0f);
+                if (normalizedHeight <= SHORE_LEVEL || normalizedHeight >= TREELINE)
+                    continue;
 
-        // Generate a quad for each cell that is below sea level
-        for (int z = 0; z < m_Size; z++)
-        {
-            for (int x = 0; x < m_Size; x++)
-            {
-                // Check if cell center is below sea level
-                size_t idx = static_cast<size_t>(z) * gridWidth + x;
-                float cellHeight = heightmap[idx];
+                float fertility;
+                BiomeWeights weights;
+                sampleDensityInputs(localX, localZ, fertility, weights);
 
-                if (cellHeight >= seaLevel)
-                {
+                float forestWeight = weights[BiomeType::Boreal] +
+                                     weights[BiomeType::Temperate] +
+                                     weights[BiomeType::Tropical] +
+                                     weights[BiomeType::Rainforest] +
+                                     0.35f * (weights[BiomeType::Grassland] +
+                                              weights[BiomeType::Mediterranean] +
+                                              weights[BiomeType::Wetland]);
+
+                if (distProb(rng) >= fertility * forestWeight * 0.5f)
                     continue;
-                }
 
-                // Cell corners in local space
-                float x0 = x * m_CellSize;
-                float x1 = (x + 1) * m_CellSize;
-                float z0 = z * m_CellSize;
-                float z1 = (z + 1) * m_CellSize;
-
-                // Create quad vertices
-                uint32_t baseIdx = static_cast<uint32_t>(vertices.size());
-
-                Vertex v0, v1, v2, v3;
-                v0.Position = glm::vec3(x0, seaLevel, z0);
-                v0.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v0.Color = waterColor;
-                v0.TexCoord = glm::vec2(0.0f, 0.0f);
-
-                v1.Position = glm::vec3(x1, seaLevel, z0);
-                v1.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v1.Color = waterColor;
-                v1.TexCoord = glm::vec2(1.0f, 0.0f);
-
-                v2.Position = glm::vec3(x1, seaLevel, z1);
-                v2.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v2.Color = waterColor;
-                v2.TexCoord = glm::vec2(1.0f, 1.0f);
-
-                v3.Position = glm::vec3(x0, seaLevel, z1);
-                v3.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v3.Color = waterColor;
-                v3.TexCoord = glm::vec2(0.0f, 1.0f);
-
-                vertices.push_back(v0);
-                vertices.push_back(v1);
-                vertices.push_back(v2);
-                vertices.push_back(v3);
-
-                // Two triangles per quad (CCW winding)
-                indices.push_back(baseIdx + 0);
-                indices.push_back(baseIdx + 3);
-                indices.push_back(baseIdx + 1);
-
-                indices.push_back(baseIdx + 1);
-                indices.push_back(baseIdx + 3);
-                indices.push_back(baseIdx + 2);
+                InstanceData tree;
+                tree.PositionAndScale = glm::vec4(worldPos.x + localX, height,
+                                                  worldPos.z + localZ, distTreeScale(rng));
+                tree.RotationAndTint = glm::vec4(0.0f, distRotation(rng), 0.0f, 1.0f);
+                m_TreeInstances.push_back(tree);
             }
         }
 
-        if (vertices.empty())
-        {
-            m_HasWater = false;
-            return;
-        }
-
-        m_WaterMesh = std::make_unique<Mesh>(vertices, indices);
-        m_HasWater = true;
-    }
+        // Rocks: sparser grid, denser in barren and cold/arid biomes
+        int rockCells = static_cast<int>(chunkWorldSize / ROCK_SPACING);
+        m_RockInstances.reserve(static_cast<size_t>(rockCells) * rockCells / 8);
 
-    void Chunk::RegenerateWater(float seaLevel, bool useOceanMask)
-    {
-        // Clean up existing water mesh
-        if (m_WaterMesh)
+        for (int gz = 0; gz < rockCells; gz++)
         {
-            if (m_State == ChunkState::Loaded)
+            for (int gx = 0; gx < rockCells; gx++)
             {
-                m_WaterMesh->Shutdown();
-            }
-            m_WaterMesh.reset();
-            m_HasWater = false;
-        }
+                float localX = (static_cast<float>(gx) + distJitter(rng)) * ROCK_SPACING;
+                float localZ = (static_cast<float>(gz) + distJitter(rng)) * ROCK_SPACING;
+                float height = GetHeightAtLocal(localX, localZ);
 
-        if (useOceanMask && m_OceanMask.IsFloodFillComplete())
-        {
-            GenerateWaterWithOceanMask(seaLevel);
-        }
-        else
-        {
-            GenerateWater(seaLevel);
-        }
-    }
+                if (height <= seaLevel + 0.5f)
+                    continue;
 
-    void Chunk::GenerateWaterWithOceanMask(float seaLevel)
-    {
-        // Generate water mesh only for cells that are actually below sea level
-        // This creates per-cell water quads, not a full plane
+                float normalizedHeight = glm::clamp((height - minHeight) / heightRange, 0.0f, 1.0f);
+                if (normalizedHeight <= 0.1f)
+                    continue;
 
-        std::vector<Vertex> vertices;
-        std::vector<uint32_t> indices;
+                float fertility;
+                BiomeWeights weights;
+                sampleDensityInputs(localX, localZ, fertility, weights);
 
-        glm::vec3 oceanColor(0.1f, 0.4f, 0.6f);
-        int cellCount = 0;
+                float barrenWeight = weights[BiomeType::Desert] +
+                                     weights[BiomeType::Polar] +
+                                     weights[BiomeType::Tundra];
+                float rockChance = 0.1f * (1.0f - fertility) + 0.15f * barrenWeight;
 
-        // Generate a quad for each cell that is below sea level (ocean or inland lake)
-        for (int z = 0; z < m_Size; z++)
-        {
-            for (int x = 0; x < m_Size; x++)
-            {
-                if (!m_OceanMask.IsBelowSeaLevel(x, z))
-                {
+                if (distProb(rng) >= rockChance)
                     continue;
-                }
 
-                // Cell corners in local space
-                float x0 = x * m_CellSize;
-                float x1 = (x + 1) * m_CellSize;
-                float z0 = z * m_CellSize;
-                float z1 = (z + 1) * m_CellSize;
-
-                // Determine color - ocean vs inland lake
-                bool isOcean = m_OceanMask.IsOcean(x, z);
-                glm::vec3 color = isOcean ? oceanColor : glm::vec3(0.15f, 0.45f, 0.55f);
-
-                // Create quad vertices
-                uint32_t baseIdx = static_cast<uint32_t>(vertices.size());
-
-                Vertex v0, v1, v2, v3;
-                v0.Position = glm::vec3(x0, seaLevel, z0);
-                v0.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v0.Color = color;
-                v0.TexCoord = glm::vec2(0.0f, 0.0f);
-
-                v1.Position = glm::vec3(x1, seaLevel, z0);
-                v1.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v1.Color = color;
-                v1.TexCoord = glm::vec2(1.0f, 0.0f);
-
-                v2.Position = glm::vec3(x1, seaLevel, z1);
-                v2.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v2.Color = color;
-                v2.TexCoord = glm::vec2(1.0f, 1.0f);
-
-                v3.Position = glm::vec3(x0, seaLevel, z1);
-                v3.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
-                v3.Color = color;
-                v3.TexCoord = glm::vec2(0.0f, 1.0f);
-
-                vertices.push_back(v0);
-                vertices.push_back(v1);
-                vertices.push_back(v2);
-                vertices.push_back(v3);
-
-                // Two triangles per quad (CCW winding)
-                indices.push_back(baseIdx + 0);
-                indices.push_back(baseIdx + 3);
-                indices.push_back(baseIdx + 1);
-
-                indices.push_back(baseIdx + 1);
-                indices.push_back(baseIdx + 3);
-                indices.push_back(baseIdx + 2);
-
-                cellCount++;
+                InstanceData rock;
+                rock.PositionAndScale = glm::vec4(worldPos.x + localX, height + 0.1f,
+                                                  worldPos.z + localZ, distRockScale(rng));
+                rock.RotationAndTint = glm::vec4(0.0f, distRotation(rng), 0.0f, 1.0f);
+                m_RockInstances.push_back(rock);
             }
         }
-
-        if (vertices.empty())
-        {
-            m_HasWater = false;
-            return;
-        }
-
-        m_WaterMesh = std::make_unique<Mesh>(vertices, indices);
-        m_HasWater = true;
     }
 
     float Chunk::GetHeightAtLocal(float localX, float localZ) const
@@ -531,35 +679,130 @@ namespace Genesis
         return GetHeightAtLocal(localX, localZ);
     }
 
-    void Chunk::Upload(VulkanDevice &device)
+    bool Chunk::RaycastTerrain(const glm::vec3 &localOrigin, const glm::vec3 &direction,
+                               float tMin, float tMax, float &outT) const
+    {
+        if (!m_HeightQuadtree.IsBuilt())
+        {
+            return false;
+        }
+
+        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
+        return m_HeightQuadtree.Raycast(localOrigin, direction, tMin, tMax, heightmap, outT);
+    }
+
+    void Chunk::ComputeHeightBounds()
+    {
+        const auto &heightmap = m_TerrainGenerator.GetCachedHeightmap();
+        if (heightmap.empty())
+        {
+            m_MinHeight = 0.0f;
+            m_MaxHeight = 0.0f;
+            return;
+        }
+
+        auto [minIt, maxIt] = std::minmax_element(heightmap.begin(), heightmap.end());
+        m_MinHeight = *minIt;
+        m_MaxHeight = *maxIt;
+    }
+
+    Mesh *Chunk::GetLodMesh(int lod) const
+    {
+        lod = std::clamp(lod, 0, LOD_COUNT - 1);
+
+        // Fall back to the finest available mesh if this level wasn't built
+        for (int level = lod; level > 0; level--)
+        {
+            if (m_LodMeshes[level])
+            {
+                return m_LodMeshes[level].get();
+            }
+        }
+        return m_Mesh.get();
+    }
+
+    void Chunk::Upload(VulkanDevice &device, IndirectTerrainRenderer *terrainPool)
     {
         if (m_Mesh && m_State == ChunkState::Loading)
         {
-            auto cpuMesh = std::move(m_Mesh);
-            m_Mesh = std::make_unique<Mesh>(device, cpuMesh->GetVertices(), cpuMesh->GetIndices());
+            // All meshes of the chunk go through one transfer batch: every
+            // copy is staged in the device ring and submitted together below
+            device.BeginTransferBatch();
 
-            if (m_WaterMesh && m_HasWater)
+            // GPU meshes consume the CPU buffers and do not retain copies;
+            // nothing reads mesh vertices back after upload
+            auto UploadMesh = [&device](std::unique_ptr<Mesh> &mesh)
             {
-                auto cpuWater = std::move(m_WaterMesh);
-                m_WaterMesh = std::make_unique<Mesh>(device, cpuWater->GetVertices(), cpuWater->GetIndices());
+                auto cpuMesh = std::move(mesh);
+                mesh = std::make_unique<Mesh>();
+                mesh->Init(device, cpuMesh->TakeVertices(), cpuMesh->TakeIndices(), false);
+            };
+
+            // Terrain geometry lands in the shared mega buffers so the
+            // renderer can batch all chunks into one indirect call
+            auto UploadTerrainMesh = [&](std::unique_ptr<Mesh> &mesh)
+            {
+                if (!terrainPool)
+                {
+                    UploadMesh(mesh);
+                    return;
+                }
+                auto cpuMesh = std::move(mesh);
+                mesh = std::make_unique<Mesh>();
+                mesh->Init(device, *terrainPool, cpuMesh->TakeVertices(), cpuMesh->TakeIndices());
+            };
+
+            UploadTerrainMesh(m_Mesh);
+
+            for (int lod = 1; lod < LOD_COUNT; lod++)
+            {
+                if (m_LodMeshes[lod])
+                {
+                    UploadTerrainMesh(m_LodMeshes[lod]);
+                }
             }
 
             // Upload lake mesh
             if (m_LakeMesh && m_HasLakes)
             {
-                auto cpuLake = std::move(m_LakeMesh);
-                m_LakeMesh = std::make_unique<Mesh>(device, cpuLake->GetVertices(), cpuLake->GetIndices());
+                UploadMesh(m_LakeMesh);
             }
 
             // Upload river mesh
             if (m_RiverMesh && m_HasRivers)
             {
-                auto cpuRiver = std::move(m_RiverMesh);
-                m_RiverMesh = std::make_unique<Mesh>(device, cpuRiver->GetVertices(), cpuRiver->GetIndices());
+                UploadMesh(m_RiverMesh);
             }
 
-            m_State = ChunkState::Loaded;
+            // The batch completes asynchronously on the transfer queue;
+            // ChunkManager polls the ticket and flips the chunk to Loaded
+            // once the meshes are resident
+            m_UploadTicket = device.EndTransferBatch();
+            if (m_UploadTicket == 0)
+            {
+                m_State = ChunkState::Loaded;
+            }
+        }
+    }
+
+    bool Chunk::PollUpload(VulkanDevice &device)
+    {
+        if (m_State == ChunkState::Loaded)
+        {
+            return true;
+        }
+        if (m_State != ChunkState::Loading || m_UploadTicket == 0)
+        {
+            return false;
+        }
+        if (!device.IsTransferComplete(m_UploadTicket))
+        {
+            return false;
         }
+
+        m_UploadTicket = 0;
+        m_State = ChunkState::Loaded;
+        return true;
     }
 
     void Chunk::Unload()
@@ -571,10 +814,13 @@ namespace Genesis
                 m_Mesh->Shutdown();
                 m_Mesh.reset();
             }
-            if (m_WaterMesh)
+            for (int lod = 1; lod < LOD_COUNT; lod++)
             {
-                m_WaterMesh->Shutdown();
-                m_WaterMesh.reset();
+                if (m_LodMeshes[lod])
+                {
+                    m_LodMeshes[lod]->Shutdown();
+                    m_LodMeshes[lod].reset();
+                }
             }
             if (m_LakeMesh)
             {
@@ -600,13 +846,16 @@ namespace Genesis
             }
             m_Mesh.reset();
         }
-        if (m_WaterMesh)
+        for (int lod = 1; lod < LOD_COUNT; lod++)
         {
-            if (m_State == ChunkState::Loaded)
+            if (m_LodMeshes[lod])
             {
-                m_WaterMesh->Shutdown();
+                if (m_State == ChunkState::Loaded)
+                {
+                    m_LodMeshes[lod]->Shutdown();
+                }
+                m_LodMeshes[lod].reset();
             }
-            m_WaterMesh.reset();
         }
         if (m_LakeMesh)
         {
@@ -624,12 +873,93 @@ namespace Genesis
             }
             m_RiverMesh.reset();
         }
-        m_TreePositions.clear();
-        m_RockPositions.clear();
+        m_TreeInstances.clear();
+        m_RockInstances.clear();
         m_HasLakes = false;
         m_HasRivers = false;
-        m_HasWater = false;
         m_State = ChunkState::Unloaded;
     }
 
+    void Chunk::RestoreWarmHeightmap(std::vector<float> heightmap)
+    {
+        m_WarmHeightmap = std::move(heightmap);
+        m_HeightmapRestored = true;
+    }
+
+    size_t Chunk::GetCpuMemoryUsage() const
+    {
+        size_t bytes = 0;
+
+        bytes += m_TerrainGenerator.GetCachedHeightmap().capacity() * sizeof(float);
+        bytes += m_CoarseHeightmap.capacity() * sizeof(float);
+        bytes += m_HeightQuadtree.GetMemoryUsage();
+
+        bytes += m_HydrologyData.waterType.capacity() * sizeof(WaterType);
+        bytes += m_HydrologyData.waterSurfaceHeight.capacity() * sizeof(float);
+        bytes += m_HydrologyData.flowAccumulation.capacity() * sizeof(uint32_t);
+        bytes += m_HydrologyData.drainageDirection.capacity() * sizeof(FlowDirection);
+        // Compact fields: two half-float fields plus one quantized byte field
+        size_t hydrologyCells = static_cast<size_t>(m_HydrologyData.width) * m_HydrologyData.depth;
+        bytes += hydrologyCells * (2 + 2 + 1);
+
+        bytes += m_TreeInstances.capacity() * sizeof(InstanceData);
+        bytes += m_RockInstances.capacity() * sizeof(InstanceData);
+
+        auto meshBytes = [](const Mesh *mesh) -> size_t
+        {
+            if (!mesh)
+                return 0;
+            return mesh->GetVertices().capacity() * sizeof(Vertex) +
+                   mesh->GetIndices().capacity() * sizeof(uint32_t);
+        };
+        bytes += meshBytes(m_Mesh.get());
+        for (int lod = 1; lod < LOD_COUNT; lod++)
+        {
+            bytes += meshBytes(m_LodMeshes[lod].get());
+        }
+        bytes += meshBytes(m_LakeMesh.get());
+        bytes += meshBytes(m_RiverMesh.get());
+
+        return bytes;
+    }
+
+    void Chunk::ReleaseCpuData()
+    {
+        // Generation data still feeds the pending upload
+        if (m_State != ChunkState::Loaded)
+            return;
+
+        // Keep the heightmap's world origin so a later SetCachedHeightmap
+        // restore (disk cache) stays consistent
+        glm::vec3 worldPos = GetWorldPosition();
+        m_TerrainGenerator.SetCachedHeightmap({}, worldPos.x, worldPos.z);
+        m_CoarseHeightmap = std::vector<float>();
+        m_HydrologyData = HydrologyData{};
+        // The quadtree leaves index the heightmap, so it goes with it
+        m_HeightQuadtree.Clear();
+
+        // Mesh CPU copies are dead weight once the GPU buffers are filled;
+        // moving them out frees the storage, draw counts stay valid
+        auto releaseMesh = [](Mesh *mesh)
+        {
+            if (!mesh)
+                return;
+            // Discarded temporaries free the storage on the spot
+            mesh->TakeVertices();
+            mesh->TakeIndices();
+        };
+        releaseMesh(m_Mesh.get());
+        for (int lod = 1; lod < LOD_COUNT; lod++)
+        {
+            releaseMesh(m_LodMeshes[lod].get());
+        }
+        releaseMesh(m_LakeMesh.get());
+        releaseMesh(m_RiverMesh.get());
+
+        // Safe to drop outright: the manager's pooled instance ranges keep
+        // their own copy from AddChunkObjects
+        m_TreeInstances = std::vector<InstanceData>();
+        m_RockInstances = std::vector<InstanceData>();
+    }
+
 }
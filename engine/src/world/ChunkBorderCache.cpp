@@ -0,0 +1,64 @@
+#include "genesis/world/ChunkBorderCache.h"
+#include <cmath>
+
+namespace Genesis
+{
+
+    void ChunkBorderCache::Store(const glm::ivec2 &coord, const HeightmapBorders &borders)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Borders[coord] = borders;
+    }
+
+    HeightmapBorders ChunkBorderCache::Gather(const glm::ivec2 &coord) const
+    {
+        HeightmapBorders halo;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // A neighbor's far edge is this chunk's near edge: the -X neighbor's
+        // +X column lines up with our x = 0 column, and so on.
+        if (auto it = m_Borders.find(glm::ivec2(coord.x - 1, coord.y)); it != m_Borders.end())
+        {
+            halo.negX = it->second.posX;
+        }
+        if (auto it = m_Borders.find(glm::ivec2(coord.x + 1, coord.y)); it != m_Borders.end())
+        {
+            halo.posX = it->second.negX;
+        }
+        if (auto it = m_Borders.find(glm::ivec2(coord.x, coord.y - 1)); it != m_Borders.end())
+        {
+            halo.negZ = it->second.posZ;
+        }
+        if (auto it = m_Borders.find(glm::ivec2(coord.x, coord.y + 1)); it != m_Borders.end())
+        {
+            halo.posZ = it->second.negZ;
+        }
+
+        return halo;
+    }
+
+    void ChunkBorderCache::Prune(const glm::ivec2 &center, int keepRadius)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (auto it = m_Borders.begin(); it != m_Borders.end();)
+        {
+            int dx = std::abs(it->first.x - center.x);
+            int dz = std::abs(it->first.y - center.y);
+            if (dx > keepRadius || dz > keepRadius)
+            {
+                it = m_Borders.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void ChunkBorderCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Borders.clear();
+    }
+
+}
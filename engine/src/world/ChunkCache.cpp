@@ -0,0 +1,573 @@
+#include "genesis/world/ChunkCache.h"
+#include "genesis/world/HeightmapCodec.h"
+#include "genesis/core/Log.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#ifndef GENESIS_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Genesis
+{
+
+    namespace
+    {
+        constexpr uint32_t REGION_MAGIC = 0x47524731; // "GRG1"
+        constexpr uint32_t REGION_VERSION = 1;
+
+        constexpr int REGION_SLOTS = ChunkCache::REGION_SIZE * ChunkCache::REGION_SIZE;
+
+        struct RegionHeader
+        {
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            uint32_t seed = 0;
+            int32_t chunkSize = 0;
+            float cellSize = 0.0f;
+            float seaLevel = 0.0f;
+            uint64_t settingsHash = 0;
+        };
+
+        // Sparse chunk table entry; offset 0 means the slot is empty
+        struct RegionSlot
+        {
+            uint64_t offset = 0;
+            uint64_t size = 0;
+        };
+
+        constexpr size_t REGION_TABLE_OFFSET = sizeof(RegionHeader);
+        constexpr size_t REGION_DATA_OFFSET = REGION_TABLE_OFFSET + REGION_SLOTS * sizeof(RegionSlot);
+
+        // Floor division so negative chunk coordinates map into the right region
+        int RegionCoord(int chunkCoord)
+        {
+            return chunkCoord >= 0 ? chunkCoord / ChunkCache::REGION_SIZE
+                                   : (chunkCoord - ChunkCache::REGION_SIZE + 1) / ChunkCache::REGION_SIZE;
+        }
+
+        int SlotIndex(int chunkX, int chunkZ)
+        {
+            int localX = chunkX - RegionCoord(chunkX) * ChunkCache::REGION_SIZE;
+            int localZ = chunkZ - RegionCoord(chunkZ) * ChunkCache::REGION_SIZE;
+            return localZ * ChunkCache::REGION_SIZE + localX;
+        }
+
+        // FNV-1a, accumulated field by field so struct padding never leaks in
+        void HashBytes(uint64_t &hash, const void *data, size_t size)
+        {
+            const uint8_t *bytes = static_cast<const uint8_t *>(data);
+            for (size_t i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+        }
+
+        template <typename T>
+        void HashValue(uint64_t &hash, const T &value)
+        {
+            HashBytes(hash, &value, sizeof(T));
+        }
+
+        // Read-only view over a memory-mapped (or fully read) region file
+        class MappedFile
+        {
+        public:
+            explicit MappedFile(const std::string &path)
+            {
+#ifndef GENESIS_PLATFORM_WINDOWS
+                m_Fd = open(path.c_str(), O_RDONLY);
+                if (m_Fd < 0)
+                    return;
+
+                struct stat st{};
+                if (fstat(m_Fd, &st) != 0 || st.st_size <= 0)
+                    return;
+
+                void *mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, m_Fd, 0);
+                if (mapped == MAP_FAILED)
+                    return;
+
+                m_Data = static_cast<const uint8_t *>(mapped);
+                m_Size = static_cast<size_t>(st.st_size);
+#else
+                std::ifstream file(path, std::ios::binary | std::ios::ate);
+                if (!file.is_open())
+                    return;
+
+                m_Buffer.resize(static_cast<size_t>(file.tellg()));
+                file.seekg(0);
+                file.read(reinterpret_cast<char *>(m_Buffer.data()), static_cast<std::streamsize>(m_Buffer.size()));
+                m_Data = m_Buffer.data();
+                m_Size = m_Buffer.size();
+#endif
+            }
+
+            ~MappedFile()
+            {
+#ifndef GENESIS_PLATFORM_WINDOWS
+                if (m_Data)
+                    munmap(const_cast<uint8_t *>(m_Data), m_Size);
+                if (m_Fd >= 0)
+                    close(m_Fd);
+#endif
+            }
+
+            bool IsValid() const { return m_Data != nullptr; }
+            const uint8_t *Data() const { return m_Data; }
+            size_t Size() const { return m_Size; }
+
+        private:
+            const uint8_t *m_Data = nullptr;
+            size_t m_Size = 0;
+#ifndef GENESIS_PLATFORM_WINDOWS
+            int m_Fd = -1;
+#else
+            std::vector<uint8_t> m_Buffer;
+#endif
+        };
+
+        // Sequential reader over a payload span; fails closed on truncation
+        class PayloadReader
+        {
+        public:
+            PayloadReader(const uint8_t *data, size_t size)
+                : m_Data(data), m_Size(size)
+            {
+            }
+
+            bool Read(void *out, size_t size)
+            {
+                if (m_Offset + size > m_Size)
+                    return false;
+                std::memcpy(out, m_Data + m_Offset, size);
+                m_Offset += size;
+                return true;
+            }
+
+            template <typename T>
+            bool ReadVector(std::vector<T> &out)
+            {
+                uint32_t count = 0;
+                if (!Read(&count, sizeof(count)))
+                    return false;
+                if (m_Offset + count * sizeof(T) > m_Size)
+                    return false;
+                out.resize(count);
+                if (count > 0)
+                {
+                    std::memcpy(out.data(), m_Data + m_Offset, count * sizeof(T));
+                    m_Offset += count * sizeof(T);
+                }
+                return true;
+            }
+
+        private:
+            const uint8_t *m_Data;
+            size_t m_Size;
+            size_t m_Offset = 0;
+        };
+
+        // Serializes a chunk payload into a memory buffer on the saving
+        // thread, so the writer thread never touches live chunk data
+        class PayloadWriter
+        {
+        public:
+            explicit PayloadWriter(std::vector<uint8_t> &out)
+                : m_Out(out)
+            {
+            }
+
+            void Write(const void *data, size_t size)
+            {
+                const uint8_t *bytes = static_cast<const uint8_t *>(data);
+                m_Out.insert(m_Out.end(), bytes, bytes + size);
+            }
+
+            template <typename T>
+            void WriteVector(const std::vector<T> &data)
+            {
+                uint32_t count = static_cast<uint32_t>(data.size());
+                Write(&count, sizeof(count));
+                if (count > 0)
+                {
+                    Write(data.data(), count * sizeof(T));
+                }
+            }
+
+            void WriteMesh(const Mesh *mesh)
+            {
+                static const std::vector<Vertex> emptyVertices;
+                static const std::vector<uint32_t> emptyIndices;
+                WriteVector(mesh ? mesh->GetVertices() : emptyVertices);
+                WriteVector(mesh ? mesh->GetIndices() : emptyIndices);
+            }
+
+        private:
+            std::vector<uint8_t> &m_Out;
+        };
+
+        bool ReadMesh(PayloadReader &reader, std::unique_ptr<Mesh> &outMesh)
+        {
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            if (!reader.ReadVector(vertices) || !reader.ReadVector(indices))
+                return false;
+
+            outMesh = vertices.empty() ? nullptr : std::make_unique<Mesh>(vertices, indices);
+            return true;
+        }
+
+        // Decode a payload and populate the chunk the same way Generate
+        // would. Returns false if any section fails to parse.
+        bool ParsePayload(PayloadReader &reader, Chunk &chunk, const TerrainSettings &settings,
+                          uint32_t worldSeed, float seaLevel)
+        {
+            int32_t chunkX = 0;
+            int32_t chunkZ = 0;
+            if (!reader.Read(&chunkX, sizeof(chunkX)) || !reader.Read(&chunkZ, sizeof(chunkZ)) ||
+                chunkX != chunk.GetChunkX() || chunkZ != chunk.GetChunkZ())
+            {
+                return false;
+            }
+
+            // Heightmap section: delta+RLE tokens (see HeightmapCodec)
+            CompressedHeightmap compressed;
+            if (!reader.Read(&compressed.Width, sizeof(compressed.Width)) ||
+                !reader.Read(&compressed.Depth, sizeof(compressed.Depth)) ||
+                !reader.ReadVector(compressed.Tokens) || compressed.Empty())
+            {
+                return false;
+            }
+
+            std::vector<float> heightmap = HeightmapCodec::Decompress(compressed);
+            if (heightmap.empty())
+                return false;
+
+            std::unique_ptr<Mesh> terrainMesh;
+            if (!ReadMesh(reader, terrainMesh) || !terrainMesh)
+                return false;
+
+            std::array<std::unique_ptr<Mesh>, Chunk::LOD_COUNT> lodMeshes;
+            for (int lod = 1; lod < Chunk::LOD_COUNT; lod++)
+            {
+                if (!ReadMesh(reader, lodMeshes[lod]))
+                    return false;
+            }
+
+            std::unique_ptr<Mesh> lakeMesh;
+            std::unique_ptr<Mesh> riverMesh;
+            std::vector<InstanceData> treeInstances;
+            std::vector<InstanceData> rockInstances;
+            if (!ReadMesh(reader, lakeMesh) || !ReadMesh(reader, riverMesh) ||
+                !reader.ReadVector(treeInstances) || !reader.ReadVector(rockInstances))
+            {
+                return false;
+            }
+
+            TerrainSettings chunkSettings = settings;
+            chunkSettings.width = chunk.m_Size;
+            chunkSettings.depth = chunk.m_Size;
+            chunkSettings.cellSize = chunk.m_CellSize;
+            chunkSettings.seed = worldSeed;
+            chunk.m_TerrainGenerator.SetSettings(chunkSettings);
+
+            glm::vec3 worldPos = chunk.GetWorldPosition();
+            chunk.m_TerrainGenerator.SetCachedHeightmap(std::move(heightmap), worldPos.x, worldPos.z);
+
+            // The below-sea mask is cheap to rebuild; flood fill state is recomputed
+            // by ChunkManager across loaded chunks anyway
+            chunk.m_OceanMask.Initialize(chunk.m_Size, chunk.m_Size);
+            chunk.m_OceanMask.GenerateBelowSeaMask(chunk.m_TerrainGenerator.GetCachedHeightmap(), seaLevel);
+
+            chunk.m_Mesh = std::move(terrainMesh);
+            chunk.m_LodMeshes = std::move(lodMeshes);
+            chunk.m_LakeMesh = std::move(lakeMesh);
+            chunk.m_RiverMesh = std::move(riverMesh);
+            chunk.m_HasLakes = chunk.m_LakeMesh != nullptr;
+            chunk.m_HasRivers = chunk.m_RiverMesh != nullptr;
+            chunk.m_TreeInstances = std::move(treeInstances);
+            chunk.m_RockInstances = std::move(rockInstances);
+            chunk.ComputeHeightBounds();
+            chunk.m_HeightQuadtree.Build(chunk.m_TerrainGenerator.GetCachedHeightmap(),
+                                         chunk.m_Size + 1, chunk.m_Size + 1, chunk.m_CellSize);
+            // Only full-hydrology chunks are ever saved (see ChunkManager), so a
+            // hit restores the final visual tier and needs no later upgrade
+            chunk.m_HydrologyLod = HydrologyLod::Full;
+            chunk.m_State = ChunkState::Loading;
+            return true;
+        }
+    }
+
+    ChunkCache::ChunkCache(const std::string &directory)
+        : m_Directory(directory)
+    {
+        m_WriterThread = std::thread(&ChunkCache::WriterLoop, this);
+    }
+
+    ChunkCache::~ChunkCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_StopWriter = true;
+        }
+        m_QueueCondition.notify_all();
+        if (m_WriterThread.joinable())
+            m_WriterThread.join();
+    }
+
+    uint64_t ChunkCache::HashSettings(const TerrainSettings &settings)
+    {
+        uint64_t hash = 14695981039346656037ull; // FNV offset basis
+
+        HashValue(hash, settings.width);
+        HashValue(hash, settings.depth);
+        HashValue(hash, settings.cellSize);
+        HashValue(hash, settings.heightScale);
+        HashValue(hash, settings.baseHeight);
+        HashValue(hash, settings.useContinentalField);
+        HashValue(hash, settings.continentalFrequency);
+        HashValue(hash, settings.oceanThreshold);
+        HashValue(hash, settings.coastlineBlend);
+        HashValue(hash, settings.oceanDepth);
+        HashValue(hash, settings.oceanFloorVariation);
+        HashValue(hash, settings.noiseScale);
+        HashValue(hash, settings.octaves);
+        HashValue(hash, settings.persistence);
+        HashValue(hash, settings.lacunarity);
+        HashValue(hash, settings.useWarp);
+        HashValue(hash, settings.warpStrength);
+        HashValue(hash, settings.warpScale);
+        HashValue(hash, settings.warpLevels);
+        HashValue(hash, settings.useRidgeNoise);
+        HashValue(hash, settings.ridgeWeight);
+        HashValue(hash, settings.ridgePower);
+        HashValue(hash, settings.ridgeScale);
+        HashValue(hash, settings.peakBoost);
+        HashValue(hash, settings.useUpliftMask);
+        HashValue(hash, settings.upliftScale);
+        HashValue(hash, settings.upliftThresholdLow);
+        HashValue(hash, settings.upliftThresholdHigh);
+        HashValue(hash, settings.upliftPower);
+        HashValue(hash, settings.useErosion);
+        HashValue(hash, settings.slopeErosionStrength);
+        HashValue(hash, settings.slopeThreshold);
+        HashValue(hash, settings.valleyDepth);
+        HashValue(hash, settings.useHydraulicErosion);
+        HashValue(hash, settings.erosionIterations);
+        HashValue(hash, settings.flatShading);
+        HashValue(hash, settings.useBiomeColors);
+
+        return hash;
+    }
+
+    std::string ChunkCache::RegionPath(int regionX, int regionZ, uint32_t worldSeed, uint64_t settingsHash) const
+    {
+        std::ostringstream oss;
+        oss << m_Directory << "/region_" << worldSeed << "_" << std::hex << settingsHash
+            << std::dec << "_" << regionX << "_" << regionZ << ".gregion";
+        return oss.str();
+    }
+
+    bool ChunkCache::TryLoad(Chunk &chunk, const TerrainSettings &settings, uint32_t worldSeed, float seaLevel) const
+    {
+        uint64_t settingsHash = HashSettings(settings);
+        std::string path = RegionPath(RegionCoord(chunk.GetChunkX()), RegionCoord(chunk.GetChunkZ()),
+                                      worldSeed, settingsHash);
+        int slot = SlotIndex(chunk.GetChunkX(), chunk.GetChunkZ());
+
+        // A chunk unloaded and revisited quickly may still be queued for
+        // write-behind; serve it from the in-memory snapshot. Newest match
+        // wins in case the same slot was queued twice.
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            for (auto it = m_WriteQueue.rbegin(); it != m_WriteQueue.rend(); ++it)
+            {
+                if (it->slot == slot && it->seaLevel == seaLevel && it->path == path)
+                {
+                    PayloadReader reader(it->payload.data(), it->payload.size());
+                    if (ParsePayload(reader, chunk, settings, worldSeed, seaLevel))
+                    {
+                        GEN_DEBUG("ChunkCache: write-behind hit for chunk ({}, {})",
+                                  chunk.GetChunkX(), chunk.GetChunkZ());
+                        return true;
+                    }
+                    return false;
+                }
+            }
+        }
+
+        MappedFile file(path);
+        if (!file.IsValid() || file.Size() < REGION_DATA_OFFSET)
+            return false;
+
+        RegionHeader header;
+        std::memcpy(&header, file.Data(), sizeof(header));
+        if (header.magic != REGION_MAGIC || header.version != REGION_VERSION ||
+            header.seed != worldSeed || header.settingsHash != settingsHash ||
+            header.chunkSize != chunk.m_Size || header.cellSize != chunk.m_CellSize ||
+            header.seaLevel != seaLevel)
+        {
+            return false;
+        }
+
+        RegionSlot entry;
+        std::memcpy(&entry, file.Data() + REGION_TABLE_OFFSET + slot * sizeof(RegionSlot), sizeof(entry));
+        if (entry.offset == 0 || entry.offset + entry.size > file.Size())
+            return false;
+
+        PayloadReader reader(file.Data() + entry.offset, static_cast<size_t>(entry.size));
+        if (!ParsePayload(reader, chunk, settings, worldSeed, seaLevel))
+            return false;
+
+        GEN_DEBUG("ChunkCache: hit for chunk ({}, {})", chunk.GetChunkX(), chunk.GetChunkZ());
+        return true;
+    }
+
+    void ChunkCache::Save(const Chunk &chunk, const TerrainSettings &settings, uint32_t worldSeed, float seaLevel)
+    {
+        const auto &heightmap = chunk.m_TerrainGenerator.GetCachedHeightmap();
+        if (heightmap.empty() || !chunk.m_Mesh)
+            return;
+
+        // Heightmap vertices run one past the cell grid on each side
+        int gridSize = chunk.m_Size + 1;
+        CompressedHeightmap compressed = HeightmapCodec::Compress(heightmap, gridSize, gridSize);
+        if (compressed.Empty())
+            return;
+
+        PendingWrite write;
+        write.seed = worldSeed;
+        write.settingsHash = HashSettings(settings);
+        write.chunkSize = chunk.m_Size;
+        write.cellSize = chunk.m_CellSize;
+        write.seaLevel = seaLevel;
+        write.path = RegionPath(RegionCoord(chunk.GetChunkX()), RegionCoord(chunk.GetChunkZ()),
+                                worldSeed, write.settingsHash);
+        write.slot = SlotIndex(chunk.GetChunkX(), chunk.GetChunkZ());
+
+        PayloadWriter writer(write.payload);
+        int32_t chunkX = chunk.GetChunkX();
+        int32_t chunkZ = chunk.GetChunkZ();
+        writer.Write(&chunkX, sizeof(chunkX));
+        writer.Write(&chunkZ, sizeof(chunkZ));
+
+        writer.Write(&compressed.Width, sizeof(compressed.Width));
+        writer.Write(&compressed.Depth, sizeof(compressed.Depth));
+        writer.WriteVector(compressed.Tokens);
+
+        writer.WriteMesh(chunk.m_Mesh.get());
+        for (int lod = 1; lod < Chunk::LOD_COUNT; lod++)
+        {
+            writer.WriteMesh(chunk.m_LodMeshes[lod].get());
+        }
+
+        writer.WriteMesh(chunk.m_HasLakes ? chunk.m_LakeMesh.get() : nullptr);
+        writer.WriteMesh(chunk.m_HasRivers ? chunk.m_RiverMesh.get() : nullptr);
+
+        writer.WriteVector(chunk.m_TreeInstances);
+        writer.WriteVector(chunk.m_RockInstances);
+
+        {
+            std::lock_guard<std::mutex> lock(m_QueueMutex);
+            m_WriteQueue.push_back(std::move(write));
+        }
+        m_QueueCondition.notify_one();
+    }
+
+    void ChunkCache::WriterLoop()
+    {
+        for (;;)
+        {
+            PendingWrite write;
+            {
+                std::unique_lock<std::mutex> lock(m_QueueMutex);
+                m_QueueCondition.wait(lock, [this]
+                                      { return m_StopWriter || !m_WriteQueue.empty(); });
+                if (m_WriteQueue.empty())
+                {
+                    // Stop requested and the queue is drained
+                    return;
+                }
+                // Peek without popping so TryLoad can still serve this
+                // payload from memory until it is actually on disk
+                write = m_WriteQueue.front();
+            }
+
+            CommitWrite(write);
+
+            {
+                std::lock_guard<std::mutex> lock(m_QueueMutex);
+                m_WriteQueue.pop_front();
+            }
+        }
+    }
+
+    void ChunkCache::CommitWrite(const PendingWrite &write)
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(m_Directory, ec);
+        if (ec)
+        {
+            GEN_WARN("ChunkCache: failed to create cache directory '{}': {}", m_Directory, ec.message());
+            return;
+        }
+
+        // Create the region on first touch: header plus an all-empty table
+        if (!std::filesystem::exists(write.path, ec))
+        {
+            std::ofstream create(write.path, std::ios::binary | std::ios::trunc);
+            if (!create.is_open())
+            {
+                GEN_WARN("ChunkCache: failed to create region '{}'", write.path);
+                return;
+            }
+
+            RegionHeader header;
+            header.magic = REGION_MAGIC;
+            header.version = REGION_VERSION;
+            header.seed = write.seed;
+            header.chunkSize = write.chunkSize;
+            header.cellSize = write.cellSize;
+            header.seaLevel = write.seaLevel;
+            header.settingsHash = write.settingsHash;
+            create.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+            std::vector<RegionSlot> table(REGION_SLOTS);
+            create.write(reinterpret_cast<const char *>(table.data()), table.size() * sizeof(RegionSlot));
+        }
+
+        std::fstream file(write.path, std::ios::binary | std::ios::in | std::ios::out);
+        if (!file.is_open())
+        {
+            GEN_WARN("ChunkCache: failed to open region '{}' for writing", write.path);
+            return;
+        }
+
+        // Append the payload, then patch its slot entry. The table entry is
+        // written last so a crash mid-append leaves the slot empty rather
+        // than pointing at a torn payload.
+        file.seekp(0, std::ios::end);
+        uint64_t offset = static_cast<uint64_t>(file.tellp());
+        if (offset < REGION_DATA_OFFSET)
+        {
+            GEN_WARN("ChunkCache: region '{}' is truncated, skipping write", write.path);
+            return;
+        }
+
+        file.write(reinterpret_cast<const char *>(write.payload.data()),
+                   static_cast<std::streamsize>(write.payload.size()));
+        file.flush();
+
+        RegionSlot entry{offset, write.payload.size()};
+        file.seekp(static_cast<std::streamoff>(REGION_TABLE_OFFSET + write.slot * sizeof(RegionSlot)));
+        file.write(reinterpret_cast<const char *>(&entry), sizeof(entry));
+    }
+
+}
@@ -1,9 +1,15 @@
 #include "genesis/world/ChunkManager.h"
+#include "genesis/procedural/Water.h"
 #include "genesis/renderer/Renderer.h"
 #include "genesis/renderer/VulkanDevice.h"
 #include "genesis/core/Log.h"
+#include "genesis/core/MemoryTracker.h"
+#include "genesis/core/Profiler.h"
+#include "genesis/math/Math.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <cmath>
+#include <limits>
+#include <numeric>
 
 namespace Genesis
 {
@@ -15,9 +21,11 @@ namespace Genesis
         Shutdown();
     }
 
-    void ChunkManager::Initialize(VulkanDevice &device, const WorldSettings &settings)
+    void ChunkManager::Initialize(VulkanDevice &device, const WorldSettings &settings,
+                                  IndirectTerrainRenderer *terrainRenderer)
     {
         m_Device = &device;
+        m_TerrainRenderer = terrainRenderer;
         m_Settings = settings;
 
         // Apply default terrain settings if not configured
@@ -32,27 +40,513 @@ namespace Genesis
             m_Settings.terrainSettings.useBiomeColors = true;
         }
 
-        GEN_INFO("ChunkManager initialized (chunk size: {}, view distance: {})",
-                 m_Settings.chunkSize, m_Settings.viewDistance);
+        // Build the global ocean surface once. Chunks never mesh ocean water
+        // themselves; this grid follows the camera and is positioned at sea
+        // level every frame, so sea-level changes are free.
+        m_OceanCellSize = m_Settings.cellSize * 4.0f;
+        auto oceanGrid = WaterGenerator::GenerateOceanGrid(m_OceanCellSize);
+        m_OceanMesh = std::make_unique<Mesh>();
+        m_Device->BeginTransferBatch();
+        m_OceanMesh->Init(*m_Device, oceanGrid->TakeVertices(), oceanGrid->TakeIndices(), false);
+        m_Device->EndTransferBatch();
+        m_Device->WaitForTransfers();
+
+        StartWorkers();
+
+        GEN_INFO("ChunkManager initialized (chunk size: {}, view distance: {}, workers: {})",
+                 m_Settings.chunkSize, m_Settings.viewDistance, m_Workers.size());
     }
 
     void ChunkManager::Shutdown()
     {
+        StopWorkers();
+
         if (m_Device)
         {
             m_Device->WaitIdle();
+            m_Device->WaitForTransfers();
+        }
+        m_UploadingChunks.clear();
+
+        if (m_OceanMesh)
+        {
+            m_OceanMesh->Shutdown();
+            m_OceanMesh.reset();
         }
 
+        ProcessDeferredDeletes(true);
+        ClearWarmHeightmaps();
+
         for (auto &[coord, chunk] : m_LoadedChunks)
         {
             chunk->Destroy();
         }
         m_LoadedChunks.clear();
-        m_AllTreePositions.clear();
-        m_AllRockPositions.clear();
+        PublishChunkTable();
+
+        // Workers are stopped, so no reader can remain pinned; drop the
+        // published table and every retired one outright
+        delete m_PublishedChunkTable.exchange(nullptr, std::memory_order_acq_rel);
+        m_RetiredTables.clear();
+        m_TreeInstancePool.Clear();
+        m_RockInstancePool.Clear();
+        m_ObjectsVersion++;
         m_Device = nullptr;
     }
 
+    void ChunkManager::StartWorkers()
+    {
+        if (!m_Workers.empty())
+            return;
+
+        m_StopWorkers = false;
+
+        // Leave one core for the main thread
+        unsigned int workerCount = std::thread::hardware_concurrency();
+        workerCount = workerCount > 1 ? workerCount - 1 : 1;
+
+        m_Workers.reserve(workerCount);
+        for (unsigned int i = 0; i < workerCount; i++)
+        {
+            m_Workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    void ChunkManager::StopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_JobMutex);
+            m_StopWorkers = true;
+            m_JobQueue.clear();
+            m_PendingChunks.clear();
+        }
+        m_JobCondition.notify_all();
+
+        for (auto &worker : m_Workers)
+        {
+            if (worker.joinable())
+            {
+                worker.join();
+            }
+        }
+        m_Workers.clear();
+
+        std::lock_guard<std::mutex> lock(m_CompletedMutex);
+        m_CompletedChunks.clear();
+    }
+
+    void ChunkManager::WorkerLoop()
+    {
+        while (true)
+        {
+            ChunkJob job;
+            {
+                std::unique_lock<std::mutex> lock(m_JobMutex);
+                m_JobCondition.wait(lock, [this]() { return m_StopWorkers || !m_JobQueue.empty(); });
+
+                if (m_StopWorkers)
+                    return;
+
+                job = std::move(m_JobQueue.front());
+                m_JobQueue.pop_front();
+            }
+
+            // Generation heap traffic (meshes, fields, instance arrays)
+            // lands in the ChunkManager bucket; hydrology retags its own
+            // stages from inside the pipeline
+            GEN_MEM_SCOPE(MemoryTag::ChunkManager);
+
+            // Preview jobs are throwaway first passes: they skip the disk
+            // cache and must not leak their reduced-quality border samples
+            // into the border cache for full-quality neighbors to pick up
+            if (job.preview)
+            {
+                job.chunk->Generate(job.terrainSettings, job.seed, job.seaLevel, HydrologyLod::None, nullptr);
+            }
+            // Disk cache hit replaces the whole procedural pipeline with an
+            // mmap read (jobs resumed mid-generation already missed it)
+            else if (job.started ||
+                     !m_ChunkCache.TryLoad(*job.chunk, job.terrainSettings, job.seed, job.seaLevel))
+            {
+                glm::ivec2 coord(job.chunk->GetChunkX(), job.chunk->GetChunkZ());
+
+                if (!job.started)
+                {
+                    // A warm compressed heightmap from a previous residency
+                    // replaces the noise stack with a decode
+                    std::vector<float> warm = TakeWarmHeightmap(coord);
+                    job.warmRestored = !warm.empty();
+                    if (job.warmRestored)
+                    {
+                        job.chunk->RestoreWarmHeightmap(std::move(warm));
+                    }
+
+                    job.halo = std::make_unique<HeightmapBorders>(m_BorderCache.Gather(coord));
+                    job.pipeline = job.chunk->GenerateStaged(job.terrainSettings, job.seed,
+                                                             job.seaLevel, job.hydrologyLod,
+                                                             job.halo.get());
+                    job.started = true;
+                }
+
+                // Run the staged pipeline. Between stages a speculative job
+                // steps aside for any queued in-view chunk: it parks itself
+                // (suspended, completed phases kept) at the back of the
+                // queue and this worker takes the urgent job instead.
+                bool parked = false;
+                while (job.pipeline.Resume())
+                {
+                    if (!job.prefetch)
+                    {
+                        continue;
+                    }
+                    std::lock_guard<std::mutex> lock(m_JobMutex);
+                    if (!m_JobQueue.empty() && !m_JobQueue.front().prefetch)
+                    {
+                        m_JobQueue.push_back(std::move(job));
+                        parked = true;
+                        break;
+                    }
+                }
+                if (parked)
+                {
+                    continue;
+                }
+
+                // Warm-restored chunks didn't run the noise stack, so they
+                // have no fresh raw borders to share
+                if (!job.warmRestored)
+                    m_BorderCache.Store(coord, job.chunk->m_TerrainGenerator.GetRawBorders());
+
+                // Only cache fully generated chunks so a later close-up revisit
+                // doesn't restore a reduced-hydrology version
+                if (job.hydrologyLod == HydrologyLod::Full)
+                {
+                    m_ChunkCache.Save(*job.chunk, job.terrainSettings, job.seed, job.seaLevel);
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_CompletedMutex);
+                m_CompletedChunks.push_back(std::move(job.chunk));
+            }
+        }
+    }
+
+    void ChunkManager::QueueChunkLoad(int chunkX, int chunkZ, bool prefetch, bool preview)
+    {
+        glm::ivec2 coord(chunkX, chunkZ);
+        if (m_PendingChunks.count(coord))
+            return;
+
+        ChunkJob job;
+        job.chunk = std::make_unique<Chunk>(chunkX, chunkZ, m_Settings.chunkSize, m_Settings.cellSize);
+        job.terrainSettings = preview ? MakePreviewSettings(m_Settings.terrainSettings)
+                                      : m_Settings.terrainSettings;
+        job.seed = m_Settings.seed;
+        job.seaLevel = m_Settings.waterEnabled ? m_Settings.seaLevel : -1000.0f;
+        job.prefetch = prefetch;
+        job.preview = preview;
+
+        // Full hydrology near the camera, coarse in the mid ring, none beyond
+        job.hydrologyLod = preview ? HydrologyLod::None
+                                   : HydrologyLodForChunk(chunkX, chunkZ);
+
+        m_PendingChunks.insert(coord);
+        {
+            std::lock_guard<std::mutex> lock(m_JobMutex);
+            if (prefetch)
+            {
+                m_JobQueue.push_back(std::move(job));
+            }
+            else
+            {
+                // Chunks in view go ahead of any queued speculative jobs
+                auto firstPrefetch = std::find_if(m_JobQueue.begin(), m_JobQueue.end(),
+                                                  [](const ChunkJob &queued) { return queued.prefetch; });
+                m_JobQueue.insert(firstPrefetch, std::move(job));
+            }
+        }
+        m_JobCondition.notify_one();
+    }
+
+    void ChunkManager::PreviewChunkAtCamera(const TerrainSettings &settings)
+    {
+        glm::ivec2 coord = m_LastCameraChunk;
+        if (coord.x == INT_MAX || !m_LoadedChunks.count(coord) || m_PendingChunks.count(coord))
+            return;
+
+        // One chunk at preview quality keeps up with a slider drag; the
+        // pending-chunk check throttles re-issues to generation speed
+        ChunkJob job;
+        job.chunk = std::make_unique<Chunk>(coord.x, coord.y, m_Settings.chunkSize, m_Settings.cellSize);
+        job.terrainSettings = MakePreviewSettings(settings);
+        job.seed = m_Settings.seed;
+        job.seaLevel = m_Settings.waterEnabled ? m_Settings.seaLevel : -1000.0f;
+        job.hydrologyLod = HydrologyLod::None;
+        job.preview = true;
+
+        m_PendingChunks.insert(coord);
+        {
+            std::lock_guard<std::mutex> lock(m_JobMutex);
+            // Ahead of everything: this is the chunk the user is looking at
+            m_JobQueue.push_front(std::move(job));
+        }
+        m_JobCondition.notify_one();
+    }
+
+    HydrologyLod ChunkManager::HydrologyLodForChunk(int chunkX, int chunkZ) const
+    {
+        int dx = std::abs(chunkX - m_LastCameraChunk.x);
+        int dz = std::abs(chunkZ - m_LastCameraChunk.y);
+        int cheb = std::max(dx, dz);
+
+        if (cheb <= m_Settings.hydrologyDistance)
+            return HydrologyLod::Full;
+        if (cheb <= m_Settings.coarseHydrologyDistance)
+            return HydrologyLod::Coarse;
+        return HydrologyLod::None;
+    }
+
+    void ChunkManager::QueueHydrologyUpgrades(const glm::ivec2 &cameraChunk)
+    {
+        // Chunks only ever upgrade: dropping back to a lower tier would
+        // regenerate for no visual gain, so downgrades wait for unload
+        std::vector<glm::ivec2> toUpgrade;
+        int maxDist = m_Settings.coarseHydrologyDistance;
+
+        for (const auto &[coord, chunk] : m_LoadedChunks)
+        {
+            int dx = std::abs(coord.x - cameraChunk.x);
+            int dz = std::abs(coord.y - cameraChunk.y);
+            if (std::max(dx, dz) > maxDist)
+                continue;
+
+            if (chunk->GetHydrologyLod() < HydrologyLodForChunk(coord.x, coord.y) &&
+                m_PendingChunks.find(coord) == m_PendingChunks.end())
+            {
+                toUpgrade.push_back(coord);
+            }
+        }
+
+        // Nearest first, same as regular loads
+        std::sort(toUpgrade.begin(), toUpgrade.end(),
+                  [cameraChunk](const glm::ivec2 &a, const glm::ivec2 &b)
+                  {
+                      glm::ivec2 da = a - cameraChunk;
+                      glm::ivec2 db = b - cameraChunk;
+                      return da.x * da.x + da.y * da.y < db.x * db.x + db.y * db.y;
+                  });
+
+        for (const auto &coord : toUpgrade)
+        {
+            // The regenerated chunk replaces the loaded one on completion
+            // via the deferred-deletion path in ProcessCompletedChunks
+            QueueChunkLoad(coord.x, coord.y);
+        }
+
+        if (!toUpgrade.empty())
+        {
+            GEN_DEBUG("Queued {} chunks for hydrology upgrade", toUpgrade.size());
+        }
+    }
+
+    void ChunkManager::PrefetchAlongVelocity(const glm::ivec2 &cameraChunk)
+    {
+        // Only prefetch under sustained movement - roughly one chunk every
+        // few seconds at 60 fps. Slow wandering is covered by regular loads.
+        float speed = glm::length(m_CameraVelocity);
+        float chunkExtent = m_Settings.chunkSize * m_Settings.cellSize;
+        if (speed * 60.0f < chunkExtent * 0.2f)
+            return;
+
+        glm::vec2 direction = m_CameraVelocity / speed;
+        constexpr float PREFETCH_CONE = 0.6f; // cos ~53 degrees
+
+        std::vector<glm::ivec2> toPrefetch;
+        int viewDist = m_Settings.viewDistance;
+        int outer = viewDist + PREFETCH_RING;
+
+        for (int z = -outer; z <= outer; z++)
+        {
+            for (int x = -outer; x <= outer; x++)
+            {
+                // The regular load list already covers the view square
+                int cheb = std::max(std::abs(x), std::abs(z));
+                if (cheb <= viewDist)
+                    continue;
+
+                glm::vec2 offset(static_cast<float>(x), static_cast<float>(z));
+                if (glm::dot(glm::normalize(offset), direction) < PREFETCH_CONE)
+                    continue;
+
+                glm::ivec2 coord(cameraChunk.x + x, cameraChunk.y + z);
+                if (m_LoadedChunks.find(coord) == m_LoadedChunks.end() &&
+                    m_PendingChunks.find(coord) == m_PendingChunks.end())
+                {
+                    toPrefetch.push_back(coord);
+                }
+            }
+        }
+
+        std::sort(toPrefetch.begin(), toPrefetch.end(),
+                  [cameraChunk](const glm::ivec2 &a, const glm::ivec2 &b)
+                  {
+                      glm::ivec2 da = a - cameraChunk;
+                      glm::ivec2 db = b - cameraChunk;
+                      return da.x * da.x + da.y * da.y < db.x * db.x + db.y * db.y;
+                  });
+
+        for (const auto &coord : toPrefetch)
+        {
+            QueueChunkLoad(coord.x, coord.y, true);
+        }
+    }
+
+    void ChunkManager::ProcessCompletedChunks()
+    {
+        int uploaded = 0;
+
+        while (uploaded < m_UploadBudgetPerFrame)
+        {
+            std::unique_ptr<Chunk> chunk;
+            {
+                std::lock_guard<std::mutex> lock(m_CompletedMutex);
+                if (m_CompletedChunks.empty())
+                    break;
+                chunk = std::move(m_CompletedChunks.front());
+                m_CompletedChunks.pop_front();
+            }
+
+            glm::ivec2 coord(chunk->GetChunkX(), chunk->GetChunkZ());
+            m_PendingChunks.erase(coord);
+
+            // The camera may have moved on while the chunk was generating
+            int dx = std::abs(coord.x - m_LastCameraChunk.x);
+            int dz = std::abs(coord.y - m_LastCameraChunk.y);
+            if (dx > m_Settings.viewDistance + PREFETCH_RING || dz > m_Settings.viewDistance + PREFETCH_RING)
+            {
+                chunk->Destroy();
+                continue;
+            }
+
+            chunk->Upload(*m_Device, m_TerrainRenderer);
+
+            // When regenerating, an old version may still occupy this slot;
+            // let the deferred-deletion queue reclaim it
+            auto existing = m_LoadedChunks.find(coord);
+            if (existing != m_LoadedChunks.end())
+            {
+                DeferredChunkDelete deferred;
+                deferred.chunk = std::move(existing->second);
+                deferred.framesRemaining = Renderer::MAX_FRAMES_IN_FLIGHT + 1;
+                m_DeferredDeletes.push_back(std::move(deferred));
+            }
+
+            bool hasDrainage = chunk->HasDrainageData();
+            bool uploadPending = chunk->GetState() == ChunkState::Loading;
+            Chunk *inserted = chunk.get();
+            m_LoadedChunks[coord] = std::move(chunk);
+            PublishChunkTable();
+            AddChunkObjects(coord, *inserted);
+            m_DebugFieldDirty.push_back(coord);
+            if (uploadPending)
+            {
+                m_UploadingChunks.push_back(coord);
+            }
+            uploaded++;
+
+            // Stitch drainage across the borders this chunk just created
+            if (m_Settings.stitchDrainage && hasDrainage)
+            {
+                StitchChunkDrainage(coord);
+            }
+
+            // Steady-state chunk load: flood this chunk and let connectivity
+            // trickle outward through the budgeted queue. During a wave the
+            // finish below queues everything at once instead.
+            if (m_Settings.useOceanMask && m_Settings.waterEnabled && !m_NeedsOceanFloodFill)
+            {
+                m_OceanUnseeded.insert(coord);
+                QueueOceanConnectivityUpdate(coord);
+            }
+        }
+
+        if (uploaded > 0)
+        {
+            // Preview wave landed: start the full-quality refinement pass.
+            // Queueing it refills m_PendingChunks, so the flood fill below
+            // keeps waiting until the refined chunks are in.
+            if (m_NeedsRefinementWave && m_PendingChunks.empty())
+            {
+                m_NeedsRefinementWave = false;
+                QueueRegenerationWave(false);
+            }
+
+            // A regeneration wave finished: queue ocean connectivity for
+            // every chunk; the per-frame drain below spreads the cost out
+            if (m_NeedsOceanFloodFill && m_PendingChunks.empty())
+            {
+                m_NeedsOceanFloodFill = false;
+                QueueOceanFloodFill();
+            }
+        }
+    }
+
+    void ChunkManager::PollUploadingChunks()
+    {
+        for (size_t i = 0; i < m_UploadingChunks.size();)
+        {
+            auto it = m_LoadedChunks.find(m_UploadingChunks[i]);
+            if (it == m_LoadedChunks.end() || it->second->PollUpload(*m_Device))
+            {
+                // Evicted, or its transfer completed and it is now Loaded
+                m_UploadingChunks[i] = m_UploadingChunks.back();
+                m_UploadingChunks.pop_back();
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    void ChunkManager::FlushPendingJobs()
+    {
+        // Drop queued jobs and wait out in-flight ones, discarding their results.
+        // Used before bulk regeneration so no chunk lands with stale settings.
+        {
+            std::lock_guard<std::mutex> lock(m_JobMutex);
+            for (const auto &job : m_JobQueue)
+            {
+                m_PendingChunks.erase(glm::ivec2(job.chunk->GetChunkX(), job.chunk->GetChunkZ()));
+            }
+            m_JobQueue.clear();
+        }
+
+        while (!m_PendingChunks.empty())
+        {
+            std::unique_ptr<Chunk> chunk;
+            {
+                std::lock_guard<std::mutex> lock(m_CompletedMutex);
+                if (!m_CompletedChunks.empty())
+                {
+                    chunk = std::move(m_CompletedChunks.front());
+                    m_CompletedChunks.pop_front();
+                }
+            }
+
+            if (chunk)
+            {
+                m_PendingChunks.erase(glm::ivec2(chunk->GetChunkX(), chunk->GetChunkZ()));
+                chunk->Destroy();
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
     glm::ivec2 ChunkManager::WorldToChunkCoord(float worldX, float worldZ) const
     {
         float chunkWorldSize = m_Settings.chunkSize * m_Settings.cellSize;
@@ -61,173 +555,782 @@ namespace Genesis
         return glm::ivec2(chunkX, chunkZ);
     }
 
-    glm::vec3 ChunkManager::ChunkCoordToWorld(int chunkX, int chunkZ) const
+    glm::vec3 ChunkManager::ChunkCoordToWorld(int chunkX, int chunkZ) const
+    {
+        float chunkWorldSize = m_Settings.chunkSize * m_Settings.cellSize;
+        return glm::vec3(chunkX * chunkWorldSize, 0.0f, chunkZ * chunkWorldSize);
+    }
+
+    void ChunkManager::Update(const glm::vec3 &cameraPosition)
+    {
+        GEN_PROFILE_SCOPE("ChunkManager::Update");
+        if (!m_Device)
+            return;
+
+        // Process deferred regeneration at frame start (before rendering)
+        if (m_NeedsRegeneration)
+        {
+            PerformRegeneration();
+            m_NeedsRegeneration = false;
+        }
+
+        // Pick up finished generation jobs every frame, not just on boundary crossings
+        ProcessCompletedChunks();
+
+        // Flip chunks whose async GPU uploads have completed to Loaded
+        PollUploadingChunks();
+
+        // Drain a few pending ocean connectivity updates
+        ProcessOceanConnectivityQueue();
+
+        // Release GPU resources of chunks unloaded a few frames ago
+        ProcessDeferredDeletes();
+
+        // Shed CPU-side chunk data if a long session pushed residency over
+        // the configured budget
+        EnforceMemoryBudget();
+
+        // Track smoothed camera movement for directional prefetch
+        if (m_HasLastCameraPosition)
+        {
+            glm::vec2 delta(cameraPosition.x - m_LastCameraPosition.x,
+                            cameraPosition.z - m_LastCameraPosition.z);
+            m_CameraVelocity = m_CameraVelocity * 0.9f + delta * 0.1f;
+        }
+        m_LastCameraPosition = cameraPosition;
+        m_HasLastCameraPosition = true;
+
+        glm::ivec2 cameraChunk = WorldToChunkCoord(cameraPosition.x, cameraPosition.z);
+
+        if (cameraChunk == m_LastCameraChunk)
+            return;
+        m_LastCameraChunk = cameraChunk;
+
+        // Border samples of far-away chunks won't be asked for again soon
+        m_BorderCache.Prune(cameraChunk, m_Settings.viewDistance + 2);
+
+        std::vector<glm::ivec2> chunksToLoad;
+        int viewDist = m_Settings.viewDistance;
+
+        for (int z = -viewDist; z <= viewDist; z++)
+        {
+            for (int x = -viewDist; x <= viewDist; x++)
+            {
+                glm::ivec2 coord(cameraChunk.x + x, cameraChunk.y + z);
+
+                if (m_LoadedChunks.find(coord) == m_LoadedChunks.end() &&
+                    m_PendingChunks.find(coord) == m_PendingChunks.end())
+                {
+                    chunksToLoad.push_back(coord);
+                }
+            }
+        }
+
+        // Generate closest chunks first so the terrain under the camera fills in early
+        std::sort(chunksToLoad.begin(), chunksToLoad.end(),
+                  [cameraChunk](const glm::ivec2 &a, const glm::ivec2 &b)
+                  {
+                      glm::ivec2 da = a - cameraChunk;
+                      glm::ivec2 db = b - cameraChunk;
+                      return da.x * da.x + da.y * da.y < db.x * db.x + db.y * db.y;
+                  });
+
+        std::vector<glm::ivec2> chunksToUnload;
+        for (const auto &[coord, chunk] : m_LoadedChunks)
+        {
+            int dx = std::abs(coord.x - cameraChunk.x);
+            int dz = std::abs(coord.y - cameraChunk.y);
+
+            // Margin covers the prefetch ring so speculatively loaded chunks
+            // ahead of the camera aren't unloaded before it reaches them
+            if (dx > viewDist + PREFETCH_RING || dz > viewDist + PREFETCH_RING)
+            {
+                chunksToUnload.push_back(coord);
+            }
+        }
+
+        for (const auto &coord : chunksToUnload)
+        {
+            UnloadChunk(coord.x, coord.y);
+        }
+
+        for (const auto &coord : chunksToLoad)
+        {
+            QueueChunkLoad(coord.x, coord.y);
+        }
+
+        // Already-loaded chunks may now be close enough to deserve a better
+        // hydrology tier than they were generated with
+        QueueHydrologyUpgrades(cameraChunk);
+
+        PrefetchAlongVelocity(cameraChunk);
+
+        if (!chunksToLoad.empty() || !chunksToUnload.empty())
+        {
+            GEN_DEBUG("Chunks updated: {} queued, {} unloaded, {} total",
+                      chunksToLoad.size(), chunksToUnload.size(), m_LoadedChunks.size());
+        }
+    }
+
+    void ChunkManager::LoadChunk(int chunkX, int chunkZ)
+    {
+        glm::ivec2 coord(chunkX, chunkZ);
+
+        auto chunk = std::make_unique<Chunk>(chunkX, chunkZ, m_Settings.chunkSize, m_Settings.cellSize);
+        float seaLevel = m_Settings.waterEnabled ? m_Settings.seaLevel : -1000.0f;
+
+        // Full hydrology near the camera, coarse in the mid ring, none beyond
+        HydrologyLod hydrologyLod = HydrologyLodForChunk(chunkX, chunkZ);
+
+        GEN_DEBUG("LoadChunk ({}, {}) - hydrologyLod: {}",
+                  chunkX, chunkZ, static_cast<int>(hydrologyLod));
+
+        if (!m_ChunkCache.TryLoad(*chunk, m_Settings.terrainSettings, m_Settings.seed, seaLevel))
+        {
+            std::vector<float> warm = TakeWarmHeightmap(coord);
+            bool warmRestored = !warm.empty();
+            if (warmRestored)
+            {
+                chunk->RestoreWarmHeightmap(std::move(warm));
+            }
+
+            HeightmapBorders halo = m_BorderCache.Gather(coord);
+            chunk->Generate(m_Settings.terrainSettings, m_Settings.seed, seaLevel, hydrologyLod, &halo);
+            if (!warmRestored)
+                m_BorderCache.Store(coord, chunk->m_TerrainGenerator.GetRawBorders());
+            if (hydrologyLod == HydrologyLod::Full)
+            {
+                m_ChunkCache.Save(*chunk, m_Settings.terrainSettings, m_Settings.seed, seaLevel);
+            }
+        }
+        chunk->Upload(*m_Device, m_TerrainRenderer);
+
+        Chunk *inserted = chunk.get();
+        m_LoadedChunks[coord] = std::move(chunk);
+        PublishChunkTable();
+        AddChunkObjects(coord, *inserted);
+        m_DebugFieldDirty.push_back(coord);
+    }
+
+    void ChunkManager::UnloadChunk(int chunkX, int chunkZ)
+    {
+        glm::ivec2 coord(chunkX, chunkZ);
+
+        auto it = m_LoadedChunks.find(coord);
+        if (it != m_LoadedChunks.end())
+        {
+            // Keep a compressed copy of the heightmap warm so a revisit
+            // decodes instead of re-running the noise stack
+            const auto &heightmap = it->second->m_TerrainGenerator.GetCachedHeightmap();
+            if (!heightmap.empty())
+            {
+                StoreWarmHeightmap(coord, heightmap);
+            }
+
+            // Defer destruction: command buffers from the last few frames may
+            // still reference this chunk's buffers. Once every in-flight frame
+            // fence has been waited on by the renderer, destruction is safe
+            // without a device-wide WaitIdle.
+            DeferredChunkDelete deferred;
+            deferred.chunk = std::move(it->second);
+            deferred.framesRemaining = Renderer::MAX_FRAMES_IN_FLIGHT + 1;
+            m_DeferredDeletes.push_back(std::move(deferred));
+            m_LoadedChunks.erase(it);
+            PublishChunkTable();
+            RemoveChunkObjects(coord);
+        }
+    }
+
+    void ChunkManager::ProcessDeferredDeletes(bool force)
+    {
+        uint64_t minPinned = 0;
+        if (!force && !m_DeferredDeletes.empty())
+        {
+            // Holding the overflow mutex here quiesces any reader that ran
+            // out of pin slots; slotted readers are covered by the scan
+            std::lock_guard<std::mutex> lock(m_ReaderOverflowMutex);
+            minPinned = MinPinnedEpoch();
+        }
+
+        for (auto it = m_DeferredDeletes.begin(); it != m_DeferredDeletes.end();)
+        {
+            it->framesRemaining--;
+            // GPU side: every in-flight frame fence has been waited on.
+            // CPU side: every snapshot that could still name this chunk
+            // has been unpinned (the publish that removed it stamped
+            // retireEpoch; 0 means that publish has not happened yet).
+            bool cpuRetired = it->retireEpoch != 0 && it->retireEpoch < minPinned;
+            if (force || (it->framesRemaining <= 0 && cpuRetired))
+            {
+                it->chunk->Destroy();
+                it = m_DeferredDeletes.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    namespace
+    {
+        // Reader pin slot this thread claimed, cached per manager instance
+        // so a torn-down and rebuilt world re-claims cleanly
+        thread_local const void *t_ReaderSlotOwner = nullptr;
+        thread_local int t_ReaderSlotIndex = -1;
+        thread_local bool t_OverflowPinned = false;
+    }
+
+    int ChunkManager::ClaimReaderSlot() const
+    {
+        if (t_ReaderSlotOwner == this)
+            return t_ReaderSlotIndex;
+
+        int index = m_ClaimedReaderSlots.fetch_add(1, std::memory_order_acq_rel);
+        if (index >= MAX_READER_SLOTS)
+        {
+            GEN_WARN("Chunk reader slots exhausted ({}); thread falls back to locked snapshot reads",
+                     MAX_READER_SLOTS);
+            index = -1;
+        }
+        t_ReaderSlotOwner = this;
+        t_ReaderSlotIndex = index;
+        return index;
+    }
+
+    uint64_t ChunkManager::MinPinnedEpoch() const
+    {
+        uint64_t minPinned = std::numeric_limits<uint64_t>::max();
+        int claimed = std::min(m_ClaimedReaderSlots.load(std::memory_order_acquire),
+                               static_cast<int>(MAX_READER_SLOTS));
+        for (int i = 0; i < claimed; i++)
+        {
+            // Sequentially consistent load pairing with the pin protocol in
+            // ChunkTableReader: a reader whose epoch re-check passed is
+            // guaranteed visible to this scan
+            uint64_t pinned = m_ReaderSlots[i].epoch.load();
+            if (pinned != READER_IDLE)
+                minPinned = std::min(minPinned, pinned);
+        }
+        return minPinned;
+    }
+
+    ChunkManager::ChunkTableReader::ChunkTableReader(const ChunkManager &manager)
+        : m_Manager(&manager)
+    {
+        int slotIndex = manager.ClaimReaderSlot();
+        if (slotIndex >= 0)
+        {
+            std::atomic<uint64_t> &slot = manager.m_ReaderSlots[slotIndex].epoch;
+            if (slot.load(std::memory_order_relaxed) == READER_IDLE)
+            {
+                // Announce-and-verify: publish the epoch being pinned, then
+                // re-check it. Once the re-check passes, reclamation must
+                // treat this epoch as live, so any table the load below can
+                // observe stays alive until the pin drops.
+                uint64_t epoch = manager.m_ChunkEpoch.load();
+                for (;;)
+                {
+                    slot.store(epoch);
+                    uint64_t current = manager.m_ChunkEpoch.load();
+                    if (current == epoch)
+                        break;
+                    epoch = current;
+                }
+                m_Slot = &slot;
+            }
+            // else: nested query on this thread - the outer pin already
+            // protects every table the inner reader can load
+        }
+        else if (!t_OverflowPinned)
+        {
+            // No slot left for this thread: serialize against reclamation
+            manager.m_ReaderOverflowMutex.lock();
+            t_OverflowPinned = true;
+            m_OverflowLocked = true;
+        }
+
+        m_Table = manager.m_PublishedChunkTable.load(std::memory_order_acquire);
+    }
+
+    ChunkManager::ChunkTableReader::~ChunkTableReader()
+    {
+        if (m_Slot)
+        {
+            m_Slot->store(READER_IDLE, std::memory_order_release);
+        }
+        if (m_OverflowLocked)
+        {
+            t_OverflowPinned = false;
+            m_Manager->m_ReaderOverflowMutex.unlock();
+        }
+    }
+
+    void ChunkManager::PublishChunkTable()
+    {
+        uint64_t epoch = m_ChunkEpoch.load(std::memory_order_relaxed);
+
+        auto table = std::make_unique<ChunkTable>();
+        table->epoch = epoch + 1;
+        for (const auto &[coord, chunk] : m_LoadedChunks)
+        {
+            table->chunks[coord] = chunk.get();
+        }
+
+        const ChunkTable *previous =
+            m_PublishedChunkTable.exchange(table.release(), std::memory_order_acq_rel);
+        m_ChunkEpoch.store(epoch + 1);
+
+        // The old table was current through `epoch`; readers pinned at or
+        // before it may still be walking it
+        if (previous)
+        {
+            m_RetiredTables.push_back({std::unique_ptr<const ChunkTable>(previous), epoch});
+        }
+
+        // Chunks deferred since the last publish left the table with it
+        for (auto &deferred : m_DeferredDeletes)
+        {
+            if (deferred.retireEpoch == 0)
+                deferred.retireEpoch = epoch;
+        }
+
+        if (!m_RetiredTables.empty())
+        {
+            std::lock_guard<std::mutex> lock(m_ReaderOverflowMutex);
+            uint64_t minPinned = MinPinnedEpoch();
+            std::erase_if(m_RetiredTables, [&](const RetiredTable &retired)
+                          { return retired.epoch < minPinned; });
+        }
+    }
+
+    void ChunkManager::StoreWarmHeightmap(const glm::ivec2 &coord, const std::vector<float> &heightmap)
+    {
+        if (m_Settings.warmHeightmapBudget == 0)
+            return;
+
+        int gridSize = m_Settings.chunkSize + 1;
+        CompressedHeightmap compressed = HeightmapCodec::Compress(heightmap, gridSize, gridSize);
+        if (compressed.Empty())
+            return;
+
+        std::lock_guard<std::mutex> lock(m_WarmMutex);
+
+        auto existing = m_WarmHeightmaps.find(coord);
+        if (existing != m_WarmHeightmaps.end())
+        {
+            m_WarmBytes -= existing->second.SizeBytes();
+            m_WarmHeightmaps.erase(existing);
+        }
+
+        m_WarmBytes += compressed.SizeBytes();
+        m_WarmHeightmaps[coord] = std::move(compressed);
+        m_WarmOrder.push_back(coord);
+
+        // FIFO eviction back under budget. Order entries whose coord was
+        // already taken or replaced just miss the map and are skipped.
+        while (m_WarmBytes > m_Settings.warmHeightmapBudget && !m_WarmOrder.empty())
+        {
+            glm::ivec2 oldest = m_WarmOrder.front();
+            m_WarmOrder.pop_front();
+            auto it = m_WarmHeightmaps.find(oldest);
+            if (it != m_WarmHeightmaps.end())
+            {
+                m_WarmBytes -= it->second.SizeBytes();
+                m_WarmHeightmaps.erase(it);
+            }
+        }
+    }
+
+    std::vector<float> ChunkManager::TakeWarmHeightmap(const glm::ivec2 &coord)
+    {
+        CompressedHeightmap compressed;
+        {
+            std::lock_guard<std::mutex> lock(m_WarmMutex);
+            auto it = m_WarmHeightmaps.find(coord);
+            if (it == m_WarmHeightmaps.end())
+                return {};
+            compressed = std::move(it->second);
+            m_WarmBytes -= compressed.SizeBytes();
+            m_WarmHeightmaps.erase(it);
+        }
+
+        // Decode outside the lock; generation workers call this
+        return HeightmapCodec::Decompress(compressed);
+    }
+
+    void ChunkManager::ClearWarmHeightmaps()
+    {
+        std::lock_guard<std::mutex> lock(m_WarmMutex);
+        m_WarmHeightmaps.clear();
+        m_WarmOrder.clear();
+        m_WarmBytes = 0;
+    }
+
+    size_t ChunkManager::GetCpuMemoryUsage() const
+    {
+        size_t total = 0;
+        for (const auto &[coord, chunk] : m_LoadedChunks)
+        {
+            total += chunk->GetCpuMemoryUsage();
+        }
+        return total;
+    }
+
+    void ChunkManager::EnforceMemoryBudget()
+    {
+        m_FrameCounter++;
+
+        size_t budget = m_Settings.cpuMemoryBudget;
+        if (budget == 0)
+            return;
+
+        size_t total = GetCpuMemoryUsage();
+        if (total <= budget)
+            return;
+
+        // Least recently rendered first; chunks still generating or
+        // uploading keep their data (it feeds the pending upload)
+        std::vector<Chunk *> candidates;
+        candidates.reserve(m_LoadedChunks.size());
+        for (const auto &[coord, chunk] : m_LoadedChunks)
+        {
+            if (chunk->GetState() == ChunkState::Loaded)
+            {
+                candidates.push_back(chunk.get());
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Chunk *a, const Chunk *b)
+                  {
+                      return a->m_LastRenderedFrame < b->m_LastRenderedFrame;
+                  });
+
+        size_t releasedBytes = 0;
+        int releasedChunks = 0;
+        for (Chunk *chunk : candidates)
+        {
+            if (total <= budget)
+                break;
+
+            size_t before = chunk->GetCpuMemoryUsage();
+            chunk->ReleaseCpuData();
+            size_t freed = before - chunk->GetCpuMemoryUsage();
+            total -= freed;
+            releasedBytes += freed;
+            releasedChunks++;
+        }
+
+        if (releasedChunks > 0)
+        {
+            GEN_DEBUG("Memory budget: released {} MB of CPU data from {} chunk(s), {} MB resident",
+                      releasedBytes / (1024 * 1024), releasedChunks, total / (1024 * 1024));
+        }
+    }
+
+    namespace
     {
-        float chunkWorldSize = m_Settings.chunkSize * m_Settings.cellSize;
-        return glm::vec3(chunkX * chunkWorldSize, 0.0f, chunkZ * chunkWorldSize);
+        // Fills freed pool slots: zero scale and far below any terrain, so
+        // the GPU cull pass rejects them without CPU-side compaction
+        InstanceData VacantInstance()
+        {
+            InstanceData vacant{};
+            vacant.PositionAndScale = glm::vec4(0.0f, -100000.0f, 0.0f, 0.0f);
+            vacant.RotationAndTint = glm::vec4(0.0f);
+            return vacant;
+        }
     }
 
-    void ChunkManager::Update(const glm::vec3 &cameraPosition)
+    bool ChunkManager::InstanceRangePool::Assign(const glm::ivec2 &coord, const std::vector<InstanceData> &data)
     {
-        if (!m_Device)
-            return;
+        bool changed = false;
 
-        // Process deferred regeneration at frame start (before rendering)
-        if (m_NeedsRegeneration)
+        auto it = ranges.find(coord);
+        if (it != ranges.end())
         {
-            PerformRegeneration();
-            m_NeedsRegeneration = false;
+            // Same-size replacement (hydrology upgrades, regeneration with
+            // unchanged placement) rewrites in place
+            if (it->second.count == data.size())
+            {
+                if (data.empty())
+                    return false;
+                std::copy(data.begin(), data.end(), instances.begin() + it->second.first);
+                return true;
+            }
+            FreeRange(it->second);
+            ranges.erase(it);
+            changed = true;
         }
 
-        glm::ivec2 cameraChunk = WorldToChunkCoord(cameraPosition.x, cameraPosition.z);
+        if (data.empty())
+            return changed;
 
-        if (cameraChunk == m_LastCameraChunk)
-            return;
-        m_LastCameraChunk = cameraChunk;
+        Range range;
+        range.count = static_cast<uint32_t>(data.size());
+        range.first = Allocate(range.count);
+        std::copy(data.begin(), data.end(), instances.begin() + range.first);
+        ranges[coord] = range;
+        return true;
+    }
 
-        std::vector<glm::ivec2> chunksToLoad;
-        int viewDist = m_Settings.viewDistance;
+    bool ChunkManager::InstanceRangePool::Release(const glm::ivec2 &coord)
+    {
+        auto it = ranges.find(coord);
+        if (it == ranges.end())
+            return false;
 
-        for (int z = -viewDist; z <= viewDist; z++)
+        FreeRange(it->second);
+        ranges.erase(it);
+        return true;
+    }
+
+    void ChunkManager::InstanceRangePool::Clear()
+    {
+        instances.clear();
+        ranges.clear();
+        freeBlocks.clear();
+    }
+
+    uint32_t ChunkManager::InstanceRangePool::Allocate(uint32_t count)
+    {
+        // First fit; chunks produce similar instance counts, so freed
+        // ranges are reused quickly and fragmentation stays low
+        for (size_t i = 0; i < freeBlocks.size(); i++)
         {
-            for (int x = -viewDist; x <= viewDist; x++)
+            if (freeBlocks[i].count >= count)
             {
-                glm::ivec2 coord(cameraChunk.x + x, cameraChunk.y + z);
-
-                if (m_LoadedChunks.find(coord) == m_LoadedChunks.end())
-                {
-                    chunksToLoad.push_back(coord);
-                }
+                uint32_t first = freeBlocks[i].first;
+                freeBlocks[i].first += count;
+                freeBlocks[i].count -= count;
+                if (freeBlocks[i].count == 0)
+                    freeBlocks.erase(freeBlocks.begin() + i);
+                return first;
             }
         }
 
-        std::vector<glm::ivec2> chunksToUnload;
-        for (const auto &[coord, chunk] : m_LoadedChunks)
-        {
-            int dx = std::abs(coord.x - cameraChunk.x);
-            int dz = std::abs(coord.y - cameraChunk.y);
+        uint32_t first = static_cast<uint32_t>(instances.size());
+        instances.resize(instances.size() + count);
+        return first;
+    }
 
-            if (dx > viewDist + 1 || dz > viewDist + 1)
+    void ChunkManager::InstanceRangePool::FreeRange(Range range)
+    {
+        // Insert sorted by first and coalesce with the neighbors
+        auto pos = std::lower_bound(freeBlocks.begin(), freeBlocks.end(), range,
+                                    [](const Range &a, const Range &b)
+                                    { return a.first < b.first; });
+        pos = freeBlocks.insert(pos, range);
+
+        if (pos != freeBlocks.begin())
+        {
+            auto prev = pos - 1;
+            if (prev->first + prev->count == pos->first)
             {
-                chunksToUnload.push_back(coord);
+                prev->count += pos->count;
+                pos = freeBlocks.erase(pos) - 1;
             }
         }
-
-        if (!chunksToUnload.empty())
+        if (pos + 1 != freeBlocks.end() && pos->first + pos->count == (pos + 1)->first)
         {
-            m_Device->WaitIdle();
+            pos->count += (pos + 1)->count;
+            freeBlocks.erase(pos + 1);
         }
 
-        for (const auto &coord : chunksToUnload)
+        // A trailing free block shrinks the array; interior holes get
+        // sentinel-filled so the array stays valid for the renderer
+        if (!freeBlocks.empty() && freeBlocks.back().first + freeBlocks.back().count == instances.size())
         {
-            UnloadChunk(coord.x, coord.y);
+            instances.resize(freeBlocks.back().first);
+            freeBlocks.pop_back();
         }
+        size_t fillBegin = std::min<size_t>(range.first, instances.size());
+        size_t fillEnd = std::min<size_t>(range.first + range.count, instances.size());
+        std::fill(instances.begin() + fillBegin, instances.begin() + fillEnd, VacantInstance());
+    }
 
-        for (const auto &coord : chunksToLoad)
+    void ChunkManager::AddChunkObjects(const glm::ivec2 &coord, const Chunk &chunk)
+    {
+        bool changed = m_TreeInstancePool.Assign(coord, chunk.GetTreeInstances());
+        changed |= m_RockInstancePool.Assign(coord, chunk.GetRockInstances());
+        if (changed)
         {
-            LoadChunk(coord.x, coord.y);
+            m_ObjectsVersion++;
         }
+    }
 
-        if (!chunksToLoad.empty() || !chunksToUnload.empty())
+    void ChunkManager::RemoveChunkObjects(const glm::ivec2 &coord)
+    {
+        bool changed = m_TreeInstancePool.Release(coord);
+        changed |= m_RockInstancePool.Release(coord);
+        if (changed)
         {
-            RebuildObjectPositions();
-            GEN_DEBUG("Chunks updated: {} loaded, {} unloaded, {} total",
-                      chunksToLoad.size(), chunksToUnload.size(), m_LoadedChunks.size());
+            m_ObjectsVersion++;
         }
     }
 
-    void ChunkManager::LoadChunk(int chunkX, int chunkZ)
+    void ChunkManager::UploadDebugFieldBlocks(Renderer &renderer)
     {
-        glm::ivec2 coord(chunkX, chunkZ);
+        if (m_DebugFieldDirty.empty())
+            return;
 
-        auto chunk = std::make_unique<Chunk>(chunkX, chunkZ, m_Settings.chunkSize, m_Settings.cellSize);
-        float seaLevel = m_Settings.waterEnabled ? m_Settings.seaLevel : -1000.0f;
+        DebugFieldAtlas &atlas = renderer.GetDebugFieldAtlas();
+        if (!atlas.IsValid() || atlas.GetChunkTexels() != m_Settings.chunkSize)
+        {
+            // Atlas was sized for a different chunk resolution; the GPU
+            // overlay simply stays dark for this world
+            m_DebugFieldDirty.clear();
+            return;
+        }
 
-        // Only compute full hydrology for chunks within hydrologyDistance
-        int dx = std::abs(chunkX - m_LastCameraChunk.x);
-        int dz = std::abs(chunkZ - m_LastCameraChunk.y);
-        bool computeHydrology = (dx <= m_Settings.hydrologyDistance && dz <= m_Settings.hydrologyDistance);
+        renderer.SetDebugAtlasWorldSize(DebugFieldAtlas::CHUNKS_PER_SIDE *
+                                        m_Settings.chunkSize * m_Settings.cellSize);
 
-        GEN_DEBUG("LoadChunk ({}, {}) - hydrology: {}",
-                  chunkX, chunkZ, computeHydrology);
+        GEN_PROFILE_SCOPE("ChunkManager::UploadDebugFieldBlocks");
+        std::vector<uint8_t> block;
+        bool anyUploaded = false;
+        for (const glm::ivec2 &coord : m_DebugFieldDirty)
+        {
+            auto it = m_LoadedChunks.find(coord);
+            if (it == m_LoadedChunks.end())
+                continue;
 
-        chunk->Generate(m_Settings.terrainSettings, m_Settings.seed, seaLevel, computeHydrology);
-        chunk->Upload(*m_Device);
+            // Chunks whose CPU data was already released keep their stale
+            // slot contents; a revisit re-marks them when the data returns
+            if (!it->second->BuildDebugFieldBlock(block))
+                continue;
 
-        m_LoadedChunks[coord] = std::move(chunk);
+            atlas.UpdateChunk(coord.x, coord.y, block.data());
+            anyUploaded = true;
+        }
+        m_DebugFieldDirty.clear();
+
+        if (anyUploaded)
+            atlas.FlushUploads();
     }
 
-    void ChunkManager::UnloadChunk(int chunkX, int chunkZ)
+    void ChunkManager::Render(Renderer &renderer, const Camera &camera)
     {
-        glm::ivec2 coord(chunkX, chunkZ);
+        GEN_PROFILE_SCOPE("ChunkManager::Render");
+        UploadDebugFieldBlocks(renderer);
+        const Frustum &frustum = camera.GetFrustum();
+        glm::vec3 cameraPos = camera.GetPosition();
+        float chunkWorldSize = m_Settings.chunkSize * m_Settings.cellSize;
 
-        auto it = m_LoadedChunks.find(coord);
-        if (it != m_LoadedChunks.end())
+        struct VisibleChunk
         {
-            it->second->Destroy();
-            m_LoadedChunks.erase(it);
-        }
-    }
+            Chunk *chunk;
+            glm::mat4 transform;
+            float distanceSq;
+            int lod;
+        };
 
-    void ChunkManager::RebuildObjectPositions()
-    {
-        m_AllTreePositions.clear();
-        m_AllRockPositions.clear();
+        struct CandidateChunk
+        {
+            Chunk *chunk;
+            glm::vec3 worldPos;
+            glm::vec3 aabbMin;
+            glm::vec3 aabbMax;
+            int lod;
+        };
+
+        std::vector<CandidateChunk> candidates;
+        candidates.reserve(m_LoadedChunks.size());
 
         for (const auto &[coord, chunk] : m_LoadedChunks)
         {
-            const auto &trees = chunk->GetTreePositions();
-            const auto &rocks = chunk->GetRockPositions();
+            if (chunk->GetState() != ChunkState::Loaded || !chunk->GetMesh())
+                continue;
 
-            m_AllTreePositions.insert(m_AllTreePositions.end(), trees.begin(), trees.end());
-            m_AllRockPositions.insert(m_AllRockPositions.end(), rocks.begin(), rocks.end());
+            glm::vec3 worldPos = chunk->GetWorldPosition();
+            glm::vec3 aabbMin(worldPos.x, chunk->GetMinHeight(), worldPos.z);
+            glm::vec3 aabbMax(worldPos.x + chunkWorldSize,
+                              std::max(chunk->GetMaxHeight(), m_Settings.seaLevel),
+                              worldPos.z + chunkWorldSize);
+
+            // Select LOD by chunk distance from the camera (Chebyshev rings)
+            int dist = std::max(std::abs(coord.x - m_LastCameraChunk.x),
+                                std::abs(coord.y - m_LastCameraChunk.y));
+            int lod = std::min(std::max(dist - 1, 0), Chunk::LOD_COUNT - 1);
+
+            candidates.push_back({chunk.get(), worldPos, aabbMin, aabbMax, lod});
         }
-    }
 
-    void ChunkManager::Render(Renderer &renderer)
-    {
-        for (const auto &[coord, chunk] : m_LoadedChunks)
+        std::vector<VisibleChunk> visibleChunks;
+        visibleChunks.reserve(candidates.size());
+
+        // Frustum-test candidates eight at a time (vectorized in
+        // Frustum::TestBatch); padding lanes in the last batch are ignored
+        AABBBatch8 batch{};
+        for (size_t base = 0; base < candidates.size(); base += 8)
         {
-            if (chunk->GetState() == ChunkState::Loaded && chunk->GetMesh())
+            size_t count = std::min<size_t>(8, candidates.size() - base);
+            for (size_t i = 0; i < count; i++)
+                batch.Set(i, candidates[base + i].aabbMin, candidates[base + i].aabbMax);
+
+            uint8_t visibleMask = frustum.TestBatch(batch);
+            for (size_t i = 0; i < count; i++)
             {
-                glm::vec3 worldPos = chunk->GetWorldPosition();
-                glm::mat4 transform = glm::translate(glm::mat4(1.0f), worldPos);
-                renderer.Draw(*chunk->GetMesh(), transform);
+                if (!(visibleMask & (1u << i)))
+                    continue;
+
+                const CandidateChunk &candidate = candidates[base + i];
+                candidate.chunk->m_LastRenderedFrame = m_FrameCounter;
+                glm::vec3 center = (candidate.aabbMin + candidate.aabbMax) * 0.5f;
+                float distanceSq = glm::dot(center - cameraPos, center - cameraPos);
+
+                visibleChunks.push_back({candidate.chunk,
+                                         glm::translate(glm::mat4(1.0f), candidate.worldPos),
+                                         distanceSq,
+                                         candidate.lod});
             }
         }
 
+        // Front-to-back so the depth test rejects occluded terrain early
+        std::sort(visibleChunks.begin(), visibleChunks.end(),
+                  [](const VisibleChunk &a, const VisibleChunk &b)
+                  {
+                      return a.distanceSq < b.distanceSq;
+                  });
+
+        for (const auto &visible : visibleChunks)
+        {
+            // Tagged with the chunk's packed coordinate so the editor's
+            // ID-buffer picking can resolve the chunk under the cursor
+            renderer.Draw(*visible.chunk->GetLodMesh(visible.lod), visible.transform,
+                          PackChunkPickID(visible.chunk->GetChunkX(), visible.chunk->GetChunkZ()));
+        }
+
         if (m_Settings.waterEnabled)
         {
-            // Render ocean water planes
-            for (const auto &[coord, chunk] : m_LoadedChunks)
+            // Render the single global ocean surface. The grid follows the
+            // camera in inner-cell increments so its vertices stay fixed in
+            // world space (no swimming), and the transform supplies the sea
+            // level; the wave phase comes from world position in water.vert,
+            // so the surface stays continuous as it moves. Where terrain
+            // rises above sea level the plane simply fails the depth test.
+            if (m_OceanMesh)
             {
-                if (chunk->GetState() == ChunkState::Loaded && chunk->HasWater() && chunk->GetWaterMesh())
-                {
-                    glm::vec3 worldPos = chunk->GetWorldPosition();
-                    glm::mat4 transform = glm::translate(glm::mat4(1.0f), worldPos);
-                    renderer.DrawWater(*chunk->GetWaterMesh(), transform);
-                }
+                glm::vec3 oceanPos(std::floor(cameraPos.x / m_OceanCellSize) * m_OceanCellSize,
+                                   m_Settings.seaLevel,
+                                   std::floor(cameraPos.z / m_OceanCellSize) * m_OceanCellSize);
+                renderer.DrawWater(*m_OceanMesh, glm::translate(glm::mat4(1.0f), oceanPos));
             }
 
             // Render lake meshes
-            for (const auto &[coord, chunk] : m_LoadedChunks)
+            for (const auto &visible : visibleChunks)
             {
-                if (chunk->GetState() == ChunkState::Loaded && chunk->HasLakes() && chunk->GetLakeMesh())
+                if (visible.chunk->HasLakes() && visible.chunk->GetLakeMesh())
                 {
-                    glm::vec3 worldPos = chunk->GetWorldPosition();
-                    glm::mat4 transform = glm::translate(glm::mat4(1.0f), worldPos);
-                    renderer.DrawWater(*chunk->GetLakeMesh(), transform);
+                    renderer.DrawWater(*visible.chunk->GetLakeMesh(), visible.transform);
                 }
             }
 
             // Render river meshes
-            for (const auto &[coord, chunk] : m_LoadedChunks)
+            for (const auto &visible : visibleChunks)
             {
-                if (chunk->GetState() == ChunkState::Loaded && chunk->HasRivers() && chunk->GetRiverMesh())
+                if (visible.chunk->HasRivers() && visible.chunk->GetRiverMesh())
                 {
-                    glm::vec3 worldPos = chunk->GetWorldPosition();
-                    glm::mat4 transform = glm::translate(glm::mat4(1.0f), worldPos);
-                    renderer.DrawWater(*chunk->GetRiverMesh(), transform);
+                    renderer.DrawWater(*visible.chunk->GetRiverMesh(), visible.transform);
                 }
             }
         }
@@ -235,6 +1338,9 @@ namespace Genesis
 
     float ChunkManager::GetHeightAt(float worldX, float worldZ) const
     {
+        // Pin one snapshot across the lookup and the sample so the chunk
+        // cannot be reclaimed between them
+        ChunkTableReader table(*this);
         Chunk *chunk = GetChunkAt(worldX, worldZ);
         if (chunk)
         {
@@ -246,6 +1352,208 @@ namespace Genesis
         return 0.0f;
     }
 
+    bool ChunkManager::RaycastTerrain(const glm::vec3 &origin, const glm::vec3 &direction,
+                                      float maxDistance, glm::vec3 &outHit) const
+    {
+        float dirLength = glm::length(direction);
+        if (dirLength < 1e-6f || maxDistance <= 0.0f)
+            return false;
+
+        glm::vec3 dir = direction / dirLength;
+        float chunkWorldSize = m_Settings.chunkSize * m_Settings.cellSize;
+
+        // One snapshot covers the whole traversal
+        ChunkTableReader table(*this);
+
+        // Amanatides-Woo traversal of the chunk grid in XZ. Each visited
+        // chunk is queried over exactly the ray segment crossing its
+        // footprint, so the first chunk that reports a hit holds the
+        // nearest one.
+        glm::ivec2 coord = WorldToChunkCoord(origin.x, origin.z);
+
+        int stepX = dir.x > 0.0f ? 1 : -1;
+        int stepZ = dir.z > 0.0f ? 1 : -1;
+
+        // Distance along the ray to the next chunk border per axis, and
+        // the distance between successive borders. Axes the ray runs
+        // parallel to never advance.
+        constexpr float NEVER = std::numeric_limits<float>::max();
+        float tNextX = NEVER;
+        float tDeltaX = NEVER;
+        if (std::abs(dir.x) > 1e-8f)
+        {
+            float borderX = (coord.x + (stepX > 0 ? 1 : 0)) * chunkWorldSize;
+            tNextX = (borderX - origin.x) / dir.x;
+            tDeltaX = chunkWorldSize / std::abs(dir.x);
+        }
+
+        float tNextZ = NEVER;
+        float tDeltaZ = NEVER;
+        if (std::abs(dir.z) > 1e-8f)
+        {
+            float borderZ = (coord.y + (stepZ > 0 ? 1 : 0)) * chunkWorldSize;
+            tNextZ = (borderZ - origin.z) / dir.z;
+            tDeltaZ = chunkWorldSize / std::abs(dir.z);
+        }
+
+        float tEnter = 0.0f;
+        while (tEnter < maxDistance)
+        {
+            float tExit = std::min(std::min(tNextX, tNextZ), maxDistance);
+
+            if (Chunk *chunk = GetChunkByCoord(coord.x, coord.y))
+            {
+                glm::vec3 chunkPos = chunk->GetWorldPosition();
+                glm::vec3 localOrigin = origin - chunkPos;
+
+                float t = 0.0f;
+                if (chunk->RaycastTerrain(localOrigin, dir, tEnter, tExit, t))
+                {
+                    outHit = origin + dir * t;
+                    return true;
+                }
+            }
+
+            if (tNextX == NEVER && tNextZ == NEVER)
+                break; // Vertical ray: one chunk covers the whole segment
+
+            tEnter = std::min(tNextX, tNextZ);
+            if (tNextX < tNextZ)
+            {
+                coord.x += stepX;
+                tNextX += tDeltaX;
+            }
+            else
+            {
+                coord.y += stepZ;
+                tNextZ += tDeltaZ;
+            }
+        }
+
+        return false;
+    }
+
+    const RiverSegment *ChunkManager::FindNearestRiverSegment(float worldX, float worldZ, float maxDistance,
+                                                              glm::vec3 *outPosition) const
+    {
+        // Visit every chunk the search circle overlaps so a river just
+        // across a border still wins over a farther one in this chunk;
+        // one pinned snapshot keeps them all alive for the scan
+        ChunkTableReader table(*this);
+        glm::ivec2 minCoord = WorldToChunkCoord(worldX - maxDistance, worldZ - maxDistance);
+        glm::ivec2 maxCoord = WorldToChunkCoord(worldX + maxDistance, worldZ + maxDistance);
+
+        const RiverSegment *best = nullptr;
+        glm::vec3 bestPosition(0.0f);
+        float bestDistSq = maxDistance * maxDistance;
+
+        for (int cz = minCoord.y; cz <= maxCoord.y; cz++)
+        {
+            for (int cx = minCoord.x; cx <= maxCoord.x; cx++)
+            {
+                Chunk *chunk = GetChunkByCoord(cx, cz);
+                if (!chunk)
+                    continue;
+
+                glm::vec3 chunkPos = chunk->GetWorldPosition();
+                const RiverSegment *segment =
+                    chunk->FindNearestRiverSegment(worldX - chunkPos.x, worldZ - chunkPos.z, maxDistance);
+                if (!segment)
+                    continue;
+
+                glm::vec3 segmentPos = chunk->GetRiverSegmentWorldPosition(*segment);
+                float dx = segmentPos.x - worldX;
+                float dz = segmentPos.z - worldZ;
+                float distSq = dx * dx + dz * dz;
+                if (distSq < bestDistSq)
+                {
+                    bestDistSq = distSq;
+                    best = segment;
+                    bestPosition = segmentPos;
+                }
+            }
+        }
+
+        if (best && outPosition)
+            *outPosition = bestPosition;
+        return best;
+    }
+
+    void ChunkManager::GetHeightsAt(std::span<const glm::vec2> positions, std::span<float> outHeights) const
+    {
+        size_t count = std::min(positions.size(), outHeights.size());
+        if (count == 0)
+            return;
+
+        // One pinned snapshot for the whole batch
+        ChunkTableReader table(*this);
+
+        // Sort query indices by owning chunk so each chunk is looked up once
+        // per group instead of once per query
+        float chunkWorldSize = m_Settings.chunkSize * m_Settings.cellSize;
+        auto coordOf = [&](uint32_t i)
+        {
+            return glm::ivec2(static_cast<int>(std::floor(positions[i].x / chunkWorldSize)),
+                              static_cast<int>(std::floor(positions[i].y / chunkWorldSize)));
+        };
+
+        std::vector<uint32_t> order(count);
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(),
+                  [&](uint32_t a, uint32_t b)
+                  {
+                      glm::ivec2 ca = coordOf(a);
+                      glm::ivec2 cb = coordOf(b);
+                      return ca.x != cb.x ? ca.x < cb.x : ca.y < cb.y;
+                  });
+
+        // Queries with no loaded chunk get collected and resolved in one
+        // batch noise evaluation at the end
+        std::vector<float> missXs, missZs;
+        std::vector<uint32_t> missIndices;
+
+        size_t i = 0;
+        while (i < count)
+        {
+            glm::ivec2 coord = coordOf(order[i]);
+            Chunk *chunk = GetChunkByCoord(coord.x, coord.y);
+            glm::vec3 chunkPos = chunk ? chunk->GetWorldPosition() : glm::vec3(0.0f);
+
+            for (; i < count && coordOf(order[i]) == coord; i++)
+            {
+                uint32_t q = order[i];
+                if (chunk)
+                {
+                    outHeights[q] = chunk->GetHeightAt(positions[q].x - chunkPos.x,
+                                                       positions[q].y - chunkPos.z);
+                }
+                else
+                {
+                    missXs.push_back(positions[q].x);
+                    missZs.push_back(positions[q].y);
+                    missIndices.push_back(q);
+                }
+            }
+        }
+
+        if (!missIndices.empty())
+        {
+            // Off-grid fallback: raw (pre-erosion) heights from the noise
+            // stack, evaluated through the batch row sampler
+            TerrainSettings settings = m_Settings.terrainSettings;
+            settings.seed = m_Settings.seed;
+            TerrainGenerator generator(settings);
+
+            std::vector<float> missHeights(missIndices.size());
+            generator.SampleRawHeightRow(missXs.data(), missZs.data(),
+                                         missHeights.data(), missHeights.size());
+            for (size_t m = 0; m < missIndices.size(); m++)
+            {
+                outHeights[missIndices[m]] = missHeights[m];
+            }
+        }
+    }
+
     Chunk *ChunkManager::GetChunkAt(float worldX, float worldZ) const
     {
         glm::ivec2 coord = WorldToChunkCoord(worldX, worldZ);
@@ -255,12 +1563,29 @@ namespace Genesis
     Chunk *ChunkManager::GetChunkByCoord(int chunkX, int chunkZ) const
     {
         glm::ivec2 coord(chunkX, chunkZ);
-        auto it = m_LoadedChunks.find(coord);
-        if (it != m_LoadedChunks.end())
+
+        ChunkTableReader table(*this);
+        if (!table)
+            return nullptr;
+
+        // Repeated queries overwhelmingly hit the same chunk (per-point
+        // height sampling walks a surface); answer those without probing.
+        // The cache is per-thread and keyed on the table epoch, so a
+        // republish can never serve a chunk the table no longer holds.
+        thread_local uint64_t t_CacheEpoch = 0; // Epochs start at 1
+        thread_local glm::ivec2 t_CacheCoord;
+        thread_local Chunk *t_CacheChunk;
+        if (t_CacheEpoch == table->epoch && t_CacheCoord == coord)
         {
-            return it->second.get();
+            return t_CacheChunk;
         }
-        return nullptr;
+
+        auto it = table->chunks.find(coord);
+        Chunk *chunk = it != table->chunks.end() ? it->second : nullptr;
+        t_CacheEpoch = table->epoch;
+        t_CacheCoord = coord;
+        t_CacheChunk = chunk;
+        return chunk;
     }
 
     void ChunkManager::SetViewDistance(int distance)
@@ -290,38 +1615,68 @@ namespace Genesis
 
         GEN_INFO("PerformRegeneration: starting...");
 
+        // Discard in-flight generation jobs so nothing lands with stale settings,
+        // and cached border samples, which the new settings invalidate
+        FlushPendingJobs();
+        m_BorderCache.Clear();
+        ClearWarmHeightmaps();
+
         // Recompute absolute sea level from normalized value
         m_Settings.ComputeSeaLevel();
         GEN_INFO("Sea level: {} (normalized: {})", m_Settings.seaLevel, m_Settings.seaLevelNormalized);
 
-        m_Device->WaitIdle();
+        // Queue every loaded chunk for regeneration instead of tearing the
+        // world down. The old chunk keeps rendering until its replacement
+        // arrives, and the nearest chunks are rebuilt first. In progressive
+        // mode the first wave is a cheap preview for instant feedback; the
+        // full-quality refinement wave is queued once the preview has landed
+        // (see ProcessCompletedChunks).
+        bool progressive = m_Settings.progressiveRefinement;
+        QueueRegenerationWave(progressive);
+        m_NeedsRefinementWave = progressive;
+
+        // Ocean flood fill needs the whole wave, so it runs once the last
+        // regenerated chunk has landed (see ProcessCompletedChunks)
+        m_NeedsOceanFloodFill = m_Settings.useOceanMask && m_Settings.waterEnabled;
+    }
 
+    void ChunkManager::QueueRegenerationWave(bool preview)
+    {
         std::vector<glm::ivec2> chunksToRegenerate;
+        chunksToRegenerate.reserve(m_LoadedChunks.size());
         for (const auto &[coord, chunk] : m_LoadedChunks)
         {
             chunksToRegenerate.push_back(coord);
         }
 
-        GEN_INFO("Unloading {} chunks...", chunksToRegenerate.size());
-        for (const auto &coord : chunksToRegenerate)
-        {
-            UnloadChunk(coord.x, coord.y);
-        }
+        glm::ivec2 cameraChunk = m_LastCameraChunk;
+        std::sort(chunksToRegenerate.begin(), chunksToRegenerate.end(),
+                  [cameraChunk](const glm::ivec2 &a, const glm::ivec2 &b)
+                  {
+                      glm::ivec2 da = a - cameraChunk;
+                      glm::ivec2 db = b - cameraChunk;
+                      return da.x * da.x + da.y * da.y < db.x * db.x + db.y * db.y;
+                  });
 
-        GEN_INFO("Reloading {} chunks...", chunksToRegenerate.size());
         for (const auto &coord : chunksToRegenerate)
         {
-            LoadChunk(coord.x, coord.y);
+            QueueChunkLoad(coord.x, coord.y, false, preview);
         }
 
-        // Perform ocean flood fill across all loaded chunks
-        if (m_Settings.useOceanMask && m_Settings.waterEnabled)
-        {
-            PerformOceanFloodFill();
-        }
+        GEN_INFO("Queued {} chunks for incremental regeneration ({})",
+                 chunksToRegenerate.size(), preview ? "preview" : "full quality");
+    }
 
-        RebuildObjectPositions();
-        GEN_INFO("Regenerated {} chunks with updated settings", chunksToRegenerate.size());
+    TerrainSettings ChunkManager::MakePreviewSettings(const TerrainSettings &settings)
+    {
+        // Enough octaves for the silhouette, none of the expensive shaping.
+        // Hydrology is skipped separately via the job's hydrology tier.
+        TerrainSettings preview = settings;
+        preview.octaves = std::min(preview.octaves, 2);
+        preview.useWarp = false;
+        preview.useErosion = false;
+        preview.useHydraulicErosion = false;
+        return preview;
     }
 
     void ChunkManager::UpdateTerrainSettings(const TerrainSettings &settings)
@@ -372,127 +1727,257 @@ namespace Genesis
         return false;
     }
 
-    void ChunkManager::PerformOceanFloodFill()
+    void ChunkManager::StitchChunkDrainage(const glm::ivec2 &start)
     {
-        GEN_DEBUG("PerformOceanFloodFill: starting ocean mask computation");
+        // Exchange boundary flow with neighbors, worklist-style: pushing
+        // flow into a chunk can raise its outflow on another edge, so
+        // affected chunks re-enter the list. The received-delta guard in
+        // AddBoundaryInflow makes the exchange monotone, so it converges;
+        // the iteration cap is only a safety net.
+        std::vector<glm::ivec2> worklist{start};
+        int iterations = 0;
+        const int maxIterations = 64;
 
-        // Step 1: Run initial flood fill on all chunks from world boundaries
-        for (auto &[coord, chunk] : m_LoadedChunks)
+        struct NeighborEdge
+        {
+            glm::ivec2 offset;
+            ChunkEdge ourEdge;      // Edge of ours facing the neighbor
+            ChunkEdge neighborEdge; // Edge of theirs facing us
+        };
+        const NeighborEdge neighbors[4] = {
+            {{-1, 0}, ChunkEdge::NegativeX, ChunkEdge::PositiveX},
+            {{1, 0}, ChunkEdge::PositiveX, ChunkEdge::NegativeX},
+            {{0, -1}, ChunkEdge::NegativeZ, ChunkEdge::PositiveZ},
+            {{0, 1}, ChunkEdge::PositiveZ, ChunkEdge::NegativeZ},
+        };
+
+        auto edgeOutflow = [](const ChunkDrainageBoundary &boundary, ChunkEdge edge)
+            -> const std::vector<uint32_t> &
+        {
+            switch (edge)
+            {
+            case ChunkEdge::NegativeX:
+                return boundary.negX;
+            case ChunkEdge::PositiveX:
+                return boundary.posX;
+            case ChunkEdge::NegativeZ:
+                return boundary.negZ;
+            default:
+                return boundary.posZ;
+            }
+        };
+
+        while (!worklist.empty() && iterations++ < maxIterations)
         {
-            int cx = coord.x;
-            int cz = coord.y;
+            glm::ivec2 coord = worklist.back();
+            worklist.pop_back();
+
+            Chunk *chunk = GetChunkByCoord(coord.x, coord.y);
+            if (!chunk || !chunk->HasDrainageData())
+                continue;
+
+            bool selfChanged = false;
+
+            for (const NeighborEdge &n : neighbors)
+            {
+                Chunk *neighbor = GetChunkByCoord(coord.x + n.offset.x, coord.y + n.offset.y);
+                if (!neighbor || !neighbor->HasDrainageData())
+                    continue;
+
+                DrainageGraph &ours = chunk->GetDrainageGraph();
+                DrainageGraph &theirs = neighbor->GetDrainageGraph();
+
+                // Edge cells only line up between equal-resolution grids;
+                // a coarse-tier chunk next to a full one is left unstitched
+                if (ours.GetData().width != theirs.GetData().width ||
+                    ours.GetData().depth != theirs.GetData().depth)
+                    continue;
+
+                // Push our outflow into the neighbor and theirs into us
+                if (theirs.AddBoundaryInflow(n.neighborEdge,
+                                             edgeOutflow(ours.GetBoundaryOutflow(), n.ourEdge)))
+                {
+                    neighbor->RefreshStitchedAccumulation();
+                    worklist.emplace_back(coord.x + n.offset.x, coord.y + n.offset.y);
+                }
+
+                if (ours.AddBoundaryInflow(n.ourEdge,
+                                           edgeOutflow(theirs.GetBoundaryOutflow(), n.neighborEdge)))
+                {
+                    selfChanged = true;
+                }
+            }
 
-            auto isAtBoundary = [this, cx, cz](ChunkEdge edge)
+            if (selfChanged)
             {
-                return IsChunkAtWorldBoundary(cx, cz, edge);
-            };
+                chunk->RefreshStitchedAccumulation();
+                worklist.push_back(coord);
+            }
+        }
+    }
+
+    void ChunkManager::QueueOceanFloodFill()
+    {
+        GEN_DEBUG("QueueOceanFloodFill: queueing ocean connectivity for {} chunks",
+                  m_LoadedChunks.size());
+
+        for (auto &[coord, chunk] : m_LoadedChunks)
+        {
+            m_OceanUnseeded.insert(coord);
+            QueueOceanConnectivityUpdate(coord);
+        }
+    }
 
-            chunk->GetOceanMask().FloodFillFromBoundary(isAtBoundary, nullptr);
+    void ChunkManager::QueueOceanConnectivityUpdate(const glm::ivec2 &coord)
+    {
+        if (m_OceanQueuedChunks.insert(coord).second)
+        {
+            m_OceanUpdateQueue.push_back(coord);
         }
+    }
 
-        // Step 2: Propagate ocean connectivity between neighboring chunks
-        // Repeat until no changes occur (convergence)
-        bool changed = true;
-        int iterations = 0;
-        const int maxIterations = 10; // Safety limit
+    void ChunkManager::ProcessOceanConnectivityQueue()
+    {
+        if (m_OceanUpdateQueue.empty())
+            return;
+
+        GEN_PROFILE_SCOPE("ChunkManager::ProcessOceanConnectivityQueue");
 
-        while (changed && iterations < maxIterations)
+        // Each step is one chunk: its local flood fill from the world
+        // boundary (first visit only) plus one round of neighbor absorption.
+        // A changed mask re-queues the four neighbors, so the propagation
+        // reaches the same fixed point the old synchronous convergence loop
+        // did, just spread across frames instead of spiking one
+        const int budget = 4;
+
+        for (int processed = 0; processed < budget && !m_OceanUpdateQueue.empty(); processed++)
         {
-            changed = false;
-            iterations++;
+            glm::ivec2 coord = m_OceanUpdateQueue.front();
+            m_OceanUpdateQueue.pop_front();
+            m_OceanQueuedChunks.erase(coord);
+
+            auto it = m_LoadedChunks.find(coord);
+            if (it == m_LoadedChunks.end())
+            {
+                // Unloaded while queued
+                m_OceanUnseeded.erase(coord);
+                continue;
+            }
 
-            for (auto &[coord, chunk] : m_LoadedChunks)
+            OceanMask &mask = it->second->GetOceanMask();
+            bool changed = false;
+
+            if (m_OceanUnseeded.erase(coord) > 0)
             {
-                OceanMask &mask = chunk->GetOceanMask();
-                const ChunkOceanBoundary &boundary = mask.GetBoundary();
+                int cx = coord.x;
+                int cz = coord.y;
 
-                // Check each neighbor and propagate
-                // -X neighbor
-                if (auto *neighbor = GetChunkByCoord(coord.x - 1, coord.y))
+                auto isAtBoundary = [this, cx, cz](ChunkEdge edge)
                 {
-                    const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
-                    for (int z = 0; z < mask.GetDepth(); z++)
-                    {
-                        if (z < static_cast<int>(neighborBoundary.posX.size()) &&
-                            neighborBoundary.posX[z] && !mask.IsOcean(0, z) && mask.IsBelowSeaLevel(0, z))
-                        {
-                            mask.PropagateFromNeighbor(ChunkEdge::NegativeX, neighborBoundary.posX);
-                            changed = true;
-                            break;
-                        }
-                    }
-                }
+                    return IsChunkAtWorldBoundary(cx, cz, edge);
+                };
+
+                mask.FloodFillFromBoundary(isAtBoundary, nullptr);
+                changed = true;
+            }
+
+            if (AbsorbNeighborOceanConnectivity(coord, mask))
+            {
+                changed = true;
+            }
+
+            if (changed)
+            {
+                // Our boundary may have grown; let the neighbors absorb it
+                QueueOceanConnectivityUpdate(glm::ivec2(coord.x - 1, coord.y));
+                QueueOceanConnectivityUpdate(glm::ivec2(coord.x + 1, coord.y));
+                QueueOceanConnectivityUpdate(glm::ivec2(coord.x, coord.y - 1));
+                QueueOceanConnectivityUpdate(glm::ivec2(coord.x, coord.y + 1));
+            }
+        }
+
+        if (m_OceanUpdateQueue.empty())
+        {
+            GEN_DEBUG("Ocean connectivity propagation settled");
+
+            // No water meshes to rebuild once the propagation settles: the
+            // global ocean surface just sits at sea level, and lake/river
+            // meshes are independent of the mask. The refreshed masks still
+            // feed ocean/inland-lake queries and object placement.
+        }
+    }
 
-                // +X neighbor
-                if (auto *neighbor = GetChunkByCoord(coord.x + 1, coord.y))
+    bool ChunkManager::AbsorbNeighborOceanConnectivity(const glm::ivec2 &coord, OceanMask &mask)
+    {
+        bool changed = false;
+
+        // -X neighbor
+        if (auto *neighbor = GetChunkByCoord(coord.x - 1, coord.y))
+        {
+            const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
+            for (int z = 0; z < mask.GetDepth(); z++)
+            {
+                if (z < static_cast<int>(neighborBoundary.posX.size()) &&
+                    neighborBoundary.posX[z] && !mask.IsOcean(0, z) && mask.IsBelowSeaLevel(0, z))
                 {
-                    const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
-                    for (int z = 0; z < mask.GetDepth(); z++)
-                    {
-                        if (z < static_cast<int>(neighborBoundary.negX.size()) &&
-                            neighborBoundary.negX[z] && !mask.IsOcean(mask.GetWidth() - 1, z) &&
-                            mask.IsBelowSeaLevel(mask.GetWidth() - 1, z))
-                        {
-                            mask.PropagateFromNeighbor(ChunkEdge::PositiveX, neighborBoundary.negX);
-                            changed = true;
-                            break;
-                        }
-                    }
+                    mask.PropagateFromNeighbor(ChunkEdge::NegativeX, neighborBoundary.posX);
+                    changed = true;
+                    break;
                 }
+            }
+        }
 
-                // -Z neighbor
-                if (auto *neighbor = GetChunkByCoord(coord.x, coord.y - 1))
+        // +X neighbor
+        if (auto *neighbor = GetChunkByCoord(coord.x + 1, coord.y))
+        {
+            const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
+            for (int z = 0; z < mask.GetDepth(); z++)
+            {
+                if (z < static_cast<int>(neighborBoundary.negX.size()) &&
+                    neighborBoundary.negX[z] && !mask.IsOcean(mask.GetWidth() - 1, z) &&
+                    mask.IsBelowSeaLevel(mask.GetWidth() - 1, z))
                 {
-                    const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
-                    for (int x = 0; x < mask.GetWidth(); x++)
-                    {
-                        if (x < static_cast<int>(neighborBoundary.posZ.size()) &&
-                            neighborBoundary.posZ[x] && !mask.IsOcean(x, 0) && mask.IsBelowSeaLevel(x, 0))
-                        {
-                            mask.PropagateFromNeighbor(ChunkEdge::NegativeZ, neighborBoundary.posZ);
-                            changed = true;
-                            break;
-                        }
-                    }
+                    mask.PropagateFromNeighbor(ChunkEdge::PositiveX, neighborBoundary.negX);
+                    changed = true;
+                    break;
                 }
+            }
+        }
 
-                // +Z neighbor
-                if (auto *neighbor = GetChunkByCoord(coord.x, coord.y + 1))
+        // -Z neighbor
+        if (auto *neighbor = GetChunkByCoord(coord.x, coord.y - 1))
+        {
+            const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
+            for (int x = 0; x < mask.GetWidth(); x++)
+            {
+                if (x < static_cast<int>(neighborBoundary.posZ.size()) &&
+                    neighborBoundary.posZ[x] && !mask.IsOcean(x, 0) && mask.IsBelowSeaLevel(x, 0))
                 {
-                    const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
-                    for (int x = 0; x < mask.GetWidth(); x++)
-                    {
-                        if (x < static_cast<int>(neighborBoundary.negZ.size()) &&
-                            neighborBoundary.negZ[x] && !mask.IsOcean(x, mask.GetDepth() - 1) &&
-                            mask.IsBelowSeaLevel(x, mask.GetDepth() - 1))
-                        {
-                            mask.PropagateFromNeighbor(ChunkEdge::PositiveZ, neighborBoundary.negZ);
-                            changed = true;
-                            break;
-                        }
-                    }
+                    mask.PropagateFromNeighbor(ChunkEdge::NegativeZ, neighborBoundary.posZ);
+                    changed = true;
+                    break;
                 }
             }
         }
 
-        GEN_DEBUG("PerformOceanFloodFill: converged after {} iterations", iterations);
-
-        // Step 3: Regenerate water meshes using ocean mask
-        for (auto &[coord, chunk] : m_LoadedChunks)
+        // +Z neighbor
+        if (auto *neighbor = GetChunkByCoord(coord.x, coord.y + 1))
         {
-            chunk->RegenerateWater(m_Settings.seaLevel, m_Settings.useOceanMask);
-
-            // Re-upload water mesh if chunk is loaded
-            if (chunk->GetState() == ChunkState::Loaded && chunk->HasWater() && chunk->GetWaterMesh())
+            const auto &neighborBoundary = neighbor->GetOceanMask().GetBoundary();
+            for (int x = 0; x < mask.GetWidth(); x++)
             {
-                // The mesh needs to be uploaded to GPU
-                auto cpuWater = std::make_unique<Mesh>(
-                    chunk->GetWaterMesh()->GetVertices(),
-                    chunk->GetWaterMesh()->GetIndices());
-                chunk->m_WaterMesh->Shutdown();
-                chunk->m_WaterMesh = std::make_unique<Mesh>(*m_Device, cpuWater->GetVertices(), cpuWater->GetIndices());
+                if (x < static_cast<int>(neighborBoundary.negZ.size()) &&
+                    neighborBoundary.negZ[x] && !mask.IsOcean(x, mask.GetDepth() - 1) &&
+                    mask.IsBelowSeaLevel(x, mask.GetDepth() - 1))
+                {
+                    mask.PropagateFromNeighbor(ChunkEdge::PositiveZ, neighborBoundary.negZ);
+                    changed = true;
+                    break;
+                }
             }
         }
+
+        return changed;
     }
 
 }
@@ -0,0 +1,221 @@
+#include "genesis/world/DeterminismValidator.h"
+#include "genesis/world/Chunk.h"
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/Log.h"
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+namespace Genesis
+{
+
+    namespace
+    {
+        constexpr uint64_t FNV_OFFSET = 1469598103934665603ull;
+        constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+        uint64_t HashBytes(const void *data, size_t size, uint64_t hash = FNV_OFFSET)
+        {
+            const uint8_t *bytes = static_cast<const uint8_t *>(data);
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash = (hash ^ bytes[i]) * FNV_PRIME;
+            }
+            return hash;
+        }
+
+        template <typename T>
+        uint64_t HashVector(const std::vector<T> &values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return HashBytes(values.data(), values.size() * sizeof(T));
+        }
+
+        // Compact fields decode to float on read; hash the decoded bit
+        // patterns so the comparison sees exactly what consumers see
+        template <typename Field>
+        uint64_t HashField(const Field &field)
+        {
+            uint64_t hash = FNV_OFFSET;
+            for (size_t i = 0; i < field.size(); ++i)
+            {
+                float value = field[i];
+                hash = HashBytes(&value, sizeof(value), hash);
+            }
+            return hash;
+        }
+
+        // Per-chunk field hashes covering every generation output: terrain
+        // geometry (positions embed the heightmap), hydrology, climate, biomes
+        struct ChunkHashes
+        {
+            uint64_t vertices = 0;
+            uint64_t indices = 0;
+            uint64_t waterType = 0;
+            uint64_t waterSurfaceHeight = 0;
+            uint64_t flowAccumulation = 0;
+            uint64_t drainageDirection = 0;
+            uint64_t distanceToWater = 0;
+            uint64_t slope = 0;
+            uint64_t moisture = 0;
+            uint64_t temperature = 0;
+            uint64_t fertility = 0;
+            uint64_t cellBiomes = 0;
+            uint64_t dominantBiome = 0;
+        };
+
+        ChunkHashes HashChunk(const Chunk &chunk)
+        {
+            ChunkHashes hashes;
+            if (const Mesh *mesh = chunk.GetMesh())
+            {
+                hashes.vertices = HashVector(mesh->GetVertices());
+                hashes.indices = HashVector(mesh->GetIndices());
+            }
+
+            const HydrologyData &hydrology = chunk.GetHydrologyData();
+            hashes.waterType = HashVector(hydrology.waterType);
+            hashes.waterSurfaceHeight = HashVector(hydrology.waterSurfaceHeight);
+            hashes.flowAccumulation = HashVector(hydrology.flowAccumulation);
+            hashes.drainageDirection = HashVector(hydrology.drainageDirection);
+            hashes.distanceToWater = HashField(hydrology.distanceToWater);
+            hashes.slope = HashField(hydrology.slope);
+            hashes.moisture = HashField(hydrology.moisture);
+
+            const ClimateData &climate = chunk.GetClimateData();
+            hashes.temperature = HashField(climate.temperature);
+            hashes.fertility = HashField(climate.fertility);
+
+            const BiomeData &biomes = chunk.GetBiomeData();
+            hashes.cellBiomes = HashVector(biomes.cellBiomes);
+            hashes.dominantBiome = HashVector(biomes.dominantBiome);
+            return hashes;
+        }
+
+        std::string HexString(uint64_t value)
+        {
+            char buffer[19];
+            std::snprintf(buffer, sizeof(buffer), "%016llx",
+                          static_cast<unsigned long long>(value));
+            return buffer;
+        }
+
+        void CompareField(DeterminismValidator::Report &report, glm::ivec2 coord,
+                          const char *field, uint64_t serial, uint64_t parallel)
+        {
+            if (serial != parallel)
+            {
+                report.mismatches.push_back({coord, field, serial, parallel});
+            }
+        }
+
+        void CompareChunk(DeterminismValidator::Report &report, glm::ivec2 coord,
+                          const ChunkHashes &serial, const ChunkHashes &parallel)
+        {
+            CompareField(report, coord, "vertices", serial.vertices, parallel.vertices);
+            CompareField(report, coord, "indices", serial.indices, parallel.indices);
+            CompareField(report, coord, "waterType", serial.waterType, parallel.waterType);
+            CompareField(report, coord, "waterSurfaceHeight", serial.waterSurfaceHeight, parallel.waterSurfaceHeight);
+            CompareField(report, coord, "flowAccumulation", serial.flowAccumulation, parallel.flowAccumulation);
+            CompareField(report, coord, "drainageDirection", serial.drainageDirection, parallel.drainageDirection);
+            CompareField(report, coord, "distanceToWater", serial.distanceToWater, parallel.distanceToWater);
+            CompareField(report, coord, "slope", serial.slope, parallel.slope);
+            CompareField(report, coord, "moisture", serial.moisture, parallel.moisture);
+            CompareField(report, coord, "temperature", serial.temperature, parallel.temperature);
+            CompareField(report, coord, "fertility", serial.fertility, parallel.fertility);
+            CompareField(report, coord, "cellBiomes", serial.cellBiomes, parallel.cellBiomes);
+            CompareField(report, coord, "dominantBiome", serial.dominantBiome, parallel.dominantBiome);
+        }
+    }
+
+    DeterminismValidator::Report DeterminismValidator::Run(const WorldSettings &settings, int radius)
+    {
+        std::vector<glm::ivec2> coords;
+        for (int z = -radius; z <= radius; ++z)
+        {
+            for (int x = -radius; x <= radius; ++x)
+            {
+                coords.push_back({x, z});
+            }
+        }
+
+        // Both runs generate without neighbor borders: border reuse depends
+        // on completion order by design, which is exactly the kind of
+        // difference this check must not report
+        const size_t count = coords.size();
+        std::vector<ChunkHashes> serialHashes(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Chunk chunk(coords[i].x, coords[i].y, settings.chunkSize, settings.cellSize);
+            chunk.Generate(settings.terrainSettings, settings.seed, settings.seaLevel,
+                           HydrologyLod::Full, nullptr);
+            serialHashes[i] = HashChunk(chunk);
+        }
+
+        std::vector<ChunkHashes> parallelHashes(count);
+        JobCounter counter;
+        for (size_t i = 0; i < count; ++i)
+        {
+            JobSystem::Get().Execute([&, i]()
+                                     {
+                Chunk chunk(coords[i].x, coords[i].y, settings.chunkSize, settings.cellSize);
+                chunk.Generate(settings.terrainSettings, settings.seed, settings.seaLevel,
+                               HydrologyLod::Full, nullptr);
+                parallelHashes[i] = HashChunk(chunk); },
+                                     &counter);
+        }
+        JobSystem::Get().Wait(counter);
+
+        Report report;
+        report.chunksCompared = static_cast<int>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            CompareChunk(report, coords[i], serialHashes[i], parallelHashes[i]);
+        }
+        return report;
+    }
+
+    int DeterminismValidator::RunStandalone(int radius)
+    {
+        Log::Init();
+
+        bool ownsJobSystem = !JobSystem::IsInitialized();
+        if (ownsJobSystem)
+        {
+            JobSystem::Init();
+        }
+
+        WorldSettings settings;
+        settings.ComputeSeaLevel();
+
+        int side = radius * 2 + 1;
+        GEN_INFO("Determinism validation: generating {}x{} chunks serially and in parallel (seed {})",
+                 side, side, settings.seed);
+
+        Report report = Run(settings, radius);
+
+        if (report.Passed())
+        {
+            GEN_INFO("Determinism validation passed: {} chunks, all field hashes identical",
+                     report.chunksCompared);
+        }
+        else
+        {
+            GEN_ERROR("Determinism validation FAILED: {} mismatched fields across {} chunks",
+                      report.mismatches.size(), report.chunksCompared);
+            for (const Mismatch &m : report.mismatches)
+            {
+                GEN_ERROR("  chunk ({}, {}) field '{}': serial {} vs parallel {}",
+                          m.coord.x, m.coord.y, m.field, HexString(m.serialHash), HexString(m.parallelHash));
+            }
+        }
+
+        if (ownsJobSystem)
+        {
+            JobSystem::Shutdown();
+        }
+
+        return report.Passed() ? 0 : 1;
+    }
+
+}
@@ -0,0 +1,201 @@
+#include "genesis/world/HeadlessBenchmark.h"
+#include "genesis/world/Chunk.h"
+#include "genesis/world/ChunkCache.h"
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/Log.h"
+#include "genesis/core/Profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+
+namespace Genesis
+{
+
+    namespace
+    {
+        constexpr uint64_t FNV_OFFSET = 1469598103934665603ull;
+        constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+        uint64_t HashBytes(const void *data, size_t size)
+        {
+            const uint8_t *bytes = static_cast<const uint8_t *>(data);
+            uint64_t hash = FNV_OFFSET;
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash = (hash ^ bytes[i]) * FNV_PRIME;
+            }
+            return hash;
+        }
+
+        // Vertex positions embed the heightmap, colors embed the biome and
+        // material output - one hash covers the observable result
+        uint64_t HashChunkContent(const Chunk &chunk)
+        {
+            const Mesh *mesh = chunk.GetMesh();
+            if (!mesh)
+                return 0;
+            const auto &vertices = mesh->GetVertices();
+            return HashBytes(vertices.data(), vertices.size() * sizeof(vertices[0]));
+        }
+
+        std::string FormatMs(double value)
+        {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.2f", value);
+            return buffer;
+        }
+
+        double Percentile(std::vector<double> &sorted, double fraction)
+        {
+            if (sorted.empty())
+                return 0.0;
+            size_t index = static_cast<size_t>(fraction * (sorted.size() - 1));
+            return sorted[index];
+        }
+
+        std::string HexString(uint64_t value)
+        {
+            char buffer[19];
+            std::snprintf(buffer, sizeof(buffer), "%016llx",
+                          static_cast<unsigned long long>(value));
+            return buffer;
+        }
+    }
+
+    HeadlessBenchmark::Report HeadlessBenchmark::Run(const WorldSettings &settings,
+                                                     int gridSize, bool bakeToCache)
+    {
+        std::vector<glm::ivec2> coords;
+        coords.reserve(static_cast<size_t>(gridSize) * gridSize);
+        int half = gridSize / 2;
+        for (int z = 0; z < gridSize; ++z)
+        {
+            for (int x = 0; x < gridSize; ++x)
+            {
+                coords.push_back({x - half, z - half});
+            }
+        }
+
+        ChunkCache cache;
+        std::mutex resultMutex;
+        std::vector<double> chunkMs;
+        chunkMs.reserve(coords.size());
+        uint64_t worldHash = 0;
+
+        uint64_t runStartUs = Profiler::NowMicroseconds();
+
+        JobCounter counter;
+        for (const glm::ivec2 &coord : coords)
+        {
+            JobSystem::Get().Execute([&, coord]()
+                                     {
+                uint64_t startUs = Profiler::NowMicroseconds();
+
+                Chunk chunk(coord.x, coord.y, settings.chunkSize, settings.cellSize);
+                chunk.Generate(settings.terrainSettings, settings.seed, settings.seaLevel,
+                               HydrologyLod::Full, nullptr);
+                if (bakeToCache)
+                {
+                    cache.Save(chunk, settings.terrainSettings, settings.seed, settings.seaLevel);
+                }
+
+                double elapsedMs = (Profiler::NowMicroseconds() - startUs) / 1000.0;
+                uint64_t hash = HashChunkContent(chunk);
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+                chunkMs.push_back(elapsedMs);
+                // XOR keeps the combined hash independent of completion order
+                worldHash ^= hash; },
+                                     &counter);
+        }
+        JobSystem::Get().Wait(counter);
+
+        Report report;
+        report.chunksGenerated = static_cast<int>(coords.size());
+        report.totalSeconds = (Profiler::NowMicroseconds() - runStartUs) / 1e6;
+        report.chunksPerSecond = report.totalSeconds > 0.0
+                                     ? report.chunksGenerated / report.totalSeconds
+                                     : 0.0;
+        report.worldHash = worldHash;
+
+        std::sort(chunkMs.begin(), chunkMs.end());
+        double chunkTotal = 0.0;
+        for (double ms : chunkMs)
+            chunkTotal += ms;
+        report.chunkMeanMs = chunkMs.empty() ? 0.0 : chunkTotal / chunkMs.size();
+        report.chunkP99Ms = Percentile(chunkMs, 0.99);
+
+        // Per-stage breakdown from the profiler rings: every generation
+        // stage is already wrapped in GEN_PROFILE_SCOPE, so the benchmark
+        // gets stage timing for free
+        std::vector<Profiler::Event> events;
+        Profiler::Collect(events, runStartUs);
+
+        std::map<std::string, std::vector<double>> stageDurations;
+        for (const Profiler::Event &event : events)
+        {
+            stageDurations[event.Name].push_back((event.EndUs - event.StartUs) / 1000.0);
+        }
+
+        for (auto &[name, durations] : stageDurations)
+        {
+            std::sort(durations.begin(), durations.end());
+            StageStats stats;
+            stats.name = name;
+            stats.count = static_cast<int>(durations.size());
+            for (double ms : durations)
+                stats.totalMs += ms;
+            stats.meanMs = stats.totalMs / durations.size();
+            stats.p99Ms = Percentile(durations, 0.99);
+            report.stages.push_back(std::move(stats));
+        }
+        std::sort(report.stages.begin(), report.stages.end(),
+                  [](const StageStats &a, const StageStats &b)
+                  { return a.totalMs > b.totalMs; });
+
+        return report;
+    }
+
+    int HeadlessBenchmark::RunStandalone(int gridSize)
+    {
+        Log::Init();
+
+        bool ownsJobSystem = !JobSystem::IsInitialized();
+        if (ownsJobSystem)
+        {
+            JobSystem::Init();
+        }
+
+        WorldSettings settings;
+        settings.ComputeSeaLevel();
+
+        GEN_INFO("Headless benchmark: generating {}x{} chunks with full hydrology (seed {})",
+                 gridSize, gridSize, settings.seed);
+
+        Report report = Run(settings, gridSize, true);
+
+        GEN_INFO("Generated {} chunks in {} s ({} chunks/s)",
+                 report.chunksGenerated, FormatMs(report.totalSeconds),
+                 FormatMs(report.chunksPerSecond));
+        GEN_INFO("Per-chunk wall time: mean {} ms, p99 {} ms",
+                 FormatMs(report.chunkMeanMs), FormatMs(report.chunkP99Ms));
+        GEN_INFO("World hash: {}", HexString(report.worldHash));
+        GEN_INFO("Stage breakdown (slowest first):");
+        for (const StageStats &stage : report.stages)
+        {
+            GEN_INFO("  {}: count {}, mean {} ms, p99 {} ms, total {} ms",
+                     stage.name, stage.count, FormatMs(stage.meanMs),
+                     FormatMs(stage.p99Ms), FormatMs(stage.totalMs));
+        }
+
+        if (ownsJobSystem)
+        {
+            JobSystem::Shutdown();
+        }
+
+        return report.chunksGenerated > 0 ? 0 : 1;
+    }
+
+}
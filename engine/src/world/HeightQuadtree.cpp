@@ -0,0 +1,292 @@
+#include "genesis/world/HeightQuadtree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Genesis
+{
+
+    void HeightQuadtree::Build(const std::vector<float> &heightmap, int width, int depth, float cellSize)
+    {
+        Clear();
+
+        if (width < 2 || depth < 2 ||
+            heightmap.size() < static_cast<size_t>(width) * depth)
+        {
+            return;
+        }
+
+        m_SampleWidth = width;
+        m_SampleDepth = depth;
+        m_CellSize = cellSize;
+
+        // Base level: one min/max pair per cell, over its four corners
+        Level base;
+        base.width = width - 1;
+        base.depth = depth - 1;
+        base.minH.resize(static_cast<size_t>(base.width) * base.depth);
+        base.maxH.resize(static_cast<size_t>(base.width) * base.depth);
+
+        for (int z = 0; z < base.depth; z++)
+        {
+            for (int x = 0; x < base.width; x++)
+            {
+                float h00 = heightmap[static_cast<size_t>(z) * width + x];
+                float h10 = heightmap[static_cast<size_t>(z) * width + x + 1];
+                float h01 = heightmap[static_cast<size_t>(z + 1) * width + x];
+                float h11 = heightmap[static_cast<size_t>(z + 1) * width + x + 1];
+
+                size_t idx = static_cast<size_t>(z) * base.width + x;
+                base.minH[idx] = std::min(std::min(h00, h10), std::min(h01, h11));
+                base.maxH[idx] = std::max(std::max(h00, h10), std::max(h01, h11));
+            }
+        }
+
+        m_Levels.push_back(std::move(base));
+
+        // Reduce 2x2 blocks until a single root node remains
+        while (m_Levels.back().width > 1 || m_Levels.back().depth > 1)
+        {
+            const Level &fine = m_Levels.back();
+
+            Level coarse;
+            coarse.width = (fine.width + 1) / 2;
+            coarse.depth = (fine.depth + 1) / 2;
+            coarse.minH.resize(static_cast<size_t>(coarse.width) * coarse.depth);
+            coarse.maxH.resize(static_cast<size_t>(coarse.width) * coarse.depth);
+
+            for (int z = 0; z < coarse.depth; z++)
+            {
+                for (int x = 0; x < coarse.width; x++)
+                {
+                    float lo = std::numeric_limits<float>::max();
+                    float hi = std::numeric_limits<float>::lowest();
+
+                    for (int dz = 0; dz < 2; dz++)
+                    {
+                        for (int dx = 0; dx < 2; dx++)
+                        {
+                            int fx = x * 2 + dx;
+                            int fz = z * 2 + dz;
+                            if (fx >= fine.width || fz >= fine.depth)
+                                continue;
+
+                            size_t fIdx = static_cast<size_t>(fz) * fine.width + fx;
+                            lo = std::min(lo, fine.minH[fIdx]);
+                            hi = std::max(hi, fine.maxH[fIdx]);
+                        }
+                    }
+
+                    size_t cIdx = static_cast<size_t>(z) * coarse.width + x;
+                    coarse.minH[cIdx] = lo;
+                    coarse.maxH[cIdx] = hi;
+                }
+            }
+
+            m_Levels.push_back(std::move(coarse));
+        }
+    }
+
+    void HeightQuadtree::Clear()
+    {
+        m_Levels.clear();
+        m_SampleWidth = 0;
+        m_SampleDepth = 0;
+    }
+
+    size_t HeightQuadtree::GetMemoryUsage() const
+    {
+        size_t bytes = 0;
+        for (const Level &level : m_Levels)
+        {
+            bytes += (level.minH.capacity() + level.maxH.capacity()) * sizeof(float);
+        }
+        return bytes;
+    }
+
+    bool HeightQuadtree::Raycast(const glm::vec3 &origin, const glm::vec3 &direction,
+                                 float tMin, float tMax,
+                                 const std::vector<float> &heightmap, float &outT) const
+    {
+        if (m_Levels.empty() || tMax <= tMin ||
+            heightmap.size() < static_cast<size_t>(m_SampleWidth) * m_SampleDepth)
+        {
+            return false;
+        }
+
+        // Slab tests divide by the direction; zero components become huge
+        // finite values so the intervals degenerate correctly
+        constexpr float HUGE_INV = 1e30f;
+        glm::vec3 invDir(std::abs(direction.x) > 1e-12f ? 1.0f / direction.x : HUGE_INV,
+                         std::abs(direction.y) > 1e-12f ? 1.0f / direction.y : HUGE_INV,
+                         std::abs(direction.z) > 1e-12f ? 1.0f / direction.z : HUGE_INV);
+
+        int root = static_cast<int>(m_Levels.size()) - 1;
+        return RaycastNode(root, 0, 0, origin, direction, invDir, tMin, tMax, heightmap, outT);
+    }
+
+    bool HeightQuadtree::RaycastNode(int level, int x, int z,
+                                     const glm::vec3 &origin, const glm::vec3 &direction,
+                                     const glm::vec3 &invDir, float tMin, float tMax,
+                                     const std::vector<float> &heightmap, float &outT) const
+    {
+        const Level &nodes = m_Levels[level];
+        size_t idx = static_cast<size_t>(z) * nodes.width + x;
+
+        // Node footprint in local space; nodes at the +X/+Z fringe of a
+        // non-power-of-two grid get clamped to the real extent
+        int span = 1 << level;
+        float x0 = x * span * m_CellSize;
+        float z0 = z * span * m_CellSize;
+        float x1 = std::min((x + 1) * span, m_SampleWidth - 1) * m_CellSize;
+        float z1 = std::min((z + 1) * span, m_SampleDepth - 1) * m_CellSize;
+
+        // Slab test against the node's bounding box
+        float txEnter = (x0 - origin.x) * invDir.x;
+        float txExit = (x1 - origin.x) * invDir.x;
+        if (txEnter > txExit)
+            std::swap(txEnter, txExit);
+
+        float tzEnter = (z0 - origin.z) * invDir.z;
+        float tzExit = (z1 - origin.z) * invDir.z;
+        if (tzEnter > tzExit)
+            std::swap(tzEnter, tzExit);
+
+        float tyEnter = (nodes.minH[idx] - origin.y) * invDir.y;
+        float tyExit = (nodes.maxH[idx] - origin.y) * invDir.y;
+        if (tyEnter > tyExit)
+            std::swap(tyEnter, tyExit);
+
+        float enter = std::max(std::max(txEnter, tzEnter), std::max(tyEnter, tMin));
+        float exit = std::min(std::min(txExit, tzExit), std::min(tyExit, tMax));
+        if (enter > exit)
+        {
+            return false;
+        }
+
+        if (level == 0)
+        {
+            return RaycastCell(x, z, origin, direction, tMin, tMax, heightmap, outT);
+        }
+
+        // Gather the live children with their box entry distances and
+        // recurse nearest first, so the first hit is the nearest hit
+        const Level &children = m_Levels[level - 1];
+        int childSpan = span >> 1;
+
+        struct Candidate
+        {
+            float enter;
+            int x;
+            int z;
+        };
+        Candidate candidates[4];
+        int count = 0;
+
+        for (int dz = 0; dz < 2; dz++)
+        {
+            for (int dx = 0; dx < 2; dx++)
+            {
+                int cx = x * 2 + dx;
+                int cz = z * 2 + dz;
+                if (cx >= children.width || cz >= children.depth)
+                    continue;
+
+                float cx0 = cx * childSpan * m_CellSize;
+                float cz0 = cz * childSpan * m_CellSize;
+                float cx1 = std::min((cx + 1) * childSpan, m_SampleWidth - 1) * m_CellSize;
+                float cz1 = std::min((cz + 1) * childSpan, m_SampleDepth - 1) * m_CellSize;
+
+                float ex = std::min((cx0 - origin.x) * invDir.x, (cx1 - origin.x) * invDir.x);
+                float ez = std::min((cz0 - origin.z) * invDir.z, (cz1 - origin.z) * invDir.z);
+
+                candidates[count++] = {std::max(ex, ez), cx, cz};
+            }
+        }
+
+        // Insertion sort; at most four entries
+        for (int i = 1; i < count; i++)
+        {
+            Candidate key = candidates[i];
+            int j = i - 1;
+            while (j >= 0 && candidates[j].enter > key.enter)
+            {
+                candidates[j + 1] = candidates[j];
+                j--;
+            }
+            candidates[j + 1] = key;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            if (RaycastNode(level - 1, candidates[i].x, candidates[i].z,
+                            origin, direction, invDir, tMin, tMax, heightmap, outT))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool HeightQuadtree::RaycastCell(int cellX, int cellZ,
+                                     const glm::vec3 &origin, const glm::vec3 &direction,
+                                     float tMin, float tMax,
+                                     const std::vector<float> &heightmap, float &outT) const
+    {
+        float x0 = cellX * m_CellSize;
+        float z0 = cellZ * m_CellSize;
+        float x1 = x0 + m_CellSize;
+        float z1 = z0 + m_CellSize;
+
+        size_t base = static_cast<size_t>(cellZ) * m_SampleWidth + cellX;
+        glm::vec3 p00(x0, heightmap[base], z0);
+        glm::vec3 p10(x1, heightmap[base + 1], z0);
+        glm::vec3 p01(x0, heightmap[base + m_SampleWidth], z1);
+        glm::vec3 p11(x1, heightmap[base + m_SampleWidth + 1], z1);
+
+        // Moller-Trumbore without backface culling; collision and picking
+        // rays may approach the surface from below (caves of the skirt
+        // geometry, underwater queries)
+        auto rayTriangle = [&](const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c,
+                               float &t) -> bool
+        {
+            glm::vec3 edge1 = b - a;
+            glm::vec3 edge2 = c - a;
+            glm::vec3 p = glm::cross(direction, edge2);
+            float det = glm::dot(edge1, p);
+            if (std::abs(det) < 1e-12f)
+                return false;
+
+            float invDet = 1.0f / det;
+            glm::vec3 s = origin - a;
+            float u = glm::dot(s, p) * invDet;
+            if (u < 0.0f || u > 1.0f)
+                return false;
+
+            glm::vec3 q = glm::cross(s, edge1);
+            float v = glm::dot(direction, q) * invDet;
+            if (v < 0.0f || u + v > 1.0f)
+                return false;
+
+            t = glm::dot(edge2, q) * invDet;
+            return t >= tMin && t <= tMax;
+        };
+
+        // Same split the mesh builder uses: (00, 01, 10) and (10, 01, 11)
+        float tA, tB;
+        bool hitA = rayTriangle(p00, p01, p10, tA);
+        bool hitB = rayTriangle(p10, p01, p11, tB);
+
+        if (!hitA && !hitB)
+            return false;
+
+        if (hitA && hitB)
+            outT = std::min(tA, tB);
+        else
+            outT = hitA ? tA : tB;
+        return true;
+    }
+
+}
@@ -0,0 +1,188 @@
+#include "genesis/world/HeightmapCodec.h"
+
+#include <cstring>
+
+namespace Genesis
+{
+
+    namespace
+    {
+        // fp16 NaN; the encoder clamps overflow to the largest finite half,
+        // so this token can never appear as data
+        constexpr uint16_t RUN_SENTINEL = 0x7C01;
+        constexpr size_t MIN_RUN = 4;
+
+        uint16_t FloatToHalf(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            uint32_t sign = (bits >> 16) & 0x8000u;
+            int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFFu) - 127 + 15;
+            uint32_t mantissa = bits & 0x7FFFFFu;
+
+            if (exponent <= 0)
+            {
+                // Below half precision: flush to signed zero (deltas this
+                // small are far under terrain height tolerance)
+                if (exponent < -10)
+                    return static_cast<uint16_t>(sign);
+                mantissa |= 0x800000u;
+                return static_cast<uint16_t>(sign | (mantissa >> (14 - exponent)));
+            }
+            if (exponent >= 0x1F)
+            {
+                // Clamp overflow (and NaN input) to the largest finite half
+                return static_cast<uint16_t>(sign | 0x7BFFu);
+            }
+            return static_cast<uint16_t>(sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13));
+        }
+
+        float HalfToFloat(uint16_t half)
+        {
+            uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+            uint32_t exponent = (half >> 10) & 0x1Fu;
+            uint32_t mantissa = half & 0x3FFu;
+
+            uint32_t bits;
+            if (exponent == 0)
+            {
+                if (mantissa == 0)
+                {
+                    bits = sign;
+                }
+                else
+                {
+                    // Normalize the subnormal
+                    int shift = 0;
+                    while (!(mantissa & 0x400u))
+                    {
+                        mantissa <<= 1;
+                        shift++;
+                    }
+                    mantissa &= 0x3FFu;
+                    bits = sign | (static_cast<uint32_t>(113 - shift) << 23) | (mantissa << 13);
+                }
+            }
+            else
+            {
+                bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+            }
+
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+    }
+
+    namespace HeightmapCodec
+    {
+
+        CompressedHeightmap Compress(const std::vector<float> &heightmap, int width, int depth)
+        {
+            CompressedHeightmap out;
+            out.Width = width;
+            out.Depth = depth;
+
+            size_t count = static_cast<size_t>(width) * depth;
+            if (count == 0 || heightmap.size() < count)
+                return out;
+
+            // Pass 1: token per sample. Row starts are absolute halves;
+            // everything else is the delta against the running decoded
+            // value, so rounding error never accumulates past one delta.
+            std::vector<uint16_t> raw;
+            raw.reserve(count);
+            for (int z = 0; z < depth; z++)
+            {
+                float decoded = 0.0f;
+                for (int x = 0; x < width; x++)
+                {
+                    float value = heightmap[static_cast<size_t>(z) * width + x];
+                    uint16_t token;
+                    if (x == 0)
+                    {
+                        token = FloatToHalf(value);
+                        decoded = HalfToFloat(token);
+                    }
+                    else
+                    {
+                        token = FloatToHalf(value - decoded);
+                        decoded += HalfToFloat(token);
+                    }
+                    raw.push_back(token);
+                }
+            }
+
+            // Pass 2: run-length encode repeats. Flat water and plains are
+            // exact zero-delta runs, so they collapse to three tokens.
+            out.Tokens.reserve(count / 4);
+            for (size_t i = 0; i < raw.size();)
+            {
+                size_t run = 1;
+                while (i + run < raw.size() && raw[i + run] == raw[i] && run < 0xFFFF)
+                    run++;
+
+                if (run >= MIN_RUN)
+                {
+                    out.Tokens.push_back(RUN_SENTINEL);
+                    out.Tokens.push_back(static_cast<uint16_t>(run));
+                    out.Tokens.push_back(raw[i]);
+                }
+                else
+                {
+                    for (size_t j = 0; j < run; j++)
+                        out.Tokens.push_back(raw[i]);
+                }
+                i += run;
+            }
+            out.Tokens.shrink_to_fit();
+            return out;
+        }
+
+        std::vector<float> Decompress(const CompressedHeightmap &compressed)
+        {
+            size_t count = static_cast<size_t>(compressed.Width) * compressed.Depth;
+            std::vector<float> out;
+            if (count == 0)
+                return out;
+
+            // Expand the run-length layer back to one token per sample
+            std::vector<uint16_t> raw;
+            raw.reserve(count);
+            const auto &tokens = compressed.Tokens;
+            for (size_t i = 0; i < tokens.size();)
+            {
+                if (tokens[i] == RUN_SENTINEL && i + 2 < tokens.size())
+                {
+                    raw.insert(raw.end(), tokens[i + 1], tokens[i + 2]);
+                    i += 3;
+                }
+                else
+                {
+                    raw.push_back(tokens[i]);
+                    i++;
+                }
+            }
+            if (raw.size() != count)
+                return out; // Corrupt stream
+
+            out.resize(count);
+            for (int z = 0; z < compressed.Depth; z++)
+            {
+                float decoded = 0.0f;
+                for (int x = 0; x < compressed.Width; x++)
+                {
+                    size_t index = static_cast<size_t>(z) * compressed.Width + x;
+                    if (x == 0)
+                        decoded = HalfToFloat(raw[index]);
+                    else
+                        decoded += HalfToFloat(raw[index]);
+                    out[index] = decoded;
+                }
+            }
+            return out;
+        }
+
+    }
+
+}
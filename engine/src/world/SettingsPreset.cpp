@@ -0,0 +1,273 @@
+#include "genesis/world/SettingsPreset.h"
+#include "genesis/world/ChunkCache.h"
+#include "genesis/core/Log.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace Genesis
+{
+
+    namespace
+    {
+        constexpr uint32_t PRESET_MAGIC = 0x47535031; // "GSP1"
+        constexpr uint32_t PRESET_VERSION = 1;
+
+        struct PresetHeader
+        {
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            // ChunkCache::HashSettings of the contained terrain settings;
+            // lets tools key caches without parsing the body, and doubles
+            // as a corruption check on load
+            uint64_t settingsHash = 0;
+        };
+
+        template <typename T>
+        void WriteValue(std::ofstream &out, const T &value)
+        {
+            out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        void WriteBool(std::ofstream &out, bool value)
+        {
+            uint8_t byte = value ? 1 : 0;
+            WriteValue(out, byte);
+        }
+
+        template <typename T>
+        bool ReadValue(std::ifstream &in, T &value)
+        {
+            in.read(reinterpret_cast<char *>(&value), sizeof(T));
+            return in.good();
+        }
+
+        bool ReadBool(std::ifstream &in, bool &value)
+        {
+            uint8_t byte = 0;
+            if (!ReadValue(in, byte))
+                return false;
+            value = byte != 0;
+            return true;
+        }
+
+        // Version 1 body layout. Append new fields at the end and bump
+        // PRESET_VERSION; never reorder or remove.
+        void WriteBody(std::ofstream &out, const WorldSettings &settings)
+        {
+            WriteValue(out, settings.chunkSize);
+            WriteValue(out, settings.cellSize);
+            WriteValue(out, settings.viewDistance);
+            WriteValue(out, settings.hydrologyDistance);
+            WriteValue(out, settings.coarseHydrologyDistance);
+            WriteValue(out, settings.seed);
+            WriteValue(out, settings.seaLevelNormalized);
+            WriteBool(out, settings.waterEnabled);
+            WriteBool(out, settings.useOceanMask);
+            WriteBool(out, settings.stitchDrainage);
+            WriteBool(out, settings.progressiveRefinement);
+
+            const TerrainSettings &t = settings.terrainSettings;
+            WriteValue(out, t.width);
+            WriteValue(out, t.depth);
+            WriteValue(out, t.cellSize);
+            WriteValue(out, t.heightScale);
+            WriteValue(out, t.baseHeight);
+            WriteBool(out, t.useContinentalField);
+            WriteValue(out, t.continentalFrequency);
+            WriteValue(out, t.oceanThreshold);
+            WriteValue(out, t.coastlineBlend);
+            WriteValue(out, t.oceanDepth);
+            WriteValue(out, t.oceanFloorVariation);
+            WriteValue(out, t.seed);
+            WriteValue(out, t.noiseScale);
+            WriteValue(out, t.octaves);
+            WriteValue(out, t.persistence);
+            WriteValue(out, t.lacunarity);
+            WriteBool(out, t.useWarp);
+            WriteValue(out, t.warpStrength);
+            WriteValue(out, t.warpScale);
+            WriteValue(out, t.warpLevels);
+            WriteBool(out, t.useRidgeNoise);
+            WriteValue(out, t.ridgeWeight);
+            WriteValue(out, t.ridgePower);
+            WriteValue(out, t.ridgeScale);
+            WriteValue(out, t.peakBoost);
+            WriteBool(out, t.useUpliftMask);
+            WriteValue(out, t.upliftScale);
+            WriteValue(out, t.upliftThresholdLow);
+            WriteValue(out, t.upliftThresholdHigh);
+            WriteValue(out, t.upliftPower);
+            WriteBool(out, t.useErosion);
+            WriteValue(out, t.slopeErosionStrength);
+            WriteValue(out, t.slopeThreshold);
+            WriteValue(out, t.valleyDepth);
+            WriteValue(out, t.erosionDownsample);
+            WriteBool(out, t.useHydraulicErosion);
+            WriteValue(out, t.erosionIterations);
+            WriteValue(out, t.erosionInertia);
+            WriteValue(out, t.erosionCapacity);
+            WriteValue(out, t.erosionDeposition);
+            WriteValue(out, t.erosionEvaporation);
+            WriteValue(out, t.gpuErosionDroplets);
+            WriteBool(out, t.flatShading);
+            WriteBool(out, t.useBiomeColors);
+        }
+
+        bool ReadBody(std::ifstream &in, WorldSettings &settings)
+        {
+            bool ok = true;
+            ok = ok && ReadValue(in, settings.chunkSize);
+            ok = ok && ReadValue(in, settings.cellSize);
+            ok = ok && ReadValue(in, settings.viewDistance);
+            ok = ok && ReadValue(in, settings.hydrologyDistance);
+            ok = ok && ReadValue(in, settings.coarseHydrologyDistance);
+            ok = ok && ReadValue(in, settings.seed);
+            ok = ok && ReadValue(in, settings.seaLevelNormalized);
+            ok = ok && ReadBool(in, settings.waterEnabled);
+            ok = ok && ReadBool(in, settings.useOceanMask);
+            ok = ok && ReadBool(in, settings.stitchDrainage);
+            ok = ok && ReadBool(in, settings.progressiveRefinement);
+
+            TerrainSettings &t = settings.terrainSettings;
+            ok = ok && ReadValue(in, t.width);
+            ok = ok && ReadValue(in, t.depth);
+            ok = ok && ReadValue(in, t.cellSize);
+            ok = ok && ReadValue(in, t.heightScale);
+            ok = ok && ReadValue(in, t.baseHeight);
+            ok = ok && ReadBool(in, t.useContinentalField);
+            ok = ok && ReadValue(in, t.continentalFrequency);
+            ok = ok && ReadValue(in, t.oceanThreshold);
+            ok = ok && ReadValue(in, t.coastlineBlend);
+            ok = ok && ReadValue(in, t.oceanDepth);
+            ok = ok && ReadValue(in, t.oceanFloorVariation);
+            ok = ok && ReadValue(in, t.seed);
+            ok = ok && ReadValue(in, t.noiseScale);
+            ok = ok && ReadValue(in, t.octaves);
+            ok = ok && ReadValue(in, t.persistence);
+            ok = ok && ReadValue(in, t.lacunarity);
+            ok = ok && ReadBool(in, t.useWarp);
+            ok = ok && ReadValue(in, t.warpStrength);
+            ok = ok && ReadValue(in, t.warpScale);
+            ok = ok && ReadValue(in, t.warpLevels);
+            ok = ok && ReadBool(in, t.useRidgeNoise);
+            ok = ok && ReadValue(in, t.ridgeWeight);
+            ok = ok && ReadValue(in, t.ridgePower);
+            ok = ok && ReadValue(in, t.ridgeScale);
+            ok = ok && ReadValue(in, t.peakBoost);
+            ok = ok && ReadBool(in, t.useUpliftMask);
+            ok = ok && ReadValue(in, t.upliftScale);
+            ok = ok && ReadValue(in, t.upliftThresholdLow);
+            ok = ok && ReadValue(in, t.upliftThresholdHigh);
+            ok = ok && ReadValue(in, t.upliftPower);
+            ok = ok && ReadBool(in, t.useErosion);
+            ok = ok && ReadValue(in, t.slopeErosionStrength);
+            ok = ok && ReadValue(in, t.slopeThreshold);
+            ok = ok && ReadValue(in, t.valleyDepth);
+            ok = ok && ReadValue(in, t.erosionDownsample);
+            ok = ok && ReadBool(in, t.useHydraulicErosion);
+            ok = ok && ReadValue(in, t.erosionIterations);
+            ok = ok && ReadValue(in, t.erosionInertia);
+            ok = ok && ReadValue(in, t.erosionCapacity);
+            ok = ok && ReadValue(in, t.erosionDeposition);
+            ok = ok && ReadValue(in, t.erosionEvaporation);
+            ok = ok && ReadValue(in, t.gpuErosionDroplets);
+            ok = ok && ReadBool(in, t.flatShading);
+            ok = ok && ReadBool(in, t.useBiomeColors);
+            return ok;
+        }
+    }
+
+    bool SettingsPreset::Save(const std::string &path, const WorldSettings &settings)
+    {
+        std::error_code ec;
+        std::filesystem::path parent = std::filesystem::path(path).parent_path();
+        if (!parent.empty())
+        {
+            std::filesystem::create_directories(parent, ec);
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+        {
+            GEN_ERROR("SettingsPreset::Save - Failed to open '{}'", path);
+            return false;
+        }
+
+        PresetHeader header;
+        header.magic = PRESET_MAGIC;
+        header.version = PRESET_VERSION;
+        header.settingsHash = ChunkCache::HashSettings(settings.terrainSettings);
+        WriteValue(out, header);
+        WriteBody(out, settings);
+
+        if (!out.good())
+        {
+            GEN_ERROR("SettingsPreset::Save - Write failed for '{}'", path);
+            return false;
+        }
+        return true;
+    }
+
+    bool SettingsPreset::Load(const std::string &path, WorldSettings &outSettings)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open())
+        {
+            GEN_ERROR("SettingsPreset::Load - Failed to open '{}'", path);
+            return false;
+        }
+
+        PresetHeader header;
+        if (!ReadValue(in, header) || header.magic != PRESET_MAGIC)
+        {
+            GEN_ERROR("SettingsPreset::Load - '{}' is not a preset file", path);
+            return false;
+        }
+        if (header.version > PRESET_VERSION)
+        {
+            GEN_ERROR("SettingsPreset::Load - '{}' is version {}, this build reads up to {}",
+                      path, header.version, PRESET_VERSION);
+            return false;
+        }
+
+        if (!ReadBody(in, outSettings))
+        {
+            GEN_ERROR("SettingsPreset::Load - '{}' is truncated", path);
+            return false;
+        }
+        outSettings.ComputeSeaLevel();
+
+        // The stored hash must reproduce exactly, or the disk cache keyed
+        // on it would go cold after the round-trip
+        uint64_t hash = ChunkCache::HashSettings(outSettings.terrainSettings);
+        if (hash != header.settingsHash)
+        {
+            GEN_WARN("SettingsPreset::Load - '{}' settings hash mismatch (file corrupt?)", path);
+        }
+        return true;
+    }
+
+    std::vector<std::string> SettingsPreset::List(const std::string &directory)
+    {
+        std::vector<std::string> names;
+        std::error_code ec;
+        for (const auto &entry : std::filesystem::directory_iterator(directory, ec))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == FILE_EXTENSION)
+            {
+                names.push_back(entry.path().stem().string());
+            }
+        }
+        std::sort(names.begin(), names.end());
+        return names;
+    }
+
+    std::string SettingsPreset::PathFor(const std::string &directory, const std::string &name)
+    {
+        return directory + "/" + name + FILE_EXTENSION;
+    }
+
+}
@@ -0,0 +1,436 @@
+#include "genesis/world/TerrainExporter.h"
+#include "genesis/core/JobSystem.h"
+#include "genesis/core/Log.h"
+#include "genesis/core/Profiler.h"
+#include "genesis/procedural/ClimateGenerator.h"
+#include "genesis/procedural/HydrologyData.h"
+#include "genesis/procedural/MaterialBlender.h"
+#include "genesis/procedural/Noise.h"
+#include "genesis/procedural/TerrainGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <vector>
+
+namespace Genesis
+{
+
+    namespace
+    {
+        uint32_t Crc32Update(uint32_t crc, const uint8_t *data, size_t size)
+        {
+            static uint32_t table[256];
+            static bool tableBuilt = false;
+            if (!tableBuilt)
+            {
+                for (uint32_t n = 0; n < 256; n++)
+                {
+                    uint32_t c = n;
+                    for (int k = 0; k < 8; k++)
+                    {
+                        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                    }
+                    table[n] = c;
+                }
+                tableBuilt = true;
+            }
+
+            for (size_t i = 0; i < size; i++)
+            {
+                crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+            }
+            return crc;
+        }
+
+        // Minimal streaming PNG encoder. Each pixel row is wrapped in
+        // stored (uncompressed) deflate blocks and emitted as its own
+        // IDAT chunk, so a tile of any height needs only one row of
+        // buffering. Stored blocks trade file size for zero dependencies
+        // and disk-speed throughput.
+        class PngStreamWriter
+        {
+        public:
+            ~PngStreamWriter()
+            {
+                if (m_File)
+                {
+                    std::fclose(m_File);
+                }
+            }
+
+            // colorType 0 = grayscale, 6 = RGBA; 16-bit samples are
+            // written high byte first per the PNG spec
+            bool Open(const std::string &path, int width, int height,
+                      int bitDepth, int colorType)
+            {
+                m_File = std::fopen(path.c_str(), "wb");
+                if (!m_File)
+                {
+                    return false;
+                }
+
+                static const uint8_t signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+                std::fwrite(signature, 1, sizeof(signature), m_File);
+                m_BytesWritten += sizeof(signature);
+
+                uint8_t ihdr[13];
+                WriteBE32(ihdr, static_cast<uint32_t>(width));
+                WriteBE32(ihdr + 4, static_cast<uint32_t>(height));
+                ihdr[8] = static_cast<uint8_t>(bitDepth);
+                ihdr[9] = static_cast<uint8_t>(colorType);
+                ihdr[10] = 0; // Compression: deflate
+                ihdr[11] = 0; // Filter method 0
+                ihdr[12] = 0; // No interlacing
+                WriteChunk("IHDR", ihdr, sizeof(ihdr));
+                return true;
+            }
+
+            // rowBytes excludes the filter byte; a filter-0 byte is
+            // prepended automatically
+            void WriteRow(const uint8_t *row, size_t rowBytes)
+            {
+                m_Payload.clear();
+                if (m_FirstRow)
+                {
+                    // zlib header: deflate, 32K window, no preset dict
+                    m_Payload.push_back(0x78);
+                    m_Payload.push_back(0x01);
+                    m_FirstRow = false;
+                }
+
+                uint8_t filter = 0;
+                AppendStoredBlocks(&filter, 1);
+                AppendStoredBlocks(row, rowBytes);
+                UpdateAdler(&filter, 1);
+                UpdateAdler(row, rowBytes);
+
+                WriteChunk("IDAT", m_Payload.data(), m_Payload.size());
+            }
+
+            // Terminates the deflate stream and closes the file; returns
+            // the total bytes written
+            uint64_t Close()
+            {
+                // Final empty stored block carries the BFINAL flag, then
+                // the zlib adler32 trailer
+                uint8_t trailer[9];
+                trailer[0] = 0x01;
+                trailer[1] = 0x00;
+                trailer[2] = 0x00;
+                trailer[3] = 0xFF;
+                trailer[4] = 0xFF;
+                uint32_t adler = (m_AdlerHigh << 16) | m_AdlerLow;
+                WriteBE32(trailer + 5, adler);
+                WriteChunk("IDAT", trailer, sizeof(trailer));
+
+                WriteChunk("IEND", nullptr, 0);
+                std::fclose(m_File);
+                m_File = nullptr;
+                return m_BytesWritten;
+            }
+
+        private:
+            static void WriteBE32(uint8_t *out, uint32_t value)
+            {
+                out[0] = static_cast<uint8_t>(value >> 24);
+                out[1] = static_cast<uint8_t>(value >> 16);
+                out[2] = static_cast<uint8_t>(value >> 8);
+                out[3] = static_cast<uint8_t>(value);
+            }
+
+            void WriteChunk(const char *type, const uint8_t *data, size_t size)
+            {
+                uint8_t header[8];
+                WriteBE32(header, static_cast<uint32_t>(size));
+                std::memcpy(header + 4, type, 4);
+                std::fwrite(header, 1, sizeof(header), m_File);
+
+                if (size > 0)
+                {
+                    std::fwrite(data, 1, size, m_File);
+                }
+
+                uint32_t crc = Crc32Update(0xFFFFFFFFu, header + 4, 4);
+                crc = Crc32Update(crc, data, size) ^ 0xFFFFFFFFu;
+                uint8_t crcBytes[4];
+                WriteBE32(crcBytes, crc);
+                std::fwrite(crcBytes, 1, sizeof(crcBytes), m_File);
+
+                m_BytesWritten += sizeof(header) + size + sizeof(crcBytes);
+            }
+
+            void AppendStoredBlocks(const uint8_t *data, size_t size)
+            {
+                // Stored deflate blocks hold at most 65535 bytes each
+                while (size > 0)
+                {
+                    size_t blockSize = std::min<size_t>(size, 65535);
+                    m_Payload.push_back(0x00); // BFINAL = 0, BTYPE = stored
+                    m_Payload.push_back(static_cast<uint8_t>(blockSize & 0xFF));
+                    m_Payload.push_back(static_cast<uint8_t>(blockSize >> 8));
+                    m_Payload.push_back(static_cast<uint8_t>(~blockSize & 0xFF));
+                    m_Payload.push_back(static_cast<uint8_t>((~blockSize >> 8) & 0xFF));
+                    m_Payload.insert(m_Payload.end(), data, data + blockSize);
+                    data += blockSize;
+                    size -= blockSize;
+                }
+            }
+
+            void UpdateAdler(const uint8_t *data, size_t size)
+            {
+                for (size_t i = 0; i < size; i++)
+                {
+                    m_AdlerLow = (m_AdlerLow + data[i]) % 65521;
+                    m_AdlerHigh = (m_AdlerHigh + m_AdlerLow) % 65521;
+                }
+            }
+
+            std::FILE *m_File = nullptr;
+            std::vector<uint8_t> m_Payload;
+            uint32_t m_AdlerLow = 1;
+            uint32_t m_AdlerHigh = 0;
+            bool m_FirstRow = true;
+            uint64_t m_BytesWritten = 0;
+        };
+
+        std::string TilePath(const std::string &directory, const char *kind,
+                             int tileX, int tileZ)
+        {
+            char buffer[64];
+            std::snprintf(buffer, sizeof(buffer), "/%s_x%d_z%d.png", kind, tileX, tileZ);
+            return directory + buffer;
+        }
+
+        std::string FormatDouble(double value)
+        {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.2f", value);
+            return buffer;
+        }
+
+        // Approximate the slope field MaterialBlender expects (the chunk
+        // pipeline gets it from the drainage graph) with central
+        // differences over the tile heightmap
+        void ComputeSlopeField(const std::vector<float> &heightmap, int gridWidth,
+                               int gridDepth, float cellSize, HalfField &outSlope)
+        {
+            for (int z = 0; z < gridDepth; z++)
+            {
+                for (int x = 0; x < gridWidth; x++)
+                {
+                    int x0 = std::max(x - 1, 0);
+                    int x1 = std::min(x + 1, gridWidth - 1);
+                    int z0 = std::max(z - 1, 0);
+                    int z1 = std::min(z + 1, gridDepth - 1);
+
+                    size_t idx = static_cast<size_t>(z) * gridWidth + x;
+                    float dx = (heightmap[static_cast<size_t>(z) * gridWidth + x1] -
+                                heightmap[static_cast<size_t>(z) * gridWidth + x0]) /
+                               ((x1 - x0) * cellSize);
+                    float dz = (heightmap[static_cast<size_t>(z1) * gridWidth + x] -
+                                heightmap[static_cast<size_t>(z0) * gridWidth + x]) /
+                               ((z1 - z0) * cellSize);
+                    outSlope.Set(idx, std::sqrt(dx * dx + dz * dz));
+                }
+            }
+        }
+    }
+
+    TerrainExporter::Report TerrainExporter::Run(const WorldSettings &world,
+                                                 const ExportSettings &settings)
+    {
+        int tilesPerSide = (settings.worldSize + settings.tileSize - 1) / settings.tileSize;
+
+        std::error_code ec;
+        std::filesystem::create_directories(settings.directory, ec);
+        if (ec)
+        {
+            GEN_ERROR("TerrainExporter - Failed to create directory '{}': {}",
+                      settings.directory, ec.message());
+            return {};
+        }
+
+        std::mutex resultMutex;
+        Report report;
+
+        uint64_t runStartUs = Profiler::NowMicroseconds();
+
+        // Height range covers the ocean floor through the highest peak so
+        // the 16-bit normalization never clips
+        const TerrainSettings &base = world.terrainSettings;
+        float minHeight = base.baseHeight -
+                          (base.useContinentalField ? base.oceanDepth : 0.0f);
+        float maxHeight = base.baseHeight + base.heightScale;
+        float heightRange = std::max(maxHeight - minHeight, 1e-6f);
+
+        JobCounter counter;
+        for (int tileZ = 0; tileZ < tilesPerSide; tileZ++)
+        {
+            for (int tileX = 0; tileX < tilesPerSide; tileX++)
+            {
+                JobSystem::Get().Execute([&, tileX, tileZ]()
+                                         {
+                GEN_PROFILE_SCOPE("TerrainExporter::Tile");
+
+                TerrainSettings tileSettings = world.terrainSettings;
+                tileSettings.width = settings.tileSize;
+                tileSettings.depth = settings.tileSize;
+                tileSettings.cellSize = world.cellSize;
+
+                int half = settings.worldSize / 2;
+                float originX = (tileX * settings.tileSize - half) * world.cellSize;
+                float originZ = (tileZ * settings.tileSize - half) * world.cellSize;
+
+                // Raw noise sampling is world-position based, so adjacent
+                // tiles share edge samples and stitch seamlessly
+                TerrainGenerator generator(tileSettings);
+                std::vector<float> heightmap =
+                    generator.GenerateHeightmapAtOffset(originX, originZ);
+
+                int gridWidth = settings.tileSize + 1;
+                uint64_t tileBytes = 0;
+                bool tileOk = true;
+
+                if (settings.exportHeight)
+                {
+                    // The grid's duplicated +X/+Z border samples belong to
+                    // the next tile, so each pixel is written exactly once
+                    PngStreamWriter png;
+                    std::string path = TilePath(settings.directory, "height", tileX, tileZ);
+                    if (png.Open(path, settings.tileSize, settings.tileSize, 16, 0))
+                    {
+                        std::vector<uint8_t> row(static_cast<size_t>(settings.tileSize) * 2);
+                        for (int z = 0; z < settings.tileSize; z++)
+                        {
+                            for (int x = 0; x < settings.tileSize; x++)
+                            {
+                                float h = heightmap[static_cast<size_t>(z) * gridWidth + x];
+                                float norm = std::clamp((h - minHeight) / heightRange, 0.0f, 1.0f);
+                                uint16_t value = static_cast<uint16_t>(norm * 65535.0f + 0.5f);
+                                row[static_cast<size_t>(x) * 2] = static_cast<uint8_t>(value >> 8);
+                                row[static_cast<size_t>(x) * 2 + 1] = static_cast<uint8_t>(value & 0xFF);
+                            }
+                            png.WriteRow(row.data(), row.size());
+                        }
+                        tileBytes += png.Close();
+                    }
+                    else
+                    {
+                        GEN_ERROR("TerrainExporter - Failed to open '{}'", path);
+                        tileOk = false;
+                    }
+                }
+
+                if (settings.exportSplat && tileOk)
+                {
+                    // The chunk pipeline feeds MaterialBlender from full
+                    // hydrology; for export we approximate with slope from
+                    // finite differences and ocean cells below sea level,
+                    // which covers every weight input except river and
+                    // lake proximity
+                    HydrologyData hydrology;
+                    hydrology.Resize(gridWidth, gridWidth);
+                    ComputeSlopeField(heightmap, gridWidth, gridWidth,
+                                      world.cellSize, hydrology.slope);
+                    for (size_t i = 0; i < heightmap.size(); i++)
+                    {
+                        if (heightmap[i] < world.seaLevel)
+                        {
+                            hydrology.waterType[i] = WaterType::Ocean;
+                            hydrology.distanceToWater.Set(i, 0.0f);
+                        }
+                    }
+
+                    std::shared_ptr<const SimplexNoise> noise = NoiseState::Get(tileSettings.seed);
+                    ClimateGenerator climate;
+                    ClimateSettings climateSettings;
+                    climate.Initialize(noise.get(), climateSettings);
+                    climate.Generate(heightmap, gridWidth, gridWidth, world.seaLevel,
+                                     tileSettings.heightScale, world.cellSize,
+                                     originX, originZ);
+
+                    MaterialBlender blender;
+                    blender.Compute(heightmap, hydrology, climate.GetData(),
+                                    world.seaLevel, tileSettings.heightScale);
+
+                    PngStreamWriter png;
+                    std::string path = TilePath(settings.directory, "splat", tileX, tileZ);
+                    if (png.Open(path, settings.tileSize, settings.tileSize, 8, 6))
+                    {
+                        std::vector<uint8_t> row(static_cast<size_t>(settings.tileSize) * 4);
+                        for (int z = 0; z < settings.tileSize; z++)
+                        {
+                            for (int x = 0; x < settings.tileSize; x++)
+                            {
+                                PackedMaterial packed = blender.GetPackedMaterial(x, z);
+                                row[static_cast<size_t>(x) * 4] = static_cast<uint8_t>(packed.primary);
+                                row[static_cast<size_t>(x) * 4 + 1] = static_cast<uint8_t>(packed.secondary);
+                                row[static_cast<size_t>(x) * 4 + 2] = packed.blend;
+                                row[static_cast<size_t>(x) * 4 + 3] = 255;
+                            }
+                            png.WriteRow(row.data(), row.size());
+                        }
+                        tileBytes += png.Close();
+                    }
+                    else
+                    {
+                        GEN_ERROR("TerrainExporter - Failed to open '{}'", path);
+                        tileOk = false;
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+                report.bytesWritten += tileBytes;
+                if (tileOk)
+                {
+                    report.tilesWritten++;
+                } },
+                                         &counter);
+            }
+        }
+        JobSystem::Get().Wait(counter);
+
+        report.totalSeconds = (Profiler::NowMicroseconds() - runStartUs) / 1e6;
+        return report;
+    }
+
+    int TerrainExporter::RunStandalone(int worldSize)
+    {
+        Log::Init();
+
+        bool ownsJobSystem = !JobSystem::IsInitialized();
+        if (ownsJobSystem)
+        {
+            JobSystem::Init();
+        }
+
+        WorldSettings world;
+        world.ComputeSeaLevel();
+
+        ExportSettings settings;
+        settings.worldSize = worldSize;
+        settings.tileSize = std::min(settings.tileSize, worldSize);
+
+        GEN_INFO("Terrain export: {}x{} cells in {}-cell tiles to '{}' (seed {})",
+                 settings.worldSize, settings.worldSize, settings.tileSize,
+                 settings.directory, world.seed);
+
+        Report report = Run(world, settings);
+
+        GEN_INFO("Exported {} tiles ({} MB) in {} s",
+                 report.tilesWritten,
+                 FormatDouble(report.bytesWritten / (1024.0 * 1024.0)),
+                 FormatDouble(report.totalSeconds));
+
+        if (ownsJobSystem)
+        {
+            JobSystem::Shutdown();
+        }
+
+        return report.tilesWritten > 0 ? 0 : 1;
+    }
+
+}
@@ -7,7 +7,13 @@ layout(location = 3) in vec3 fragViewPos;
 
 layout(location = 0) out vec4 outColor;
 
-#define MAX_POINT_LIGHTS 4
+#define MAX_POINT_LIGHTS 256
+
+// Froxel grid for clustered light culling; must match Renderer.h
+#define CLUSTER_GRID_X 16
+#define CLUSTER_GRID_Y 8
+#define CLUSTER_GRID_Z 8
+#define MAX_LIGHTS_PER_CLUSTER 8
 
 struct PointLight {
     vec4 positionAndIntensity;  // xyz = position, w = intensity
@@ -24,8 +30,43 @@ layout(set = 0, binding = 0) uniform GlobalUBO {
     PointLight pointLights[MAX_POINT_LIGHTS];
     ivec4 numPointLights;    // x = count
     vec4 fogColorAndDensity; // xyz = color, w = density
+    vec4 clusterParams;      // x = slice scale, y = slice bias, zw = tile size px
+    mat4 sunCascadeViewProj[3]; // sun shadow cascade light matrices
+    vec4 cascadeSplits;      // xyz = cascade far depths, w = shadow distance (0 = off)
 } ubo;
 
+// Per-cluster light lists, CPU-binned each frame: light count followed by
+// MAX_LIGHTS_PER_CLUSTER indices into ubo.pointLights
+layout(std430, set = 0, binding = 1) readonly buffer ClusterBuffer {
+    uint clusterData[];
+};
+
+// Sun shadow cascades, comparison-sampled (1.0 = fully lit). Cascades
+// re-render only when their cached footprint is invalidated; sampling
+// always uses the matrices the cached depth was rendered with.
+layout(set = 0, binding = 2) uniform sampler2DArrayShadow shadowMap;
+
+#define SHADOW_CASCADE_COUNT 3
+
+float sampleSunShadow(vec3 worldPos, float viewDepth) {
+    // w = 0 disables shadows; past the shadow distance everything is lit
+    if (ubo.cascadeSplits.w <= 0.0 || viewDepth > ubo.cascadeSplits.w)
+        return 1.0;
+
+    int cascade = 0;
+    for (int i = 0; i < SHADOW_CASCADE_COUNT - 1; i++) {
+        if (viewDepth > ubo.cascadeSplits[i])
+            cascade = i + 1;
+    }
+
+    vec4 coord = ubo.sunCascadeViewProj[cascade] * vec4(worldPos, 1.0);
+    if (coord.z <= 0.0 || coord.z >= 1.0)
+        return 1.0;
+
+    vec2 uv = coord.xy * 0.5 + 0.5;
+    return texture(shadowMap, vec4(uv, float(cascade), coord.z));
+}
+
 vec3 calculatePointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir) {
     vec3 lightPos = light.positionAndIntensity.xyz;
     float intensity = light.positionAndIntensity.w;
@@ -74,14 +115,25 @@ void main() {
     float spec = pow(max(dot(norm, halfwayDir), 0.0), 32.0);
     vec3 sunSpecular = spec * ubo.sunColor.rgb * ubo.sunColor.a * 0.2;
     
-    // Point lights
+    // Point lights: shade only this fragment's cluster list
+    float viewDepth = max(-(ubo.view * vec4(fragPos, 1.0)).z, 0.0001);
+    int slice = clamp(int(log(viewDepth) * ubo.clusterParams.x + ubo.clusterParams.y), 0, CLUSTER_GRID_Z - 1);
+    int tileX = clamp(int(gl_FragCoord.x / ubo.clusterParams.z), 0, CLUSTER_GRID_X - 1);
+    int tileY = clamp(int(gl_FragCoord.y / ubo.clusterParams.w), 0, CLUSTER_GRID_Y - 1);
+    uint slot = uint((slice * CLUSTER_GRID_Y + tileY) * CLUSTER_GRID_X + tileX) * uint(MAX_LIGHTS_PER_CLUSTER + 1);
+
     vec3 pointLighting = vec3(0.0);
-    for (int i = 0; i < ubo.numPointLights.x && i < MAX_POINT_LIGHTS; i++) {
-        pointLighting += calculatePointLight(ubo.pointLights[i], norm, fragPos, viewDir);
+    uint clusterLightCount = clusterData[slot];
+    for (uint i = 0u; i < clusterLightCount; i++) {
+        pointLighting += calculatePointLight(ubo.pointLights[clusterData[slot + 1u + i]], norm, fragPos, viewDir);
     }
     
+    // Shadow only the sun's contribution; ambient and point lights are
+    // unaffected so shadowed areas keep their fill lighting
+    float shadow = sampleSunShadow(fragPos, viewDepth);
+
     // Combine lighting with vertex color
-    vec3 result = (ambient + sunDiffuse + sunSpecular + pointLighting) * fragColor;
+    vec3 result = (ambient + (sunDiffuse + sunSpecular) * shadow + pointLighting) * fragColor;
     
     // Fog
     float fogDensity = ubo.fogColorAndDensity.w;
@@ -5,7 +5,7 @@ layout(location = 1) in vec3 inNormal;
 layout(location = 2) in vec3 inColor;
 layout(location = 3) in vec2 inTexCoord;
 
-#define MAX_POINT_LIGHTS 4
+#define MAX_POINT_LIGHTS 256
 
 struct PointLight {
     vec4 positionAndIntensity;  // xyz = position, w = intensity
@@ -22,6 +22,9 @@ layout(set = 0, binding = 0) uniform GlobalUBO {
     PointLight pointLights[MAX_POINT_LIGHTS];
     ivec4 numPointLights;    // x = count
     vec4 fogColorAndDensity; // xyz = color, w = density
+    vec4 clusterParams;      // x = slice scale, y = slice bias, zw = tile size px
+    mat4 sunCascadeViewProj[3]; // sun shadow cascade light matrices
+    vec4 cascadeSplits;      // xyz = cascade far depths, w = shadow distance (0 = off)
 } ubo;
 
 layout(push_constant) uniform PushConstants {
@@ -0,0 +1,201 @@
+#version 450
+
+// Flat-shaded variant of lowpoly.frag for the terrain pipelines: color and
+// normal carry per-face data on the provoking vertex (see the flat-shading
+// path in TerrainGenerator) and must not be interpolated. Vegetation and
+// props keep lowpoly.frag because their meshes bake facets into duplicated
+// vertices instead.
+
+layout(location = 0) flat in vec3 fragColor;
+layout(location = 1) flat in vec3 fragNormal;
+layout(location = 2) in vec3 fragPos;
+layout(location = 3) in vec3 fragViewPos;
+
+layout(location = 0) out vec4 outColor;
+
+#define MAX_POINT_LIGHTS 256
+
+// Froxel grid for clustered light culling; must match Renderer.h
+#define CLUSTER_GRID_X 16
+#define CLUSTER_GRID_Y 8
+#define CLUSTER_GRID_Z 8
+#define MAX_LIGHTS_PER_CLUSTER 8
+
+struct PointLight {
+    vec4 positionAndIntensity;  // xyz = position, w = intensity
+    vec4 colorAndRadius;         // xyz = color, w = radius
+};
+
+layout(set = 0, binding = 0) uniform GlobalUBO {
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition;
+    vec4 sunDirection;
+    vec4 sunColor;           // xyz = color, w = intensity
+    vec4 ambientColor;       // xyz = color, w = intensity
+    PointLight pointLights[MAX_POINT_LIGHTS];
+    ivec4 numPointLights;    // x = count
+    vec4 fogColorAndDensity; // xyz = color, w = density
+    vec4 clusterParams;      // x = slice scale, y = slice bias, zw = tile size px
+    mat4 sunCascadeViewProj[3]; // sun shadow cascade light matrices
+    vec4 cascadeSplits;      // xyz = cascade far depths, w = shadow distance (0 = off)
+    vec4 waterParams;        // unused here; declared to keep offsets aligned
+    vec4 waterShallowColor;
+    vec4 waterDeepColor;
+    vec4 debugParams;        // x = debug mode (0 = off), y = overlay opacity
+    vec4 debugAtlasParams;   // x = 1 / debug atlas world period
+} ubo;
+
+// Per-cluster light lists, CPU-binned each frame: light count followed by
+// MAX_LIGHTS_PER_CLUSTER indices into ubo.pointLights
+layout(std430, set = 0, binding = 1) readonly buffer ClusterBuffer {
+    uint clusterData[];
+};
+
+// Sun shadow cascades, comparison-sampled (1.0 = fully lit). Cascades
+// re-render only when their cached footprint is invalidated; sampling
+// always uses the matrices the cached depth was rendered with.
+layout(set = 0, binding = 2) uniform sampler2DArrayShadow shadowMap;
+
+// Per-cell terrain debug fields (R = height, G = log flow accumulation,
+// B = moisture, A = biome id), chunks placed toroidally by world position.
+// Sampled only while a debug view is active.
+layout(set = 0, binding = 3) uniform sampler2D debugFieldAtlas;
+
+// Matches the legend in the terragen debug view panel
+const vec3 biomePalette[10] = vec3[](
+    vec3(0.90, 0.93, 1.00), // Polar
+    vec3(0.55, 0.60, 0.70), // Tundra
+    vec3(0.15, 0.35, 0.20), // Boreal
+    vec3(0.30, 0.55, 0.25), // Temperate
+    vec3(0.50, 0.50, 0.25), // Mediterranean
+    vec3(0.65, 0.70, 0.30), // Grassland
+    vec3(0.85, 0.75, 0.50), // Desert
+    vec3(0.30, 0.70, 0.30), // Tropical
+    vec3(0.10, 0.45, 0.20), // Rainforest
+    vec3(0.25, 0.60, 0.55)  // Wetland
+);
+
+vec3 debugOverlayColor(vec4 fields, int mode) {
+    if (mode == 1) // Height: grayscale ramp
+        return vec3(fields.r);
+    if (mode == 2) // Flow accumulation: blue-to-white heat ramp
+        return mix(vec3(0.05, 0.1, 0.4), vec3(1.0), fields.g);
+    if (mode == 3) // Moisture: dry brown to wet green
+        return mix(vec3(0.55, 0.4, 0.2), vec3(0.1, 0.6, 0.3), fields.b);
+    // Dominant biome: palette lookup by id
+    int biome = clamp(int(fields.a * 255.0 + 0.5), 0, 9);
+    return biomePalette[biome];
+}
+
+#define SHADOW_CASCADE_COUNT 3
+
+float sampleSunShadow(vec3 worldPos, float viewDepth) {
+    // w = 0 disables shadows; past the shadow distance everything is lit
+    if (ubo.cascadeSplits.w <= 0.0 || viewDepth > ubo.cascadeSplits.w)
+        return 1.0;
+
+    int cascade = 0;
+    for (int i = 0; i < SHADOW_CASCADE_COUNT - 1; i++) {
+        if (viewDepth > ubo.cascadeSplits[i])
+            cascade = i + 1;
+    }
+
+    vec4 coord = ubo.sunCascadeViewProj[cascade] * vec4(worldPos, 1.0);
+    if (coord.z <= 0.0 || coord.z >= 1.0)
+        return 1.0;
+
+    vec2 uv = coord.xy * 0.5 + 0.5;
+    return texture(shadowMap, vec4(uv, float(cascade), coord.z));
+}
+
+vec3 calculatePointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir) {
+    vec3 lightPos = light.positionAndIntensity.xyz;
+    float intensity = light.positionAndIntensity.w;
+    vec3 lightColor = light.colorAndRadius.xyz;
+    float radius = light.colorAndRadius.w;
+
+    vec3 lightDir = lightPos - fragPos;
+    float distance = length(lightDir);
+
+    // Early out if outside light radius
+    if (distance > radius) return vec3(0.0);
+
+    lightDir = normalize(lightDir);
+
+    // Attenuation
+    float attenuation = 1.0 / (1.0 + 0.09 * distance + 0.032 * distance * distance);
+    attenuation *= intensity;
+
+    // Diffuse
+    float diff = max(dot(normal, lightDir), 0.0);
+    vec3 diffuse = diff * lightColor * attenuation;
+
+    // Simple specular for point lights
+    vec3 halfwayDir = normalize(lightDir + viewDir);
+    float spec = pow(max(dot(normal, halfwayDir), 0.0), 16.0);
+    vec3 specular = spec * lightColor * attenuation * 0.3;
+
+    return diffuse + specular;
+}
+
+void main() {
+    // Normalize inputs
+    vec3 norm = normalize(fragNormal);
+    vec3 viewDir = normalize(fragViewPos - fragPos);
+    vec3 lightDir = normalize(-ubo.sunDirection.xyz);
+
+    // Ambient
+    vec3 ambient = ubo.ambientColor.rgb * ubo.ambientColor.a;
+
+    // Directional light (sun) - diffuse
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec3 sunDiffuse = diff * ubo.sunColor.rgb * ubo.sunColor.a;
+
+    // Directional light - specular (subtle for low-poly)
+    vec3 halfwayDir = normalize(lightDir + viewDir);
+    float spec = pow(max(dot(norm, halfwayDir), 0.0), 32.0);
+    vec3 sunSpecular = spec * ubo.sunColor.rgb * ubo.sunColor.a * 0.2;
+
+    // Point lights: shade only this fragment's cluster list
+    float viewDepth = max(-(ubo.view * vec4(fragPos, 1.0)).z, 0.0001);
+    int slice = clamp(int(log(viewDepth) * ubo.clusterParams.x + ubo.clusterParams.y), 0, CLUSTER_GRID_Z - 1);
+    int tileX = clamp(int(gl_FragCoord.x / ubo.clusterParams.z), 0, CLUSTER_GRID_X - 1);
+    int tileY = clamp(int(gl_FragCoord.y / ubo.clusterParams.w), 0, CLUSTER_GRID_Y - 1);
+    uint slot = uint((slice * CLUSTER_GRID_Y + tileY) * CLUSTER_GRID_X + tileX) * uint(MAX_LIGHTS_PER_CLUSTER + 1);
+
+    vec3 pointLighting = vec3(0.0);
+    uint clusterLightCount = clusterData[slot];
+    for (uint i = 0u; i < clusterLightCount; i++) {
+        pointLighting += calculatePointLight(ubo.pointLights[clusterData[slot + 1u + i]], norm, fragPos, viewDir);
+    }
+
+    // Shadow only the sun's contribution; ambient and point lights are
+    // unaffected so shadowed areas keep their fill lighting
+    float shadow = sampleSunShadow(fragPos, viewDepth);
+
+    // Combine lighting with vertex color
+    vec3 result = (ambient + (sunDiffuse + sunSpecular) * shadow + pointLighting) * fragColor;
+
+    // Fog
+    float fogDensity = ubo.fogColorAndDensity.w;
+    if (fogDensity > 0.0) {
+        float distance = length(fragViewPos - fragPos);
+        float fogFactor = exp(-fogDensity * distance);
+        fogFactor = clamp(fogFactor, 0.0, 1.0);
+        result = mix(ubo.fogColorAndDensity.rgb, result, fogFactor);
+    }
+
+    // Slight color banding for stylized low-poly look
+    result = floor(result * 10.0) / 10.0;
+
+    // Debug overlay, blended after lighting so the fields read flat
+    int debugMode = int(ubo.debugParams.x);
+    if (debugMode > 0 && ubo.debugAtlasParams.x > 0.0) {
+        vec2 uv = fract(fragPos.xz * ubo.debugAtlasParams.x);
+        vec4 fields = texture(debugFieldAtlas, uv);
+        result = mix(result, debugOverlayColor(fields, debugMode), ubo.debugParams.y);
+    }
+
+    outColor = vec4(result, 1.0);
+}
@@ -0,0 +1,77 @@
+#version 450
+
+// Multi-draw indirect variant of lowpoly.vert: per-chunk transforms come
+// from a storage buffer instead of push constants. Each indirect command
+// is issued with instanceCount 1 and firstInstance set to its draw slot,
+// so gl_InstanceIndex selects the transform without needing the
+// shaderDrawParameters feature that gl_DrawID would require.
+//
+// The pooled terrain vertex format is compact (see TerrainVertex in
+// Mesh.h): half-float positions and RGBA8 colors expand in fixed-function
+// vertex fetch, the octahedral snorm8 normal is decoded below.
+
+layout(location = 0) in vec4 inPosition;  // xyz = chunk-local position
+layout(location = 1) in vec2 inNormalOct; // Octahedral-encoded normal
+layout(location = 2) in vec4 inColor;     // rgb = vertex color
+
+#define MAX_POINT_LIGHTS 256
+
+struct PointLight {
+    vec4 positionAndIntensity;  // xyz = position, w = intensity
+    vec4 colorAndRadius;         // xyz = color, w = radius
+};
+
+layout(set = 0, binding = 0) uniform GlobalUBO {
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition;
+    vec4 sunDirection;
+    vec4 sunColor;           // xyz = color, w = intensity
+    vec4 ambientColor;       // xyz = color, w = intensity
+    PointLight pointLights[MAX_POINT_LIGHTS];
+    ivec4 numPointLights;    // x = count
+    vec4 fogColorAndDensity; // xyz = color, w = density
+    vec4 clusterParams;      // x = slice scale, y = slice bias, zw = tile size px
+    mat4 sunCascadeViewProj[3]; // sun shadow cascade light matrices
+    vec4 cascadeSplits;      // xyz = cascade far depths, w = shadow distance (0 = off)
+} ubo;
+
+struct TransformData {
+    mat4 model;
+    mat4 normalMatrix;
+};
+
+layout(std430, set = 1, binding = 0) readonly buffer TransformBuffer {
+    TransformData transforms[];
+};
+
+// Color and normal are flat: terrain meshes share grid vertices and store
+// each face's normal and color on the triangle's provoking vertex (see the
+// flat-shading path in TerrainGenerator), so only that vertex's values
+// reach the fragment stage. Pairs with lowpoly_flat.frag.
+layout(location = 0) flat out vec3 fragColor;
+layout(location = 1) flat out vec3 fragNormal;
+layout(location = 2) out vec3 fragPos;
+layout(location = 3) out vec3 fragViewPos;
+
+// Unfold the lower octahedron hemisphere and renormalize
+vec3 decodeOctahedral(vec2 oct) {
+    vec3 n = vec3(oct, 1.0 - abs(oct.x) - abs(oct.y));
+    if (n.z < 0.0) {
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0,
+                                        n.y >= 0.0 ? 1.0 : -1.0);
+    }
+    return normalize(n);
+}
+
+void main() {
+    TransformData t = transforms[gl_InstanceIndex];
+
+    vec4 worldPos = t.model * vec4(inPosition.xyz, 1.0);
+    gl_Position = ubo.projection * ubo.view * worldPos;
+
+    fragColor = inColor.rgb;
+    fragNormal = mat3(t.normalMatrix) * decodeOctahedral(inNormalOct);
+    fragPos = worldPos.xyz;
+    fragViewPos = ubo.cameraPosition.xyz;
+}
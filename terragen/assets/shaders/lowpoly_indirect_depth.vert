@@ -0,0 +1,44 @@
+#version 450
+
+// Depth pre-pass variant of lowpoly_indirect.vert: position only, no
+// fragment stage. Terrain is drawn once through this pipeline to prime the
+// depth buffer, then the shading pass runs with depth compare EQUAL-style
+// behavior so each pixel is shaded exactly once despite overdraw.
+
+layout(location = 0) in vec4 inPosition;  // xyz = chunk-local position
+
+#define MAX_POINT_LIGHTS 256
+
+struct PointLight {
+    vec4 positionAndIntensity;  // xyz = position, w = intensity
+    vec4 colorAndRadius;         // xyz = color, w = radius
+};
+
+layout(set = 0, binding = 0) uniform GlobalUBO {
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition;
+    vec4 sunDirection;
+    vec4 sunColor;           // xyz = color, w = intensity
+    vec4 ambientColor;       // xyz = color, w = intensity
+    PointLight pointLights[MAX_POINT_LIGHTS];
+    ivec4 numPointLights;    // x = count
+    vec4 fogColorAndDensity; // xyz = color, w = density
+    vec4 clusterParams;      // x = slice scale, y = slice bias, zw = tile size px
+    mat4 sunCascadeViewProj[3]; // sun shadow cascade light matrices
+    vec4 cascadeSplits;      // xyz = cascade far depths, w = shadow distance (0 = off)
+} ubo;
+
+struct TransformData {
+    mat4 model;
+    mat4 normalMatrix;
+};
+
+layout(std430, set = 1, binding = 0) readonly buffer TransformBuffer {
+    TransformData transforms[];
+};
+
+void main() {
+    TransformData t = transforms[gl_InstanceIndex];
+    gl_Position = ubo.projection * ubo.view * t.model * vec4(inPosition.xyz, 1.0);
+}
@@ -0,0 +1,26 @@
+#version 450
+
+// Shadow cascade variant of lowpoly_indirect_depth.vert: renders the
+// frame's terrain batch from the sun. The cascade's light matrix arrives
+// as a push constant so one pipeline serves every cascade; set 0 stays
+// bound for pipeline layout compatibility with the main indirect passes.
+
+layout(location = 0) in vec4 inPosition;  // xyz = chunk-local position
+
+layout(push_constant) uniform ShadowPush {
+    mat4 lightViewProj;
+} push;
+
+struct TransformData {
+    mat4 model;
+    mat4 normalMatrix;
+};
+
+layout(std430, set = 1, binding = 0) readonly buffer TransformBuffer {
+    TransformData transforms[];
+};
+
+void main() {
+    TransformData t = transforms[gl_InstanceIndex];
+    gl_Position = push.lightViewProj * t.model * vec4(inPosition.xyz, 1.0);
+}
@@ -0,0 +1,60 @@
+#version 450
+
+// Instanced variant of lowpoly.vert for vegetation and props: the model
+// transform is rebuilt from compact per-instance attributes (position,
+// uniform scale, Y-axis rotation) instead of push constants, so one draw
+// covers every instance of a mesh. Uniform scale keeps the normal
+// transform a pure rotation.
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec3 inColor;
+layout(location = 3) in vec2 inTexCoord;
+
+// Per-instance data (binding 1, VK_VERTEX_INPUT_RATE_INSTANCE)
+layout(location = 4) in vec4 inPositionAndScale; // xyz = position, w = uniform scale
+layout(location = 5) in vec4 inRotationAndTint;  // xyz = euler rotation (radians), w = tint factor
+
+#define MAX_POINT_LIGHTS 256
+
+struct PointLight {
+    vec4 positionAndIntensity;  // xyz = position, w = intensity
+    vec4 colorAndRadius;         // xyz = color, w = radius
+};
+
+layout(set = 0, binding = 0) uniform GlobalUBO {
+    mat4 view;
+    mat4 projection;
+    vec4 cameraPosition;
+    vec4 sunDirection;
+    vec4 sunColor;           // xyz = color, w = intensity
+    vec4 ambientColor;       // xyz = color, w = intensity
+    PointLight pointLights[MAX_POINT_LIGHTS];
+    ivec4 numPointLights;    // x = count
+    vec4 fogColorAndDensity; // xyz = color, w = density
+    vec4 clusterParams;      // x = slice scale, y = slice bias, zw = tile size px
+    mat4 sunCascadeViewProj[3]; // sun shadow cascade light matrices
+    vec4 cascadeSplits;      // xyz = cascade far depths, w = shadow distance (0 = off)
+} ubo;
+
+layout(location = 0) out vec3 fragColor;
+layout(location = 1) out vec3 fragNormal;
+layout(location = 2) out vec3 fragPos;
+layout(location = 3) out vec3 fragViewPos;
+
+void main() {
+    float c = cos(inRotationAndTint.y);
+    float s = sin(inRotationAndTint.y);
+    mat3 rotation = mat3(
+        c, 0.0, -s,
+        0.0, 1.0, 0.0,
+        s, 0.0, c);
+
+    vec3 worldPos = rotation * (inPosition * inPositionAndScale.w) + inPositionAndScale.xyz;
+    gl_Position = ubo.projection * ubo.view * vec4(worldPos, 1.0);
+
+    fragColor = inColor * inRotationAndTint.w;
+    fragNormal = rotation * inNormal;
+    fragPos = worldPos;
+    fragViewPos = ubo.cameraPosition.xyz;
+}
@@ -0,0 +1,14 @@
+#version 450
+
+// Writes the draw's pick ID into the R32_UINT target; the depth test has
+// already decided which surface owns the pixel.
+
+layout(push_constant) uniform Push {
+    layout(offset = 64) uint pickId;
+} push;
+
+layout(location = 0) out uint outId;
+
+void main() {
+    outId = push.pickId;
+}
@@ -0,0 +1,20 @@
+#version 450
+
+// ID-buffer pick pass over the standard mesh vertex format: position only,
+// the camera matrices come from the same GlobalUBO the scene pass uses so
+// the pick rasterizes exactly what the viewport shows.
+
+layout(location = 0) in vec3 inPosition;
+
+layout(set = 0, binding = 0) uniform GlobalUBO {
+    mat4 view;
+    mat4 projection;
+} ubo;
+
+layout(push_constant) uniform Push {
+    mat4 model;
+} push;
+
+void main() {
+    gl_Position = ubo.projection * ubo.view * push.model * vec4(inPosition, 1.0);
+}
@@ -0,0 +1,20 @@
+#version 450
+
+// ID-buffer pick pass over the pooled terrain vertex format (half-float
+// chunk-local positions, see TerrainVertex in Mesh.h); pairs with
+// picking.frag like picking.vert does.
+
+layout(location = 0) in vec4 inPosition; // xyz = chunk-local position
+
+layout(set = 0, binding = 0) uniform GlobalUBO {
+    mat4 view;
+    mat4 projection;
+} ubo;
+
+layout(push_constant) uniform Push {
+    mat4 model;
+} push;
+
+void main() {
+    gl_Position = ubo.projection * ubo.view * push.model * vec4(inPosition.xyz, 1.0);
+}
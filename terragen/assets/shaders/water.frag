@@ -8,7 +8,7 @@ layout(location = 4) in float fragDepth;
 
 layout(location = 0) out vec4 outColor;
 
-#define MAX_POINT_LIGHTS 4
+#define MAX_POINT_LIGHTS 256
 
 struct PointLight {
     vec4 positionAndIntensity;
@@ -25,6 +25,12 @@ layout(set = 0, binding = 0) uniform GlobalUBO {
     PointLight pointLights[MAX_POINT_LIGHTS];
     ivec4 numPointLights;
     vec4 fogColorAndDensity;
+    vec4 clusterParams;
+    mat4 sunCascadeViewProj[3];
+    vec4 cascadeSplits;
+    vec4 waterParams;       // x = time, y = wave height, z = wave speed, w = transparency
+    vec4 waterShallowColor;
+    vec4 waterDeepColor;
 } ubo;
 
 void main() {
@@ -32,9 +38,9 @@ void main() {
     vec3 viewDir = normalize(fragViewPos - fragPos);
     vec3 lightDir = normalize(-ubo.sunDirection.xyz);
     
-    // Water colors
-    vec3 shallowColor = vec3(0.1, 0.5, 0.6);
-    vec3 deepColor = vec3(0.0, 0.2, 0.4);
+    // Water colors from WaterSettings
+    vec3 shallowColor = ubo.waterShallowColor.rgb;
+    vec3 deepColor = ubo.waterDeepColor.rgb;
     vec3 foamColor = vec3(0.9, 0.95, 1.0);
     
     // Fresnel effect - more reflective at grazing angles
@@ -75,8 +81,8 @@ void main() {
         result = mix(ubo.fogColorAndDensity.rgb, result, fogFactor);
     }
     
-    // Alpha based on fresnel and depth
-    float alpha = mix(0.6, 0.9, fresnel);
+    // Alpha based on fresnel, scaled by the configured transparency
+    float alpha = clamp(ubo.waterParams.w * mix(0.85, 1.3, fresnel), 0.0, 1.0);
     
     outColor = vec4(result, alpha);
 }
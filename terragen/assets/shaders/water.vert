@@ -5,7 +5,7 @@ layout(location = 1) in vec3 inNormal;
 layout(location = 2) in vec3 inColor;
 layout(location = 3) in vec2 inTexCoord;
 
-#define MAX_POINT_LIGHTS 4
+#define MAX_POINT_LIGHTS 256
 
 struct PointLight {
     vec4 positionAndIntensity;
@@ -22,6 +22,12 @@ layout(set = 0, binding = 0) uniform GlobalUBO {
     PointLight pointLights[MAX_POINT_LIGHTS];
     ivec4 numPointLights;
     vec4 fogColorAndDensity;
+    vec4 clusterParams;
+    mat4 sunCascadeViewProj[3];
+    vec4 cascadeSplits;
+    vec4 waterParams;       // x = time, y = wave height, z = wave speed, w = transparency
+    vec4 waterShallowColor;
+    vec4 waterDeepColor;
 } ubo;
 
 layout(push_constant) uniform PushConstants {
@@ -35,31 +41,33 @@ layout(location = 2) out vec2 fragTexCoord;
 layout(location = 3) out vec3 fragViewPos;
 layout(location = 4) out float fragDepth;
 
-// Time passed to shader via model matrix w component hack (or we add to UBO)
-// For now we'll use world position for wave phase
+// All wave motion happens here, driven by time and wave parameters from
+// the UBO: animating water never touches vertices on the CPU
 
 void main() {
     vec4 worldPos = push.model * vec4(inPosition, 1.0);
-    
-    // Simple wave animation using world position
-    float time = ubo.cameraPosition.w;  // We'll pack time into w component
+
+    // Phase from world position so adjoining water meshes line up
+    float time = ubo.waterParams.x * ubo.waterParams.z;
+    float amp = ubo.waterParams.y;
     float waveHeight = 0.0;
-    
-    // Multiple wave frequencies for more natural look
-    waveHeight += sin(worldPos.x * 0.5 + time * 2.0) * 0.1;
-    waveHeight += sin(worldPos.z * 0.7 + time * 1.5) * 0.08;
-    waveHeight += sin((worldPos.x + worldPos.z) * 0.3 + time * 2.5) * 0.05;
-    
+
+    // Multiple wave frequencies for more natural look; octave amplitudes
+    // are fractions of the configured wave height
+    waveHeight += sin(worldPos.x * 0.5 + time * 2.0) * 0.65 * amp;
+    waveHeight += sin(worldPos.z * 0.7 + time * 1.5) * 0.55 * amp;
+    waveHeight += sin((worldPos.x + worldPos.z) * 0.3 + time * 2.5) * 0.35 * amp;
+
     worldPos.y += waveHeight;
-    
+
     gl_Position = ubo.projection * ubo.view * worldPos;
-    
+
     // Calculate wave normal from derivatives
-    float dx = cos(worldPos.x * 0.5 + time * 2.0) * 0.5 * 0.1 +
-               cos((worldPos.x + worldPos.z) * 0.3 + time * 2.5) * 0.3 * 0.05;
-    float dz = cos(worldPos.z * 0.7 + time * 1.5) * 0.7 * 0.08 +
-               cos((worldPos.x + worldPos.z) * 0.3 + time * 2.5) * 0.3 * 0.05;
-    
+    float dx = cos(worldPos.x * 0.5 + time * 2.0) * 0.5 * 0.65 * amp +
+               cos((worldPos.x + worldPos.z) * 0.3 + time * 2.5) * 0.3 * 0.35 * amp;
+    float dz = cos(worldPos.z * 0.7 + time * 1.5) * 0.7 * 0.55 * amp +
+               cos((worldPos.x + worldPos.z) * 0.3 + time * 2.5) * 0.3 * 0.35 * amp;
+
     vec3 waveNormal = normalize(vec3(-dx, 1.0, -dz));
     
     fragPos = worldPos.xyz;
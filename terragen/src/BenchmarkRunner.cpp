@@ -0,0 +1,197 @@
+#include "BenchmarkRunner.h"
+
+#include <genesis/world/ChunkManager.h>
+#include <genesis/core/MemoryTracker.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace Genesis
+{
+
+    BenchmarkRunner::BenchmarkRunner(std::string outputPrefix)
+        : m_OutputPrefix(std::move(outputPrefix))
+    {
+    }
+
+    void BenchmarkRunner::Initialize(ChunkManager &chunkManager)
+    {
+        m_ChunkManager = &chunkManager;
+        m_Samples.reserve(static_cast<size_t>(DURATION_SECONDS * 240.0f));
+
+        // A wide loop that crosses coast, river valleys and high ground,
+        // chosen to force streaming in and out along the way. Fixed
+        // coordinates, fixed seed - every run flies the same meters.
+        m_Waypoints = {
+            {{0.0f, 18.0f, 60.0f}},
+            {{55.0f, 24.0f, 35.0f}},
+            {{75.0f, 32.0f, -20.0f}},
+            {{40.0f, 20.0f, -65.0f}},
+            {{-15.0f, 14.0f, -75.0f}},
+            {{-60.0f, 26.0f, -40.0f}},
+            {{-70.0f, 35.0f, 25.0f}},
+            {{-35.0f, 22.0f, 60.0f}},
+        };
+
+        GEN_INFO("Benchmark: flying {}s loop, results to {}.csv/.json",
+                 DURATION_SECONDS, m_OutputPrefix);
+    }
+
+    glm::vec3 BenchmarkRunner::SplinePosition(float t) const
+    {
+        // Closed Catmull-Rom through the waypoint loop
+        size_t count = m_Waypoints.size();
+        float scaled = t * static_cast<float>(count);
+        size_t segment = static_cast<size_t>(scaled) % count;
+        float u = scaled - std::floor(scaled);
+
+        const glm::vec3 &p0 = m_Waypoints[(segment + count - 1) % count].Position;
+        const glm::vec3 &p1 = m_Waypoints[segment].Position;
+        const glm::vec3 &p2 = m_Waypoints[(segment + 1) % count].Position;
+        const glm::vec3 &p3 = m_Waypoints[(segment + 2) % count].Position;
+
+        float u2 = u * u;
+        float u3 = u2 * u;
+        return 0.5f * ((2.0f * p1) + (-p0 + p2) * u +
+                       (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * u2 +
+                       (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * u3);
+    }
+
+    bool BenchmarkRunner::Update(float deltaTime, glm::vec3 &position, glm::vec3 &rotation)
+    {
+        if (m_Finished)
+        {
+            return false;
+        }
+
+        // Record the frame that just completed
+        float frameMs = deltaTime * 1000.0f;
+        if (m_RollingAverage <= 0.0f)
+        {
+            m_RollingAverage = frameMs;
+        }
+        m_RollingAverage += (frameMs - m_RollingAverage) * 0.02f;
+
+        FrameSample sample;
+        sample.TimeSec = m_Elapsed;
+        sample.FrameMs = frameMs;
+        sample.GpuMs = Application::Get().GetRenderer().GetStats().GpuTime;
+        sample.LoadedChunks = m_ChunkManager->GetLoadedChunkCount();
+        sample.PendingChunks = m_ChunkManager->GetPendingChunkCount();
+        sample.Hitch = frameMs > std::max(m_RollingAverage * HITCH_FACTOR, HITCH_FLOOR_MS);
+        m_Samples.push_back(sample);
+
+        m_Elapsed += deltaTime;
+        if (m_Elapsed >= DURATION_SECONDS)
+        {
+            m_Finished = true;
+            return false;
+        }
+
+        float t = m_Elapsed / DURATION_SECONDS;
+        position = SplinePosition(t);
+
+        // Look along the direction of travel, pitched gently down; the
+        // small lookahead keeps the heading stable through waypoints
+        glm::vec3 ahead = SplinePosition(std::fmod(t + 0.005f, 1.0f));
+        glm::vec3 dir = ahead - position;
+        float yaw = glm::degrees(std::atan2(dir.x, -dir.z));
+        rotation = glm::vec3(-12.0f, yaw, 0.0f);
+
+        return true;
+    }
+
+    void BenchmarkRunner::WriteResults()
+    {
+        if (m_Samples.empty())
+        {
+            return;
+        }
+
+        std::string csvPath = m_OutputPrefix + ".csv";
+        FILE *csv = std::fopen(csvPath.c_str(), "w");
+        if (csv)
+        {
+            std::fprintf(csv, "time_s,frame_ms,gpu_ms,loaded_chunks,pending_chunks,hitch\n");
+            for (const FrameSample &sample : m_Samples)
+            {
+                std::fprintf(csv, "%.4f,%.3f,%.3f,%d,%d,%d\n",
+                             sample.TimeSec, sample.FrameMs, sample.GpuMs,
+                             sample.LoadedChunks, sample.PendingChunks,
+                             sample.Hitch ? 1 : 0);
+            }
+            std::fclose(csv);
+        }
+        else
+        {
+            GEN_ERROR("Benchmark: could not write {}", csvPath);
+        }
+
+        // Summary statistics
+        std::vector<float> sorted;
+        sorted.reserve(m_Samples.size());
+        double frameSum = 0.0;
+        double gpuSum = 0.0;
+        int hitches = 0;
+        float worstMs = 0.0f;
+        int maxPending = 0;
+        float streamedAt = -1.0f;
+        for (const FrameSample &sample : m_Samples)
+        {
+            sorted.push_back(sample.FrameMs);
+            frameSum += sample.FrameMs;
+            gpuSum += sample.GpuMs;
+            hitches += sample.Hitch ? 1 : 0;
+            worstMs = std::max(worstMs, sample.FrameMs);
+            maxPending = std::max(maxPending, sample.PendingChunks);
+            if (streamedAt < 0.0f && sample.PendingChunks == 0)
+            {
+                streamedAt = sample.TimeSec;
+            }
+        }
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&](float p)
+        {
+            size_t index = static_cast<size_t>(p * static_cast<float>(sorted.size() - 1));
+            return sorted[index];
+        };
+
+        uint64_t peakHeap = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryTag::Count); i++)
+        {
+            peakHeap += MemoryTracker::GetStats(static_cast<MemoryTag>(i)).PeakBytes;
+        }
+
+        std::string jsonPath = m_OutputPrefix + ".json";
+        FILE *json = std::fopen(jsonPath.c_str(), "w");
+        if (json)
+        {
+            std::fprintf(json, "{\n");
+            std::fprintf(json, "  \"frames\": %zu,\n", m_Samples.size());
+            std::fprintf(json, "  \"duration_s\": %.2f,\n", m_Elapsed);
+            std::fprintf(json, "  \"avg_frame_ms\": %.3f,\n",
+                         frameSum / static_cast<double>(m_Samples.size()));
+            std::fprintf(json, "  \"p50_frame_ms\": %.3f,\n", percentile(0.50f));
+            std::fprintf(json, "  \"p99_frame_ms\": %.3f,\n", percentile(0.99f));
+            std::fprintf(json, "  \"worst_frame_ms\": %.3f,\n", worstMs);
+            std::fprintf(json, "  \"avg_gpu_ms\": %.3f,\n",
+                         gpuSum / static_cast<double>(m_Samples.size()));
+            std::fprintf(json, "  \"hitch_count\": %d,\n", hitches);
+            std::fprintf(json, "  \"max_pending_chunks\": %d,\n", maxPending);
+            std::fprintf(json, "  \"first_fully_streamed_s\": %.2f,\n", streamedAt);
+            std::fprintf(json, "  \"peak_heap_bytes\": %llu\n",
+                         static_cast<unsigned long long>(peakHeap));
+            std::fprintf(json, "}\n");
+            std::fclose(json);
+        }
+        else
+        {
+            GEN_ERROR("Benchmark: could not write {}", jsonPath);
+        }
+
+        GEN_INFO("Benchmark complete: {} frames, {} hitches, results in {}.csv/.json",
+                 m_Samples.size(), hitches, m_OutputPrefix);
+    }
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <genesis/Genesis.h>
+
+#include <string>
+#include <vector>
+
+namespace Genesis
+{
+
+    class ChunkManager;
+
+    // Deterministic flythrough benchmark (`terragen --benchmark [prefix]`).
+    // The camera flies a fixed Catmull-Rom loop over the standard seed-42
+    // world while every frame's CPU/GPU time and streaming state is
+    // recorded; when the path completes, the samples go to <prefix>.csv
+    // and a summary (averages, percentiles, hitches, peak heap) to
+    // <prefix>.json so two runs can be diffed number by number.
+    class BenchmarkRunner
+    {
+    public:
+        explicit BenchmarkRunner(std::string outputPrefix);
+
+        void Initialize(ChunkManager &chunkManager);
+
+        // Advance the flythrough and record the previous frame. Fills the
+        // camera pose for this frame; returns false once the path has been
+        // flown, after which the caller should write results and quit.
+        bool Update(float deltaTime, glm::vec3 &position, glm::vec3 &rotation);
+
+        // Dump the CSV and JSON summary; called once at the end of the run
+        void WriteResults();
+
+    private:
+        struct FrameSample
+        {
+            float TimeSec = 0.0f;
+            float FrameMs = 0.0f;
+            float GpuMs = 0.0f;
+            int LoadedChunks = 0;
+            int PendingChunks = 0;
+            bool Hitch = false;
+        };
+
+        struct Waypoint
+        {
+            glm::vec3 Position{0.0f};
+        };
+
+        glm::vec3 SplinePosition(float t) const;
+
+        static constexpr float DURATION_SECONDS = 60.0f;
+        static constexpr float HITCH_FACTOR = 2.0f;
+        static constexpr float HITCH_FLOOR_MS = 20.0f;
+
+        std::string m_OutputPrefix;
+        ChunkManager *m_ChunkManager = nullptr;
+
+        std::vector<Waypoint> m_Waypoints;
+        float m_Elapsed = 0.0f;
+        bool m_Finished = false;
+
+        float m_RollingAverage = 0.0f;
+        std::vector<FrameSample> m_Samples;
+    };
+
+}
@@ -0,0 +1,210 @@
+#include "MinimapBuilder.h"
+#include "genesis/core/JobSystem.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Genesis
+{
+
+    void MinimapBuilder::Start(const TerrainSettings &settings, int size, float cellSize)
+    {
+        Cancel();
+
+        auto state = std::make_shared<BuildState>();
+        state->settings = settings;
+        state->size = size;
+        state->cellSize = cellSize;
+        state->heights.resize(static_cast<size_t>(size) * size, settings.baseHeight);
+
+        int tilesPerSide = (size + TILE_SIZE - 1) / TILE_SIZE;
+        state->tilesTotal = tilesPerSide * tilesPerSide + 1; // Fine tiles + coarse pass
+        state->tilesRemaining.store(state->tilesTotal);
+
+        m_State = state;
+
+        // The coarse pass enqueues the fine tiles itself once the whole
+        // map is blocked in, so refinement never races ahead of the first
+        // visible result
+        JobSystem::Get().Execute([state]()
+                                 { RunCoarsePass(state); });
+    }
+
+    void MinimapBuilder::Cancel()
+    {
+        if (m_State)
+        {
+            m_State->cancelled.store(true);
+            m_State.reset();
+        }
+    }
+
+    bool MinimapBuilder::ApplyCompletedTiles(HeightmapTexture &texture)
+    {
+        if (!m_State || !texture.IsValid())
+            return false;
+
+        // The lock also covers the UpdateRegion reads: workers only write
+        // into heights while holding it, so the UI never sees a half
+        // copied tile
+        std::lock_guard<std::mutex> lock(m_State->mutex);
+        if (m_State->completed.empty())
+            return false;
+
+        for (const auto &rect : m_State->completed)
+        {
+            texture.UpdateRegion(m_State->heights, m_State->minHeight,
+                                 m_State->maxHeight, rect);
+        }
+        m_State->completed.clear();
+        texture.FlushUploads();
+        return true;
+    }
+
+    bool MinimapBuilder::IsBuilding() const
+    {
+        return m_State && m_State->tilesRemaining.load() > 0;
+    }
+
+    float MinimapBuilder::GetProgress() const
+    {
+        if (!m_State || m_State->tilesTotal == 0)
+            return 1.0f;
+        int remaining = m_State->tilesRemaining.load();
+        return 1.0f - static_cast<float>(remaining) / m_State->tilesTotal;
+    }
+
+    void MinimapBuilder::RunCoarsePass(const std::shared_ptr<BuildState> &state)
+    {
+        if (state->cancelled.load())
+            return;
+
+        TerrainGenerator generator(state->settings);
+        int size = state->size;
+        int coarseCount = (size + COARSE_STRIDE - 1) / COARSE_STRIDE;
+
+        std::vector<float> xs(coarseCount);
+        std::vector<float> zs(coarseCount);
+        std::vector<float> row(coarseCount);
+        for (int i = 0; i < coarseCount; i++)
+        {
+            xs[i] = i * COARSE_STRIDE * state->cellSize;
+        }
+
+        float minHeight = std::numeric_limits<float>::max();
+        float maxHeight = std::numeric_limits<float>::lowest();
+
+        for (int cz = 0; cz < coarseCount; cz++)
+        {
+            if (state->cancelled.load())
+                return;
+
+            float worldZ = cz * COARSE_STRIDE * state->cellSize;
+            std::fill(zs.begin(), zs.end(), worldZ);
+            generator.SampleRawHeightRow(xs.data(), zs.data(), row.data(), coarseCount);
+
+            // Replicate each sample over its stride block so the map is
+            // fully covered after this pass
+            int blockZ0 = cz * COARSE_STRIDE;
+            int blockZ1 = std::min(blockZ0 + COARSE_STRIDE, size);
+            for (int cx = 0; cx < coarseCount; cx++)
+            {
+                float h = row[cx];
+                minHeight = std::min(minHeight, h);
+                maxHeight = std::max(maxHeight, h);
+
+                int blockX0 = cx * COARSE_STRIDE;
+                int blockX1 = std::min(blockX0 + COARSE_STRIDE, size);
+                for (int z = blockZ0; z < blockZ1; z++)
+                {
+                    std::fill(state->heights.begin() + static_cast<size_t>(z) * size + blockX0,
+                              state->heights.begin() + static_cast<size_t>(z) * size + blockX1,
+                              h);
+                }
+            }
+        }
+
+        if (maxHeight <= minHeight)
+        {
+            maxHeight = minHeight + 1.0f;
+        }
+
+        if (state->cancelled.load())
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            // Fixed before the first rect is visible; fine tiles inherit it
+            state->minHeight = minHeight;
+            state->maxHeight = maxHeight;
+            state->completed.push_back({0, 0, size, size});
+        }
+        state->tilesRemaining.fetch_sub(1);
+
+        int tilesPerSide = (size + TILE_SIZE - 1) / TILE_SIZE;
+        for (int tileZ = 0; tileZ < tilesPerSide; tileZ++)
+        {
+            for (int tileX = 0; tileX < tilesPerSide; tileX++)
+            {
+                JobSystem::Get().Execute([state, tileX, tileZ]()
+                                         { RunTile(state, tileX, tileZ); });
+            }
+        }
+    }
+
+    void MinimapBuilder::RunTile(const std::shared_ptr<BuildState> &state,
+                                 int tileX, int tileZ)
+    {
+        if (state->cancelled.load())
+        {
+            state->tilesRemaining.fetch_sub(1);
+            return;
+        }
+
+        TerrainGenerator generator(state->settings);
+        int size = state->size;
+        int x0 = tileX * TILE_SIZE;
+        int z0 = tileZ * TILE_SIZE;
+        int x1 = std::min(x0 + TILE_SIZE, size);
+        int z1 = std::min(z0 + TILE_SIZE, size);
+        int tileWidth = x1 - x0;
+        int tileDepth = z1 - z0;
+
+        // Sample into a local buffer so the shared grid is only touched
+        // under the publish lock
+        std::vector<float> tile(static_cast<size_t>(tileWidth) * tileDepth);
+        std::vector<float> xs(tileWidth);
+        std::vector<float> zs(tileWidth);
+        for (int i = 0; i < tileWidth; i++)
+        {
+            xs[i] = (x0 + i) * state->cellSize;
+        }
+
+        for (int z = 0; z < tileDepth; z++)
+        {
+            if (state->cancelled.load())
+            {
+                state->tilesRemaining.fetch_sub(1);
+                return;
+            }
+            std::fill(zs.begin(), zs.end(), (z0 + z) * state->cellSize);
+            generator.SampleRawHeightRow(xs.data(), zs.data(),
+                                         tile.data() + static_cast<size_t>(z) * tileWidth,
+                                         tileWidth);
+        }
+
+        if (!state->cancelled.load())
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            for (int z = 0; z < tileDepth; z++)
+            {
+                std::copy(tile.begin() + static_cast<size_t>(z) * tileWidth,
+                          tile.begin() + static_cast<size_t>(z + 1) * tileWidth,
+                          state->heights.begin() + static_cast<size_t>(z0 + z) * size + x0);
+            }
+            state->completed.push_back({x0, z0, tileWidth, tileDepth});
+        }
+        state->tilesRemaining.fetch_sub(1);
+    }
+
+}
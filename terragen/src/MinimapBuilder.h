@@ -0,0 +1,88 @@
+#pragma once
+
+#include "genesis/procedural/TerrainGenerator.h"
+#include "genesis/renderer/HeightmapTexture.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Genesis
+{
+
+    /**
+     * Progressive world-overview builder for the settings panel.
+     *
+     * The overview refines coarse-to-fine on job system workers: a strided
+     * pass fills the whole map with blocky samples first, then full-detail
+     * tiles replace it as they complete. Workers sample the raw noise stack
+     * through TerrainGenerator's batch row API, and the UI thread applies
+     * finished tiles with partial HeightmapTexture updates, so a 1024x1024
+     * overview refines over a few frames without ever blocking input.
+     *
+     * Starting a new build cancels the previous one: stale workers see the
+     * cancellation flag and drop their output, and the per-build state is
+     * shared-ownership so late tiles never write into a newer build.
+     */
+    class MinimapBuilder
+    {
+    public:
+        // Kick off a build covering size x size samples spaced cellSize
+        // world units apart. Cancels any build still in flight.
+        void Start(const TerrainSettings &settings, int size, float cellSize);
+
+        // Abandon the current build; in-flight workers finish harmlessly.
+        void Cancel();
+
+        // Call once per frame on the UI thread: uploads tiles completed
+        // since the last call to the texture (which must match the build
+        // size). Returns true when anything was applied.
+        bool ApplyCompletedTiles(HeightmapTexture &texture);
+
+        bool IsBuilding() const;
+
+        // Fraction of tiles applied-or-pending completion, for UI feedback
+        float GetProgress() const;
+
+    private:
+        // Stride of the first blocky full-map pass
+        static constexpr int COARSE_STRIDE = 8;
+
+        // Fine pass tile side length in samples
+        static constexpr int TILE_SIZE = 64;
+
+        // Everything one build touches. Workers hold a shared_ptr, so a
+        // cancelled build's memory stays valid until its last job exits.
+        struct BuildState
+        {
+            TerrainSettings settings;
+            int size = 0;
+            float cellSize = 1.0f;
+
+            std::atomic<bool> cancelled{false};
+
+            // Full-size sample grid; tiles write disjoint regions and
+            // publish them through the mutex below
+            std::vector<float> heights;
+
+            // Normalization range, fixed after the coarse pass so later
+            // tiles don't re-scale already-visible areas
+            float minHeight = 0.0f;
+            float maxHeight = 1.0f;
+
+            std::mutex mutex;
+            std::vector<HeightmapTexture::DirtyRect> completed;
+
+            std::atomic<int> tilesRemaining{0};
+            int tilesTotal = 0;
+        };
+
+        static void RunCoarsePass(const std::shared_ptr<BuildState> &state);
+        static void RunTile(const std::shared_ptr<BuildState> &state,
+                            int tileX, int tileZ);
+
+        std::shared_ptr<BuildState> m_State;
+    };
+
+}
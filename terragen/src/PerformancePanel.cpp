@@ -0,0 +1,260 @@
+#include "PerformancePanel.h"
+
+#include <genesis/Genesis.h>
+#include <genesis/world/ChunkManager.h>
+#include <genesis/core/MemoryTracker.h>
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace Genesis
+{
+
+    void PerformancePanel::Initialize(ChunkManager &chunkManager)
+    {
+        m_ChunkManager = &chunkManager;
+        m_LastCollectUs = Profiler::NowMicroseconds();
+        m_EventScratch.reserve(512);
+    }
+
+    void PerformancePanel::Update(float deltaTime)
+    {
+        float frameMs = deltaTime * 1000.0f;
+
+        // Rolling average trails slowly so a single hitch does not drag
+        // the threshold up with it
+        if (m_RollingAverage <= 0.0f)
+        {
+            m_RollingAverage = frameMs;
+        }
+        m_RollingAverage += (frameMs - m_RollingAverage) * 0.02f;
+
+        if (frameMs > std::max(m_RollingAverage * HITCH_FACTOR, HITCH_FLOOR_MS))
+        {
+            m_HitchCount++;
+            m_WorstHitchMs = std::max(m_WorstHitchMs, frameMs);
+        }
+
+        // Retire the sample falling out of the window from the hitch tally
+        float evicted = m_FrameTimes[m_Head];
+        if (evicted > std::max(m_RollingAverage * HITCH_FACTOR, HITCH_FLOOR_MS) && m_HitchCount > 0)
+        {
+            m_HitchCount--;
+        }
+
+        m_FrameTimes[m_Head] = frameMs;
+        m_Head = (m_Head + 1) % HISTORY_SIZE;
+
+        CollectCpuStages();
+    }
+
+    void PerformancePanel::CollectCpuStages()
+    {
+        m_EventScratch.clear();
+        Profiler::Collect(m_EventScratch, m_LastCollectUs);
+        m_LastCollectUs = Profiler::NowMicroseconds();
+
+        m_CpuStages.clear();
+        for (const auto &event : m_EventScratch)
+        {
+            float ms = static_cast<float>(event.EndUs - event.StartUs) / 1000.0f;
+
+            auto it = std::find_if(m_CpuStages.begin(), m_CpuStages.end(),
+                                   [&](const StageTiming &stage)
+                                   { return std::strcmp(stage.Name, event.Name) == 0; });
+            if (it != m_CpuStages.end())
+            {
+                it->Milliseconds += ms;
+            }
+            else
+            {
+                StageTiming stage;
+                stage.Name = event.Name;
+                stage.Milliseconds = ms;
+                m_CpuStages.push_back(stage);
+            }
+        }
+
+        // Heaviest first; drop sub-threshold noise and cap the list
+        std::sort(m_CpuStages.begin(), m_CpuStages.end(),
+                  [](const StageTiming &a, const StageTiming &b)
+                  { return a.Milliseconds > b.Milliseconds; });
+        while (!m_CpuStages.empty() &&
+               (m_CpuStages.size() > MAX_STAGE_BARS ||
+                m_CpuStages.back().Milliseconds < MIN_STAGE_MS))
+        {
+            m_CpuStages.pop_back();
+        }
+    }
+
+    void PerformancePanel::Render()
+    {
+        ImGui::SetNextWindowPos(ImVec2(10, 220), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(340, 420), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin("Performance"))
+        {
+            ImGui::End();
+            return;
+        }
+
+        RenderFrameGraph();
+
+        ImGui::Separator();
+
+        float budgetMs = std::max(m_RollingAverage, 1.0f);
+        RenderStageBars("CPU stages", m_CpuStages, budgetMs);
+
+        // GPU zones arrive through RenderStats, resolved a couple of
+        // frames behind the CPU
+        const auto &stats = Application::Get().GetRenderer().GetStats();
+        m_GpuStages.clear();
+        for (const auto &zone : stats.GpuZones)
+        {
+            if (zone.Name == "Frame")
+            {
+                continue;
+            }
+            StageTiming stage;
+            stage.OwnedName = zone.Name;
+            stage.Milliseconds = zone.Milliseconds;
+            m_GpuStages.push_back(std::move(stage));
+        }
+        std::sort(m_GpuStages.begin(), m_GpuStages.end(),
+                  [](const StageTiming &a, const StageTiming &b)
+                  { return a.Milliseconds > b.Milliseconds; });
+        // Point the display names at the owned strings only once the
+        // vector has stopped relocating elements
+        for (auto &stage : m_GpuStages)
+        {
+            stage.Name = stage.OwnedName.c_str();
+        }
+
+        ImGui::Separator();
+        if (stats.GpuZones.empty())
+        {
+            ImGui::TextDisabled("GPU timestamps unsupported on this device");
+        }
+        else
+        {
+            ImGui::Text("GPU frame: %.2f ms", stats.GpuTime);
+            RenderStageBars("GPU stages", m_GpuStages,
+                            std::max(stats.GpuTime, 1.0f));
+        }
+
+        ImGui::Separator();
+        RenderStreamingGauges();
+
+        ImGui::Separator();
+        RenderMemoryGauges();
+
+        ImGui::End();
+    }
+
+    void PerformancePanel::RenderFrameGraph()
+    {
+        float current = m_FrameTimes[(m_Head + HISTORY_SIZE - 1) % HISTORY_SIZE];
+        ImGui::Text("Frame: %.2f ms (avg %.2f ms)", current, m_RollingAverage);
+
+        // Fixed 2x-average ceiling keeps the graph steady frame to frame;
+        // hitches clip against the top rather than rescaling everything
+        float ceiling = std::max(m_RollingAverage * 2.0f, HITCH_FLOOR_MS);
+        ImGui::PlotLines("##frametimes", m_FrameTimes.data(), HISTORY_SIZE, m_Head,
+                         nullptr, 0.0f, ceiling,
+                         ImVec2(ImGui::GetContentRegionAvail().x, 60.0f));
+
+        // Mark hitch frames with ticks along the top of the plot
+        ImVec2 plotMin = ImGui::GetItemRectMin();
+        ImVec2 plotMax = ImGui::GetItemRectMax();
+        ImDrawList *drawList = ImGui::GetWindowDrawList();
+        float threshold = std::max(m_RollingAverage * HITCH_FACTOR, HITCH_FLOOR_MS);
+        float width = plotMax.x - plotMin.x;
+        for (int i = 0; i < HISTORY_SIZE; i++)
+        {
+            // Oldest sample sits at the left edge
+            int index = (m_Head + i) % HISTORY_SIZE;
+            if (m_FrameTimes[index] <= threshold)
+            {
+                continue;
+            }
+            float x = plotMin.x + width * (static_cast<float>(i) + 0.5f) / HISTORY_SIZE;
+            drawList->AddLine(ImVec2(x, plotMin.y), ImVec2(x, plotMin.y + 8.0f),
+                              IM_COL32(255, 64, 64, 255), 2.0f);
+        }
+
+        if (m_HitchCount > 0)
+        {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f),
+                               "%d hitches in window (worst %.1f ms)",
+                               m_HitchCount, m_WorstHitchMs);
+        }
+        else
+        {
+            ImGui::TextDisabled("No hitches in window");
+            m_WorstHitchMs = 0.0f;
+        }
+    }
+
+    void PerformancePanel::RenderStageBars(const char *label,
+                                           const std::vector<StageTiming> &stages,
+                                           float budgetMs)
+    {
+        ImGui::Text("%s", label);
+        for (const auto &stage : stages)
+        {
+            float fraction = std::clamp(stage.Milliseconds / budgetMs, 0.0f, 1.0f);
+            char overlay[96];
+            snprintf(overlay, sizeof(overlay), "%s %.2f ms", stage.Name, stage.Milliseconds);
+            ImGui::ProgressBar(fraction, ImVec2(-1.0f, 0.0f), overlay);
+        }
+        if (stages.empty())
+        {
+            ImGui::TextDisabled("  (nothing above %.2f ms)", MIN_STAGE_MS);
+        }
+    }
+
+    void PerformancePanel::RenderMemoryGauges()
+    {
+        if (!MemoryTracker::IsEnabled())
+        {
+            ImGui::TextDisabled("Heap tracking compiled out");
+            return;
+        }
+
+        ImGui::Text("Heap by subsystem");
+        for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryTag::Count); i++)
+        {
+            MemoryTag tag = static_cast<MemoryTag>(i);
+            MemoryTracker::TagStats stats = MemoryTracker::GetStats(tag);
+            if (stats.TotalAllocations == 0)
+            {
+                continue;
+            }
+            ImGui::Text("  %-12s %7.1f MB (peak %.1f)   %llu allocs/frame",
+                        MemoryTracker::TagName(tag),
+                        static_cast<double>(stats.CurrentBytes) / (1024.0 * 1024.0),
+                        static_cast<double>(stats.PeakBytes) / (1024.0 * 1024.0),
+                        static_cast<unsigned long long>(stats.FrameAllocations));
+        }
+    }
+
+    void PerformancePanel::RenderStreamingGauges()
+    {
+        ImGui::Text("Chunk streaming");
+        ImGui::Text("  Loaded: %d   Pending: %d",
+                    m_ChunkManager->GetLoadedChunkCount(),
+                    m_ChunkManager->GetPendingChunkCount());
+
+        size_t used = m_ChunkManager->GetCpuMemoryUsage();
+        size_t budget = m_ChunkManager->GetCpuMemoryBudget();
+        float fill = budget > 0 ? static_cast<float>(used) / static_cast<float>(budget) : 0.0f;
+        char overlay[64];
+        snprintf(overlay, sizeof(overlay), "CPU memory %.0f / %.0f MB",
+                 static_cast<double>(used) / (1024.0 * 1024.0),
+                 static_cast<double>(budget) / (1024.0 * 1024.0));
+        ImGui::ProgressBar(std::clamp(fill, 0.0f, 1.0f), ImVec2(-1.0f, 0.0f), overlay);
+    }
+
+}
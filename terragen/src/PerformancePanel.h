@@ -0,0 +1,86 @@
+#pragma once
+
+#include <genesis/core/Profiler.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Genesis
+{
+
+    class ChunkManager;
+
+    /**
+     * Dockable performance panel for the sandbox.
+     *
+     * RenderStats reaches the stats overlay as a handful of numbers; this
+     * panel makes the rest of the instrumentation visible at a glance:
+     *
+     *   - Scrolling frame-time graph over the last few seconds, with
+     *     hitch markers on frames that spiked past the rolling average
+     *   - Per-stage bars for the frame's CPU scopes (GEN_PROFILE_SCOPE,
+     *     aggregated by name across all threads) and the renderer's GPU
+     *     zones, scaled against the frame budget
+     *   - Chunk streaming gauges: loaded/pending counts and the CPU
+     *     memory budget fill
+     *
+     * Everything is read from instrumentation that is already on in
+     * production builds, so the panel itself costs one Profiler::Collect
+     * and some ImGui per frame.
+     */
+    class PerformancePanel
+    {
+    public:
+        PerformancePanel() = default;
+
+        void Initialize(ChunkManager &chunkManager);
+
+        // Record this frame's sample; call once per update before Render
+        void Update(float deltaTime);
+
+        void Render();
+
+    private:
+        // One aggregated CPU or GPU stage for the bar list
+        struct StageTiming
+        {
+            const char *Name = nullptr;
+            std::string OwnedName; // GPU zone names are not literals
+            float Milliseconds = 0.0f;
+        };
+
+        void CollectCpuStages();
+        void RenderFrameGraph();
+        void RenderStageBars(const char *label, const std::vector<StageTiming> &stages,
+                             float budgetMs);
+        void RenderStreamingGauges();
+        void RenderMemoryGauges();
+
+    private:
+        static constexpr int HISTORY_SIZE = 240;
+        // A frame this far above the rolling average is marked as a hitch
+        static constexpr float HITCH_FACTOR = 2.0f;
+        static constexpr float HITCH_FLOOR_MS = 20.0f;
+        // Stages cheaper than this are noise; fold them out of the bars
+        static constexpr float MIN_STAGE_MS = 0.05f;
+        static constexpr size_t MAX_STAGE_BARS = 10;
+
+        ChunkManager *m_ChunkManager = nullptr;
+
+        // Frame-time ring; Head is the next write position
+        std::array<float, HISTORY_SIZE> m_FrameTimes{};
+        int m_Head = 0;
+        float m_RollingAverage = 0.0f;
+        int m_HitchCount = 0;
+        float m_WorstHitchMs = 0.0f;
+
+        // Scratch reused across frames to keep Collect allocation-free at
+        // steady state
+        std::vector<Profiler::Event> m_EventScratch;
+        std::vector<StageTiming> m_CpuStages;
+        std::vector<StageTiming> m_GpuStages;
+        uint64_t m_LastCollectUs = 0;
+    };
+
+}
@@ -1,13 +1,16 @@
 #include "Sandbox.h"
+#include "BenchmarkRunner.h"
+#include "PerformancePanel.h"
 #include "TerrainSettingsPanel.h"
+#include <genesis/renderer/InstancedRenderer.h>
 #include <genesis/renderer/VulkanDevice.h>
 #include <imgui.h>
 
 namespace Genesis
 {
 
-    Sandbox::Sandbox()
-        : Layer("Sandbox")
+    Sandbox::Sandbox(std::string benchmarkPrefix)
+        : Layer("Sandbox"), m_BenchmarkPrefix(std::move(benchmarkPrefix))
     {
     }
 
@@ -23,6 +26,13 @@ namespace Genesis
         m_Camera.SetRotation(m_CameraRotation);
 
         SetupScene();
+
+        if (!m_BenchmarkPrefix.empty())
+        {
+            m_Benchmark = std::make_unique<BenchmarkRunner>(m_BenchmarkPrefix);
+            m_Benchmark->Initialize(m_ChunkManager);
+            m_ShowUI = false;
+        }
     }
 
     void Sandbox::OnDetach()
@@ -38,26 +48,28 @@ namespace Genesis
             m_TerrainPanel->Shutdown();
             m_TerrainPanel.reset();
         }
+        m_PerformancePanel.reset();
+        m_Benchmark.reset();
 
         // Shutdown chunk manager first
         m_ChunkManager.Shutdown();
 
-        // Cleanup meshes
-        if (m_RockMesh)
-        {
-            m_RockMesh->Shutdown();
-            m_RockMesh.reset();
-        }
+        // Drop instance batches referencing the meshes we are about to destroy
+        auto &instanced = Application::Get().GetRenderer().GetInstancedRenderer();
         if (m_TreeMesh)
         {
-            m_TreeMesh->Shutdown();
-            m_TreeMesh.reset();
+            instanced.SetInstances(m_TreeMesh.get(), {});
         }
-        if (m_CubeMesh)
+        if (m_RockMesh)
         {
-            m_CubeMesh->Shutdown();
-            m_CubeMesh.reset();
+            instanced.SetInstances(m_RockMesh.get(), {});
         }
+
+        // Release our references; the renderer's mesh cache owns the GPU
+        // buffers and frees them on renderer shutdown
+        m_RockMesh.reset();
+        m_TreeMesh.reset();
+        m_CubeMesh.reset();
     }
 
     void Sandbox::OnUpdate(float deltaTime)
@@ -66,101 +78,144 @@ namespace Genesis
         m_FrameCount++;
         m_TotalTime += deltaTime; // Track total time for water animation
 
-        // Simple WASD camera controller
-        float velocity = m_CameraSpeed * deltaTime;
-
-        if (Input::IsKeyPressed(static_cast<int>(Key::W)))
+        // Benchmark mode flies the scripted spline; no input reaches the
+        // camera, so two runs cover identical ground
+        if (m_Benchmark)
         {
-            m_CameraPosition += m_Camera.GetForward() * velocity;
-        }
-        if (Input::IsKeyPressed(static_cast<int>(Key::S)))
-        {
-            m_CameraPosition -= m_Camera.GetForward() * velocity;
-        }
-        if (Input::IsKeyPressed(static_cast<int>(Key::A)))
-        {
-            m_CameraPosition -= m_Camera.GetRight() * velocity;
-        }
-        if (Input::IsKeyPressed(static_cast<int>(Key::D)))
-        {
-            m_CameraPosition += m_Camera.GetRight() * velocity;
-        }
-        if (Input::IsKeyPressed(static_cast<int>(Key::Space)))
-        {
-            m_CameraPosition.y += velocity;
-        }
-        if (Input::IsKeyPressed(static_cast<int>(Key::LeftShift)))
-        {
-            m_CameraPosition.y -= velocity;
+            if (!m_Benchmark->Update(deltaTime, m_CameraPosition, m_CameraRotation))
+            {
+                m_Benchmark->WriteResults();
+                m_Benchmark.reset();
+                Application::Get().Close();
+            }
         }
-
-        // Mouse look (when right mouse button is held)
-        if (Input::IsMouseButtonPressed(static_cast<int>(Mouse::Right)))
+        else
         {
-            glm::vec2 mousePos = Input::GetMousePosition();
+            // Simple WASD camera controller
+            float velocity = m_CameraSpeed * deltaTime;
 
-            if (m_FirstMouse)
+            if (Input::IsKeyPressed(static_cast<int>(Key::W)))
             {
-                m_LastMousePosition = mousePos;
-                m_FirstMouse = false;
+                m_CameraPosition += m_Camera.GetForward() * velocity;
+            }
+            if (Input::IsKeyPressed(static_cast<int>(Key::S)))
+            {
+                m_CameraPosition -= m_Camera.GetForward() * velocity;
+            }
+            if (Input::IsKeyPressed(static_cast<int>(Key::A)))
+            {
+                m_CameraPosition -= m_Camera.GetRight() * velocity;
+            }
+            if (Input::IsKeyPressed(static_cast<int>(Key::D)))
+            {
+                m_CameraPosition += m_Camera.GetRight() * velocity;
+            }
+            if (Input::IsKeyPressed(static_cast<int>(Key::Space)))
+            {
+                m_CameraPosition.y += velocity;
+            }
+            if (Input::IsKeyPressed(static_cast<int>(Key::LeftShift)))
+            {
+                m_CameraPosition.y -= velocity;
             }
 
-            float xOffset = (mousePos.x - m_LastMousePosition.x) * m_MouseSensitivity;
-            float yOffset = (mousePos.y - m_LastMousePosition.y) * m_MouseSensitivity;
+            // Mouse look (when right mouse button is held)
+            if (Input::IsMouseButtonPressed(static_cast<int>(Mouse::Right)))
+            {
+                glm::vec2 mousePos = Input::GetMousePosition();
 
-            m_LastMousePosition = mousePos;
+                if (m_FirstMouse)
+                {
+                    m_LastMousePosition = mousePos;
+                    m_FirstMouse = false;
+                }
 
-            m_CameraRotation.y += xOffset;
-            m_CameraRotation.x += yOffset;
+                float xOffset = (mousePos.x - m_LastMousePosition.x) * m_MouseSensitivity;
+                float yOffset = (mousePos.y - m_LastMousePosition.y) * m_MouseSensitivity;
 
-            // Clamp pitch
-            if (m_CameraRotation.x > 89.0f)
-                m_CameraRotation.x = 89.0f;
-            if (m_CameraRotation.x < -89.0f)
-                m_CameraRotation.x = -89.0f;
-        }
-        else
-        {
-            m_FirstMouse = true;
-        }
+                m_LastMousePosition = mousePos;
 
-        // Time of day controls: T to advance, Shift+T to reverse
-        if (Input::IsKeyPressed(static_cast<int>(Key::T)))
-        {
-            if (Input::IsKeyPressed(static_cast<int>(Key::LeftShift)))
-            {
-                m_TimeOfDay -= deltaTime * 2.0f; // 2 hours per second backwards
+                m_CameraRotation.y += xOffset;
+                m_CameraRotation.x += yOffset;
+
+                // Clamp pitch
+                if (m_CameraRotation.x > 89.0f)
+                    m_CameraRotation.x = 89.0f;
+                if (m_CameraRotation.x < -89.0f)
+                    m_CameraRotation.x = -89.0f;
             }
             else
             {
-                m_TimeOfDay += deltaTime * 2.0f; // 2 hours per second forward
+                m_FirstMouse = true;
             }
-            if (m_TimeOfDay < 0)
-                m_TimeOfDay += 24.0f;
-            if (m_TimeOfDay >= 24.0f)
-                m_TimeOfDay -= 24.0f;
 
-            Application::Get().GetRenderer().GetLightManager().SetTimeOfDay(m_TimeOfDay);
-        }
+            // Time of day controls: T to advance, Shift+T to reverse
+            if (Input::IsKeyPressed(static_cast<int>(Key::T)))
+            {
+                if (Input::IsKeyPressed(static_cast<int>(Key::LeftShift)))
+                {
+                    m_TimeOfDay -= deltaTime * 2.0f; // 2 hours per second backwards
+                }
+                else
+                {
+                    m_TimeOfDay += deltaTime * 2.0f; // 2 hours per second forward
+                }
+                if (m_TimeOfDay < 0)
+                    m_TimeOfDay += 24.0f;
+                if (m_TimeOfDay >= 24.0f)
+                    m_TimeOfDay -= 24.0f;
+
+                Application::Get().GetRenderer().GetLightManager().SetTimeOfDay(m_TimeOfDay);
+            }
 
-        // Toggle UI with Tab key (using simple debounce)
-        static bool tabWasPressed = false;
-        bool tabPressed = Input::IsKeyPressed(static_cast<int>(Key::Tab));
-        if (tabPressed && !tabWasPressed)
-        {
-            m_ShowUI = !m_ShowUI;
+            // Toggle UI with Tab key (using simple debounce)
+            static bool tabWasPressed = false;
+            bool tabPressed = Input::IsKeyPressed(static_cast<int>(Key::Tab));
+            if (tabPressed && !tabWasPressed)
+            {
+                m_ShowUI = !m_ShowUI;
+            }
+            tabWasPressed = tabPressed;
         }
-        tabWasPressed = tabPressed;
 
         m_Camera.SetPosition(m_CameraPosition);
         m_Camera.SetRotation(m_CameraRotation);
 
+        // Feed this frame's camera to the GPU vegetation cull pass; it is
+        // recorded at BeginFrame, before BeginScene supplies the matrices
+        Application::Get().GetRenderer().GetInstancedRenderer().SetCullCamera(
+            m_Camera.GetPosition(), m_Camera.GetViewProjectionMatrix());
+
         // Update renderer time for water animation
         Application::Get().GetRenderer().SetTime(m_TotalTime);
 
         // Update chunk manager based on camera position
         m_ChunkManager.Update(m_CameraPosition);
 
+        // Re-upload vegetation instance buffers only when chunk streaming
+        // changed the aggregated lists; steady-state frames skip this
+        uint64_t objectsVersion = m_ChunkManager.GetObjectsVersion();
+        if (objectsVersion != m_VegetationVersion)
+        {
+            auto &instanced = Application::Get().GetRenderer().GetInstancedRenderer();
+            if (m_TreeMesh)
+            {
+                instanced.SetInstances(m_TreeMesh.get(), m_ChunkManager.GetAllTreeInstances());
+            }
+            if (m_RockMesh)
+            {
+                instanced.SetInstances(m_RockMesh.get(), m_ChunkManager.GetAllRockInstances());
+            }
+            m_VegetationVersion = objectsVersion;
+        }
+
+        // Record this frame into the performance panel's history even
+        // while the UI is hidden, so reopening it shows a full window
+        if (m_PerformancePanel)
+        {
+            m_PerformancePanel->Update(deltaTime);
+        }
+
         // Update scene
         if (m_Scene)
         {
@@ -179,7 +234,7 @@ namespace Genesis
         renderer.BeginScene(m_Camera);
 
         // Render all loaded terrain chunks
-        m_ChunkManager.Render(renderer);
+        m_ChunkManager.Render(renderer, m_Camera);
 
         // Render a marker cube at origin
         if (m_CubeMesh)
@@ -188,25 +243,10 @@ namespace Genesis
             renderer.Draw(*m_CubeMesh, cubeTransform);
         }
 
-        // Render trees from all loaded chunks
-        if (m_TreeMesh)
-        {
-            for (const auto &pos : m_ChunkManager.GetAllTreePositions())
-            {
-                glm::mat4 treeTransform = glm::translate(glm::mat4(1.0f), pos);
-                renderer.Draw(*m_TreeMesh, treeTransform);
-            }
-        }
-
-        // Render rocks from all loaded chunks
-        if (m_RockMesh)
-        {
-            for (const auto &pos : m_ChunkManager.GetAllRockPositions())
-            {
-                glm::mat4 rockTransform = glm::translate(glm::mat4(1.0f), pos);
-                renderer.Draw(*m_RockMesh, rockTransform);
-            }
-        }
+        // Trees and rocks draw from persistent instance buffers; one
+        // instanced draw per mesh, re-uploaded only on chunk load/unload
+        // (the renderer wraps them in the "Vegetation" GPU zone)
+        renderer.DrawInstanced();
 
         renderer.EndScene();
     }
@@ -222,15 +262,30 @@ namespace Genesis
             m_TerrainPanel->Render();
         }
 
+        // Performance panel: frame graph, stage bars, streaming gauges
+        if (m_PerformancePanel)
+        {
+            m_PerformancePanel->Render();
+        }
+
         // Render debug/stats overlay
         ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
         ImGui::SetNextWindowSize(ImVec2(250, 200), ImGuiCond_FirstUseEver);
         ImGui::Begin("Stats & Controls", nullptr, ImGuiWindowFlags_NoCollapse);
 
         ImGui::Text("FPS: %.1f (%.2f ms)", 1.0f / m_FrameTime, m_FrameTime * 1000.0f);
+
+        // Per-stage CPU/GPU breakdowns, graphs and streaming gauges live
+        // in the Performance panel; this overlay stays headline-only
+        const auto &stats = Application::Get().GetRenderer().GetStats();
+        if (!stats.GpuZones.empty())
+        {
+            ImGui::Text("GPU: %.2f ms", stats.GpuTime);
+        }
+
         ImGui::Text("Chunks: %d", m_ChunkManager.GetLoadedChunkCount());
-        ImGui::Text("Trees: %zu", m_ChunkManager.GetAllTreePositions().size());
-        ImGui::Text("Rocks: %zu", m_ChunkManager.GetAllRockPositions().size());
+        ImGui::Text("Trees: %zu", m_ChunkManager.GetAllTreeInstances().size());
+        ImGui::Text("Rocks: %zu", m_ChunkManager.GetAllRockInstances().size());
 
         ImGui::Separator();
         ImGui::Text("Camera Position:");
@@ -266,10 +321,11 @@ namespace Genesis
 
         auto &device = Application::Get().GetRenderer().GetDevice();
 
-        // Create shared object meshes
-        m_CubeMesh = Mesh::CreateCube(device, {0.8f, 0.2f, 0.2f});
-        m_TreeMesh = Mesh::CreateLowPolyTree(device);
-        m_RockMesh = Mesh::CreateLowPolyRock(device);
+        // Shared primitive meshes from the renderer's cache
+        auto &meshCache = Application::Get().GetRenderer().GetMeshCache();
+        m_CubeMesh = meshCache.GetCube({0.8f, 0.2f, 0.2f});
+        m_TreeMesh = meshCache.GetLowPolyTree();
+        m_RockMesh = meshCache.GetLowPolyRock();
 
         // Initialize chunk-based world
         WorldSettings worldSettings;
@@ -301,7 +357,14 @@ namespace Genesis
         worldSettings.terrainSettings.warpScale = 0.5f;
         worldSettings.terrainSettings.warpLevels = 2;
 
-        m_ChunkManager.Initialize(device, worldSettings);
+        m_ChunkManager.Initialize(device, worldSettings,
+                                  &Application::Get().GetRenderer().GetTerrainRenderer());
+
+        // Vegetation beyond the streamed chunk radius cannot exist, so cap
+        // the GPU distance cull at the loaded world edge
+        float loadedRadius = (worldSettings.viewDistance + 1) *
+                             worldSettings.chunkSize * worldSettings.cellSize;
+        Application::Get().GetRenderer().GetInstancedRenderer().SetMaxDrawDistance(loadedRadius);
 
         // Initial chunk load
         m_ChunkManager.Update(m_CameraPosition);
@@ -310,6 +373,9 @@ namespace Genesis
         m_TerrainPanel = std::make_unique<TerrainSettingsPanel>();
         m_TerrainPanel->Initialize(device, m_ChunkManager);
 
+        m_PerformancePanel = std::make_unique<PerformancePanel>();
+        m_PerformancePanel->Initialize(m_ChunkManager);
+
         // Setup lighting
         SetupLighting();
 
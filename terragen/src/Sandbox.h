@@ -2,18 +2,23 @@
 
 #include <genesis/Genesis.h>
 #include <memory>
+#include <string>
 
 namespace Genesis
 {
 
     class TerrainSettingsPanel;
+    class PerformancePanel;
+    class BenchmarkRunner;
     class ImGuiLayer;
 
     // Sandbox layer for testing engine features
     class Sandbox : public Layer
     {
     public:
-        Sandbox();
+        // A non-empty benchmark prefix flies the scripted flythrough
+        // instead of taking input, writing <prefix>.csv/.json on finish
+        explicit Sandbox(std::string benchmarkPrefix = {});
         ~Sandbox() override;
 
         void OnAttach() override;
@@ -34,10 +39,13 @@ namespace Genesis
         // Chunk-based world
         ChunkManager m_ChunkManager;
 
-        // Shared meshes for objects
-        std::unique_ptr<Mesh> m_CubeMesh;
-        std::unique_ptr<Mesh> m_TreeMesh;
-        std::unique_ptr<Mesh> m_RockMesh;
+        // Shared primitives from the renderer's mesh cache
+        std::shared_ptr<Mesh> m_CubeMesh;
+        std::shared_ptr<Mesh> m_TreeMesh;
+        std::shared_ptr<Mesh> m_RockMesh;
+
+        // Last ChunkManager objects version pushed to the instanced renderer
+        uint64_t m_VegetationVersion = 0;
 
         // Camera controller state
         glm::vec3 m_CameraPosition{0.0f, 15.0f, 40.0f};
@@ -59,7 +67,12 @@ namespace Genesis
 
         // UI
         std::unique_ptr<TerrainSettingsPanel> m_TerrainPanel;
+        std::unique_ptr<PerformancePanel> m_PerformancePanel;
         bool m_ShowUI = true;
+
+        // Benchmark mode (see BenchmarkRunner.h)
+        std::string m_BenchmarkPrefix;
+        std::unique_ptr<BenchmarkRunner> m_Benchmark;
     };
 
 }
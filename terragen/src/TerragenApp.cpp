@@ -1,11 +1,13 @@
 #include "TerragenApp.h"
 #include "Sandbox.h"
 
+#include <cstring>
+
 namespace Genesis
 {
 
-    TerragenApp::TerragenApp(const ApplicationConfig &config)
-        : Application(config)
+    TerragenApp::TerragenApp(const ApplicationConfig &config, std::string benchmarkPrefix)
+        : Application(config), m_BenchmarkPrefix(std::move(benchmarkPrefix))
     {
     }
 
@@ -19,7 +21,7 @@ namespace Genesis
         m_ImGuiLayer = new ImGuiLayer();
         PushOverlay(m_ImGuiLayer);
 
-        m_Sandbox = new Sandbox();
+        m_Sandbox = new Sandbox(m_BenchmarkPrefix);
         PushLayer(m_Sandbox);
     }
 
@@ -36,14 +38,28 @@ namespace Genesis
     // Application factory
     Application *CreateApplication(int argc, char **argv)
     {
+        std::string benchmarkPrefix;
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], "--benchmark") == 0)
+            {
+                benchmarkPrefix = "terragen_benchmark";
+                if (i + 1 < argc && argv[i + 1][0] != '-')
+                {
+                    benchmarkPrefix = argv[i + 1];
+                }
+            }
+        }
+
         ApplicationConfig config;
         config.Name = "Terragen";
         config.Window.Title = "Terragen";
         config.Window.Width = 1600;
         config.Window.Height = 900;
-        config.EnableValidationLayers = true;
+        // Validation layers distort timings too much to benchmark through
+        config.EnableValidationLayers = benchmarkPrefix.empty();
 
-        return new TerragenApp(config);
+        return new TerragenApp(config, std::move(benchmarkPrefix));
     }
 
 }
@@ -2,6 +2,8 @@
 
 #include <genesis/Genesis.h>
 
+#include <string>
+
 namespace Genesis
 {
 
@@ -11,7 +13,9 @@ namespace Genesis
     class TerragenApp : public Application
     {
     public:
-        TerragenApp(const ApplicationConfig &config);
+        // A non-empty benchmark prefix runs the scripted flythrough and
+        // exits (see BenchmarkRunner.h)
+        TerragenApp(const ApplicationConfig &config, std::string benchmarkPrefix = {});
         ~TerragenApp() override;
 
     protected:
@@ -22,6 +26,7 @@ namespace Genesis
     private:
         Sandbox *m_Sandbox = nullptr;
         ImGuiLayer *m_ImGuiLayer = nullptr;
+        std::string m_BenchmarkPrefix;
     };
 
 }
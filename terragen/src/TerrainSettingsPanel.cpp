@@ -1,12 +1,16 @@
 #include "TerrainSettingsPanel.h"
+#include "genesis/core/Application.h"
+#include "genesis/renderer/Renderer.h"
 #include "genesis/renderer/VulkanDevice.h"
 #include "genesis/procedural/TerrainGenerator.h"
 #include "genesis/procedural/Noise.h"
 #include "genesis/core/Log.h"
+#include "genesis/world/SettingsPreset.h"
 
 #include <imgui.h>
 #include <algorithm>
 #include <cmath>
+#include <filesystem>
 
 namespace Genesis
 {
@@ -44,11 +48,25 @@ namespace Genesis
         m_HeightmapTexture = std::make_unique<HeightmapTexture>();
         m_HeightmapTexture->Create(device, PREVIEW_SIZE, PREVIEW_SIZE);
 
+        m_MinimapTexture = std::make_unique<HeightmapTexture>();
+        // The minimap is drawn far below native size, so store it as a
+        // single 16-bit height channel with a mip chain: half the upload
+        // bandwidth, and the widget samples the right level instead of
+        // magnifying the full base texture
+        m_MinimapTexture->Create(device, MINIMAP_SIZE, MINIMAP_SIZE,
+                                 HeightmapTexture::Format::R16, true);
+
         m_NeedsPreviewUpdate = true;
     }
 
     void TerrainSettingsPanel::Shutdown()
     {
+        m_MinimapBuilder.Cancel();
+        if (m_MinimapTexture)
+        {
+            m_MinimapTexture->Destroy();
+            m_MinimapTexture.reset();
+        }
         if (m_HeightmapTexture)
         {
             m_HeightmapTexture->Destroy();
@@ -91,24 +109,61 @@ namespace Genesis
         ImGui::Separator();
         RenderWaterSection();
         ImGui::Separator();
+        RenderSavedPresetsSection();
+        ImGui::Separator();
         RenderDebugViewSection();
         ImGui::Separator();
 
         ImGui::Spacing();
+        ImGui::Checkbox("Live Update", &m_LiveUpdate);
+        if (ImGui::IsItemHovered())
+            ImGui::SetTooltip("Rebuilds the world automatically once a setting stops\nchanging; while dragging, only the nearest chunk\nregenerates at preview quality.");
+
         if (ImGui::Button("Apply Changes", ImVec2(-1, 30)))
         {
             GEN_INFO("Apply Changes button clicked!");
+            m_SettingsDirty = false;
             ApplySettings();
         }
         if (ImGui::IsItemHovered())
             ImGui::SetTooltip("Rebuilds terrain chunks using the current settings.\nTip: the preview updates live; the world updates when you Apply.");
 
+        // Upload overview tiles finished since last frame (partial texture
+        // updates; a frame with no completed tiles costs nothing)
+        if (m_MinimapTexture)
+        {
+            m_MinimapBuilder.ApplyCompletedTiles(*m_MinimapTexture);
+        }
+
         if (m_NeedsPreviewUpdate)
         {
             UpdateHeightmapPreview();
             m_NeedsPreviewUpdate = false;
+            if (m_LiveUpdate && m_HasRenderedOnce && !m_SuppressLiveApply)
+            {
+                m_SettingsDirty = true;
+                m_TimeSinceChange = 0.0f;
+            }
+            m_SuppressLiveApply = false;
         }
 
+        // Debounce: a dragging slider resets the timer every frame, so only
+        // the cheap single-chunk preview runs until the value settles
+        if (m_SettingsDirty)
+        {
+            m_TimeSinceChange += ImGui::GetIO().DeltaTime;
+            if (m_TimeSinceChange >= APPLY_DEBOUNCE_SECONDS)
+            {
+                m_SettingsDirty = false;
+                ApplySettings();
+            }
+            else if (m_ChunkManager)
+            {
+                m_ChunkManager->PreviewChunkAtCamera(m_TerrainSettings);
+            }
+        }
+
+        m_HasRenderedOnce = true;
         ImGui::End();
     }
 
@@ -146,6 +201,117 @@ namespace Genesis
         }
     }
 
+    void TerrainSettingsPanel::RenderSavedPresetsSection()
+    {
+        if (!ImGui::CollapsingHeader("Saved Presets"))
+            return;
+
+        if (m_SavedPresetsDirty)
+        {
+            m_SavedPresets = SettingsPreset::List(PRESET_DIRECTORY);
+            m_SavedPresetsDirty = false;
+        }
+
+        ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x - 60.0f);
+        ImGui::InputText("##preset_name", m_PresetNameBuffer, sizeof(m_PresetNameBuffer));
+        ImGui::SameLine();
+        if (ImGui::Button("Save") && m_PresetNameBuffer[0] != '\0' && m_ChunkManager)
+        {
+            // Snapshot the panel state over the live settings so fields the
+            // panel doesn't edit (budgets, hydrology distances) carry over
+            WorldSettings snapshot = m_ChunkManager->GetSettings();
+            snapshot.terrainSettings = m_TerrainSettings;
+            snapshot.seaLevelNormalized = m_SeaLevelNormalized;
+            snapshot.waterEnabled = m_WaterEnabled;
+            snapshot.useOceanMask = m_UseOceanMask;
+            snapshot.viewDistance = m_ViewDistance;
+            snapshot.seed = m_Seed;
+            snapshot.ComputeSeaLevel();
+
+            std::string path = SettingsPreset::PathFor(PRESET_DIRECTORY, m_PresetNameBuffer);
+            if (SettingsPreset::Save(path, snapshot))
+            {
+                GEN_INFO("Saved preset '{}'", m_PresetNameBuffer);
+                m_SavedPresetsDirty = true;
+            }
+        }
+        if (ImGui::IsItemHovered())
+            ImGui::SetTooltip("Writes the current settings to presets/<name>%s.\nThe file keys the chunk disk cache, so a saved world\nreloads from cache after switching back.", SettingsPreset::FILE_EXTENSION);
+
+        if (m_SavedPresets.empty())
+        {
+            ImGui::TextDisabled("No saved presets");
+            return;
+        }
+
+        for (int i = 0; i < static_cast<int>(m_SavedPresets.size()); i++)
+        {
+            const std::string &name = m_SavedPresets[i];
+            ImGui::PushID(i);
+            if (ImGui::Button("Load"))
+            {
+                LoadPresetFile(name);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("X"))
+            {
+                std::error_code ec;
+                std::filesystem::remove(SettingsPreset::PathFor(PRESET_DIRECTORY, name), ec);
+                m_SavedPresetsDirty = true;
+            }
+            if (ImGui::IsItemHovered())
+                ImGui::SetTooltip("Delete this preset file");
+            ImGui::SameLine();
+            ImGui::TextUnformatted(name.c_str());
+            ImGui::PopID();
+        }
+    }
+
+    void TerrainSettingsPanel::LoadPresetFile(const std::string &name)
+    {
+        if (!m_ChunkManager)
+            return;
+
+        // Start from the live settings so machine-local fields the preset
+        // doesn't carry keep their current values
+        WorldSettings loaded = m_ChunkManager->GetSettings();
+        if (!SettingsPreset::Load(SettingsPreset::PathFor(PRESET_DIRECTORY, name), loaded))
+            return;
+
+        auto &worldSettings = m_ChunkManager->GetSettings();
+        if (loaded.chunkSize != worldSettings.chunkSize ||
+            loaded.cellSize != worldSettings.cellSize)
+        {
+            // Loaded chunk objects are sized at construction; honor the
+            // preset's grid on the next app start instead of mid-session
+            GEN_WARN("Preset '{}' changes chunk size/cell size; applied on next launch", name);
+            loaded.chunkSize = worldSettings.chunkSize;
+            loaded.cellSize = worldSettings.cellSize;
+        }
+        worldSettings.hydrologyDistance = loaded.hydrologyDistance;
+        worldSettings.coarseHydrologyDistance = loaded.coarseHydrologyDistance;
+        worldSettings.stitchDrainage = loaded.stitchDrainage;
+        worldSettings.progressiveRefinement = loaded.progressiveRefinement;
+
+        m_TerrainSettings = loaded.terrainSettings;
+        m_SeaLevelNormalized = loaded.seaLevelNormalized;
+        m_SeaLevel = loaded.seaLevel;
+        m_WaterEnabled = loaded.waterEnabled;
+        m_UseOceanMask = loaded.useOceanMask;
+        m_ViewDistance = loaded.viewDistance;
+        m_Seed = loaded.seed;
+        UpdatePresetSelection();
+
+        GEN_INFO("Loaded preset '{}'", name);
+
+        // Straight onto the prioritized incremental rebuild: old chunks
+        // keep rendering while replacements arrive nearest-first
+        m_NeedsPreviewUpdate = true;
+        m_SuppressLiveApply = true;
+        m_SettingsDirty = false;
+        ApplySettings();
+    }
+
     void TerrainSettingsPanel::RenderIntentSection()
     {
         if (ImGui::CollapsingHeader("Terrain Intent", ImGuiTreeNodeFlags_DefaultOpen))
@@ -255,15 +421,30 @@ namespace Genesis
     {
         if (ImGui::CollapsingHeader("Heightmap Preview", ImGuiTreeNodeFlags_DefaultOpen))
         {
-            if (m_HeightmapTexture && m_HeightmapTexture->IsValid())
+            // Height views show the progressive world overview; debug views
+            // keep the small synchronously-generated visualization texture
+            DebugViewType viewType = static_cast<DebugViewType>(m_DebugViewIndex);
+            bool useMinimap = (viewType == DebugViewType::None ||
+                               viewType == DebugViewType::Height) &&
+                              m_MinimapTexture && m_MinimapTexture->IsValid();
+            HeightmapTexture *shown = useMinimap ? m_MinimapTexture.get()
+                                                 : m_HeightmapTexture.get();
+
+            if (shown && shown->IsValid())
             {
                 float availWidth = ImGui::GetContentRegionAvail().x;
                 float previewSize = std::min(availWidth, 256.0f);
 
                 ImGui::SetCursorPosX((ImGui::GetWindowWidth() - previewSize) * 0.5f);
-                ImGui::Image(reinterpret_cast<ImTextureID>(m_HeightmapTexture->GetDescriptorSet()),
+                ImGui::Image(reinterpret_cast<ImTextureID>(shown->GetDescriptorSet()),
                              ImVec2(previewSize, previewSize));
 
+                if (useMinimap && m_MinimapBuilder.IsBuilding())
+                {
+                    ImGui::TextDisabled("Refining... %d%%",
+                                        static_cast<int>(m_MinimapBuilder.GetProgress() * 100.0f));
+                }
+
                 if (ImGui::Button("Refresh Preview", ImVec2(-1, 0)))
                 {
                     m_NeedsPreviewUpdate = true;
@@ -595,10 +776,31 @@ namespace Genesis
         }
     }
 
+    // Debug views the terrain fragment shader colorizes from the field
+    // atlas; must match the mode switch in lowpoly_flat.frag. Zero means
+    // the view (if any) uses the baked vertex-color path.
+    static int GpuDebugMode(DebugViewType view)
+    {
+        switch (view)
+        {
+        case DebugViewType::Height:
+            return 1;
+        case DebugViewType::FlowAccumulation:
+            return 2;
+        case DebugViewType::Moisture:
+            return 3;
+        case DebugViewType::DominantBiome:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+
     void TerrainSettingsPanel::RenderDebugViewSection()
     {
         if (ImGui::CollapsingHeader("Debug Views (Section 32)"))
         {
+            bool overlayChanged = false;
             ImGui::TextWrapped("Visualize intermediate terrain fields for debugging and validation.");
             ImGui::Spacing();
 
@@ -623,11 +825,17 @@ namespace Genesis
             {
                 m_DebugView.GetSettings().activeView = static_cast<DebugViewType>(m_DebugViewIndex);
                 m_NeedsPreviewUpdate = true;
+                overlayChanged = true;
+                // Atlas-backed views (and None) need no world rebuild, so
+                // don't let the live-update debounce trigger one
+                if (GpuDebugMode(static_cast<DebugViewType>(m_DebugViewIndex)) != 0 || m_DebugViewIndex == 0)
+                    m_SuppressLiveApply = true;
             }
 
             if (m_DebugViewIndex > 0)
             {
-                ImGui::SliderFloat("Overlay Opacity", &m_DebugView.GetSettings().overlayOpacity, 0.0f, 1.0f, "%.2f");
+                if (ImGui::SliderFloat("Overlay Opacity", &m_DebugView.GetSettings().overlayOpacity, 0.0f, 1.0f, "%.2f"))
+                    overlayChanged = true;
                 if (ImGui::IsItemHovered())
                     ImGui::SetTooltip("Transparency of the debug overlay.\n0 = invisible, 1 = fully opaque.");
 
@@ -685,13 +893,18 @@ namespace Genesis
                     ImGui::BulletText("Blue: Water");
                 }
 
+                if (GpuDebugMode(static_cast<DebugViewType>(m_DebugViewIndex)) != 0)
+                {
+                    ImGui::Separator();
+                    ImGui::TextColored(ImVec4(0.5f, 1.0f, 0.5f, 1.0f),
+                                       "Shown in-world immediately (GPU overlay) -\n"
+                                       "no Apply Changes needed.");
+                }
                 // Note for complex views that require full pipeline
-                if (m_DebugViewIndex == static_cast<int>(DebugViewType::FlowDirection) ||
-                    m_DebugViewIndex == static_cast<int>(DebugViewType::FlowAccumulation) ||
-                    m_DebugViewIndex == static_cast<int>(DebugViewType::WaterType) ||
-                    m_DebugViewIndex == static_cast<int>(DebugViewType::DistanceToWater) ||
-                    m_DebugViewIndex == static_cast<int>(DebugViewType::DominantBiome) ||
-                    m_DebugViewIndex == static_cast<int>(DebugViewType::DominantMaterial))
+                else if (m_DebugViewIndex == static_cast<int>(DebugViewType::FlowDirection) ||
+                         m_DebugViewIndex == static_cast<int>(DebugViewType::WaterType) ||
+                         m_DebugViewIndex == static_cast<int>(DebugViewType::DistanceToWater) ||
+                         m_DebugViewIndex == static_cast<int>(DebugViewType::DominantMaterial))
                 {
                     ImGui::Separator();
                     ImGui::TextColored(ImVec4(1.0f, 0.7f, 0.3f, 1.0f),
@@ -699,6 +912,16 @@ namespace Genesis
                                        "Preview shows heightmap. Full view available in-world.");
                 }
             }
+
+            if (overlayChanged)
+            {
+                // Atlas-backed views take effect on the next frame without
+                // touching any chunk; the remaining views keep the baked
+                // vertex-color path and still need Apply Changes
+                Application::Get().GetRenderer().SetDebugView(
+                    GpuDebugMode(static_cast<DebugViewType>(m_DebugViewIndex)),
+                    m_DebugView.GetSettings().overlayOpacity);
+            }
         }
     }
 
@@ -739,6 +962,20 @@ namespace Genesis
         previewSettings.seed = m_Seed;
         previewSettings.flatShading = true;
 
+        DebugViewType viewType = static_cast<DebugViewType>(m_DebugViewIndex);
+
+        if (viewType == DebugViewType::None || viewType == DebugViewType::Height)
+        {
+            // Height views build the large overview progressively on
+            // worker threads; restarting cancels a build still in flight
+            if (m_MinimapTexture && m_MinimapTexture->IsValid())
+            {
+                m_MinimapBuilder.Start(previewSettings, MINIMAP_SIZE,
+                                       previewSettings.cellSize);
+            }
+            return;
+        }
+
         TerrainGenerator previewGenerator(previewSettings);
 
         // Generate heightmap using the canonical algorithm
@@ -756,15 +993,7 @@ namespace Genesis
         const int width = PREVIEW_SIZE;
         const int depth = PREVIEW_SIZE;
 
-        DebugViewType viewType = static_cast<DebugViewType>(m_DebugViewIndex);
-
-        // For non-height debug views, generate the appropriate visualization
-        if (viewType == DebugViewType::None || viewType == DebugViewType::Height)
-        {
-            // Default: grayscale heightmap
-            m_HeightmapTexture->Update(heightData, minHeight, maxHeight);
-        }
-        else if (viewType == DebugViewType::Slope)
+        if (viewType == DebugViewType::Slope)
         {
             // Compute slope from heightmap
             std::vector<float> slopeData(heightData.size());
@@ -5,6 +5,7 @@
 #include "genesis/procedural/TerrainDebugView.h"
 #include "genesis/renderer/HeightmapTexture.h"
 #include "genesis/world/ChunkManager.h"
+#include "MinimapBuilder.h"
 #include <memory>
 
 namespace Genesis
@@ -59,6 +60,9 @@ namespace Genesis
         void RenderWaterSection();
         void RenderPreviewSection();
         void RenderDebugViewSection();
+        void RenderSavedPresetsSection();
+
+        void LoadPresetFile(const std::string &name);
 
         void UpdateHeightmapPreview();
         void ApplySettings();
@@ -86,14 +90,39 @@ namespace Genesis
         uint32_t m_Seed = 42;
 
         std::unique_ptr<HeightmapTexture> m_HeightmapTexture;
+
+        // Progressive world overview: built coarse-to-fine on job system
+        // workers, refined with partial texture updates each frame
+        std::unique_ptr<HeightmapTexture> m_MinimapTexture;
+        MinimapBuilder m_MinimapBuilder;
+
         bool m_SettingsChanged = false;
         bool m_NeedsPreviewUpdate = true;
 
+        // Debounced live apply: while a value keeps changing (slider drag)
+        // only the camera's chunk regenerates at preview quality; the full
+        // prioritized rebuild fires once the value has settled
+        bool m_LiveUpdate = true;
+        bool m_SettingsDirty = false;
+        float m_TimeSinceChange = 0.0f;
+        // Set by changes the GPU debug overlay already covers, so they
+        // refresh the panel preview without rebuilding the world
+        bool m_SuppressLiveApply = false;
+        bool m_HasRenderedOnce = false;
+        static constexpr float APPLY_DEBOUNCE_SECONDS = 0.15f;
+
         // Debug view settings
         int m_DebugViewIndex = 0;
         TerrainDebugView m_DebugView;
 
+        // Saved preset browser (versioned binary files on disk)
+        char m_PresetNameBuffer[64] = "";
+        std::vector<std::string> m_SavedPresets;
+        bool m_SavedPresetsDirty = true;
+        static constexpr const char *PRESET_DIRECTORY = "presets";
+
         static constexpr int PREVIEW_SIZE = 128;
+        static constexpr int MINIMAP_SIZE = 1024;
     };
 
 }
@@ -1,6 +1,44 @@
 #include "TerragenApp.h"
 
+#include <genesis/world/DeterminismValidator.h>
+#include <genesis/world/HeadlessBenchmark.h>
+#include <genesis/world/TerrainExporter.h>
+#include <cstdlib>
+#include <cstring>
+
 int main(int argc, char** argv) {
+    // Headless modes run without a window or Vulkan instance and exit
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--validate-determinism") == 0) {
+            // Verify parallel chunk generation matches serial
+            return Genesis::DeterminismValidator::RunStandalone();
+        }
+        if (std::strcmp(argv[i], "--headless") == 0) {
+            // Batch-generate an N x N grid (optional next argument),
+            // benchmarking the pipeline and pre-baking the disk cache
+            int gridSize = 8;
+            if (i + 1 < argc) {
+                int parsed = std::atoi(argv[i + 1]);
+                if (parsed > 0) {
+                    gridSize = parsed;
+                }
+            }
+            return Genesis::HeadlessBenchmark::RunStandalone(gridSize);
+        }
+        if (std::strcmp(argv[i], "--export") == 0) {
+            // Export an N x N cell world (optional next argument) as
+            // tiled heightmap and splatmap images
+            int worldSize = 8192;
+            if (i + 1 < argc) {
+                int parsed = std::atoi(argv[i + 1]);
+                if (parsed > 0) {
+                    worldSize = parsed;
+                }
+            }
+            return Genesis::TerrainExporter::RunStandalone(worldSize);
+        }
+    }
+
     auto app = Genesis::CreateApplication(argc, argv);
     app->Run();
     delete app;